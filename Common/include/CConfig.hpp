@@ -96,6 +96,8 @@ private:
   bool ActDisk_DoubleSurface;     /*!< \brief actuator disk double surface  */
   bool Engine_HalfModel;          /*!< \brief only half model is in the computational grid  */
   bool ActDisk_SU2_DEF;           /*!< \brief actuator disk double surface  */
+  bool ActDisk_BodyForce;         /*!< \brief Model the actuator disks of the input file as volume forces. */
+  su2double ActDisk_BodyForce_Thickness; /*!< \brief Axial thickness of the body force actuator disks. */
   unsigned short nFFD_Iter;       /*!< \brief Iteration for the point inversion problem. */
   unsigned short FFD_Blending;    /*!< \brief Kind of FFD Blending function. */
   su2double FFD_Tol;              /*!< \brief Tolerance in the point inversion problem. */
@@ -141,6 +143,9 @@ private:
   unsigned long Bc_Eval_Freq;      /*!< \brief Evaluation frequency for Engine and Actuator disk markers. */
   su2double Damp_Res_Restric,     /*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong;            /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_ParallelAgglomeration;  /*!< \brief Thread-parallel agglomeration of the interior control volumes. */
+  bool MG_MergeSingletons;        /*!< \brief Merge isolated leftover control volumes into their neighbors. */
+  bool MG_ScalarSolvers;          /*!< \brief Apply the FAS multigrid also to the turbulence and species solvers. */
   su2double Position_Plane;    /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd;          /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL;           /*!< \brief Fixed Cl mode derivate . */
@@ -154,6 +159,7 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool Fused_Gradient_Limiter;       /*!< \brief Compute the flow limiters together with the reconstruction gradients. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   ENUM_REGIME Kind_Regime;           /*!< \brief Kind of flow regime: in/compressible. */
@@ -322,6 +328,9 @@ private:
   su2double *HeatTransfer_WallTemp;          /*!< \brief Specified temperatures at infinity alongside heat transfer coefficients. */
   su2double *Heat_Flux;                      /*!< \brief Specified wall heat fluxes. */
   su2double *Roughness_Height;               /*!< \brief Equivalent sand grain roughness for the marker according to config file. */
+  bool WallDistance_Distributed;             /*!< \brief Distribute the wall elements across ranks for the wall distance. */
+  su2double WallDistance_Band;               /*!< \brief Width of the band of points whose wall distance is updated on moving meshes. */
+  unsigned long WallDistance_PeriodicCache; /*!< \brief Max. time steps per revolution whose wall distances are cached. */
   su2double *Displ_Value;                    /*!< \brief Specified displacement for displacement boundaries. */
   su2double *Load_Value;                     /*!< \brief Specified force for load boundaries. */
   su2double *Damper_Constant;                /*!< \brief Specified constant for damper boundaries. */
@@ -414,6 +423,9 @@ private:
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
+  bool Unst_Adjoint_Recompute;      /*!< \brief Recompute the direct solutions without restart file for the unsteady adjoint. */
+  bool Vector_Adjoint;              /*!< \brief One discrete adjoint per objective function, with vector mode tape evaluations. */
+  unsigned long Unst_Adjoint_Snapshots; /*!< \brief Number of recomputed direct solutions kept in memory. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
   unsigned short nLevels_TimeAccurateLTS;   /*!< \brief Number of time levels for time accurate local time stepping. */
@@ -423,13 +435,25 @@ private:
   su2double *TimeIntegrationADER_DG;        /*!< \brief The location of the ADER-DG time integration points on the interval [-1,1]. */
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
+  unsigned short JFNK_Newton_Iter;          /*!< \brief Maximum number of Newton iterations per time step of the implicit DG scheme. */
+  su2double JFNK_Newton_Tol;                /*!< \brief Relative reduction of the nonlinear residual of the implicit DG scheme. */
+  unsigned long JFNK_Precond_Rebuild;       /*!< \brief Time steps between rebuilds of the element block-Jacobi preconditioner. */
+  unsigned long LoadBalance_Freq_FEM;       /*!< \brief Time steps between measurements of the load balance of the DG solver. */
+  string WorkWeights_FileName_FEM;          /*!< \brief File with measured work of the DG elements, used in the partitioning. */
+  bool Threaded_Task_Scheduler_FEM;         /*!< \brief Whether the tasks of the DG solver are executed concurrently by the OpenMP threads. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
+  bool ResidualSmoothing;                   /*!< \brief Implicit residual smoothing of the explicit flow schemes. */
+  su2double ResidualSmoothing_Coeff;        /*!< \brief Coefficient of the implicit residual smoothing. */
+  unsigned short ResidualSmoothing_Iter;    /*!< \brief Number of Jacobi iterations of the implicit residual smoothing. */
+  bool LineImplicitSmoothing;               /*!< \brief Line-implicit smoothing of the explicit flow schemes. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
   bool UseVectorization;       /*!< \brief Whether to use vectorized numerics schemes. */
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NK_FrozenGradients;     /*!< \brief Freeze gradients and limiters during the matrix-free products of the NK method. */
+  bool NK_AssembledJacobian;   /*!< \brief Assemble the Jacobian of the NK method by colored finite differences. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -441,6 +465,8 @@ private:
   CFLFineGrid,                 /*!< \brief CFL of the finest grid. */
   Max_DeltaTime,               /*!< \brief Max delta time. */
   Unst_CFL;                    /*!< \brief Unsteady CFL number. */
+  bool Time_Extrapolation;     /*!< \brief Initialize the inner iterations by extrapolation of the time levels. */
+  su2double Time_Extrapolation_Tol; /*!< \brief Ratio of initial residuals above which the extrapolation is undone. */
 
   TURBO_PERF_KIND *Kind_TurboPerf;           /*!< \brief Kind of turbomachynery architecture.*/
   TURBOMACHINERY_TYPE *Kind_TurboMachinery;
@@ -487,7 +513,11 @@ private:
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
   unsigned short nMG_PreSmooth,       /*!< \brief Number of MG pre-smooth parameters found in config file. */
   nMG_PostSmooth,                     /*!< \brief Number of MG post-smooth parameters found in config file. */
-  nMG_CorrecSmooth;                   /*!< \brief Number of MG correct-smooth parameters found in config file. */
+  nMG_CorrecSmooth,                   /*!< \brief Number of MG correct-smooth parameters found in config file. */
+  nFullMG_Iter,                       /*!< \brief Number of grid sequencing iterations found in config file. */
+  nFullMG_CFL;                        /*!< \brief Number of grid sequencing CFL numbers found in config file. */
+  unsigned long *FullMG_Iter;         /*!< \brief Grid sequencing iterations of each coarse grid (MESH_1, ...). */
+  su2double *FullMG_CFL;              /*!< \brief CFL of each coarse grid while it is the finest grid (MESH_1, ...). */
   short *FFD_Fix_IDir,
   *FFD_Fix_JDir, *FFD_Fix_KDir;       /*!< \brief Exact sections. */
   unsigned short *MG_PreSmooth,       /*!< \brief Multigrid Pre smoothing. */
@@ -496,12 +526,15 @@ private:
   su2double *LocationStations;        /*!< \brief Airfoil sections in wing slicing subroutine. */
 
   ENUM_MULTIZONE Kind_MZSolver;    /*!< \brief Kind of multizone solver.  */
+  bool Multizone_ConcurrentZones;  /*!< \brief Solve the zones concurrently in block-Jacobi iterations. */
   INC_DENSITYMODEL Kind_DensityModel; /*!< \brief Kind of the density model for incompressible flows. */
   CHT_COUPLING Kind_CHT_Coupling;  /*!< \brief Kind of coupling method used at CHT interfaces. */
+  bool Heat_Frozen_System;         /*!< \brief Reuse the conduction matrix and preconditioner of solid zones. */
   VISCOSITYMODEL Kind_ViscosityModel; /*!< \brief Kind of the Viscosity Model*/
   MIXINGVISCOSITYMODEL Kind_MixingViscosityModel; /*!< \brief Kind of the mixing Viscosity Model*/
   CONDUCTIVITYMODEL Kind_ConductivityModel; /*!< \brief Kind of the Thermal Conductivity Model */
   CONDUCTIVITYMODEL_TURB Kind_ConductivityModel_Turb; /*!< \brief Kind of the Turbulent Thermal Conductivity Model */
+  su2double Transport_Cache_Tol;     /*!< \brief Relative tolerance for reusing the transport properties of a point. */
   DIFFUSIVITYMODEL Kind_Diffusivity_Model; /*!< \brief Kind of the mass diffusivity Model */
   FREESTREAM_OPTION Kind_FreeStreamOption; /*!< \brief Kind of free stream option to choose if initializing with density or temperature  */
   MAIN_SOLVER Kind_Solver;         /*!< \brief Kind of solver: Euler, NS, Continuous adjoint, etc.  */
@@ -539,6 +572,14 @@ private:
   ENUM_DATADRIVEN_METHOD Kind_DataDriven_Method;       /*!< \brief Method used for datset regression in data-driven fluid models. */
 
   su2double DataDriven_Relaxation_Factor; /*!< \brief Relaxation factor for Newton solvers in data-driven fluid models. */
+  bool LUT_Write_Binary;                  /*!< \brief Write the binary version of ASCII lookup tables. */
+  bool LUT_Search_Grid;                   /*!< \brief Locate points in lookup tables with a uniform search grid. */
+  bool LUT_Structured;                    /*!< \brief Interpolate regular lookup table levels bilinearly. */
+  bool LUT_Generate;                      /*!< \brief Generate the lookup table of the data-driven fluid model. */
+  unsigned short Kind_LUT_Generate_FluidModel; /*!< \brief Fluid model tabulated by the generated lookup table. */
+  array<su2double,4> LUT_Generate_Range{{0.0, 0.0, 0.0, 0.0}}; /*!< \brief Density and energy range of the generated table. */
+  array<unsigned short,2> LUT_Generate_Levels{{4, 10}}; /*!< \brief Base and maximum refinement levels of the generated table. */
+  su2double LUT_Generate_Tolerance;       /*!< \brief Refinement tolerance of the generated table. */
 
   STRUCT_TIME_INT Kind_TimeIntScheme_FEA;    /*!< \brief Time integration for the FEA equations. */
   STRUCT_SPACE_ITE Kind_SpaceIteScheme_FEA;  /*!< \brief Iterative scheme for nonlinear structural analysis. */
@@ -571,6 +612,7 @@ private:
   FEM_SHOCK_CAPTURING_DG Kind_FEM_Shock_Capturing_DG; /*!< \brief Shock capturing method for the FEM DG solver. */
   BGS_RELAXATION Kind_BGS_RelaxMethod; /*!< \brief Kind of relaxation method for Block Gauss Seidel method in FSI problems. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
+  bool Cache_LeastSquares_Weights;     /*!< \brief Store the least-squares gradient weights of static meshes. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
@@ -600,6 +642,8 @@ private:
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
   bool AD_Preaccumulation;  /*!< \brief Enable or disable preaccumulation in the AD mode. */
+  bool Primal_Tape_Reuse;   /*!< \brief Re-evaluate the primal value tape instead of re-recording it. */
+  bool Inline_Gradient_Projection; /*!< \brief Project the sensitivities on the design variables at the end of SU2_CFD_AD. */
   STRUCT_COMPRESS Kind_Material_Compress;  /*!< \brief Determines if the material is compressible or incompressible (structural analysis). */
   STRUCT_MODEL Kind_Material;              /*!< \brief Determines the material model to be used (structural analysis). */
   STRUCT_DEFORMATION Kind_Struct_Solver;   /*!< \brief Determines the geometric condition (small or large deformations) for structural analysis. */
@@ -630,8 +674,17 @@ private:
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned long Linear_Solver_Recycle_Size;      /*!< \brief Number of vectors recycled between calls by RECYCLED_FGMRES. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_ILU_Level_Scheduling;       /*!< \brief Thread parallel ILU based on level scheduling. */
+  unsigned long Linear_Solver_Prec_Reuse;        /*!< \brief Maximum number of linear solves that reuse the preconditioner. */
+  su2double Linear_Solver_Prec_Reuse_Growth;     /*!< \brief Growth of the linear iterations that triggers a rebuild of the preconditioner. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_Refinement_Iter;  /*!< \brief Iterative refinement steps of mixed precision linear solvers. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Number of smoothing sweeps per level of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Relaxation;        /*!< \brief Damping factor of the AMG Jacobi smoother. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for the AMG aggregation. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -654,6 +707,18 @@ private:
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
   unsigned short Deform_StiffnessType;   /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  bool Deform_FrozenStiffness;           /*!< \brief Assemble the FEA mesh stiffness matrix only once. */
+  bool Deform_AdaptiveIncrement;         /*!< \brief Adapt the size of the mesh deformation increments. */
+  unsigned short Deform_MaxSubdivisions; /*!< \brief Maximum number of halvings of a failed deformation increment. */
+  bool Deform_WarmStart;                 /*!< \brief Warm start the linear solves of the mesh deformation. */
+  bool Deform_MatrixFree;                /*!< \brief Apply the stiffness of the mesh solver without assembling it. */
+  bool Incremental_DualGrid;             /*!< \brief Update the dual grid of moving meshes incrementally. */
+  su2double Incremental_DualGrid_Threshold; /*!< \brief Fraction of moved points to fully recompute the dual grid. */
+  DEFORM_METHOD Kind_Deform_Method;      /*!< \brief Method to deform the volume mesh. */
+  RADIAL_BASIS Kind_Deform_RBF;          /*!< \brief Radial basis function for RBF mesh deformation. */
+  su2double Deform_RBF_Radius;           /*!< \brief Support radius of the RBF mesh deformation. */
+  su2double Deform_RBF_GreedyTol;        /*!< \brief Relative tolerance of the greedy selection of RBF centers. */
+  unsigned long Deform_RBF_MaxCenters;   /*!< \brief Maximum number of RBF centers for mesh deformation. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
@@ -701,10 +766,24 @@ private:
   su2double Cauchy_Eps;               /*!< \brief Epsilon used for the convergence. */
   bool Restart,                       /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,                /*!< \brief Read binary SU2 native restart files.*/
+  Restart_Interpolation,              /*!< \brief Interpolate the restart from another mesh even if the sizes match.*/
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
+  Wrt_Async_Output,                   /*!< \brief Sort and write the result files on a background thread.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned short HDF5_Compression;    /*!< \brief Deflate level of the datasets in HDF5 output files. */
+  string *Catalyst_Scripts,           /*!< \brief Pipeline scripts of the Catalyst (in-situ) output. */
+  *Catalyst_Fields;                   /*!< \brief Volume output fields or groups passed to Catalyst. */
+  unsigned short nCatalyst_Scripts,   /*!< \brief Number of Catalyst pipeline scripts. */
+  nCatalyst_Fields;                   /*!< \brief Number of fields or groups passed to Catalyst. */
+  string Catalyst_Implementation;     /*!< \brief Name of the Catalyst implementation to load. */
+  string *Surface_Stream_Markers,     /*!< \brief Markers of the surface stream output. */
+  *Surface_Stream_Fields;             /*!< \brief Volume output fields or groups of the surface stream output. */
+  unsigned short nSurface_Stream_Markers, /*!< \brief Number of markers of the surface stream output. */
+  nSurface_Stream_Fields;             /*!< \brief Number of fields or groups of the surface stream output. */
+  RESTART_COMPRESSION Restart_Compression; /*!< \brief Compression of the binary restart files. */
+  su2double Restart_Compression_Tol;  /*!< \brief Relative error bound of the lossy restart compression. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -784,9 +863,33 @@ private:
   unsigned short output_precision;    /*!< \brief <ofstream>.precision(value) for SU2_DOT and HISTORY output */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
+  bool Time_Statistics;               /*!< \brief Compute running statistics of the flow in unsteady simulations. */
+  bool Time_Statistics_Single_Prec;   /*!< \brief Store the running statistics in single precision. */
+  string Time_Statistics_FileName;    /*!< \brief File with the state of the running statistics (for restarts). */
+  string* Spectral_Probes;            /*!< \brief History outputs whose power spectral density is computed. */
+  unsigned short nSpectral_Probes;    /*!< \brief Number of spectral probes. */
+  unsigned long Spectral_Window;      /*!< \brief Number of time steps of the windows of the spectral probes. */
+  unsigned long Checkpoint_Freq;      /*!< \brief Time iterations between node-local (buddy) checkpoints, 0 disables them. */
+  string Checkpoint_Dir;              /*!< \brief Node-local directory of the checkpoint files. */
+  bool Checkpoint_Restart;            /*!< \brief Restart from the node-local checkpoint instead of the restart files. */
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
+  CFL_ADAPT_METHOD Kind_CFL_Adapt;     /*!< \brief Method used to adapt the local CFL numbers. */
+  array<su2double,2> CFL_AdaptLocalParam{{0.5, 0.5}}; /*!< \brief Parameters of the local CFL adaption. */
+  bool ActiveSet;        /*!< \brief Freeze the converged regions of steady flow problems. */
+  array<su2double,3> ActiveSetParam{{1e-6, 5, 50}}; /*!< \brief Parameters of the active set (tol., iterations, sweep). */
+  bool NonlinearAcceleration;                /*!< \brief Anderson acceleration of the nonlinear iterations. */
+  unsigned short NonlinearAccelerationDepth; /*!< \brief Number of previous iterations of the Anderson acceleration. */
+  bool Coupled_Turb_Solve;                   /*!< \brief Single linear system for the mean flow and turbulence. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
+  unsigned short HB_InstanceGroups; /*!< \brief Number of rank groups sharing the harmonic balance instances. */
+  unsigned short TimeParallelGroups;  /*!< \brief Number of rank groups (time slices) of the parareal method. */
+  unsigned short Parareal_Iter;       /*!< \brief Maximum number of parareal iterations. */
+  unsigned short Parareal_Coarsening; /*!< \brief Ratio between the coarse and fine parareal time steps. */
+  su2double Parareal_Tol;             /*!< \brief Tolerance on the relative change of the slice initial states. */
+  string *Ensemble_Configs;           /*!< \brief Config files of the cases of an ensemble run. */
+  unsigned short nEnsemble_Configs;   /*!< \brief Number of cases of an ensemble run. */
+  unsigned short EnsembleGroups;      /*!< \brief Number of rank groups that run the ensemble cases concurrently. */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
   RefSharpEdges,         /*!< \brief Reference coefficient for detecting sharp edges. */
@@ -825,6 +928,10 @@ private:
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Runtime_Profiling,         /*!< \brief Time the main phases of the iterations.  */
+  Hardware_Counters,         /*!< \brief Make the profiled phases hardware counter regions.  */
+  Memory_History,            /*!< \brief Compute the memory high-water marks every iteration.  */
+  Huge_Pages,                /*!< \brief Use transparent huge pages for the large aligned allocations.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
@@ -896,6 +1003,7 @@ private:
   Temperature_FreeStream,          /*!< \brief Total temperature of the fluid.  */
   Temperature_ve_FreeStream;       /*!< \brief Total vibrational-electronic temperature of the fluid.  */
   unsigned short wallModel_MaxIter; /*!< \brief maximum number of iterations for the Newton method for the wall model */
+  bool wallModel_Table;             /*!< \brief Tabulated inverse law of the wall instead of Newton iterations */
   su2double wallModel_Kappa,        /*!< \brief von Karman constant kappa for turbulence wall modeling */
   wallModel_B,                      /*!< \brief constant B for turbulence wall modeling */
   wallModel_RelFac,                 /*!< \brief relaxation factor for the Newton method used in the wall model */
@@ -942,6 +1050,9 @@ private:
   su2double AitkenStatRelax;      /*!< \brief Aitken's relaxation factor (if set as static) */
   su2double AitkenDynMaxInit;     /*!< \brief Aitken's maximum dynamic relaxation factor for the first iteration */
   su2double AitkenDynMinInit;     /*!< \brief Aitken's minimum dynamic relaxation factor for the first iteration */
+  unsigned short QuasiNewtonFSI_MaxColumns;  /*!< \brief Maximum number of columns of the interface quasi-Newton history. */
+  unsigned short QuasiNewtonFSI_ReuseSteps;  /*!< \brief Number of time steps whose quasi-Newton history is reused. */
+  su2double QuasiNewtonFSI_Filter;           /*!< \brief Relative tolerance of the quasi-Newton QR filter. */
   bool RampAndRelease;            /*!< \brief option for ramp load and release */
   bool Sine_Load;                 /*!< \brief option for sine load */
   su2double Thermal_Diffusivity;  /*!< \brief Thermal diffusivity used in the heat solver. */
@@ -1038,6 +1149,7 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned short RadialBasisFunction_MaxDonors; /*!< \brief Maximum number of donors of the local RBF systems. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1047,11 +1159,24 @@ private:
   DV_Penalty;                       /*!< \brief Penalty weight to add a constraint to the total amount of stiffness. */
   array<su2double,2> StressPenaltyParam = {{1.0, 20.0}}; /*!< \brief Allowed stress and KS aggregation exponent. */
   unsigned long Nonphys_Points,     /*!< \brief Current number of non-physical points in the solution. */
-  Nonphys_Reconstr;                 /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
+  Nonphys_Reconstr,                 /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
+  Transport_Cache_Hits;             /*!< \brief Current number of points that reused their transport properties. */
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
-  unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
+  bool ParMETIS_Hierarchical;       /*!< \brief Two-level (node, then rank) partitioning. */
+  bool ParMETIS_PointCost;          /*!< \brief Weight the points by their measured cost for ParMETIS. */
+  unsigned long PointCost_Profiling_Iter; /*!< \brief Iterations over which the cost of each point is measured. */
+  string PointCost_FileName;        /*!< \brief File with the measured cost of each point. */
+  bool Partition_Cache;             /*!< \brief Reuse the ParMETIS partitioning stored on disk by a previous run. */
+  string Partition_Cache_FileName;  /*!< \brief Prefix of the partition cache files. */
+  POINT_ORDERING Kind_PointOrdering; /*!< \brief Renumbering of the points after partitioning. */
+  bool Persistent_P2P_Comms;        /*!< \brief Use persistent MPI requests for the halo exchanges. */
+  bool Overlap_Halo_Comms;          /*!< \brief Overlap the halo exchanges with the edge flux computation. */
+  bool Float_Halo_Comms;            /*!< \brief Gradients and limiters are sent in single precision. */
+  unsigned short DirectDiff = NO_DERIVATIVE; /*!< \brief Direct Differentation mode (first direction). */
+  unsigned short nDirectDiff = 0;   /*!< \brief Number of directions of the direct differentiation. */
+  ENUM_DIRECTDIFF_VAR* DirectDiff_List = nullptr; /*!< \brief Variable of each direction of the direct differentiation. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
   WINDOW_FUNCTION Kind_WindowFct;      /*!< \brief Type of window (weight) function for objective functional. */
@@ -1066,6 +1191,7 @@ private:
   bool RampRotatingFrame;           /*!< \brief option for ramping up or down the Rotating Frame values */
   bool RampOutletPressure;          /*!< \brief option for ramping up or down the outlet pressure */
   su2double AverageMachLimit;           /*!< \brief option for turbulent mixingplane */
+  unsigned long TurboPerf_Freq;         /*!< \brief Frequency of the turbomachinery performance updates. */
   su2double FinalRotation_Rate_Z;       /*!< \brief Final rotation rate Z if Ramp rotating frame is activated. */
   su2double FinalOutletPressure;        /*!< \brief Final outlet pressure if Ramp outlet pressure is activated. */
   su2double MonitorOutletPressure;      /*!< \brief Monitor outlet pressure if Ramp outlet pressure is activated. */
@@ -1108,6 +1234,8 @@ private:
   su2double *Wall_Emissivity;          /*!< \brief Emissivity of the wall. */
   bool Radiation;                      /*!< \brief Determines if a radiation model is incorporated. */
   su2double CFL_Rad;                   /*!< \brief CFL Number for the radiation solver. */
+  unsigned long Radiation_Freq;        /*!< \brief Number of flow iterations between radiation updates. */
+  bool Radiation_Frozen_System;        /*!< \brief Reuse the P1 matrix and preconditioner across radiation updates. */
 
   array<su2double,5> default_cfl_adapt;  /*!< \brief Default CFL adapt param array for the COption class. */
   su2double vel_init[3], /*!< \brief initial velocity array for the COption class. */
@@ -1168,6 +1296,7 @@ private:
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool Wrt_ZoneConv;              /*!< \brief Write the convergence history of each individual zone to screen. */
   bool Wrt_ZoneHist;              /*!< \brief Write the convergence history of each individual zone to file. */
+  bool Zone_Tapes;                /*!< \brief Record one tape per zone in the multizone discrete adjoint. */
   bool SpecialOutput,             /*!< \brief Determines if the special output is written. */
   Wrt_ForcesBreakdown;            /*!< \brief Determines if the forces breakdown file is written. */
   string *ScreenOutput,           /*!< \brief Kind of the screen output. */
@@ -1186,11 +1315,15 @@ private:
   unsigned long pastix_fact_freq;  /*!< \brief (Re-)Factorization frequency for PaStiX */
   unsigned short pastix_verb_lvl;  /*!< \brief Verbosity level for PaStiX */
   unsigned short pastix_fill_lvl;  /*!< \brief Fill level for PaStiX ILU */
+  string* Petsc_Options;           /*!< \brief Options of the PETSc solver (command line syntax). */
+  unsigned short nPetsc_Options;   /*!< \brief Number of words of the PETSc options. */
 
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
   bool edgeColoringRelaxDiscAdj;    /*!< \brief Allow fallback to smaller edge color group sizes and use more colors for the discrete adjoint. */
+  bool edgeColoringAutotune;        /*!< \brief Select the edge loop strategy (coloring group size or reducer) by timing them at startup. */
+  unsigned long edgePrefetchDistance; /*!< \brief Number of SIMD groups of edges ahead whose point data is prefetched. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1202,6 +1335,7 @@ private:
   POD_KIND POD_Basis_Gen;                   /*!< \brief Type of POD basis generation (static or incremental). */
   unsigned short maxBasisDim,               /*!< \brief Maximum number of POD basis dimensions. */
   rom_save_freq;                            /*!< \brief Frequency of unsteady time steps to save. */
+  ROM_PROJECTION Kind_ROMProjection;        /*!< \brief Projection of the online reduced order model. */
 
   unsigned short nSpecies = 0;              /*!< \brief Number of transported species equations (for NEMO and species transport)*/
 
@@ -1214,6 +1348,7 @@ private:
   *Supercatalytic_Wall_Composition,         /*!< \brief Supercatalytic wall mass fractions [dimensionless]. */
   pnorm_heat;                               /*!< \brief pnorm for heat-flux. */
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
+  chemistry_splitting,                      /*!< \brief Flag for operator splitting of the chemical source terms. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
   monoatomic,                               /*!< \brief Flag for monoatomic mixture. */
@@ -1222,6 +1357,8 @@ private:
   *Wall_Catalytic;                          /*!< \brief Pointer to catalytic walls. */
   TRANSCOEFFMODEL   Kind_TransCoeffModel;   /*!< \brief Transport coefficient Model for NEMO solver. */
   su2double CatalyticEfficiency;            /*!< \brief Wall catalytic efficiency. */
+  su2double Chemistry_Split_Tol;            /*!< \brief Relative tolerance of the split chemistry integration. */
+  unsigned long Chemistry_Split_MaxSteps;   /*!< \brief Maximum number of sub-steps of the split chemistry integration. */
   su2double *Inlet_MassFrac;                /*!< \brief Specified Mass fraction vectors for NEMO inlet boundaries. */
   su2double Inlet_Temperature_ve;           /*!< \brief Specified Tve for supersonic inlet boundaries (NEMO solver). */
 
@@ -1651,6 +1788,46 @@ public:
    */
   bool GetCFL_Adapt(void) const { return CFL_Adapt; }
 
+  /*!
+   * \brief Get the method used to adapt the local CFL numbers.
+   */
+  CFL_ADAPT_METHOD GetKind_CFL_Adapt(void) const { return Kind_CFL_Adapt; }
+
+  /*!
+   * \brief Get the parameters of the local residual CFL adaption.
+   * \param[in] val_index - 0 for the exponent of the residual ratio, 1 for the backtracking tolerance
+   *            (increase of the nonlinear residual indicator, in orders of magnitude).
+   */
+  su2double GetCFL_AdaptLocalParam(unsigned short val_index) const { return CFL_AdaptLocalParam[val_index]; }
+
+  /*!
+   * \brief Check if the converged regions of the flow are frozen (active set of points).
+   */
+  bool GetActiveSet(void) const { return ActiveSet; }
+
+  /*!
+   * \brief Get the parameters of the active set.
+   * \param[in] val_index - 0 for the residual threshold (relative to the largest local residual of the first
+   *            iteration), 1 for the number of consecutive iterations below it before a point is frozen, 2 for
+   *            the frequency of the global sweeps that update all points.
+   */
+  su2double GetActiveSet_Param(unsigned short val_index) const { return ActiveSetParam[val_index]; }
+
+  /*!
+   * \brief Check if the nonlinear iterations of the primal solvers are accelerated (Anderson acceleration).
+   */
+  bool GetNonlinearAcceleration(void) const { return NonlinearAcceleration; }
+
+  /*!
+   * \brief Get the number of previous iterations (depth) used by the Anderson acceleration.
+   */
+  unsigned short GetNonlinearAcceleration_Depth(void) const { return NonlinearAccelerationDepth; }
+
+  /*!
+   * \brief Check if the mean flow and turbulence equations are solved in a single (block) linear system.
+   */
+  bool GetCoupled_Turb_Solve(void) const { return Coupled_Turb_Solve; }
+
   /*!
    * \brief Get the value of the limits for the sections.
    * \return Value of the limits for the sections.
@@ -1812,6 +1989,11 @@ public:
    */
   su2double GetwallModel_B() const { return wallModel_B; }
 
+  /*!
+   * \brief Check if the wall functions and wall models use a table of the inverse law of the wall (u+ from U y / nu).
+   */
+  bool GetwallModel_Table() const { return wallModel_Table; }
+
   /*!
    * \brief Get the value of the thermal diffusivity for solids.
    * \return Thermal conductivity (solid).
@@ -2495,6 +2677,11 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Get whether the flow limiters are computed in the same pass over the grid as the gradients.
+   */
+  bool GetFused_Gradient_Limiter(void) const { return Fused_Gradient_Limiter; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -2909,6 +3096,19 @@ public:
    */
   su2double GetUnst_CFL(void) const { return Unst_CFL; }
 
+  /*!
+   * \brief Check if the inner iterations of dual time stepping start from an extrapolation of the time levels.
+   * \return <code>TRUE</code> if the extrapolated initial guess is used.
+   */
+  bool GetTime_Extrapolation(void) const { return Time_Extrapolation; }
+
+  /*!
+   * \brief Get the growth of the initial residual (w.r.t. the previous time step) above which the extrapolated
+   *        initial guess is replaced by the solution at time n.
+   * \return Tolerance of the extrapolation fallback.
+   */
+  su2double GetTime_Extrapolation_Tol(void) const { return Time_Extrapolation_Tol; }
+
   /*!
    * \brief Get information about element reorientation
    * \return    <code>TRUE</code> means that elements can be reoriented if suspected unhealthy
@@ -3022,6 +3222,47 @@ public:
    */
   unsigned short GetnRKStep(void) const { return nRKStep; }
 
+  /*!
+   * \brief Get the maximum number of Newton iterations per time step of the implicit (JFNK) DG scheme.
+   * \return Maximum number of Newton iterations.
+   */
+  unsigned short GetJFNK_Newton_Iter(void) const { return JFNK_Newton_Iter; }
+
+  /*!
+   * \brief Get the relative reduction of the nonlinear residual at which the Newton iterations of the
+   *        implicit (JFNK) DG scheme stop.
+   * \return Relative tolerance of the Newton iterations.
+   */
+  su2double GetJFNK_Newton_Tol(void) const { return JFNK_Newton_Tol; }
+
+  /*!
+   * \brief Get the number of time steps between rebuilds of the element block-Jacobi preconditioner
+   *        of the implicit (JFNK) DG scheme.
+   * \return Rebuild period of the preconditioner.
+   */
+  unsigned long GetJFNK_Precond_Rebuild(void) const { return JFNK_Precond_Rebuild; }
+
+  /*!
+   * \brief Get the number of time steps over which the work of the DG solver is measured
+   *        before the load balance is reported (0 means no measurement).
+   * \return Frequency of the load balance monitoring.
+   */
+  unsigned long GetLoadBalance_Freq_FEM(void) const { return LoadBalance_Freq_FEM; }
+
+  /*!
+   * \brief Get the name of the file with the measured work of the DG elements. It is written by the
+   *        load balance monitoring and, if it exists, used for the weights of the partitioning.
+   * \return File name.
+   */
+  const string& GetWorkWeights_FileName_FEM(void) const { return WorkWeights_FileName_FEM; }
+
+  /*!
+   * \brief Get whether the ready tasks of the DG solver are executed concurrently by a pool of OpenMP
+   *        threads, such that the communication is overlapped with the work of the other threads.
+   * \return <code>TRUE</code> if the threaded task scheduler must be used.
+   */
+  bool GetThreaded_Task_Scheduler_FEM(void) const { return Threaded_Task_Scheduler_FEM; }
+
   /*!
    * \brief Get the number of time levels for time accurate local time stepping.
    * \return Number of time levels.
@@ -3208,6 +3449,11 @@ public:
    */
   unsigned short GetnObj(void) const { return nObj;}
 
+  /*!
+   * \brief Check if one discrete adjoint is solved per objective function (vector mode tape evaluations).
+   */
+  bool GetVector_Adjoint(void) const { return Vector_Adjoint; }
+
   /*!
    * \brief Stores the number of marker in the simulation.
    * \param[in] val_nmarker - Number of markers of the problem.
@@ -3220,6 +3466,17 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Check if the unsteady adjoint recomputes the direct solutions that have no restart file.
+   * \return <code>TRUE</code> if the direct solutions are recomputed from the closest earlier restart files.
+   */
+  bool GetUnst_Adjoint_Recompute(void) const { return Unst_Adjoint_Recompute; }
+
+  /*!
+   * \brief Get the number of recomputed direct solutions that the unsteady adjoint keeps in memory.
+   */
+  unsigned long GetUnst_Adjoint_Snapshots(void) const { return Unst_Adjoint_Snapshots; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3304,6 +3561,26 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get whether the main phases of the iterations are timed (see CRuntimeProfiler).
+   */
+  bool GetRuntime_Profiling(void) const { return Runtime_Profiling; }
+
+  /*!
+   * \brief Get whether the profiled phases are also hardware counter regions (LIKWID or PAPI).
+   */
+  bool GetHardware_Counters(void) const { return Hardware_Counters; }
+
+  /*!
+   * \brief Get whether the memory high-water marks are computed every iteration (history group MEMORY).
+   */
+  bool GetMemory_History(void) const { return Memory_History; }
+
+  /*!
+   * \brief Get whether the large aligned allocations (solver fields, grids, Jacobians) use transparent huge pages.
+   */
+  bool GetHuge_Pages(void) const { return Huge_Pages; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3346,6 +3623,26 @@ public:
    */
   su2double Get_Alpha_RKStep(unsigned short val_step) const { return RK_Alpha_Step[val_step]; }
 
+  /*!
+   * \brief Get whether the residuals of the explicit flow schemes are smoothed implicitly.
+   */
+  bool GetResidualSmoothing(void) const { return ResidualSmoothing; }
+
+  /*!
+   * \brief Get the coefficient of the implicit residual smoothing.
+   */
+  su2double GetResidualSmoothing_Coeff(void) const { return ResidualSmoothing_Coeff; }
+
+  /*!
+   * \brief Get the number of Jacobi iterations of the implicit residual smoothing.
+   */
+  unsigned short GetResidualSmoothing_Iter(void) const { return ResidualSmoothing_Iter; }
+
+  /*!
+   * \brief Get whether the explicit flow schemes are implicit along the lines normal to the walls.
+   */
+  bool GetLineImplicit_Smoothing(void) const { return LineImplicitSmoothing; }
+
   /*!
    * \brief Get the index of the surface defined in the geometry file.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -3785,6 +4082,33 @@ public:
     return MG_CorrecSmooth[val_mesh];
   }
 
+  /*!
+   * \brief Get the number of iterations of a coarse grid in the grid sequencing start-up (FULLMG_CYCLE).
+   * \note The last value of the list is used for the coarser grids.
+   * \param[in] val_mesh - Index of the grid (> 0).
+   * \return Number of iterations while the grid is the finest grid.
+   */
+  unsigned long GetFullMG_Iter(unsigned short val_mesh) const {
+    if (nFullMG_Iter == 0) return 100;
+    return FullMG_Iter[min<unsigned short>(val_mesh, nFullMG_Iter) - 1];
+  }
+
+  /*!
+   * \brief Get the number of CFL numbers specified for the grid sequencing start-up.
+   */
+  unsigned short GetnFullMG_CFL(void) const { return nFullMG_CFL; }
+
+  /*!
+   * \brief Get the CFL of a coarse grid while it is the finest grid of the grid sequencing start-up.
+   * \note The last value of the list is used for the coarser grids.
+   * \param[in] val_mesh - Index of the grid (> 0).
+   * \return CFL number, the multigrid CFL of the grid if none was specified.
+   */
+  su2double GetFullMG_CFL(unsigned short val_mesh) const {
+    if (nFullMG_CFL == 0) return CFL[val_mesh];
+    return FullMG_CFL[min<unsigned short>(val_mesh, nFullMG_CFL) - 1];
+  }
+
   /*!
    * \brief plane of the FFD (I axis) that should be fixed.
    * \param[in] val_index - Index of the arrray with all the planes in the I direction that should be fixed.
@@ -3904,6 +4228,11 @@ public:
    */
   ENUM_MULTIZONE GetKind_MZSolver(void) const { return Kind_MZSolver; }
 
+  /*!
+   * \brief Get whether the zones are solved concurrently in block-Jacobi iterations.
+   */
+  bool GetMultizone_ConcurrentZones(void) const { return Multizone_ConcurrentZones; }
+
   /*!
    * \brief Governing equations of the flow (it can be different from the run time equation).
    * \param[in] val_zone - Zone where the soler is applied.
@@ -3979,6 +4308,48 @@ public:
    */
   su2double GetRelaxation_DataDriven(void) const { return DataDriven_Relaxation_Factor; }
 
+  /*!
+   * \brief Check if the binary version (.drb) of ASCII lookup tables should be written.
+   */
+  bool GetLUT_Write_Binary(void) const { return LUT_Write_Binary; }
+
+  /*!
+   * \brief Check if points are located in lookup tables with a uniform search grid instead of the trapezoidal map.
+   */
+  bool GetLUT_Search_Grid(void) const { return LUT_Search_Grid; }
+
+  /*!
+   * \brief Check if regular (tensor-product) levels of lookup tables are detected and interpolated bilinearly.
+   */
+  bool GetLUT_Structured(void) const { return LUT_Structured; }
+
+  /*!
+   * \brief Check if the lookup table of the data-driven fluid model is generated at startup.
+   */
+  bool GetLUT_Generate(void) const { return LUT_Generate; }
+
+  /*!
+   * \brief Get the fluid model tabulated by the generated lookup table.
+   */
+  unsigned short GetKind_LUT_Generate_FluidModel(void) const { return Kind_LUT_Generate_FluidModel; }
+
+  /*!
+   * \brief Get the range of the generated lookup table.
+   * \return Minimum and maximum density, minimum and maximum static energy.
+   */
+  const array<su2double,4>& GetLUT_Generate_Range(void) const { return LUT_Generate_Range; }
+
+  /*!
+   * \brief Get the refinement levels of the generated lookup table.
+   * \return Level of the uniform base grid, and maximum level of the adaptive refinement.
+   */
+  const array<unsigned short,2>& GetLUT_Generate_Levels(void) const { return LUT_Generate_Levels; }
+
+  /*!
+   * \brief Get the relative tolerance for the refinement of the generated lookup table.
+   */
+  su2double GetLUT_Generate_Tolerance(void) const { return LUT_Generate_Tolerance; }
+
   /*!
    * \brief Returns the name of the fluid we are using in CoolProp.
    */
@@ -4055,6 +4426,12 @@ public:
    */
   CONDUCTIVITYMODEL_TURB GetKind_ConductivityModel_Turb() const { return Kind_ConductivityModel_Turb; }
 
+  /*!
+   * \brief Get the relative change of density and temperature below which the transport properties of a point are
+   *        reused from the previous update (0 if the cache is disabled).
+   */
+  su2double GetTransport_Cache_Tol() const { return Transport_Cache_Tol; }
+
   /*!
    * \brief Get the value of the mass diffusivity model.
    * \return Mass diffusivity model.
@@ -4119,6 +4496,18 @@ public:
    */
   su2double GetConstant_Lewis_Number(unsigned short val_index = 0) const { return Constant_Lewis_Number[val_index]; }
 
+  /*!
+   * \brief Check if the mass diffusivity model gives the same coefficient to all species.
+   * \return True for constant diffusivity, constant Schmidt, unity Lewis, flamelet, or equal Lewis numbers.
+   */
+  bool GetSpecies_SharedDiffusivity() const {
+    if (Kind_Diffusivity_Model != DIFFUSIVITYMODEL::CONSTANT_LEWIS) return true;
+    for (unsigned short iVar = 1; iVar < nConstant_Lewis_Number; ++iVar) {
+      if (Constant_Lewis_Number[iVar] != Constant_Lewis_Number[0]) return false;
+    }
+    return true;
+  }
+
   /*!
    * \brief Get the value of the reference viscosity for Sutherland model.
    * \return The reference viscosity.
@@ -4261,6 +4650,11 @@ public:
    */
   bool GetReconstructionGradientRequired(void) const { return ReconstructionGradientRequired; }
 
+  /*!
+   * \brief Get whether the least-squares gradient weights are computed once and stored (for static meshes).
+   */
+  bool GetCache_LeastSquares_Weights(void) const { return Cache_LeastSquares_Weights; }
+
   /*!
    * \brief Get flag for whether a least-squares gradient method is being applied.
    * \return <code>TRUE</code> means that a least-squares gradient method is being applied.
@@ -4316,12 +4710,43 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get the maximum number of iterative refinement steps when the linear solver works in single precision.
+   */
+  unsigned short GetLinear_Solver_Refinement_Iter(void) const { return Linear_Solver_Refinement_Iter; }
+
+  /*!
+   * \brief Get the maximum number of levels (including the fine level) of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre and post smoothing sweeps of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Get the damping factor of the Jacobi smoother used by the AMG preconditioner.
+   */
+  su2double GetLinear_Solver_AMG_Relaxation(void) const { return Linear_Solver_AMG_Relaxation; }
+
+  /*!
+   * \brief Get the strength of connection threshold used to form the AMG aggregates.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the size of the subspace recycled between calls of the linear solver (RECYCLED_FGMRES).
+   * \return Number of recycled vectors.
+   */
+  unsigned long GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4364,6 +4789,17 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether the gradients and limiters are frozen during the matrix-free products of the NK method.
+   */
+  bool GetNewtonKrylovFrozenGradients(void) const { return NK_FrozenGradients; }
+
+  /*!
+   * \brief Get whether the Jacobian of the NK method is assembled (by colored finite differences) instead of
+   *        using matrix-free products.
+   */
+  bool GetNewtonKrylovAssembledJacobian(void) const { return NK_AssembledJacobian; }
+
   /*!
    * \brief Returns the Roe kappa (multipler of the dissipation term).
    */
@@ -4452,6 +4888,56 @@ public:
    */
   unsigned short GetDeform_Stiffness_Type(void) const { return Deform_StiffnessType; }
 
+  /*!
+   * \brief Get whether the stiffness matrix of the mesh deformation is assembled only once and then reused.
+   */
+  bool GetDeform_Frozen_Stiffness(void) const { return Deform_FrozenStiffness; }
+
+  /*!
+   * \brief Get whether the size of the mesh deformation increments is adapted to the mesh quality.
+   */
+  bool GetDeform_Adaptive_Increment(void) const { return Deform_AdaptiveIncrement; }
+
+  /*!
+   * \brief Get the maximum number of times a deformation increment is halved after producing negative volumes.
+   */
+  unsigned short GetDeform_Max_Subdivisions(void) const { return Deform_MaxSubdivisions; }
+
+  /*!
+   * \brief Get whether the linear solves of the mesh deformation start from the (extrapolated) previous solution.
+   */
+  bool GetDeform_Warm_Start(void) const { return Deform_WarmStart; }
+
+  /*!
+   * \brief Get whether the mesh solver (DEFORM_MESH= YES) applies the element stiffness on the fly (matrix-free).
+   */
+  bool GetDeform_Matrix_Free(void) const { return Deform_MatrixFree; }
+
+  /*!
+   * \brief Get the method to deform the volume mesh.
+   */
+  DEFORM_METHOD GetKind_Deform_Method(void) const { return Kind_Deform_Method; }
+
+  /*!
+   * \brief Get the radial basis function for RBF mesh deformation.
+   */
+  RADIAL_BASIS GetKind_Deform_RBF(void) const { return Kind_Deform_RBF; }
+
+  /*!
+   * \brief Get the support radius of the RBF mesh deformation (0 for automatic).
+   */
+  su2double GetDeform_RBF_Radius(void) const { return Deform_RBF_Radius; }
+
+  /*!
+   * \brief Get the tolerance, relative to the maximum surface displacement, of the greedy selection of RBF centers.
+   */
+  su2double GetDeform_RBF_GreedyTol(void) const { return Deform_RBF_GreedyTol; }
+
+  /*!
+   * \brief Get the maximum number of RBF centers for mesh deformation.
+   */
+  unsigned long GetDeform_RBF_MaxCenters(void) const { return Deform_RBF_MaxCenters; }
+
   /*!
    * \brief Get the size of the layer of highest stiffness for wall distance-based mesh stiffness.
    */
@@ -5077,6 +5563,18 @@ public:
    */
   string GetActDisk_FileName(void) const { return ActDisk_FileName; }
 
+  /*!
+   * \brief Get whether the actuator disks of the input file are modeled as volumetric body forces.
+   * \return <code>TRUE</code> if the body force actuator disk model is used (no disk markers are needed).
+   */
+  bool GetActDisk_BodyForce(void) const { return ActDisk_BodyForce; }
+
+  /*!
+   * \brief Get the axial thickness of the volume over which the load of each body force actuator disk is spread.
+   * \return Thickness of the body force actuator disks (mesh units).
+   */
+  su2double GetActDisk_BodyForce_Thickness(void) const { return ActDisk_BodyForce_Thickness; }
+
   /*!
    * \brief Get the tolerance used for matching two points on a specified inlet
    * \return Tolerance used for matching a point to a specified inlet
@@ -5202,6 +5700,18 @@ public:
    */
   su2double GetAverageMachLimit(void) const { return AverageMachLimit;}
 
+  /*!
+   * \brief Get the frequency (iterations) of the turbomachinery performance updates.
+   * \return Frequency of the updates.
+   */
+  unsigned long GetTurboPerf_Freq(void) const { return TurboPerf_Freq;}
+
+  /*!
+   * \brief Check if the turbomachinery performance is updated in the current (outer for multizone) iteration.
+   * \return True if it is updated.
+   */
+  bool GetTurboPerf_Iter(void) const { return (Multizone_Problem ? OuterIter : InnerIter) % TurboPerf_Freq == 0;}
+
   /*!
    * \brief Get the kind of mixing process for averaging quantities at the boundaries.
    * \return Kind of mixing process.
@@ -5490,6 +6000,12 @@ public:
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Flag for restarts from a different mesh with the same number of points (or in SU2_SOL).
+   * \return <code>TRUE</code> if the (binary) restart is always interpolated from its point coordinates.
+   */
+  bool GetRestart_Interpolation(void) const { return Restart_Interpolation; }
+
   /*!
    * \brief Flag for whether restart solution files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -5508,6 +6024,77 @@ public:
    */
   bool GetWrt_Volume_Overwrite(void) const { return Wrt_Volume_Overwrite; }
 
+  /*!
+   * \brief Flag for whether the result files are sorted and written on a background thread.
+   * \return <TRUE> if the solver continues while the previous output is being written.
+   */
+  bool GetWrt_Async_Output(void) const { return Wrt_Async_Output; }
+
+  /*!
+   * \brief Get the deflate level of the datasets in HDF5 output files.
+   * \return Compression level between 0 (no compression) and 9.
+   */
+  unsigned short GetHDF5_Compression(void) const { return HDF5_Compression; }
+
+  /*!
+   * \brief Get the number of Catalyst pipeline scripts.
+   */
+  unsigned short GetnCatalyst_Scripts(void) const { return nCatalyst_Scripts; }
+
+  /*!
+   * \brief Get the Catalyst pipeline script iScript.
+   */
+  const string& GetCatalyst_Script(unsigned short iScript) const { return Catalyst_Scripts[iScript]; }
+
+  /*!
+   * \brief Get the number of volume output fields or groups passed to Catalyst (0 means all).
+   */
+  unsigned short GetnCatalyst_Fields(void) const { return nCatalyst_Fields; }
+
+  /*!
+   * \brief Get the volume output field or group iField passed to Catalyst.
+   */
+  const string& GetCatalyst_Field(unsigned short iField) const { return Catalyst_Fields[iField]; }
+
+  /*!
+   * \brief Get the name of the Catalyst implementation (empty to use the environment).
+   */
+  const string& GetCatalyst_Implementation(void) const { return Catalyst_Implementation; }
+
+  /*!
+   * \brief Get the number of markers of the surface stream output (the plotting markers if none are specified).
+   */
+  unsigned short GetnSurface_Stream_Markers(void) const {
+    return nSurface_Stream_Markers > 0 ? nSurface_Stream_Markers : nMarker_Plotting;
+  }
+
+  /*!
+   * \brief Get the marker iMarker of the surface stream output.
+   */
+  const string& GetSurface_Stream_Marker(unsigned short iMarker) const {
+    return nSurface_Stream_Markers > 0 ? Surface_Stream_Markers[iMarker] : Marker_Plotting[iMarker];
+  }
+
+  /*!
+   * \brief Get the number of volume output fields or groups of the surface stream output (0 means all).
+   */
+  unsigned short GetnSurface_Stream_Fields(void) const { return nSurface_Stream_Fields; }
+
+  /*!
+   * \brief Get the volume output field or group iField of the surface stream output.
+   */
+  const string& GetSurface_Stream_Field(unsigned short iField) const { return Surface_Stream_Fields[iField]; }
+
+  /*!
+   * \brief Get the compression of the binary restart files.
+   */
+  RESTART_COMPRESSION GetRestart_Compression(void) const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the error bound of the lossy restart compression, relative to the magnitude of each field.
+   */
+  su2double GetRestart_Compression_Tol(void) const { return Restart_Compression_Tol; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5539,6 +6126,21 @@ public:
    */
   bool GetFrozen(void) const { return frozen; }
 
+  /*!
+   * \brief Indicates whether the chemical source terms are integrated separately from the flow (operator splitting).
+   */
+  bool GetChemistry_Splitting(void) const { return chemistry_splitting; }
+
+  /*!
+   * \brief Get the relative tolerance of the error control of the split chemistry integration.
+   */
+  su2double GetChemistry_Split_Tol(void) const { return Chemistry_Split_Tol; }
+
+  /*!
+   * \brief Get the maximum number of sub-steps per cell of the split chemistry integration.
+   */
+  unsigned long GetChemistry_Split_MaxSteps(void) const { return Chemistry_Split_MaxSteps; }
+
   /*!
    * \brief Indicates whether electron gas is present in the gas mixture.
    */
@@ -5641,6 +6243,56 @@ public:
    */
   unsigned long GetStartWindowIteration(void) const { return StartWindowIteration; }
 
+  /*!
+   * \brief Check if the running statistics (mean, Reynolds stresses, higher moments) are computed.
+   */
+  bool GetTime_Statistics(void) const { return Time_Statistics; }
+
+  /*!
+   * \brief Check if the running statistics are stored in single precision.
+   */
+  bool GetTime_Statistics_Single_Prec(void) const { return Time_Statistics_Single_Prec; }
+
+  /*!
+   * \brief Get the name of the file with the state of the running statistics.
+   */
+  const string& GetTime_Statistics_FileName(void) const { return Time_Statistics_FileName; }
+
+  /*!
+   * \brief Get the history outputs whose power spectral density is computed.
+   */
+  vector<string> GetSpectral_Probes(void) const { return {Spectral_Probes, Spectral_Probes + nSpectral_Probes}; }
+
+  /*!
+   * \brief Get the number of time steps of the windows of the spectral probes.
+   */
+  unsigned long GetSpectral_Window(void) const { return Spectral_Window; }
+
+  /*!
+   * \brief Get the number of time iterations between node-local checkpoints (0 if disabled).
+   */
+  unsigned long GetCheckpoint_Freq(void) const { return Checkpoint_Freq; }
+
+  /*!
+   * \brief Get the node-local directory of the checkpoint files.
+   */
+  const string& GetCheckpoint_Dir(void) const { return Checkpoint_Dir; }
+
+  /*!
+   * \brief Check if the simulation restarts from the node-local checkpoint.
+   */
+  bool GetCheckpoint_Restart(void) const { return Checkpoint_Restart; }
+
+  /*!
+   * \brief Restart at the iteration after a checkpoint, the solution is then read from memory.
+   * \param[in] iter - Restart iteration.
+   */
+  void SetRestart_FromCheckpoint(unsigned long iter) {
+    Restart = true;
+    Restart_Iter = iter;
+    if (!OptionIsSet("WINDOW_START_ITER")) StartWindowIteration = iter;
+  }
+
   /*!
    * \brief Get Index of the window function used as weight in the cost functional
    * \return
@@ -5663,7 +6315,7 @@ public:
    * \brief Add any numbers necessary to the filename (iteration number, zone ID ...)
    * \param[in] filename - the base filename.
    * \param[in] ext - the extension to be added.
-   * \param[in] Iter - the current iteration
+   * \param[in] Iter - the current iteration, negative to omit it (e.g. for files that hold a time series)
    * \return The new filename
    */
   string GetFilename(string filename, const string& ext, int Iter) const;
@@ -5779,6 +6431,12 @@ public:
    */
   string GetObjFunc_Extension(string val_filename) const;
 
+  /*!
+   * \brief Get the filename extension of one objective function (e.g. "_cd").
+   * \param[in] iObj - Index of the objective function.
+   */
+  string GetObjFunc_Suffix(unsigned short iObj) const;
+
   /*!
    * \brief Get functional that is going to be used to evaluate the residual flow convergence.
    * \return Functional that is going to be used to evaluate the residual flow convergence.
@@ -5906,6 +6564,17 @@ public:
     return (Kind_GridMovement != NO_MOVEMENT) || (nKind_SurfaceMovement > 0);
   }
 
+  /*!
+   * \brief Get whether the dual grid of moving meshes is updated incrementally.
+   * \return <code>TRUE</code> for incremental updates of the dual grid.
+   */
+  bool GetIncremental_DualGrid(void) const { return Incremental_DualGrid; }
+
+  /*!
+   * \brief Get the fraction of moved points above which the dual grid is fully recomputed.
+   */
+  su2double GetIncremental_DualGrid_Threshold(void) const { return Incremental_DualGrid_Threshold; }
+
   /*!
    * \brief Get information about dynamic grids.
    * \return <code>TRUE</code> if there is a grid movement; otherwise <code>FALSE</code>.
@@ -5933,6 +6602,11 @@ public:
    */
   void SetSurface_Movement(unsigned short iMarker, unsigned short kind_movement);
 
+  /*!
+   * \brief Get the number of kinds of surface movement.
+   */
+  unsigned short GetnKind_SurfaceMovement() const { return nKind_SurfaceMovement; }
+
   /*!
    * \brief Get the type of dynamic mesh motion. Each zone gets a config file.
    * \return Type of dynamic mesh motion.
@@ -6152,6 +6826,48 @@ public:
    */
   bool GetHB_Precondition(void) const { return HB_Precondition; }
 
+  /*!
+   * \brief Get the number of MPI rank groups over which the harmonic balance time instances are distributed.
+   * \return Number of rank groups.
+   */
+  unsigned short GetHB_InstanceGroups(void) const { return HB_InstanceGroups; }
+
+  /*!
+   * \brief Get the number of MPI rank groups (time slices) of the time-parallel (parareal) dual time stepping.
+   */
+  unsigned short GetTimeParallelGroups(void) const { return TimeParallelGroups; }
+
+  /*!
+   * \brief Get the maximum number of parareal iterations.
+   */
+  unsigned short GetParareal_Iter(void) const { return Parareal_Iter; }
+
+  /*!
+   * \brief Get the ratio between the time steps of the coarse and fine parareal propagators.
+   */
+  unsigned short GetParareal_Coarsening(void) const { return Parareal_Coarsening; }
+
+  /*!
+   * \brief Get the tolerance on the relative change of the initial states of the time slices.
+   */
+  su2double GetParareal_Tol(void) const { return Parareal_Tol; }
+
+  /*!
+   * \brief Get the number of cases (config files) of an ensemble run, 0 for a normal run.
+   */
+  unsigned short GetnEnsemble_Configs(void) const { return nEnsemble_Configs; }
+
+  /*!
+   * \brief Get the config file of a case of the ensemble.
+   * \param[in] iCase - Index of the case.
+   */
+  const string& GetEnsemble_Config(unsigned short iCase) const { return Ensemble_Configs[iCase]; }
+
+  /*!
+   * \brief Get the number of MPI rank groups that run the cases of the ensemble concurrently.
+   */
+  unsigned short GetEnsembleGroups(void) const { return EnsembleGroups; }
+
   /*!
    * \brief Get if we should update the motion origin.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -6577,6 +7293,23 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void) const { return Damp_Correc_Prolong; }
 
+  /*!
+   * \brief Whether the interior control volumes are agglomerated in parallel (multigrid coarsening).
+   */
+  bool GetMG_ParallelAgglomeration(void) const { return MG_ParallelAgglomeration; }
+
+  /*!
+   * \brief Whether leftover interior control volumes are merged into a neighbor instead of becoming coarse
+   *        control volumes with a single child (multigrid coarsening).
+   */
+  bool GetMG_MergeSingletons(void) const { return MG_MergeSingletons; }
+
+  /*!
+   * \brief Whether the turbulence and species solvers are integrated with the FAS multigrid (instead of
+   *        on the fine grid only).
+   */
+  bool GetMG_ScalarSolvers(void) const { return MG_ScalarSolvers; }
+
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -7206,6 +7939,22 @@ public:
    */
   const su2double* GetWallFunction_DoubleInfo(const string& val_marker) const;
 
+  /*!
+   * \brief Get whether the wall elements stay distributed across ranks for the wall distance computation.
+   */
+  bool GetWallDistance_Distributed() const { return WallDistance_Distributed; }
+
+  /*!
+   * \brief Get the width of the band of points whose wall distance is updated on moving meshes (0 for all points).
+   */
+  su2double GetWallDistance_Band() const { return WallDistance_Band; }
+
+  /*!
+   * \brief Get the maximum number of time steps per revolution of rigidly rotating zones for which the wall
+   *        distances of one revolution are cached and reused (0 disables the cache).
+   */
+  unsigned long GetWallDistance_PeriodicCache() const { return WallDistance_PeriodicCache; }
+
   /*!
    * \brief Get the type of wall and roughness height on a wall boundary (Heatflux or Isothermal).
    * \param[in] val_index - Index corresponding to the boundary.
@@ -8816,6 +9565,18 @@ public:
    */
   unsigned long GetNonphysical_Points(void) const { return Nonphys_Points; }
 
+  /*!
+   * \brief Set the current number of points that reused their cached transport properties.
+   * \param[in] val_hits - current number of cache hits.
+   */
+  void SetTransport_Cache_Hits(unsigned long val_hits) { Transport_Cache_Hits = val_hits; }
+
+  /*!
+   * \brief Get the current number of points that reused their cached transport properties.
+   * \return Current number of cache hits.
+   */
+  unsigned long GetTransport_Cache_Hits(void) const { return Transport_Cache_Hits; }
+
   /*!
    * \brief Set the current number of non-physical reconstructions for 2nd-order upwinding.
    * \param[in] val_nonphys_reconstr - current number of non-physical reconstructions for 2nd-order upwinding.
@@ -8898,6 +9659,35 @@ public:
    */
   unsigned short GetDirectDiff() const { return DirectDiff;}
 
+  /*!
+   * \brief Get the number of directions of the direct differentiation, more than one for the vector forward mode.
+   */
+  unsigned short GetnDirectDiff() const { return nDirectDiff; }
+
+  /*!
+   * \brief Get the variable differentiated in one direction of the direct differentiation.
+   * \param[in] iDir - The direction.
+   */
+  unsigned short GetDirectDiff(unsigned short iDir) const { return DirectDiff_List[iDir]; }
+
+  /*!
+   * \brief Get the name (as in the config file) of the variable differentiated in one direction.
+   * \param[in] iDir - The direction.
+   */
+  string GetDirectDiff_Name(unsigned short iDir) const;
+
+  /*!
+   * \brief Get the name (as in the config file) of the kind of a design variable.
+   * \param[in] iDV - Index of the design variable.
+   */
+  string GetDesign_Variable_Name(unsigned short iDV) const;
+
+  /*!
+   * \brief Get the name (as in the config file) of an objective function.
+   * \param[in] iObj - Index of the objective function.
+   */
+  string GetObjFunc_Name(unsigned short iObj = 0) const;
+
   /*!
    * \brief Get the indicator whether we are solving an discrete adjoint problem.
    * \return the discrete adjoint indicator.
@@ -8928,6 +9718,21 @@ public:
    */
   su2double GetAitkenDynMinInit(void) const { return AitkenDynMinInit; }
 
+  /*!
+   * \brief Get the maximum number of columns of the interface quasi-Newton history (BGS_RELAXATION= QUASI_NEWTON).
+   */
+  unsigned short GetQuasiNewtonFSI_MaxColumns(void) const { return QuasiNewtonFSI_MaxColumns; }
+
+  /*!
+   * \brief Get the number of previous time steps whose interface quasi-Newton history is reused.
+   */
+  unsigned short GetQuasiNewtonFSI_ReuseSteps(void) const { return QuasiNewtonFSI_ReuseSteps; }
+
+  /*!
+   * \brief Get the relative tolerance below which columns of the interface quasi-Newton history are filtered.
+   */
+  su2double GetQuasiNewtonFSI_Filter(void) const { return QuasiNewtonFSI_Filter; }
+
   /*!
    * \brief Decide whether to apply dead loads to the model.
    * \return <code>TRUE</code> if the dead loads are to be applied, <code>FALSE</code> otherwise.
@@ -9245,6 +10050,11 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the maximum number of donor points of each target point in local RBF interpolation.
+   */
+  unsigned short GetRadialBasisFunctionMaxDonors(void) const { return RadialBasisFunction_MaxDonors; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9347,6 +10157,17 @@ public:
    */
   bool GetAD_Preaccumulation(void) const { return AD_Preaccumulation;}
 
+  /*!
+   * \brief Check if the primal value tape is re-evaluated with the current solution and coordinates when possible,
+   *        instead of being re-recorded.
+   */
+  bool GetPrimal_Tape_Reuse(void) const { return Primal_Tape_Reuse; }
+
+  /*!
+   * \brief Get if the discrete adjoint driver projects the sensitivities on the design variables (in memory, as SU2_DOT).
+   */
+  bool GetInline_Gradient_Projection(void) const { return Inline_Gradient_Projection; }
+
   /*!
    * \brief Get the heat equation.
    * \return YES if weakly coupled heat equation for inc. flow is enabled.
@@ -9359,6 +10180,12 @@ public:
    */
   CHT_COUPLING GetKind_CHT_Coupling() const { return Kind_CHT_Coupling; }
 
+  /*!
+   * \brief Get whether the matrix of the heat solver in solid zones is assembled only once.
+   * \return <code>TRUE</code> if the conduction matrix and its preconditioner are kept.
+   */
+  bool GetHeat_Frozen_System(void) const { return Heat_Frozen_System; }
+
   /*!
    * \brief Check if values passed to the BC_HeatFlux-Routine are already integrated.
    * \return YES if the passed values is the integrated heat flux over the marker's surface.
@@ -9546,6 +10373,18 @@ public:
    */
   su2double GetCFL_Rad(void) const { return CFL_Rad; }
 
+  /*!
+   * \brief Get the number of flow iterations between updates of the radiation solution.
+   * \return Frequency of the radiation updates.
+   */
+  unsigned long GetRadiation_Freq(void) const { return Radiation_Freq; }
+
+  /*!
+   * \brief Check if the matrix and preconditioner of the radiation solver are kept across updates.
+   * \return YES if the radiation system is frozen after its first assembly.
+   */
+  bool GetRadiation_Frozen_System(void) const { return Radiation_Frozen_System; }
+
   /*!
    * \brief Determines if radiation needs to be incorporated to the analysis.
    * \return Radiation boolean
@@ -9564,6 +10403,11 @@ public:
    */
   bool GetWrt_ZoneHist(void) const { return Wrt_ZoneHist; }
 
+  /*!
+   * \brief Check if the multizone discrete adjoint records one tape per zone (instead of one for all zones).
+   */
+  bool GetZone_Tapes(void) const { return Zone_Tapes; }
+
   /*!
    * \brief Check if the special output is written
    * \return YES if the special output is written.
@@ -9749,6 +10593,16 @@ public:
    */
   unsigned short GetPastixFillLvl(void) const { return pastix_fill_lvl; }
 
+  /*!
+   * \brief Get the options of the PETSc solver.
+   * \return The options joined with spaces (e.g. "-ksp_type gmres -pc_type gamg").
+   */
+  string GetPetsc_Options(void) const {
+    string options;
+    for (unsigned short i = 0; i < nPetsc_Options; ++i) options += (i ? " " : "") + Petsc_Options[i];
+    return options;
+  }
+
   /*!
    * \brief Check if an option is present in the config file
    * \param[in] - Name of the option
@@ -9768,6 +10622,22 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get whether the ILU preconditioner is parallelized with level scheduling (instead of thread partitions).
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Level_Scheduling; }
+
+  /*!
+   * \brief Get the maximum number of linear solves for which the ILU/LINELET/AMG preconditioner is reused (0 = never).
+   */
+  unsigned long GetLinear_Solver_Prec_Reuse(void) const { return Linear_Solver_Prec_Reuse; }
+
+  /*!
+   * \brief Get the ratio between the current linear iterations and those right after the last build
+   *        of the preconditioner, above which the preconditioner is rebuilt.
+   */
+  su2double GetLinear_Solver_Prec_Reuse_Growth(void) const { return Linear_Solver_Prec_Reuse_Growth; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
@@ -9778,6 +10648,17 @@ public:
    */
   bool GetEdgeColoringRelaxDiscAdj() const { return edgeColoringRelaxDiscAdj; }
 
+  /*!
+   * \brief Check if the edge loop strategy should be selected by timing the alternatives at startup.
+   */
+  bool GetEdgeColoringAutotune() const { return edgeColoringAutotune; }
+
+  /*!
+   * \brief Get the number of SIMD groups of edges ahead whose point data is prefetched in the vectorized edge loops
+   *        (0 disables the prefetching and its gather plan).
+   */
+  unsigned long GetEdgePrefetchDistance() const { return edgePrefetchDistance; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9793,6 +10674,56 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Get whether the grid is partitioned first across compute nodes and then across the ranks of each node.
+   */
+  bool GetParMETIS_Hierarchical() const { return ParMETIS_Hierarchical; }
+
+  /*!
+   * \brief Get whether the points are weighted by their measured cost (from GetPointCost_FileName) for ParMETIS.
+   */
+  bool GetParMETIS_PointCost() const { return ParMETIS_PointCost; }
+
+  /*!
+   * \brief Get the number of iterations over which the cost of each point is measured (0 if disabled).
+   */
+  unsigned long GetPointCost_Profiling_Iter() const { return PointCost_Profiling_Iter; }
+
+  /*!
+   * \brief Get the name of the file with the measured cost of each point.
+   */
+  const string& GetPointCost_FileName() const { return PointCost_FileName; }
+
+  /*!
+   * \brief Get whether the ParMETIS partitioning is cached on disk and reused by later runs.
+   */
+  bool GetPartition_Cache() const { return Partition_Cache; }
+
+  /*!
+   * \brief Get the prefix of the partition cache files.
+   */
+  const string& GetPartition_Cache_FileName() const { return Partition_Cache_FileName; }
+
+  /*!
+   * \brief Get the renumbering of the points after partitioning.
+   */
+  POINT_ORDERING GetKind_PointOrdering() const { return Kind_PointOrdering; }
+
+  /*!
+   * \brief Get whether the halo exchanges use persistent MPI requests.
+   */
+  bool GetPersistent_P2P_Comms() const { return Persistent_P2P_Comms; }
+
+  /*!
+   * \brief Get whether the halo exchanges of gradients and limiters are overlapped with the edge flux computation.
+   */
+  bool GetOverlap_Halo_Comms() const { return Overlap_Halo_Comms; }
+
+  /*!
+   * \brief Get whether the gradients and limiters are sent in single precision in the halo exchanges.
+   */
+  bool GetFloat_Halo_Comms() const { return Float_Halo_Comms; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -9830,6 +10761,13 @@ public:
    */
   unsigned short GetRom_SaveFreq(void) const { return rom_save_freq; }
 
+  /*!
+   * \brief Get the projection of the online reduced order model, the implicit flow system is solved on the
+   *        POD basis (LIBROM_BASE_FILENAME, up to MAX_BASIS_DIM modes) of a previous SAVE_LIBROM run.
+   * \return Kind of projection, NONE for the full order model.
+   */
+  ROM_PROJECTION GetKind_ROMProjection(void) const { return Kind_ROMProjection; }
+
   /*!
    * \brief Check if the gradient smoothing is active
    * \return true means that smoothing is applied to the sensitivities
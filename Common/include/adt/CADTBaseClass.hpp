@@ -29,6 +29,7 @@
 
 #include <vector>
 #include <array>
+#include <limits>
 
 #include "../basic_types/datatype_structure.hpp"
 #include "./CADTNodeClass.hpp"
@@ -80,6 +81,23 @@ class CADTBaseClass {
    */
   void BuildADT(unsigned short nDim, unsigned long nPoints, const su2double* coor);
 
+  /*!
+   * \brief Order of the query points along a Morton (Z-order) curve, such that consecutive
+   *        queries are close in space and traverse similar parts of the ADT.
+   * \param[in] nDim    Number of dimensions of the points.
+   * \param[in] nPoints Number of query points.
+   * \param[in] coor    Coordinates of the points.
+   * \param[in] stride  Distance between the coordinates of consecutive points in coor.
+   * \return The indices of the points in Morton order.
+   */
+  static vector<unsigned long> SpatialOrder(unsigned short nDim, unsigned long nPoints, const su2double* coor,
+                                            unsigned long stride);
+
+  /*!
+   * \brief Number of consecutive (Morton ordered) queries processed by a thread in batch searches.
+   */
+  static constexpr unsigned long QueryBlockSize = 64;
+
  public:
   /*!
    * \brief Function, which returns whether or not the ADT is empty.
@@ -60,6 +60,7 @@ class CADTElemClass : public CADTBaseClass {
                                                    of the elements in the ADT. */
   vector<int> ranksOfElems;            /*!< \brief Vector, which contains the ranks
                                                    of the elements in the ADT. */
+  bool isGlobal = false;               /*!< \brief Whether the ADT holds the elements of all ranks. */
 #ifdef HAVE_OMP
   vector<vector<CBBoxTargetClass> > BBoxTargets; /*!< \brief Vector, used to store possible bounding box
                                                              candidates during the nearest element search. */
@@ -84,6 +85,18 @@ class CADTElemClass : public CADTBaseClass {
                 vector<unsigned short>& val_VTKElem, vector<unsigned short>& val_markerID,
                 vector<unsigned long>& val_elemID, const bool globalTree);
 
+  /*!
+   * \brief Whether the ADT holds the elements of all ranks (global tree) or only those of this rank.
+   */
+  inline bool IsGlobal() const { return isGlobal; }
+
+  /*!
+   * \brief Bounding box of all the elements in the ADT (minimum larger than maximum if the ADT is empty).
+   * \param[out] bbMin - Minimum coordinates, nDim values.
+   * \param[out] bbMax - Maximum coordinates, nDim values.
+   */
+  void GetBoundingBox(passivedouble* bbMin, passivedouble* bbMax) const;
+
   /*!
    * \brief Function, which determines the element that contains the given coordinate.
    * \note This simply forwards the call to the implementation function selecting the right
@@ -122,6 +135,23 @@ class CADTElemClass : public CADTBaseClass {
                                  markerID, elemID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest elements in the ADT for a batch of coordinates.
+   * \note The queries are sorted along a Morton curve and distributed over the threads in blocks of
+   *       consecutive queries. The result of a query is used as the initial guess for the next query
+   *       of the block, which usually limits the traversal to a small part of the tree. This function
+   *       must not be called from within a parallel region.
+   * \param[in]  nQuery   Number of coordinates.
+   * \param[in]  coor     Coordinates, the i-th coordinate starts at coor + i*stride.
+   * \param[in]  stride   Distance between the starts of consecutive coordinates.
+   * \param[out] dist     Distance to the nearest element in the ADT, nQuery values.
+   * \param[out] markerID Local marker ID of the nearest element in the ADT, nQuery values.
+   * \param[out] elemID   Local element ID of the nearest element in the ADT, nQuery values.
+   * \param[out] rankID   Rank on which the nearest element in the ADT is stored, nQuery values.
+   */
+  void DetermineNearestElements(unsigned long nQuery, const su2double* coor, unsigned long stride, su2double* dist,
+                                unsigned short* markerID, unsigned long* elemID, int* rankID);
+
  private:
   /*!
    * \brief Implementation of DetermineContainingElement.
@@ -134,10 +164,15 @@ class CADTElemClass : public CADTBaseClass {
   /*!
    * \brief Implementation of DetermineNearestElement.
    * \note Working variables (first three) passed explicitly for thread safety.
+   * \param[in] seedElem Element used as the initial guess (e.g. the result for a nearby coordinate), ignored if
+   *                     it is not a valid element.
+   * \return Index of the nearest element in the ADT, to be used as seedElem for nearby coordinates.
    */
-  void DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets, vector<unsigned long>& frontLeaves,
-                                    vector<unsigned long>& frontLeavesNew, const su2double* coor, su2double& dist,
-                                    unsigned short& markerID, unsigned long& elemID, int& rankID) const;
+  unsigned long DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets, vector<unsigned long>& frontLeaves,
+                                             vector<unsigned long>& frontLeavesNew, const su2double* coor,
+                                             su2double& dist, unsigned short& markerID, unsigned long& elemID,
+                                             int& rankID,
+                                             unsigned long seedElem = numeric_limits<unsigned long>::max()) const;
 
   /*!
    * \brief Function, which checks whether or not the given coordinate is
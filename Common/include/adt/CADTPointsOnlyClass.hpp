@@ -69,6 +69,22 @@ class CADTPointsOnlyClass : public CADTBaseClass {
     DetermineNearestNode_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nearest nodes in the ADT for a batch of coordinates.
+   * \note The queries are sorted along a Morton curve and distributed over the threads in blocks of
+   *       consecutive queries. The result of a query is used as the initial guess for the next query
+   *       of the block, which usually limits the traversal to a small part of the tree. This function
+   *       must not be called from within a parallel region.
+   * \param[in]  nQuery  Number of coordinates.
+   * \param[in]  coor    Coordinates, the i-th coordinate starts at coor + i*stride.
+   * \param[in]  stride  Distance between the starts of consecutive coordinates.
+   * \param[out] dist    Distance to the nearest node in the ADT, nQuery values.
+   * \param[out] pointID Local point ID of the nearest node in the ADT, nQuery values.
+   * \param[out] rankID  Rank on which the nearest node in the ADT is stored, nQuery values.
+   */
+  void DetermineNearestNodes(unsigned long nQuery, const su2double* coor, unsigned long stride, su2double* dist,
+                             unsigned long* pointID, int* rankID);
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -78,7 +94,11 @@ class CADTPointsOnlyClass : public CADTBaseClass {
   /*!
    * \brief Implementation of DetermineNearestNode.
    * \note Working variables (first two) passed explicitly for thread safety.
+   * \param[in] seedNode Node used as the initial guess (e.g. the result for a nearby coordinate), the central
+   *                     node of the root leaf is used if it is not a valid node.
+   * \return Index of the nearest node in the ADT, to be used as seedNode for nearby coordinates.
    */
-  void DetermineNearestNode_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
-                                 const su2double* coor, su2double& dist, unsigned long& pointID, int& rankID) const;
+  unsigned long DetermineNearestNode_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
+                                          const su2double* coor, su2double& dist, unsigned long& pointID, int& rankID,
+                                          unsigned long seedNode = numeric_limits<unsigned long>::max()) const;
 };
@@ -38,11 +38,11 @@
  * \version 8.1.0 "Harrier"
  */
 struct CBBoxTargetClass {
-  unsigned long boundingBoxID;  /*!< \brief Corresponding bounding box ID. */
-  su2double possibleMinDist2;   /*!< \brief Possible minimimum distance squared to the
-                                            given coordinate. */
-  su2double guaranteedMinDist2; /*!< \brief Guaranteed minimum distance squared to the
-                                            given coordinate. */
+  unsigned long boundingBoxID;      /*!< \brief Corresponding bounding box ID. */
+  passivedouble possibleMinDist2;   /*!< \brief Possible minimimum distance squared to the
+                                                given coordinate. */
+  passivedouble guaranteedMinDist2; /*!< \brief Guaranteed minimum distance squared to the
+                                                given coordinate. */
 
   /*!
    * \brief Constructor of the class. Nothing to be done.
@@ -57,7 +57,8 @@ struct CBBoxTargetClass {
    * \param[in] val_guarDist2 - Guaranteed minimum distance squared to the target
                                 for this bounding box.
    */
-  inline CBBoxTargetClass(const unsigned long val_BBoxID, const su2double val_posDist2, const su2double val_guarDist2)
+  inline CBBoxTargetClass(const unsigned long val_BBoxID, const passivedouble val_posDist2,
+                          const passivedouble val_guarDist2)
       : boundingBoxID(val_BBoxID), possibleMinDist2(val_posDist2), guaranteedMinDist2(val_guarDist2) {}
 
   /*!
@@ -37,6 +37,26 @@
  * and so the real versions of the routined are after #else.
  */
 namespace AD {
+/*!
+ * \brief Sections of the tape that are profiled separately (see BeginTapeSection).
+ */
+enum class TapeSection : unsigned short {
+  GRADIENTS,
+  LIMITERS,
+  CONVECTIVE_RESIDUAL,
+  VISCOUS_RESIDUAL,
+  BOUNDARY_CONDITIONS,
+  TURBULENCE,
+  MESH_DEFORMATION,
+  OTHER, /*!< \brief Everything outside of the other sections. */
+};
+constexpr unsigned short nTapeSections = static_cast<unsigned short>(TapeSection::OTHER) + 1;
+
+/*!
+ * \brief Number of adjoint directions propagated by one tape evaluation in vector mode (see BeginVectorMode).
+ */
+constexpr unsigned short MaxAdjointDirections = 8;
+
 #ifndef CODI_REVERSE_TYPE
 /*!
  * \brief Start the recording of the operations and involved variables.
@@ -266,6 +286,70 @@ inline void SetIndex(int& index, const su2double& data) {}
  */
 inline void Push_TapePosition() {}
 
+/*!
+ * \brief Check if the tape stores the primal values, which allows re-evaluating it with new input values.
+ * \return True for the Primal* CoDiPack tapes.
+ */
+inline bool PrimalTapeAvailable() { return false; }
+
+/*!
+ * \brief Set the primal value of an input of a primal value tape.
+ * \param[in] index - Position in the tape.
+ * \param[in] val - Value to set.
+ */
+inline void SetPrimal(int index, const double val) {}
+
+/*!
+ * \brief Get the primal value of a variable of a primal value tape.
+ * \param[in] index - Position in the tape.
+ */
+inline double GetPrimal(int index) { return 0.0; }
+
+/*!
+ * \brief Re-evaluate the primal values of a primal value tape from the values of its inputs. Branches and
+ * other decisions taken during the recording are not revisited.
+ */
+inline void EvaluatePrimal() {}
+
+/*!
+ * \brief Start the vector mode, in which each tape evaluation propagates MaxAdjointDirections adjoints.
+ * SetDerivative and GetDerivative access the direction set by SetAdjointDirection, ComputeAdjoint evaluates all
+ * directions in one sweep, and ClearAdjoints clears all of them.
+ * \note Not available with OpenMP (OpDiLib) tapes.
+ */
+inline void BeginVectorMode() {}
+
+/*!
+ * \brief End the vector mode and release its adjoints.
+ */
+inline void EndVectorMode() {}
+
+/*!
+ * \brief Set the direction accessed by SetDerivative and GetDerivative in vector mode.
+ * \param[in] direction - Index of the direction, smaller than MaxAdjointDirections.
+ */
+inline void SetAdjointDirection(unsigned short direction) {}
+
+/*!
+ * \brief Enable the profiling of the tape by sections (memory and reverse evaluation time of each section).
+ * \note With OpenMP (OpDiLib) tapes the sections are not distinguished, only the recording and the evaluations of
+ *       the whole tape are timed.
+ * \param[in] enable - Whether the sections are recorded.
+ */
+inline void EnableTapeSections(bool enable) {}
+
+/*!
+ * \brief Attribute what is recorded from now on to a section of the tape. Nested sections are attributed to the
+ * outermost one. When the sections are enabled, the full tape evaluations (ComputeAdjoint) are timed per section.
+ * \param[in] section - The section.
+ */
+inline void BeginTapeSection(TapeSection section) {}
+
+/*!
+ * \brief End the section started by the matching BeginTapeSection.
+ */
+inline void EndTapeSection() {}
+
 /*!
  * \brief Start a passive region, i.e. stop recording.
  * \return True if tape was active.
@@ -337,6 +421,30 @@ extern codi::PreaccumulationHelper<su2double> PreaccHelper;
 SU2_OMP(threadprivate(PreaccHelper))
 #endif
 
+/*!
+ * \brief Start of a tape section, everything up to the next mark belongs to the section.
+ */
+struct TapeSectionMark {
+  TapeSection section;
+  Tape::Position position;
+  double memory; /*!< \brief Memory used by the tape at the mark. */
+};
+
+using VectorAdjointHelper = codi::CustomAdjointVectorHelper<su2double, codi::Direction<double, MaxAdjointDirections>>;
+
+extern VectorAdjointHelper* VectorAdjoints;
+extern unsigned short AdjointDirection;
+
+extern bool TapeSectionsEnabled;
+extern unsigned short TapeSectionDepth;
+extern std::vector<TapeSectionMark> TapeSectionMarks;
+
+void MarkTapeSection(TapeSection section);
+void ComputeAdjointBySection();
+void ComputeAdjointTimed();
+void ResetTapeSections();
+void TimeRecording(bool start);
+
 /*--- Reference to the tape. ---*/
 
 FORCEINLINE Tape& getTape() { return su2double::getTape(); }
@@ -347,9 +455,15 @@ FORCEINLINE void RegisterOutput(su2double& data) { AD::getTape().registerOutput(
 
 FORCEINLINE void ResetInput(su2double& data) { data = data.getValue(); }
 
-FORCEINLINE void StartRecording() { AD::getTape().setActive(); }
+FORCEINLINE void StartRecording() {
+  if (TapeSectionsEnabled) TimeRecording(true);
+  AD::getTape().setActive();
+}
 
-FORCEINLINE void StopRecording() { AD::getTape().setPassive(); }
+FORCEINLINE void StopRecording() {
+  AD::getTape().setPassive();
+  if (TapeSectionsEnabled) TimeRecording(false);
+}
 
 FORCEINLINE bool TapeActive() { return AD::getTape().isActive(); }
 
@@ -425,11 +539,30 @@ FORCEINLINE void PrintStatistics(Comm communicator, bool printingRank) {
   }
 }
 
-FORCEINLINE void ClearAdjoints() { AD::getTape().clearAdjoints(); }
+FORCEINLINE void ClearAdjoints() {
+  if (VectorAdjoints) {
+    VectorAdjoints->clearAdjoints();
+    return;
+  }
+  AD::getTape().clearAdjoints();
+}
 
 FORCEINLINE void ComputeAdjoint() {
 #if defined(HAVE_OPDI)
+  if (TapeSectionsEnabled) {
+    ComputeAdjointTimed();
+    return;
+  }
   opdi::logic->prepareEvaluate();
+#else
+  if (VectorAdjoints) {
+    VectorAdjoints->evaluate();
+    return;
+  }
+  if (!TapeSectionMarks.empty()) {
+    ComputeAdjointBySection();
+    return;
+  }
 #endif
   AD::getTape().evaluate();
 #if defined(HAVE_OPDI)
@@ -462,6 +595,7 @@ FORCEINLINE void Reset() {
 #endif
     TapePositions.clear();
   }
+  ResetTapeSections();
 }
 
 FORCEINLINE void ResizeAdjoints() { AD::getTape().resizeAdjointVector(); }
@@ -480,6 +614,10 @@ FORCEINLINE void SetDerivative(int index, const double val) {
   if (index == 0)  // Allow multiple threads to "set the derivative" of passive variables without causing data races.
     return;
 
+  if (VectorAdjoints) {
+    VectorAdjoints->gradient(index)[AdjointDirection] = val;
+    return;
+  }
   AD::getTape().setGradient(index, val, codi::AdjointsManagement::Manual);
 }
 
@@ -489,6 +627,7 @@ FORCEINLINE void SetDerivative(int index, const double val) {
 // This method does not perform locking either.
 // It should be safeguarded by calls to AD::BeginUseAdjoints() and AD::EndUseAdjoints().
 FORCEINLINE double GetDerivative(int index) {
+  if (VectorAdjoints) return VectorAdjoints->gradient(index)[AdjointDirection];
   return AD::getTape().getGradient(index, codi::AdjointsManagement::Manual);
 }
 
@@ -582,6 +721,56 @@ FORCEINLINE void Push_TapePosition() {
 #endif
 }
 
+FORCEINLINE bool PrimalTapeAvailable() {
+#ifdef CODI_PRIMAL_TAPE
+  return true;
+#else
+  return false;
+#endif
+}
+
+FORCEINLINE void SetPrimal(int index, const double val) {
+#ifdef CODI_PRIMAL_TAPE
+  if (index != 0) AD::getTape().setPrimal(index, val);
+#endif
+}
+
+FORCEINLINE double GetPrimal(int index) {
+#ifdef CODI_PRIMAL_TAPE
+  return AD::getTape().getPrimal(index);
+#else
+  return 0.0;
+#endif
+}
+
+FORCEINLINE void EvaluatePrimal() {
+#ifdef CODI_PRIMAL_TAPE
+  AD::getTape().evaluatePrimal();
+#endif
+}
+
+void BeginVectorMode();
+
+void EndVectorMode();
+
+FORCEINLINE void SetAdjointDirection(unsigned short direction) { AdjointDirection = direction; }
+
+FORCEINLINE void EnableTapeSections(bool enable) { TapeSectionsEnabled = enable; }
+
+/*--- With OpenMP the sections are recorded by all threads, they are not marked and only the whole tape is timed. ---*/
+
+FORCEINLINE void BeginTapeSection(TapeSection section) {
+#ifndef HAVE_OPDI
+  if (TapeSectionsEnabled && TapeSectionDepth++ == 0) MarkTapeSection(section);
+#endif
+}
+
+FORCEINLINE void EndTapeSection() {
+#ifndef HAVE_OPDI
+  if (TapeSectionsEnabled && --TapeSectionDepth == 0) MarkTapeSection(TapeSection::OTHER);
+#endif
+}
+
 FORCEINLINE void EndPreacc() {
   if (PreaccActive) {
     PreaccHelper.finish(false);
@@ -681,6 +870,15 @@ FORCEINLINE void ResumePreaccumulation(bool wasActive) {
 void Initialize();
 void Finalize();
 
+/*!
+ * \brief Print the memory and the reverse evaluation time of each section of the tape, if the sections are enabled
+ * (see BeginTapeSection), followed by the recording and reverse times per thread to assess the parallel scaling.
+ * The memory is summed and the time is maximized across MPI processes (collective).
+ * \param[in] printingRank - Whether this rank prints.
+ * \param[in] evaluated - Print only if the tape was evaluated, i.e. if there are reverse times to report.
+ */
+void PrintTapeSectionStatistics(bool printingRank, bool evaluated = false);
+
 }  // namespace AD
 
 /*--- If we compile under OSX we have to overload some of the operators for
@@ -83,9 +83,54 @@ passivedouble GetDerivative(const su2double& data);
  */
 void SetDerivative(su2double& data, const passivedouble& val);
 
+/*!
+ * \brief Number of derivative directions carried by the datatype, more than one in vector forward mode.
+ */
+#if defined(CODI_FORWARD_VECTOR_DIM)
+constexpr unsigned short nDirections = CODI_FORWARD_VECTOR_DIM;
+#else
+constexpr unsigned short nDirections = 1;
+#endif
+
+/*!
+ * \brief Get the derivative value of the datatype in one direction (see nDirections).
+ * \param[in] data - The non-primitive datatype.
+ * \param[in] iDir - The direction.
+ * \return The derivative value.
+ */
+passivedouble GetDerivative(const su2double& data, unsigned short iDir);
+
+/*!
+ * \brief Set the derivative value of the datatype in one direction (see nDirections).
+ * \param[in] data - The non-primitive datatype.
+ * \param[in] iDir - The direction.
+ * \param[in] val - The value of the derivative.
+ */
+void SetDerivative(su2double& data, unsigned short iDir, const passivedouble& val);
+
 /*--- Implementation of the above for the different types. ---*/
 
-#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+#if defined(CODI_FORWARD_VECTOR_DIM)  // vector forward mode, the scalar functions use the first direction
+
+FORCEINLINE void SetValue(su2double& data, const passivedouble& val) { data.setValue(val); }
+
+FORCEINLINE passivedouble GetValue(const su2double& data) { return data.getValue(); }
+
+FORCEINLINE void SetSecondary(su2double& data, const passivedouble& val) { data.gradient()[0] = val; }
+
+FORCEINLINE void SetDerivative(su2double& data, const passivedouble& val) { data.gradient()[0] = val; }
+
+FORCEINLINE passivedouble GetSecondary(const su2double& data) { return data.getGradient()[0]; }
+
+FORCEINLINE passivedouble GetDerivative(const su2double& data) { return data.getGradient()[0]; }
+
+FORCEINLINE passivedouble GetDerivative(const su2double& data, unsigned short iDir) { return data.getGradient()[iDir]; }
+
+FORCEINLINE void SetDerivative(su2double& data, unsigned short iDir, const passivedouble& val) {
+  data.gradient()[iDir] = val;
+}
+
+#elif defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
 
 FORCEINLINE void SetValue(su2double& data, const passivedouble& val) { data.setValue(val); }
 
@@ -99,6 +144,10 @@ FORCEINLINE passivedouble GetSecondary(const su2double& data) { return data.getG
 
 FORCEINLINE passivedouble GetDerivative(const su2double& data) { return data.getGradient(); }
 
+FORCEINLINE passivedouble GetDerivative(const su2double& data, unsigned short) { return data.getGradient(); }
+
+FORCEINLINE void SetDerivative(su2double& data, unsigned short, const passivedouble& val) { data.setGradient(val); }
+
 #else  // passive type, no AD
 
 FORCEINLINE void SetValue(su2double& data, const passivedouble& val) { data = val; }
@@ -112,6 +161,10 @@ FORCEINLINE passivedouble GetDerivative(const su2double&) { return 0.0; }
 FORCEINLINE passivedouble GetSecondary(const su2double&) { return 0.0; }
 
 FORCEINLINE void SetDerivative(su2double&, const passivedouble&) {}
+
+FORCEINLINE passivedouble GetDerivative(const su2double&, unsigned short) { return 0.0; }
+
+FORCEINLINE void SetDerivative(su2double&, unsigned short, const passivedouble&) {}
 #endif
 
 /*!
@@ -42,6 +42,19 @@
 #define NEVERINLINE inline
 #endif
 
+/*!
+ * \brief Hint that "bytes" of memory starting at "ptr" will be read soon (each cache line is prefetched).
+ */
+FORCEINLINE void su2prefetch(const void* ptr, unsigned long bytes = 1) {
+#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
+  const auto* p = static_cast<const char*>(ptr);
+  for (unsigned long offset = 0; offset < bytes; offset += 64) __builtin_prefetch(p + offset, 0, 3);
+#else
+  (void)ptr;
+  (void)bytes;
+#endif
+}
+
 #if defined(__INTEL_COMPILER)
 /*--- Disable warnings related to inline attributes. ---*/
 #pragma warning disable 2196
@@ -119,9 +132,17 @@ using su2double = codi::RealReversePrimalIndex;
     defined(CODI_PRIMAL_REUSE_TAPE) || defined(CODI_PRIMAL_MULTIUSE_TAPE)
 #define CODI_INDEX_REUSE
 #endif
+
+#if defined(CODI_PRIMAL_LINEAR_TAPE) || defined(CODI_PRIMAL_REUSE_TAPE) || defined(CODI_PRIMAL_MULTIUSE_TAPE)
+#define CODI_PRIMAL_TAPE
+#endif
 #elif defined(CODI_FORWARD_TYPE)  // forward mode AD
 #include "codi.hpp"
+#if defined(CODI_FORWARD_VECTOR_DIM)
+using su2double = codi::RealForwardVec<CODI_FORWARD_VECTOR_DIM>;
+#else
 using su2double = codi::RealForward;
+#endif
 #else  // primal / direct / no AD
 using su2double = double;
 #endif
@@ -137,6 +158,31 @@ using su2mixedfloat = float;
 using su2mixedfloat = passivedouble;
 #endif
 
+/*--- Define a type for the storage of slope limiters, which do not need double
+ * precision, lower precision is only used by primal (non-AD) builds. ---*/
+#if defined(USE_SINGLE_PRECISION_LIMITERS) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+using su2limiterfloat = float;
+#else
+using su2limiterfloat = su2double;
+#endif
+
+/*--- Define a type for the storage of the metric terms of the DG-FEM solver in the integration
+ * points, which for high order curved elements can take more memory than the solution, lower
+ * precision is only used by primal (non-AD) builds. ---*/
+#if defined(USE_SINGLE_PRECISION_DG_METRICS) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+using su2metricfloat = float;
+#else
+using su2metricfloat = su2double;
+#endif
+
+/*--- Define a type for the local (per rank) indices of the point connectivity (neighbors, edges,
+ * and elements of each point), 32 bits suffice unless a single rank holds billions of them. ---*/
+#ifdef USE_64BIT_LOCAL_INDICES
+using su2localindex = unsigned long;
+#else
+using su2localindex = unsigned int;
+#endif
+
 /*--- Detect if OpDiLib has to be used. ---*/
 #if defined(HAVE_OMP) && defined(CODI_REVERSE_TYPE)
 #ifndef __INTEL_COMPILER
@@ -541,8 +541,17 @@ class C2DContainer
 
   /*!
    * \brief Set value of all entries to "value".
+   * \note Outside of parallel regions, large containers of arithmetic type are set by all threads, with the
+   *       schedule of the light point loops of the solvers (NUMA first touch), see parallelFirstTouch.
    */
   void setConstant(const Scalar_t& value) noexcept {
+    if (std::is_arithmetic<Scalar_t>::value && size() >= FIRST_TOUCH_MIN_SIZE) {
+      constexpr size_t maxChunkRows = 512;
+      const size_t outer = IsRowMajor ? rows() : cols();
+      const size_t chunk = computeStaticChunkSize(outer, omp_get_max_threads(), maxChunkRows) * (size() / outer);
+      parallelFirstTouch(size(), chunk, value, m_data);
+      return;
+    }
     for (size_t i = 0; i < size(); ++i) m_data[i] = value;
   }
 
@@ -587,13 +596,36 @@ class C2DContainer
     static_assert(Size, "This method requires a static output type.");
     assert(Size <= cols() - start);
     StaticContainer ret;
+    /*--- Full blocks of N columns of row-major storage via transposed loads, then the remainder. ---*/
+    const size_t begin = IsRowMajor ? m_getTransposed(row, start, Size, ret.data()) : 0;
     for (size_t k = 0; k < N; ++k) {
       SU2_OMP_SIMD_IF_NOT_AD
-      for (size_t i = 0; i < Size; ++i)
+      for (size_t i = begin; i < Size; ++i)
         ret.data()[i][k] = m_data[IsRowMajor ? row[k] * cols() + i + start : row[k] + (i + start) * rows()];
     }
     return ret;
   }
+
+ private:
+  /*!
+   * \brief Copy the first "size" columns (rounded down to a multiple of N) of "row" to "ret",
+   * for row-major storage and SIMD types of the same scalar type, returns the number of columns copied.
+   */
+  template <class T, size_t N>
+  FORCEINLINE size_t m_getTransposed(simd::Array<T, N> row, Index_t start, size_t size,
+                                     simd::Array<Scalar_t, N>* ret) const noexcept {
+    size_t i = 0;
+    for (; i + N <= size; i += N) simd::loadTransposed(&m_data[start + i], row, cols(), &ret[i]);
+    return i;
+  }
+
+  /*!
+   * \brief Fallback of the above for other types, nothing is copied.
+   */
+  template <class T, size_t N, class U>
+  FORCEINLINE size_t m_getTransposed(simd::Array<T, N>, Index_t, size_t, U*) const noexcept {
+    return 0;
+  }
 };
 
 /*!
@@ -27,8 +27,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -36,6 +38,61 @@
 #include "CFileReaderLUT.hpp"
 #include "CTrapezoidalMap.hpp"
 
+/*!
+ * \brief Read-only rows of table data of equal length, either owned or a view of a binary table in memory.
+ * \ingroup LookUpInterp
+ */
+template <class T>
+class CLookUpTableRows {
+ private:
+  std::vector<T> owned;    /*!< \brief Storage, if the data is not a view. */
+  const T* ptr = nullptr;  /*!< \brief First entry of the first row. */
+  unsigned long n_rows = 0, n_cols = 0;
+
+ public:
+  CLookUpTableRows() = default;
+  CLookUpTableRows(const CLookUpTableRows&) = delete;
+  CLookUpTableRows(CLookUpTableRows&&) = default;
+  CLookUpTableRows& operator=(const CLookUpTableRows&) = delete;
+  CLookUpTableRows& operator=(CLookUpTableRows&&) = default;
+
+  /*!
+   * \brief Allocate owned storage.
+   * \return Pointer to the storage, to be filled by the caller.
+   */
+  T* Allocate(unsigned long rows, unsigned long cols) {
+    owned.assign(rows * cols, T(0));
+    ptr = owned.data();
+    n_rows = rows;
+    n_cols = cols;
+    return owned.data();
+  }
+
+  /*!
+   * \brief Use data of the same type in place, it must outlive this object.
+   */
+  void Load(unsigned long rows, unsigned long cols, const T* data) {
+    std::vector<T>().swap(owned);
+    ptr = data;
+    n_rows = rows;
+    n_cols = cols;
+  }
+
+  /*!
+   * \brief Copy (and convert) data of another type, e.g. passive values for AD types.
+   */
+  template <class U>
+  void Load(unsigned long rows, unsigned long cols, const U* data) {
+    auto* dst = Allocate(rows, cols);
+    for (unsigned long i = 0; i < rows * cols; ++i) dst[i] = T(data[i]);
+  }
+
+  inline const T* operator[](unsigned long i_row) const { return ptr + i_row * n_cols; }
+  inline const T* data() const { return ptr; }
+  inline unsigned long rows() const { return n_rows; }
+  inline unsigned long cols() const { return n_cols; }
+};
+
 /*!
  * \brief Look up table.
  * \ingroup LookUpInterp
@@ -56,7 +113,8 @@ class CLookUpTable {
 
   su2vector<unsigned long> n_points, /*!< \brief Number of data poins per table level.*/
       n_triangles,                   /*!< \brief Number of triangles per table level.*/
-      n_hull_points;                 /*!< \brief Number of outer boundary points per table level.*/
+      n_hull_points,                 /*!< \brief Number of outer boundary points per table level.*/
+      n_edges;                       /*!< \brief Number of unique edges per table level.*/
 
   unsigned long n_variables, n_table_levels = 1;
 
@@ -66,8 +124,8 @@ class CLookUpTable {
   /*!
    * \brief The lower and upper limits of the z, y and x variable for each table level.
    */
-  std::pair<su2double*, su2double*> limits_table_z;
-  su2vector<std::pair<su2double*, su2double*>> limits_table_y, limits_table_x;
+  std::pair<const su2double*, const su2double*> limits_table_z;
+  su2vector<std::pair<const su2double*, const su2double*>> limits_table_y, limits_table_x;
 
   /*! \brief Holds the variable names stored in the table file.
    * Order is in sync with data.
@@ -75,18 +133,18 @@ class CLookUpTable {
   su2vector<std::string> names_var;
 
   /*! \brief
-   * Holds all data stored in the table. First index addresses the variable
+   * Holds all data stored in the table for each level. First index addresses the variable
    * while second index addresses the point.
    */
-  su2vector<su2activematrix> table_data;
+  std::vector<CLookUpTableRows<su2double>> table_data;
 
   double memory_footprint_data = 0; /*!< \brief Memory footprint of the loaded table data. */
 
   /*! \brief
    * Holds all connectivity data stored in the table for each level. First index
-   * addresses the variable while second index addresses the point.
+   * addresses the triangle while second index addresses the point.
    */
-  su2vector<su2matrix<unsigned long>> triangles;
+  std::vector<CLookUpTableRows<unsigned long>> triangles;
 
   /*! \brief
    * Edge information for each table level.
@@ -104,10 +162,64 @@ class CLookUpTable {
    */
   su2vector<CTrapezoidalMap> trap_map_x_y;
 
+  /*!
+   * \brief Uniform grid over the (normalized) controlling variables of a level, each cell lists the triangles
+   *        whose bounding box overlaps it, to locate points without searching the trapezoidal map.
+   */
+  struct CSearchGrid {
+    passivedouble x_min = 0, y_min = 0, inv_dx = 0, inv_dy = 0;
+    unsigned long nx = 0, ny = 0;
+    std::vector<unsigned long> cell_offsets;   /*!< \brief Start of the triangles of each cell (CSR). */
+    std::vector<unsigned long> cell_triangles; /*!< \brief Candidate triangles of the cells. */
+
+    inline unsigned long CellX(passivedouble x) const {
+      return std::min(nx - 1, static_cast<unsigned long>(std::max(0.0, (x - x_min) * inv_dx)));
+    }
+    inline unsigned long CellY(passivedouble y) const {
+      return std::min(ny - 1, static_cast<unsigned long>(std::max(0.0, (y - y_min) * inv_dy)));
+    }
+  };
+  std::vector<CSearchGrid> search_grid; /*!< \brief Search grid of each level, empty if not used. */
+  std::vector<unsigned long> last_triangle; /*!< \brief Last triangle found on each level, tested first. */
+  std::vector<bool> on_device; /*!< \brief Whether the data of each level is mapped to the offload device. */
+
+  /*!
+   * \brief Rectilinear grid of a level whose points are the tensor product of the unique values of the controlling
+   *        variables, the cell of a point is computed instead of searched, and the values interpolated bilinearly.
+   */
+  struct CStructuredLevel {
+    std::vector<passivedouble> x, y;      /*!< \brief Sorted unique values of the controlling variables. */
+    std::vector<unsigned long> point_ids; /*!< \brief Table point of each node (ix + nx * iy). */
+    passivedouble inv_dx = 0, inv_dy = 0; /*!< \brief Inverse of the spacing, if uniform, 0 otherwise. */
+
+    inline bool IsRegular() const { return !point_ids.empty(); }
+
+    /*!
+     * \brief Index of the cell (interval) of the sorted values that contains val, clamped to the first/last cell.
+     */
+    static inline unsigned long CellIndex(const std::vector<passivedouble>& values, passivedouble inv_delta,
+                                          passivedouble val) {
+      const auto n_cells = values.size() - 1;
+      if (inv_delta > 0) {
+        const auto i = static_cast<long>((val - values[0]) * inv_delta);
+        return static_cast<unsigned long>(std::max(0l, std::min(long(n_cells) - 1, i)));
+      }
+      const auto i = std::upper_bound(values.begin() + 1, values.end() - 1, val) - values.begin() - 1;
+      return static_cast<unsigned long>(i);
+    }
+  };
+  std::vector<CStructuredLevel> structured_levels; /*!< \brief Structured grid of each level, empty if not used. */
+
   /*! \brief
-   * Vector of all the weight factors for the interpolation.
+   * Inverse interpolation matrices (3x3, row-major) of all triangles of each level.
    */
-  su2vector<su2vector<su2activematrix>> interp_mat_inv_x_y;
+  std::vector<CLookUpTableRows<su2double>> interp_mat_inv_x_y;
+
+  /*! \brief
+   * Image of a binary table file, the table data, connectivity and interpolation matrices are views of it.
+   * In MPI builds without AD, the image is shared by the ranks of each compute node.
+   */
+  std::shared_ptr<const char> binary_image;
 
   /*! \brief
    * Returns true if the string is null or zero (ignores case).
@@ -149,6 +261,12 @@ class CLookUpTable {
    */
   void LoadTableRaw(const std::string& file_name_lut);
 
+  /*!
+   * \brief Load a table written by WriteBinary, including its edges, trapezoidal maps and interpolation matrices.
+   * \param[in] file_name_lut - the filename of the binary lookup table.
+   */
+  void LoadTableBinary(const std::string& file_name_lut);
+
   /*!
    * \brief Compute vector of all (inverse) interpolation coefficients "interp_mat_inv_x_y" of all triangles.
    */
@@ -162,16 +280,16 @@ class CLookUpTable {
    * \param[out] interp_mat_inv - Inverse matrix for interpolation.
    */
   void GetInterpMatInv(const su2double* vec_CV1, const su2double* vec_CV2, std::array<unsigned long, 3>& point_ids,
-                       su2activematrix& interp_mat_inv);
+                       su2double* interp_mat_inv);
 
   /*!
    * \brief Compute the interpolation coefficients for the triangular interpolation.
    * \param[in] val_CV1 - Value of first coordinate (progress variable).
    * \param[in] val_CV2 - Value of second coordinate (enthalpy).
-   * \param[in] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[in] interp_mat_inv - Inverse matrix for interpolation (3x3, row-major).
    * \param[out] interp_coeffs - Interpolation coefficients.
    */
-  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                        std::array<su2double, 3>& interp_coeffs) const;
 
   /*!
@@ -316,8 +434,71 @@ class CLookUpTable {
   std::pair<unsigned long, unsigned long> FindNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
                                                                const unsigned long iLevel = 0);
 
+  /*!
+   * \brief Bilinear interpolation on a regular level (see CStructuredLevel).
+   * \param[in] idx_var - Table indices of the variables.
+   * \param[out] val_vars - Interpolated values.
+   * \param[in] val_CV1 - Value of controlling variable 1.
+   * \param[in] val_CV2 - Value of controlling variable 2.
+   * \param[in] i_level - Table level index.
+   * \returns whether query is inside (true) or outside (false) data set, outside points are extrapolated as usual.
+   */
+  bool LookUp_XY_Structured(const std::vector<unsigned long>& idx_var, std::vector<su2double>& val_vars,
+                            su2double val_CV1, su2double val_CV2, unsigned long i_level);
+
+  /*!
+   * \brief Map the data of a level used by the batch lookup (table data, triangles, interpolation matrices and
+   *        search grid) to the offload device, once.
+   * \param[in] i_level - Table level index.
+   */
+  void MapToDevice(unsigned long i_level);
+
+  /*!
+   * \brief Locate and interpolate a batch of points on the offload device, see LookUp_XY_Batch.
+   */
+  void LookUp_XY_Device(unsigned long n_batch, const std::vector<unsigned long>& idx_var, const su2double* val_CV1,
+                        const su2double* val_CV2, su2double* val_vars, unsigned long* outside, unsigned long i_level);
+
  public:
-  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in);
+  /*!
+   * \brief Load a table, ASCII (.drg) or binary (.drb, see WriteBinary).
+   * \param[in] file_name_lut - the filename of the lookup table.
+   * \param[in] name_CV1_in - Name of controlling variable 1.
+   * \param[in] name_CV2_in - Name of controlling variable 2.
+   * \param[in] write_binary - Write the binary version of an ASCII table, to be used by subsequent runs.
+   */
+  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in,
+               bool write_binary = false);
+
+  /*!
+   * \brief Release the data mapped to the offload device.
+   */
+  ~CLookUpTable();
+
+  /*!
+   * \brief Build a uniform search grid for each level, which replaces the trapezoidal map search, and keep the
+   *        last triangle found on each level to test it first, since consecutive queries are usually close.
+   * \note The table is then no longer safe to share between threads (each fluid model has its own table).
+   */
+  void BuildSearchGrid();
+
+  /*!
+   * \brief Detect the levels whose points form a tensor-product grid of the controlling variables, which are then
+   *        interpolated bilinearly (trilinearly between levels) without searching the triangulation.
+   * \return Number of regular levels.
+   */
+  unsigned long DetectStructuredLevels();
+
+  /*!
+   * \brief Write the table with its edges, trapezoidal maps and interpolation matrices to a binary file (.drb),
+   *        which is loaded without any preprocessing (master node only).
+   * \note The layout is a sequence of 8-byte aligned blocks: "SU2LUTB1", uint64 {dimension, levels, variables},
+   *       the version strings and variable names (uint64 length, chars), and for each level the z value (double),
+   *       uint64 {points, triangles, hull points, edges}, the data of each variable (double), the triangles
+   *       (3 uint64 each), the hull (uint64), the interpolation matrices (9 doubles each), and the trapezoidal map.
+   * \param[in] file_name - Name of the binary file.
+   */
+  void WriteBinary(const std::string& file_name) const;
 
   /*!
    * \brief Print information to screen.
@@ -356,6 +537,30 @@ class CLookUpTable {
    */
   bool LookUp_XY(const std::vector<unsigned long>& idx_var, std::vector<su2double*>& val_vars, const su2double val_CV1,
                  su2double val_CV2, const unsigned long i_level = 0);
+
+  /*!
+   * \brief Lookup the values of several variables for a batch of points of a 2D table. With offloading enabled
+   *        (HAVE_OMP_TARGET), a device available, and the search grid built, large batches are located and
+   *        interpolated on the device, in chunks whose transfers overlap the computation of other chunks.
+   *        Points outside the table are extrapolated on the host. Regular levels (DetectStructuredLevels) are
+   *        interpolated on the host in vectorizable loops over the points.
+   * \param[in] n_batch - Number of points.
+   * \param[in] idx_var - Table indices of the variables.
+   * \param[in] val_CV1 - Values of controlling variable 1.
+   * \param[in] val_CV2 - Values of controlling variable 2.
+   * \param[out] val_vars - Values of the variables, point-major (n_batch x idx_var.size()).
+   * \param[out] outside - Whether each point is outside (1) or inside (0) the data set.
+   * \param[in] i_level - Table level index.
+   */
+  void LookUp_XY_Batch(unsigned long n_batch, const std::vector<unsigned long>& idx_var, const su2double* val_CV1,
+                       const su2double* val_CV2, su2double* val_vars, unsigned long* outside,
+                       unsigned long i_level = 0);
+
+  /*!
+   * \brief Whether LookUp_XY_Batch uses an offload device for large batches.
+   */
+  bool UsesDevice() const;
+
   /*!
    * \brief Lookup the value of the variable stored under idx_var using controlling variable values(val_CV1,val_CV2,
    * val_CV3). \param[in] val_name_var - String name of the variable to look up. \param[out] val_var - The stored value
@@ -397,7 +602,7 @@ class CLookUpTable {
    * \brief Determine the minimum and maximum value of the second controlling variable.
    * \returns Pair of minimum and maximum value of controlling variable 2.
    */
-  inline std::pair<su2double*, su2double*> GetTableLimitsY(const unsigned long i_level = 0) const {
+  inline std::pair<const su2double*, const su2double*> GetTableLimitsY(const unsigned long i_level = 0) const {
     return limits_table_y[i_level];
   }
 
@@ -405,7 +610,7 @@ class CLookUpTable {
    * \brief Determine the minimum and maximum value of the first controlling variable.
    * \returns Pair of minimum and maximum value of controlling variable 1.
    */
-  inline std::pair<su2double*, su2double*> GetTableLimitsX(const unsigned long i_level = 0) const {
+  inline std::pair<const su2double*, const su2double*> GetTableLimitsX(const unsigned long i_level = 0) const {
     return limits_table_x[i_level];
   }
 
@@ -27,7 +27,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -71,6 +73,21 @@
   void Set(unsigned long row, std::vector<passivedouble> vals) {                                                 \
     unsigned long j = 0;                                                                                         \
     for (const auto& val : vals) Set(row, j++, val);                                                             \
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Gets all the values of the matrix (row-major), with a single call. */                               \
+  std::vector<passivedouble> GetAll() const {                                                                    \
+    std::vector<passivedouble> vals(rows_ * cols_);                                                              \
+    for (unsigned long i = 0; i < rows_; ++i)                                                                    \
+      for (unsigned long j = 0; j < cols_; ++j) vals[i * cols_ + j] = SU2_TYPE::GetValue(Access(i, j));          \
+    return vals;                                                                                                 \
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Sets all the values of the matrix (row-major), with a single call. This clears derivative info. */  \
+  void SetAll(const std::vector<passivedouble>& vals) {                                                          \
+    if (vals.size() != rows_ * cols_) SU2_MPI::Error(name_ + " size mismatch", CURRENT_FUNCTION);                \
+    for (unsigned long i = 0; i < rows_; ++i)                                                                    \
+      for (unsigned long j = 0; j < cols_; ++j) Access(i, j) = vals[i * cols_ + j];                              \
   }
 
 /*!
@@ -109,6 +126,18 @@ class CPyWrapperMatrixView {
   CPyWrapperMatrixView(su2activematrix& mat, const std::string& name, bool read_only)
       : data_(mat.data()), rows_(mat.rows()), cols_(mat.cols()), name_(name), read_only_(read_only) {}
 
+  /*!
+   * \brief Returns the address of the (contiguous, row-major) data, used by the NumPy array interface
+   * of the Python wrapper to create views of the data without copies.
+   * \note Only available when su2double is passivedouble, i.e. not in AD builds.
+   */
+  unsigned long long DataAddress() const {
+    if (!std::is_same<su2double, passivedouble>::value) {
+      SU2_MPI::Error(name_ + " cannot be accessed without copies in AD builds", "CPyWrapperMatrixView");
+    }
+    return static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(data_));
+  }
+
   /*--- Use the macro to generate the interface. ---*/
   PY_WRAPPER_MATRIX_INTERFACE
 };
@@ -41,6 +41,8 @@
  * \version 8.1.0 "Harrier"
  */
 class CTrapezoidalMap {
+  friend class CLookUpTable; /*!< \brief Writes and loads the map with binary tables. */
+
  protected:
   /* The unique values of x which exist in the data */
   std::vector<su2double> unique_bands_x;
@@ -234,14 +234,15 @@ class CVolumeElementFEM {
 
   su2double lenScale; /*!< \brief Length scale of the element. */
 
-  su2double shockSensorValue;         /*!< \brief Value for sensing a shock */
-  su2double shockArtificialViscosity; /*!< \brief Artificial viscosity for a shock */
+  su2double shockSensorValue = -1000.0;       /*!< \brief Value for sensing a shock */
+  su2double shockArtificialViscosity = 0.0;   /*!< \brief Artificial viscosity for a shock */
+  bool shockTroubled = false;                 /*!< \brief Whether the shock sensor flagged this element. */
 
-  vector<su2double> metricTerms;           /*!< \brief Vector of the metric terms in the
+  vector<su2metricfloat> metricTerms;      /*!< \brief Vector of the metric terms in the
                                                        integration points of this element. */
   vector<su2double> metricTermsSolDOFs;    /*!< \brief Vector of the metric terms in the
                                                        solution DOFs of this element. */
-  vector<su2double> metricTerms2ndDer;     /*!< \brief Vector of the metric terms needed for the
+  vector<su2metricfloat> metricTerms2ndDer; /*!< \brief Vector of the metric terms needed for the
                                                        computation of the 2nd derivatives in the
                                                        integration points. Only determined when
                                                        needed (ADER-DG with non-aliased predictor
@@ -322,9 +323,9 @@ struct CInternalFaceElementFEM {
 
   vector<su2double> metricNormalsFace;    /*!< \brief The normals in the integration points of the face.
                                                       The normals point from side 0 to side 1. */
-  vector<su2double> metricCoorDerivFace0; /*!< \brief The terms drdx, dsdx, etc. of side 0 in the
+  vector<su2metricfloat> metricCoorDerivFace0; /*!< \brief The terms drdx, dsdx, etc. of side 0 in the
                                                       integration points of the face. */
-  vector<su2double> metricCoorDerivFace1; /*!< \brief The terms dxdr, dydr, etc. of side 1 in the
+  vector<su2metricfloat> metricCoorDerivFace1; /*!< \brief The terms dxdr, dydr, etc. of side 1 in the
                                                       integration points of the face. */
 
   vector<su2double> coorIntegrationPoints; /*!< \brief Coordinates for the integration points of this face. */
@@ -371,7 +372,7 @@ struct CSurfaceElementFEM {
 
   vector<su2double> metricNormalsFace;     /*!< \brief The normals in the integration points of the face.
                                                        The normals point out of the adjacent element. */
-  vector<su2double> metricCoorDerivFace;   /*!< \brief The terms drdx, dsdx, etc. in the integration
+  vector<su2metricfloat> metricCoorDerivFace; /*!< \brief The terms drdx, dsdx, etc. in the integration
                                                        points of the face. */
   vector<su2double> coorIntegrationPoints; /*!< \brief The coordinates of the integration points of the face. */
   vector<su2double> gridVelocities;        /*!< \brief Grid velocities in the integration points of this face. */
@@ -646,8 +647,8 @@ class CMeshFEM : public CGeometry {
   *  \param[in] config         - Definition of the particular problem.
   */
   void ComputeGradientsCoordinatesFace(const unsigned short nIntegration, const unsigned short nDOFs,
-                                       const su2double* matDerBasisInt, const unsigned long* DOFs, su2double* derivCoor,
-                                       CConfig* config);
+                                       const su2double* matDerBasisInt, const unsigned long* DOFs,
+                                       su2metricfloat* derivCoor, CConfig* config);
   /*!
   * \brief Function, which computes the gradients of the Cartesian coordinates
            w.r.t. the parametric coordinates in the given set of integration
@@ -858,6 +859,12 @@ class CMeshFEM_DG : public CMeshFEM {
    */
   void MetricTermsVolumeElements(CConfig* config);
 
+  /*!
+   * \brief Function, which writes the memory used by the metric terms of the volume
+            and surface elements, relative to the memory of the solution, to the screen.
+   */
+  void ReportMemoryMetricTerms(void) const;
+
   /*!
    * \brief Set the send receive boundaries of the grid.
    * \param[in] config - Definition of the particular problem.
@@ -1156,10 +1163,12 @@ class CMeshFEM_DG : public CMeshFEM {
   * \param[in]  gradCoor     - The gradients of the coordinates (w.r.t. the
                                parametric coordinates) from which the metric
                                terms must be computed.
-  * \param[out] metricTerms  - Vector in which the metric terms must be stored.
+  * \param[out] metricTerms  - Vector in which the metric terms must be stored
+                               (stored or temporary metric terms, hence the template).
   */
+  template <class MetricType>
   void VolumeMetricTermsFromCoorGradients(const unsigned short nEntities, const su2double* gradCoor,
-                                          vector<su2double>& metricTerms);
+                                          vector<MetricType>& metricTerms);
 
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
@@ -715,6 +715,16 @@ class CFEMStandardElement : public CFEMStandardElementBase {
                                             functions   in the integration points. As such second derivatives can be
                                             computed   using one call to the BLAS routines. */
 
+  unsigned short nDOFs1D = 0; /*!< \brief Number of DOFs per direction of a tensor product element (quadrilateral or
+                                           hexahedron), 0 if the sum-factorization kernels cannot be used. */
+  unsigned short nInt1D = 0;  /*!< \brief Number of integration points per direction of a tensor product element. */
+
+  vector<su2double> lagBasisInt1D;         /*!< \brief 1D Lagrangian basis functions in the 1D integration points,
+                                                       nInt1D x nDOFs1D, row major. */
+  vector<su2double> lagBasisInt1DTrans;    /*!< \brief Transpose of lagBasisInt1D. */
+  vector<su2double> derLagBasisInt1DTrans; /*!< \brief Transpose of the derivatives of the 1D Lagrangian basis
+                                                       functions in the 1D integration points. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs
                                        is such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs
@@ -861,6 +871,37 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   */
   inline const su2double* GetMat2ndDerBasisFunctionsInt(void) const { return mat2ndDerBasisInt.data(); }
 
+  /*!
+   * \brief Function, which indicates whether the sum-factorization kernels can be used for this standard element.
+   * \return True for quadrilaterals and hexahedra, for which the DOFs and the integration points are tensor products.
+   */
+  inline bool TensorProductKernels(void) const { return nDOFs1D > 0; }
+
+  /*!
+  * \brief Function, which interpolates data from the DOFs to the integration points by sum-factorization.
+           It is equivalent to a gemm with the first nIntegration rows of matBasisIntegration, but the cost
+           is O(p^(d+1)) per entry instead of O(p^(2d)).
+  * \param[in]  NPad     - Padded number of entries per DOF/integration point (leading dimension).
+  * \param[in]  dataDOFs - Data in the DOFs, nDOFs x NPad.
+  * \param[out] dataInt  - Data in the integration points, nIntegration x NPad.
+  * \param[in]  work     - Work array of size 2*max(nDOFs,nIntegration)*NPad.
+  */
+  void TensorProductInterpolation(unsigned short NPad, const su2double* dataDOFs, su2double* dataInt,
+                                  su2double* work) const;
+
+  /*!
+  * \brief Function, which computes the volume residual from the fluxes (and optionally the source terms)
+           in the integration points by sum-factorization. It is equivalent to a gemm with matDerBasisIntTrans,
+           plus a gemm with lagBasisIntegrationTrans for the source terms.
+  * \param[in]  NPad    - Padded number of entries per DOF/integration point (leading dimension).
+  * \param[in]  fluxes  - Fluxes in the integration points, stored as (nIntegration x nDim) x NPad.
+  * \param[in]  sources - Source terms in the integration points (nIntegration x NPad), may be nullptr.
+  * \param[out] res     - Residual in the DOFs, nDOFs x NPad.
+  * \param[in]  work    - Work array of size 2*max(nDOFs,nIntegration)*NPad.
+  */
+  void TensorProductResidual(unsigned short NPad, const su2double* fluxes, const su2double* sources, su2double* res,
+                             su2double* work) const;
+
   /*!
    * \brief Function, which makes available the connectivity of face 0.
    * \return  The pointer to data, which stores the connectivity of face 0.
@@ -990,7 +1031,7 @@ class CFEMStandardElement : public CFEMStandardElementBase {
            type. This information is used to determine a well balanced partition.
   * \param[in] config - Object, which contains the input parameters.
   */
-  su2double WorkEstimateMetis(CConfig* config);
+  su2double WorkEstimateMetis(CConfig* config) const;
 
  private:
   /*!
@@ -1037,6 +1078,30 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   void CreateBasisFunctionsAndMatrixDerivatives(const vector<su2double>& rLoc, const vector<su2double>& sLoc,
                                                 const vector<su2double>& tLoc, vector<su2double>& matVandermondeInv,
                                                 vector<su2double>& lagBasis, vector<su2double>& matDerBasis);
+
+  /*!
+  * \brief Function, which creates the 1D data of the sum-factorization kernels for quadrilaterals and
+           hexahedra. Other element types, and elements for which the integration points do not form a
+           tensor product, keep using the full matrices.
+  */
+  void CreateTensorProductData(void);
+
+  /*!
+  * \brief Function, which applies one 1D operator per parametric direction to tensor product data,
+           i.e. out = (A_{nDim-1} x ... x A_0) in, one direction at a time.
+  * \param[in]  NPad     - Padded number of entries per point (leading dimension).
+  * \param[in]  mat      - The 1D operators (nOut x nIn, row major), one per direction.
+  * \param[in]  nOut     - Number of output points per direction.
+  * \param[in]  nIn      - Number of input points per direction.
+  * \param[in]  in       - Input data.
+  * \param[in]  strideIn - Stride (in units of NPad) between the input points.
+  * \param[out] out      - Output data, nOut^nDim x NPad.
+  * \param[in]  add      - Whether to add to, instead of overwrite, out.
+  * \param[in]  work     - Work array of size 2*max(nDOFs,nIntegration)*NPad.
+  */
+  void TensorProductApply(unsigned short NPad, const su2double* const* mat, unsigned short nOut, unsigned short nIn,
+                          const su2double* in, unsigned short strideIn, su2double* out, bool add,
+                          su2double* work) const;
   /*!
    * \brief Function, which creates all the data for a line element.
    */
@@ -66,6 +66,25 @@ extern "C" {
 
 using namespace std;
 
+/*!
+ * \struct CElementFilterCache
+ * \brief Cached filter of values at element CG (see CGeometry::FilterValuesAtElementCG), i.e. a sparse
+ *        matrix per kernel whose rows are the local elements and whose columns are global element indices.
+ * \note The weights are passive, when recording they are recomputed to capture the dependency on the coordinates.
+ */
+struct CElementFilterCache {
+  vector<CCompressedSparsePatternUL> neighbours; /*!< \brief Radial neighbourhood of each local element, per kernel. */
+  vector<vector<passivedouble> > weights;         /*!< \brief Normalized weights of the distance-based kernels. */
+
+  /*!
+   * \brief Discard the cache, e.g. if the mesh changes.
+   */
+  void clear() {
+    neighbours.clear();
+    weights.clear();
+  }
+};
+
 /*!
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry,
@@ -80,6 +99,9 @@ class CGeometry {
   const int size{SINGLE_NODE}; /*!< \brief MPI Size. */
   const int rank{MASTER_NODE}; /*!< \brief MPI Rank. */
 
+  vector<unsigned long> DomainPoints_GlobalOrder; /*!< \brief Local domain points in ascending order of global index. */
+  vector<unsigned long> DomainPoints_GlobalIndex; /*!< \brief Global indices of those points (ascending). */
+
   unsigned long nPoint{0}, /*!< \brief Number of points of the mesh. */
       nPointDomain{0},     /*!< \brief Number of real points of the mesh. */
       nPointGhost{0},      /*!< \brief Number of ghost points of the mesh. */
@@ -143,9 +165,23 @@ class CGeometry {
 
   vector<su2double> XCoordList; /*!< \brief Vector containing points appearing on a single plane */
 
+  vector<passivedouble> pointCost; /*!< \brief Time spent by each point in the profiled loops (empty if not profiling). */
+  passivedouble pointCostStartTime{0.0}; /*!< \brief Start of the profiled iterations. */
+  unsigned long pointCostIter{0};        /*!< \brief Iterations seen by the point cost profiler. */
+  static constexpr uint64_t PointCostFileMagic = 0x5355325043535431; /*!< \brief Identifies point cost files. */
+
+  /*!
+   * \brief Read the relative cost of a range of points from the file written by the point cost profiler.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nPointGlobal - Number of points of the grid, must match the file.
+   * \param[in] firstIndex - Global index of the first point to read.
+   * \param[out] cost - Relative cost of the points, sized by the caller.
+   * \return False if the file does not exist or does not match the grid.
+   */
+  static bool ReadPointCost(const CConfig* config, unsigned long nPointGlobal, unsigned long firstIndex,
+                            vector<float>& cost);
+
 #if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
-  vector<vector<unsigned long>>
-      adj_nodes; /*!< \brief Vector of vectors holding each node's adjacency during preparation for ParMETIS. */
   vector<idx_t> adjacency; /*!< \brief Local adjacency array to be input into ParMETIS for partitioning (idx_t is a
                               ParMETIS type defined in their headers). */
   vector<idx_t> xadj; /*!< \brief Index array that points to the start of each node's adjacency in CSR format (needed to
@@ -194,15 +230,81 @@ class CGeometry {
 
   CEdgeToNonZeroMapUL edgeToCSRMap; /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
 
+  /*--- Multigrid transfer operator of coarse grids (rows are the coarse points, columns their children). ---*/
+
+  CCompressedSparsePatternUL MGTransferPattern; /*!< \brief Children (fine grid points) of each coarse grid point. */
+  su2activevector MGTransferWeights;            /*!< \brief Volume of each child over the volume of its parent. */
+
   /*--- Edge and element colorings. ---*/
 
   CCompressedSparsePatternUL edgeColoring, /*!< \brief Edge coloring structure for thread-based parallelization. */
       elemColoring;                        /*!< \brief Element coloring structure for thread-based parallelization. */
   unsigned long edgeColorGroupSize{1};     /*!< \brief Size of the edge groups within each color. */
+
+  /*--- Structure-of-arrays storage of the hot vertex data, per marker. ---*/
+
+  vector<su2vector<unsigned long> > vertexNodes; /*!< \brief Node of each vertex (copy of CVertex::GetNode). */
+  vector<su2activematrix> vertexNormals; /*!< \brief Normal of each vertex, the normals of the CVertex point here. */
+  bool edgeColoringLargestFirst{false};    /*!< \brief Edge groups colored in largest-degree-first order. */
   unsigned long elemColorGroupSize{1};     /*!< \brief Size of the element groups within each color. */
 
+  su2matrix<bool> boundaryMarkerOverlap; /*!< \brief Whether the boundary loops of two markers touch the same points. */
+
   ColMajorMatrix<uint8_t> CoarseGridColor_; /*!< \brief Coarse grid levels, colorized. */
 
+  su2activematrix LeastSquaresWeights[2]; /*!< \brief Unweighted and inverse-distance-weighted least-squares gradient weights. */
+
+  bool dualGridOnDevice{false}; /*!< \brief Whether the dual grid was mapped to the offload device. */
+
+  su2activematrix CoordDualGrid; /*!< \brief Coordinates at the last update of the dual grid (INCREMENTAL_DUAL_GRID). */
+
+  /*!
+   * \brief Build the sparse pattern of edges (outer index) to points (inner indices), used to color the edges.
+   */
+  CCompressedSparsePatternUL GetEdgePattern() const;
+
+  /*!
+   * \brief Segments of a section (intersection of a plane with the GeoEval surfaces), each entry
+   * is one edge of the section defined by two points (Index0 and Index1), and each of these points is
+   * identified by the global indices of the surface edge (I and J) it is on.
+   */
+  struct CAirfoilSegments {
+    vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0;
+    vector<su2double> Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
+    vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1;
+  };
+
+  /*!
+   * \brief Gather the data that is shared by all the sections of the geometry.
+   * \param[in] original_surface - If false, the VarCoord of the GeoEval vertices is added to the coordinates.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] SectionCoord - Coordinates (always 3 components) of the points.
+   * \param[out] SectionElem - Marker and index of the boundary elements of the GeoEval markers.
+   */
+  void SetAirfoil_SectionData(bool original_surface, const CConfig* config, su2activematrix& SectionCoord,
+                              vector<pair<unsigned short, unsigned long> >& SectionElem) const;
+
+  /*!
+   * \brief Compute the local (this rank) segments of a section.
+   * \param[in] ElemList - Indices (into SectionElem) of the elements that may intersect the plane.
+   * \note Thread-safe, different sections can be extracted concurrently.
+   */
+  void ExtractAirfoil_Segments(const su2double* Plane_P0, const su2double* Plane_Normal, su2double MinXCoord,
+                               su2double MaxXCoord, su2double MinYCoord, su2double MaxYCoord, su2double MinZCoord,
+                               su2double MaxZCoord, const su2double* FlowVariable, const su2activematrix& SectionCoord,
+                               const vector<pair<unsigned short, unsigned long> >& SectionElem,
+                               const vector<unsigned long>& ElemList, CAirfoilSegments& Segments,
+                               const CConfig* config);
+
+  /*!
+   * \brief Gather the segments of a section on the master node and chain them into a curve.
+   * \note The segments are consumed, the curve is only available on the master node.
+   */
+  void AssembleAirfoil_Section(const su2double* Plane_Normal, CAirfoilSegments& Segments,
+                               vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
+                               vector<su2double>& Zcoord_Airfoil, vector<su2double>& Variable_Airfoil,
+                               const CConfig* config) const;
+
  public:
   /*!< \brief Linelets (mesh lines perpendicular to stretching direction). */
   struct CLineletInfo {
@@ -282,10 +384,15 @@ class CGeometry {
                                         in point-to-point comms. */
   su2double* bufD_P2PRecv{nullptr};  /*!< \brief Data structure for su2double point-to-point receive. */
   su2double* bufD_P2PSend{nullptr};  /*!< \brief Data structure for su2double point-to-point send. */
+  float* bufF_P2PRecv{nullptr};      /*!< \brief Data structure for float point-to-point receive. */
+  float* bufF_P2PSend{nullptr};      /*!< \brief Data structure for float point-to-point send. */
   unsigned short* bufS_P2PRecv{nullptr};  /*!< \brief Data structure for unsigned long point-to-point receive. */
   unsigned short* bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
+  bool persistentP2P{false}; /*!< \brief Use persistent requests for point-to-point comms. */
+  mutable map<unsigned long, vector<SU2_MPI::Request> > P2PPersistentReq; /*!< \brief Persistent send and recv requests
+                                          for each combination of data type, count per point, and direction. */
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -318,6 +425,10 @@ class CGeometry {
   unsigned short* bufS_PeriodicSend{nullptr};  /*!< \brief Data structure for unsigned long periodic send. */
   SU2_MPI::Request* req_PeriodicSend{nullptr}; /*!< \brief Data structure for periodic send requests. */
   SU2_MPI::Request* req_PeriodicRecv{nullptr}; /*!< \brief Data structure for periodic recv requests. */
+  bool periodicPairsDisjoint{false}; /*!< \brief No point is on more than one pair of periodic markers (all ranks),
+                                        all pairs can then be communicated at once. */
+  vector<bool> P2PSendPeriodic;      /*!< \brief Whether each point-to-point send contains points that are updated
+                                        by periodic comms (the others can be sent before the periodic comms). */
 
   /*--- Mesh quality metrics. ---*/
 
@@ -359,6 +470,21 @@ class CGeometry {
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Free the persistent requests for point-to-point comms (e.g. when the buffers are reallocated).
+   */
+  void FreeP2PPersistentRequests();
+
+  /*!
+   * \brief Start the persistent recvs for a combination of data type, count, and direction, creating the persistent
+   *        requests (sends and recvs) if needed. The send requests are copied to req_P2PSend and they are started
+   *        individually by PostP2PSends.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void StartP2PPersistentRecvs(unsigned short commType, unsigned short countPerPoint, bool val_reverse) const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -483,6 +609,17 @@ class CGeometry {
    */
   inline unsigned long GetGlobal_nPointDomain() const { return Global_nPointDomain; }
 
+  /*!
+   * \brief Get the local indices of the domain points in ascending order of their global index, which is the
+   *        order in which the points of this rank appear in restart files (set by SetGlobal_to_Local_Point).
+   */
+  inline const vector<unsigned long>& GetDomainPoints_GlobalOrder() const { return DomainPoints_GlobalOrder; }
+
+  /*!
+   * \brief Get the global indices of the points of GetDomainPoints_GlobalOrder (in ascending order).
+   */
+  inline const vector<unsigned long>& GetDomainPoints_GlobalIndex() const { return DomainPoints_GlobalIndex; }
+
   /*!
    * \brief Get number of elements.
    * \return Number of elements.
@@ -515,6 +652,27 @@ class CGeometry {
    */
   inline unsigned long GetnVertex(unsigned short val_marker) const { return nVertex[val_marker]; }
 
+  /*!
+   * \brief Move the hot data of the vertices (node and normal) to contiguous storage per marker. The CVertex
+   * interface remains valid, its normal points to the new storage. Called at the end of SetVertex.
+   */
+  void SetVertexStorage();
+
+  /*!
+   * \brief Get the nodes of all the vertices of a marker (contiguous, for fast boundary loops).
+   * \param[in] val_marker - Marker of the boundary.
+   */
+  inline const su2vector<unsigned long>& GetVertexNodes(unsigned short val_marker) const {
+    return vertexNodes[val_marker];
+  }
+
+  /*!
+   * \brief Get the normals of all the vertices of a marker (nVertex x 3, contiguous, for fast boundary loops).
+   * \note These are the same values accessed via CVertex::GetNormal.
+   * \param[in] val_marker - Marker of the boundary.
+   */
+  inline const su2activematrix& GetVertexNormals(unsigned short val_marker) const { return vertexNormals[val_marker]; }
+
   /*!
    * \brief Get number of span wise section.
    * \param[in] marker_flag - flag of the turbomachinery boundary.
@@ -703,6 +861,12 @@ class CGeometry {
    */
   inline virtual void SetRCM_Ordering(CConfig* config) {}
 
+  /*!
+   * \brief Orders the points along a Hilbert curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetHilbert_Ordering(CConfig* config) {}
+
   /*!
    * \brief Connects elements  .
    */
@@ -796,6 +960,15 @@ class CGeometry {
    */
   inline virtual void SetControlVolume(CConfig* config, unsigned short action) {}
 
+  /*!
+   * \brief Update the dual grid after a rigid body motion of all the points, x' = R x + t. The normals of
+   *        the edges and vertices are rotated, the element centers of gravity are recomputed from the
+   *        (already moved) coordinates, and the volumes do not change.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix R of the motion.
+   */
+  void SetRigidMotionControlVolume(const CConfig* config, const su2double (*rotMatrix)[3]);
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1030,6 +1203,23 @@ class CGeometry {
                               vector<su2double>& Ycoord_Airfoil, vector<su2double>& Zcoord_Airfoil,
                               vector<su2double>& Variable_Airfoil, bool original_surface, CConfig* config);
 
+  /*!
+   * \brief Compute several sections of the geometry at once (see ComputeAirfoil_Section), the shared data
+   * is prepared once, the elements are binned by plane when all planes are parallel, and the local
+   * extraction of the sections is multithreaded.
+   * \param[in] nPlane - Number of sections.
+   * \param[in] Plane_P0 - Point of each plane.
+   * \param[in] Plane_Normal - Normal of each plane.
+   * \param[in] FlowVariable - Point variable interpolated to the sections, can be nullptr.
+   * \param[out] Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil - nPlane curves.
+   * \param[in] original_surface - If false, the VarCoord of the GeoEval vertices is added to the coordinates.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAirfoil_Sections(unsigned short nPlane, su2double** Plane_P0, su2double** Plane_Normal,
+                               const su2double* FlowVariable, vector<su2double>* Xcoord_Airfoil,
+                               vector<su2double>* Ycoord_Airfoil, vector<su2double>* Zcoord_Airfoil,
+                               vector<su2double>* Variable_Airfoil, bool original_surface, CConfig* config);
+
   /*!
    * \brief A virtual member.
    */
@@ -1689,10 +1879,13 @@ class CGeometry {
    * \param[in] kernels - Kernel types and respective parameter, size of vector defines number of filter recursions.
    * \param[in] search_limit - Max degree of neighborhood considered for neighbor search, avoids excessive work in fine
    * regions. \param[in,out] values - On entry, the "raw" values, on exit, the filtered values.
+   * \param[in,out] cache - If not null, the neighbourhoods and weights are stored on the first call and reused after,
+   *                 filtering is then a sparse matrix-vector product per kernel (no geometric searches).
    */
   void FilterValuesAtElementCG(const vector<su2double>& filter_radius,
                                const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels,
-                               const unsigned short search_limit, su2double* values) const;
+                               const unsigned short search_limit, su2double* values,
+                               CElementFilterCache* cache = nullptr) const;
 
   /*!
    * \brief Build the global (entire mesh!) adjacency matrix for the elements in compressed format.
@@ -1756,6 +1949,17 @@ class CGeometry {
    */
   const CCompressedSparsePatternUL& GetSparsePattern(ConnectivityType type, unsigned long fillLvl = 0);
 
+  /*!
+   * \brief Get the pattern of the multigrid transfer operator of a coarse grid, the inner indices of each
+   *        point are its children on the finer grid.
+   */
+  inline const CCompressedSparsePatternUL& GetMGTransferPattern() const { return MGTransferPattern; }
+
+  /*!
+   * \brief Get the volume weights of the multigrid transfer operator (one per non zero of the pattern).
+   */
+  inline const su2activevector& GetMGTransferWeights() const { return MGTransferWeights; }
+
   /*!
    * \brief Get the edge to sparse pattern map.
    * \note This method builds the map and required pattern (0-fill FVM) if that has not been done yet.
@@ -1787,12 +1991,39 @@ class CGeometry {
    */
   void SetNaturalEdgeColoring();
 
+  /*!
+   * \brief Select the edge coloring by timing, on this grid and with the current number of threads,
+   * a proxy of the edge loops (gather from points, scatter of a flux) with the reducer strategy (natural
+   * coloring) and with colorings of CGeometry::edgeColorGroupSize, 1/2, 1/4, and 1/8 of it, each with the groups
+   * colored in natural and in largest-degree-first order (see colorSparsePattern).
+   * \note Only group sizes that are multiples of "granularity" and yield efficient colorings are tried.
+   * Nothing is done if the coloring was already built (e.g. by another solver) or without threads.
+   * After this, GetEdgeColoring returns the fastest coloring, with an efficiency below #COLORING_EFF_THRESH
+   * if the reducer strategy is the fastest.
+   * \param[in] nVar - Number of variables per point in the proxy loops.
+   * \param[in] granularity - The group sizes need to be multiples of this value (e.g. SIMD length).
+   */
+  void AutotuneEdgeColoring(unsigned long nVar, unsigned long granularity);
+
   /*!
    * \brief Get the group size used in edge coloring.
    * \return Group size.
    */
   inline unsigned long GetEdgeColorGroupSize() const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get whether the edge coloring was built in largest-degree-first order (selected by the autotune).
+   */
+  inline bool GetEdgeColoringLargestFirst() const { return edgeColoringLargestFirst; }
+
+  /*!
+   * \brief Map the point adjacency (neighbors and edges), the edge normals, and the volumes to the offload device,
+   *        where they remain until the geometry is destroyed, i.e. the grid must be static.
+   * \note Only the master thread should call this, without SU2_OMP_OFFLOAD or a device it has no effect.
+   * \return Whether the dual grid is on the device.
+   */
+  bool MapDualGridToDevice();
+
   /*!
    * \brief Get the element coloring.
    * \note This method computes the coloring if that has not been done yet.
@@ -1812,6 +2043,42 @@ class CGeometry {
    */
   inline unsigned long GetElementColorGroupSize() const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Determine which pairs of markers touch the same points in their vertex loops, i.e. the vertex
+   * nodes and their normal neighbors. The vertex loops of markers that do not overlap can run concurrently.
+   * \note Call after FindNormal_Neighbor.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetBoundaryMarkerOverlap(const CConfig* config);
+
+  /*!
+   * \brief Check if the vertex loops of two markers may touch the same points.
+   * \note Returns true (conservatively) if SetBoundaryMarkerOverlap was not called.
+   * \param[in] iMarker - First marker.
+   * \param[in] jMarker - Second marker.
+   * \return True if the markers overlap.
+   */
+  inline bool GetBoundaryMarkersOverlap(unsigned short iMarker, unsigned short jMarker) const {
+    return boundaryMarkerOverlap.empty() || boundaryMarkerOverlap(iMarker, jMarker);
+  }
+
+  /*!
+   * \brief Get the storage for the least-squares gradient weights.
+   * \note The weights are computed by the gradient algorithm when the storage is empty (see
+   * computeGradientsLeastSquares.hpp), they are stored with the same sparse structure as the
+   * neighbors of each point (CPoint::GetPoints) and cleared by SetControlVolume.
+   * \param[in] weighted - Inverse-distance-weighted or unweighted least-squares.
+   * \return Reference to the weights.
+   */
+  inline su2activematrix& GetLeastSquaresWeights(bool weighted) { return LeastSquaresWeights[weighted]; }
+
+  /*!
+   * \brief Clear the stored least-squares gradient weights, e.g. after the grid coordinates change.
+   */
+  inline void ClearLeastSquaresWeights() {
+    for (auto& weights : LeastSquaresWeights) weights.resize(0, 0);
+  }
+
   /*!
    * \brief Get the linelet definition, this function computes the linelets if that has not been done yet.
    */
@@ -1841,12 +2108,61 @@ class CGeometry {
    */
   virtual void SetWallDistance(su2double val) {}
 
+  /*!
+   * \brief Prepare the wall distance for a new computation, by default all points are reset and recomputed.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] update - Whether this is an update after the mesh moved, which may be limited to some points.
+   */
+  virtual void ResetWallDistance(const CConfig* config, bool update) {
+    SetWallDistance(numeric_limits<su2double>::max());
+  }
+
+  /*!
+   * \brief Called once the wall distance has been computed for all zones.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void FinalizeWallDistance(const CConfig* config) {}
+
+  /*!
+   * \brief Store the wall distance of one phase of a periodic motion (see WALL_DISTANCE_PERIODIC_CACHE).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] phase - Phase (time step within the period).
+   * \param[in] nPhase - Number of time steps per period.
+   */
+  virtual void StorePeriodicWallDistance(const CConfig* config, unsigned long phase, unsigned long nPhase) {}
+
+  /*!
+   * \brief Whether the wall distance of one phase of a periodic motion is stored.
+   * \param[in] phase - Phase (time step within the period).
+   */
+  virtual bool HasPeriodicWallDistance(unsigned long phase) const { return false; }
+
+  /*!
+   * \brief Set the wall distance of one phase of a periodic motion from the stored values.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] phase - Phase (time step within the period).
+   */
+  virtual void LoadPeriodicWallDistance(const CConfig* config, unsigned long phase) {}
+
+  /*!
+   * \brief Number of time steps after which the grids of all zones return to the same relative position, i.e.
+   *        when the only motion is a steady rigid rotation about one axis (RIGID_MOTION) and one revolution
+   *        takes an integer number of time steps (the same for all rotating zones).
+   * \param[in] config_container - Definition of the particular problem.
+   * \param[in] nZone - Number of zones.
+   * \return Number of time steps per period, or 0 if the motion is not periodic.
+   */
+  static unsigned long GetPeriodicMotion_Steps(const CConfig* const* config_container, int nZone);
+
   /*!
    * \brief Compute the distances to the closest vertex on viscous walls over the entire domain
    * \param[in] config_container - Definition of the particular problem.
    * \param[in] geometry_container - Geometrical definition of the problem.
+   * \param[in] update - Whether this is an update after the mesh moved. The computation is skipped if the zones
+   *                     did not move relative to each other, and it may be limited to a band of points near the walls.
    */
-  static void ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container);
+  static void ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container,
+                                  bool update = false);
 
   /*!
    * \brief Set the amount of nonconvex elements in the mesh.
@@ -1871,4 +2187,42 @@ class CGeometry {
    * \return A pointer to the reference node coordinate vector.
    */
   inline virtual const su2double* GetStreamwise_Periodic_RefNode() const { return nullptr; }
+
+  /*!
+   * \brief Adds the time spent in its scope to the cost of a point, if the point cost is being profiled.
+   */
+  class CPointCostScope {
+    passivedouble* cost;
+    const passivedouble startTime;
+
+   public:
+    explicit CPointCostScope(passivedouble* val_cost)
+        : cost(val_cost), startTime(val_cost ? SU2_MPI::Wtime() : 0.0) {}
+    CPointCostScope(CPointCostScope&& other) noexcept : cost(other.cost), startTime(other.startTime) {
+      other.cost = nullptr;
+    }
+    CPointCostScope(const CPointCostScope&) = delete;
+    CPointCostScope& operator=(const CPointCostScope&) = delete;
+    ~CPointCostScope() {
+      if (cost) *cost += SU2_MPI::Wtime() - startTime;
+    }
+  };
+
+  /*!
+   * \brief Time the expensive work of a point (e.g. chemistry, table lookups, wall functions) while the point cost
+   *        is profiled, the returned object must be kept alive for the duration of that work.
+   * \note Threads must work on different points.
+   * \param[in] iPoint - Point.
+   */
+  inline CPointCostScope ProfilePointCost(unsigned long iPoint) {
+    return CPointCostScope(pointCost.empty() ? nullptr : &pointCost[iPoint]);
+  }
+
+  /*!
+   * \brief Advance the point cost profiler by one iteration. Profiling starts after the first iteration and, after
+   *        the number of iterations set in the config, the cost of each point is written to file, to be used as
+   *        partitioning weights by later runs.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdatePointCostProfile(const CConfig* config);
 };
@@ -66,6 +66,26 @@ class CMultiGridGeometry final : public CGeometry {
   void SetSuitableNeighbors(vector<unsigned long>& Suitable_Indirect_Neighbors, unsigned long iPoint,
                             unsigned long Index_CoarseCV, const CGeometry* fine_grid) const;
 
+  /*!
+   * \brief Agglomerate the interior control volumes with the priority queue (serial).
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Index_CoarseCV - Number of coarse control volumes created so far.
+   * \return Number of coarse control volumes after the agglomeration.
+   */
+  unsigned long AgglomerateDomainQueue(CGeometry* fine_grid, const CConfig* config, unsigned long Index_CoarseCV);
+
+  /*!
+   * \brief Agglomerate the interior control volumes in parallel. In each round, the seeds are the points with
+   *        the highest priority (number of agglomerated neighbors, ties broken by a hash of the index) within their
+   *        neighbors of neighbors, so the seeds of a round do not compete for the same direct neighbors.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Index_CoarseCV - Number of coarse control volumes created so far.
+   * \return Number of coarse control volumes after the agglomeration.
+   */
+  unsigned long AgglomerateDomainParallel(CGeometry* fine_grid, const CConfig* config, unsigned long Index_CoarseCV);
+
  public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetBoundControlVolume;
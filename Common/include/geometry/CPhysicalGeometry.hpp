@@ -43,6 +43,7 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long* adj_counter{nullptr};    /*!< \brief Adjacency counter. */
   unsigned long** adjacent_elem{nullptr}; /*!< \brief Adjacency element list. */
   su2activematrix Sensitivity;            /*!< \brief Matrix holding the sensitivities at each point. */
+  bool incrementalUpdate{false};          /*!< \brief Whether the last dual grid update was incremental. */
 
   vector<vector<unsigned long> > Neighbors;
   unordered_map<unsigned long, unsigned long> Color_List;
@@ -90,6 +91,55 @@ class CPhysicalGeometry final : public CGeometry {
       0}; /*!< \brief Coordinates of the reference node [m] on the receiving periodic marker, for recovered
              pressure/temperature computation only.*/
 
+  /*--- Incremental wall distance updates on moving meshes. ---*/
+  bool wallDistanceInBand{false};             /*!< \brief Whether only the points near the walls are updated. */
+  vector<unsigned long> wallDistancePoints;   /*!< \brief Points being updated (if wallDistanceInBand). */
+  vector<passivedouble> wallDistanceRef;      /*!< \brief Wall distance of the last full computation. */
+  vector<passivedouble> wallDistanceRefCoord; /*!< \brief Coordinates of the last full computation. */
+  vector<vector<passivedouble> > wallDistancePeriodic; /*!< \brief Wall distance (and roughness) of each phase
+                                                             of a periodic motion, empty if not stored. */
+
+  /*!
+   * \brief Reduce the wall distance using an ADT that only holds the walls of each rank. The points are first
+   *        compared with the local walls, then sent to the ranks whose walls may be closer, based on the bounding
+   *        box of their walls.
+   * \param[in] WallADT - Local ADT of the walls of this rank.
+   * \param[in] iZone - Zone whose markers made the ADT.
+   */
+  void SetWallDistanceDistributed(CADTElemClass* WallADT, unsigned short iZone);
+
+  /*!
+   * \brief Coordinates of the points whose wall distance is being computed (all, or those in the update band).
+   * \param[out] buffer - Storage for the coordinates, if they are not contiguous in the nodes.
+   * \return Pointer to the coordinates, nDim values per point.
+   */
+  const su2double* GetWallDistanceTargets(vector<su2double>& buffer) const;
+
+  /*!
+   * \brief Renumber the points and update the connectivities of the elements and markers.
+   * \param[in] Result - Old index of each new point, the halo points must keep their positions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ApplyPoint_Ordering(const vector<unsigned long>& Result, const CConfig* config);
+
+  /*!
+   * \brief Add the contributions of an element to the normals of its edges and to the volumes of its points.
+   * \param[in] iElem - Index of the element.
+   * \param[in] updatePoint - Points whose volume is updated (all if empty).
+   * \param[in] updateEdge - Edges whose normal is updated (all if empty).
+   * \return Volume of the element.
+   */
+  su2double AddElemControlVolume(unsigned long iElem, const vector<bool>& updatePoint,
+                                 const vector<bool>& updateEdge);
+
+  /*!
+   * \brief Update the dual grid only around the points that moved since the last update.
+   * \note Must be called by the master thread.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if too many points moved, in which case nothing is updated.
+   */
+  bool SetControlVolume_Incremental(CConfig* config);
+
  public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetBoundControlVolume;
@@ -244,6 +294,7 @@ class CPhysicalGeometry final : public CGeometry {
 
   /*!
    * \brief Routine to sort the adjacency for ParMETIS for graph partitioning in parallel.
+   * \note Sorts the entries of each point and removes the repeats, compacting the CSR arrays in place.
    * \param[in] config - Definition of the particular problem.
    */
   void SortAdjacency(const CConfig* config);
@@ -337,6 +388,40 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void PrepareAdjacency(const CConfig* config);
 
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+  /*!
+   * \brief Two-level partitioning, first across the compute nodes with ParMETIS, then across the ranks of each node
+   *        with METIS (on the first rank of the node).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] vtxdist - Distribution of the graph vertices (points) across ranks.
+   * \param[in] vwgt - Weights of the local vertices.
+   * \param[out] part - Rank of each local point.
+   * \return False if the ranks do not form a two-level layout, in which case the flat partitioning should be used.
+   */
+  bool PartitionHierarchical(const CConfig* config, vector<idx_t>& vtxdist, vector<idx_t>& vwgt, vector<idx_t>& part);
+
+  /*!
+   * \brief Name of the partition cache file, based on a hash of the adjacency graph and of the ParMETIS options.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] vwgt - Weights of the local vertices.
+   * \return Name of the file.
+   */
+  string GetPartitionCacheFileName(const CConfig* config, const vector<idx_t>& vwgt) const;
+
+  /*!
+   * \brief Read the colors of the local points from a partition cache file, if it exists and matches this grid.
+   * \param[in] filename - Name of the partition cache file.
+   * \return True if the coloring was loaded.
+   */
+  bool ReadPartitionCache(const string& filename);
+
+  /*!
+   * \brief Write the colors of the local points to a partition cache file.
+   * \param[in] filename - Name of the partition cache file.
+   */
+  void WritePartitionCache(const string& filename) const;
+#endif
+
   /*!
    * \brief Find repeated nodes between two elements to identify the common face.
    * \param[in] first_elem - Identification of the first element.
@@ -365,6 +450,12 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetRCM_Ordering(CConfig* config) override;
 
+  /*!
+   * \brief Set a renumbering that follows a Hilbert space-filling curve through the coordinates of the points.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetHilbert_Ordering(CConfig* config) override;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -762,8 +853,46 @@ class CPhysicalGeometry final : public CGeometry {
     for (unsigned long iPoint = 0; iPoint < GetnPoint(); iPoint++) {
       nodes->SetWall_Distance(iPoint, val);
     }
+    wallDistanceInBand = false;
+  }
+
+  /*!
+   * \brief Prepare the wall distance for a new computation. On updates with a band (WALL_DISTANCE_BAND) only the
+   *        points that may be within the band are reset, the others take the distance of the last full computation.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] update - Whether this is an update after the mesh moved.
+   */
+  void ResetWallDistance(const CConfig* config, bool update) override;
+
+  /*!
+   * \brief Store the reference for later band updates after a full computation.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void FinalizeWallDistance(const CConfig* config) override;
+
+  /*!
+   * \brief Store the wall distance (and roughness) of one phase of a periodic motion.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] phase - Phase (time step within the period).
+   * \param[in] nPhase - Number of time steps per period.
+   */
+  void StorePeriodicWallDistance(const CConfig* config, unsigned long phase, unsigned long nPhase) override;
+
+  /*!
+   * \brief Whether the wall distance of one phase of a periodic motion is stored.
+   * \param[in] phase - Phase (time step within the period).
+   */
+  bool HasPeriodicWallDistance(unsigned long phase) const override {
+    return (phase < wallDistancePeriodic.size()) && (!wallDistancePeriodic[phase].empty() || nPoint == 0);
   }
 
+  /*!
+   * \brief Set the wall distance (and roughness) of one phase of a periodic motion from the stored values.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] phase - Phase (time step within the period).
+   */
+  void LoadPeriodicWallDistance(const CConfig* config, unsigned long phase) override;
+
   /*!
    * \brief For streamwise periodicity, find & store a unique reference node on the designated periodic inlet.
    * \param[in] config - Definition of the particular problem.
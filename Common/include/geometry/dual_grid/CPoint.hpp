@@ -53,9 +53,9 @@ class CPoint {
   su2vector<unsigned long> GlobalIndex; /*!< \brief Global index in the parallel simulation. */
   su2vector<unsigned long> Color;       /*!< \brief Color of the point in the partitioning strategy. */
 
-  CCompressedSparsePatternUL Point; /*!< \brief Points surrounding the central node of the control volume. */
-  CCompressedSparsePatternL Edge;   /*!< \brief Edges that set up a control volume (same sparse structure as Point). */
-  CCompressedSparsePatternL Elem;   /*!< \brief Elements that set up a control volume around a node. */
+  CCompressedSparsePatternLocal Point; /*!< \brief Points surrounding the central node of the control volume. */
+  CCompressedSparsePatternLocal Edge;  /*!< \brief Edges that set up a control volume (same sparse structure as Point). */
+  CCompressedSparsePatternLocal Elem;  /*!< \brief Elements that set up a control volume around a node. */
   vector<vector<long> > Vertex; /*!< \brief Index of the vertex that correspond which the control volume (we need one
                                    for each marker in the same node). */
 
@@ -123,6 +123,12 @@ class CPoint {
   void MinimalAllocation(unsigned long npoint);
 
  public:
+  /*!
+   * \brief Check that the connectivity indices fit in su2localindex, throws an error otherwise.
+   * \param[in] maxIndex - Largest index (or number of entries) that will be stored.
+   */
+  static void CheckLocalIndexRange(unsigned long maxIndex);
+
   /*!
    * \brief "Full" constructor of the class.
    * \param[in] npoint - Number of points (dual volumes) in the problem.
@@ -196,14 +202,14 @@ class CPoint {
 
   /*!
    * \brief Set the elements that are connected to each point.
-   * \param[in] elemsMatrix - List of lists with the neighbor points connected to each point.
+   * \param[in] elems - Elements connected to each point in compressed format (CSR).
    */
-  void SetElems(const vector<vector<long> >& elemsMatrix);
+  void SetElems(CCompressedSparsePatternLocal&& elems);
 
   /*!
    * \brief Reset the elements of a control volume.
    */
-  inline void ResetElems() { Elem = CCompressedSparsePatternL(); }
+  inline void ResetElems() { Elem = CCompressedSparsePatternLocal(); }
 
   /*!
    * \brief Get the number of elements that compose the control volume.
@@ -225,7 +231,7 @@ class CPoint {
   /*!
    * \brief Get inner iterator to loop over neighbor elements.
    */
-  inline CCompressedSparsePatternL::CInnerIter GetElems(unsigned long iPoint) const {
+  inline CCompressedSparsePatternLocal::CInnerIter GetElems(unsigned long iPoint) const {
     return Elem.getInnerIter(iPoint);
   }
 
@@ -235,17 +241,27 @@ class CPoint {
    */
   void SetPoints(const vector<vector<unsigned long> >& pointsMatrix);
 
+  /*!
+   * \brief Set the points that compose the control volume.
+   * \param[in] points - Neighbor points of each point in compressed format (CSR).
+   */
+  void SetPoints(CCompressedSparsePatternLocal&& points);
   /*!
    * \brief Get the entire point adjacency information in compressed format (CSR).
    */
-  const CCompressedSparsePatternUL& GetPoints() const { return Point; }
+  const CCompressedSparsePatternLocal& GetPoints() const { return Point; }
+
+  /*!
+   * \brief Get the entire point-to-edge adjacency information in compressed format (CSR), same structure as GetPoints.
+   */
+  const CCompressedSparsePatternLocal& GetEdges() const { return Edge; }
 
   /*!
    * \brief Reset the points that compose the control volume.
    */
   inline void ResetPoints() {
-    Point = CCompressedSparsePatternUL();
-    Edge = CCompressedSparsePatternL();
+    Point = CCompressedSparsePatternLocal();
+    Edge = CCompressedSparsePatternLocal();
   }
 
   /*!
@@ -268,7 +284,7 @@ class CPoint {
   /*!
    * \brief Get inner iterator to loop over neighbor points.
    */
-  inline CCompressedSparsePatternUL::CInnerIter GetPoints(unsigned long iPoint) const {
+  inline CCompressedSparsePatternLocal::CInnerIter GetPoints(unsigned long iPoint) const {
     return Point.getInnerIter(iPoint);
   }
 
@@ -293,7 +309,7 @@ class CPoint {
   /*!
    * \brief Get inner iterator to loop over neighbor edges.
    */
-  inline CCompressedSparsePatternL::CInnerIter GetEdges(unsigned long iPoint) const {
+  inline CCompressedSparsePatternLocal::CInnerIter GetEdges(unsigned long iPoint) const {
     return Edge.getInnerIter(iPoint);
   }
 
@@ -492,6 +508,11 @@ class CPoint {
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the entire vector of distances to the nearest wall.
+   */
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -549,6 +570,11 @@ class CPoint {
    */
   inline su2double GetMaxLength(unsigned long iPoint) const { return MaxLength(iPoint); }
 
+  /*!
+   * \brief Get the entire vector of maximum cell-center to cell-center lengths.
+   */
+  inline const su2activevector& GetMaxLength() const { return MaxLength; }
+
   /*!
    * \brief Get area or volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -557,6 +583,11 @@ class CPoint {
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
 
+  /*!
+   * \brief Get the entire vector of volumes of the control volumes.
+   */
+  inline const su2activevector& GetVolume() const { return Volume; }
+
   /*!
    * \brief Set the volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -874,6 +905,15 @@ class CPoint {
     return AD::GetDerivative(AD_InputIndex(iPoint, iDim));
   }
 
+  /*!
+   * \brief Set the current coordinates as the primal values of the inputs of a primal value tape.
+   * \param[in] iPoint - Index of the point.
+   */
+  inline void SetTapeCoord(unsigned long iPoint) const {
+    for (unsigned long iDim = 0; iDim < nDim; iDim++)
+      AD::SetPrimal(AD_InputIndex(iPoint, iDim), SU2_TYPE::GetValue(Coord(iPoint, iDim)));
+  }
+
   /*!
    * \brief Register coordinates of a point.
    * \param[in] iPoint - Index of the point.
@@ -38,7 +38,9 @@
 class CVertex : public CDualGrid {
  protected:
   unsigned long Nodes[1];         /*!< \brief Vector to store the global nodes of an element. */
-  su2double Normal[3] = {0.0};    /*!< \brief Normal coordinates of the element and its center of gravity. */
+  su2double OwnNormal[3] = {0.0}; /*!< \brief Storage of the normal, until it is moved to the marker storage. */
+  su2double* Normal = OwnNormal;  /*!< \brief Normal coordinates of the element and its center of gravity,
+                                              see CGeometry::SetVertexStorage. */
   su2double Aux_Var;              /*!< \brief Auxiliar variable defined only on the surface. */
   su2double CartCoord[3] = {0.0}; /*!< \brief Vertex cartesians coordinates. */
   su2double VarCoord[3] = {0.0}; /*!< \brief Used for storing the coordinate variation due to a surface modification. */
@@ -56,6 +58,21 @@ class CVertex : public CDualGrid {
    */
   CVertex(unsigned long val_point, unsigned short val_nDim);
 
+  /*!
+   * \brief The normal may point to external storage, vertices cannot be copied.
+   */
+  CVertex(const CVertex&) = delete;
+  CVertex& operator=(const CVertex&) = delete;
+
+  /*!
+   * \brief Move the normal to external storage (e.g. contiguous for all vertices of a marker).
+   * \param[in] storage - Space for 3 values that outlives the vertex, the current normal is copied to it.
+   */
+  inline void SetNormalStorage(su2double* storage) {
+    for (unsigned short iDim = 0; iDim < 3; iDim++) storage[iDim] = Normal[iDim];
+    Normal = storage;
+  }
+
   /*!
    * \brief Get the number of nodes of a vertex.
    * \return Number of nodes that set a vertex (1).
@@ -30,6 +30,9 @@
 
 #ifdef HAVE_CGNS
 #include "cgnslib.h"
+#ifdef HAVE_MPI
+#include "pcgnslib.h"
+#endif
 #endif
 
 #include "CMeshReaderFVM.hpp"
@@ -43,6 +46,8 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
  private:
 #ifdef HAVE_CGNS
   int cgnsFileID;         /*!< \brief CGNS file identifier. */
+  bool parallelIO = false; /*!< \brief Whether the bulk data can be read with parallel CGNS (HDF5 file, MPI build). */
+  bool parallelRead = false; /*!< \brief Whether cgnsFileID is currently a parallel (collective) handle. */
   const int cgnsBase = 1; /*!< \brief CGNS database index (the CGNS reader currently assumes a single database). */
   const int cgnsZone = 1; /*!< \brief CGNS zone index (and 1 zone in that database). */
 
@@ -50,6 +55,7 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
 
   vector<bool> isInterior; /*!< \brief Vector of booleans to store whether each section in the CGNS file is an interior
                               or boundary section. */
+  vector<bool> isFixedSize; /*!< \brief Whether each section has a single element type (required for parallel reads). */
   vector<unsigned long>
       nElems; /*!< \brief Vector containing the local number of elements found within each CGNS section. */
   vector<unsigned long> elemOffset;    /*!< \brief Global ID offset for each interior section (i.e., the total number of
@@ -65,6 +71,12 @@ class CCGNSMeshReaderFVM : public CMeshReaderFVM {
    */
   void OpenCGNSFile(const string& val_filename);
 
+  /*!
+   * \brief Open the CGNS file for collective reads with parallel CGNS, all ranks must call this.
+   * \param[in] val_filename - string name of the CGNS file to be read.
+   */
+  void OpenCGNSFileParallel(const string& val_filename);
+
   /*!
    * \brief Reads all CGNS database metadata and checks for errors.
    */
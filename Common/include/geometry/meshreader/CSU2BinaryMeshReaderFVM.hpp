@@ -0,0 +1,104 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdio>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary mesh file into linear partitions for the finite volume solver (FVM).
+ * \note All records have a fixed size, which allows each rank to read only its own slice of the points and
+ *       elements directly from the file (MPI-IO in parallel builds), instead of parsing the entire file.
+ *       The layout (native byte order, all integers are 64-bit unsigned) is:
+ *       - Header: the 8 characters of FileMagic, then version, dimension, number of elements, number of points.
+ *       - Elements: one record of ElemRecordSize integers per element, [vtkType n0 ... n7] (unused nodes are 0).
+ *       - Points: dimension doubles per point, in global index order.
+ *       - Markers: number of markers, then per marker the length of the tag, the tag characters, the number
+ *         of elements, and one record of BoundRecordSize integers per element, [vtkType n0 ... n3].
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ public:
+  static constexpr char FileMagic[] = "SU2BMESH";         /*!< \brief Identifier at the start of the file. */
+  static constexpr unsigned long FileVersion = 1;         /*!< \brief Version of the binary layout. */
+  static constexpr unsigned long HeaderSize = 8 + 4 * 8;  /*!< \brief Size of the header in bytes. */
+  static constexpr unsigned long ElemRecordSize = 1 + N_POINTS_HEXAHEDRON;    /*!< \brief Integers per element. */
+  static constexpr unsigned long BoundRecordSize = 1 + N_POINTS_QUADRILATERAL; /*!< \brief Integers per surface elem. */
+
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief MPI-IO handle of the mesh file. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief Handle of the mesh file. */
+#endif
+
+  /*!
+   * \brief Read a contiguous block of bytes from the mesh file, independently of the other ranks.
+   * \param[in] offset - Position of the block in the file, in bytes.
+   * \param[out] buffer - Destination of the data.
+   * \param[in] nBytes - Size of the block.
+   */
+  void ReadBlock(unsigned long offset, void* buffer, unsigned long nBytes) const;
+
+  /*!
+   * \brief Reads the header of the file and performs some basic error checks.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of this rank's linear partition directly from the file.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the interior elements on each rank and redistributes them to the ranks
+   *        that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements of all markers.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Read the dimension of the mesh from the header of the file.
+   * \param[in] val_mesh_filename - Name of the SU2 binary mesh file.
+   * \return Dimension of the mesh.
+   */
+  static unsigned short ReadDimension(const string& val_mesh_filename);
+};
@@ -70,6 +70,15 @@ class CBSplineBlending : public CFreeFormBlending {
    */
   su2double GetDerivative(short val_i, su2double val_t, short val_order_der) override;
 
+  /*!
+   * \brief Returns the values of all the basis functions and of their first derivative (only the Degree+1
+   *        functions of the knot span of val_t are non zero, outside [0,1] the end polynomials are extended).
+   * \param[in] val_t - Point at which we want to evaluate all the basis.
+   * \param[out] val_basis - Values of the nControl basis functions.
+   * \param[out] val_deriv - Values of their first derivatives.
+   */
+  void GetAllBasis(su2double val_t, su2double* val_basis, su2double* val_deriv) const override;
+
   /*!
    * \brief Set the order and number of control points.
    * \param[in] val_order - The new order of the function.
@@ -41,6 +41,7 @@ using namespace std;
 class CBezierBlending : public CFreeFormBlending {
  private:
   vector<su2double> binomial; /*!< \brief Temporary vector for the Bernstein evaluation. */
+  vector<su2double> binomialDeg, binomialDegM1; /*!< \brief Binomial coefficients of the degree and degree-1. */
 
   /*!
    * \brief Returns the value of the i-th Bernstein polynomial of order n.
@@ -96,6 +97,14 @@ class CBezierBlending : public CFreeFormBlending {
    */
   su2double GetDerivative(short val_i, su2double val_t, short val_order_der) override;
 
+  /*!
+   * \brief Returns the values of all the Bernstein polynomials and of their first derivative.
+   * \param[in] val_t - Point at which we want to evaluate all the basis.
+   * \param[out] val_basis - Values of the Degree+1 basis functions.
+   * \param[out] val_deriv - Values of their first derivatives.
+   */
+  void GetAllBasis(su2double val_t, su2double* val_basis, su2double* val_deriv) const override;
+
   /*!
    * \brief Set the order and number of control points.
    * \param[in] val_order - The new order of the function.
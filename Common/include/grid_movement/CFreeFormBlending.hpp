@@ -68,6 +68,15 @@ class CFreeFormBlending {
    */
   inline virtual su2double GetDerivative(short val_i, su2double val_t, short val_order) { return 0.0; }
 
+  /*!
+   * \brief A pure virtual member.
+   * \note Unlike GetBasis and GetDerivative this is thread-safe and does not allocate.
+   * \param[in] val_t - Point at which we want to evaluate all the basis.
+   * \param[out] val_basis - Values of all the basis functions (one per control point).
+   * \param[out] val_deriv - Values of their first derivatives.
+   */
+  inline virtual void GetAllBasis(su2double val_t, su2double* val_basis, su2double* val_deriv) const {}
+
   /*!
    * \brief A pure virtual member.
    * \param[in] val_order - The new order of the function.
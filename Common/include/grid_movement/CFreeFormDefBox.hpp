@@ -75,6 +75,8 @@ class CFreeFormDefBox : public CGridMovement {
 
   CFreeFormBlending** BlendingFunction;
 
+  vector<su2double> FlatControlPoints; /*!< \brief Contiguous copy of the control points (thread-safe evaluation). */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -260,6 +262,15 @@ class CFreeFormDefBox : public CGridMovement {
     return ParamCoord_;
   }
 
+  /*!
+   * \brief Get one parametric coordinate (thread-safe version of Get_ParametricCoord).
+   * \param[in] val_iSurfacePoints - Surface points of FFD box.
+   * \param[in] iDim - Index of the coordinate.
+   */
+  inline su2double Get_ParametricCoord(unsigned long val_iSurfacePoints, unsigned short iDim) const {
+    return ParametricCoord[iDim][val_iSurfacePoints];
+  }
+
   /*!
    * \brief Get number of surface points.
    */
@@ -565,6 +576,18 @@ class CFreeFormDefBox : public CGridMovement {
   su2double* GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz, const su2double* guess,
                                           CConfig* config);
 
+  /*!
+   * \brief Thread-safe point inversion, Newton's method for X(u,v,w) - (x,y,z) = 0 with step halving.
+   * \note Returns false if the method did not converge, GetParametricCoord_Iterative should then be used.
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[in,out] uvw - Initial guess and parametric coordinates of the point.
+   * \param[in] tol - Convergence tolerance for the update of the parametric coordinates.
+   * \param[in] it_max - Maximal number of iterations.
+   * \param[in] work - Work array of size GetEvalWorkSize().
+   */
+  bool GetParametricCoord_Newton(const su2double* xyz, su2double* uvw, su2double tol, unsigned long it_max,
+                                 su2double* work) const;
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
@@ -596,6 +619,46 @@ class CFreeFormDefBox : public CGridMovement {
    */
   su2double* EvalCartesianCoord(su2double* ParamCoord) const;
 
+  /*!
+   * \brief Copy the control points to contiguous storage, required by the thread-safe evaluation
+   *        functions, must be called again if the control points or the orders of the box change.
+   */
+  void SetFlatControlPoints();
+
+  /*!
+   * \brief Size of the work array needed by the thread-safe evaluation functions.
+   */
+  inline unsigned long GetEvalWorkSize() const { return 2ul * (lOrder + mOrder + nOrder); }
+
+  /*!
+   * \brief Thread-safe version of EvalCartesianCoord that also computes the derivatives w.r.t. the
+   *        parametric coordinates, the basis of each direction are evaluated only once.
+   * \param[in] uvw - Parametric coordinates of a point.
+   * \param[out] xyz - Cartesian coordinates of the point.
+   * \param[out] jac - Derivatives, jac[iDim][iParam], may be nullptr.
+   * \param[in] work - Work array of size GetEvalWorkSize().
+   */
+  void EvalCartesianCoord(const su2double* uvw, su2double* xyz, su2double (*jac)[3], su2double* work) const;
+
+  /*!
+   * \brief Add the sensitivity of a point to the sensitivity of the control points, i.e. the product with the
+   *        transposed Jacobian of the cartesian coordinates w.r.t. the control points (the basis functions).
+   * \note The cartesian coordinates are linear in the control points only for cartesian boxes.
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[in] sens - Sensitivity w.r.t. the cartesian coordinates of the point (3 components).
+   * \param[in,out] cpSens - Sensitivity of the control points, same layout as the flat control points.
+   * \param[in] work - Work array of size GetEvalWorkSize().
+   */
+  void AddControlPointSensitivity(const su2double* uvw, const su2double* sens, su2double* cpSens,
+                                  su2double* work) const;
+
+  /*!
+   * \brief Dot product of a control point sensitivity with the displacement of the control points from their
+   *        original position (the directional derivative for that displacement).
+   * \param[in] cpSens - Sensitivity of the control points, same layout as the flat control points.
+   */
+  su2double GetControlPointDisplacementDot(const su2double* cpSens) const;
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -42,6 +42,46 @@ class CSurfaceMovement : public CGridMovement {
   unsigned short nLevel;    /*!< \brief Level of the FFD FFDBoxes (parent/child). */
   bool FFDBoxDefinition;    /*!< \brief If the FFD FFDBox has been defined in the input file. */
 
+  /*!
+   * \brief Parameters of a bump design variable (Hicks-Henne, CST, or surface bump), precomputed such that
+   *        the variations due to many design variables are evaluated in one sweep over the surface.
+   */
+  struct CBumpDV {
+    unsigned short kind = 0;     /*!< \brief Type of design variable. */
+    bool upper = true;           /*!< \brief Upper or lower surface (Hicks-Henne and CST). */
+    su2double ampl = 0.0;        /*!< \brief Value of the design variable times the relaxation factor. */
+    su2double param[4] = {0.0};  /*!< \brief Exponents, location, and coefficients, depending on the kind. */
+
+    /*!
+     * \brief Variation of the y coordinate of a surface point.
+     * \param[in] coord - Coordinates of the point.
+     * \param[in] normal - Normal of the point.
+     */
+    su2double Eval(const su2double* coord, const su2double* normal) const;
+  };
+
+  /*!
+   * \brief Precompute the parameters of a bump design variable.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iDV - Index of the design variable.
+   */
+  static CBumpDV GetBumpDV(const CConfig* config, unsigned short iDV);
+
+  /*!
+   * \brief Add the variations due to several bump design variables to the surface points of the DV markers.
+   * \param[in] boundary - Geometry of the boundary.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] bumps - Parameters of the design variables.
+   */
+  void SetBump_Deformation(CGeometry* boundary, const CConfig* config, const vector<CBumpDV>& bumps) const;
+
+  /*!
+   * \brief Reset the variation of the coordinates of all the surface points.
+   * \param[in] boundary - Geometry of the boundary.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static void ResetVarCoord(CGeometry* boundary, const CConfig* config);
+
  public:
   vector<su2double> GlobalCoordX[MAX_NUMBER_FFD];
   vector<su2double> GlobalCoordY[MAX_NUMBER_FFD];
@@ -59,6 +99,26 @@ class CSurfaceMovement : public CGridMovement {
    */
   ~CSurfaceMovement(void) override;
 
+  /*!
+   * \brief Project the surface sensitivity (auxiliary variable of the vertices) onto several bump design
+   *        variables (Hicks-Henne, CST, or surface bump) in one sweep over the surface, the variations are
+   *        finite differences with steps equal to the design variable values.
+   * \param[in] boundary - Geometry of the boundary.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] listDV - Indices of the design variables.
+   * \param[out] gradient - Gradient with respect to each design variable in listDV.
+   */
+  void SetBump_Gradient(CGeometry* boundary, const CConfig* config, const vector<unsigned short>& listDV,
+                        su2double* gradient) const;
+
+  /*!
+   * \brief Check if a design variable is a bump function (Hicks-Henne, CST, or surface bump).
+   * \param[in] kind - Type of design variable.
+   */
+  static inline bool IsBumpDV(unsigned short kind) {
+    return (kind == HICKS_HENNE) || (kind == CST) || (kind == SURFACE_BUMP);
+  }
+
   /*!
    * \brief Set a Hicks-Henne deformation bump functions on an airfoil.
    * \param[in] boundary - Geometry of the boundary.
@@ -485,6 +545,25 @@ class CSurfaceMovement : public CGridMovement {
    */
   void SetSurface_Derivative(CGeometry* geometry, CConfig* config);
 
+  /*!
+   * \brief Project the sensitivities (dJ/dx) of the surface points on the design variables by differentiating the
+   *        surface deformation with AD. The design variables are set to zero, i.e. the gradient is for the current
+   *        design. Used by SU2_DOT and by the discrete adjoint driver (INLINE_GRADIENT_PROJECTION).
+   * \note Without AD (continuous adjoint), the surface sensitivity (GetAuxVar) is used instead of GetSensitivity.
+   * \param[in] geometry - Geometrical definition of the problem, with the sensitivities.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] Gradient - The gradient is added to it (nDV x nDV_Value).
+   */
+  void SetProjection_AD(CGeometry* geometry, CConfig* config, su2double** Gradient);
+
+  /*!
+   * \brief Print the gradient to screen and write it to a file (master rank).
+   * \param[in] Gradient - Gradient of the objective w.r.t. the design variables (nDV x nDV_Value).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Gradient_file - Output file.
+   */
+  static void OutputGradient(su2double** Gradient, const CConfig* config, ofstream& Gradient_file);
+
   /*!
    * \brief Calculate the determinant of the Jacobian matrix for the FFD problem.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -47,6 +47,15 @@ class CVolumetricMovement : public CGridMovement {
 
   unsigned long nIterMesh; /*!< \brief Number of iterations in the mesh update. +*/
 
+  bool stiffnessAssembled = false; /*!< \brief The stiffness matrix was assembled (for DEFORM_FROZEN_STIFFNESS). */
+  su2double frozenMinVolume = 0.0; /*!< \brief Minimum element volume when the stiffness matrix was assembled. */
+
+  /*--- Rigid motion since the last update of the multigrid levels, x' = R x + t (INCREMENTAL_DUAL_GRID). ---*/
+  su2double rigidRotation[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  su2double rigidTranslation[3] = {0.0, 0.0, 0.0};
+  bool rigidMotionPending = false; /*!< \brief The fine grid moved rigidly with an incremental dual grid update. */
+  bool fullUpdatePending = false;  /*!< \brief The dual grid of the fine grid was recomputed. */
+
 #ifndef CODI_FORWARD_TYPE
   CSysMatrix<su2mixedfloat> StiffMatrix; /*!< \brief Stiffness matrix of the elasticity problem. */
   CSysSolve<su2mixedfloat> System;       /*!< \brief Linear solver/smoother. */
@@ -56,6 +65,18 @@ class CVolumetricMovement : public CGridMovement {
 #endif
   CSysVector<su2double> LinSysSol;
   CSysVector<su2double> LinSysRes;
+  CSysVector<su2double> LinSysSol_Prev; /*!< \brief Solution of the previous solve (DEFORM_WARM_START). */
+  bool warmStartReady = false;          /*!< \brief LinSysSol_Prev can be used as initial guess. */
+
+  /*!
+   * \brief Volume (area in 2D) of an element computed from the current coordinates.
+   */
+  su2double GetElement_Volume(const CGeometry* geometry, unsigned long iElem) const;
+
+  /*!
+   * \brief Whether a 2D element is nonconvex.
+   */
+  bool IsNonconvex_Element(const CGeometry* geometry, unsigned long iElem) const;
 
  public:
   /*!
@@ -87,6 +108,19 @@ class CVolumetricMovement : public CGridMovement {
    */
   void UpdateDualGrid(CGeometry* geometry, CConfig* config);
 
+  /*!
+   * \brief Update the dual grid after a rigid body motion of all the points, x' = R (x - c) + c + t.
+   * \note With INCREMENTAL_DUAL_GRID the stored normals are rotated instead of recomputed, and the motion
+   *       is accumulated to also move the coarse multigrid levels in UpdateMultiGrid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix R of the motion.
+   * \param[in] center - Center of rotation c.
+   * \param[in] translation - Translation t of the motion.
+   */
+  void UpdateDualGrid_Rigid(CGeometry* geometry, CConfig* config, const su2double (*rotMatrix)[3],
+                            const su2double* center, const su2double* translation);
+
   /*!
    * \brief Update the coarse multigrid levels after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -254,6 +288,18 @@ class CVolumetricMovement : public CGridMovement {
    */
   void ComputenNonconvexElements(CGeometry* geometry, bool Screen_Output);
 
+  /*!
+   * \brief Check for negative volumes and compute the amount of nonconvex elements in a single pass.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] MinVolume - Minimum element volume.
+   * \param[out] MaxVolume - Maximum element volume.
+   * \param[in] EarlyExit - Stop at the first negative volume, the other outputs are then not computed.
+   * \param[in] Screen_Output - determines if text is written to screen
+   * \return Number of elements with negative volume (only nonzero is meaningful with early exit).
+   */
+  unsigned long ComputeDeforming_Element_Quality(CGeometry* geometry, su2double& MinVolume, su2double& MaxVolume,
+                                                 bool EarlyExit, bool Screen_Output);
+
   /*!
    * \brief Compute the minimum distance to the nearest solid surface.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -266,8 +312,9 @@ class CVolumetricMovement : public CGridMovement {
    * \brief Check the boundary vertex that are going to be moved.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] VarIncrement - Fraction of the surface deformation imposed in this increment.
    */
-  void SetBoundaryDisplacements(CGeometry* geometry, CConfig* config);
+  void SetBoundaryDisplacements(CGeometry* geometry, CConfig* config, su2double VarIncrement);
 
   /*!
    * \brief Check the domain points vertex that are going to be moved.
@@ -346,6 +393,17 @@ class CVolumetricMovement : public CGridMovement {
   void SetVolume_Deformation(CGeometry* geometry, CConfig* config, bool UpdateGeo, bool Derivative = false,
                              bool ForwardProjectionDerivative = false);
 
+  /*!
+   * \brief Grid deformation by radial basis function interpolation of the boundary displacements.
+   * \note The RBF centers are a greedy selection of boundary points (the points with the largest
+   * interpolation error are added until the tolerance is met), the volume points are then evaluated
+   * in parallel, with compactly supported functions only the centers within one radius are visited.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] UpdateGeo - Update geometry.
+   */
+  void SetVolume_Deformation_RBF(CGeometry* geometry, CConfig* config, bool UpdateGeo);
+
   /*!
    * \brief Grid deformation using the spring analogy method.
    * \param[in] geometry - Geometrical definition of the problem.
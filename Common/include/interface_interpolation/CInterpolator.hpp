@@ -85,6 +85,8 @@ class CInterpolator {
   CGeometry* const donor_geometry;  /*! \brief Donor geometry. */
   CGeometry* const target_geometry; /*! \brief Target geometry. */
 
+  unsigned long nUpdates = 0; /*!< \brief Number of calls to SetTransferCoeff, incremented by the derived classes. */
+
  public:
   struct CDonorInfo {
     vector<int> processor;
@@ -132,6 +134,12 @@ class CInterpolator {
    */
   virtual void PrintStatistics(void) const {}
 
+  /*!
+   * \brief Get the number of times the coefficients were set, the users of the interpolator can
+   *        use it to detect that the donors may have changed (it is the same on all ranks).
+   */
+  inline unsigned long GetnUpdates() const { return nUpdates; }
+
   /*!
    * \brief Check whether an interface should be processed or not, i.e. if it is part of the zones.
    * \param[in] val_markDonor  - Marker tag from donor zone.
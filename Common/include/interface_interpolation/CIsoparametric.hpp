@@ -30,6 +30,9 @@
 
 /*!
  * \brief Isoparametric interpolation.
+ * \note The closest donor vertex of each target vertex is found with a batched ADT query, the candidate
+ *       donor elements are the ones connected to that vertex. When the coefficients are updated, the
+ *       donor element of target vertices that did not move is reused if the donor vertices did not change.
  * \ingroup Interfaces
  */
 class CIsoparametric final : public CInterpolator {
@@ -49,6 +52,19 @@ class CIsoparametric final : public CInterpolator {
     bool operator<(const DonorInfo& other) const { return distance < other.distance; }
   };
 
+  /*! \brief Donor of a target vertex in the previous update. */
+  struct CachedDonor {
+    unsigned iElem = 0;    /*!< \brief Donor element. */
+    bool match = false;    /*!< \brief If the target matches a donor vertex. */
+    bool searched = false; /*!< \brief If the donor needs to be searched in the current update. */
+  };
+
+  /*--- State of the previous update, per target marker, for static interfaces. ---*/
+  vector<vector<long> > prevDonorPoint;    /*!< \brief Global indices of the donor vertices. */
+  vector<su2activematrix> prevDonorCoord;  /*!< \brief Coordinates of the donor vertices (same order). */
+  vector<su2activematrix> prevTargetCoord; /*!< \brief Coordinates of the target vertices. */
+  vector<vector<CachedDonor> > prevDonor;  /*!< \brief Donor of each target vertex. */
+
  public:
   /*!
    * \brief Constructor of the class.
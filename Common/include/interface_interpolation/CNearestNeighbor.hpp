@@ -33,12 +33,23 @@
  * \note The closest k neighbors are used for IDW interpolation, the computational
  * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
  * by using an ADT.
+ * \note When the coefficients are updated (e.g. moving meshes) the donors of a target point are kept, and only
+ *       the coefficients recomputed, if they are guaranteed to still be the closest points, i.e. if they are closer
+ *       than a lower bound for the distance to the other points. The bound is the distance to the closest non-donor
+ *       point of the last search minus the displacements of the target point and of the donor points since then.
  * \ingroup Interfaces
  */
 class CNearestNeighbor final : public CInterpolator {
  private:
   su2double AvgDistance = 0.0, MaxDistance = 0.0;
 
+  /*--- State of the previous update, per target marker, for incremental updates. ---*/
+  vector<vector<unsigned long> > prevDonorPoint; /*!< \brief Sorted global indices of the possible donors. */
+  vector<su2activematrix> prevDonorCoord;         /*!< \brief Coordinates of the possible donors (same order). */
+  vector<su2activematrix> prevTargetCoord;        /*!< \brief Coordinates of the target vertices. */
+  vector<vector<su2double> > nextDonorDist;       /*!< \brief Lower bound of the distance to the closest
+                                                                non-donor point of each target vertex. */
+
   /*! \brief Helper struct to (partially) sort neighbours according to distance while
    *         keeping track of the origin of the point (i.e. index and processor). */
   struct DonorInfo {
@@ -32,6 +32,10 @@
 
 /*!
  * \brief Radial basis function interpolation.
+ * \note In the local variant each target point has its own (small) RBF system, formed by the nearest donor
+ *       points within the radius of the basis function. The cost scales with the number of target points
+ *       instead of the cube of the number of donor points, which makes it suitable for large interfaces,
+ *       and the interpolation matrix is sparse by construction. This is best combined with WENDLAND_C2.
  * \ingroup Interfaces
  */
 class CRadialBasisFunction final : public CInterpolator {
@@ -40,6 +44,7 @@ class CRadialBasisFunction final : public CInterpolator {
  private:
   unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
   passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  const bool localSystems; /*!< \brief Use one RBF system of nearby donors per target point. */
 
  public:
   /*!
@@ -48,9 +53,10 @@ class CRadialBasisFunction final : public CInterpolator {
    * \param[in] config - Definition of the particular problem.
    * \param[in] iZone - index of the donor zone.
    * \param[in] jZone - index of the target zone.
+   * \param[in] local - Use local RBF systems (see class notes).
    */
   CRadialBasisFunction(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
-                       unsigned int jZone);
+                       unsigned int jZone, bool local = false);
 
   /*!
    * \brief Set up transfer matrix defining relation between two meshes
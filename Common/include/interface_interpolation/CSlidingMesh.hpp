@@ -32,9 +32,15 @@
  * \brief Sliding mesh approach.
  * \note The algorithm is based on Rinaldi et al. "Flux-conserving treatment of non-conformal interfaces
  *       for finite-volume discritization of conservation laws" 2015, Comp. Fluids, 120, pp 126-139
+ * \note The closest donor vertex of each target vertex, where the supermesh construction starts, is kept between
+ *       updates of the coefficients (moving interfaces) to search for the new one only in its neighborhood.
  * \ingroup Interfaces
  */
 class CSlidingMesh final : public CInterpolator {
+ private:
+  vector<vector<long> > closestDonor; /*!< \brief Global index of the closest donor vertex of each target vertex
+                                                    in the last update, per target marker (-1 if unknown). */
+
  public:
   /*!
    * \brief Constructor of the class.
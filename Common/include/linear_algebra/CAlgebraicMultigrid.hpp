@@ -0,0 +1,243 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Smoothed aggregation algebraic multigrid hierarchy for block-sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../code_config.hpp"
+
+#include <vector>
+
+class CConfig;
+class CGeometry;
+template <class T>
+class CSysMatrix;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Smoothed aggregation AMG hierarchy built from the block-CSR structure of a CSysMatrix.
+ *
+ * Each level groups the block rows of the finer level into aggregates, the tentative prolongation P0
+ * interpolates the near null space of the operator exactly, it is obtained from QR factorizations of
+ * the null space restricted to each aggregate. P0 is smoothed by one damped Jacobi step,
+ * P = (I - w D^-1 A) P0 with w = 4 / (3 rho(D^-1 A)), and the coarse operators are the Galerkin
+ * products P^T A P. For general systems the near null space is one constant per variable (P0 is then
+ * piecewise constant), derived classes can provide other modes (see CSmoothedAggregationAMG).
+ * The first coarsening reuses the agglomeration of the geometric multigrid (when available), the others
+ * are based on the strength of the couplings. Like the ILU and LU_SGS preconditioners the hierarchy is
+ * local to each rank (couplings to halo points are ignored) and all levels are smoothed with damped
+ * block-Jacobi, the hierarchy is thus MPI parallel without additional communication. The coarsest level
+ * is solved directly if it is small enough. The setup is sequential (per rank), the V-cycle is thread parallel.
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ protected:
+  /*!
+   * \brief Block sparse row matrix, blocks of rowBlk x colBlk stored in row-major order.
+   */
+  struct CBlockMatrix {
+    unsigned long nRow = 0;             /*!< \brief Number of block rows. */
+    unsigned long nCol = 0;             /*!< \brief Number of block columns. */
+    unsigned long rowBlk = 0;           /*!< \brief Number of rows of each block. */
+    unsigned long colBlk = 0;           /*!< \brief Number of columns of each block. */
+    std::vector<unsigned long> row_ptr; /*!< \brief Pointers to the first block of each row. */
+    std::vector<unsigned long> col_ind; /*!< \brief Column index of each block. */
+    std::vector<ScalarType> values;     /*!< \brief Blocks. */
+  };
+
+  /*!
+   * \brief Lightweight view of a block sparse matrix (the fine matrix or the matrices of the hierarchy).
+   * \note Columns with index greater or equal to nCol are ignored (couplings to halo points).
+   */
+  struct CMatrixView {
+    unsigned long nRow, nCol, rowBlk, colBlk;
+    const unsigned long* row_ptr;
+    const unsigned long* col_ind;
+    const ScalarType* values;
+  };
+
+  /*!
+   * \brief A coarse level of the hierarchy.
+   */
+  struct CLevel {
+    CBlockMatrix P0;                      /*!< \brief Tentative prolongation from this level to the finer one. */
+    CBlockMatrix P;                       /*!< \brief Smoothed prolongation. */
+    CBlockMatrix R;                       /*!< \brief Restriction, the transpose of P. */
+    CBlockMatrix A;                       /*!< \brief Galerkin operator. */
+    std::vector<ScalarType> invDiag;      /*!< \brief Inverse of the diagonal blocks of A. */
+    mutable std::vector<ScalarType> sol;  /*!< \brief Correction (working memory). */
+    mutable std::vector<ScalarType> rhs;  /*!< \brief Restricted residual (working memory). */
+    mutable std::vector<ScalarType> work; /*!< \brief Residual and smoother increments (working memory). */
+  };
+
+  enum : unsigned long { MAX_BLOCK_SIZE = 20 };    /*!< \brief Largest block, same as CSysMatrix. */
+  enum : unsigned long { MAX_DIRECT_SIZE = 1024 }; /*!< \brief Max number of unknowns of the direct coarse solve. */
+  enum : unsigned long { POWER_ITERATIONS = 15 };  /*!< \brief Iterations of the spectral radius estimate. */
+  enum : unsigned long { OMP_MIN_SIZE = 64 };      /*!< \brief Chunk size for the loops over rows. */
+
+  std::vector<CLevel> levels;               /*!< \brief Coarse levels, the fine level is the matrix itself. */
+  mutable std::vector<ScalarType> fineWork; /*!< \brief Residual of the fine level (working memory). */
+  std::vector<passivedouble> coarseLU;      /*!< \brief Dense LU factorization of the coarsest level. */
+  std::vector<unsigned long> coarsePivot;   /*!< \brief Row permutation of the LU factorization. */
+  mutable std::vector<passivedouble> coarseWork; /*!< \brief Working memory of the direct solve. */
+  bool isAggregated = false;                /*!< \brief The aggregates and tentative prolongations are known. */
+  unsigned short nSweeps = 1;               /*!< \brief Number of pre and post smoothing sweeps. */
+  unsigned short nCoarseSweeps = 4;         /*!< \brief Sweeps on the coarsest level (if not solved directly). */
+  ScalarType relaxation = 0.7;              /*!< \brief Damping factor of the Jacobi smoother. */
+
+  /*!
+   * \brief Returns a view of a block matrix.
+   */
+  static CMatrixView View(const CBlockMatrix& M) {
+    return {M.nRow, M.nCol, M.rowBlk, M.colBlk, M.row_ptr.data(), M.col_ind.data(), M.values.data()};
+  }
+
+  /*!
+   * \brief Returns the operator and inverse diagonal of level iLevel, 0 being the fine matrix.
+   */
+  CMatrixView GetLevel(const CSysMatrix<ScalarType>& A, unsigned long iLevel, const ScalarType*& invDiag) const;
+
+  /*!
+   * \brief Greedy aggregation based on the strength of the couplings (Frobenius norm of the blocks).
+   * \param[in] fine - Level being coarsened (square blocks).
+   * \param[in] threshold - Couplings weaker than this fraction of the strongest in the row are ignored.
+   * \param[out] parent - Aggregate of each row.
+   * \return Number of aggregates.
+   */
+  static unsigned long Aggregate(const CMatrixView& fine, passivedouble threshold, std::vector<unsigned long>& parent);
+
+  /*!
+   * \brief Sparse product of block matrices, Z = X * Y.
+   */
+  static void Multiply(const CMatrixView& X, const CMatrixView& Y, CBlockMatrix& Z);
+
+  /*!
+   * \brief Transpose of a block matrix.
+   */
+  static void Transpose(const CMatrixView& X, CBlockMatrix& XT);
+
+  /*!
+   * \brief Invert the diagonal blocks of a matrix, the unused unknowns (zero rows) are regularized.
+   */
+  static void InvertDiagonal(const CMatrixView& M, std::vector<ScalarType>& invDiag);
+
+  /*!
+   * \brief Estimate the spectral radius of D^-1 A by power iterations.
+   */
+  static passivedouble SpectralRadius(const CMatrixView& M, const ScalarType* invDiag);
+
+  /*!
+   * \brief Tentative prolongation, QR factorization of the near null space restricted to each aggregate.
+   * \param[in] parent - Aggregate of each row of the finer level.
+   * \param[in] nAgg - Number of aggregates.
+   * \param[in] blkSize - Number of unknowns per row of the finer level.
+   * \param[in] nNull - Number of null space vectors.
+   * \param[in] nullSpace - Null space of the finer level (row-major, nNull values per unknown).
+   * \param[out] P0 - Tentative prolongation.
+   * \param[out] coarseNullSpace - Null space of the coarse level.
+   */
+  static void TentativeProlongation(const std::vector<unsigned long>& parent, unsigned long nAgg,
+                                    unsigned long blkSize, unsigned long nNull,
+                                    const std::vector<passivedouble>& nullSpace, CBlockMatrix& P0,
+                                    std::vector<passivedouble>& coarseNullSpace);
+
+  /*!
+   * \brief Smoothed prolongation, P = (I - w D^-1 A) P0, with w = 4 / (3 rho(D^-1 A)).
+   * \param[in] fine - Operator of the finer level.
+   * \param[in] invDiag - Inverse of its diagonal blocks.
+   * \param[in] P0 - Tentative prolongation.
+   * \param[out] P - Smoothed prolongation.
+   */
+  static void SmoothProlongation(const CMatrixView& fine, const ScalarType* invDiag, const CBlockMatrix& P0,
+                                 CBlockMatrix& P);
+
+  /*!
+   * \brief Smooth the tentative prolongation of a level and compute its Galerkin operator.
+   * \param[in] A - The fine matrix.
+   * \param[in] iLevel - Index of the coarse level (0 is the first coarse level).
+   */
+  void GalerkinOperator(const CSysMatrix<ScalarType>& A, unsigned long iLevel);
+
+  /*!
+   * \brief Factorize the coarsest level (if it is small enough).
+   */
+  void FactorizeCoarsest(const CSysMatrix<ScalarType>& A);
+
+  /*!
+   * \brief Aggregate and build the hierarchy for a given near null space, the first time, or recompute
+   *        the smoothed prolongations and coarse operators (the null space is not used).
+   * \note Sequential, must be called by a single thread.
+   * \param[in] A - The fine matrix, its Jacobi preconditioner must have been built.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nNull - Number of null space vectors.
+   * \param[in] nullSpace - Null space of the fine level (row-major, nNull values per unknown).
+   * \param[in] firstParent - Aggregates of the first coarsening (if empty they are computed).
+   */
+  void BuildHierarchy(const CSysMatrix<ScalarType>& A, const CConfig* config, unsigned long nNull,
+                      std::vector<passivedouble> nullSpace, const std::vector<unsigned long>& firstParent);
+
+  /*!
+   * \brief Generic y = y0 + scale * M * x, y0 may be null (zero) or the same as y.
+   */
+  void Product(const CMatrixView& M, const ScalarType* x, ScalarType* y, ScalarType scale,
+               const ScalarType* y0) const;
+
+  /*!
+   * \brief Damped block-Jacobi sweeps, x += w * D^-1 * (b - A*x).
+   */
+  void Smooth(const CMatrixView& M, const ScalarType* invDiag, const ScalarType* b, ScalarType* x,
+              ScalarType* work, unsigned short sweeps, bool xIsZero) const;
+
+  /*!
+   * \brief Apply a V-cycle that starts on a given level.
+   */
+  void Cycle(const CSysMatrix<ScalarType>& A, unsigned long iLevel, const ScalarType* b, ScalarType* x) const;
+
+ public:
+  /*!
+   * \brief Build the hierarchy, the aggregates and tentative prolongations are only computed on the
+   *        first call, the smoothed prolongations and coarse operators are recomputed on every call.
+   * \note Should be called by all threads of a parallel region.
+   * \param[in] A - The fine matrix, its Jacobi preconditioner must have been built.
+   * \param[in] geometry - Geometry associated with the matrix, to reuse the multigrid agglomeration.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(const CSysMatrix<ScalarType>& A, const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Apply one V-cycle to vec (the halos of prod are not updated).
+   * \param[in] A - The fine matrix.
+   * \param[in] vec - Right hand side.
+   * \param[out] prod - Result.
+   */
+  void Apply(const CSysMatrix<ScalarType>& A, const ScalarType* vec, ScalarType* prod) const;
+
+  /*!
+   * \brief Number of levels, including the fine level.
+   */
+  inline unsigned long GetNumLevels() const { return levels.size() + 1; }
+};
@@ -0,0 +1,201 @@
+/*!
+ * \file CPetscWrapper.hpp
+ * \brief An interface to the Krylov solvers and preconditioners of PETSc (https://petsc.org)
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_PETSC
+
+#ifdef CODI_FORWARD_TYPE
+#error Cannot use PETSc with forward mode AD
+#endif
+
+#include <petscksp.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CPetscWrapper
+ * \ingroup SpLinSys
+ * \brief Wrapper class that hands a SU2 sparse system to PETSc as a block (BAIJ) matrix, the Krylov method and
+ *        the preconditioner are chosen with PETSC_OPTIONS (e.g. -pc_type gamg, or -pc_type hypre for BoomerAMG).
+ * \note The matrix entries are copied (BAIJ splits the local and off-rank blocks), the vectors are used in place
+ *       when the types match (i.e. not in mixed precision builds).
+ */
+template <class ScalarType>
+class CPetscWrapper {
+ private:
+  Mat A = nullptr;   /*!< \brief Matrix of the system. */
+  Vec b = nullptr;   /*!< \brief Right hand side, placed over the SU2 vector or over workRhs. */
+  Vec x = nullptr;   /*!< \brief Solution, placed over the SU2 vector or over workSol. */
+  KSP ksp = nullptr; /*!< \brief Krylov solver (and preconditioner). */
+
+  vector<PetscInt> colGlobal;   /*!< \brief Global (block) column index of each non zero. */
+  vector<PetscScalar> rowVals;  /*!< \brief Entries of one block row converted to PetscScalar. */
+  vector<PetscScalar> workRhs;  /*!< \brief Right hand side if ScalarType is not PetscScalar. */
+  vector<PetscScalar> workSol;  /*!< \brief Solution if ScalarType is not PetscScalar. */
+  PetscInt offset = 0;          /*!< \brief Global index of the first (block) row of this rank. */
+
+  struct {
+    unsigned long nVar = 0;
+    unsigned long nPoint = 0;
+    unsigned long nPointDomain = 0;
+    const unsigned long* rowptr = nullptr;
+    const unsigned long* colidx = nullptr;
+    const ScalarType* values = nullptr;
+
+    unsigned long size_rhs() const { return nPointDomain * nVar; }
+  } matrix; /*!< \brief Pointers and sizes of the input matrix. */
+
+  bool issetup = false;       /*!< \brief Signals that the matrix data has been provided. */
+  bool isinitialized = false; /*!< \brief Signals that the PETSc objects have been created. */
+
+  /*!
+   * \brief Abort on PETSc errors.
+   */
+  static void Check(PetscErrorCode ierr) {
+    if (ierr) SU2_MPI::Error("PETSc error code " + to_string(int(ierr)), CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Create the PETSc objects and the global numbering of the sparsity pattern.
+   */
+  void Initialize(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Place the vectors over the data of the SU2 vectors (no copy).
+   */
+  void PlaceArrays(const PetscScalar* rhs, PetscScalar* sol) {
+    Check(VecPlaceArray(b, rhs));
+    Check(VecPlaceArray(x, sol));
+  }
+
+  /*!
+   * \brief Copy the SU2 vectors to the work vectors (different types) and place the PETSc vectors over them.
+   */
+  template <class T>
+  void PlaceArrays(const T* rhs, T* sol) {
+    for (auto i = 0ul; i < matrix.size_rhs(); ++i) {
+      workRhs[i] = SU2_TYPE::GetValue(rhs[i]);
+      workSol[i] = SU2_TYPE::GetValue(sol[i]);
+    }
+    Check(VecPlaceArray(b, workRhs.data()));
+    Check(VecPlaceArray(x, workSol.data()));
+  }
+
+  /*!
+   * \brief Copy the solution back to the SU2 vector if the types are different.
+   */
+  void RetrieveSolution(PetscScalar*) const {}
+  template <class T>
+  void RetrieveSolution(T* sol) const {
+    for (auto i = 0ul; i < matrix.size_rhs(); ++i) sol[i] = workSol[i];
+  }
+
+ public:
+  CPetscWrapper() = default;
+
+  /*--- Move or copy is not allowed. ---*/
+  CPetscWrapper(CPetscWrapper&&) = delete;
+  CPetscWrapper(const CPetscWrapper&) = delete;
+  CPetscWrapper& operator=(CPetscWrapper&&) = delete;
+  CPetscWrapper& operator=(const CPetscWrapper&) = delete;
+
+  /*!
+   * \brief Class destructor.
+   */
+  ~CPetscWrapper();
+
+  /*!
+   * \brief Set matrix data, only once.
+   * \param[in] nVar - DOF per point.
+   * \param[in] nPoint - Total number of points including halos.
+   * \param[in] nPointDomain - Number of internal points.
+   * \param[in] rowptr - Array, where column index data starts for each matrix row.
+   * \param[in] colidx - Non zeros column indices.
+   * \param[in] values - Matrix coefficients.
+   */
+  void SetMatrix(unsigned long nVar, unsigned long nPoint, unsigned long nPointDomain, const unsigned long* rowptr,
+                 const unsigned long* colidx, const ScalarType* values) {
+    if (issetup) return;
+    matrix.nVar = nVar;
+    matrix.nPoint = nPoint;
+    matrix.nPointDomain = nPointDomain;
+    matrix.rowptr = rowptr;
+    matrix.colidx = colidx;
+    matrix.values = values;
+    issetup = true;
+  }
+
+  /*!
+   * \brief Copy the current entries of the matrix to PETSc, the preconditioner is rebuilt by the next solve.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Update(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Solve the system for any rhs/sol with operator [] (the halos of sol are not updated).
+   * \param[in] rhs - Right hand side of the linear system.
+   * \param[in,out] sol - Initial guess and solution of the system.
+   * \param[in] tol - Tolerance relative to the norm of the right hand side.
+   * \param[in] maxIter - Maximum number of iterations.
+   * \param[in] transposed - Solve the transposed system.
+   * \param[out] residual - Final residual relative to the norm of the right hand side.
+   * \return Number of iterations.
+   */
+  template <class T>
+  unsigned long Solve(const T& rhs, T& sol, passivedouble tol, unsigned long maxIter, bool transposed,
+                      passivedouble& residual) {
+    if (!isinitialized) SU2_MPI::Error("The matrix has not been copied to PETSc yet.", CURRENT_FUNCTION);
+
+    PlaceArrays(&rhs[0], &sol[0]);
+
+    Check(KSPSetTolerances(ksp, tol, PETSC_DEFAULT, PETSC_DEFAULT, PetscInt(maxIter)));
+    if (transposed)
+      Check(KSPSolveTranspose(ksp, b, x));
+    else
+      Check(KSPSolve(ksp, b, x));
+
+    PetscInt iter = 0;
+    PetscReal resNorm = 0, rhsNorm = 0;
+    Check(KSPGetIterationNumber(ksp, &iter));
+    Check(KSPGetResidualNorm(ksp, &resNorm));
+    Check(VecNorm(b, NORM_2, &rhsNorm));
+    residual = resNorm / max(rhsNorm, PetscReal(1e-300));
+
+    Check(VecResetArray(b));
+    Check(VecResetArray(x));
+    RetrieveSolution(&sol[0]);
+
+    return iter;
+  }
+};
+#endif
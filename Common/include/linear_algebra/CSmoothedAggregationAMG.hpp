@@ -0,0 +1,55 @@
+/*!
+ * \file CSmoothedAggregationAMG.hpp
+ * \brief Smoothed aggregation algebraic multigrid hierarchy for the block-sparse matrices of elasticity.
+ *        The implementation is in <i>CSmoothedAggregationAMG.cpp</i>.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CAlgebraicMultigrid.hpp"
+
+/*!
+ * \class CSmoothedAggregationAMG
+ * \ingroup SpLinSys
+ * \brief Smoothed aggregation AMG hierarchy for the nDim-blocked matrices of elasticity (structural
+ *        and mesh deformation problems).
+ *
+ * The near null space of elasticity operators, the rigid body modes (3 in 2D, 6 in 3D), is interpolated
+ * exactly by the tentative prolongation, the coarse levels therefore have one block of that size per
+ * aggregate. Everything else (aggregation, prolongation smoothing, Galerkin operators, V-cycle) is
+ * done by CAlgebraicMultigrid.
+ */
+template <class ScalarType>
+class CSmoothedAggregationAMG : public CAlgebraicMultigrid<ScalarType> {
+ public:
+  /*!
+   * \brief Build the hierarchy, the aggregates and tentative prolongations are only computed on the
+   *        first call, the smoothed prolongations and coarse operators are recomputed on every call.
+   * \note Should be called by all threads of a parallel region.
+   * \param[in] A - The fine matrix (nDim variables per point), its Jacobi preconditioner must have been built.
+   * \param[in] geometry - Geometry associated with the matrix, provides the coordinates for the rigid body modes.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(const CSysMatrix<ScalarType>& A, const CGeometry* geometry, const CConfig* config);
+};
@@ -31,6 +31,9 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CPetscWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
+#include "CSmoothedAggregationAMG.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -116,6 +119,8 @@ template <class ScalarType>
 class CSysMatrix {
  private:
   friend struct CSysMatrixComms;
+  friend class CAlgebraicMultigrid<ScalarType>;
+  friend class CSmoothedAggregationAMG<ScalarType>;
 
   const int rank; /*!< \brief MPI Rank. */
   const int size; /*!< \brief MPI Size. */
@@ -137,6 +142,7 @@ class CSysMatrix {
   unsigned long nPointDomain; /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;         /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;         /*!< \brief Number of equations (and columns of the blocks). */
+  unsigned long kernelBlockSize; /*!< \brief Block size of the specialized kernels, 0 for the generic ones. */
 
   ScalarType* matrix;           /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;            /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -151,8 +157,25 @@ class CSysMatrix {
   const unsigned long* dia_ptr_ilu; /*!< \brief Pointers to the diagonal element in each row (ILU). */
   const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
+  bool ilu_in_place = false;        /*!< \brief ILU(0) factorization overwrites the matrix (ILU_matrix == matrix). */
+
+  /*--- 32-bit copies of the sparse patterns, the matrix-vector product and the ILU substitutions are memory
+   *    bound and use them (half the index traffic) when all local indices fit in 32 bits. ---*/
+  bool compactIndices = false;     /*!< \brief Whether the 32-bit patterns are used. */
+  vector<uint32_t> row_ptr_32;     /*!< \brief 32-bit copy of row_ptr. */
+  vector<uint32_t> col_ind_32;     /*!< \brief 32-bit copy of col_ind. */
+  vector<uint32_t> row_ptr_ilu_32; /*!< \brief 32-bit copy of row_ptr_ilu. */
+  vector<uint32_t> dia_ptr_ilu_32; /*!< \brief 32-bit copy of dia_ptr_ilu. */
+  vector<uint32_t> col_ind_ilu_32; /*!< \brief 32-bit copy of col_ind_ilu. */
+
+  /*--- Level scheduling of the ILU factorization and substitutions, each level only depends on previous ones. ---*/
+  vector<unsigned long> ilu_lower_level_ptr; /*!< \brief Pointers to the first row of each level (forward). */
+  vector<unsigned long> ilu_lower_level_row; /*!< \brief Rows sorted by level of the lower factor (forward). */
+  vector<unsigned long> ilu_upper_level_ptr; /*!< \brief Pointers to the first row of each level (backward). */
+  vector<unsigned long> ilu_upper_level_row; /*!< \brief Rows sorted by level of the upper factor (backward). */
 
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
+  bool onDevice = false; /*!< \brief The matrix and the Jacobi preconditioner are mapped to the target device. */
 
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
   mutable vector<vector<const ScalarType*> >
@@ -178,6 +201,12 @@ class CSysMatrix {
 #ifdef HAVE_PASTIX
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
+#ifdef HAVE_PETSC
+  mutable CPetscWrapper<ScalarType> petsc_wrapper;
+#endif
+
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Coarse levels of the AMG preconditioner. */
+  CSmoothedAggregationAMG<ScalarType> sa_amg_hierarchy; /*!< \brief Coarse levels of the SA_AMG preconditioner. */
 
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
@@ -284,10 +313,12 @@ class CSysMatrix {
 
   /*!
    * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i,i) subblock and rhs.
+   * \tparam N - Compile-time block size, 0 for the runtime size (see kernelBlockSize).
    * \param[in] block_i - Index of the (i,i) diagonal block.
    * \param[in] rhs - Right-hand-side of the linear system.
    * \return Solution of the linear system (overwritten on rhs).
    */
+  template <size_t N = 0>
   inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const;
 
   /*!
@@ -319,13 +350,40 @@ class CSysMatrix {
    */
   inline void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType* val_block);
 
+  /*!
+   * \brief Block-vector products (prod = block*vec, prod += block*vec, and prod -= block*vec) specialized on
+   *        the size of the blocks, N = 0 uses the runtime size, i.e. the generic (or MKL) implementation.
+   * \note The kernels for fixed N are fully unrolled by the compiler, which then vectorizes the rows.
+   */
+  template <size_t N>
+  inline void BlockVectorProduct(const ScalarType* matrix, const ScalarType* vector, ScalarType* product) const;
+  template <size_t N>
+  inline void BlockVectorProductAdd(const ScalarType* matrix, const ScalarType* vector, ScalarType* product) const;
+  template <size_t N>
+  inline void BlockVectorProductSub(const ScalarType* matrix, const ScalarType* vector, ScalarType* product) const;
+
+  /*!
+   * \brief Compute the levels of the ILU factors such that rows of the same level can be processed in parallel.
+   */
+  void SetILULevels();
+
+  /*!
+   * \brief Incomplete factorization of a row of the ILU matrix (the rows it depends on must be factorized).
+   * \param[in] iPoint - The row.
+   * \param[in] begin - Columns before this one are ignored.
+   * \param[in] end - Columns from this one are ignored.
+   */
+  void FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end);
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
+   * \tparam N - Compile-time block size, 0 for the runtime size (see kernelBlockSize).
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
+  template <size_t N = 0>
   inline void UpperProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, unsigned long col_ub,
                            ScalarType* prod) const;
 
@@ -336,6 +394,7 @@ class CSysMatrix {
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
+  template <size_t N = 0>
   inline void LowerProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, unsigned long col_lb,
                            ScalarType* prod) const;
 
@@ -345,6 +404,7 @@ class CSysMatrix {
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
+  template <size_t N = 0>
   inline void DiagonalProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
 
   /*!
@@ -353,7 +413,40 @@ class CSysMatrix {
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return Result of the product (stored at *prod_row_vector).
    */
-  void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
+  template <size_t N = 0>
+  inline void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
+
+  /*!
+   * \brief Same as above with an explicit sparse pattern (e.g. the 32-bit copy).
+   */
+  template <size_t N, class Index_t>
+  inline void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod,
+                         const Index_t* rowPtr, const Index_t* colInd) const;
+
+  /*!
+   * \brief Thread-parallel loops of the matrix-vector product, of the ILU substitutions, and of the two sweeps
+   *        of LU_SGS, specialized on the block size (called via the switch on kernelBlockSize).
+   * \note These do not perform any communication or synchronization before the loops.
+   */
+  template <size_t N>
+  void RowProductLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+  template <size_t N>
+  void ILUSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+  template <size_t N>
+  void ILULevelSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+  template <size_t N, class Index_t>
+  void RowProductLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, const Index_t* rowPtr,
+                      const Index_t* colInd) const;
+  template <size_t N, class Index_t>
+  void ILUSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, const Index_t* rowPtr,
+                           const Index_t* diaPtr, const Index_t* colInd) const;
+  template <size_t N, class Index_t>
+  void ILULevelSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                const Index_t* rowPtr, const Index_t* diaPtr, const Index_t* colInd) const;
+  template <size_t N>
+  void LU_SGSForwardLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+  template <size_t N>
+  void LU_SGSBackwardLoop(CSysVector<ScalarType>& prod) const;
 
  public:
   /*!
@@ -375,7 +468,7 @@ class CSysMatrix {
    * \param[in] neqn - Number of equations (and columns of the blocks).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
-   * \param[in] needTranspPtr - If "col_ptr" should be created, used for "SetDiagonalAsColumnSum".
+   * \param[in] needTranspPtr - If "col_ptr" should be created, used for "SetDiagonalAsColumnSum" (FEM only).
    */
   void Initialize(unsigned long npoint, unsigned long npointdomain, unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry* geometry, const CConfig* config, bool needTranspPtr = false,
@@ -812,8 +905,12 @@ class CSysMatrix {
 
   /*!
    * \brief Sets the diagonal entries of the matrix as the sum of the blocks in the corresponding column.
+   * \note For edge-based (FV) matrices, the off-diagonal blocks of each point are gathered via its edges, i.e. this
+   *       is the point loop that complements edge loops that only set the off-diagonal blocks (as SumEdgeFluxes
+   *       does for the residual), for other matrices "col_ptr" is required.
+   * \param[in] geometry - Geometrical definition of the problem.
    */
-  void SetDiagonalAsColumnSum();
+  void SetDiagonalAsColumnSum(const CGeometry* geometry);
 
   /*!
    * \brief Transposes the matrix, any preconditioner that was computed may be invalid.
@@ -828,6 +925,15 @@ class CSysMatrix {
    */
   void MatrixMatrixAddition(ScalarType alpha, const CSysMatrix& B);
 
+  /*!
+   * \brief Copy the blocks of B into sub-blocks of the blocks of "this", A_ij(offset:, offset:) = B_ij, used to
+   *        assemble a coupled system from the Jacobians of the individual solvers.
+   * \note Matrices must have the same sparse pattern, the other entries of the blocks are not modified.
+   * \param[in] B - Matrix being copied.
+   * \param[in] offset - Row and column of the blocks of "this" where the blocks of B start.
+   */
+  void SetSubBlocks(const CSysMatrix& B, unsigned long offset);
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
@@ -853,11 +959,43 @@ class CSysMatrix {
   void ComputeJacobiPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
 
+  /*!
+   * \brief Copy the entries of the matrix and of the Jacobi preconditioner to the OpenMP target device, the
+   *        memory is mapped by the first call and stays on the device until the matrix is destroyed.
+   * \note Only the master thread should call this, after BuildJacobiPreconditioner.
+   * \return False if the build does not support offloading (SU2_OMP_OFFLOAD) or no device is available.
+   */
+  bool UpdateDevice();
+
+  /*!
+   * \brief Product of the owned rows of the matrix by a vector on the device (see UpdateDevice).
+   * \note The vectors must already be on the device (e.g. target enter data), the halos are not updated,
+   *       only the master thread should call this.
+   * \param[in] vec - Vector to be multiplied by the matrix (device copy of its host address).
+   * \param[out] prod - Result of the product.
+   */
+  void DeviceMatrixVectorProduct(const ScalarType* vec, ScalarType* prod) const;
+
+  /*!
+   * \brief Application of the Jacobi preconditioner on the device, see DeviceMatrixVectorProduct.
+   * \param[in] vec - Vector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   */
+  void DeviceJacobiPreconditioner(const ScalarType* vec, ScalarType* prod) const;
+
   /*!
    * \brief Build the ILU preconditioner.
    */
   void BuildILUPreconditioner();
 
+  /*!
+   * \brief Factorize ILU(0) in place of the matrix entries instead of in a copy, this halves the memory of
+   *        matrices that are only used to build the preconditioner (e.g. the matrix-free Newton-Krylov method).
+   * \note After BuildILUPreconditioner the matrix holds the factors and cannot be used in products.
+   * \return False if the matrix does not have an ILU(0) preconditioner.
+   */
+  bool SetILUInPlace();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -891,6 +1029,40 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one AMG V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
+  /*!
+   * \brief Build the smoothed aggregation multigrid preconditioner for elasticity (nDim variables per point).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildSAAMGPreconditioner(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one smoothed aggregation V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeSAAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                  CGeometry* geometry, const CConfig* config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
@@ -900,6 +1072,17 @@ class CSysMatrix {
   void ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                        CSysVector<ScalarType>& res) const;
 
+  /*!
+   * \brief Compute the linear residual in the precision of the vectors (the blocks are promoted).
+   * \note Used for iterative refinement when the matrix is stored in lower precision.
+   * \param[in] sol - Solution (x).
+   * \param[in] f - Right hand side (b).
+   * \param[out] res - Residual (Ax-b).
+   */
+  template <class OtherType>
+  void ComputePromotedResidual(const CSysVector<OtherType>& sol, const CSysVector<OtherType>& f,
+                               CSysVector<OtherType>& res) const;
+
   /*!
    * \brief Factorize matrix using PaStiX.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -917,4 +1100,20 @@ class CSysMatrix {
    */
   void ComputePastixPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
+
+  /*!
+   * \brief Solve the system with PETSc, the Krylov method and preconditioner are set with PETSC_OPTIONS.
+   * \param[in] vec - Right hand side of the system.
+   * \param[in,out] prod - Initial guess and solution of the system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] tol - Tolerance relative to the norm of the right hand side.
+   * \param[in] maxIter - Maximum number of iterations.
+   * \param[in] transposed - Solve the transposed system (discrete adjoint).
+   * \param[out] residual - Final residual relative to the norm of the right hand side.
+   * \return Number of iterations.
+   */
+  unsigned long ComputePetscSolution(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                     CGeometry* geometry, const CConfig* config, passivedouble tol,
+                                     unsigned long maxIter, bool transposed, passivedouble& residual) const;
 };
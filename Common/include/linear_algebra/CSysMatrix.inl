@@ -71,6 +71,29 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T* a, const T
   }
 }
 
+template <class T>
+FORCEINLINE void gauss_elimination_impl(unsigned long n, T* matrix, T* vec) {
+  /*--- Gaussian elimination without pivoting, the size is a parameter for the same reason as above. ---*/
+#define A(I, J) matrix[(I)*n + (J)]
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar, jVar) / A(jVar, jVar);
+      for (auto kVar = jVar; kVar < n; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
+      vec[iVar] -= weight * vec[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--;  // unsigned type
+    for (auto jVar = iVar + 1; jVar < n; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
+    vec[iVar] /= A(iVar, iVar);
+  }
+#undef A
+}
+
 template <class T>
 FORCEINLINE void gemm_impl(unsigned long n, const T* a, const T* b, T* c) {
   /*--- Same deal as for GEMV but here only the type is templated. ---*/
@@ -141,8 +164,45 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType* m
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
+/*--- Block-size specialized kernels, for N = 0 they forward to the generic (or MKL) versions above. ---*/
+
+#define BLOCKPROD_SIGNATURE(NAME)                                                                     \
+  template <class ScalarType>                                                                         \
+  template <size_t N>                                                                                 \
+  FORCEINLINE void CSysMatrix<ScalarType>::NAME(const ScalarType* matrix, const ScalarType* vector, \
+                                                ScalarType* product) const
+
+BLOCKPROD_SIGNATURE(BlockVectorProduct) {
+  if (N == 0) return MatrixVectorProduct(matrix, vector, product);
+  gemv_impl<ScalarType, true, false, false>(N, N, matrix, vector, product);
+}
+
+BLOCKPROD_SIGNATURE(BlockVectorProductAdd) {
+  if (N == 0) return MatrixVectorProductAdd(matrix, vector, product);
+  gemv_impl<ScalarType, true, true, false>(N, N, matrix, vector, product);
+}
+
+BLOCKPROD_SIGNATURE(BlockVectorProductSub) {
+  if (N == 0) return MatrixVectorProductSub(matrix, vector, product);
+  gemv_impl<ScalarType, false, true, false>(N, N, matrix, vector, product);
+}
+
+#undef BLOCKPROD_SIGNATURE
+
 template <class ScalarType>
+template <size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const {
+  /*--- With MKL LAPACK the generic version uses the pivoted getrf/getrs, which is kept for all block sizes. ---*/
+#ifndef USE_MKL_LAPACK
+  if (N != 0) {
+    ScalarType block[N ? N * N : 1];
+    const auto src = &matrix[dia_ptr[block_i] * N * N];
+    for (auto iVar = 0ul; iVar < N * N; ++iVar) block[iVar] = src[iVar];
+
+    gauss_elimination_impl(N, block, rhs);
+    return;
+  }
+#endif
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR * MAXNVAR];
   MatrixCopy(&matrix[dia_ptr[block_i] * nVar * nVar], block);
@@ -169,43 +229,69 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
   MatrixInverse(block, invBlock);
 }
 
+/*--- In the row operations the block sizes are replaced by N when it is not 0,
+ *    this allows the compiler to resolve the index arithmetic at compilation. ---*/
+
 template <class ScalarType>
+template <size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                     ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+  RowProduct<N>(vec, row_i, prod, row_ptr, col_ind);
+}
 
-  for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
-    auto col_j = col_ind[index];
-    MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+template <class ScalarType>
+template <size_t N, class Index_t>
+FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
+                                                    ScalarType* prod, const Index_t* rowPtr,
+                                                    const Index_t* colInd) const {
+  const auto nv = N ? N : nVar;
+  const auto ne = N ? N : nEqn;
+
+  for (auto iVar = 0ul; iVar < nv; iVar++) prod[iVar] = 0.0;
+
+  for (unsigned long index = rowPtr[row_i]; index < rowPtr[row_i + 1]; index++) {
+    const unsigned long col_j = colInd[index];
+    BlockVectorProductAdd<N>(&matrix[index * nv * ne], &vec[col_j * ne], prod);
   }
 }
 
 template <class ScalarType>
+template <size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                       unsigned long col_ub, ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+  const auto nv = N ? N : nVar;
+  const auto ne = N ? N : nEqn;
+
+  for (auto iVar = 0ul; iVar < nv; iVar++) prod[iVar] = 0.0;
 
   for (auto index = dia_ptr[row_i] + 1; index < row_ptr[row_i + 1]; index++) {
     auto col_j = col_ind[index];
     /*--- Always include halos. ---*/
     if (col_j < col_ub || col_j >= nPointDomain)
-      MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+      BlockVectorProductAdd<N>(&matrix[index * nv * ne], &vec[col_j * ne], prod);
   }
 }
 
 template <class ScalarType>
+template <size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                       unsigned long col_lb, ScalarType* prod) const {
-  for (auto iVar = 0ul; iVar < nVar; iVar++) prod[iVar] = 0.0;
+  const auto nv = N ? N : nVar;
+  const auto ne = N ? N : nEqn;
+
+  for (auto iVar = 0ul; iVar < nv; iVar++) prod[iVar] = 0.0;
 
   for (auto index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
     auto col_j = col_ind[index];
-    if (col_j >= col_lb) MatrixVectorProductAdd(&matrix[index * nVar * nEqn], &vec[col_j * nEqn], prod);
+    if (col_j >= col_lb) BlockVectorProductAdd<N>(&matrix[index * nv * ne], &vec[col_j * ne], prod);
   }
 }
 
 template <class ScalarType>
+template <size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                          ScalarType* prod) const {
-  MatrixVectorProduct(&matrix[dia_ptr[row_i] * nVar * nEqn], &vec[row_i * nEqn], prod);
+  const auto nv = N ? N : nVar;
+  const auto ne = N ? N : nEqn;
+  BlockVectorProduct<N>(&matrix[dia_ptr[row_i] * nv * ne], &vec[row_i * ne], prod);
 }
@@ -100,10 +100,23 @@ class CSysSolve {
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
 
+  mutable std::vector<VectorType> RecycleU; /*!< \brief Recycled subspace (solution updates of previous calls). */
+  mutable std::vector<VectorType> RecycleC; /*!< \brief Orthonormal products of the operator with RecycleU. */
+  mutable VectorType RecycleX0;             /*!< \brief Initial solution, to compute the update of each call. */
+  mutable unsigned long nRecycled = 0;      /*!< \brief Number of valid vectors in the recycled subspace. */
+  mutable unsigned long recycleNext = 0;    /*!< \brief Position of the next (or oldest) recycled vector. */
+
+  using MPIWrapper = typename SelectMPIWrapper<ScalarType>::W;
+  mutable std::vector<ScalarType> dotLocal;  /*!< \brief Local (rank) sums of the block dot product. */
+  mutable std::vector<ScalarType> dotGlobal; /*!< \brief Result of the block dot product. */
+  mutable typename MPIWrapper::Request dotRequest; /*!< \brief Request of the non-blocking reduction. */
+
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType
       LinSysRes_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
+  CSysVector<su2double> RefineRes; /*!< \brief Residual of the outer vectors during iterative refinement. */
+  CSysVector<su2double> RefineSol; /*!< \brief Correction computed during iterative refinement. */
   VectorType*
       LinSysSol_ptr; /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
   const VectorType*
@@ -115,6 +128,13 @@ class CSysSolve {
   bool recomputeRes = false;         /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10;    /*!< \brief Monitoring frequency. */
 
+  bool precReady = false;         /*!< \brief The preconditioner was built by a previous call to Solve. */
+  bool precReused = false;        /*!< \brief The preconditioner was reused in the last call to Solve. */
+  unsigned long precAge = 0;      /*!< \brief Number of calls to Solve since the preconditioner was last built. */
+  unsigned long precRefIter = 0;  /*!< \brief Iterations done right after the preconditioner was last built. */
+  bool matrixUnchanged = false;   /*!< \brief The matrix did not change since the previous call to Solve. */
+  bool deviceSolve = false;       /*!< \brief The system of the current call to Solve is solved on the device. */
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -184,6 +204,23 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Start the (non-blocking) reduction of the dot products of w[i+1] with w[0:i+1], and optionally
+   *        of w[i] with w[0:i] (to measure the loss of orthogonality and the norm of the last basis vector).
+   * \note The (i+1)-th product is the squared norm of w[i+1]. The local products are computed by all threads,
+   *       w[0:i+1] can be used but not modified until the results are obtained with CompleteBlockDot.
+   * \param[in] i - Index of the vector being orthogonalized minus one.
+   * \param[in] w - The vectors.
+   * \param[in] lagged - Whether to include the products of w[i].
+   */
+  void InitiateBlockDot(int i, const std::vector<VectorType>& w, bool lagged) const;
+
+  /*!
+   * \brief Complete the reduction started by InitiateBlockDot.
+   * \return Pointer to the i+2 (plus i+1 if lagged) dot products (shared by all threads).
+   */
+  const ScalarType* CompleteBlockDot() const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -326,6 +363,30 @@ class CSysSolve {
                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                  bool monitoring, const CConfig* config) const;
 
+  /*!
+   * \brief Pipelined Flexible Generalized Minimal Residual method.
+   * \note The orthogonalization of each new vector requires a single global reduction (classical Gram-Schmidt
+   *       with lagged reorthogonalization and normalization of the previous vector), which is overlapped with
+   *       the application of the preconditioner and the matrix-vector product to the non-orthogonalized vector.
+   *       The next direction and its product are then obtained by recurrence (p1-GMRES), the product is
+   *       recomputed when there is significant cancellation. The parameters are the same as FGMRES.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                  bool monitoring, const CConfig* config) const;
+
+  /*!
+   * \brief Flexible Generalized Minimal Residual method with a subspace recycled between calls (GCRO type).
+   * \note The recycled subspace U holds the solution updates of the last LINEAR_SOLVER_RECYCLE_SIZE calls,
+   *       C = A U is recomputed and orthonormalized at the start of each call (the operator may have changed),
+   *       the initial residual is projected out of span(C), and the Krylov subspace is built with (I - C C^T) A.
+   *       Effective for sequences of similar systems (dual time steps, Newton and adjoint iterations).
+   *       The parameters are the same as FGMRES.
+   */
+  unsigned long RecycledFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                         const PrecondType& precond, ScalarType tol, unsigned long m,
+                                         ScalarType& residual, bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Flexible Generalized Minimal Residual method with restarts (frequency comes from config).
    */
@@ -365,6 +426,41 @@ class CSysSolve {
                                    const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                    bool monitoring, const CConfig* config) const;
 
+  /*!
+   * \brief BCGSTAB with the Jacobi preconditioner on the OpenMP target device (DEVICE_BCGSTAB).
+   * \note The vectors stay on the device during the iterations, only the halos are exchanged through the host.
+   *       The matrix and the preconditioner must be on the device (CSysMatrix::UpdateDevice).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] matrix - the matrix of the system
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long DeviceBCGSTAB_LinSolver(const VectorType& b, VectorType& x, const MatrixType& matrix,
+                                        CGeometry* geometry, ScalarType tol, unsigned long m, ScalarType& residual,
+                                        bool monitoring, const CConfig* config) const;
+
+  /*!
+   * \brief Solve the system with the Krylov methods and preconditioners of PETSc (LINEAR_SOLVER= PETSC).
+   * \param[in] matrix - the matrix of the system
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[in] transposed - solve the transposed system
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PETSc_LinSolver(const MatrixType& matrix, const VectorType& b, VectorType& x, ScalarType tol,
+                                unsigned long m, bool transposed, ScalarType& residual, bool monitoring,
+                                CGeometry* geometry, const CConfig* config) const;
+
   /*!
    * \brief Solve the linear system using a Krylov subspace method
    * \param[in] Jacobian - Jacobian Matrix for the linear system
@@ -400,6 +496,18 @@ class CSysSolve {
    */
   inline ScalarType GetResidual(void) const { return Residual; }
 
+  /*!
+   * \brief Get the age of the preconditioner used in the last call to Solve.
+   * \return Number of calls since the preconditioner was built, 0 if it was built in the last call.
+   */
+  inline unsigned long GetPreconditionerAge(void) const { return precAge; }
+
+  /*!
+   * \brief Declare that the matrix is the same as in the previous call to Solve (e.g. frozen stiffness),
+   *        the preconditioner (or the PaStiX factorization) is then reused regardless of its age.
+   */
+  inline void SetMatrixUnchanged(bool unchanged) { matrixUnchanged = unchanged; }
+
   /*!
    * \brief Set the type of the tolerance for stoping the linear solvers (RELATIVE or ABSOLUTE).
    */
@@ -34,5 +34,13 @@ template <class ScalarType>
 struct CSysSolve_b {
   static void Solve_b(const su2double::Real* x, su2double::Real* x_b, size_t m, const su2double::Real* y,
                       const su2double::Real* y_b, size_t n, codi::ExternalFunctionUserData* d);
+
+  /*!
+   * \brief Primal of the external function, used when a primal value tape is re-evaluated.
+   * \note The (possibly transposed) matrix of the recording is used, the solution of the system is only a
+   *       correction of the fixed-point iteration and the matrix does not change its converged solution.
+   */
+  static void Solve_p(const su2double::Real* x, size_t m, su2double::Real* y, size_t n,
+                      codi::ExternalFunctionUserData* d);
 };
 #endif
@@ -71,6 +71,36 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
   unsigned long nElmDomain = 0; /*!< \brief Total number of elements without Ghost cells. */
   unsigned long nVar = 1;       /*!< \brief Number of elements in a block. */
 
+  /*!
+   * \brief Sum the partial results of the threads, and of the ranks, with a single reduction.
+   * \note Collective over the threads, "sums" is overwritten by the global sums.
+   * \param[in,out] sums - Partial sums of the calling thread.
+   */
+  template <size_t N>
+  static void reduceSums(ScalarType (&sums)[N]) {
+    static ScalarType shared[N];
+    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
+    SU2_OMP_SAFE_GLOBAL_ACCESS(for (size_t k = 0; k < N; ++k) shared[k] = 0.0;)
+
+    /*--- Update shared variable with "our" partial sums. ---*/
+    for (size_t k = 0; k < N; ++k) atomicAdd(sums[k], shared[k]);
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (size_t k = 0; k < N; ++k) sums[k] = shared[k];
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(sums, shared, N, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#else
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+#endif
+
+    for (size_t k = 0; k < N; ++k) sums[k] = shared[k];
+  }
+
   /*!
    * \brief Generic initialization from a scalar or array.
    * \note If val==nullptr vec_val is not initialized, only allocated.
@@ -294,36 +324,78 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   template <class T>
   ScalarType dot(const VecExpr::CVecExpr<T, ScalarType>& expr) const {
-    static ScalarType dotRes;
-    /*--- All threads get the same "view" of the vectors and shared variable. ---*/
-    SU2_OMP_SAFE_GLOBAL_ACCESS(dotRes = 0.0;)
-
     /*--- Local dot product for each thread. ---*/
-    ScalarType sum = 0.0;
+    ScalarType sum[1] = {0.0};
 
     CSYSVEC_PARFOR
     for (auto i = 0ul; i < nElmDomain; ++i) {
-      sum += vec_val[i] * expr.derived()[i];
+      sum[0] += vec_val[i] * expr.derived()[i];
     }
     END_CSYSVEC_PARFOR
 
-    /*--- Update shared variable with "our" partial sum. ---*/
-    atomicAdd(sum, dotRes);
+    reduceSums(sum);
+    return sum[0];
+  }
+
+  /*!
+   * \brief Two dot products of "this" in a single pass over the vectors, and with a single reduction.
+   * \param[in] expr1 - First expression.
+   * \param[in] expr2 - Second expression.
+   * \param[out] dot1 - Dot product with the first expression.
+   * \param[out] dot2 - Dot product with the second expression.
+   */
+  template <class T, class U>
+  void dot(const VecExpr::CVecExpr<T, ScalarType>& expr1, const VecExpr::CVecExpr<U, ScalarType>& expr2,
+           ScalarType& dot1, ScalarType& dot2) const {
+    ScalarType sum[2] = {0.0, 0.0};
 
-#ifdef HAVE_MPI
-    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      sum = dotRes;
-      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
-      SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      sum[0] += vec_val[i] * expr1.derived()[i];
+      sum[1] += vec_val[i] * expr2.derived()[i];
     }
-    END_SU2_OMP_SAFE_GLOBAL_ACCESS
-#else
-    /*--- Make view of result consistent across threads. ---*/
-    SU2_OMP_BARRIER
-#endif
+    END_CSYSVEC_PARFOR
+
+    reduceSums(sum);
+    dot1 = sum[0];
+    dot2 = sum[1];
+  }
+
+  /*!
+   * \brief Add an expression to "this" (axpy) and compute the dot product of the result with another vector,
+   *        in a single pass over the vectors.
+   * \param[in] expr - Expression added to "this".
+   * \param[in] other - Vector for the dot product (can be "this").
+   * \return Dot product of the updated vector with "other".
+   */
+  template <class T>
+  ScalarType addAndDot(const VecExpr::CVecExpr<T, ScalarType>& expr, const CSysVector& other) {
+    ScalarType sum[1] = {0.0};
 
-    return dotRes;
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      vec_val[i] += expr.derived()[i];
+      sum[0] += vec_val[i] * other.vec_val[i];
+    }
+    END_CSYSVEC_PARFOR
+
+    /*--- Halo entries, not included in the dot product. ---*/
+    CSYSVEC_PARFOR
+    for (auto i = nElmDomain; i < nElm; ++i) vec_val[i] += expr.derived()[i];
+    END_CSYSVEC_PARFOR
+
+    reduceSums(sum);
+    return sum[0];
+  }
+
+  /*!
+   * \brief Add an expression to "this" and compute the squared L2 norm of the result, in a single pass.
+   * \param[in] expr - Expression added to "this".
+   * \return Squared L2 norm of the updated vector.
+   */
+  template <class T>
+  inline ScalarType addAndSquaredNorm(const VecExpr::CVecExpr<T, ScalarType>& expr) {
+    return addAndDot(expr, *this);
   }
 
   /*!
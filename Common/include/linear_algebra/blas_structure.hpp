@@ -31,6 +31,8 @@
 
 /* LIBXSMM include files, if supported. */
 #ifdef HAVE_LIBXSMM
+#include <array>
+#include <map>
 #include "libxsmm.h"
 #endif
 
@@ -53,6 +55,8 @@ class CBlasStructure {
   /*!
    * \brief Function, which carries out a dense matrix product. It is a
             limited version of the BLAS gemm functionality..
+   * \note With libxsmm the size-specialized (JIT) kernels are dispatched once per (M,N,K) and cached
+            in this object, without external libraries small matrices use register-blocked microkernels.
    * \param[in]  M  - Number of rows of A and C.
    * \param[in]  N  - Number of columns of B and C.
    * \param[in]  K  - Number of columns of A and number of rows of B.
@@ -494,6 +498,12 @@ class CBlasStructure {
   }
 
  private:
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  /*! \brief Cache of the libxsmm kernels, dispatched on first use of each (M,N,K). This object is
+             not shared between threads, hence the cache does not need to be guarded. */
+  std::map<std::array<int, 3>, libxsmm_dmmfunction> xsmmKernels;
+#endif
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || \
     (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   /* Blocking parameters for the outer kernel.  We multiply mc x kc blocks of
@@ -514,6 +524,20 @@ class CBlasStructure {
    */
   void gemm_imp(const int m, const int n, const int k, const su2double* a, const su2double* b, su2double* c);
 
+  /*!
+   * \brief Matrix product for small (row major) matrices, c = a*b, with the columns of c processed in
+            register blocks whose width is chosen from n. Used instead of gemm_imp for the small
+            matrices of the DG solver, whose number of columns is padded to a multiple of 4 or 8.
+   * \param[in]  m  - Number of rows of a and c.
+   * \param[in]  n  - Number of columns of b and c.
+   * \param[in]  k  - Number of columns of a and number of rows of b.
+   * \param[in]  a  - Input matrix in the multiplication.
+   * \param[in]  b  - Input matrix in the multiplication.
+   * \param[out] c  - Result of the matrix product a*b.
+   * \return False if n is not suited for the microkernels, in which case c is not computed.
+   */
+  bool gemm_small(const int m, const int n, const int k, const su2double* a, const su2double* b, su2double* c);
+
   /*!
    * \brief Compute a portion of the c matrix one block at a time.
             Handle ragged edges with calls to a slow but general function.
@@ -119,6 +119,7 @@ const unsigned short COMM_TYPE_DOUBLE         = 4;  /*!< \brief Communication ty
 const unsigned short COMM_TYPE_CHAR           = 5;  /*!< \brief Communication type for char. */
 const unsigned short COMM_TYPE_SHORT          = 6;  /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7;  /*!< \brief Communication type for int. */
+const unsigned short COMM_TYPE_FLOAT          = 8;  /*!< \brief Communication type for float. */
 
 /*!
  * \brief Types of geometric entities based on VTK nomenclature
@@ -339,12 +340,14 @@ enum class INTERFACE_INTERPOLATOR {
   ISOPARAMETRIC,         /*!< \brief Isoparametric interpolation, use CONSERVATIVE_INTERPOLATION=YES for conservative interpolation (S.A. Brown 1997).*/
   WEIGHTED_AVERAGE,      /*!< \brief Sliding Mesh Approach E. Rinaldi 2015 */
   RADIAL_BASIS_FUNCTION, /*!< \brief Radial basis function interpolation. */
+  LOCAL_RADIAL_BASIS_FUNCTION, /*!< \brief Radial basis function interpolation with local systems of nearby donors. */
 };
 static const MapType<std::string, INTERFACE_INTERPOLATOR> Interpolator_Map = {
   MakePair("NEAREST_NEIGHBOR", INTERFACE_INTERPOLATOR::NEAREST_NEIGHBOR)
   MakePair("ISOPARAMETRIC",    INTERFACE_INTERPOLATOR::ISOPARAMETRIC)
   MakePair("WEIGHTED_AVERAGE", INTERFACE_INTERPOLATOR::WEIGHTED_AVERAGE)
   MakePair("RADIAL_BASIS_FUNCTION", INTERFACE_INTERPOLATOR::RADIAL_BASIS_FUNCTION)
+  MakePair("LOCAL_RADIAL_BASIS_FUNCTION", INTERFACE_INTERPOLATOR::LOCAL_RADIAL_BASIS_FUNCTION)
 };
 
 /*!
@@ -1640,6 +1643,20 @@ static const MapType<std::string, STRUCT_2DFORM> ElasForm_2D = {
   MakePair("PLANE_STRAIN", STRUCT_2DFORM::PLANE_STRAIN)
 };
 
+/*!
+ * \brief Renumbering of the points of each rank after partitioning.
+ */
+enum class POINT_ORDERING {
+  NONE,       /*!< \brief Keep the order of the global indices. */
+  RCM,        /*!< \brief Reverse Cuthill-McKee. */
+  HILBERT,    /*!< \brief Hilbert space-filling curve through the coordinates. */
+};
+static const MapType<std::string, POINT_ORDERING> PointOrdering_Map = {
+  MakePair("NONE", POINT_ORDERING::NONE)
+  MakePair("RCM", POINT_ORDERING::RCM)
+  MakePair("HILBERT", POINT_ORDERING::HILBERT)
+};
+
 /*!
  * \brief Kinds of relaxation for multizone problems
  */
@@ -1647,11 +1664,13 @@ enum class BGS_RELAXATION {
   NONE,       /*!< \brief No relaxation in the strongly coupled approach. */
   FIXED,      /*!< \brief Relaxation with a fixed parameter. */
   AITKEN,     /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  QUASI_NEWTON, /*!< \brief Interface quasi-Newton (IQN-ILS) acceleration. */
 };
 static const MapType<std::string, BGS_RELAXATION> AitkenForm_Map = {
   MakePair("NONE", BGS_RELAXATION::NONE)
   MakePair("FIXED_PARAMETER", BGS_RELAXATION::FIXED)
   MakePair("AITKEN_DYNAMIC", BGS_RELAXATION::AITKEN)
+  MakePair("QUASI_NEWTON", BGS_RELAXATION::QUASI_NEWTON)
 };
 
 /*!
@@ -1728,12 +1747,14 @@ enum CHT_COUPLING {
   AVERAGED_TEMPERATURE_NEUMANN_HEATFLUX,
   DIRECT_TEMPERATURE_ROBIN_HEATFLUX,
   AVERAGED_TEMPERATURE_ROBIN_HEATFLUX,
+  IMPLICIT_ROBIN_HEATFLUX,  /*!< \brief Both zones use implicit Robin conditions with the conductance of the other. */
 };
 static const MapType<std::string, CHT_COUPLING> CHT_Coupling_Map = {
   MakePair("DIRECT_TEMPERATURE_NEUMANN_HEATFLUX", CHT_COUPLING::DIRECT_TEMPERATURE_NEUMANN_HEATFLUX)
   MakePair("AVERAGED_TEMPERATURE_NEUMANN_HEATFLUX", CHT_COUPLING::AVERAGED_TEMPERATURE_NEUMANN_HEATFLUX)
   MakePair("DIRECT_TEMPERATURE_ROBIN_HEATFLUX", CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX)
   MakePair("AVERAGED_TEMPERATURE_ROBIN_HEATFLUX", CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)
+  MakePair("IMPLICIT_ROBIN_HEATFLUX", CHT_COUPLING::IMPLICIT_ROBIN_HEATFLUX)
 };
 
 /*!
@@ -2061,10 +2082,12 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 binary input format, read in parallel by linear partitions. */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
+  MakePair("SU2_BINARY", SU2_BINARY)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
@@ -2086,6 +2109,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2095,6 +2119,10 @@ enum class OUTPUT_TYPE {
   SURFACE_CGNS,            /*!< \brief CGNS format. */
   STL_ASCII,               /*!< \brief STL ASCII format for surface solution output. */
   STL_BINARY,              /*!< \brief STL binary format for surface solution output. Not implemented yet. */
+  HDF5,                    /*!< \brief HDF5 file with XDMF descriptor. */
+  SURFACE_HDF5,            /*!< \brief Surface HDF5 file with XDMF descriptor. */
+  CATALYST,                /*!< \brief In-situ processing of the volume data with Catalyst (no file). */
+  SURFACE_STREAM,          /*!< \brief Binary stream of surface values appended at every output (no sorting). */
 };
 static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("TECPLOT_ASCII", OUTPUT_TYPE::TECPLOT_ASCII)
@@ -2111,12 +2139,31 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
   MakePair("SURFACE_CGNS", OUTPUT_TYPE::SURFACE_CGNS)
   MakePair("STL_ASCII", OUTPUT_TYPE::STL_ASCII)
   MakePair("STL_BINARY", OUTPUT_TYPE::STL_BINARY)
+  MakePair("HDF5", OUTPUT_TYPE::HDF5)
+  MakePair("SURFACE_HDF5", OUTPUT_TYPE::SURFACE_HDF5)
+  MakePair("CATALYST", OUTPUT_TYPE::CATALYST)
+  MakePair("SURFACE_STREAM", OUTPUT_TYPE::SURFACE_STREAM)
+};
+
+/*!
+ * \brief Compression of the binary restart files.
+ */
+enum class RESTART_COMPRESSION {
+  NONE,      /*!< \brief Raw doubles. */
+  LOSSLESS,  /*!< \brief Byte shuffle and deflate. */
+  LOSSY,     /*!< \brief Rounding to a tolerance, then byte shuffle and deflate. */
+};
+static const MapType<std::string, RESTART_COMPRESSION> Restart_Compression_Map = {
+  MakePair("NONE", RESTART_COMPRESSION::NONE)
+  MakePair("LOSSLESS", RESTART_COMPRESSION::LOSSLESS)
+  MakePair("LOSSY", RESTART_COMPRESSION::LOSSY)
 };
 
 /*!
@@ -2299,12 +2346,20 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_FGMRES,     /*!< \brief FGMRES with one non-blocking reduction per iteration overlapped with computations. */
+  RECYCLED_FGMRES,      /*!< \brief FGMRES with a subspace (previous solution updates) recycled between solves. */
+  DEVICE_BCGSTAB,       /*!< \brief BCGSTAB with the Jacobi preconditioner on an OpenMP target device. */
+  PETSC,                /*!< \brief Krylov method and preconditioner of PETSc (set with PETSC_OPTIONS). */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("RECYCLED_FGMRES", RECYCLED_FGMRES)
+  MakePair("DEVICE_BCGSTAB", DEVICE_BCGSTAB)
+  MakePair("PETSC", PETSC)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -2364,6 +2419,8 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
+  SA_AMG,         /*!< \brief Smoothed aggregation multigrid with rigid body modes (elasticity). */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2373,6 +2430,8 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
+  MakePair("SA_AMG", SA_AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2446,6 +2505,18 @@ static const MapType<std::string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map =
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Methods to deform the volume mesh given the surface displacements (CVolumetricMovement).
+ */
+enum class DEFORM_METHOD {
+  ELASTICITY,             /*!< \brief Linear elasticity (FEA) equations. */
+  RADIAL_BASIS_FUNCTION,  /*!< \brief Interpolation of the surface displacements with RBF (greedy reduced). */
+};
+static const MapType<std::string, DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("ELASTICITY", DEFORM_METHOD::ELASTICITY)
+  MakePair("RBF", DEFORM_METHOD::RADIAL_BASIS_FUNCTION)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -2686,6 +2757,32 @@ static const MapType<std::string, POD_KIND> POD_Map = {
   MakePair("INCREMENTAL_POD", POD_KIND::INCREMENTAL)
 };
 
+/*!
+ * \brief Projection of the implicit system for the online reduced order model (for use with libROM)
+ */
+enum class ROM_PROJECTION {
+  NONE,              /*!< \brief Full order model. */
+  GALERKIN,          /*!< \brief Galerkin projection on the POD basis. */
+  LSPG,              /*!< \brief Least-squares Petrov-Galerkin projection. */
+};
+static const MapType<std::string, ROM_PROJECTION> ROM_Projection_Map = {
+  MakePair("NONE",     ROM_PROJECTION::NONE)
+  MakePair("GALERKIN", ROM_PROJECTION::GALERKIN)
+  MakePair("LSPG",     ROM_PROJECTION::LSPG)
+};
+
+/*!
+ * \brief Methods to adapt the local CFL numbers.
+ */
+enum class CFL_ADAPT_METHOD {
+  UNDER_RELAXATION, /*!< \brief Global increase/decrease driven by the under-relaxation and linear solver. */
+  LOCAL_RESIDUAL,   /*!< \brief Pseudo-transient continuation driven by the local residual reduction. */
+};
+static const MapType<std::string, CFL_ADAPT_METHOD> CFL_Adapt_Method_Map = {
+  MakePair("UNDER_RELAXATION", CFL_ADAPT_METHOD::UNDER_RELAXATION)
+  MakePair("LOCAL_RESIDUAL", CFL_ADAPT_METHOD::LOCAL_RESIDUAL)
+};
+
 /*!
  * \brief Type of operation for the linear system solver, changes the source of solver options.
  */
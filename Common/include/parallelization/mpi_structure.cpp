@@ -35,6 +35,7 @@ int CBaseMPIWrapper::Size = 1;
 /* Set the default MPI Communicator */
 #ifdef HAVE_MPI
 CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = MPI_COMM_WORLD;
+thread_local CBaseMPIWrapper::Comm CBaseMPIWrapper::threadComm = MPI_COMM_NULL;
 #else
 CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = 0;  // dummy value
 #endif
@@ -34,6 +34,8 @@
 #endif
 
 #include <stdlib.h>
+#include <type_traits>
+#include <vector>
 #include "../basic_types/datatype_structure.hpp"
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -101,6 +103,7 @@ class CBaseMPIWrapper {
  protected:
   static int Rank, Size, MinRankError;
   static Comm currentComm;
+  static thread_local Comm threadComm;
   static bool winMinRankErrorInUse;
   static Win winMinRankError;
 
@@ -125,7 +128,14 @@ class CBaseMPIWrapper {
     winMinRankErrorInUse = true;
   }
 
-  static inline Comm GetComm() { return currentComm; }
+  static inline Comm GetComm() { return threadComm != MPI_COMM_NULL ? threadComm : currentComm; }
+
+  /*!
+   * \brief Make GetComm return a different communicator on the calling thread (MPI_COMM_NULL to reset).
+   * \note Threads that communicate while the main thread is in collectives of its own (e.g. asynchronous
+   *       output) must do so on a duplicate of the current communicator, and need MPI_THREAD_MULTIPLE.
+   */
+  static inline void SetThreadComm(Comm comm) { threadComm = comm; }
 
   static inline void Init(int* argc, char*** argv) {
     MPI_Init(argc, argv);
@@ -173,6 +183,20 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+  }
+
+  static inline void Start(Request* request) { MPI_Start(request); }
+
+  static inline void Startall(int nrequests, Request* request) { MPI_Startall(nrequests, request); }
+
   static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
@@ -208,6 +232,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -376,6 +405,26 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Irecv(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm), request);
   }
 
+  /*--- Persistent requests are not differentiated, the P2P comms fall back to Isend/Irecv. ---*/
+
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not supported with AD.", CURRENT_FUNCTION);
+  }
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {
+    Error("Persistent requests are not supported with AD.", CURRENT_FUNCTION);
+  }
+
+  static inline void Start(Request* request) {
+    Error("Persistent requests are not supported with AD.", CURRENT_FUNCTION);
+  }
+
+  static inline void Startall(int nrequests, Request* request) {
+    Error("Persistent requests are not supported with AD.", CURRENT_FUNCTION);
+  }
+
   static inline void Wait(SU2_MPI::Request* request, Status* status) { AMPI_Wait(request, status); }
 
   static inline int Request_free(Request* request) { return AMPI_Request_free(request); }
@@ -413,6 +462,11 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    AMPI_Iallreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm), request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
@@ -484,6 +538,7 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
 #define MPI_INT 11
 #define MPI_PROD 12
 #define MPI_STATUS_IGNORE nullptr
+#define MPI_STATUSES_IGNORE nullptr
 
 /*!
  * \class CMPIWrapper
@@ -539,6 +594,16 @@ class CBaseMPIWrapper {
 
   static inline void Irecv(void* buf, int count, Datatype datatype, int source, int tag, Comm comm, Request* request) {}
 
+  static inline void Send_init(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Recv_init(void* buf, int count, Datatype datatype, int source, int tag, Comm comm,
+                               Request* request) {}
+
+  static inline void Start(Request* request) {}
+
+  static inline void Startall(int nrequests, Request* request) {}
+
   static inline void Wait(Request* request, Status* status) {}
 
   static inline int Request_free(Request* request) { return 0; }
@@ -562,6 +627,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, count, datatype);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    CopyData(sendbuf, recvbuf, count, datatype);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -612,6 +682,107 @@ typedef CBaseMPIWrapper SU2_MPI;
 
 #endif
 
+/*!
+ * \class CNodeSharedArray
+ * \brief Read-only array of which there is one copy per compute node (instead of one per rank), it is stored in
+ *        an MPI-3 shared memory window of the ranks of the node. Without MPI it is a plain array.
+ * \details Allocate collectively (same size on all ranks), fill the array on the ranks for which IsWriter() is true
+ *          (one per node), and call Publish() (collective) before reading it on any rank.
+ * \note The array must be destroyed before MPI is finalized, T must be a passive (trivially copyable) type.
+ */
+template <class T>
+class CNodeSharedArray {
+  static_assert(std::is_trivially_copyable<T>::value, "Only passive types can be shared between ranks.");
+
+ private:
+  T* ptr = nullptr;
+  size_t nElem = 0;
+  bool writer = true;
+#ifdef HAVE_MPI
+  MPI_Comm nodeComm = MPI_COMM_NULL;
+  MPI_Win win = MPI_WIN_NULL;
+#else
+  std::vector<T> storage;
+#endif
+
+ public:
+  CNodeSharedArray() = default;
+  CNodeSharedArray(const CNodeSharedArray&) = delete;
+  CNodeSharedArray& operator=(const CNodeSharedArray&) = delete;
+  ~CNodeSharedArray() { Free(); }
+
+  /*!
+   * \brief Allocate the array (collective), the previous contents are lost.
+   * \param[in] size - Number of elements.
+   * \param[in] comm - Communicator of the ranks that share the array, it is split by compute node.
+   */
+  void Allocate(size_t size, SU2_Comm comm = SU2_MPI::GetComm()) {
+    Free();
+    nElem = size;
+#ifdef HAVE_MPI
+    int nodeRank = 0;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm);
+    MPI_Comm_rank(nodeComm, &nodeRank);
+    writer = (nodeRank == 0);
+
+    /*--- Only the first rank of the node contributes memory, the others get a pointer to it. ---*/
+    const auto bytes = static_cast<MPI_Aint>(writer ? size * sizeof(T) : 0);
+    MPI_Win_allocate_shared(bytes, sizeof(T), MPI_INFO_NULL, nodeComm, &ptr, &win);
+    MPI_Aint winSize = 0;
+    int dispUnit = 0;
+    MPI_Win_shared_query(win, 0, &winSize, &dispUnit, &ptr);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+#else
+    storage.resize(size);
+    ptr = storage.data();
+#endif
+  }
+
+  /*!
+   * \brief Make the data written by the writer ranks visible to all ranks of their node (collective).
+   */
+  void Publish() {
+#ifdef HAVE_MPI
+    if (win == MPI_WIN_NULL) return;
+    MPI_Win_sync(win);
+    MPI_Barrier(nodeComm);
+    MPI_Win_sync(win);
+#endif
+  }
+
+  /*!
+   * \brief Release the memory (collective).
+   */
+  void Free() {
+#ifdef HAVE_MPI
+    if (win != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(win);
+      MPI_Win_free(&win);
+      MPI_Comm_free(&nodeComm);
+    }
+#else
+    storage.clear();
+#endif
+    ptr = nullptr;
+    nElem = 0;
+    writer = true;
+  }
+
+  /*!
+   * \brief Whether this rank fills the array of its node.
+   */
+  bool IsWriter() const { return writer; }
+
+  /*!
+   * \brief Pointer to fill the array, it is null on the ranks that are not writers.
+   */
+  T* WritableData() { return writer ? ptr : nullptr; }
+
+  size_t size() const { return nElem; }
+  const T* data() const { return ptr; }
+  const T& operator[](size_t i) const { return ptr[i]; }
+};
+
 /*--- Select the appropriate MPI wrapper based on datatype, to use in templated classes. ---*/
 template <class T>
 struct SelectMPIWrapper {
@@ -54,6 +54,28 @@ void omp_finalize() {
 #endif
 }
 
+std::string omp_affinity_report() {
+  const int nThreads = omp_get_max_threads();
+  std::string report = "OpenMP: " + std::to_string(nThreads) + " thread(s) per process";
+#ifdef HAVE_OMP
+  if (nThreads == 1) return report + ".";
+
+  const char* bindNames[] = {"false", "true", "master", "close", "spread"};
+  const auto bind = omp_get_proc_bind();
+  report += ", proc_bind=";
+  report += (bind >= 0 && bind <= 4) ? bindNames[bind] : "unknown";
+  report += ", " + std::to_string(omp_get_num_places()) + " place(s).";
+
+  if (bind == omp_proc_bind_false || omp_get_num_places() == 0) {
+    report += "\nWARNING: The threads are not pinned, set OMP_PROC_BIND and OMP_PLACES (e.g. close and cores)"
+              " for NUMA-local memory accesses.";
+  }
+#else
+  report += ".";
+#endif
+  return report;
+}
+
 #ifdef HAVE_OPDI
 #include "opdi.cpp"
 #endif
@@ -39,6 +39,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 
 #include "../code_config.hpp"
 
@@ -119,6 +120,14 @@ inline void omp_destroy_lock(omp_lock_t*) {}
 void omp_initialize();
 void omp_finalize();
 
+/*!
+ * \brief Describe the number of threads and their affinity (binding policy and places) on this process.
+ * \note Pinning the threads (e.g. OMP_PROC_BIND=close/spread and OMP_PLACES=cores) is required for the first
+ *       touch initialization of the large containers (see parallelFirstTouch) to result in NUMA-local accesses.
+ * \return One line of text, with a warning if the threads are not pinned.
+ */
+std::string omp_affinity_report();
+
 /*--- Detect SIMD support (version 4+, after Jul 2013). ---*/
 #ifdef _OPENMP
 #if _OPENMP >= 201307
@@ -136,6 +145,14 @@ void omp_finalize();
 #define SU2_OMP_SIMD_IF_NOT_AD
 #endif
 
+/*--- Offloading to accelerators with target constructs (version 4.5+, after Nov 2015), opt-in
+ *    at configuration (HAVE_OMP_TARGET) and only for primal builds, AD types cannot be mapped. ---*/
+#if defined(HAVE_OMP_TARGET) && defined(_OPENMP) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+#if _OPENMP >= 201511
+#define SU2_OMP_OFFLOAD
+#endif
+#endif
+
 /*--- Convenience macros (do not use excessive nesting). ---*/
 
 #define SU2_OMP_ATOMIC SU2_OMP(atomic)
@@ -257,6 +274,34 @@ void parallelSet(size_t size, T val, U* dst) {
   END_SU2_OMP_FOR
 }
 
+/*!
+ * \brief Arrays smaller than this (number of elements) are not worth initializing in parallel.
+ */
+constexpr size_t FIRST_TOUCH_MIN_SIZE = 16384;
+
+/*!
+ * \brief Initialize a newly allocated array in parallel, such that its memory pages are first touched (and thus
+ *        placed on the NUMA node of) the threads that will later access them in static loops of the same chunk size.
+ * \note Inside parallel regions, or for small arrays, the initialization is serial.
+ * \param[in] size - Number of elements.
+ * \param[in] chunkSize - Chunk size of the static schedule used to access the array.
+ * \param[in] val - Value to set.
+ * \param[in] dst - Destination array.
+ */
+template <class T, class U>
+void parallelFirstTouch(size_t size, size_t chunkSize, T val, U* dst) {
+  if (size < FIRST_TOUCH_MIN_SIZE || omp_get_max_threads() == 1 || omp_in_parallel()) {
+    for (size_t i = 0; i < size; ++i) dst[i] = val;
+    return;
+  }
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(chunkSize)
+    for (size_t i = 0; i < size; ++i) dst[i] = val;
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
 /*!
  * \brief Atomically update a (shared) lhs value with a (local) rhs value.
  * \note For types without atomic support (non-arithmetic) this is done via critical.
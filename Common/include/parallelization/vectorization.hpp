@@ -42,17 +42,82 @@ namespace simd {
 
 using namespace VecExpr;
 
-/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures. ---*/
+/*--- Detect preferred SIMD size (bytes). This covers x86 and ARM (NEON) architectures. ---*/
 #if defined(__AVX512F__)
 constexpr size_t PREFERRED_SIZE = 64;
 #elif defined(__AVX__)
 constexpr size_t PREFERRED_SIZE = 32;
-#elif defined(__SSE2__)
+#elif defined(__SSE2__) || defined(__ARM_NEON)
 constexpr size_t PREFERRED_SIZE = 16;
 #else
 constexpr size_t PREFERRED_SIZE = 8;
 #endif
 
+/*!
+ * \brief Instruction sets relevant for vectorization, in increasing order of SIMD width (per architecture).
+ */
+enum class ISA { GENERIC, SSE2, NEON, AVX, AVX2, AVX512 };
+
+/*!
+ * \brief Instruction set the calling code was compiled for.
+ */
+constexpr ISA compiledISA() {
+#if defined(__AVX512F__)
+  return ISA::AVX512;
+#elif defined(__AVX2__)
+  return ISA::AVX2;
+#elif defined(__AVX__)
+  return ISA::AVX;
+#elif defined(__ARM_NEON)
+  return ISA::NEON;
+#elif defined(__SSE2__)
+  return ISA::SSE2;
+#else
+  return ISA::GENERIC;
+#endif
+}
+
+/*!
+ * \brief Most capable instruction set supported by the host CPU (queried with CPUID on x86).
+ */
+inline ISA hostISA() {
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  __builtin_cpu_init();
+  /*--- The subset of AVX-512 available on all CPUs since Skylake-SP (x86-64-v4). ---*/
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512vl"))
+    return ISA::AVX512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return ISA::AVX2;
+  if (__builtin_cpu_supports("avx")) return ISA::AVX;
+  if (__builtin_cpu_supports("sse2")) return ISA::SSE2;
+  return ISA::GENERIC;
+#elif defined(__aarch64__)
+  return ISA::NEON;
+#else
+  return compiledISA();
+#endif
+}
+
+/*!
+ * \brief Name of an instruction set.
+ */
+inline const char* isaName(ISA isa) {
+  switch (isa) {
+    case ISA::SSE2:
+      return "SSE2";
+    case ISA::NEON:
+      return "NEON";
+    case ISA::AVX:
+      return "AVX";
+    case ISA::AVX2:
+      return "AVX2";
+    case ISA::AVX512:
+      return "AVX-512";
+    default:
+      return "generic";
+  }
+}
+
 /*!
  * \brief Convert the SIMD size (bytes) to a lenght (num elems).
  */
@@ -186,6 +251,18 @@ class Array : public CVecExpr<Array<Scalar_t, N>, Scalar_t> {
 #undef FOREACH
 };
 
+/*!
+ * \brief Transposed load, x[i][k] = begin[rows[k] * stride + i] for i, k in [0, N).
+ * \note Loads N consecutive values from N rows of a row-major array into N arrays, i.e.
+ * one row per SIMD lane. This is used to gather rows of row-major containers, the
+ * specializations below use vector loads and in-register transposes instead of scalar loads.
+ */
+template <class Scalar, size_t N, class T>
+FORCEINLINE void loadTransposed(const Scalar* begin, const T& rows, size_t stride, Array<Scalar, N>* x) {
+  for (size_t i = 0; i < N; ++i)
+    for (size_t k = 0; k < N; ++k) x[i][k] = begin[rows[k] * stride + i];
+}
+
 /*--- Explicit vectorization specializations, see e.g.
  * https://software.intel.com/sites/landingpage/IntrinsicsGuide/
  * for documentation on the "_mm*" functions. ---*/
@@ -248,6 +325,13 @@ FORCEINLINE __m128d sign_p(__m128d x) { return _mm_or_pd(ones_2d, _mm_and_pd(x,
 
 #include "special_vectorization.hpp"
 
+template <class T>
+FORCEINLINE void loadTransposed(const double* begin, const T& rows, size_t stride, Array<double, 2>* x) {
+  const __m128d r0 = _mm_loadu_pd(begin + rows[0] * stride), r1 = _mm_loadu_pd(begin + rows[1] * stride);
+  x[0] = _mm_unpacklo_pd(r0, r1);
+  x[1] = _mm_unpackhi_pd(r0, r1);
+}
+
 #endif  // __SSE2__
 
 #ifdef __AVX__
@@ -291,6 +375,19 @@ FORCEINLINE __m256d sign_p(__m256d x) { return _mm256_or_pd(ones_4d, _mm256_and_
 
 #include "special_vectorization.hpp"
 
+template <class T>
+FORCEINLINE void loadTransposed(const double* begin, const T& rows, size_t stride, Array<double, 4>* x) {
+  /*--- Transpose 2x2 blocks within each 128-bit lane, then swap the off-diagonal lanes. ---*/
+  const __m256d r0 = _mm256_loadu_pd(begin + rows[0] * stride), r1 = _mm256_loadu_pd(begin + rows[1] * stride);
+  const __m256d r2 = _mm256_loadu_pd(begin + rows[2] * stride), r3 = _mm256_loadu_pd(begin + rows[3] * stride);
+  const __m256d t0 = _mm256_unpacklo_pd(r0, r1), t1 = _mm256_unpackhi_pd(r0, r1);
+  const __m256d t2 = _mm256_unpacklo_pd(r2, r3), t3 = _mm256_unpackhi_pd(r2, r3);
+  x[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+  x[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+  x[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+  x[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+}
+
 #endif  // __AVX__
 
 #ifdef __AVX512F__
@@ -338,6 +435,28 @@ FORCEINLINE __m512d sign_p(__m512d x) { return _mm512_or_pd(ones_8d, _mm512_and_
 
 #include "special_vectorization.hpp"
 
+template <class T>
+FORCEINLINE void loadTransposed(const double* begin, const T& rows, size_t stride, Array<double, 8>* x) {
+  /*--- Transpose 2x2 blocks within each 128-bit lane, then two rounds of lane shuffles. ---*/
+  __m512d t[8];
+  for (int k = 0; k < 8; k += 2) {
+    const __m512d r0 = _mm512_loadu_pd(begin + rows[k] * stride);
+    const __m512d r1 = _mm512_loadu_pd(begin + rows[k + 1] * stride);
+    t[k] = _mm512_unpacklo_pd(r0, r1);
+    t[k + 1] = _mm512_unpackhi_pd(r0, r1);
+  }
+  for (int i = 0; i < 2; ++i) {
+    const __m512d s0 = _mm512_shuffle_f64x2(t[i], t[i + 2], 0x88);
+    const __m512d s1 = _mm512_shuffle_f64x2(t[i + 4], t[i + 6], 0x88);
+    const __m512d s2 = _mm512_shuffle_f64x2(t[i], t[i + 2], 0xDD);
+    const __m512d s3 = _mm512_shuffle_f64x2(t[i + 4], t[i + 6], 0xDD);
+    x[i] = _mm512_shuffle_f64x2(s0, s1, 0x88);
+    x[i + 4] = _mm512_shuffle_f64x2(s0, s1, 0xDD);
+    x[i + 2] = _mm512_shuffle_f64x2(s2, s3, 0x88);
+    x[i + 6] = _mm512_shuffle_f64x2(s2, s3, 0xDD);
+  }
+}
+
 #endif  // __AVX512F__
 
 #undef ARRAY_BOILERPLATE
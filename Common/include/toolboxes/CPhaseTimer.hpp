@@ -0,0 +1,96 @@
+/*!
+ * \file CPhaseTimer.hpp
+ * \brief Hierarchical timer of program phases, with a report of the timings
+ *        over the MPI ranks and of the memory high-water mark.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../parallelization/mpi_structure.hpp"
+
+/*!
+ * \class CPhaseTimer
+ * \ingroup Toolboxes
+ * \brief Wall clock timer of nested program phases (e.g. the steps of the preprocessing). The report lists the
+ *        minimum, average, and maximum time of each phase over the ranks, and the largest memory high-water mark
+ *        (resident set size) of the ranks at the end of the phase.
+ * \note All ranks must start and stop the same phases in the same order, the inner phases are stopped before
+ *       the outer ones.
+ */
+class CPhaseTimer {
+ private:
+  struct Phase {
+    std::string name;       /*!< \brief Name of the phase, indented by its depth. */
+    su2double time = 0.0;   /*!< \brief Elapsed time of the phase (start time while it runs). */
+    su2double memory = 0.0; /*!< \brief Memory high-water mark at the end of the phase, in MB. */
+  };
+  std::vector<Phase> phases;   /*!< \brief Phases in the order they were started. */
+  std::vector<size_t> running; /*!< \brief Stack of the phases that were started but not stopped. */
+
+ public:
+  /*!
+   * \brief Memory high-water mark of the calling process in MB (0 if not available on the platform).
+   */
+  static passivedouble MemoryHighWaterMark();
+
+  /*!
+   * \brief Start a phase, it is nested in the phases that are running.
+   * \param[in] name - Name of the phase.
+   */
+  void Start(const std::string& name) {
+    Phase phase;
+    phase.name = std::string(2 * running.size(), ' ') + name;
+    phase.time = SU2_MPI::Wtime();
+    running.push_back(phases.size());
+    phases.push_back(phase);
+  }
+
+  /*!
+   * \brief Stop the innermost running phase.
+   */
+  void Stop() {
+    auto& phase = phases[running.back()];
+    running.pop_back();
+    phase.time = SU2_MPI::Wtime() - phase.time;
+    phase.memory = MemoryHighWaterMark();
+  }
+
+  /*!
+   * \brief Discard all phases.
+   */
+  void Clear() {
+    phases.clear();
+    running.clear();
+  }
+
+  /*!
+   * \brief Reduce the timings over the ranks and print them on the master rank.
+   * \note Collective operation, the phases that are still running are not reported.
+   * \param[in] title - Title of the report.
+   */
+  void Report(const std::string& title) const;
+};
@@ -0,0 +1,287 @@
+/*!
+ * \file CQuasiNewtonInvLeastSquaresQR.hpp
+ * \brief Implements the IQN-ILS method with a QR decomposition of the least
+ * squares problem, filtering of (almost) linearly dependent columns, and
+ * reuse of the history of previous time steps. Intended for the acceleration
+ * of partitioned (e.g. fluid-structure) coupling iterations.
+ * \note See DOI 10.1007/s11831-013-9085-5 and references therein.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "../parallelization/omp_structure.hpp"
+#include "../parallelization/mpi_structure.hpp"
+#include "../containers/C2DContainer.hpp"
+
+/*!
+ * \brief A quasi-Newton fixed-point (FP) accelerator based on IQN-ILS, for interface problems.
+ * \note Unlike CQuasiNewtonInvLeastSquares, the history is stored as differences of
+ * residuals (V) and of FP results (W), which allows keeping the columns of previous time
+ * steps (the FP changes little from one step to the next), and the LS problem is solved
+ * via a QR decomposition (Gram-Schmidt, with re-orthogonalization) that discards columns
+ * that are almost linearly dependent on newer ones. The problems are expected to be small
+ * (e.g. interface displacements), the number of MPI reductions scales with the number of columns.
+ * Usage: Allocate, at the start of each time step call "newTimeStep", store the input of the
+ * FP (operator (i,j)) and its result ("FPresult"), compute the new input, run the FP, etc.
+ * \ingroup BLAS
+ */
+template <class Scalar_t, bool WithMPI = true>
+class CQuasiNewtonInvLeastSquaresQR {
+ public:
+  using Scalar = Scalar_t;
+  using Index = typename su2matrix<Scalar>::Index;
+  static_assert(std::is_floating_point<Scalar>::value, "");
+
+ private:
+  using MPI_Wrapper = typename SelectMPIWrapper<Scalar>::W;
+
+  std::vector<su2matrix<Scalar> > V, W; /*!< \brief Differences of residuals and of FP results, oldest first. */
+  std::vector<unsigned long> colStep;   /*!< \brief Time step in which each column was created. */
+  std::vector<su2matrix<Scalar> > Q;    /*!< \brief Orthonormal basis of the accepted columns of V. */
+  su2matrix<Scalar> X, work;            /*!< \brief Input of the FP (and new solution), and FP result. */
+  su2matrix<Scalar> res, resOld, workOld; /*!< \brief Residuals and FP result of the previous iteration. */
+  bool hasOld = false;                  /*!< \brief Whether there is a previous iteration in this time step. */
+  unsigned long timeStep = 0;           /*!< \brief Time step counter. */
+  Index nPtDomain = 0;                  /*!< \brief Local size of the history, considered in dot products. */
+  Index maxColumns = 0;                 /*!< \brief Maximum number of columns of the history. */
+  unsigned long reuseSteps = 0;         /*!< \brief Number of previous time steps whose columns are kept. */
+  Scalar filterTol = 0;                 /*!< \brief Relative tolerance of the QR filter. */
+  Scalar omega = 1;                     /*!< \brief Relaxation used when there is no history. */
+
+  /*!
+   * \brief Dot products of b with each vector in a, reduced over MPI.
+   */
+  void dotProducts(const std::vector<const Scalar*>& a, const Scalar* b, std::vector<Scalar>& dots) const {
+    const auto end = std::min<Index>(nPtDomain, work.rows()) * work.cols();
+
+    std::vector<Scalar> local(a.size(), Scalar(0));
+    for (size_t j = 0; j < a.size(); ++j) {
+      Scalar sum = 0;
+      SU2_OMP_SIMD
+      for (Index k = 0; k < end; ++k) sum += a[j][k] * b[k];
+      local[j] = sum;
+    }
+    dots.resize(a.size());
+    if (WithMPI) {
+      const auto type = (sizeof(Scalar) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      MPI_Wrapper::Allreduce(local.data(), dots.data(), a.size(), type, MPI_SUM, SU2_MPI::GetComm());
+    } else {
+      dots = std::move(local);
+    }
+  }
+
+  /*!
+   * \brief Remove the columns of the history for which "discard" is true.
+   */
+  template <class F>
+  void removeColumns(const F& discard) {
+    Index n = 0;
+    for (Index i = 0; i < V.size(); ++i) {
+      if (discard(i)) continue;
+      if (n != i) {
+        std::swap(V[n], V[i]);
+        std::swap(W[n], W[i]);
+        colStep[n] = colStep[i];
+      }
+      ++n;
+    }
+    V.resize(n);
+    W.resize(n);
+    colStep.resize(n);
+  }
+
+ public:
+  /*! \brief Default construction without allocation. */
+  CQuasiNewtonInvLeastSquaresQR() = default;
+
+  /*!
+   * \brief Resize the object (discards all history).
+   * \param[in] npt - Size of the solution including any halos.
+   * \param[in] nvar - Number of solution variables.
+   * \param[in] nptdomain - Local size (<= npt) considered in dot products.
+   * \param[in] maxcols - Maximum number of columns of the history.
+   * \param[in] reuse - Number of previous time steps whose history is reused.
+   * \param[in] tol - Relative tolerance below which columns are filtered.
+   * \param[in] relax - Relaxation factor used when there is no history.
+   */
+  void resize(Index npt, Index nvar, Index nptdomain, Index maxcols, unsigned long reuse, Scalar tol, Scalar relax) {
+    if (nptdomain > npt || maxcols < 1) SU2_MPI::Error("Invalid quasi-Newton parameters", CURRENT_FUNCTION);
+    nPtDomain = nptdomain;
+    maxColumns = maxcols;
+    reuseSteps = reuse;
+    filterTol = tol;
+    omega = relax;
+    X.resize(npt, nvar) = Scalar(0);
+    work.resize(npt, nvar) = Scalar(0);
+    res.resize(npt, nvar);
+    resOld.resize(npt, nvar);
+    workOld.resize(npt, nvar);
+    V.clear();
+    W.clear();
+    Q.clear();
+    colStep.clear();
+    hasOld = false;
+  }
+
+  /*! \brief Number of columns in the history. */
+  Index size() const { return V.size(); }
+
+  /*!
+   * \brief Start a new time step, the columns of older time steps than the reuse limit are discarded.
+   */
+  void newTimeStep() {
+    ++timeStep;
+    hasOld = false;
+    removeColumns([this](Index i) { return colStep[i] + reuseSteps < timeStep; });
+  }
+
+  /*!
+   * \brief Access the current fixed-point result.
+   * \note Use these to STORE the result of running the FP.
+   */
+  su2matrix<Scalar>& FPresult() { return work; }
+  const su2matrix<Scalar>& FPresult() const { return work; }
+  Scalar& FPresult(Index iPt, Index iVar) { return work(iPt, iVar); }
+  const Scalar& FPresult(Index iPt, Index iVar) const { return work(iPt, iVar); }
+
+  /*!
+   * \brief Access the current solution approximation.
+   * \note Use these to STORE the input of the FP and, after calling compute, to GET the new estimate.
+   */
+  su2matrix<Scalar>& solution() { return X; }
+  const su2matrix<Scalar>& solution() const { return X; }
+  Scalar& operator()(Index iPt, Index iVar) { return X(iPt, iVar); }
+  const Scalar& operator()(Index iPt, Index iVar) const { return X(iPt, iVar); }
+
+  /*!
+   * \brief Compute and return a new approximation.
+   * \note To be used after storing the FP input and result.
+   */
+  const su2matrix<Scalar>& compute() {
+    const Index n = work.size();
+
+    /*--- Compute the FP residual and add the differences w.r.t. the previous iteration to the history. ---*/
+    SU2_OMP_SIMD
+    for (Index i = 0; i < n; ++i) res.data()[i] = work.data()[i] - X.data()[i];
+
+    if (hasOld) {
+      if (V.size() == maxColumns) removeColumns([](Index i) { return i == 0; });
+      V.emplace_back(X.rows(), X.cols());
+      W.emplace_back(X.rows(), X.cols());
+      colStep.push_back(timeStep);
+      auto v = V.back().data();
+      auto w = W.back().data();
+      SU2_OMP_SIMD
+      for (Index i = 0; i < n; ++i) {
+        v[i] = res.data()[i] - resOld.data()[i];
+        w[i] = work.data()[i] - workOld.data()[i];
+      }
+    }
+    std::swap(res, resOld);
+    workOld = work;
+    hasOld = true;
+    const auto& r = resOld;
+
+    /*--- Without history, relax the FP result. ---*/
+    if (V.empty()) {
+      SU2_OMP_SIMD
+      for (Index i = 0; i < n; ++i) X.data()[i] += omega * r.data()[i];
+      return solution();
+    }
+
+    /*--- QR decomposition of V, from the newest to the oldest column, such that
+     * columns that are (almost) linearly dependent on newer ones are discarded. ---*/
+    Q.resize(V.size());
+    std::vector<Index> accepted;
+    std::vector<std::vector<Scalar> > R;
+    std::vector<bool> discard(V.size(), false);
+    std::vector<const Scalar*> basis;
+    std::vector<Scalar> dots, coeffs;
+
+    for (Index iCol = V.size(); iCol-- > 0;) {
+      auto& q = Q[accepted.size()];
+      q = V[iCol];
+
+      /*--- Classic Gram-Schmidt with one re-orthogonalization, the norm of the original column is
+       * computed together with the first projection. ---*/
+      coeffs.assign(accepted.size(), Scalar(0));
+      Scalar norm0 = 0;
+      for (int pass = 0; pass < 2; ++pass) {
+        basis.clear();
+        for (Index j = 0; j < accepted.size(); ++j) basis.push_back(Q[j].data());
+        if (pass == 0) basis.push_back(V[iCol].data());
+        dotProducts(basis, q.data(), dots);
+        if (pass == 0) norm0 = sqrt(dots.back());
+
+        for (Index j = 0; j < accepted.size(); ++j) {
+          coeffs[j] += dots[j];
+          const auto qj = Q[j].data();
+          SU2_OMP_SIMD
+          for (Index i = 0; i < n; ++i) q.data()[i] -= dots[j] * qj[i];
+        }
+      }
+      dotProducts({q.data()}, q.data(), dots);
+      const Scalar norm = sqrt(dots[0]);
+
+      if (norm <= filterTol * norm0) {
+        discard[iCol] = true;
+        continue;
+      }
+      SU2_OMP_SIMD
+      for (Index i = 0; i < n; ++i) q.data()[i] /= norm;
+      coeffs.push_back(norm);
+      R.push_back(coeffs);
+      accepted.push_back(iCol);
+    }
+    Q.resize(accepted.size());
+
+    /*--- Solve R c = -Q^T r by back substitution, R(i,j) is R[j][i]. ---*/
+    basis.clear();
+    for (const auto& q : Q) basis.push_back(q.data());
+    dotProducts(basis, r.data(), dots);
+
+    const Index m = accepted.size();
+    std::vector<Scalar> c(m);
+    for (Index i = m; i-- > 0;) {
+      Scalar sum = -dots[i];
+      for (Index j = i + 1; j < m; ++j) sum -= R[j][i] * c[j];
+      c[i] = sum / R[i][i];
+    }
+
+    /*--- New solution x = FP result + W c. ---*/
+    X = work;
+    for (Index j = 0; j < m; ++j) {
+      const auto w = W[accepted[j]].data();
+      SU2_OMP_SIMD
+      for (Index i = 0; i < n; ++i) X.data()[i] += c[j] * w[i];
+    }
+
+    removeColumns([&discard](Index i) { return discard[i]; });
+
+    return solution();
+  }
+};
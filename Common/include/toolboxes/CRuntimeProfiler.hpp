@@ -0,0 +1,153 @@
+/*!
+ * \file CRuntimeProfiler.hpp
+ * \brief Lightweight profiler of the main phases of the solver iterations.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+/*!
+ * \class CRuntimeProfiler
+ * \ingroup Toolboxes
+ * \brief Accumulates the wall clock time and number of calls of the main phases of the iterations (enabled with
+ *        RUNTIME_PROFILING). The summary (min/avg/max over the ranks) is written at the end of the run.
+ * \note The phases are timed by the first thread of each rank, i.e. the times include the waits for the other
+ *       threads. Phases of different kinds can be nested (e.g. communications in the gradients, or the
+ *       preconditioner in the linear solver), the times are inclusive. Phases of the same kind cannot be nested.
+ * \note When SU2 is built with hardware counter support (meson option hardware-counters) and HARDWARE_COUNTERS
+ *       is set, the phases are also marker regions of LIKWID or PAPI, started and stopped by all threads.
+ */
+class CRuntimeProfiler {
+ public:
+  /*!
+   * \brief Profiled phases.
+   */
+  enum class SECTION : unsigned short {
+    FLUID_MODEL,         /*!< \brief Update of the primitive variables (fluid model, e.g. MLP evaluation). */
+    GRADIENTS,           /*!< \brief Gradients of the primitive or solution variables. */
+    LIMITERS,            /*!< \brief Slope limiters. */
+    CONVECTIVE_RESIDUAL, /*!< \brief Edge loops of the convective fluxes (with their Jacobians). */
+    VISCOUS_RESIDUAL,    /*!< \brief Viscous residuals (when separate from the convective loop). */
+    SOURCE_RESIDUAL,     /*!< \brief Source terms. */
+    BOUNDARY_CONDITIONS, /*!< \brief Boundary conditions. */
+    IMPLICIT_SETUP,      /*!< \brief Time step terms of the Jacobian and right hand side of the linear system. */
+    PRECONDITIONER,      /*!< \brief Build of the preconditioner of the linear solver. */
+    SPMV,                /*!< \brief Sparse matrix-vector products. */
+    ILU,                 /*!< \brief Application of the ILU preconditioner (forward and backward substitution). */
+    LINEAR_SOLVER,       /*!< \brief Linear solver (including the preconditioner build). */
+    COMMUNICATION,       /*!< \brief Completion of the halo communications (mostly waiting). */
+    OUTPUT,              /*!< \brief History, screen, and file output. */
+  };
+  static constexpr unsigned short nSections = static_cast<unsigned short>(SECTION::OUTPUT) + 1;
+
+  /*!
+   * \brief Scope guard that times a section from its construction to its destruction.
+   */
+  class CScope {
+   private:
+    const SECTION section;
+
+   public:
+    explicit CScope(SECTION s) : section(s) { Begin(section); }
+    ~CScope() { End(section); }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+  };
+
+ private:
+  static bool enabled;                        /*!< \brief Whether the sections are timed. */
+  static bool counters;                       /*!< \brief Whether the sections are hardware counter regions. */
+  static passivedouble startTime[nSections];  /*!< \brief Start time of the running sections. */
+  static passivedouble totalTime[nSections];  /*!< \brief Accumulated time of each section. */
+  static unsigned long numCalls[nSections];   /*!< \brief Number of times each section ran. */
+
+  static inline unsigned short Index(SECTION section) { return static_cast<unsigned short>(section); }
+
+  /*!
+   * \brief Start and stop the hardware counter region of a section (on the calling thread).
+   */
+  static void CountersBegin(SECTION section);
+  static void CountersEnd(SECTION section);
+
+ public:
+  /*!
+   * \brief Enable or disable the profiler, and reset the accumulated times.
+   * \param[in] enable - Whether to time the sections.
+   */
+  static void Enable(bool enable);
+
+  /*!
+   * \brief Whether the profiler is enabled.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Initialize the hardware counter regions (LIKWID or PAPI), the profiler must be enabled.
+   * \note Call outside of parallel regions, it is an error if SU2 was built without hardware counter support.
+   */
+  static void EnableHardwareCounters();
+
+  /*!
+   * \brief Name of a section (used for the history fields and in the summary).
+   */
+  static const char* Name(SECTION section);
+
+  /*!
+   * \brief Start timing a section.
+   */
+  static inline void Begin(SECTION section) {
+    if (!enabled) return;
+    if (counters) CountersBegin(section);
+    if (omp_get_thread_num() == 0) startTime[Index(section)] = SU2_MPI::Wtime();
+  }
+
+  /*!
+   * \brief Stop timing a section and accumulate its time.
+   */
+  static inline void End(SECTION section) {
+    if (!enabled) return;
+    if (omp_get_thread_num() == 0) {
+      totalTime[Index(section)] += SU2_MPI::Wtime() - startTime[Index(section)];
+      ++numCalls[Index(section)];
+    }
+    if (counters) CountersEnd(section);
+  }
+
+  /*!
+   * \brief Accumulated time of a section on this rank.
+   */
+  static inline passivedouble GetTime(SECTION section) { return totalTime[Index(section)]; }
+
+  /*!
+   * \brief Reduce the times over the ranks and write the summary, as CSV and JSON, on the master rank.
+   * \note Collective operation, it also finalizes the hardware counters (with LIKWID the event counts of each
+   *       section, summed over the threads and ranks, are included in the JSON file).
+   * \param[in] fileName - Name of the files without extension.
+   */
+  static void WriteSummary(const std::string& fileName);
+};
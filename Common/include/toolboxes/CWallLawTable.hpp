@@ -0,0 +1,131 @@
+/*!
+ * \file CWallLawTable.hpp
+ * \brief Tabulated inverse of the laws of the wall used by the wall functions and wall models.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "../basic_types/datatype_structure.hpp"
+
+/*!
+ * \class CWallLawTable
+ * \brief Inverse of a law of the wall, u+ as a function of Re_y = u+ y+ = U y / nu.
+ * \details Since Re_y only depends on the data at the exchange point, the friction velocity follows directly
+ *          as u_tau = U / u+, without the Newton iterations on u_tau. The table is uniform in log(Re_y) with linear
+ *          interpolation, below the table the viscous sublayer (u+ = y+) is used, above it the table is extrapolated
+ *          linearly in log(Re_y) (log layer). The table is passive, the derivatives w.r.t. the constants of the law
+ *          are not propagated.
+ * \ingroup LookUpInterp
+ */
+class CWallLawTable {
+ private:
+  passivedouble logReMin = 0.0;    /*!< \brief Log of the smallest Re_y of the table. */
+  passivedouble dLogRe = 1.0;      /*!< \brief Spacing of the table in log(Re_y). */
+  std::vector<passivedouble> uPlus; /*!< \brief Tabulated u+. */
+
+ public:
+  /*!
+   * \brief Tabulate the inverse of a law given by samples of y+ and u+, Re_y must increase with the samples.
+   * \param[in] yPlusSamples - Values of y+.
+   * \param[in] uPlusSamples - Corresponding values of u+.
+   * \param[in] nTable - Size of the table.
+   */
+  void Initialize(const std::vector<passivedouble>& yPlusSamples, const std::vector<passivedouble>& uPlusSamples,
+                  unsigned long nTable = 4096) {
+    const auto nSamples = yPlusSamples.size();
+    std::vector<passivedouble> logRe(nSamples);
+    for (auto i = 0ul; i < nSamples; ++i) logRe[i] = std::log(yPlusSamples[i] * uPlusSamples[i]);
+
+    logReMin = logRe.front();
+    dLogRe = (logRe.back() - logReMin) / (nTable - 1);
+    uPlus.resize(nTable);
+
+    for (auto i = 0ul, k = 0ul; i < nTable; ++i) {
+      const passivedouble x = logReMin + i * dLogRe;
+      while (k + 2 < nSamples && logRe[k + 1] < x) ++k;
+      const passivedouble w = std::min(std::max((x - logRe[k]) / (logRe[k + 1] - logRe[k]), 0.0), 1.0);
+      uPlus[i] = (1 - w) * uPlusSamples[k] + w * uPlusSamples[k + 1];
+    }
+  }
+
+  /*!
+   * \brief Spalding's law, y+ = u+ + exp(-kappa B) (exp(kappa u+) - 1 - kappa u+ - (kappa u+)^2/2 - (kappa u+)^3/6).
+   * \param[in] kappa - von Karman constant.
+   * \param[in] B - Constant of the log law.
+   */
+  void InitializeSpalding(passivedouble kappa, passivedouble B) {
+    /*--- u+ sampled geometrically up to y+ ~ 1e8. ---*/
+    const unsigned long nSamples = 1 << 15;
+    const passivedouble uMin = 1e-3, uMax = (std::log(1e8) + kappa * B) / kappa;
+    std::vector<passivedouble> yp(nSamples), up(nSamples);
+
+    for (auto i = 0ul; i < nSamples; ++i) {
+      up[i] = uMin * std::pow(uMax / uMin, passivedouble(i) / (nSamples - 1));
+      const passivedouble kUp = kappa * up[i];
+      yp[i] = up[i] + std::exp(-kappa * B) * (std::exp(kUp) - 1 - kUp - 0.5 * kUp * kUp - kUp * kUp * kUp / 6);
+    }
+    Initialize(yp, up);
+  }
+
+  /*!
+   * \brief Reichardt's law, u+ = (C - log(kappa)/kappa) (1 - exp(-y+/11) - y+/11 exp(-0.33 y+)) +
+   *        log(1 + kappa y+) / kappa.
+   * \param[in] kappa - von Karman constant.
+   * \param[in] C - Constant to match the profile.
+   */
+  void InitializeReichardt(passivedouble kappa, passivedouble C) {
+    /*--- y+ sampled geometrically up to 1e8. ---*/
+    const unsigned long nSamples = 1 << 15;
+    const passivedouble yMin = 1e-3, yMax = 1e8;
+    std::vector<passivedouble> yp(nSamples), up(nSamples);
+
+    for (auto i = 0ul; i < nSamples; ++i) {
+      yp[i] = yMin * std::pow(yMax / yMin, passivedouble(i) / (nSamples - 1));
+      up[i] = (C - std::log(kappa) / kappa) * (1 - std::exp(-yp[i] / 11) - yp[i] / 11 * std::exp(-0.33 * yp[i])) +
+              std::log(1 + kappa * yp[i]) / kappa;
+    }
+    Initialize(yp, up);
+  }
+
+  /*!
+   * \brief Check if the table was initialized.
+   */
+  bool empty() const { return uPlus.empty(); }
+
+  /*!
+   * \brief Get u+ for a given Re_y = U y / nu.
+   * \param[in] Re - Reynolds number based on the velocity and distance of the exchange point, Re > 0.
+   * \return u+, the friction velocity is U / u+ and y+ = Re / u+.
+   */
+  su2double GetUPlus(const su2double& Re) const {
+    const su2double x = (log(Re) - logReMin) / dLogRe;
+    if (x <= 0) return sqrt(Re);
+    const auto i = std::min(static_cast<unsigned long>(SU2_TYPE::GetValue(x)), uPlus.size() - 2);
+    const su2double w = x - i;
+    return (1 - w) * uPlus[i] + w * uPlus[i + 1];
+  }
+};
@@ -0,0 +1,100 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Compression of blocks of floating point data (used by the binary restart files).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include "../basic_types/datatype_structure.hpp"
+
+/*!
+ * \namespace CompressionToolbox
+ * \brief Lossless (byte shuffle + deflate) and error-bounded lossy compression of blocks of doubles.
+ * \note Compressed SU2 binary restart files keep the usual header (5 ints and the field names), with
+ *       the 4th int set to RestartFormat and the 5th to the number of blocks. The header is followed by a
+ *       table with RestartTableEntry(nFields) 64-bit integers per block, [first point, number of points,
+ *       compressed size of each field], and then by the compressed fields of each block, in order.
+ *       The blocks never cross the partitions of the writer, but any partition can read them.
+ */
+namespace CompressionToolbox {
+
+constexpr int RestartFormat = 1;                    /*!< \brief Format ID of compressed restart files. */
+constexpr unsigned long RestartBlockSize = 16384;   /*!< \brief Maximum number of points per block. */
+
+/*!
+ * \brief Number of integers per block in the table of a compressed restart file.
+ */
+inline unsigned long RestartTableEntry(unsigned long nFields) { return 2 + nFields; }
+
+/*!
+ * \brief Whether SU2 was built with compression support (zlib).
+ */
+bool Available();
+
+/*!
+ * \brief Round the values to the fewest mantissa bits that keep the error below a tolerance.
+ * \note This makes the data more compressible, the result is stored and read as normal doubles.
+ * \param[in,out] values - The values.
+ * \param[in] n - Number of values.
+ * \param[in] tolerance - Maximum absolute error.
+ */
+void Quantize(passivedouble* values, unsigned long n, passivedouble tolerance);
+
+/*!
+ * \brief Group the bytes of the values by significance, byte b of value i goes to position b * n + i.
+ * \note The sign and exponent bytes of similar values are repetitive, which helps the compression.
+ * \param[in] values - The values.
+ * \param[in] n - Number of values.
+ * \param[out] bytes - The shuffled bytes (n * sizeof(passivedouble)).
+ */
+void Shuffle(const passivedouble* values, unsigned long n, unsigned char* bytes);
+
+/*!
+ * \brief Inverse of Shuffle.
+ * \param[in] bytes - The shuffled bytes (n * sizeof(passivedouble)).
+ * \param[in] n - Number of values.
+ * \param[out] values - The values.
+ */
+void Unshuffle(const unsigned char* bytes, unsigned long n, passivedouble* values);
+
+/*!
+ * \brief Compress values (the bytes are shuffled by significance before deflating them).
+ * \param[in] values - The values.
+ * \param[in] n - Number of values.
+ * \param[in,out] out - The compressed data is appended to this buffer.
+ * \return Size of the compressed data in bytes.
+ */
+unsigned long Compress(const passivedouble* values, unsigned long n, std::vector<char>& out);
+
+/*!
+ * \brief Decompress values compressed by Compress.
+ * \param[in] in - The compressed data.
+ * \param[in] nBytes - Size of the compressed data.
+ * \param[out] values - The values.
+ * \param[in] n - Number of values.
+ */
+void Decompress(const char* in, unsigned long nBytes, passivedouble* values, unsigned long n);
+
+}  // namespace CompressionToolbox
@@ -335,6 +335,7 @@ using CEdgeToNonZeroMap = C2DContainer<unsigned long, Index_t, StorageType::RowM
 
 using CCompressedSparsePatternUL = CCompressedSparsePattern<unsigned long>;
 using CCompressedSparsePatternL = CCompressedSparsePattern<long>;
+using CCompressedSparsePatternLocal = CCompressedSparsePattern<su2localindex>;
 using CEdgeToNonZeroMapUL = CEdgeToNonZeroMap<unsigned long>;
 
 /*!
@@ -482,11 +483,16 @@ T createNaturalColoring(Index_t numInnerIndexes) {
  * \param[in] balanceColors - Try to balance number of indexes per color,
  *            tends to result in worse locality (thus false by default).
  * \param[out] indexColor - Optional, vector with colors given to the outer indices.
+ * \param[in] largestFirst - Color the groups in order of decreasing degree (the number of times their inner
+ *            indices appear in the pattern) instead of the natural order. The hardest groups are placed while
+ *            there are few colors, which tends to reduce the number of colors on poorly ordered patterns.
+ *            Within each color the outer indices remain in ascending order (same locality).
  * \return Coloring in the same type of the input pattern.
  */
 template <typename Color_t = unsigned char, size_t MaxColors = 255, size_t MaxMB = 128, class T>
 T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors = false,
-                     std::vector<Color_t>* indexColor = nullptr) {
+                     typename std::common_type<std::vector<Color_t> >::type* indexColor = nullptr,
+                     bool largestFirst = false) {
   static_assert(std::is_integral<Color_t>::value, "");
   static_assert(std::numeric_limits<Color_t>::max() >= MaxColors, "");
 
@@ -496,7 +502,7 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
   const Index_t nOuter = pattern.getOuterSize();
 
   /*--- Trivial case. ---*/
-  if (groupSize >= nOuter) return createNaturalColoring(nOuter);
+  if (groupSize >= nOuter) return createNaturalColoring<T>(nOuter);
 
   const Index_t minIdx = pattern.getMinInnerIdx();
   const Index_t nInner = pattern.getMaxInnerIdx() + 1 - minIdx;
@@ -522,7 +528,27 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
     auto outerPtr = pattern.outerPtr();
     auto innerIdx = pattern.innerIdx();
 
-    for (Index_t iOuter = 0; iOuter < nOuter; iOuter += grpSz) {
+    /*--- Order in which the groups are colored (their first outer index). ---*/
+    const Index_t nGroup = (nOuter + grpSz - 1) / grpSz;
+    std::vector<Index_t> groupOrder(nGroup);
+    for (Index_t iGroup = 0; iGroup < nGroup; ++iGroup) groupOrder[iGroup] = iGroup * grpSz;
+
+    if (largestFirst) {
+      std::vector<Index_t> innerDegree(nInner, 0);
+      for (Index_t k = 0; k < outerPtr[nOuter]; ++k) ++innerDegree[innerIdx[k] - minIdx];
+
+      std::vector<size_t> groupDegree(nGroup, 0);
+      for (Index_t iGroup = 0; iGroup < nGroup; ++iGroup) {
+        const Index_t iOuter = groupOrder[iGroup], grpEnd = std::min(iOuter + grpSz, nOuter);
+        for (Index_t k = outerPtr[iOuter]; k < outerPtr[grpEnd]; ++k)
+          groupDegree[iGroup] += innerDegree[innerIdx[k] - minIdx];
+      }
+      std::stable_sort(groupOrder.begin(), groupOrder.end(), [&](Index_t a, Index_t b) {
+        return groupDegree[a / grpSz] > groupDegree[b / grpSz];
+      });
+    }
+
+    for (const Index_t iOuter : groupOrder) {
       Index_t grpEnd = std::min(iOuter + grpSz, nOuter);
 
       searchOrder.resize(nColor);
@@ -29,6 +29,7 @@
 
 #include "./parallelization/mpi_structure.hpp"
 #include "./CConfig.hpp"
+#include "./toolboxes/CWallLawTable.hpp"
 
 #include <iostream>
 #include <cmath>
@@ -178,6 +179,7 @@ class CWallModelLogLaw : public CWallModel {
 
  private:
   su2double C; /*!< \brief Constant to match the Reichardt BL profile. */
+  CWallLawTable table; /*!< \brief Inverse of the Reichardt profile (WALLMODEL_TABLE), replaces the Newton method. */
 
   /*!
    * \brief Default constructor of the class, disabled.
@@ -33,9 +33,11 @@
 
 #include "../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../include/fem/fem_geometry_structure.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/parallelization/vectorization.hpp"
 
 using namespace PrintingToolbox;
 
@@ -695,6 +697,7 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
 
       break;
     }
+    case SU2_BINARY:
     case RECTANGLE: {
       nZone = 1;
       break;
@@ -805,6 +808,10 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
 
       break;
     }
+    case SU2_BINARY: {
+      nDim = CSU2BinaryMeshReaderFVM::ReadDimension(val_mesh_filename);
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -973,6 +980,8 @@ void CConfig::SetPointersNull() {
   MG_CorrecSmooth           = nullptr;
   MG_PreSmooth              = nullptr;
   MG_PostSmooth             = nullptr;
+  FullMG_Iter               = nullptr;
+  FullMG_CFL                = nullptr;
   Int_Coeffs                = nullptr;
 
   Kind_Inc_Inlet = nullptr;
@@ -1051,6 +1060,13 @@ void CConfig::SetPointersNull() {
   ScreenOutput = nullptr;
   HistoryOutput = nullptr;
   VolumeOutput = nullptr;
+  Catalyst_Scripts = nullptr;
+  Petsc_Options = nullptr;
+  Spectral_Probes = nullptr;
+  Ensemble_Configs = nullptr;
+  Catalyst_Fields = nullptr;
+  Surface_Stream_Markers = nullptr;
+  Surface_Stream_Fields = nullptr;
   VolumeOutputFiles = nullptr;
   VolumeOutputFrequencies = nullptr;
   ConvField = nullptr;
@@ -1105,6 +1121,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NONE \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief MULTIZONE_CONCURRENT_ZONES \n DESCRIPTION: Solve the zones concurrently in block-Jacobi iterations, each
+   * with a share of the threads of each rank proportional to its number of points (requires MPI_THREAD_MULTIPLE).
+   * \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("MULTIZONE_CONCURRENT_ZONES", Multizone_ConcurrentZones, NO);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1171,12 +1191,32 @@ void CConfig::SetConfig_Options() {
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief RESTART_INTERPOLATION \n DESCRIPTION: Always interpolate the (binary) restart from the coordinates of its points, e.g. another mesh of equal size. \n Options: YES, NO \ingroup Config */
+  addBoolOption("RESTART_INTERPOLATION", Restart_Interpolation, false);
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_RESTART_OVERWRITE", Wrt_Restart_Overwrite, true);
   /*!\brief WRT_SURFACE_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_VOLUME_OVERWRITE", Wrt_Volume_Overwrite, true);
+  /*!\brief WRT_ASYNC_OUTPUT \n DESCRIPTION: sort and write the result files on a background thread while the solver continues. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_ASYNC_OUTPUT", Wrt_Async_Output, false);
+  /*!\brief OUTPUT_HDF5_COMPRESSION \n DESCRIPTION: deflate level (0 to 9) of the datasets in HDF5 output files, 0 disables compression. \ingroup Config */
+  addUnsignedShortOption("OUTPUT_HDF5_COMPRESSION", HDF5_Compression, 0);
+  /*!\brief CATALYST_SCRIPTS \n DESCRIPTION: pipeline scripts (e.g. ParaView Python) of the CATALYST output. \ingroup Config */
+  addStringListOption("CATALYST_SCRIPTS", nCatalyst_Scripts, Catalyst_Scripts);
+  /*!\brief CATALYST_FIELDS \n DESCRIPTION: volume output fields or groups passed to Catalyst, all volume output if not set. \ingroup Config */
+  addStringListOption("CATALYST_FIELDS", nCatalyst_Fields, Catalyst_Fields);
+  /*!\brief CATALYST_IMPLEMENTATION \n DESCRIPTION: Catalyst implementation to load (e.g. paraview, adios), taken from the environment if not set. \ingroup Config */
+  addStringOption("CATALYST_IMPLEMENTATION", Catalyst_Implementation, string(""));
+  /*!\brief SURFACE_STREAM_MARKERS \n DESCRIPTION: markers of the SURFACE_STREAM output, the plotting markers if not set. \ingroup Config */
+  addStringListOption("SURFACE_STREAM_MARKERS", nSurface_Stream_Markers, Surface_Stream_Markers);
+  /*!\brief SURFACE_STREAM_FIELDS \n DESCRIPTION: volume output fields or groups of the SURFACE_STREAM output, all volume output if not set. \ingroup Config */
+  addStringListOption("SURFACE_STREAM_FIELDS", nSurface_Stream_Fields, Surface_Stream_Fields);
+  /*!\brief RESTART_COMPRESSION \n DESCRIPTION: compression of the binary restart files \n OPTIONS: see \link Restart_Compression_Map \endlink \n DEFAULT: NONE \ingroup Config */
+  addEnumOption("RESTART_COMPRESSION", Restart_Compression, Restart_Compression_Map, RESTART_COMPRESSION::NONE);
+  /*!\brief RESTART_COMPRESSION_TOL \n DESCRIPTION: error bound of LOSSY restart compression, relative to the largest magnitude of each field in each block of points. \ingroup Config */
+  addDoubleOption("RESTART_COMPRESSION_TOL", Restart_Compression_Tol, 1e-8);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1193,6 +1233,22 @@ void CConfig::SetConfig_Options() {
   addStringListOption("FILENAMES_INTERPOLATOR", n_Datadriven_files, DataDriven_Method_FileNames);
   /*!\brief DATADRIVEN_NEWTON_RELAXATION \n DESCRIPTION: Relaxation factor for Newton solvers in data-driven fluid model. \n \ingroup Config*/
   addDoubleOption("DATADRIVEN_NEWTON_RELAXATION", DataDriven_Relaxation_Factor, 0.05);
+  /*!\brief LUT_WRITE_BINARY \n DESCRIPTION: Write the binary version (.drb) of ASCII lookup tables, it is loaded without preprocessing and shared by the ranks of each node. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("LUT_WRITE_BINARY", LUT_Write_Binary, false);
+  /*!\brief LUT_SEARCH_GRID \n DESCRIPTION: Locate points in lookup tables with a uniform search grid and the last triangle found, instead of the trapezoidal map. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("LUT_SEARCH_GRID", LUT_Search_Grid, false);
+  /*!\brief LUT_STRUCTURED \n DESCRIPTION: Detect the levels of lookup tables whose points form a tensor-product grid, and interpolate them bilinearly (trilinearly for 3D tables) without searching the triangulation. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("LUT_STRUCTURED", LUT_Structured, false);
+  /*!\brief LUT_GENERATE \n DESCRIPTION: Generate the lookup table of the data-driven fluid model (first file of FILENAMES_INTERPOLATOR) from another fluid model at startup. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("LUT_GENERATE", LUT_Generate, false);
+  /*!\brief LUT_GENERATE_FLUID_MODEL \n DESCRIPTION: Fluid model tabulated by the generated lookup table. \n OPTIONS: IDEAL_GAS, VW_GAS, PR_GAS, COOLPROP \n DEFAULT: COOLPROP \ingroup Config*/
+  addEnumOption("LUT_GENERATE_FLUID_MODEL", Kind_LUT_Generate_FluidModel, FluidModel_Map, COOLPROP);
+  /*!\brief LUT_GENERATE_RANGE \n DESCRIPTION: Minimum and maximum density, minimum and maximum static energy of the generated lookup table. \ingroup Config*/
+  addDoubleArrayOption("LUT_GENERATE_RANGE", 4, LUT_Generate_Range.data());
+  /*!\brief LUT_GENERATE_LEVELS \n DESCRIPTION: Level of the uniform base grid and maximum level of the adaptive refinement of the generated lookup table. \n DEFAULT: (4, 10) \ingroup Config*/
+  addUShortArrayOption("LUT_GENERATE_LEVELS", 2, LUT_Generate_Levels.data());
+  /*!\brief LUT_GENERATE_TOLERANCE \n DESCRIPTION: Relative interpolation error of pressure, temperature, and speed of sound above which cells of the generated lookup table are refined. \n DEFAULT: 1e-3 \ingroup Config*/
+  addDoubleOption("LUT_GENERATE_TOLERANCE", LUT_Generate_Tolerance, 1e-3);
 
   /*!\brief CONFINEMENT_PARAM \n DESCRIPTION: Input Confinement Parameter for Vorticity Confinement*/
   addDoubleOption("CONFINEMENT_PARAM", Confinement_Param, 0.0);
@@ -1227,6 +1283,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("INLET_TEMPERATURE_VE", Inlet_Temperature_ve, 0.0);
   /* DESCRIPTION: Specify if mixture is frozen */
   addBoolOption("FROZEN_MIXTURE", frozen, false);
+  /* DESCRIPTION: Integrate the chemical source terms separately from the flow with a stiff ODE integrator */
+  addBoolOption("CHEMISTRY_SPLITTING", chemistry_splitting, false);
+  /* DESCRIPTION: Relative tolerance of the split chemistry integration */
+  addDoubleOption("CHEMISTRY_SPLIT_TOLERANCE", Chemistry_Split_Tol, 1e-4);
+  /* DESCRIPTION: Maximum number of sub-steps per cell of the split chemistry integration */
+  addUnsignedLongOption("CHEMISTRY_SPLIT_MAX_STEPS", Chemistry_Split_MaxSteps, 1000);
   /* DESCRIPTION: Specify if there is ionization */
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
@@ -1283,6 +1345,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Definition of the turbulent thermal conductivity model (CONSTANT_PRANDTL_TURB (default), NONE). */
   addEnumOption("TURBULENT_CONDUCTIVITY_MODEL", Kind_ConductivityModel_Turb, TurbConductivityModel_Map, CONDUCTIVITYMODEL_TURB::CONSTANT_PRANDTL);
 
+  /* DESCRIPTION: Relative change of density and temperature below which the transport properties of a point are reused (0 disables the cache). */
+  addDoubleOption("TRANSPORT_CACHE_TOLERANCE", Transport_Cache_Tol, 0.0);
+
  /*--- Options related to Constant Thermal Conductivity Model ---*/
 
  /* DESCRIPTION: default value for AIR */
@@ -1318,6 +1383,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("WALLMODEL_MINYPLUS", wallModel_MinYplus, 5.0);
   /*!\brief WALLMODEL_B \n DESCRIPTION: constant B used for the wall model \n DEFAULT 5.5 \ingroup Config*/
   addDoubleOption("WALLMODEL_B", wallModel_B, 5.5);
+  /*!\brief WALLMODEL_TABLE \n DESCRIPTION: Tabulated inverse law of the wall \n DEFAULT NO \ingroup Config*/
+  addBoolOption("WALLMODEL_TABLE", wallModel_Table, false);
 
   /*!\brief BULK_MODULUS \n DESCRIPTION: Value of the Bulk Modulus  \n DEFAULT 1.42E5 \ingroup Config*/
   addDoubleOption("BULK_MODULUS", Bulk_Modulus, 1.42E5);
@@ -1563,6 +1630,11 @@ void CConfig::SetConfig_Options() {
   /*!\brief ACTDISK_FILENAME \n DESCRIPTION: Input file for a specified actuator disk (w/ extension) \n DEFAULT: actdiskinput.dat \ingroup Config*/
   addStringOption("ACTDISK_FILENAME", ActDisk_FileName, string("actdiskinput.dat"));
 
+  /*!\brief ACTDISK_BODY_FORCE \n DESCRIPTION: Model the actuator disks of ACTDISK_FILENAME as volumetric body forces, no disk markers are needed \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("ACTDISK_BODY_FORCE", ActDisk_BodyForce, false);
+  /*!\brief ACTDISK_BODY_FORCE_THICKNESS \n DESCRIPTION: Axial thickness of the volume over which the load of each body force actuator disk is spread \ingroup Config*/
+  addDoubleOption("ACTDISK_BODY_FORCE_THICKNESS", ActDisk_BodyForce_Thickness, 0.0);
+
   /*!\brief INLET_TYPE  \n DESCRIPTION: Inlet boundary type \n OPTIONS: see \link Inlet_Map \endlink \n DEFAULT: TOTAL_CONDITIONS \ingroup Config*/
   addEnumOption("INLET_TYPE", Kind_Inlet, Inlet_Map, INLET_TYPE::TOTAL_CONDITIONS);
   /*!\brief INC_INLET_TYPE \n DESCRIPTION: List of inlet types for incompressible flows. List length must match number of inlet markers. Options: VELOCITY_INLET, PRESSURE_INLET, INPUT_FILE. \ingroup Config*/
@@ -1624,6 +1696,9 @@ void CConfig::SetConfig_Options() {
   addDoubleArrayOption("RAMP_ROTATING_FRAME_COEFF", 3, rampRotFrame_coeff);
   /* DESCRIPTION: AVERAGE_MACH_LIMIT is a limit value for average procedure based on the mass flux. */
   addDoubleOption("AVERAGE_MACH_LIMIT", AverageMachLimit, 0.03);
+  /* DESCRIPTION: Frequency (iterations) at which the turbomachinery performance is updated, independent of the
+   * screen and history output frequencies. */
+  addUnsignedLongOption("TURBO_PERF_FREQ", TurboPerf_Freq, 1);
   /*!\brief RAMP_OUTLET_PRESSURE\n DESCRIPTION: option to ramp up or down the rotating frame velocity value*/
   addBoolOption("RAMP_OUTLET_PRESSURE", RampOutletPressure, false);
   rampOutPres_coeff[0] = 100000.0; rampOutPres_coeff[1] = 1.0; rampOutPres_coeff[2] = 1000.0;
@@ -1677,6 +1752,15 @@ void CConfig::SetConfig_Options() {
   /*!\brief WALL_ROUGHNESS  \n DESCRIPTION: Specified roughness heights at wall boundary marker(s)
    Format: ( Wall marker, roughness_height (static), ... ) \ingroup Config*/
   addStringDoubleListOption("WALL_ROUGHNESS", nRough_Wall, Marker_RoughWall, Roughness_Height);
+  /*!\brief WALL_DISTANCE_DISTRIBUTED \n DESCRIPTION: Keep the wall elements of each rank local and route the wall distance queries
+   to the ranks whose walls may be closest, instead of gathering all wall elements on every rank. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("WALL_DISTANCE_DISTRIBUTED", WallDistance_Distributed, false);
+  /*!\brief WALL_DISTANCE_BAND \n DESCRIPTION: On moving meshes, only recompute the wall distance of the points within this distance
+   of the walls, 0 recomputes all points. \n DEFAULT: 0.0 \ingroup Config*/
+  addDoubleOption("WALL_DISTANCE_BAND", WallDistance_Band, 0.0);
+  /*!\brief WALL_DISTANCE_PERIODIC_CACHE \n DESCRIPTION: For rigid rotations that repeat every N time steps (N up to this
+   value), store the wall distances of the first revolution and reuse them afterwards, 0 disables. \n DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("WALL_DISTANCE_PERIODIC_CACHE", WallDistance_PeriodicCache, 0);
   /*!\brief MARKER_ENGINE_INFLOW  \n DESCRIPTION: Engine inflow boundary marker(s)
    Format: ( nacelle inflow marker, fan face Mach, ... ) \ingroup Config*/
   addStringDoubleListOption("MARKER_ENGINE_INFLOW", nMarker_EngineInflow, Marker_EngineInflow, EngineInflow_Target);
@@ -1759,6 +1843,10 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Freeze the gradients and limiters during the matrix-free products, only the fluxes are re-evaluated. */
+  addBoolOption("NEWTON_KRYLOV_FROZEN_GRADIENTS", NK_FrozenGradients, false);
+  /* DESCRIPTION: Assemble the Jacobian of the second order residual by colored finite differences and use it instead of matrix-free products. */
+  addBoolOption("NEWTON_KRYLOV_ASSEMBLED_JACOBIAN", NK_AssembledJacobian, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1783,6 +1871,24 @@ void CConfig::SetConfig_Options() {
   default_cfl_adapt[0] = 1.0; default_cfl_adapt[1] = 1.0; default_cfl_adapt[2] = 10.0; default_cfl_adapt[3] = 100.0;
   default_cfl_adapt[4] = 0.001;
   addDoubleListOption("CFL_ADAPT_PARAM", nCFL_AdaptParam, CFL_AdaptParam);
+  /* DESCRIPTION: Method used to adapt the local CFL numbers (UNDER_RELAXATION, LOCAL_RESIDUAL) */
+  addEnumOption("CFL_ADAPT_METHOD", Kind_CFL_Adapt, CFL_Adapt_Method_Map, CFL_ADAPT_METHOD::UNDER_RELAXATION);
+  /* !\brief CFL_ADAPT_LOCAL_PARAM
+   * DESCRIPTION: Parameters of the LOCAL_RESIDUAL CFL adaption (exponent of the local residual reduction ratio,
+   * increase of the nonlinear residual in orders of magnitude that triggers a global CFL backtrack). \ingroup Config*/
+  addDoubleArrayOption("CFL_ADAPT_LOCAL_PARAM", 2, CFL_AdaptLocalParam.data());
+  /* DESCRIPTION: Freeze the points whose local residual converged (steady implicit flow problems) */
+  addBoolOption("ACTIVE_SET", ActiveSet, false);
+  /* !\brief ACTIVE_SET_PARAM
+   * DESCRIPTION: Parameters of the active set (residual threshold relative to the largest local residual of the
+   * first iteration, consecutive iterations below it to freeze a point, frequency of the global sweeps). \ingroup Config*/
+  addDoubleArrayOption("ACTIVE_SET_PARAM", 3, ActiveSetParam.data());
+  /* DESCRIPTION: Anderson acceleration of the nonlinear (fixed-point) iterations of the primal solvers */
+  addBoolOption("NONLINEAR_ACCELERATION", NonlinearAcceleration, false);
+  /* DESCRIPTION: Number of previous iterations used by the Anderson acceleration */
+  addUnsignedShortOption("NONLINEAR_ACCELERATION_DEPTH", NonlinearAccelerationDepth, 5);
+  /* DESCRIPTION: Solve the mean flow and turbulence equations in a single coupled linear system */
+  addBoolOption("COUPLED_TURBULENCE_SOLVE", Coupled_Turb_Solve, false);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1796,26 +1902,68 @@ void CConfig::SetConfig_Options() {
   // these options share nRKStep as their size, which is not a good idea in general
   /* DESCRIPTION: Runge-Kutta alpha coefficients */
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
+  /* DESCRIPTION: Central implicit residual smoothing of the explicit flow schemes. */
+  addBoolOption("RESIDUAL_SMOOTHING", ResidualSmoothing, false);
+  /* DESCRIPTION: Coefficient of the implicit residual smoothing. */
+  addDoubleOption("RESIDUAL_SMOOTHING_COEFF", ResidualSmoothing_Coeff, 0.5);
+  /* DESCRIPTION: Number of Jacobi iterations of the implicit residual smoothing. */
+  addUnsignedShortOption("RESIDUAL_SMOOTHING_ITER", ResidualSmoothing_Iter, 2);
+  /* DESCRIPTION: Line-implicit smoothing (along the linelets) of the explicit flow schemes. */
+  addBoolOption("LINE_IMPLICIT_SMOOTHING", LineImplicitSmoothing, false);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
   addUnsignedShortOption("TIME_DOFS_ADER_DG", nTimeDOFsADER_DG, 2);
   /* DESCRIPTION: Unsteady Courant-Friedrichs-Lewy number of the finest grid */
   addDoubleOption("UNST_CFL_NUMBER", Unst_CFL, 0.0);
+  /* DESCRIPTION: Start the inner iterations of dual time stepping from a linear extrapolation of the time levels */
+  addBoolOption("TIME_EXTRAPOLATION", Time_Extrapolation, false);
+  /* DESCRIPTION: Growth of the initial residual that makes a time step fall back to the solution at time n */
+  addDoubleOption("TIME_EXTRAPOLATION_TOL", Time_Extrapolation_Tol, 10.0);
   /* DESCRIPTION: Integer number of periodic time instances for Harmonic Balance */
   addUnsignedShortOption("TIME_INSTANCES", nTimeInstances, 1);
   /* DESCRIPTION: Time period for Harmonic Balance wihtout moving meshes */
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
+  /* DESCRIPTION: Number of MPI rank groups over which the time instances of Harmonic Balance are distributed */
+  addUnsignedShortOption("HB_INSTANCE_GROUPS", HB_InstanceGroups, 1);
+  /* DESCRIPTION: Number of MPI rank groups (time slices) of the time-parallel (parareal) dual time stepping */
+  addUnsignedShortOption("TIME_PARALLEL_GROUPS", TimeParallelGroups, 1);
+  /* DESCRIPTION: Maximum number of parareal iterations */
+  addUnsignedShortOption("PARAREAL_ITER", Parareal_Iter, 3);
+  /* DESCRIPTION: Ratio between the time steps of the coarse and fine parareal propagators */
+  addUnsignedShortOption("PARAREAL_COARSENING", Parareal_Coarsening, 10);
+  /* DESCRIPTION: Tolerance on the relative change of the initial states of the time slices */
+  addDoubleOption("PARAREAL_TOL", Parareal_Tol, 1e-6);
+  /* DESCRIPTION: Config files of the independent cases of an ensemble run */
+  addStringListOption("ENSEMBLE_CONFIGS", nEnsemble_Configs, Ensemble_Configs);
+  /* DESCRIPTION: Number of MPI rank groups that run the cases of the ensemble concurrently */
+  addUnsignedShortOption("ENSEMBLE_GROUPS", EnsembleGroups, 1);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Recompute the direct solutions that have no restart file for the unsteady adjoint */
+  addBoolOption("UNST_ADJOINT_RECOMPUTE", Unst_Adjoint_Recompute, false);
+  /* DESCRIPTION: Number of recomputed direct solutions kept in memory for the unsteady adjoint */
+  addUnsignedLongOption("UNST_ADJOINT_SNAPSHOTS", Unst_Adjoint_Snapshots, 8);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FLOW", Kind_TimeIntScheme_Flow, Time_Int_Map, EULER_IMPLICIT);
   /* DESCRIPTION: Time discretization */
   addEnumOption("TIME_DISCRE_FEM_FLOW", Kind_TimeIntScheme_FEM_Flow, Time_Int_Map, RUNGE_KUTTA_EXPLICIT);
+  /* DESCRIPTION: Maximum number of Newton iterations per time step of the implicit (JFNK) DG scheme */
+  addUnsignedShortOption("JFNK_NEWTON_ITER_FEM_FLOW", JFNK_Newton_Iter, 10);
+  /* DESCRIPTION: Relative reduction of the nonlinear residual of the implicit (JFNK) DG scheme */
+  addDoubleOption("JFNK_NEWTON_TOL_FEM_FLOW", JFNK_Newton_Tol, 1e-6);
+  /* DESCRIPTION: Time steps between rebuilds of the block-Jacobi preconditioner of the implicit (JFNK) DG scheme */
+  addUnsignedLongOption("JFNK_PRECOND_REBUILD_FEM_FLOW", JFNK_Precond_Rebuild, 10);
+  /* DESCRIPTION: Time steps between measurements of the load balance of the DG solver (0 = no measurement) */
+  addUnsignedLongOption("LOAD_BALANCE_FREQ_FEM", LoadBalance_Freq_FEM, 0);
+  /* DESCRIPTION: File with the measured work of the DG elements, used for the weights of the partitioning */
+  addStringOption("WORK_WEIGHTS_FILENAME_FEM", WorkWeights_FileName_FEM, string("work_weights_fem.dat"));
+  /* DESCRIPTION: Execute the tasks of the DG solver concurrently with the OpenMP threads */
+  addBoolOption("THREADED_TASK_SCHEDULER_FEM", Threaded_Task_Scheduler_FEM, false);
   /* DESCRIPTION: ADER-DG predictor step */
   addEnumOption("ADER_PREDICTOR", Kind_ADER_Predictor, Ader_Predictor_Map, ADER_ALIASED_PREDICTOR);
   /* DESCRIPTION: Time discretization */
@@ -1850,12 +1998,31 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Maximum number of iterative refinement steps (with double precision residuals) when the linear solver works in single precision.
+   * The single precision storage of the Jacobian is a build option (-Denable-mixedprec=true), it cannot be selected at runtime. */
+  addUnsignedShortOption("LINEAR_SOLVER_MIXED_REFINEMENT", Linear_Solver_Refinement_Iter, 0);
+  /* DESCRIPTION: Maximum number of levels (including the fine level) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 4);
+  /* DESCRIPTION: Number of pre and post smoothing sweeps on each level of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
+  /* DESCRIPTION: Damping factor of the block-Jacobi smoother of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_RELAXATION", Linear_Solver_AMG_Relaxation, 0.7);
+  /* DESCRIPTION: Couplings weaker than this fraction of the strongest coupling of a row are not aggregated */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.25);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of vectors (previous solution updates) recycled between the calls of RECYCLED_FGMRES */
+  addUnsignedLongOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Apply the ILU preconditioner with level scheduling instead of additive domain decomposition over threads. */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Level_Scheduling, false);
+  /* DESCRIPTION: Maximum number of linear solves that reuse the ILU/LINELET/AMG preconditioner (0 rebuilds it every time). */
+  addUnsignedLongOption("LINEAR_SOLVER_PREC_REUSE", Linear_Solver_Prec_Reuse, 0);
+  /* DESCRIPTION: The preconditioner is rebuilt when the linear iterations exceed this factor times those after the last build. */
+  addDoubleOption("LINEAR_SOLVER_PREC_REUSE_GROWTH", Linear_Solver_Prec_Reuse_Growth, 1.5);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1915,10 +2082,20 @@ void CConfig::SetConfig_Options() {
   addUShortListOption("MG_POST_SMOOTH", nMG_PostSmooth, MG_PostSmooth);
   /*!\brief MG_CORRECTION_SMOOTH\n DESCRIPTION: Jacobi implicit smoothing of the correction \ingroup Config*/
   addUShortListOption("MG_CORRECTION_SMOOTH", nMG_CorrecSmooth, MG_CorrecSmooth);
+  /*!\brief FULLMG_ITER\n DESCRIPTION: Iterations of each coarse grid (MESH_1, MESH_2, ...) in the grid sequencing start-up of FULLMG_CYCLE. DEFAULT: 100 \ingroup Config*/
+  addULongListOption("FULLMG_ITER", nFullMG_Iter, FullMG_Iter);
+  /*!\brief FULLMG_CFL\n DESCRIPTION: CFL of each coarse grid (MESH_1, MESH_2, ...) while it is the finest grid of the grid sequencing start-up. \ingroup Config*/
+  addDoubleListOption("FULLMG_CFL", nFullMG_CFL, FullMG_CFL);
   /*!\brief MG_DAMP_RESTRICTION\n DESCRIPTION: Damping factor for the residual restriction. DEFAULT: 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_PARALLEL_AGGLOMERATION\n DESCRIPTION: Agglomerate the interior control volumes with all threads, in rounds of independent seeds. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_PARALLEL_AGGLOMERATION", MG_ParallelAgglomeration, false);
+  /*!\brief MG_MERGE_SINGLETONS\n DESCRIPTION: Merge leftover interior control volumes into their smallest agglomerated neighbor. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_MERGE_SINGLETONS", MG_MergeSingletons, false);
+  /*!\brief MG_SCALAR_SOLVERS\n DESCRIPTION: Apply the FAS multigrid also to the turbulence and species solvers (steady primal problems). DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_SCALAR_SOLVERS", MG_ScalarSolvers, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1929,6 +2106,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief CACHE_LEAST_SQUARES_WEIGHTS
+   *  \n DESCRIPTION: Compute the least-squares gradient weights once and store them, only used for static meshes. DEFAULT: NO. \ingroup Config*/
+  addBoolOption("CACHE_LEAST_SQUARES_WEIGHTS", Cache_LeastSquares_Weights, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1938,6 +2118,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute the limiters of the flow solver in the same pass over the grid as the reconstruction gradients. DEFAULT: NO. \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", Fused_Gradient_Limiter, false);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -2022,6 +2205,8 @@ void CConfig::SetConfig_Options() {
   addDoubleListOption("OBJECTIVE_WEIGHT", nObjW, Weight_ObjFunc);
   /*!\brief OBJECTIVE_FUNCTION \n DESCRIPTION: Adjoint problem boundary condition \n OPTIONS: see \link Objective_Map \endlink \n DEFAULT: DRAG_COEFFICIENT \ingroup Config*/
   addEnumListOption("OBJECTIVE_FUNCTION", nObj, Kind_ObjFunc, Objective_Map);
+  /*!\brief VECTOR_ADJOINT \n DESCRIPTION: Solve one discrete adjoint per objective function with vector mode tape evaluations, instead of one adjoint for their weighted sum. \ingroup Config*/
+  addBoolOption("VECTOR_ADJOINT", Vector_Adjoint, false);
 
   /*!\brief CUSTOM_OBJFUNC \n DESCRIPTION: User-provided definition of a custom objective function. \ingroup Config*/
   addStringOption("CUSTOM_OBJFUNC", CustomObjFunc, "");
@@ -2195,6 +2380,14 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /* DESCRIPTION: Time the main phases of the iterations, and write the summary at the end of SU2_CFD  \ingroup Config*/
+  addBoolOption("RUNTIME_PROFILING", Runtime_Profiling, false);
+  /* DESCRIPTION: Make the profiled phases hardware counter regions (LIKWID or PAPI builds)  \ingroup Config*/
+  addBoolOption("HARDWARE_COUNTERS", Hardware_Counters, false);
+  /* DESCRIPTION: Compute the memory high-water marks every iteration (history group MEMORY)  \ingroup Config*/
+  addBoolOption("MEMORY_HISTORY", Memory_History, false);
+  /* DESCRIPTION: Use transparent huge pages for the large allocations  \ingroup Config*/
+  addBoolOption("HUGE_PAGES", Huge_Pages, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2253,6 +2446,11 @@ void CConfig::SetConfig_Options() {
   addDoubleListOption("SURFACE_PLUNGING_AMPL", nMarkerPlunging_Ampl, MarkerPlunging_Ampl);
   /* DESCRIPTION: Value to move motion origins (1 or 0) */
   addUShortListOption("MOVE_MOTION_ORIGIN", nMoveMotion_Origin, MoveMotion_Origin);
+  /* DESCRIPTION: Update the dual grid of moving meshes incrementally (rotate the normals for rigid motion,
+   *              recompute only around the points that moved for deforming meshes) */
+  addBoolOption("INCREMENTAL_DUAL_GRID", Incremental_DualGrid, false);
+  /* DESCRIPTION: Fraction of moved points above which the dual grid is fully recomputed */
+  addDoubleOption("INCREMENTAL_DUAL_GRID_THRESHOLD", Incremental_DualGrid_Threshold, 0.25);
 
   /* DESCRIPTION: Before each computation, implicitly smooth the nodal coordinates */
   addUnsignedShortOption("SMOOTH_GEOMETRY", SmoothNumGrid, 0);
@@ -2389,6 +2587,26 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_POISSONS_RATIO", Deform_PoissonRatio, 0.3);
   /* DESCRIPTION: Size of the layer of highest stiffness for wall distance-based mesh stiffness */
   addDoubleOption("DEFORM_STIFF_LAYER_SIZE", Deform_StiffLayerSize, 0.0);
+  /* DESCRIPTION: Reuse the stiffness matrix (and preconditioner) of the first mesh deformation */
+  addBoolOption("DEFORM_FROZEN_STIFFNESS", Deform_FrozenStiffness, false);
+  /* DESCRIPTION: Adapt the deformation increments, DEFORM_NONLINEAR_ITER sets the initial increment */
+  addBoolOption("DEFORM_ADAPTIVE_INCREMENT", Deform_AdaptiveIncrement, false);
+  /* DESCRIPTION: Maximum number of times a deformation increment is halved after producing negative volumes */
+  addUnsignedShortOption("DEFORM_MAX_SUBDIVISIONS", Deform_MaxSubdivisions, 4);
+  /* DESCRIPTION: Start the deformation linear solves from the (extrapolated) previous solution */
+  addBoolOption("DEFORM_WARM_START", Deform_WarmStart, false);
+  /* DESCRIPTION: Apply the element stiffness of the mesh solver on the fly instead of assembling the matrix */
+  addBoolOption("DEFORM_MATRIX_FREE", Deform_MatrixFree, false);
+  /* DESCRIPTION: Method to deform the volume mesh (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Kind_Deform_Method, Deform_Method_Map, DEFORM_METHOD::ELASTICITY);
+  /* DESCRIPTION: Radial basis function for RBF mesh deformation (WENDLAND_C2, GAUSSIAN, INV_MULTI_QUADRIC) */
+  addEnumOption("DEFORM_RBF_FUNCTION", Kind_Deform_RBF, RadialBasisFunction_Map, RADIAL_BASIS::WENDLAND_C2);
+  /* DESCRIPTION: Support radius of the RBF mesh deformation, the default (0) is the size of the deforming surfaces */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Tolerance (relative to the maximum surface displacement) of the greedy selection of RBF centers */
+  addDoubleOption("DEFORM_RBF_GREEDY_TOL", Deform_RBF_GreedyTol, 1e-3);
+  /* DESCRIPTION: Maximum number of RBF centers for mesh deformation */
+  addUnsignedLongOption("DEFORM_RBF_MAX_CENTERS", Deform_RBF_MaxCenters, 2000);
   /*  DESCRIPTION: Linear solver for the mesh deformation\n OPTIONS: see \link Linear_Solver_Map \endlink \n DEFAULT: FGMRES \ingroup Config*/
   addEnumOption("DEFORM_LINEAR_SOLVER", Kind_Deform_Linear_Solver, Linear_Solver_Map, FGMRES);
   /*  \n DESCRIPTION: Preconditioner for the Krylov linear solvers \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: LU_SGS \ingroup Config*/
@@ -2580,6 +2798,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_ZONE_CONV", Wrt_ZoneConv, false);
   /* DESCRIPTION: Determines if the convergence history of each individual zone is written to file */
   addBoolOption("WRT_ZONE_HIST", Wrt_ZoneHist, false);
+  /* DESCRIPTION: Record one tape per zone in the multizone discrete adjoint */
+  addBoolOption("ZONE_TAPES", Zone_Tapes, false);
 
   /* DESCRIPTION: Determines if the forces breakdown is written out */
   addBoolOption("WRT_FORCES_BREAKDOWN", Wrt_ForcesBreakdown, false);
@@ -2612,6 +2832,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Maximum number of donors (nearest, within the radius) of each target point in local RBF interpolation. */
+  addUnsignedShortOption("RADIAL_BASIS_FUNCTION_MAX_DONORS", RadialBasisFunction_MaxDonors, 32);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2636,6 +2859,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
   /* DESCRIPTION: Kind of relaxation */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, BGS_RELAXATION::NONE);
+  /* DESCRIPTION: Maximum number of columns of the interface quasi-Newton history */
+  addUnsignedShortOption("QUASI_NEWTON_FSI_MAX_COLUMNS", QuasiNewtonFSI_MaxColumns, 50);
+  /* DESCRIPTION: Number of previous time steps whose interface quasi-Newton history is reused */
+  addUnsignedShortOption("QUASI_NEWTON_FSI_REUSE_STEPS", QuasiNewtonFSI_ReuseSteps, 4);
+  /* DESCRIPTION: Relative tolerance of the QR filter of the interface quasi-Newton history */
+  addDoubleOption("QUASI_NEWTON_FSI_FILTER", QuasiNewtonFSI_Filter, 1e-2);
   /* DESCRIPTION: Relaxation required */
   addBoolOption("RELAXATION", Relaxation, false);
 
@@ -2673,6 +2902,14 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION:  Courant-Friedrichs-Lewy condition of the finest grid in radiation solvers */
   addDoubleOption("CFL_NUMBER_RAD", CFL_Rad, 1.0);
 
+  /* DESCRIPTION: Number of flow iterations between updates of the radiation solution, the radiative
+   * source terms are lagged in between */
+  addUnsignedLongOption("RADIATION_FREQUENCY", Radiation_Freq, 1);
+
+  /* DESCRIPTION: Keep the matrix and preconditioner of the P1 model across radiation updates, and warm-start
+   * the linear solver with the previous update */
+  addBoolOption("RADIATION_FROZEN_SYSTEM", Radiation_Frozen_System, false);
+
   /*!\par CONFIG_CATEGORY: Heat solver \ingroup Config*/
   /*--- options related to the heat solver ---*/
 
@@ -2680,6 +2917,9 @@ void CConfig::SetConfig_Options() {
   /*  Options: NO, YES \ingroup Config */
   addEnumOption("CHT_COUPLING_METHOD", Kind_CHT_Coupling, CHT_Coupling_Map, CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX);
 
+  /* DESCRIPTION: Assemble the (linear) conduction matrix of solid zones once, and keep it and its preconditioner */
+  addBoolOption("HEAT_FROZEN_SYSTEM", Heat_Frozen_System, false);
+
   /*!\par CONFIG_CATEGORY: Visualize Control Volumes \ingroup Config*/
   /*--- options related to visualizing control volumes ---*/
 
@@ -2769,8 +3009,9 @@ void CConfig::SetConfig_Options() {
   /*--- Options for the automatic differentiation methods ---*/
   /*!\par CONFIG_CATEGORY: Automatic Differentation options\ingroup Config*/
 
-  /* DESCRIPTION: Direct differentiation mode (forward) */
-  addEnumOption("DIRECT_DIFF", DirectDiff, DirectDiff_Var_Map, NO_DERIVATIVE);
+  /* DESCRIPTION: Direct differentiation mode (forward), a list of variables propagates one direction per variable
+   * (requires a build with -Ddirectdiff-vector-width at least as large as the list). */
+  addEnumListOption("DIRECT_DIFF", nDirectDiff, DirectDiff_List, DirectDiff_Var_Map);
 
   /* DESCRIPTION: Automatic differentiation mode (reverse) */
   addBoolOption("AUTO_DIFF", AD_Mode, NO);
@@ -2778,6 +3019,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Preaccumulation in the AD mode. */
   addBoolOption("PREACC", AD_Preaccumulation, YES);
 
+  /* DESCRIPTION: Re-evaluate the primal value tape with the current solution and coordinates instead of re-recording it. */
+  addBoolOption("PRIMAL_TAPE_REUSE", Primal_Tape_Reuse, NO);
+
+  /* DESCRIPTION: Project the sensitivities on the design variables at the end of the discrete adjoint run (as SU2_DOT). */
+  addBoolOption("INLINE_GRADIENT_PROJECTION", Inline_Gradient_Projection, NO);
+
   /*--- options that are used in the python optimization scripts. These have no effect on the c++ toolsuite ---*/
   /*!\par CONFIG_CATEGORY:Python Options\ingroup Config*/
 
@@ -2845,6 +3092,36 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Partition first across compute nodes, then across the ranks of each node */
+  addBoolOption("PARMETIS_HIERARCHICAL", ParMETIS_Hierarchical, false);
+
+  /* DESCRIPTION: Use the measured cost of each point (POINT_COST_FILENAME) to weight the points for ParMETIS */
+  addBoolOption("PARMETIS_POINT_COST", ParMETIS_PointCost, false);
+
+  /* DESCRIPTION: Number of iterations over which the cost of each point is measured (0 to disable) */
+  addUnsignedLongOption("POINT_COST_PROFILING_ITER", PointCost_Profiling_Iter, 0);
+
+  /* DESCRIPTION: File with the measured cost of each point */
+  addStringOption("POINT_COST_FILENAME", PointCost_FileName, string("point_cost.dat"));
+
+  /* DESCRIPTION: Store the ParMETIS partitioning on disk and reuse it when the same mesh is run on the same number of ranks */
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+
+  /* DESCRIPTION: Prefix of the partition cache files */
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache"));
+
+  /* DESCRIPTION: Renumbering of the points of each rank after partitioning (NONE, RCM, HILBERT) */
+  addEnumOption("POINT_ORDERING", Kind_PointOrdering, PointOrdering_Map, POINT_ORDERING::RCM);
+
+  /* DESCRIPTION: Use persistent MPI requests (created once) for the halo exchanges */
+  addBoolOption("PERSISTENT_P2P_COMMS", Persistent_P2P_Comms, false);
+
+  /* DESCRIPTION: Send the gradients and limiters in single precision in the halo exchanges */
+  addBoolOption("FLOAT_HALO_COMMS", Float_Halo_Comms, false);
+
+  /* DESCRIPTION: Compute the fluxes of edges that do not touch halo points while the halo exchanges complete */
+  addBoolOption("OVERLAP_HALO_COMMS", Overlap_Halo_Comms, false);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2854,6 +3131,30 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Window (weight) function for the cost-functional in the reverse sweep */
   addEnumOption("WINDOW_FUNCTION", Kind_WindowFct, Window_Map, WINDOW_FUNCTION::SQUARE);
 
+  /* DESCRIPTION: Running statistics of the flow (mean, Reynolds stresses, skewness, flatness) from WINDOW_START_ITER */
+  addBoolOption("TIME_STATISTICS", Time_Statistics, false);
+
+  /* DESCRIPTION: Store the running statistics in single precision */
+  addBoolOption("TIME_STATISTICS_SINGLE_PREC", Time_Statistics_Single_Prec, false);
+
+  /* DESCRIPTION: File with the state of the running statistics and spectral probes, read on restart */
+  addStringOption("TIME_STATISTICS_FILENAME", Time_Statistics_FileName, string("time_statistics.dat"));
+
+  /* DESCRIPTION: History outputs (e.g. custom probes) whose power spectral density is computed */
+  addStringListOption("SPECTRAL_PROBES", nSpectral_Probes, Spectral_Probes);
+
+  /* DESCRIPTION: Number of time steps of each window of the spectral probes (power of 2) */
+  addUnsignedLongOption("SPECTRAL_WINDOW", Spectral_Window, 256);
+
+  /* DESCRIPTION: Time iterations between node-local checkpoints with a copy on a buddy rank (0 disables them) */
+  addUnsignedLongOption("CHECKPOINT_FREQ", Checkpoint_Freq, 0);
+
+  /* DESCRIPTION: Node-local directory (e.g. a local SSD) of the checkpoint files */
+  addStringOption("CHECKPOINT_DIR", Checkpoint_Dir, string("checkpoints"));
+
+  /* DESCRIPTION: Restart from the last node-local checkpoint, recovering lost ranks from their buddy copies */
+  addBoolOption("CHECKPOINT_RESTART", Checkpoint_Restart, false);
+
   /* DESCRIPTION: DES Constant */
   addDoubleOption("DES_CONST", Const_DES, 0.65);
 
@@ -2946,12 +3247,21 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Level of fill for PaStiX incomplete LU factorization. */
   addUnsignedShortOption("PASTIX_FILL_LEVEL", pastix_fill_lvl, 1);
 
+  /* DESCRIPTION: Krylov method, preconditioner, etc. of LINEAR_SOLVER= PETSC, in PETSc command line syntax. */
+  addStringListOption("PETSC_OPTIONS", nPetsc_Options, Petsc_Options);
+
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
   /* DESCRIPTION: Allow fallback to smaller edge color group sizes for the discrete adjoint and allow more colors. */
   addBoolOption("EDGE_COLORING_RELAX_DISC_ADJ", edgeColoringRelaxDiscAdj, true);
 
+  /* DESCRIPTION: Time the reducer strategy and a few edge color group sizes at startup, and use the fastest. */
+  addBoolOption("EDGE_COLORING_AUTOTUNE", edgeColoringAutotune, false);
+
+  /* DESCRIPTION: Number of SIMD groups of edges ahead whose point data is prefetched in vectorized edge loops (0 disables). */
+  addUnsignedLongOption("EDGE_PREFETCH_DISTANCE", edgePrefetchDistance, 0);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -2970,25 +3280,42 @@ void CConfig::SetConfig_Options() {
   /*!\brief ROM_SAVE_FREQ \n DESCRIPTION: How often to save snapshots for unsteady problems.*/
   addUnsignedShortOption("ROM_SAVE_FREQ", rom_save_freq, 1);
 
+  /*!\brief ROM_PROJECTION \n DESCRIPTION: Online reduced order model, projection of the implicit flow system on the
+   POD basis of LIBROM_BASE_FILENAME (NONE, GALERKIN, LSPG). */
+  addEnumOption("ROM_PROJECTION", Kind_ROMProjection, ROM_Projection_Map, ROM_PROJECTION::NONE);
+
   /* END_CONFIG_OPTIONS */
 
 }
 
 void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
-  ifstream case_file;
+  /*--- Read the configuration file on the master rank and broadcast its text, the file is read
+   once per zone (and per driver in Python scripts), which is slow on parallel file systems
+   when all ranks open it. The size includes 1 to distinguish empty from missing files. ---*/
 
-  /*--- Read the configuration file ---*/
+  string case_text;
+  unsigned long case_size = 0;
 
-  case_file.open(case_filename, ios::in);
+  if (rank == MASTER_NODE) {
+    ifstream case_file(case_filename, ios::in);
+    if (!case_file.fail()) {
+      stringstream buffer;
+      buffer << case_file.rdbuf();
+      case_text = buffer.str();
+      case_size = case_text.size() + 1;
+    }
+  }
+  SU2_MPI::Bcast(&case_size, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
 
-  if (case_file.fail()) {
+  if (case_size == 0) {
     SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
   }
+  case_text.resize(case_size - 1);
+  SU2_MPI::Bcast(&case_text[0], case_size - 1, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
 
-  SetConfig_Parsing(case_file);
-
-  case_file.close();
+  istringstream case_buffer(case_text);
+  SetConfig_Parsing(case_buffer);
 
 }
 
@@ -3023,8 +3350,7 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
      * throw an error. ---*/
 
      if (!text_line.empty() && (text_line.front() != '%')){
-       while (text_line.back() == '\\' ||
-              (PrintingToolbox::split(text_line, '\\').size() > 1)){
+       for (auto cont = text_line.find('\\'); cont != string::npos; cont = text_line.find('\\')) {
          string tmp;
          getline (config_buffer, tmp);
          line_count++;
@@ -3033,7 +3359,7 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
          }
          PrintingToolbox::trim(tmp);
          if (tmp.front() != '%'){
-           text_line = PrintingToolbox::split(text_line, '\\')[0];
+           text_line.erase(cont);
            text_line += " " + tmp;
          }
        }
@@ -3042,7 +3368,9 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
     if (TokenizeString(text_line, option_name, option_value)) {
       /*--- See if it's a python option ---*/
 
-      if (option_map.find(option_name) == option_map.end()) {
+      const auto option = option_map.find(option_name);
+
+      if (option == option_map.end()) {
           string newString;
           newString.append("Line " + to_string(line_count)  + " " + option_name);
           newString.append(": invalid option name");
@@ -3113,7 +3441,7 @@ void CConfig::SetConfig_Parsing(istream& config_buffer){
 
       /*--- Set the value and check error ---*/
 
-      string out = option_map[option_name]->SetValue(option_value);
+      string out = option->second->SetValue(option_value);
       if (out.compare("") != 0) {
         /*--- valid option, but deprecated value ---*/
         if (!option_name.compare("KIND_TURB_MODEL")) {
@@ -3277,6 +3605,14 @@ void CConfig::SetHeader(SU2_COMPONENT val_software) const{
     }
     cout << "|                                                                       |\n";
     cout << "-------------------------------------------------------------------------\n";
+    /*--- Instruction set of the vectorized kernels, and the best one supported by the host. ---*/
+    string simdInfo = string("Vectorization: ") + simd::isaName(simd::compiledISA()) + ", " +
+                      to_string(simd::preferredLen<su2double>()) + " x double";
+    if (simd::hostISA() != simd::compiledISA())
+      simdInfo += string(" (host supports ") + simd::isaName(simd::hostISA()) + ")";
+    simdInfo.resize(70, ' ');
+    cout << "| " << simdInfo << "|\n";
+    cout << "-------------------------------------------------------------------------\n";
     cout << "| SU2 Project Website: https://su2code.github.io                        |\n";
     cout << "|                                                                       |\n";
     cout << "| The SU2 Project is maintained by the SU2 Foundation                   |\n";
@@ -3433,6 +3769,35 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   }
 #endif
 
+  /*--- HDF5 output uses the HDF5 library that comes with CGNS. ---*/
+#ifndef HAVE_HDF5
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
+    if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::HDF5 ||
+        VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::SURFACE_HDF5) {
+      SU2_MPI::Error(string("HDF5 file requested in option OUTPUT_FILES but SU2 was built without HDF5 (CGNS) support.\n"),CURRENT_FUNCTION);
+    }
+  }
+#endif
+
+  for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
+    if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::CATALYST) {
+#ifndef HAVE_CATALYST
+      SU2_MPI::Error(string("CATALYST requested in option OUTPUT_FILES but SU2 was built without Catalyst support.\n"),CURRENT_FUNCTION);
+#endif
+      if (nCatalyst_Scripts == 0 && Catalyst_Implementation.empty())
+        SU2_MPI::Error("CATALYST output requires pipeline scripts (option CATALYST_SCRIPTS).", CURRENT_FUNCTION);
+    }
+  }
+
+#ifndef HAVE_ZLIB
+  if (Restart_Compression != RESTART_COMPRESSION::NONE) {
+    SU2_MPI::Error("RESTART_COMPRESSION requires SU2 to be built with zlib.", CURRENT_FUNCTION);
+  }
+#endif
+  if (Restart_Compression == RESTART_COMPRESSION::LOSSY && Restart_Compression_Tol <= 0.0) {
+    SU2_MPI::Error("RESTART_COMPRESSION_TOL must be positive.", CURRENT_FUNCTION);
+  }
+
   /*--- Check if CoolProp is used with non-dimensionalization. ---*/
   if (Kind_FluidModel == COOLPROP && Ref_NonDim != DIMENSIONAL) {
     SU2_MPI::Error("CoolProp can not be used with non-dimensionalization.", CURRENT_FUNCTION);
@@ -3446,6 +3811,9 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     if (val_nDim == 2 && (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::STL_ASCII || VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::STL_BINARY)) {
       SU2_MPI::Error(string("OUTPUT_FILES: 'STL(_BINARY)' output only reasonable for 3D cases.\n"), CURRENT_FUNCTION);
     }
+    if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::MESH_BINARY && val_software != SU2_COMPONENT::SU2_DEF) {
+      SU2_MPI::Error(string("OUTPUT_FILES: 'MESH_BINARY' output is only available in SU2_DEF.\n"), CURRENT_FUNCTION);
+    }
   }
 
   /*--- Check if MESH_QUALITY is requested in VOLUME_OUTPUT and set the config boolean accordingly. ---*/
@@ -3802,6 +4170,18 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       StartWindowIteration = Restart_Iter;
     }
 
+    if (nSpectral_Probes > 0 && !Time_Statistics) {
+      SU2_MPI::Error("SPECTRAL_PROBES require TIME_STATISTICS= YES.", CURRENT_FUNCTION);
+    }
+    if (nSpectral_Probes > 0 && (Spectral_Window < 2 || (Spectral_Window & (Spectral_Window - 1)))) {
+      SU2_MPI::Error("SPECTRAL_WINDOW must be a power of 2.", CURRENT_FUNCTION);
+    }
+
+    if ((Checkpoint_Freq > 0 || Checkpoint_Restart) && (Multizone_Problem || GetDynamic_Grid())) {
+      SU2_MPI::Error("Node-local checkpoints are only available for single zone problems on fixed grids.",
+                     CURRENT_FUNCTION);
+    }
+
     if (Time_Step <= 0.0 && Unst_CFL == 0.0){ SU2_MPI::Error("Invalid value for TIME_STEP.", CURRENT_FUNCTION); }
   } else {
     nTimeIter = 1;
@@ -3860,6 +4240,7 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   /*--- Initialize non-physical points/reconstructions to zero ---*/
 
   Nonphys_Points   = 0;
+  Transport_Cache_Hits = 0;
   Nonphys_Reconstr = 0;
 
   /*--- Set the number of external iterations to 1 for the steady state problem ---*/
@@ -3873,6 +4254,13 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   Radiation = (Kind_Radiation != RADIATION_MODEL::NONE);
 
+  if (Radiation_Freq == 0) {
+    SU2_MPI::Error("RADIATION_FREQUENCY must be at least 1.", CURRENT_FUNCTION);
+  }
+  if (Radiation && (Radiation_Freq > 1) && DiscreteAdjoint) {
+    SU2_MPI::Error("RADIATION_FREQUENCY > 1 is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
   /*--- Check for unsupported features. ---*/
 
   if ((Kind_Solver != MAIN_SOLVER::EULER && Kind_Solver != MAIN_SOLVER::NAVIER_STOKES && Kind_Solver != MAIN_SOLVER::RANS) && (TimeMarching == TIME_MARCHING::HARMONIC_BALANCE)){
@@ -4075,6 +4463,11 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                      CURRENT_FUNCTION);
     }
 
+    if (nemo && chemistry_splitting &&
+        (TimeMarching == TIME_MARCHING::DT_STEPPING_1ST || TimeMarching == TIME_MARCHING::DT_STEPPING_2ND)) {
+      SU2_MPI::Error("CHEMISTRY_SPLITTING is not compatible with dual time stepping.", CURRENT_FUNCTION);
+    }
+
     if (Kind_FluidModel == SU2_NONEQ && GasModel == "AIR-7" && nWall_Catalytic != 0) {
       SU2_MPI::Error("Catalytic wall recombination is not yet available for ionized flows in SU2_NEMO.", CURRENT_FUNCTION);
     }
@@ -4323,6 +4716,13 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     nSpan_iZones = new unsigned short[nZone];
   }
 
+  if (TurboPerf_Freq == 0) {
+    SU2_MPI::Error("TURBO_PERF_FREQ must be at least 1.", CURRENT_FUNCTION);
+  }
+  if ((TurboPerf_Freq > 1) && DiscreteAdjoint) {
+    SU2_MPI::Error("TURBO_PERF_FREQ > 1 is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
   /*--- Set number of TurboPerformance markers ---*/
   if(GetGrid_Movement() && RampRotatingFrame && !DiscreteAdjoint){
     FinalRotation_Rate_Z = Rotation_Rate[2];
@@ -4517,6 +4917,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   FinestMesh = MESH_0;
   if (MGCycle == FULLMG_CYCLE) FinestMesh = nMGLevels;
 
+  /*--- The multigrid of the scalar solvers is only implemented for steady primal problems. ---*/
+
+  if (MG_ScalarSolvers) {
+    if (ContinuousAdjoint || DiscreteAdjoint || Time_Domain || (TimeMarching == TIME_MARCHING::HARMONIC_BALANCE))
+      SU2_MPI::Error("MG_SCALAR_SOLVERS is only available for steady primal problems.", CURRENT_FUNCTION);
+    if (nMGLevels == 0) MG_ScalarSolvers = false;
+  }
+
   if ((Kind_Solver == MAIN_SOLVER::NAVIER_STOKES) &&
       (Kind_Turb_Model != TURB_MODEL::NONE))
     Kind_Solver = MAIN_SOLVER::RANS;
@@ -4657,7 +5065,16 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   }
   if (nMG_CorrecSmooth != 0) MG_CorrecSmooth[nMGLevels] = 0;
 
-  if (Restart) MGCycle = V_CYCLE;
+  if (Restart) {
+    MGCycle = V_CYCLE;
+    FinestMesh = MESH_0;
+  }
+
+  if (MGCycle == FULLMG_CYCLE) {
+    for (unsigned short i = 0; i < nFullMG_CFL; i++) {
+      if (FullMG_CFL[i] <= 0.0) SU2_MPI::Error("FULLMG_CFL must be positive.", CURRENT_FUNCTION);
+    }
+  }
 
   if (ContinuousAdjoint) {
     if (Kind_Solver == MAIN_SOLVER::EULER) Kind_Solver = MAIN_SOLVER::ADJ_EULER;
@@ -4927,6 +5344,30 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   if (Fixed_CL_Mode) Update_AoA = false;
 
+  /*--- The first direction defines the direct differentiation mode, "NONE" alone means no derivatives. ---*/
+
+  if (nDirectDiff == 1 && DirectDiff_List[0] == NO_DERIVATIVE) nDirectDiff = 0;
+  DirectDiff = (nDirectDiff > 0) ? DirectDiff_List[0] : NO_DERIVATIVE;
+
+  if (nDirectDiff > 1) {
+    if (nDirectDiff > SU2_TYPE::nDirections && Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
+      SU2_MPI::Error("DIRECT_DIFF lists " + to_string(nDirectDiff) + " variables but this build propagates " +
+                     to_string(SU2_TYPE::nDirections) + " direction(s).\n"
+                     "Please rebuild SU2_CFD_DIRECTDIFF with -Ddirectdiff-vector-width=" + to_string(nDirectDiff) +
+                     " or larger.", CURRENT_FUNCTION);
+    }
+    for (unsigned short iDir = 0; iDir < nDirectDiff; iDir++) {
+      const auto kind = DirectDiff_List[iDir];
+      if (kind == NO_DERIVATIVE || kind == D_DESIGN || kind >= D_YOUNG) {
+        SU2_MPI::Error("Only freestream and fluid property variables can be combined in a list of DIRECT_DIFF.",
+                       CURRENT_FUNCTION);
+      }
+      for (unsigned short jDir = 0; jDir < iDir; jDir++) {
+        if (DirectDiff_List[jDir] == kind) SU2_MPI::Error("Repeated variable in DIRECT_DIFF.", CURRENT_FUNCTION);
+      }
+    }
+  }
+
   if (DirectDiff != NO_DERIVATIVE) {
 #ifndef CODI_FORWARD_TYPE
     if (Kind_SU2 == SU2_COMPONENT::SU2_CFD) {
@@ -4935,32 +5376,37 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                      CURRENT_FUNCTION);
     }
 #endif
-    /*--- Initialize the derivative values ---*/
-    switch (DirectDiff) {
-      case D_MACH:
-        SU2_TYPE::SetDerivative(Mach, 1.0);
-        break;
-      case D_AOA:
-        SU2_TYPE::SetDerivative(AoA, 1.0);
-        break;
-      case D_SIDESLIP:
-        SU2_TYPE::SetDerivative(AoS, 1.0);
-        break;
-      case D_REYNOLDS:
-        SU2_TYPE::SetDerivative(Reynolds, 1.0);
-        break;
-      case D_TURB2LAM:
-       SU2_TYPE::SetDerivative(TurbIntensityAndViscRatioFreeStream[1], 1.0);
-        break;
-      default:
-        /*--- All other cases are handled in the specific solver ---*/
-        break;
+    /*--- Initialize the derivative values, one direction per variable. ---*/
+    for (unsigned short iDir = 0; iDir < nDirectDiff; iDir++) {
+      switch (DirectDiff_List[iDir]) {
+        case D_MACH:
+          SU2_TYPE::SetDerivative(Mach, iDir, 1.0);
+          break;
+        case D_AOA:
+          SU2_TYPE::SetDerivative(AoA, iDir, 1.0);
+          break;
+        case D_SIDESLIP:
+          SU2_TYPE::SetDerivative(AoS, iDir, 1.0);
+          break;
+        case D_REYNOLDS:
+          SU2_TYPE::SetDerivative(Reynolds, iDir, 1.0);
+          break;
+        case D_TURB2LAM:
+          SU2_TYPE::SetDerivative(TurbIntensityAndViscRatioFreeStream[1], iDir, 1.0);
+          break;
+        default:
+          /*--- All other cases are handled in the specific solver ---*/
+          break;
       }
+    }
   }
 
 #if defined CODI_REVERSE_TYPE
   AD_Mode = YES;
 
+  /*--- Preaccumulated statements store their partial derivatives, they cannot be re-evaluated. ---*/
+  if (Primal_Tape_Reuse) AD_Preaccumulation = NO;
+
   AD::PreaccEnabled = AD_Preaccumulation;
 
 #else
@@ -5308,6 +5754,32 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /*--- The same applies to PETSc, which has its own preconditioners. ---*/
+  if (Kind_Linear_Solver == PETSC) Kind_Linear_Solver_Prec = LU_SGS;
+  if (Kind_DiscAdj_Linear_Solver == PETSC) Kind_DiscAdj_Linear_Prec = LU_SGS;
+  if (Kind_Deform_Linear_Solver == PETSC) Kind_Deform_Linear_Solver_Prec = LU_SGS;
+#ifndef HAVE_PETSC
+  if (Kind_Linear_Solver == PETSC || Kind_DiscAdj_Linear_Solver == PETSC || Kind_Deform_Linear_Solver == PETSC) {
+    SU2_MPI::Error("LINEAR_SOLVER= PETSC requires SU2 to be compiled with PETSc (-Denable-petsc=true).",
+                   CURRENT_FUNCTION);
+  }
+#endif
+
+  /*--- The device solver only has the Jacobi preconditioner. ---*/
+  if (Kind_Linear_Solver == DEVICE_BCGSTAB && Kind_Linear_Solver_Prec != JACOBI) {
+    SU2_MPI::Error("LINEAR_SOLVER= DEVICE_BCGSTAB requires LINEAR_SOLVER_PREC= JACOBI.", CURRENT_FUNCTION);
+  }
+
+  /*--- The matrix-free mesh solver is not differentiated, the adjoint needs the assembled stiffness. ---*/
+#ifdef CODI_REVERSE_TYPE
+  Deform_MatrixFree = false;
+#endif
+
+  /*--- Single precision halo exchanges would drop the derivatives. ---*/
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  Float_Halo_Comms = false;
+#endif
+  if (DiscreteAdjoint) Deform_MatrixFree = false;
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -5318,6 +5790,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
 #endif
 
+    /*--- The interface quasi-Newton update is computed with passive values. ---*/
+    if (Kind_BGS_RelaxMethod == BGS_RELAXATION::QUASI_NEWTON) {
+      SU2_MPI::Error("BGS_RELAXATION= QUASI_NEWTON is not available for discrete adjoint problems.", CURRENT_FUNCTION);
+    }
+
+    /*--- The incremental dual grid update does not record the dependence on all the coordinates. ---*/
+    Incremental_DualGrid = false;
+
     /*--- Use the same linear solver on the primal as the one used in the adjoint. ---*/
     Kind_Linear_Solver = Kind_DiscAdj_Linear_Solver;
     Kind_Linear_Solver_Prec = Kind_DiscAdj_Linear_Prec;
@@ -5338,6 +5818,65 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
         Iter_Avg_Objective = nTimeIter;
       }
 
+      if (Vector_Adjoint) {
+        SU2_MPI::Error("VECTOR_ADJOINT is not available for unsteady problems.", CURRENT_FUNCTION);
+      }
+
+      if (Unst_Adjoint_Recompute) {
+        if (Multizone_Problem || !GetFluidProblem() || (Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_EULER) ||
+            (Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_NS) || (Kind_Solver == MAIN_SOLVER::DISC_ADJ_FEM_RANS) ||
+            (TimeMarching != TIME_MARCHING::DT_STEPPING_1ST && TimeMarching != TIME_MARCHING::DT_STEPPING_2ND)) {
+          SU2_MPI::Error("UNST_ADJOINT_RECOMPUTE is only available for single zone fluid problems with dual time stepping.",
+                         CURRENT_FUNCTION);
+        }
+        if (GetGrid_Movement() || Deform_Mesh || Weakly_Coupled_Heat || Kind_FluidModel == FLUID_FLAMELET) {
+          SU2_MPI::Error("UNST_ADJOINT_RECOMPUTE does not support moving grids, weakly coupled heat or flamelets.",
+                         CURRENT_FUNCTION);
+        }
+        if (Unst_Adjoint_Snapshots < 2) {
+          SU2_MPI::Error("UNST_ADJOINT_SNAPSHOTS must be at least 2.", CURRENT_FUNCTION);
+        }
+      }
+
+    }
+
+    if (Vector_Adjoint) {
+      if (Multizone_Problem || !GetFluidProblem()) {
+        SU2_MPI::Error("VECTOR_ADJOINT is only available for single zone fluid problems.",
+                       CURRENT_FUNCTION);
+      }
+      if (nObj > AD::MaxAdjointDirections) {
+        SU2_MPI::Error("VECTOR_ADJOINT supports up to " + to_string(AD::MaxAdjointDirections) +
+                       " objective functions.", CURRENT_FUNCTION);
+      }
+      if (Kind_ObjFunc[0] == CUSTOM_OBJFUNC) {
+        SU2_MPI::Error("VECTOR_ADJOINT does not support CUSTOM_OBJFUNC.", CURRENT_FUNCTION);
+      }
+    }
+
+    if (Primal_Tape_Reuse) {
+      if (Multizone_Problem || !GetFluidProblem() || Time_Domain || Deform_Mesh) {
+        SU2_MPI::Error("PRIMAL_TAPE_REUSE is only available for steady single zone fluid problems without mesh deformation.",
+                       CURRENT_FUNCTION);
+      }
+      if (val_software == SU2_COMPONENT::SU2_CFD && !AD::PrimalTapeAvailable()) {
+        SU2_MPI::Error("PRIMAL_TAPE_REUSE requires a primal value tape (-Dcodi-tape=PrimalLinear, PrimalReuse, or PrimalMultiUse).",
+                       CURRENT_FUNCTION);
+      }
+    }
+
+    if (Inline_Gradient_Projection) {
+      if (Multizone_Problem || !GetFluidProblem() || Time_Domain) {
+        SU2_MPI::Error("INLINE_GRADIENT_PROJECTION is only available for steady single zone fluid problems.",
+                       CURRENT_FUNCTION);
+      }
+      if (nDV == 0 || Design_Variable[0] == NO_DEFORMATION || Design_Variable[0] == SURFACE_FILE) {
+        SU2_MPI::Error("INLINE_GRADIENT_PROJECTION requires design variables (DV_KIND).", CURRENT_FUNCTION);
+      }
+      if (SmoothGradient || Vector_Adjoint || Primal_Tape_Reuse) {
+        SU2_MPI::Error("INLINE_GRADIENT_PROJECTION cannot be combined with SMOOTH_GRADIENT, VECTOR_ADJOINT, or\n"
+                       "PRIMAL_TAPE_REUSE, use SU2_DOT_AD instead.", CURRENT_FUNCTION);
+      }
     }
 
     /*--- Note that this is deliberately done at the end of this routine! ---*/
@@ -5463,12 +6002,138 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error(string("CFL adaption minimum CFL is larger than the maximum CFL."), CURRENT_FUNCTION);
   }
 
+  if (TimeParallelGroups > 1) {
+    if ((TimeMarching != TIME_MARCHING::DT_STEPPING_1ST) && (TimeMarching != TIME_MARCHING::DT_STEPPING_2ND)) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS requires dual time stepping.", CURRENT_FUNCTION);
+    }
+    if (Multizone_Problem || DiscreteAdjoint || ContinuousAdjoint || GetGrid_Movement() || Deform_Mesh) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS is only available for primal single zone problems on fixed grids.",
+                     CURRENT_FUNCTION);
+    }
+    const auto nSlicedIter = nTimeIter - (Restart ? Restart_Iter : 0);
+    if ((Parareal_Coarsening == 0) || (nSlicedIter % (TimeParallelGroups * Parareal_Coarsening) != 0)) {
+      SU2_MPI::Error("The number of time iterations must be a multiple of TIME_PARALLEL_GROUPS x PARAREAL_COARSENING.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  if (EnsembleGroups == 0 || (nEnsemble_Configs > 0 && EnsembleGroups > nEnsemble_Configs)) {
+    SU2_MPI::Error("ENSEMBLE_GROUPS must be at least 1 and not exceed the number of ENSEMBLE_CONFIGS.",
+                   CURRENT_FUNCTION);
+  }
+
+  if (Hardware_Counters && !Runtime_Profiling) {
+    SU2_MPI::Error("HARDWARE_COUNTERS requires RUNTIME_PROFILING= YES.", CURRENT_FUNCTION);
+  }
+
+  if (Time_Extrapolation && (Time_Extrapolation_Tol <= 1.0)) {
+    SU2_MPI::Error("TIME_EXTRAPOLATION_TOL must be larger than 1.", CURRENT_FUNCTION);
+  }
+
+  if (ResidualSmoothing && (Kind_TimeIntScheme_Flow != RUNGE_KUTTA_EXPLICIT) &&
+      (Kind_TimeIntScheme_Flow != EULER_EXPLICIT) && (Kind_TimeIntScheme_Flow != CLASSICAL_RK4_EXPLICIT)) {
+    SU2_MPI::Error("RESIDUAL_SMOOTHING is only available for explicit flow schemes.", CURRENT_FUNCTION);
+  }
+
+  if (LineImplicitSmoothing) {
+    if ((Kind_TimeIntScheme_Flow != RUNGE_KUTTA_EXPLICIT) && (Kind_TimeIntScheme_Flow != EULER_EXPLICIT) &&
+        (Kind_TimeIntScheme_Flow != CLASSICAL_RK4_EXPLICIT)) {
+      SU2_MPI::Error("LINE_IMPLICIT_SMOOTHING is only available for explicit flow schemes.", CURRENT_FUNCTION);
+    }
+    if (ResidualSmoothing || (TimeMarching == TIME_MARCHING::TIME_STEPPING)) {
+      SU2_MPI::Error("LINE_IMPLICIT_SMOOTHING cannot be combined with RESIDUAL_SMOOTHING or TIME_STEPPING.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  if (Kind_ROMProjection != ROM_PROJECTION::NONE) {
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) {
+      SU2_MPI::Error("ROM_PROJECTION requires an implicit flow solver.", CURRENT_FUNCTION);
+    }
+    if (DiscreteAdjoint || libROM) {
+      SU2_MPI::Error("ROM_PROJECTION is not compatible with discrete adjoints or SAVE_LIBROM.", CURRENT_FUNCTION);
+    }
+    if (nMGLevels != 0) {
+      SU2_MPI::Error("ROM_PROJECTION requires MGLEVEL= 0, the POD basis is only defined on the fine grid.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  if (CFL_Adapt && (Kind_CFL_Adapt == CFL_ADAPT_METHOD::LOCAL_RESIDUAL)) {
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) {
+      SU2_MPI::Error("CFL_ADAPT_METHOD= LOCAL_RESIDUAL requires an implicit flow solver.", CURRENT_FUNCTION);
+    }
+    if ((CFL_AdaptLocalParam[0] <= 0.0) || (CFL_AdaptLocalParam[1] <= 0.0)) {
+      SU2_MPI::Error("The parameters of CFL_ADAPT_LOCAL_PARAM must be positive.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (ActiveSet) {
+    if (Time_Domain || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (nMGLevels != 0) || DiscreteAdjoint ||
+        ContinuousAdjoint) {
+      SU2_MPI::Error("ACTIVE_SET requires a steady primal problem with an implicit flow solver and no multigrid.",
+                     CURRENT_FUNCTION);
+    }
+    if ((ActiveSetParam[0] <= 0.0) || (ActiveSetParam[1] < 1.0) || (ActiveSetParam[2] < 0.0)) {
+      SU2_MPI::Error("Invalid ACTIVE_SET_PARAM, the threshold must be positive and the iterations at least 1.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  if (Coupled_Turb_Solve) {
+    if ((Kind_Solver != MAIN_SOLVER::RANS) && (Kind_Solver != MAIN_SOLVER::INC_RANS)) {
+      SU2_MPI::Error("COUPLED_TURBULENCE_SOLVE is only available for the primal RANS and INC_RANS solvers.",
+                     CURRENT_FUNCTION);
+    }
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (Kind_TimeIntScheme_Turb != EULER_IMPLICIT)) {
+      SU2_MPI::Error("COUPLED_TURBULENCE_SOLVE requires implicit flow and turbulence solvers.", CURRENT_FUNCTION);
+    }
+    if ((nMGLevels != 0) || NonlinearAcceleration) {
+      SU2_MPI::Error("COUPLED_TURBULENCE_SOLVE cannot be combined with multigrid or NONLINEAR_ACCELERATION.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
+  if (NonlinearAcceleration) {
+    if (DiscreteAdjoint || ContinuousAdjoint) {
+      SU2_MPI::Error("NONLINEAR_ACCELERATION is only available for primal problems.", CURRENT_FUNCTION);
+    }
+    if (NonlinearAccelerationDepth < 1) {
+      SU2_MPI::Error("NONLINEAR_ACCELERATION_DEPTH must be at least 1.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- 0 in the config file means "disable" which can be done using a very large group. ---*/
   if (edgeColorGroupSize==0) edgeColorGroupSize = 1<<30;
 
   /*--- Specifying a deforming surface requires a mesh deformation solver. ---*/
   if (GetSurface_Movement(DEFORMING)) Deform_Mesh = true;
 
+  /*--- The frozen P1 system depends on the geometry. ---*/
+  if (Radiation && Radiation_Frozen_System && (GetDynamic_Grid() || DiscreteAdjoint)) {
+    SU2_MPI::Error("RADIATION_FROZEN_SYSTEM requires a static mesh and is not compatible with the discrete adjoint.",
+                   CURRENT_FUNCTION);
+  }
+
+  if (ActDisk_BodyForce) {
+    if (Kind_Solver != MAIN_SOLVER::EULER && Kind_Solver != MAIN_SOLVER::NAVIER_STOKES &&
+        Kind_Solver != MAIN_SOLVER::RANS && Kind_Solver != MAIN_SOLVER::DISC_ADJ_EULER &&
+        Kind_Solver != MAIN_SOLVER::DISC_ADJ_NAVIER_STOKES && Kind_Solver != MAIN_SOLVER::DISC_ADJ_RANS) {
+      SU2_MPI::Error("ACTDISK_BODY_FORCE is only available for the compressible (finite volume) flow solvers.",
+                     CURRENT_FUNCTION);
+    }
+    if (ActDisk_BodyForce_Thickness <= 0.0) {
+      SU2_MPI::Error("ACTDISK_BODY_FORCE requires a positive ACTDISK_BODY_FORCE_THICKNESS.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The frozen conduction matrix depends on the geometry and on the (constant) time step. ---*/
+  if (Heat_Frozen_System && (GetDynamic_Grid() || Deform_Mesh || DiscreteAdjoint || CFL_Adapt ||
+                             nMarker_PerBound > 0)) {
+    SU2_MPI::Error("HEAT_FROZEN_SYSTEM requires a static, non-periodic mesh, a constant CFL, and is not compatible\n"
+                   "with the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
   monoatomic = GetGasModel() == "ARGON";
 
   /*--- Set number of Turbulence Variables. ---*/
@@ -7082,8 +7747,21 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_FGMRES:
+            case RECYCLED_FGMRES:
+            case DEVICE_BCGSTAB:
+            case PETSC:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == DEVICE_BCGSTAB)
+                cout << "BCGSTAB is used for solving the linear system on the accelerator (if available)." << endl;
+              else if (Kind_Linear_Solver == PETSC)
+                cout << "PETSc is used for solving the linear system (see PETSC_OPTIONS)." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == RECYCLED_FGMRES)
+                cout << "FGMRES with " << Linear_Solver_Recycle_Size
+                     << " recycled vectors is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -7091,6 +7769,9 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an AMG(" << Linear_Solver_AMG_Levels << " levels) preconditioning."<< endl; break;
+                case SA_AMG:  cout << "Using a smoothed aggregation AMG(" << Linear_Solver_AMG_Levels
+                                   << " levels) preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -7099,12 +7780,22 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An AMG"; break;
+                case SA_AMG:  cout << "A smoothed aggregation AMG"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
           }
           cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
           cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
+          if (Linear_Solver_Refinement_Iter > 0) {
+#ifdef USE_MIXED_PRECISION
+            cout << "Max number of iterative refinement steps: " << Linear_Solver_Refinement_Iter << "." << endl;
+#else
+            cout << "WARNING: LINEAR_SOLVER_MIXED_REFINEMENT has no effect, the Jacobian is only stored in single\n"
+                    "precision in builds with mixed precision linear algebra (-Denable-mixedprec=true)." << endl;
+#endif
+          }
           break;
         case CLASSICAL_RK4_EXPLICIT:
           cout << "Classical RK4 explicit method for the flow equations." << endl;
@@ -7128,7 +7819,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_FGMRES: case RECYCLED_FGMRES:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -7178,6 +7869,14 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
 
+        case EULER_IMPLICIT:
+          cout << "Jacobian-free Newton-Krylov implicit method for the flow equations." << endl;
+          cout << "Max number of Newton iterations: " << JFNK_Newton_Iter << "." << endl;
+          cout << "Relative tolerance of the Newton iterations: " << JFNK_Newton_Tol << "." << endl;
+          cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+          cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
+          break;
+
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
             cout << "ADER-DG for the flow equations with global time stepping." << endl;
@@ -7223,6 +7922,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
 
       cout << "Damping factor for the residual restriction: " << Damp_Res_Restric <<"."<< endl;
       cout << "Damping factor for the correction prolongation: " << Damp_Correc_Prolong <<"."<< endl;
+      if (MG_ScalarSolvers) cout << "The turbulence and species solvers also use the multigrid cycle." << endl;
     }
 
     if ((Kind_Solver != MAIN_SOLVER::FEM_ELASTICITY) && (Kind_Solver != MAIN_SOLVER::DISC_ADJ_FEM)) {
@@ -7231,6 +7931,9 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
       else cout << "CFL adaptation. Factor down: "<< CFL_AdaptParam[0] <<", factor up: "<< CFL_AdaptParam[1]
         <<",\n                lower limit: "<< CFL_AdaptParam[2] <<", upper limit: " << CFL_AdaptParam[3]
         <<",\n                acceptable linear residual: "<< CFL_AdaptParam[4] << "." << endl;
+      if (CFL_Adapt && (Kind_CFL_Adapt == CFL_ADAPT_METHOD::LOCAL_RESIDUAL))
+        cout << "Local residual CFL adaption. Exponent: " << CFL_AdaptLocalParam[0]
+             << ", backtracking tolerance: " << CFL_AdaptLocalParam[1] << " orders of magnitude." << endl;
 
       if (nMGLevels !=0) {
         PrintingToolbox::CTablePrinter MGTable(&std::cout);
@@ -8115,6 +8818,8 @@ CConfig::~CConfig() {
     delete itr->second;
   }
 
+  delete [] DirectDiff_List;
+
   delete [] TimeDOFsADER_DG;
   delete [] TimeIntegrationADER_DG;
   delete [] WeightsIntegrationADER_DG;
@@ -8348,7 +9053,7 @@ string CConfig::GetFilename(string filename, const string& ext, int timeIter) co
     filename = GetMultiInstance_FileName(filename, GetiInst(), ext);
 
   /*--- Append the iteration number for unsteady problems ---*/
-  if (GetTime_Domain()){
+  if (GetTime_Domain() && timeIter >= 0){
     filename = GetUnsteady_FileName(filename, timeIter, ext);
   }
 
@@ -8462,48 +9167,7 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
     Filename = Filename.substr(0, lastindex);
 
     if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
-        case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
-        case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
-        case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
-        case INVERSE_DESIGN_PRESSURE:     AdjExt = "_invpress"; break;
-        case INVERSE_DESIGN_HEATFLUX:     AdjExt = "_invheat";  break;
-        case MOMENT_X_COEFFICIENT:        AdjExt = "_cmx";      break;
-        case MOMENT_Y_COEFFICIENT:        AdjExt = "_cmy";      break;
-        case MOMENT_Z_COEFFICIENT:        AdjExt = "_cmz";      break;
-        case EFFICIENCY:                  AdjExt = "_eff";      break;
-        case EQUIVALENT_AREA:             AdjExt = "_ea";       break;
-        case NEARFIELD_PRESSURE:          AdjExt = "_nfp";      break;
-        case FORCE_X_COEFFICIENT:         AdjExt = "_cfx";      break;
-        case FORCE_Y_COEFFICIENT:         AdjExt = "_cfy";      break;
-        case FORCE_Z_COEFFICIENT:         AdjExt = "_cfz";      break;
-        case THRUST_COEFFICIENT:          AdjExt = "_ct";       break;
-        case TORQUE_COEFFICIENT:          AdjExt = "_cq";       break;
-        case TOTAL_HEATFLUX:              AdjExt = "_totheat";  break;
-        case MAXIMUM_HEATFLUX:            AdjExt = "_maxheat";  break;
-        case AVG_TEMPERATURE:             AdjExt = "_avtp";     break;
-        case FIGURE_OF_MERIT:             AdjExt = "_merit";    break;
-        case BUFFET_SENSOR:               AdjExt = "_buffet";   break;
-        case SURFACE_TOTAL_PRESSURE:      AdjExt = "_pt";       break;
-        case SURFACE_STATIC_PRESSURE:     AdjExt = "_pe";       break;
-        case SURFACE_STATIC_TEMPERATURE:  AdjExt = "_T";        break;
-        case SURFACE_MASSFLOW:            AdjExt = "_mfr";      break;
-        case SURFACE_UNIFORMITY:          AdjExt = "_uniform";  break;
-        case SURFACE_SECONDARY:           AdjExt = "_second";   break;
-        case SURFACE_MOM_DISTORTION:      AdjExt = "_distort";  break;
-        case SURFACE_SECOND_OVER_UNIFORM: AdjExt = "_sou";      break;
-        case SURFACE_PRESSURE_DROP:       AdjExt = "_dp";       break;
-        case SURFACE_SPECIES_0:           AdjExt = "_avgspec0"; break;
-        case SURFACE_SPECIES_VARIANCE:    AdjExt = "_specvar";  break;
-        case SURFACE_MACH:                AdjExt = "_mach";     break;
-        case CUSTOM_OBJFUNC:              AdjExt = "_custom";   break;
-        case REFERENCE_GEOMETRY:          AdjExt = "_refgeom";  break;
-        case REFERENCE_NODE:              AdjExt = "_refnode";  break;
-        case VOLUME_FRACTION:             AdjExt = "_volfrac";  break;
-        case TOPOL_DISCRETENESS:          AdjExt = "_topdisc";  break;
-        case TOPOL_COMPLIANCE:            AdjExt = "_topcomp";  break;
-        case STRESS_PENALTY:              AdjExt = "_stress";   break;
-      }
+      AdjExt = GetObjFunc_Suffix(0);
     }
     else{
       AdjExt = "_combo";
@@ -8518,6 +9182,76 @@ string CConfig::GetObjFunc_Extension(string val_filename) const {
   return Filename;
 }
 
+string CConfig::GetDirectDiff_Name(unsigned short iDir) const {
+  for (const auto& entry : DirectDiff_Var_Map) {
+    if (entry.second == DirectDiff_List[iDir]) return entry.first;
+  }
+  return to_string(iDir);
+}
+
+string CConfig::GetDesign_Variable_Name(unsigned short iDV) const {
+  for (const auto& entry : Param_Map) {
+    if (entry.second == Design_Variable[iDV]) return entry.first;
+  }
+  return to_string(Design_Variable[iDV]);
+}
+
+string CConfig::GetObjFunc_Name(unsigned short iObj) const {
+  for (const auto& entry : Objective_Map) {
+    if (entry.second == Kind_ObjFunc[iObj]) return entry.first;
+  }
+  return to_string(Kind_ObjFunc[iObj]);
+}
+
+string CConfig::GetObjFunc_Suffix(unsigned short iObj) const {
+
+  string ext;
+
+  switch (Kind_ObjFunc[iObj]) {
+    case DRAG_COEFFICIENT:            ext = "_cd";       break;
+    case LIFT_COEFFICIENT:            ext = "_cl";       break;
+    case SIDEFORCE_COEFFICIENT:       ext = "_csf";      break;
+    case INVERSE_DESIGN_PRESSURE:     ext = "_invpress"; break;
+    case INVERSE_DESIGN_HEATFLUX:     ext = "_invheat";  break;
+    case MOMENT_X_COEFFICIENT:        ext = "_cmx";      break;
+    case MOMENT_Y_COEFFICIENT:        ext = "_cmy";      break;
+    case MOMENT_Z_COEFFICIENT:        ext = "_cmz";      break;
+    case EFFICIENCY:                  ext = "_eff";      break;
+    case EQUIVALENT_AREA:             ext = "_ea";       break;
+    case NEARFIELD_PRESSURE:          ext = "_nfp";      break;
+    case FORCE_X_COEFFICIENT:         ext = "_cfx";      break;
+    case FORCE_Y_COEFFICIENT:         ext = "_cfy";      break;
+    case FORCE_Z_COEFFICIENT:         ext = "_cfz";      break;
+    case THRUST_COEFFICIENT:          ext = "_ct";       break;
+    case TORQUE_COEFFICIENT:          ext = "_cq";       break;
+    case TOTAL_HEATFLUX:              ext = "_totheat";  break;
+    case MAXIMUM_HEATFLUX:            ext = "_maxheat";  break;
+    case AVG_TEMPERATURE:             ext = "_avtp";     break;
+    case FIGURE_OF_MERIT:             ext = "_merit";    break;
+    case BUFFET_SENSOR:               ext = "_buffet";   break;
+    case SURFACE_TOTAL_PRESSURE:      ext = "_pt";       break;
+    case SURFACE_STATIC_PRESSURE:     ext = "_pe";       break;
+    case SURFACE_STATIC_TEMPERATURE:  ext = "_T";        break;
+    case SURFACE_MASSFLOW:            ext = "_mfr";      break;
+    case SURFACE_UNIFORMITY:          ext = "_uniform";  break;
+    case SURFACE_SECONDARY:           ext = "_second";   break;
+    case SURFACE_MOM_DISTORTION:      ext = "_distort";  break;
+    case SURFACE_SECOND_OVER_UNIFORM: ext = "_sou";      break;
+    case SURFACE_PRESSURE_DROP:       ext = "_dp";       break;
+    case SURFACE_SPECIES_0:           ext = "_avgspec0"; break;
+    case SURFACE_SPECIES_VARIANCE:    ext = "_specvar";  break;
+    case SURFACE_MACH:                ext = "_mach";     break;
+    case CUSTOM_OBJFUNC:              ext = "_custom";   break;
+    case REFERENCE_GEOMETRY:          ext = "_refgeom";  break;
+    case REFERENCE_NODE:              ext = "_refnode";  break;
+    case VOLUME_FRACTION:             ext = "_volfrac";  break;
+    case TOPOL_DISCRETENESS:          ext = "_topdisc";  break;
+    case TOPOL_COMPLIANCE:            ext = "_topcomp";  break;
+    case STRESS_PENALTY:              ext = "_stress";   break;
+  }
+  return ext;
+}
+
 unsigned short CConfig::GetContainerPosition(unsigned short val_eqsystem) {
 
   switch (val_eqsystem) {
@@ -30,6 +30,8 @@
 #include "../../include/adt/CADTComparePointClass.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 
 void CADTBaseClass::BuildADT(unsigned short nDim, unsigned long nPoints, const su2double* coor) {
   /*---  Determine the number of leaves. It can be proved that nLeaves equals
@@ -204,3 +206,45 @@ void CADTBaseClass::BuildADT(unsigned short nDim, unsigned long nPoints, const s
     for (unsigned long i = 0; i < nPointIDs[nLeavesToDivide]; ++i) pointIDs[i] = pointIDsNew[i];
   }
 }
+
+vector<unsigned long> CADTBaseClass::SpatialOrder(unsigned short nDim, unsigned long nPoints, const su2double* coor,
+                                                  unsigned long stride) {
+  vector<unsigned long> order(nPoints);
+  for (unsigned long i = 0; i < nPoints; ++i) order[i] = i;
+  if (nPoints < 2 || nDim == 0) return order;
+
+  /*--- Bounding box of the points, used to quantize the coordinates. ---*/
+  vector<passivedouble> xMin(nDim, numeric_limits<passivedouble>::max());
+  vector<passivedouble> xMax(nDim, numeric_limits<passivedouble>::lowest());
+  for (unsigned long i = 0; i < nPoints; ++i) {
+    for (unsigned short l = 0; l < nDim; ++l) {
+      const passivedouble x = SU2_TYPE::GetValue(coor[i * stride + l]);
+      xMin[l] = min(xMin[l], x);
+      xMax[l] = max(xMax[l], x);
+    }
+  }
+
+  /*--- Interleave the bits of the quantized coordinates (at most the first
+        three) to obtain the Morton key. ---*/
+  const unsigned short nKey = min<unsigned short>(nDim, 3);
+  const unsigned short nBits = min(21, 63 / nKey);
+  const passivedouble maxInt = (uint64_t(1) << nBits) - 1;
+
+  vector<pair<uint64_t, unsigned long> > keys(nPoints);
+  SU2_OMP_PARALLEL_(for schedule(static, QueryBlockSize))
+  for (unsigned long i = 0; i < nPoints; ++i) {
+    uint64_t quant[3] = {0, 0, 0}, key = 0;
+    for (unsigned short l = 0; l < nKey; ++l) {
+      const passivedouble range = xMax[l] - xMin[l];
+      if (range > 0) quant[l] = (SU2_TYPE::GetValue(coor[i * stride + l]) - xMin[l]) / range * maxInt;
+    }
+    for (int b = nBits - 1; b >= 0; --b)
+      for (unsigned short l = 0; l < nKey; ++l) key = (key << 1) | ((quant[l] >> b) & 1);
+    keys[i] = make_pair(key, i);
+  }
+  END_SU2_OMP_PARALLEL
+
+  sort(keys.begin(), keys.end());
+  for (unsigned long i = 0; i < nPoints; ++i) order[i] = keys[i].second;
+  return order;
+}
@@ -34,11 +34,56 @@ const su2double tolInsideElem = 1.e-10;
 const su2double paramLowerBound = -1.0 - tolInsideElem;
 const su2double paramUpperBound = 1.0 + tolInsideElem;
 
+namespace {
+/*--- The tree traversals only compare coordinates and distances, they are done in passive arithmetic, which
+ * avoids the overhead of the AD types (the distance to the element that is found is computed with them). ---*/
+
+/*!
+ * \brief Possible (lower bound) squared distance from a point to a box, 0 if the point is inside.
+ */
+inline passivedouble PossibleDist2(unsigned short nDim, const passivedouble* x, const su2double* bbMin,
+                                   const su2double* bbMax) {
+  passivedouble dist2 = 0.0;
+  for (unsigned short k = 0; k < nDim; ++k) {
+    const passivedouble ds =
+        min(0.0, x[k] - SU2_TYPE::GetValue(bbMin[k])) + max(0.0, x[k] - SU2_TYPE::GetValue(bbMax[k]));
+    dist2 += ds * ds;
+  }
+  return dist2;
+}
+
+/*!
+ * \brief Guaranteed (upper bound) squared distance from a point to the nearest object in a box.
+ */
+inline passivedouble GuaranteedDist2(unsigned short nDim, const passivedouble* x, const su2double* bbMin,
+                                     const su2double* bbMax) {
+  passivedouble dist2 = 0.0;
+  for (unsigned short k = 0; k < nDim; ++k) {
+    const passivedouble ds = max(fabs(x[k] - SU2_TYPE::GetValue(bbMin[k])), fabs(x[k] - SU2_TYPE::GetValue(bbMax[k])));
+    dist2 += ds * ds;
+  }
+  return dist2;
+}
+
+/*!
+ * \brief Whether a point is inside a box.
+ */
+inline bool InsideBox(unsigned short nDim, const passivedouble* x, const su2double* bbMin, const su2double* bbMax) {
+  bool inside = true;
+  for (unsigned short k = 0; k < nDim; ++k) {
+    if (x[k] < SU2_TYPE::GetValue(bbMin[k])) inside = false;
+    if (x[k] > SU2_TYPE::GetValue(bbMax[k])) inside = false;
+  }
+  return inside;
+}
+}  // namespace
+
 CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coor, vector<unsigned long>& val_connElem,
                              vector<unsigned short>& val_VTKElem, vector<unsigned short>& val_markerID,
                              vector<unsigned long>& val_elemID, const bool globalTree) {
   /* Copy the dimension of the problem into nDim. */
   nDim = val_nDim;
+  isGlobal = globalTree;
 
   /* Allocate some thread-safe working variables if required. */
 #ifdef HAVE_OMP
@@ -260,10 +305,31 @@ CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coo
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
+void CADTElemClass::GetBoundingBox(passivedouble* bbMin, passivedouble* bbMax) const {
+  for (unsigned short k = 0; k < nDim; ++k) {
+    bbMin[k] = numeric_limits<passivedouble>::max();
+    bbMax[k] = numeric_limits<passivedouble>::lowest();
+  }
+
+  /*--- The element bounding boxes already include the tolerance for round off. ---*/
+  const unsigned long nElem = elemVTK_Type.size();
+  for (unsigned long i = 0; i < nElem; ++i) {
+    const su2double* BBMin = BBoxCoor.data() + 2 * nDim * i;
+    const su2double* BBMax = BBMin + nDim;
+    for (unsigned short k = 0; k < nDim; ++k) {
+      bbMin[k] = min(bbMin[k], SU2_TYPE::GetValue(BBMin[k]));
+      bbMax[k] = max(bbMax[k], SU2_TYPE::GetValue(BBMax[k]));
+    }
+  }
+}
+
 bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& frontLeaves,
                                                     vector<unsigned long>& frontLeavesNew, const su2double* coor,
                                                     unsigned short& markerID, unsigned long& elemID, int& rankID,
                                                     su2double* parCoor, su2double* weightsInterpol) const {
+  passivedouble x[3] = {0.0};
+  for (unsigned short k = 0; k < nDim; ++k) x[k] = SU2_TYPE::GetValue(coor[k]);
+
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
      previous search. */
@@ -289,13 +355,7 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
           const su2double* coorBBMin = BBoxCoor.data() + nDimADT * kk;
           const su2double* coorBBMax = coorBBMin + nDim;
 
-          bool coorIsInside = true;
-          for (unsigned short k = 0; k < nDim; ++k) {
-            if (coor[k] < coorBBMin[k]) coorIsInside = false;
-            if (coor[k] > coorBBMax[k]) coorIsInside = false;
-          }
-
-          if (coorIsInside) {
+          if (InsideBox(nDim, x, coorBBMin, coorBBMax)) {
             /* Coordinate is inside the bounding box. Check if it
                is also inside the corresponding element. If so,
                set the required information and return true. */
@@ -312,13 +372,7 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
           const su2double* coorBBMin = leaves[kk].xMin;
           const su2double* coorBBMax = leaves[kk].xMax + nDim;
 
-          bool coorIsInside = true;
-          for (unsigned short k = 0; k < nDim; ++k) {
-            if (coor[k] < coorBBMin[k]) coorIsInside = false;
-            if (coor[k] > coorBBMax[k]) coorIsInside = false;
-          }
-
-          if (coorIsInside) frontLeavesNew.push_back(kk);
+          if (InsideBox(nDim, x, coorBBMin, coorBBMax)) frontLeavesNew.push_back(kk);
         }
       }
     }
@@ -336,13 +390,45 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
   return false;
 }
 
-void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
-                                                 vector<unsigned long>& frontLeaves,
-                                                 vector<unsigned long>& frontLeavesNew, const su2double* coor,
-                                                 su2double& dist, unsigned short& markerID, unsigned long& elemID,
-                                                 int& rankID) const {
+void CADTElemClass::DetermineNearestElements(unsigned long nQuery, const su2double* coor, unsigned long stride,
+                                             su2double* dist, unsigned short* markerID, unsigned long* elemID,
+                                             int* rankID) {
+  const auto order = SpatialOrder(nDim, nQuery, coor, stride);
+  const unsigned long nBlocks = roundUpDiv(nQuery, QueryBlockSize);
+
+  SU2_OMP_PARALLEL {
+    const auto iThread = omp_get_thread_num();
+
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+      /*--- The queries of a block are close to each other, each one starts from the result of the previous. ---*/
+      unsigned long seedElem = numeric_limits<unsigned long>::max();
+      const unsigned long end = min(nQuery, (iBlock + 1) * QueryBlockSize);
+
+      for (unsigned long i = iBlock * QueryBlockSize; i < end; ++i) {
+        const auto q = order[i];
+        seedElem = DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                                coor + q * stride, dist[q], markerID[q], elemID[q], rankID[q],
+                                                seedElem);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+unsigned long CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
+                                                          vector<unsigned long>& frontLeaves,
+                                                          vector<unsigned long>& frontLeavesNew,
+                                                          const su2double* coor, su2double& dist,
+                                                          unsigned short& markerID, unsigned long& elemID,
+                                                          int& rankID, unsigned long seedElem) const {
   const bool wasActive = AD::BeginPassive();
 
+  /*--- The search is done with the passive values of the coordinates and distances. ---*/
+  passivedouble x[3] = {0.0};
+  for (unsigned short k = 0; k < nDim; ++k) x[k] = SU2_TYPE::GetValue(coor[k]);
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the distance (squared) to the quaranteed distance ---*/
   /*---         of the central bounding box of the root element.             ---*/
@@ -353,15 +439,21 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
   const su2double* coorBBMax = coorBBMin + nDim;
   unsigned long jj = 0;
 
-  dist = 0.0;
-  su2double ds;
-  ds = max(fabs(coor[0] - coorBBMin[0]), fabs(coor[0] - coorBBMax[0]));
-  dist += ds * ds;
-  ds = max(fabs(coor[1] - coorBBMin[1]), fabs(coor[1] - coorBBMax[1]));
-  dist += ds * ds;
-  if (nDim == 3) {
-    ds = max(fabs(coor[2] - coorBBMin[2]), fabs(coor[2] - coorBBMax[2]));
-    dist += ds * ds;
+  passivedouble minDist2 = GuaranteedDist2(nDim, x, coorBBMin, coorBBMax);
+
+  /*--- If an initial guess is given, its distance is an upper bound of the minimum distance,
+        usually much tighter than the guaranteed distance of the root. The guess is stored as
+        the result in case no other element is found in the traversal below. ---*/
+  if (seedElem < elemVTK_Type.size()) {
+    su2double dist2Seed;
+    Dist2ToElement(seedElem, coor, dist2Seed);
+    if (SU2_TYPE::GetValue(dist2Seed) <= minDist2) {
+      jj = seedElem;
+      minDist2 = SU2_TYPE::GetValue(dist2Seed);
+      markerID = localMarkers[jj];
+      elemID = localElemIDs[jj];
+      rankID = ranksOfElems[jj];
+    }
   }
 
   /*----------------------------------------------------------------------------*/
@@ -397,76 +489,42 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
           coorBBMin = BBoxCoor.data() + nDimADT * kk;
           coorBBMax = coorBBMin + nDim;
 
-          su2double posDist2 = 0.0, ds;
-          ds = min(0.0, coor[0] - coorBBMin[0]) + max(0.0, coor[0] - coorBBMax[0]);
-          posDist2 += ds * ds;
-          ds = min(0.0, coor[1] - coorBBMin[1]) + max(0.0, coor[1] - coorBBMax[1]);
-          posDist2 += ds * ds;
-          if (nDim == 3) {
-            ds = min(0.0, coor[2] - coorBBMin[2]) + max(0.0, coor[2] - coorBBMax[2]);
-            posDist2 += ds * ds;
-          }
+          const passivedouble posDist2 = PossibleDist2(nDim, x, coorBBMin, coorBBMax);
 
           /* Check if the possible minimum distance is less than or equal to
              the currently stored distance. If so, this bounding box is a
              candidate for the actual minimum distance and must be stored
              in BBoxTargets. */
-          if (posDist2 <= dist) {
+          if (posDist2 <= minDist2) {
             /*--- Compute the guaranteed minimum distance for this bounding box. ---*/
-            su2double guarDist2 = 0.0, ds;
-            ds = max(fabs(coor[0] - coorBBMin[0]), fabs(coor[0] - coorBBMax[0]));
-            guarDist2 += ds * ds;
-            ds = max(fabs(coor[1] - coorBBMin[1]), fabs(coor[1] - coorBBMax[1]));
-            guarDist2 += ds * ds;
-            if (nDim == 3) {
-              ds = max(fabs(coor[2] - coorBBMin[2]), fabs(coor[2] - coorBBMax[2]));
-              guarDist2 += ds * ds;
-            }
+            const passivedouble guarDist2 = GuaranteedDist2(nDim, x, coorBBMin, coorBBMax);
 
             /* Store this bounding box in BBoxTargets and update the currently
                stored value of the distance squared. */
             BBoxTargets.emplace_back(kk, posDist2, guarDist2);
-            dist = min(dist, guarDist2);
+            minDist2 = min(minDist2, guarDist2);
           }
         } else {
           /*--- Child contains a leaf. Determine the possible minimum distance
-                squared to that leaf. Same manual unroling as before. ---*/
+                squared to that leaf. ---*/
           coorBBMin = leaves[kk].xMin;
           coorBBMax = leaves[kk].xMax + nDim;
 
-          su2double posDist2 = 0.0, ds;
-          ds = min(0.0, coor[0] - coorBBMin[0]) + max(0.0, coor[0] - coorBBMax[0]);
-          posDist2 += ds * ds;
-          ds = min(0.0, coor[1] - coorBBMin[1]) + max(0.0, coor[1] - coorBBMax[1]);
-          posDist2 += ds * ds;
-          if (nDim == 3) {
-            ds = min(0.0, coor[2] - coorBBMin[2]) + max(0.0, coor[2] - coorBBMax[2]);
-            posDist2 += ds * ds;
-          }
+          const passivedouble posDist2 = PossibleDist2(nDim, x, coorBBMin, coorBBMax);
 
           /* Check if the possible minimum distance is less than or equal to the currently
              stored distance. If so this leaf must be stored for the next round. */
-          if (posDist2 <= dist) {
+          if (posDist2 <= minDist2) {
             frontLeavesNew.push_back(kk);
 
             /*--- Determine the guaranteed minimum distance squared to the central
                   bounding box of this leaf and update the currently stored
-                  minimum wall distance. Same manual unroling as before. ---*/
+                  minimum wall distance. ---*/
             kk = leaves[kk].centralNodeID;
             coorBBMin = BBoxCoor.data() + nDimADT * kk;
             coorBBMax = coorBBMin + nDim;
 
-            su2double guarDist2 = 0.0, ds;
-            ds = max(fabs(coor[0] - coorBBMin[0]), fabs(coor[0] - coorBBMax[0]));
-            guarDist2 += ds * ds;
-            ds = max(fabs(coor[1] - coorBBMin[1]), fabs(coor[1] - coorBBMax[1]));
-            guarDist2 += ds * ds;
-            if (nDim == 3) {
-              ds = max(fabs(coor[2] - coorBBMin[2]), fabs(coor[2] - coorBBMax[2]));
-              guarDist2 += ds * ds;
-            }
-
-            dist = min(dist, guarDist2);
+            minDist2 = min(minDist2, GuaranteedDist2(nDim, x, coorBBMin, coorBBMax));
           }
         }
       }
@@ -497,7 +555,7 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
        check the remainder of the bounding boxes, as they are sorted in
        increasing order (based on the possible minimum distance.
        Make sure that at least one bounding box is checked. */
-    if (BBoxTargets[i].possibleMinDist2 > dist) break;
+    if (BBoxTargets[i].possibleMinDist2 > minDist2) break;
 
     /*--- Compute the distance squared to the element that corresponds to the
           current bounding box. If this distance is less than or equal to
@@ -507,9 +565,9 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
 
     su2double dist2Elem;
     Dist2ToElement(ii, coor, dist2Elem);
-    if (dist2Elem <= dist) {
+    if (SU2_TYPE::GetValue(dist2Elem) <= minDist2) {
       jj = ii;
-      dist = dist2Elem;
+      minDist2 = SU2_TYPE::GetValue(dist2Elem);
       markerID = localMarkers[ii];
       elemID = localElemIDs[ii];
       rankID = ranksOfElems[ii];
@@ -518,10 +576,12 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
 
   AD::EndPassive(wasActive);
 
-  /* At the moment the square of the distance is stored in dist. Compute
-     the correct value. */
+  /* Compute the distance to the element that was found, with the AD types
+     (the search above only needed their values). */
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+
+  return jj;
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID, const su2double* coor, su2double* parCoor,
@@ -108,18 +108,45 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim, unsigned long nPoi
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
-void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
-                                                    vector<unsigned long>& frontLeavesNew, const su2double* coor,
-                                                    su2double& dist, unsigned long& pointID, int& rankID) const {
+void CADTPointsOnlyClass::DetermineNearestNodes(unsigned long nQuery, const su2double* coor, unsigned long stride,
+                                                su2double* dist, unsigned long* pointID, int* rankID) {
+  const auto order = SpatialOrder(nDimADT, nQuery, coor, stride);
+  const unsigned long nBlocks = roundUpDiv(nQuery, QueryBlockSize);
+
+  SU2_OMP_PARALLEL {
+    const auto iThread = omp_get_thread_num();
+
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+      /*--- The queries of a block are close to each other, each one starts from the result of the previous. ---*/
+      unsigned long seedNode = numeric_limits<unsigned long>::max();
+      const unsigned long end = min(nQuery, (iBlock + 1) * QueryBlockSize);
+
+      for (unsigned long i = iBlock * QueryBlockSize; i < end; ++i) {
+        const auto q = order[i];
+        seedNode = DetermineNearestNode_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor + q * stride, dist[q],
+                                             pointID[q], rankID[q], seedNode);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+unsigned long CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& frontLeaves,
+                                                             vector<unsigned long>& frontLeavesNew,
+                                                             const su2double* coor, su2double& dist,
+                                                             unsigned long& pointID, int& rankID,
+                                                             unsigned long seedNode) const {
   const bool wasActive = AD::BeginPassive();
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 1: Initialize the nearest node to the central node of the     ---*/
-  /*---         root leaf. Note that the distance is the distance squared  ---*/
-  /*---         to avoid a sqrt.                                           ---*/
+  /*--- Step 1: Initialize the nearest node to the initial guess or to the ---*/
+  /*---         central node of the root leaf. Note that the distance is   ---*/
+  /*---         the distance squared to avoid a sqrt.                      ---*/
   /*--------------------------------------------------------------------------*/
 
-  unsigned long kk = leaves[0].centralNodeID, minIndex;
+  unsigned long kk = (seedNode < localPointIDs.size()) ? seedNode : leaves[0].centralNodeID, minIndex;
   const su2double* coorTarget = coorPoints.data() + nDimADT * kk;
 
   pointID = localPointIDs[kk];
@@ -236,4 +263,6 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
   /* At the moment the distance squared to the nearest node is stored.
      Take the sqrt to obtain the correct value. */
   dist = sqrt(dist);
+
+  return minIndex;
 }
@@ -26,6 +26,10 @@
  */
 
 #include "../../include/basic_types/datatype_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <array>
+#include <iomanip>
 
 namespace AD {
 #ifdef CODI_REVERSE_TYPE
@@ -48,6 +52,91 @@ SU2_OMP(threadprivate(PreaccHelper))
 
 ExtFuncHelper FuncHelper;
 
+VectorAdjointHelper* VectorAdjoints = nullptr;
+unsigned short AdjointDirection = 0;
+
+void BeginVectorMode() {
+#ifdef HAVE_OPDI
+  SU2_MPI::Error("The vector mode is not available with OpenMP.", CURRENT_FUNCTION);
+#endif
+  if (!VectorAdjoints) VectorAdjoints = new VectorAdjointHelper();
+  AdjointDirection = 0;
+}
+
+void EndVectorMode() {
+  delete VectorAdjoints;
+  VectorAdjoints = nullptr;
+  AdjointDirection = 0;
+}
+
+bool TapeSectionsEnabled = false;
+unsigned short TapeSectionDepth = 0;
+std::vector<TapeSectionMark> TapeSectionMarks;
+
+namespace {
+/*--- Reverse evaluation time of each section, accumulated over the evaluations of the tape. ---*/
+std::array<passivedouble, nTapeSections> TapeSectionTimes{};
+unsigned long TapeSectionEvaluations = 0;
+
+/*--- Wall time spent recording the tape, and start of the current recording (negative if not recording). ---*/
+passivedouble RecordingTime = 0.0;
+passivedouble RecordingStart = -1.0;
+}  // namespace
+
+void MarkTapeSection(TapeSection section) {
+  if (!getTape().isActive()) return;
+  TapeSectionMarks.push_back({section, getTape().getPosition(), getTape().getTapeValues().getUsedMemorySize()});
+}
+
+void ComputeAdjointBySection() {
+  /*--- Evaluate the tape from the end, one section at a time. ---*/
+  auto end = getTape().getPosition();
+
+  for (auto iMark = TapeSectionMarks.size(); iMark-- > 0;) {
+    const auto& mark = TapeSectionMarks[iMark];
+    const auto start = SU2_MPI::Wtime();
+    getTape().evaluate(end, mark.position);
+    TapeSectionTimes[static_cast<unsigned short>(mark.section)] += SU2_MPI::Wtime() - start;
+    end = mark.position;
+  }
+  const auto start = SU2_MPI::Wtime();
+  getTape().evaluate(end, getTape().getZeroPosition());
+  TapeSectionTimes[static_cast<unsigned short>(TapeSection::OTHER)] += SU2_MPI::Wtime() - start;
+
+  ++TapeSectionEvaluations;
+}
+
+void ComputeAdjointTimed() {
+  const auto start = SU2_MPI::Wtime();
+#ifdef HAVE_OPDI
+  opdi::logic->prepareEvaluate();
+#endif
+  getTape().evaluate();
+#ifdef HAVE_OPDI
+  opdi::logic->postEvaluate();
+#endif
+  TapeSectionTimes[static_cast<unsigned short>(TapeSection::OTHER)] += SU2_MPI::Wtime() - start;
+  ++TapeSectionEvaluations;
+}
+
+void TimeRecording(bool start) {
+  if (start) {
+    RecordingStart = SU2_MPI::Wtime();
+  } else if (RecordingStart >= 0.0) {
+    RecordingTime += SU2_MPI::Wtime() - RecordingStart;
+    RecordingStart = -1.0;
+  }
+}
+
+void ResetTapeSections() {
+  TapeSectionDepth = 0;
+  TapeSectionMarks.clear();
+  TapeSectionTimes.fill(0.0);
+  TapeSectionEvaluations = 0;
+  RecordingTime = 0.0;
+  RecordingStart = -1.0;
+}
+
 #endif
 
 void Initialize() {
@@ -59,4 +148,108 @@ void Initialize() {
 
 void Finalize() { AD::Reset(); }
 
+void PrintTapeSectionStatistics(bool printingRank, bool evaluated) {
+#ifdef CODI_REVERSE_TYPE
+  if (!TapeSectionsEnabled || (evaluated && TapeSectionEvaluations == 0)) return;
+
+  std::array<passivedouble, nTapeSections> maxTime{};
+  SU2_MPI::Allreduce(TapeSectionTimes.data(), maxTime.data(), nTapeSections, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  passivedouble totalTime = 0.0;
+  for (auto t : maxTime) totalTime += t;
+
+#ifndef HAVE_OPDI
+  /*--- Memory of each section from the memory used at its marks, the tape starts in the "other" section. ---*/
+
+  std::array<passivedouble, nTapeSections> memory{};
+  auto section = TapeSection::OTHER;
+  double previous = 0.0;
+
+  for (const auto& mark : TapeSectionMarks) {
+    memory[static_cast<unsigned short>(section)] += mark.memory - previous;
+    section = mark.section;
+    previous = mark.memory;
+  }
+  memory[static_cast<unsigned short>(section)] += getTape().getTapeValues().getUsedMemorySize() - previous;
+
+  std::array<passivedouble, nTapeSections> globalMemory{};
+  SU2_MPI::Allreduce(memory.data(), globalMemory.data(), nTapeSections, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  passivedouble totalMemory = 0.0;
+  for (auto mem : globalMemory) totalMemory += mem;
+
+  if (printingRank && totalMemory > 0.0) {
+    static const char* names[nTapeSections] = {"Gradients",        "Limiters",            "Convective residual",
+                                               "Viscous residual", "Boundary conditions", "Turbulence",
+                                               "Mesh deformation", "Other"};
+
+    std::cout << "-------------------------------------------------------\n";
+    std::cout << "  Tape sections\n";
+#ifdef HAVE_MPI
+    std::cout << "  (memory summed, time maximized across MPI processes)\n";
+#endif
+    if (TapeSectionEvaluations > 0) {
+      std::cout << "  (reverse time averaged over " << TapeSectionEvaluations << " evaluations)\n";
+    }
+    std::cout << "-------------------------------------------------------\n";
+    std::cout << "  " << std::left << std::setw(22) << "Section" << std::right << std::setw(13) << "Memory [MB]"
+              << std::setw(9) << "Memory %";
+    if (TapeSectionEvaluations > 0) std::cout << std::setw(14) << "Reverse [ms]";
+    std::cout << "\n";
+
+    for (unsigned short iSection = 0; iSection < nTapeSections; ++iSection) {
+      std::cout << "  " << std::left << std::setw(22) << names[iSection] << std::right << std::fixed
+                << std::setprecision(2) << std::setw(13) << globalMemory[iSection] / 1024.0 / 1024.0 << std::setw(9)
+                << 100.0 * globalMemory[iSection] / totalMemory;
+      if (TapeSectionEvaluations > 0) {
+        std::cout << std::setw(14) << 1000.0 * maxTime[iSection] / TapeSectionEvaluations;
+      }
+      std::cout << "\n";
+    }
+
+    std::cout << "  " << std::left << std::setw(22) << "Total" << std::right << std::fixed << std::setprecision(2)
+              << std::setw(13) << totalMemory / 1024.0 / 1024.0 << std::setw(9) << 100.0;
+    if (TapeSectionEvaluations > 0) std::cout << std::setw(14) << 1000.0 * totalTime / TapeSectionEvaluations;
+    std::cout << "\n";
+    std::cout << std::defaultfloat;
+  }
+#endif
+
+  /*--- Recording and reverse times per thread, to compare runs with different numbers of threads. With ideal
+   *    scaling the thread-times are constant, and so is the ratio of reverse to recording time. ---*/
+
+  passivedouble maxRecording = 0.0;
+  SU2_MPI::Allreduce(&RecordingTime, &maxRecording, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if (!printingRank) return;
+
+  const int nThread = omp_get_max_threads();
+
+  std::cout << "-------------------------------------------------------\n";
+  std::cout << "  Parallel scaling of the tape (" << nThread << " threads per process)\n";
+#ifdef HAVE_MPI
+  std::cout << "  (time maximized across MPI processes)\n";
+#endif
+  std::cout << "-------------------------------------------------------\n";
+  std::cout << "  " << std::left << std::setw(22) << "" << std::right << std::setw(14) << "Time [ms]" << std::setw(17)
+            << "Thread-time [ms]\n";
+  std::cout << std::fixed << std::setprecision(2);
+  if (maxRecording > 0.0) {
+    std::cout << "  " << std::left << std::setw(22) << "Recording" << std::right << std::setw(14)
+              << 1000.0 * maxRecording << std::setw(16) << 1000.0 * nThread * maxRecording << "\n";
+  }
+  if (TapeSectionEvaluations > 0) {
+    const passivedouble reverse = totalTime / TapeSectionEvaluations;
+    std::cout << "  " << std::left << std::setw(22) << "Reverse (per eval.)" << std::right << std::setw(14)
+              << 1000.0 * reverse << std::setw(16) << 1000.0 * nThread * reverse << "\n";
+    if (maxRecording > 0.0) {
+      std::cout << "  " << std::left << std::setw(22) << "Reverse / recording" << std::right << std::setw(14)
+                << reverse / maxRecording << "\n";
+    }
+  }
+  std::cout << std::defaultfloat;
+  std::cout << "-------------------------------------------------------" << std::endl;
+#endif
+}
+
 }  // namespace AD
@@ -25,6 +25,11 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
 #include <utility>
 
 #include "../../../Common/include/containers/CLookUpTable.hpp"
@@ -34,11 +39,181 @@
 
 using namespace std;
 
-CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in)
+namespace {
+
+static_assert(sizeof(passivedouble) == sizeof(uint64_t), "The binary tables assume 64-bit doubles.");
+
+const char binary_lut_magic[] = "SU2LUTB1";
+const string binary_lut_ext = ".drb";
+
+bool IsBinaryTable(const string& file_name) {
+  return file_name.size() > binary_lut_ext.size() &&
+         file_name.compare(file_name.size() - binary_lut_ext.size(), binary_lut_ext.size(), binary_lut_ext) == 0;
+}
+
+/*--- Blocks of the binary format are padded to 8 bytes, so that all arrays can be used in place. ---*/
+inline uint64_t PaddedSize(uint64_t n_bytes) { return (n_bytes + 7) / 8 * 8; }
+
+/*!
+ * \brief Sequential writer of the blocks of a binary table.
+ */
+class CBinaryLUTWriter {
+  ofstream file;
+
+ public:
+  explicit CBinaryLUTWriter(const string& file_name) : file(file_name, ios::binary) {
+    if (!file.is_open()) SU2_MPI::Error("Unable to open " + file_name + " to write the binary table.", CURRENT_FUNCTION);
+  }
+
+  template <class T>
+  void Write(const T* data, uint64_t n) {
+    const uint64_t n_bytes = n * sizeof(T);
+    file.write(reinterpret_cast<const char*>(data), n_bytes);
+    const char zeros[8] = {};
+    file.write(zeros, PaddedSize(n_bytes) - n_bytes);
+  }
+
+  void Write(uint64_t value) { Write(&value, 1); }
+
+  void Write(const string& str) {
+    Write(uint64_t(str.size()));
+    Write(str.data(), str.size());
+  }
+
+  bool Good() const { return file.good(); }
+};
+
+/*!
+ * \brief Sequential reader of the blocks of a binary table image, arrays are returned in place.
+ */
+class CBinaryLUTReader {
+  const char* image;
+  uint64_t size, pos = 0;
+  const string& file_name;
+
+ public:
+  CBinaryLUTReader(const char* image_, uint64_t size_, const string& file_name_)
+      : image(image_), size(size_), file_name(file_name_) {}
+
+  template <class T>
+  const T* Read(uint64_t n) {
+    const uint64_t n_bytes = n * sizeof(T);
+    if (n_bytes / sizeof(T) != n || n_bytes > size - pos)
+      SU2_MPI::Error("The binary table " + file_name + " is truncated or corrupted.", CURRENT_FUNCTION);
+    const auto* data = reinterpret_cast<const T*>(image + pos);
+    pos += min(PaddedSize(n_bytes), size - pos);
+    return data;
+  }
+
+  uint64_t Read() { return *Read<uint64_t>(1); }
+
+  string ReadString() {
+    const auto length = Read();
+    const auto* chars = Read<char>(length);
+    return string(chars, length);
+  }
+
+  bool AtEnd() const { return pos == size; }
+};
+
+/*!
+ * \brief Images of the binary tables used by this process, the tables of each file (e.g. of each thread) share one.
+ */
+map<string, pair<weak_ptr<const char>, uint64_t>> loaded_images;
+set<string> written_binaries;
+
+/*!
+ * \brief Read a file into memory (private to the calling rank).
+ */
+void ReadFileInto(const string& file_name, char* buffer, uint64_t size) {
+  ifstream file(file_name, ios::binary);
+  if (!file.read(buffer, size))
+    SU2_MPI::Error("Unable to read the binary table " + file_name + ".", CURRENT_FUNCTION);
+}
+
+uint64_t GetFileSize(const string& file_name) {
+  ifstream file(file_name, ios::binary | ios::ate);
+  if (!file.is_open()) return 0;
+  return static_cast<uint64_t>(file.tellg());
+}
+
+/*!
+ * \brief Get the image of a binary table. In MPI builds without AD, the file is read once per compute node into
+ *        shared memory (collective, unless the image is already loaded), otherwise each rank reads it.
+ */
+shared_ptr<const char> LoadBinaryImage(const string& file_name, uint64_t& size) {
+  shared_ptr<const char> image;
+
+  SU2_OMP_CRITICAL {
+    const auto it = loaded_images.find(file_name);
+    if (it != loaded_images.end()) {
+      image = it->second.first.lock();
+      size = it->second.second;
+    }
+  }
+  END_SU2_OMP_CRITICAL
+  if (image) return image;
+
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  if (!omp_in_parallel()) {
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, SU2_MPI::GetRank(), MPI_INFO_NULL, &node_comm);
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+
+    size = (node_rank == 0) ? GetFileSize(file_name) : 0;
+    MPI_Bcast(&size, 1, MPI_UINT64_T, 0, node_comm);
+    if (size == 0) SU2_MPI::Error("Unable to open the binary table " + file_name + ".", CURRENT_FUNCTION);
+
+    /*--- The first rank of the node allocates and fills the window, the others map it. ---*/
+    char* buffer = nullptr;
+    MPI_Win window;
+    MPI_Win_allocate_shared(node_rank == 0 ? size : 0, 1, MPI_INFO_NULL, node_comm, &buffer, &window);
+    if (node_rank != 0) {
+      MPI_Aint window_size;
+      int disp_unit;
+      MPI_Win_shared_query(window, 0, &window_size, &disp_unit, &buffer);
+    }
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+    if (node_rank == 0) ReadFileInto(file_name, buffer, size);
+    MPI_Win_sync(window);
+    MPI_Barrier(node_comm);
+    MPI_Win_sync(window);
+    MPI_Win_unlock_all(window);
+    MPI_Comm_free(&node_comm);
+
+    /*--- Freeing the window is collective, the tables are destroyed in the same order by all ranks. ---*/
+    image = shared_ptr<const char>(buffer, [window](const char*) mutable { MPI_Win_free(&window); });
+  }
+#endif
+  if (!image) {
+    size = GetFileSize(file_name);
+    if (size == 0) SU2_MPI::Error("Unable to open the binary table " + file_name + ".", CURRENT_FUNCTION);
+    char* buffer = new char[size];
+    ReadFileInto(file_name, buffer, size);
+    image = shared_ptr<const char>(buffer, default_delete<char[]>());
+  }
+
+  SU2_OMP_CRITICAL
+  loaded_images[file_name] = make_pair(weak_ptr<const char>(image), size);
+  END_SU2_OMP_CRITICAL
+
+  return image;
+}
+
+}  // namespace
+
+CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in,
+                           bool write_binary)
     : file_name_lut{var_file_name_lut}, name_CV1{std::move(name_CV1_in)}, name_CV2{std::move(name_CV2_in)} {
   rank = SU2_MPI::GetRank();
 
-  LoadTableRaw(var_file_name_lut);
+  const bool binary = IsBinaryTable(var_file_name_lut);
+
+  if (binary)
+    LoadTableBinary(var_file_name_lut);
+  else
+    LoadTableRaw(var_file_name_lut);
 
   /* Store indices of controlling variables. */
   idx_CV1 = GetIndexOfVar(name_CV1);
@@ -46,6 +221,23 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   FindTableLimits(name_CV1, name_CV2);
 
+  /* Add additional variable index which will always result in zero when looked up. */
+  idx_null = names_var.size();
+
+  if (binary) {
+    /* The edges, trapezoidal maps, and interpolation coefficients were loaded with the table. */
+    PrintTableInfo();
+
+    if (rank == MASTER_NODE) {
+      double tmap_memory_footprint = 0;
+      for (const auto& trap_map : trap_map_x_y) tmap_memory_footprint += trap_map.GetMemoryFootprint();
+      cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
+      cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
+      cout << "LUT fluid model ready for use" << endl;
+    }
+    return;
+  }
+
   if (rank == MASTER_NODE)
     cout << "Detecting all unique edges and setting edge to triangle connectivity "
             "..."
@@ -57,9 +249,6 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   PrintTableInfo();
 
-  /* Add additional variable index which will always result in zero when looked up. */
-  idx_null = names_var.size();
-
   if (rank == MASTER_NODE) switch (table_dim) {
       case 2:
         cout << "Building a trapezoidal map for the (" + name_CV1 + ", " + name_CV2 +
@@ -117,9 +306,42 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   ComputeInterpCoeffs();
 
+  if (write_binary && rank == MASTER_NODE) {
+    const auto file_name_binary = var_file_name_lut.substr(0, var_file_name_lut.find_last_of('.')) + binary_lut_ext;
+    bool first_write = false;
+    SU2_OMP_CRITICAL
+    first_write = written_binaries.insert(file_name_binary).second;
+    END_SU2_OMP_CRITICAL
+    if (first_write) {
+      cout << "Writing the binary lookup table " << file_name_binary << " ..." << endl;
+      WriteBinary(file_name_binary);
+      cout << " done." << endl;
+    }
+  }
+
   if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
 }
 
+CLookUpTable::~CLookUpTable() {
+#ifdef SU2_OMP_OFFLOAD
+  for (auto i_level = 0ul; i_level < on_device.size(); i_level++) {
+    if (!on_device[i_level]) continue;
+    const auto& grid = search_grid[i_level];
+    const su2double* data = table_data[i_level].data();
+    const unsigned long* tri = triangles[i_level].data();
+    const su2double* mats = interp_mat_inv_x_y[i_level].data();
+    const unsigned long* offsets = grid.cell_offsets.data();
+    const unsigned long* cand = grid.cell_triangles.data();
+    const unsigned long n_data = table_data[i_level].rows() * table_data[i_level].cols();
+    const unsigned long n_tri = n_triangles[i_level];
+    const unsigned long n_offsets = grid.cell_offsets.size(), n_cand = grid.cell_triangles.size();
+    SU2_OMP(target exit data map(release : data[:n_data], tri[:N_POINTS_TRIANGLE * n_tri],
+                                 mats[:N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_tri], offsets[:n_offsets],
+                                 cand[:n_cand]))
+  }
+#endif
+}
+
 void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   CFileReaderLUT file_reader;
 
@@ -132,6 +354,7 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   n_points.resize(n_table_levels);
   n_triangles.resize(n_table_levels);
   n_hull_points.resize(n_table_levels);
+  n_edges.resize(n_table_levels);
   table_data.resize(n_table_levels);
   hull.resize(n_table_levels);
   triangles.resize(n_table_levels);
@@ -143,8 +366,15 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
     n_points[i_level] = file_reader.GetNPoints(i_level);
     n_triangles[i_level] = file_reader.GetNTriangles(i_level);
     n_hull_points[i_level] = file_reader.GetNHullPoints(i_level);
-    table_data[i_level] = file_reader.GetTableData(i_level);
-    triangles[i_level] = file_reader.GetTriangles(i_level);
+
+    const auto& data = file_reader.GetTableData(i_level);
+    auto* data_copy = table_data[i_level].Allocate(data.rows(), data.cols());
+    copy(data.data(), data.data() + data.size(), data_copy);
+
+    const auto& connectivity = file_reader.GetTriangles(i_level);
+    auto* connectivity_copy = triangles[i_level].Allocate(connectivity.rows(), connectivity.cols());
+    copy(connectivity.data(), connectivity.data() + connectivity.size(), connectivity_copy);
+
     hull[i_level] = file_reader.GetHull(i_level);
     memory_footprint_data += n_points[i_level] * sizeof(su2double);
   }
@@ -164,6 +394,190 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
   if (rank == MASTER_NODE) cout << " done." << endl;
 }
 
+void CLookUpTable::LoadTableBinary(const string& var_file_name_lut) {
+  if (rank == MASTER_NODE) cout << "Loading binary lookup table, filename = " << var_file_name_lut << " ..." << endl;
+
+  uint64_t size = 0;
+  binary_image = LoadBinaryImage(var_file_name_lut, size);
+  CBinaryLUTReader reader(binary_image.get(), size, var_file_name_lut);
+
+  if (size < sizeof(binary_lut_magic) - 1 ||
+      memcmp(reader.Read<char>(sizeof(binary_lut_magic) - 1), binary_lut_magic, sizeof(binary_lut_magic) - 1) != 0) {
+    SU2_MPI::Error(var_file_name_lut + " is not a binary lookup table.", CURRENT_FUNCTION);
+  }
+
+  table_dim = reader.Read();
+  n_table_levels = reader.Read();
+  n_variables = reader.Read();
+  version_lut = reader.ReadString();
+  version_reader = reader.ReadString();
+  names_var.resize(n_variables);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) names_var[i_var] = reader.ReadString();
+
+  n_points.resize(n_table_levels);
+  n_triangles.resize(n_table_levels);
+  n_hull_points.resize(n_table_levels);
+  n_edges.resize(n_table_levels);
+  table_data.resize(n_table_levels);
+  hull.resize(n_table_levels);
+  triangles.resize(n_table_levels);
+  interp_mat_inv_x_y.resize(n_table_levels);
+  trap_map_x_y.resize(n_table_levels);
+  if (table_dim == 3) z_values_levels.resize(n_table_levels);
+
+  /* Arrays of passive values are used in place, or copied for AD types. */
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    const auto z_value = *reader.Read<passivedouble>(1);
+    if (table_dim == 3) z_values_levels[i_level] = z_value;
+
+    n_points[i_level] = reader.Read();
+    n_triangles[i_level] = reader.Read();
+    n_hull_points[i_level] = reader.Read();
+    n_edges[i_level] = reader.Read();
+
+    table_data[i_level].Load(n_variables, n_points[i_level],
+                             reader.Read<passivedouble>(n_variables * n_points[i_level]));
+    triangles[i_level].Load(n_triangles[i_level], N_POINTS_TRIANGLE,
+                            reader.Read<uint64_t>(N_POINTS_TRIANGLE * n_triangles[i_level]));
+
+    const auto* hull_ids = reader.Read<uint64_t>(n_hull_points[i_level]);
+    hull[i_level].resize(n_hull_points[i_level]);
+    for (auto i_point = 0ul; i_point < n_hull_points[i_level]; i_point++) hull[i_level][i_point] = hull_ids[i_point];
+
+    interp_mat_inv_x_y[i_level].Load(n_triangles[i_level], N_POINTS_TRIANGLE * N_POINTS_TRIANGLE,
+                                     reader.Read<passivedouble>(N_POINTS_TRIANGLE * N_POINTS_TRIANGLE *
+                                                                n_triangles[i_level]));
+
+    /* Trapezoidal map, the search structure is copied since it is small compared to the table. */
+    auto& trap_map = trap_map_x_y[i_level];
+
+    const auto n_bands = reader.Read();
+    const auto* bands = reader.Read<passivedouble>(n_bands);
+    trap_map.unique_bands_x.assign(bands, bands + n_bands);
+
+    const auto n_map_edges = reader.Read();
+    const auto* limits_x = reader.Read<passivedouble>(2 * n_map_edges);
+    const auto* limits_y = reader.Read<passivedouble>(2 * n_map_edges);
+    trap_map.edge_limits_x.resize(n_map_edges, 2);
+    trap_map.edge_limits_y.resize(n_map_edges, 2);
+    for (auto i_edge = 0ul; i_edge < n_map_edges; i_edge++) {
+      for (auto i = 0u; i < 2; i++) {
+        trap_map.edge_limits_x(i_edge, i) = limits_x[2 * i_edge + i];
+        trap_map.edge_limits_y(i_edge, i) = limits_y[2 * i_edge + i];
+      }
+    }
+
+    const auto* edge_offsets = reader.Read<uint64_t>(n_map_edges + 1);
+    const auto* edge_triangles = reader.Read<uint64_t>(edge_offsets[n_map_edges]);
+    trap_map.edge_to_triangle.resize(n_map_edges);
+    for (auto i_edge = 0ul; i_edge < n_map_edges; i_edge++) {
+      if (edge_offsets[i_edge] > edge_offsets[i_edge + 1] || edge_offsets[i_edge + 1] > edge_offsets[n_map_edges])
+        SU2_MPI::Error("The binary table " + var_file_name_lut + " is corrupted.", CURRENT_FUNCTION);
+      trap_map.edge_to_triangle[i_edge].assign(edge_triangles + edge_offsets[i_edge],
+                                               edge_triangles + edge_offsets[i_edge + 1]);
+    }
+
+    const auto n_band_lists = n_bands > 0 ? n_bands - 1 : 0;
+    const auto* band_offsets = reader.Read<uint64_t>(n_band_lists + 1);
+    const auto* band_y = reader.Read<passivedouble>(band_offsets[n_band_lists]);
+    const auto* band_edges = reader.Read<uint64_t>(band_offsets[n_band_lists]);
+    trap_map.y_edge_at_band_mid.resize(n_band_lists);
+    for (auto i_band = 0ul; i_band < n_band_lists; i_band++) {
+      if (band_offsets[i_band] > band_offsets[i_band + 1] || band_offsets[i_band + 1] > band_offsets[n_band_lists])
+        SU2_MPI::Error("The binary table " + var_file_name_lut + " is corrupted.", CURRENT_FUNCTION);
+      auto& band = trap_map.y_edge_at_band_mid[i_band];
+      band.clear();
+      for (auto i = band_offsets[i_band]; i < band_offsets[i_band + 1]; i++) band.emplace_back(band_y[i], band_edges[i]);
+    }
+
+    trap_map.memory_footprint = (sizeof(su2double) * (n_bands + 4 * n_map_edges + band_offsets[n_band_lists]) +
+                                 sizeof(unsigned long) * (edge_offsets[n_map_edges] + band_offsets[n_band_lists])) /
+                                1e6;
+    memory_footprint_data += n_points[i_level] * sizeof(su2double);
+  }
+  memory_footprint_data /= 1e6;
+
+  if (!reader.AtEnd()) SU2_MPI::Error("The binary table " + var_file_name_lut + " is corrupted.", CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE) cout << " done." << endl;
+}
+
+void CLookUpTable::WriteBinary(const string& file_name) const {
+  CBinaryLUTWriter writer(file_name);
+
+  writer.Write(binary_lut_magic, sizeof(binary_lut_magic) - 1);
+  writer.Write(uint64_t(table_dim));
+  writer.Write(uint64_t(n_table_levels));
+  writer.Write(uint64_t(n_variables));
+  writer.Write(version_lut);
+  writer.Write(version_reader);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) writer.Write(names_var[i_var]);
+
+  vector<passivedouble> values;
+  vector<uint64_t> ids;
+
+  auto WritePassive = [&](const su2double* data, unsigned long n) {
+    values.resize(n);
+    for (auto i = 0ul; i < n; i++) values[i] = SU2_TYPE::GetValue(data[i]);
+    writer.Write(values.data(), n);
+  };
+  auto WriteIds = [&](const unsigned long* data, unsigned long n) {
+    ids.assign(data, data + n);
+    writer.Write(ids.data(), n);
+  };
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    const su2double z_value = (table_dim == 3) ? z_values_levels[i_level] : su2double(0.0);
+    WritePassive(&z_value, 1);
+
+    writer.Write(uint64_t(n_points[i_level]));
+    writer.Write(uint64_t(n_triangles[i_level]));
+    writer.Write(uint64_t(n_hull_points[i_level]));
+    writer.Write(uint64_t(n_edges[i_level]));
+
+    WritePassive(table_data[i_level].data(), n_variables * n_points[i_level]);
+    WriteIds(triangles[i_level].data(), N_POINTS_TRIANGLE * n_triangles[i_level]);
+    WriteIds(hull[i_level].data(), n_hull_points[i_level]);
+    WritePassive(interp_mat_inv_x_y[i_level].data(), N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_triangles[i_level]);
+
+    const auto& trap_map = trap_map_x_y[i_level];
+
+    writer.Write(uint64_t(trap_map.unique_bands_x.size()));
+    WritePassive(trap_map.unique_bands_x.data(), trap_map.unique_bands_x.size());
+
+    const unsigned long n_map_edges = trap_map.edge_limits_x.rows();
+    writer.Write(uint64_t(n_map_edges));
+    WritePassive(trap_map.edge_limits_x.data(), 2 * n_map_edges);
+    WritePassive(trap_map.edge_limits_y.data(), 2 * n_map_edges);
+
+    ids.assign(1, 0);
+    for (auto i_edge = 0ul; i_edge < n_map_edges; i_edge++)
+      ids.push_back(ids.back() + trap_map.edge_to_triangle[i_edge].size());
+    writer.Write(ids.data(), ids.size());
+    ids.clear();
+    for (auto i_edge = 0ul; i_edge < n_map_edges; i_edge++)
+      ids.insert(ids.end(), trap_map.edge_to_triangle[i_edge].begin(), trap_map.edge_to_triangle[i_edge].end());
+    writer.Write(ids.data(), ids.size());
+
+    const auto& bands = trap_map.y_edge_at_band_mid;
+    ids.assign(1, 0);
+    for (auto i_band = 0ul; i_band < bands.size(); i_band++) ids.push_back(ids.back() + bands[i_band].size());
+    writer.Write(ids.data(), ids.size());
+    values.clear();
+    ids.clear();
+    for (auto i_band = 0ul; i_band < bands.size(); i_band++) {
+      for (const auto& y_edge : bands[i_band]) {
+        values.push_back(SU2_TYPE::GetValue(y_edge.first));
+        ids.push_back(y_edge.second);
+      }
+    }
+    writer.Write(values.data(), values.size());
+    writer.Write(ids.data(), ids.size());
+  }
+
+  if (!writer.Good()) SU2_MPI::Error("Writing the binary table " + file_name + " failed.", CURRENT_FUNCTION);
+}
+
 void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv2) {
   limits_table_x.resize(n_table_levels);
   limits_table_y.resize(n_table_levels);
@@ -199,7 +613,7 @@ void CLookUpTable::PrintTableInfo() {
     for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
       n_points_av += n_points[i_level] / n_table_levels;
       n_tria_av += n_triangles[i_level] / n_table_levels;
-      n_edges_av += edges[i_level].size() / n_table_levels;
+      n_edges_av += n_edges[i_level] / n_table_levels;
       min_x = min(min_x, *limits_table_x[i_level].first);
       min_y = min(min_y, *limits_table_y[i_level].first);
       max_x = max(max_x, *limits_table_x[i_level].second);
@@ -356,6 +770,7 @@ void CLookUpTable::IdentifyUniqueEdges() {
         }
       }
     }
+    n_edges[i_level] = edges[i_level].size();
   }
 }
 
@@ -370,21 +785,20 @@ void CLookUpTable::ComputeInterpCoeffs() {
 
     /* calculate weights for each triangle (basically a distance function) and
      * build inverse interpolation matrices */
-    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level]);
+    constexpr auto mat_size = N_POINTS_TRIANGLE * N_POINTS_TRIANGLE;
+    auto* interp_mats = interp_mat_inv_x_y[i_level].Allocate(n_triangles[i_level], mat_size);
     for (auto i_triangle = 0u; i_triangle < n_triangles[i_level]; i_triangle++) {
       for (auto p = 0u; p < N_POINTS_TRIANGLE; p++) {
         next_triangle[p] = triangles[i_level][i_triangle][p];
       }
 
-      su2activematrix x_interp_mat_inv(N_POINTS_TRIANGLE, N_POINTS_TRIANGLE);
-      GetInterpMatInv(val_CV1, val_CV2, next_triangle, x_interp_mat_inv);
-      interp_mat_inv_x_y[i_level][i_triangle] = x_interp_mat_inv;
+      GetInterpMatInv(val_CV1, val_CV2, next_triangle, interp_mats + i_triangle * mat_size);
     }
   }
 }
 
 void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_y,
-                                   std::array<unsigned long, 3>& point_ids, su2activematrix& interp_mat_inv) {
+                                   std::array<unsigned long, 3>& point_ids, su2double* interp_mat_inv) {
   CSquareMatrixCM global_M(N_POINTS_TRIANGLE);
 
   /* setup LHM matrix for the interpolation */
@@ -402,9 +816,145 @@ void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_
 
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      interp_mat_inv[i][j] = global_M(i, j);
+      interp_mat_inv[i * N_POINTS_TRIANGLE + j] = global_M(i, j);
+    }
+  }
+}
+
+void CLookUpTable::BuildSearchGrid() {
+  search_grid.resize(n_table_levels);
+  last_triangle.assign(n_table_levels, 0);
+  on_device.assign(n_table_levels, false);
+
+  unsigned long n_cells = 0, n_candidates = 0;
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    auto& grid = search_grid[i_level];
+    const su2double* val_CV1 = table_data[i_level][idx_CV1];
+    const su2double* val_CV2 = table_data[i_level][idx_CV2];
+
+    /* about one triangle per cell, the grid is uniform in the space normalized by the table limits */
+    grid.nx = max(1ul, static_cast<unsigned long>(ceil(sqrt(double(n_triangles[i_level])))));
+    grid.ny = grid.nx;
+    grid.x_min = SU2_TYPE::GetValue(*limits_table_x[i_level].first);
+    grid.y_min = SU2_TYPE::GetValue(*limits_table_y[i_level].first);
+    const passivedouble eps = SU2_TYPE::GetValue(EPS);
+    grid.inv_dx = grid.nx / max(SU2_TYPE::GetValue(*limits_table_x[i_level].second) - grid.x_min, eps);
+    grid.inv_dy = grid.ny / max(SU2_TYPE::GetValue(*limits_table_y[i_level].second) - grid.y_min, eps);
+
+    /* range of cells overlapped by the bounding box of a triangle */
+    auto CellRange = [&](unsigned long i_triangle) {
+      const auto id_0 = triangles[i_level][i_triangle][0];
+      passivedouble x_lo = SU2_TYPE::GetValue(val_CV1[id_0]), x_hi = x_lo;
+      passivedouble y_lo = SU2_TYPE::GetValue(val_CV2[id_0]), y_hi = y_lo;
+      for (auto i_point = 1u; i_point < N_POINTS_TRIANGLE; i_point++) {
+        const auto id = triangles[i_level][i_triangle][i_point];
+        x_lo = min(x_lo, SU2_TYPE::GetValue(val_CV1[id]));
+        x_hi = max(x_hi, SU2_TYPE::GetValue(val_CV1[id]));
+        y_lo = min(y_lo, SU2_TYPE::GetValue(val_CV2[id]));
+        y_hi = max(y_hi, SU2_TYPE::GetValue(val_CV2[id]));
+      }
+      return std::array<unsigned long, 4>{{grid.CellX(x_lo), grid.CellX(x_hi), grid.CellY(y_lo), grid.CellY(y_hi)}};
+    };
+
+    /* count the candidates of each cell, and then store them */
+    grid.cell_offsets.assign(grid.nx * grid.ny + 1, 0);
+    for (auto i_triangle = 0ul; i_triangle < n_triangles[i_level]; i_triangle++) {
+      const auto range = CellRange(i_triangle);
+      for (auto iy = range[2]; iy <= range[3]; iy++)
+        for (auto ix = range[0]; ix <= range[1]; ix++) grid.cell_offsets[ix + iy * grid.nx + 1]++;
+    }
+    for (auto i_cell = 0ul; i_cell < grid.nx * grid.ny; i_cell++)
+      grid.cell_offsets[i_cell + 1] += grid.cell_offsets[i_cell];
+
+    grid.cell_triangles.resize(grid.cell_offsets.back());
+    vector<unsigned long> position(grid.cell_offsets.begin(), grid.cell_offsets.end() - 1);
+    for (auto i_triangle = 0ul; i_triangle < n_triangles[i_level]; i_triangle++) {
+      const auto range = CellRange(i_triangle);
+      for (auto iy = range[2]; iy <= range[3]; iy++)
+        for (auto ix = range[0]; ix <= range[1]; ix++)
+          grid.cell_triangles[position[ix + iy * grid.nx]++] = i_triangle;
     }
+
+    n_cells += grid.nx * grid.ny;
+    n_candidates += grid.cell_triangles.size();
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Search grid of the lookup table: " << n_cells << " cells, " << double(n_candidates) / max(n_cells, 1ul)
+         << " triangles per cell, memory footprint: "
+         << (n_cells + n_table_levels + n_candidates) * sizeof(unsigned long) / 1e6 << " MB" << endl;
+  }
+}
+
+unsigned long CLookUpTable::DetectStructuredLevels() {
+  structured_levels.assign(n_table_levels, CStructuredLevel());
+  unsigned long n_regular = 0;
+
+  /* sorted unique values, within a tolerance */
+  auto UniqueValues = [](const su2double* values, unsigned long n, passivedouble tol) {
+    vector<passivedouble> sorted(n), unique_values;
+    for (auto i = 0ul; i < n; i++) sorted[i] = SU2_TYPE::GetValue(values[i]);
+    sort(sorted.begin(), sorted.end());
+    for (const auto val : sorted)
+      if (unique_values.empty() || val - unique_values.back() > tol) unique_values.push_back(val);
+    return unique_values;
+  };
+
+  /* index of a value in the unique values, -1 if it is not one of them */
+  auto IndexOf = [](const vector<passivedouble>& values, passivedouble val, passivedouble tol) {
+    const auto it = lower_bound(values.begin(), values.end(), val - tol);
+    return (it == values.end() || fabs(*it - val) > tol) ? -1l : long(it - values.begin());
+  };
+
+  /* inverse of the spacing if the values are uniformly spaced, 0 otherwise */
+  auto InverseSpacing = [](const vector<passivedouble>& values, passivedouble tol) {
+    const passivedouble delta = (values.back() - values.front()) / (values.size() - 1);
+    for (auto i = 1ul; i + 1 < values.size(); i++)
+      if (fabs(values[i] - (values.front() + i * delta)) > tol) return 0.0;
+    return 1 / delta;
+  };
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    const auto n = n_points[i_level];
+    const su2double* val_CV1 = table_data[i_level][idx_CV1];
+    const su2double* val_CV2 = table_data[i_level][idx_CV2];
+    const passivedouble tol_x =
+        1e-8 * SU2_TYPE::GetValue(*limits_table_x[i_level].second - *limits_table_x[i_level].first);
+    const passivedouble tol_y =
+        1e-8 * SU2_TYPE::GetValue(*limits_table_y[i_level].second - *limits_table_y[i_level].first);
+
+    auto x = UniqueValues(val_CV1, n, tol_x);
+    auto y = UniqueValues(val_CV2, n, tol_y);
+    if (x.size() < 2 || y.size() < 2 || x.size() * y.size() != n) continue;
+
+    /* each node of the tensor-product grid must be exactly one point */
+    vector<unsigned long> point_ids(n, n);
+    bool regular = true;
+    for (auto i_point = 0ul; i_point < n && regular; i_point++) {
+      const auto ix = IndexOf(x, SU2_TYPE::GetValue(val_CV1[i_point]), tol_x);
+      const auto iy = IndexOf(y, SU2_TYPE::GetValue(val_CV2[i_point]), tol_y);
+      regular = (ix >= 0) && (iy >= 0) && (point_ids[ix + x.size() * iy] == n);
+      if (regular) point_ids[ix + x.size() * iy] = i_point;
+    }
+    if (!regular) continue;
+
+    auto& level = structured_levels[i_level];
+    level.inv_dx = InverseSpacing(x, tol_x);
+    level.inv_dy = InverseSpacing(y, tol_y);
+    level.x = std::move(x);
+    level.y = std::move(y);
+    level.point_ids = std::move(point_ids);
+    n_regular++;
   }
+
+  if (n_regular == 0) structured_levels.clear();
+
+  if (rank == MASTER_NODE) {
+    cout << n_regular << " of " << n_table_levels
+         << " lookup table levels are regular and interpolated without searching the triangulation." << endl;
+  }
+  return n_regular;
 }
 
 std::pair<unsigned long, unsigned long> CLookUpTable::FindInclusionLevels(const su2double val_CV3) {
@@ -571,6 +1121,9 @@ std::array<std::array<su2double, 2>, 2> CLookUpTable::ComputeNormalizedXY(
 
 bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2double>& val_vars, const su2double val_CV1,
                              const su2double val_CV2, unsigned long i_level) {
+  if (!structured_levels.empty() && structured_levels[i_level].IsRegular())
+    return LookUp_XY_Structured(idx_var, val_vars, val_CV1, val_CV2, i_level);
+
   unsigned long id_triangle;
   bool inside = FindInclusionTriangle(val_CV1, val_CV2, id_triangle, i_level);
 
@@ -615,12 +1168,267 @@ bool CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_var, vector<su2dou
   return inside;
 }
 
+namespace {
+/*--- Smallest batch worth the transfers to the device, and number of points per chunk of a batch. ---*/
+constexpr unsigned long device_min_batch = 4096;
+constexpr unsigned long device_chunk_size = 65536;
+}  // namespace
+
+bool CLookUpTable::UsesDevice() const {
+#ifdef SU2_OMP_OFFLOAD
+  return table_dim == 2 && !search_grid.empty() && omp_get_num_devices() > 0;
+#else
+  return false;
+#endif
+}
+
+void CLookUpTable::LookUp_XY_Batch(unsigned long n_batch, const vector<unsigned long>& idx_var,
+                                   const su2double* val_CV1, const su2double* val_CV2, su2double* val_vars,
+                                   unsigned long* outside, unsigned long i_level) {
+  const auto n_var = idx_var.size();
+  vector<su2double> vals(n_var);
+
+  if (!structured_levels.empty() && structured_levels[i_level].IsRegular()) {
+    const auto& grid = structured_levels[i_level];
+    const auto nx = grid.x.size();
+
+    /* corners and bilinear weights of all points, and then the values of each variable */
+    vector<unsigned long> corners(4 * n_batch);
+    vector<su2double> weights(4 * n_batch);
+
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto i = 0ul; i < n_batch; i++) {
+      const passivedouble x = SU2_TYPE::GetValue(val_CV1[i]), y = SU2_TYPE::GetValue(val_CV2[i]);
+      outside[i] = (x < grid.x.front()) | (x > grid.x.back()) | (y < grid.y.front()) | (y > grid.y.back());
+
+      const auto ix = CStructuredLevel::CellIndex(grid.x, grid.inv_dx, x);
+      const auto iy = CStructuredLevel::CellIndex(grid.y, grid.inv_dy, y);
+      const su2double wx = (val_CV1[i] - grid.x[ix]) / (grid.x[ix + 1] - grid.x[ix]);
+      const su2double wy = (val_CV2[i] - grid.y[iy]) / (grid.y[iy + 1] - grid.y[iy]);
+
+      corners[4 * i] = grid.point_ids[ix + nx * iy];
+      corners[4 * i + 1] = grid.point_ids[ix + 1 + nx * iy];
+      corners[4 * i + 2] = grid.point_ids[ix + nx * (iy + 1)];
+      corners[4 * i + 3] = grid.point_ids[ix + 1 + nx * (iy + 1)];
+      weights[4 * i] = (1 - wx) * (1 - wy);
+      weights[4 * i + 1] = wx * (1 - wy);
+      weights[4 * i + 2] = (1 - wx) * wy;
+      weights[4 * i + 3] = wx * wy;
+    }
+
+    for (auto iVar = 0ul; iVar < n_var; iVar++) {
+      if (idx_var[iVar] == idx_null) {
+        for (auto i = 0ul; i < n_batch; i++) val_vars[i * n_var + iVar] = 0;
+        continue;
+      }
+      const su2double* data = table_data[i_level][idx_var[iVar]];
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n_batch; i++) {
+        val_vars[i * n_var + iVar] = weights[4 * i] * data[corners[4 * i]] +
+                                     weights[4 * i + 1] * data[corners[4 * i + 1]] +
+                                     weights[4 * i + 2] * data[corners[4 * i + 2]] +
+                                     weights[4 * i + 3] * data[corners[4 * i + 3]];
+      }
+    }
+
+    /* points outside the table are extrapolated as usual */
+    for (auto i = 0ul; i < n_batch; i++) {
+      if (!outside[i]) continue;
+      InterpolateToNearestNeighbors(val_CV1[i], val_CV2[i], idx_var, vals, i_level);
+      for (auto iVar = 0ul; iVar < n_var; iVar++) val_vars[i * n_var + iVar] = vals[iVar];
+    }
+    return;
+  }
+
+  if (n_batch >= device_min_batch && UsesDevice()) {
+    LookUp_XY_Device(n_batch, idx_var, val_CV1, val_CV2, val_vars, outside, i_level);
+
+    /* points outside the table (rare) are extrapolated on the host */
+    for (auto i = 0ul; i < n_batch; i++) {
+      if (!outside[i]) continue;
+      InterpolateToNearestNeighbors(val_CV1[i], val_CV2[i], idx_var, vals, i_level);
+      for (auto iVar = 0ul; iVar < n_var; iVar++) val_vars[i * n_var + iVar] = vals[iVar];
+    }
+    return;
+  }
+
+  for (auto i = 0ul; i < n_batch; i++) {
+    outside[i] = !LookUp_XY(idx_var, vals, val_CV1[i], val_CV2[i], i_level);
+    for (auto iVar = 0ul; iVar < n_var; iVar++) val_vars[i * n_var + iVar] = vals[iVar];
+  }
+}
+
+void CLookUpTable::MapToDevice(unsigned long i_level) {
+#ifdef SU2_OMP_OFFLOAD
+  if (on_device[i_level]) return;
+
+  const auto& grid = search_grid[i_level];
+  const su2double* data = table_data[i_level].data();
+  const unsigned long* tri = triangles[i_level].data();
+  const su2double* mats = interp_mat_inv_x_y[i_level].data();
+  const unsigned long* offsets = grid.cell_offsets.data();
+  const unsigned long* cand = grid.cell_triangles.data();
+  const unsigned long n_data = table_data[i_level].rows() * table_data[i_level].cols();
+  const unsigned long n_tri = n_triangles[i_level];
+  const unsigned long n_offsets = grid.cell_offsets.size(), n_cand = grid.cell_triangles.size();
+
+  SU2_OMP(target enter data map(to : data[:n_data], tri[:N_POINTS_TRIANGLE * n_tri],
+                                mats[:N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_tri], offsets[:n_offsets],
+                                cand[:n_cand]))
+  on_device[i_level] = true;
+
+  if (rank == MASTER_NODE) {
+    cout << "Lookup table level " << i_level << " mapped to the offload device, "
+         << (n_data + N_POINTS_TRIANGLE * (N_POINTS_TRIANGLE + 1) * n_tri + n_offsets + n_cand) * 8 / 1e6 << " MB"
+         << endl;
+  }
+#endif
+}
+
+void CLookUpTable::LookUp_XY_Device(unsigned long n_batch, const vector<unsigned long>& idx_var,
+                                    const su2double* val_CV1, const su2double* val_CV2, su2double* val_vars,
+                                    unsigned long* outside, unsigned long i_level) {
+#ifdef SU2_OMP_OFFLOAD
+  MapToDevice(i_level);
+
+  /* the level data is present on the device, mapping it again does not transfer it */
+  const auto& grid = search_grid[i_level];
+  const su2double* data = table_data[i_level].data();
+  const unsigned long* tri = triangles[i_level].data();
+  const su2double* mats = interp_mat_inv_x_y[i_level].data();
+  const unsigned long* offsets = grid.cell_offsets.data();
+  const unsigned long* cand = grid.cell_triangles.data();
+  const unsigned long* vars = idx_var.data();
+  const unsigned long n_data = table_data[i_level].rows() * table_data[i_level].cols();
+  const unsigned long n_tri = n_triangles[i_level];
+  const unsigned long n_offsets = grid.cell_offsets.size(), n_cand = grid.cell_triangles.size();
+
+  const unsigned long n_pts = table_data[i_level].cols(), n_var = idx_var.size(), null_var = idx_null;
+  const unsigned long cv1 = idx_CV1 * n_pts, cv2 = idx_CV2 * n_pts, nx = grid.nx, ny = grid.ny;
+  const passivedouble x_lo = *limits_table_x[i_level].first, x_hi = *limits_table_x[i_level].second;
+  const passivedouble y_lo = *limits_table_y[i_level].first, y_hi = *limits_table_y[i_level].second;
+  const passivedouble x_min = grid.x_min, y_min = grid.y_min, inv_dx = grid.inv_dx, inv_dy = grid.inv_dy;
+
+  /* the chunks are deferred target tasks, which lets the runtime overlap the transfers of
+   * the controlling variables and results of one chunk with the computation of others */
+  for (auto begin = 0ul; begin < n_batch; begin += device_chunk_size) {
+    const auto end = min(begin + device_chunk_size, n_batch);
+
+    SU2_OMP(target teams distribute parallel for nowait
+            map(to : data[:n_data], tri[:N_POINTS_TRIANGLE * n_tri], mats[:N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * n_tri])
+            map(to : offsets[:n_offsets], cand[:n_cand], vars[:n_var])
+            map(to : val_CV1[begin:end - begin], val_CV2[begin:end - begin])
+            map(from : val_vars[begin * n_var:(end - begin) * n_var], outside[begin:end - begin]))
+    for (auto i = begin; i < end; i++) {
+      const passivedouble x = val_CV1[i], y = val_CV2[i];
+      unsigned long id_triangle = 0;
+      bool found = false;
+
+      /* same search and inclusion test as FindInclusionTriangle with the search grid */
+      if (x >= x_lo && x <= x_hi && y >= y_lo && y <= y_hi) {
+        const auto ix = min(nx - 1, static_cast<unsigned long>(fmax(0.0, (x - x_min) * inv_dx)));
+        const auto iy = min(ny - 1, static_cast<unsigned long>(fmax(0.0, (y - y_min) * inv_dy)));
+        const auto i_cell = ix + nx * iy;
+
+        for (auto j = offsets[i_cell]; j < offsets[i_cell + 1] && !found; j++) {
+          const auto* p = tri + N_POINTS_TRIANGLE * cand[j];
+          const passivedouble x0 = data[cv1 + p[0]], y0 = data[cv2 + p[0]];
+          const passivedouble x1 = data[cv1 + p[1]], y1 = data[cv2 + p[1]];
+          const passivedouble x2 = data[cv1 + p[2]], y2 = data[cv2 + p[2]];
+
+          const passivedouble area_tri = fabs(x0 * (y1 - y2) + x1 * (y2 - y0) + x2 * (y0 - y1)) * 0.5;
+          const passivedouble area_0 = fabs(x * (y1 - y2) + x1 * (y2 - y) + x2 * (y - y1)) * 0.5;
+          const passivedouble area_1 = fabs(x0 * (y - y2) + x * (y2 - y0) + x2 * (y0 - y)) * 0.5;
+          const passivedouble area_2 = fabs(x0 * (y1 - y) + x1 * (y - y0) + x * (y0 - y1)) * 0.5;
+
+          if (fabs(area_tri - (area_0 + area_1 + area_2)) < area_tri * 1e-10) {
+            found = true;
+            id_triangle = cand[j];
+          }
+        }
+      }
+      outside[i] = !found;
+      if (!found) continue;
+
+      const auto* p = tri + N_POINTS_TRIANGLE * id_triangle;
+      const auto* mat = mats + N_POINTS_TRIANGLE * N_POINTS_TRIANGLE * id_triangle;
+      passivedouble coeffs[N_POINTS_TRIANGLE];
+      for (auto k = 0u; k < N_POINTS_TRIANGLE; k++)
+        coeffs[k] = mat[k * N_POINTS_TRIANGLE] + mat[k * N_POINTS_TRIANGLE + 1] * x + mat[k * N_POINTS_TRIANGLE + 2] * y;
+
+      for (auto iVar = 0ul; iVar < n_var; iVar++) {
+        passivedouble value = 0;
+        if (vars[iVar] != null_var) {
+          const auto* var = data + vars[iVar] * n_pts;
+          for (auto k = 0u; k < N_POINTS_TRIANGLE; k++) value += coeffs[k] * var[p[k]];
+        }
+        val_vars[i * n_var + iVar] = value;
+      }
+    }
+  }
+  SU2_OMP(taskwait)
+#endif
+}
+
+bool CLookUpTable::LookUp_XY_Structured(const vector<unsigned long>& idx_var, vector<su2double>& val_vars,
+                                        su2double val_CV1, su2double val_CV2, unsigned long i_level) {
+  const auto& grid = structured_levels[i_level];
+  const passivedouble x = SU2_TYPE::GetValue(val_CV1), y = SU2_TYPE::GetValue(val_CV2);
+
+  if (x < grid.x.front() || x > grid.x.back() || y < grid.y.front() || y > grid.y.back()) {
+    InterpolateToNearestNeighbors(val_CV1, val_CV2, idx_var, val_vars, i_level);
+    return false;
+  }
+
+  const auto nx = grid.x.size();
+  const auto ix = CStructuredLevel::CellIndex(grid.x, grid.inv_dx, x);
+  const auto iy = CStructuredLevel::CellIndex(grid.y, grid.inv_dy, y);
+  const su2double wx = (val_CV1 - grid.x[ix]) / (grid.x[ix + 1] - grid.x[ix]);
+  const su2double wy = (val_CV2 - grid.y[iy]) / (grid.y[iy + 1] - grid.y[iy]);
+
+  const std::array<unsigned long, 4> corners = {{grid.point_ids[ix + nx * iy], grid.point_ids[ix + 1 + nx * iy],
+                                                 grid.point_ids[ix + nx * (iy + 1)],
+                                                 grid.point_ids[ix + 1 + nx * (iy + 1)]}};
+  const std::array<su2double, 4> weights = {{(1 - wx) * (1 - wy), wx * (1 - wy), (1 - wx) * wy, wx * wy}};
+
+  for (auto iVar = 0u; iVar < idx_var.size(); iVar++) {
+    if (idx_var[iVar] == idx_null) {
+      val_vars[iVar] = 0;
+      continue;
+    }
+    const su2double* data = table_data[i_level][idx_var[iVar]];
+    val_vars[iVar] = weights[0] * data[corners[0]] + weights[1] * data[corners[1]] + weights[2] * data[corners[2]] +
+                     weights[3] * data[corners[3]];
+  }
+  return true;
+}
+
 bool CLookUpTable::FindInclusionTriangle(const su2double val_CV1, const su2double val_CV2, unsigned long& id_triangle,
                                          const unsigned long iLevel) {
   /* check if x value is in table x-dimension range
    * and if y is in table y-dimension table range */
   if ((val_CV1 >= *limits_table_x[iLevel].first && val_CV1 <= *limits_table_x[iLevel].second) &&
       (val_CV2 >= *limits_table_y[iLevel].first && val_CV2 <= *limits_table_y[iLevel].second)) {
+    if (!search_grid.empty()) {
+      /* test the last triangle found, and then the candidates of the grid cell */
+      if (IsInTriangle(val_CV1, val_CV2, last_triangle[iLevel], iLevel)) {
+        id_triangle = last_triangle[iLevel];
+        return true;
+      }
+      const auto& grid = search_grid[iLevel];
+      const auto i_cell =
+          grid.CellX(SU2_TYPE::GetValue(val_CV1)) + grid.nx * grid.CellY(SU2_TYPE::GetValue(val_CV2));
+      for (auto i = grid.cell_offsets[i_cell]; i < grid.cell_offsets[i_cell + 1]; i++) {
+        if (IsInTriangle(val_CV1, val_CV2, grid.cell_triangles[i], iLevel)) {
+          id_triangle = grid.cell_triangles[i];
+          last_triangle[iLevel] = id_triangle;
+          return true;
+        }
+      }
+      /* the point is in a gap of a non-rectangular table */
+      return false;
+    }
+
     /* if so, try to find the triangle that holds the (prog, enth) point */
     id_triangle = trap_map_x_y[iLevel].GetTriangle(val_CV1, val_CV2);
 
@@ -631,7 +1439,7 @@ bool CLookUpTable::FindInclusionTriangle(const su2double val_CV1, const su2doubl
   return false;
 }
 
-void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                                    std::array<su2double, N_POINTS_TRIANGLE>& interp_coeffs) const {
   std::array<su2double, N_POINTS_TRIANGLE> query_vector = {1, val_CV1, val_CV2};
 
@@ -639,7 +1447,7 @@ void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const s
   for (auto i = 0u; i < N_POINTS_TRIANGLE; i++) {
     d = 0;
     for (auto j = 0u; j < N_POINTS_TRIANGLE; j++) {
-      d = d + interp_mat_inv[i][j] * query_vector[j];
+      d = d + interp_mat_inv[i * N_POINTS_TRIANGLE + j] * query_vector[j];
     }
     interp_coeffs[i] = d;
   }
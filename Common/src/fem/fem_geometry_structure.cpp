@@ -1968,7 +1968,7 @@ CMeshFEM::CMeshFEM(CGeometry* geometry, CConfig* config) {
 
 void CMeshFEM::ComputeGradientsCoordinatesFace(const unsigned short nIntegration, const unsigned short nDOFs,
                                                const su2double* matDerBasisInt, const unsigned long* DOFs,
-                                               su2double* derivCoor, CConfig* config) {
+                                               su2metricfloat* derivCoor, CConfig* config) {
   /* Allocate the memory to store the values of dxdr, dydr, etc. */
   vector<su2double> helpDxdrVec(nIntegration * nDim * nDim);
   su2double* dxdrVec = helpDxdrVec.data();
@@ -2275,6 +2275,17 @@ void CMeshFEM_DG::SetGlobal_to_Local_Point() {
       Global_to_Local_Point[volElem[i].offsetDOFsSolGlobal + j] = ii;
     }
   }
+
+  /*--- The map is sorted by global index, which is the order of the DOFs in restart files. ---*/
+
+  DomainPoints_GlobalOrder.clear();
+  DomainPoints_GlobalIndex.clear();
+  DomainPoints_GlobalOrder.reserve(Global_to_Local_Point.size());
+  DomainPoints_GlobalIndex.reserve(Global_to_Local_Point.size());
+  for (const auto& globalLocal : Global_to_Local_Point) {
+    DomainPoints_GlobalIndex.push_back(globalLocal.first);
+    DomainPoints_GlobalOrder.push_back(globalLocal.second);
+  }
 }
 
 void CMeshFEM_DG::CoordinatesIntegrationPoints() {
@@ -4837,6 +4848,43 @@ void CMeshFEM_DG::MetricTermsMatchingFaces(CConfig* config) {
   }
 }
 
+void CMeshFEM_DG::ReportMemoryMetricTerms() const {
+  /*--- Count the stored values of the metric terms and of the solution. ---*/
+  unsigned long nMetric = 0, nMetricDouble = 0, nSolution = 0;
+
+  for (unsigned long i = 0; i < nVolElemTot; ++i) {
+    nMetric += volElem[i].metricTerms.size() + volElem[i].metricTerms2ndDer.size();
+    nMetricDouble += volElem[i].metricTermsSolDOFs.size();
+    if (i < nVolElemOwned) nSolution += volElem[i].nDOFsSol * (nDim + 2);
+  }
+
+  for (const auto& face : matchingFaces) {
+    nMetric += face.metricCoorDerivFace0.size() + face.metricCoorDerivFace1.size();
+    nMetricDouble += face.metricNormalsFace.size();
+  }
+
+  for (const auto& boundary : boundaries) {
+    for (const auto& face : boundary.surfElem) {
+      nMetric += face.metricCoorDerivFace.size();
+      nMetricDouble += face.metricNormalsFace.size();
+    }
+  }
+
+  const su2double MB = 1024.0 * 1024.0;
+  su2double localMem[] = {(nMetric * sizeof(su2metricfloat) + nMetricDouble * sizeof(su2double)) / MB,
+                              nSolution * sizeof(su2double) / MB};
+  su2double totalMem[2] = {0.0}, maxMem[2] = {0.0};
+  SU2_MPI::Reduce(localMem, totalMem, 2, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Reduce(localMem, maxMem, 2, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    cout << "Memory of the metric terms: " << totalMem[0] << " MB (max per rank " << maxMem[0]
+         << " MB), of the solution: " << totalMem[1] << " MB (max per rank " << maxMem[1] << " MB)." << endl;
+    cout << "The metric terms in the integration points are stored in "
+         << (sizeof(su2metricfloat) < sizeof(su2double) ? "single" : "double") << " precision." << endl;
+  }
+}
+
 void CMeshFEM_DG::LengthScaleVolumeElements() {
   /* Initialize the length scale of the elements to zero. */
   for (unsigned long i = 0; i < nVolElemTot; ++i) volElem[i].lenScale = 0.0;
@@ -4998,7 +5046,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements() {
   for (unsigned long i = 0; i < nVolElemOwned; ++i) {
     /* Easier storage of the metric terms and determine the number of
        integration points for this element. */
-    const su2double* metric = volElem[i].metricTerms.data();
+    const su2metricfloat* metric = volElem[i].metricTerms.data();
     const unsigned short ind = volElem[i].indStandardElement;
     const unsigned short nInt = standardElementsSol[ind].GetNIntegration();
 
@@ -5006,7 +5054,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements() {
        for this element. Note that the Jacobian is the first variable stored
        in the metric terms of the integration points. */
     su2double minJacElem = metric[0];
-    for (unsigned short k = 1; k < nInt; ++k) minJacElem = min(minJacElem, metric[k * nMetricPerPoint]);
+    for (unsigned short k = 1; k < nInt; ++k) minJacElem = min(minJacElem, su2double(metric[k * nMetricPerPoint]));
 
     /* Determine the length scale of the element, for which the length
        scale of the reference element, 2.0, must be taken into account. */
@@ -5280,10 +5328,10 @@ void CMeshFEM_DG::MetricTermsVolumeElements(CConfig* config) {
           for (unsigned short j = 0; j < nInt; ++j) {
             /* Set the pointers where the data for this integration
                point starts. */
-            const su2double* metric = volElem[i].metricTerms.data() + j * nMetricPerPoint;
+            const su2metricfloat* metric = volElem[i].metricTerms.data() + j * nMetricPerPoint;
             const su2double* rDerMetric = vecDerMetrics + j * (nMetricPerPoint - 1);
             const su2double* sDerMetric = rDerMetric + nInt * (nMetricPerPoint - 1);
-            su2double* metric2ndDer = volElem[i].metricTerms2ndDer.data() + j * nMetric2ndDerPerPoint;
+            su2metricfloat* metric2ndDer = volElem[i].metricTerms2ndDer.data() + j * nMetric2ndDerPerPoint;
 
             /* More readable abbreviations for the metric terms
                and its derivatives. */
@@ -5318,11 +5366,11 @@ void CMeshFEM_DG::MetricTermsVolumeElements(CConfig* config) {
           for (unsigned short j = 0; j < nInt; ++j) {
             /* Set the pointers where the data for this integration
                point starts. */
-            const su2double* metric = volElem[i].metricTerms.data() + j * nMetricPerPoint;
+            const su2metricfloat* metric = volElem[i].metricTerms.data() + j * nMetricPerPoint;
             const su2double* rDerMetric = vecDerMetrics + j * (nMetricPerPoint - 1);
             const su2double* sDerMetric = rDerMetric + nInt * (nMetricPerPoint - 1);
             const su2double* tDerMetric = sDerMetric + nInt * (nMetricPerPoint - 1);
-            su2double* metric2ndDer = volElem[i].metricTerms2ndDer.data() + j * nMetric2ndDerPerPoint;
+            su2metricfloat* metric2ndDer = volElem[i].metricTerms2ndDer.data() + j * nMetric2ndDerPerPoint;
 
             /* More readable abbreviations for the metric terms
                and its derivatives. */
@@ -5733,8 +5781,9 @@ void CMeshFEM_DG::TimeCoefficientsPredictorADER_DG(CConfig* config) {
   }
 }
 
+template <class MetricType>
 void CMeshFEM_DG::VolumeMetricTermsFromCoorGradients(const unsigned short nEntities, const su2double* gradCoor,
-                                                     vector<su2double>& metricTerms) {
+                                                     vector<MetricType>& metricTerms) {
   /*--- Convert the dxdr, dydr, etc., stored in coorGradients, to the
         required metric terms. Make a distinction between 2D and 3D. ---*/
   switch (nDim) {
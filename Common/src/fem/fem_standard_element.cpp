@@ -1812,6 +1812,9 @@ CFEMStandardElement::CFEMStandardElement(unsigned short val_VTK_Type, unsigned s
     }
   }
 
+  /*--- Create the 1D data of the sum-factorization kernels, if possible. ---*/
+  CreateTensorProductData();
+
   /*--------------------------------------------------------------------------*/
   /*--- Create the data of the derivatives of the basis functions in the   ---*/
   /*--- solution DOFs of the element.                                      ---*/
@@ -1886,6 +1889,35 @@ CFEMStandardElement::CFEMStandardElement(unsigned short val_VTK_Type, unsigned s
   }
 }
 
+void CFEMStandardElement::TensorProductInterpolation(unsigned short NPad, const su2double* dataDOFs,
+                                                     su2double* dataInt, su2double* work) const {
+  /*--- The same 1D interpolation is applied in all directions. ---*/
+  const su2double* mat[] = {lagBasisInt1D.data(), lagBasisInt1D.data(), lagBasisInt1D.data()};
+  TensorProductApply(NPad, mat, nInt1D, nDOFs1D, dataDOFs, 1, dataInt, false, work);
+}
+
+void CFEMStandardElement::TensorProductResidual(unsigned short NPad, const su2double* fluxes,
+                                                const su2double* sources, su2double* res, su2double* work) const {
+  const unsigned short nDim = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+
+  /*--- The contribution of the flux in direction iDim is obtained with the transposed derivative
+        in that direction and the transposed interpolation in the other directions. The fluxes
+        of all directions are interleaved, hence the stride nDim. ---*/
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    const su2double* mat[3];
+    for (unsigned short jDim = 0; jDim < nDim; ++jDim)
+      mat[jDim] = (iDim == jDim) ? derLagBasisInt1DTrans.data() : lagBasisInt1DTrans.data();
+
+    TensorProductApply(NPad, mat, nDOFs1D, nInt1D, fluxes + iDim * NPad, nDim, res, iDim > 0, work);
+  }
+
+  /*--- Source terms, transposed interpolation in all directions. ---*/
+  if (sources) {
+    const su2double* mat[] = {lagBasisInt1DTrans.data(), lagBasisInt1DTrans.data(), lagBasisInt1DTrans.data()};
+    TensorProductApply(NPad, mat, nDOFs1D, nInt1D, sources, 1, res, true, work);
+  }
+}
+
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double* parCoor, vector<su2double>& lagBasis) {
   /* Determine the number of parametric dimensions, depending on the
      element type. */
@@ -2062,6 +2094,12 @@ void CFEMStandardElement::Copy(const CFEMStandardElement& other) {
   matDerBasisSolDOFs = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt = other.mat2ndDerBasisInt;
+
+  nDOFs1D = other.nDOFs1D;
+  nInt1D = other.nInt1D;
+  lagBasisInt1D = other.lagBasisInt1D;
+  lagBasisInt1DTrans = other.lagBasisInt1DTrans;
+  derLagBasisInt1DTrans = other.derLagBasisInt1DTrans;
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2141,6 +2179,116 @@ void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
   for (unsigned long i = 0; i < dtLagBasisLoc.size(); ++i, ++ii) matDerBasis[ii] = dtLagBasisLoc[i];
 }
 
+void CFEMStandardElement::CreateTensorProductData() {
+  nDOFs1D = nInt1D = 0;
+
+  /*--- Only quadrilaterals and hexahedra of at least degree 1 are considered. ---*/
+  unsigned short nDim;
+  if (VTK_Type == QUADRILATERAL)
+    nDim = 2;
+  else if (VTK_Type == HEXAHEDRON)
+    nDim = 3;
+  else
+    return;
+  if (nPoly == 0) return;
+
+  /*--- The integration rule is a tensor product of the 1D Gauss-Legendre rule, with r running fastest,
+        hence the first points contain the 1D rule. Check this to be on the safe side. ---*/
+  const unsigned short M = orderExact / 2 + 1;
+  unsigned long nIntTensor = 1;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) nIntTensor *= M;
+  if (nIntTensor != nIntegration) return;
+
+  const vector<su2double> rInt1D(rIntegration.begin(), rIntegration.begin() + M);
+  for (unsigned short i = 0; i < nIntegration; ++i)
+    if (rIntegration[i] != rInt1D[i % M]) return;
+
+  /*--- Determine the 1D Lagrangian basis functions and derivatives in the 1D integration points.
+        The DOFs of the 1D element coincide with the DOFs of the element in each direction. ---*/
+  unsigned short nDOFsLine;
+  vector<su2double> rDOFsLine, matVandermondeInvDummy, derLagBasisInt1D;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, rInt1D, nDOFsLine, rDOFsLine, matVandermondeInvDummy,
+                                            lagBasisInt1D, derLagBasisInt1D);
+
+  /*--- Store the transposed matrices, used for the residuals. ---*/
+  lagBasisInt1DTrans.resize(lagBasisInt1D.size());
+  derLagBasisInt1DTrans.resize(derLagBasisInt1D.size());
+
+  for (unsigned short j = 0; j < nDOFsLine; ++j) {
+    for (unsigned short i = 0; i < M; ++i) {
+      lagBasisInt1DTrans[j * M + i] = lagBasisInt1D[i * nDOFsLine + j];
+      derLagBasisInt1DTrans[j * M + i] = derLagBasisInt1D[i * nDOFsLine + j];
+    }
+  }
+
+  nDOFs1D = nDOFsLine;
+  nInt1D = M;
+}
+
+namespace {
+/*!
+ * \brief Contract tensor product data in one direction, out(c,o,b,:) (+)= sum_k A(o,k) in(c,k,b,:), where b
+ *        runs over the faster directions and c over the slower ones. The number of input points per direction
+ *        is a template parameter for the common cases (0 means run-time) such that the k-loop is unrolled.
+ */
+template <unsigned short NIn>
+void TensorContraction(unsigned short nOut, unsigned short nInRun, const su2double* A, unsigned long nBefore,
+                       unsigned long nAfter, unsigned short NPad, const su2double* in, unsigned short strideIn,
+                       su2double* out, bool add) {
+  const unsigned short nIn = NIn ? NIn : nInRun;
+
+  for (unsigned long c = 0; c < nAfter; ++c) {
+    for (unsigned short o = 0; o < nOut; ++o) {
+      const su2double* a = A + o * nIn;
+      for (unsigned long b = 0; b < nBefore; ++b) {
+        su2double* outPoint = out + ((c * nOut + o) * nBefore + b) * NPad;
+        if (!add) {
+          for (unsigned short v = 0; v < NPad; ++v) outPoint[v] = 0.0;
+        }
+        for (unsigned short k = 0; k < nIn; ++k) {
+          const su2double* inPoint = in + ((c * nIn + k) * nBefore + b) * strideIn * NPad;
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (unsigned short v = 0; v < NPad; ++v) outPoint[v] += a[k] * inPoint[v];
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+void CFEMStandardElement::TensorProductApply(unsigned short NPad, const su2double* const* mat, unsigned short nOut,
+                                             unsigned short nIn, const su2double* in, unsigned short strideIn,
+                                             su2double* out, bool add, su2double* work) const {
+  const unsigned short nDim = (VTK_Type == HEXAHEDRON) ? 3 : 2;
+  su2double* buffer[] = {work, work + max(nDOFs, nIntegration) * NPad};
+
+  /*--- Apply the operators one direction at a time, ping-ponging between the work buffers. The directions
+        that were already processed have nOut points, the remaining ones still have nIn points. ---*/
+  unsigned long nBefore = 1;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    unsigned long nAfter = 1;
+    for (unsigned short jDim = iDim + 1; jDim < nDim; ++jDim) nAfter *= nIn;
+
+    const bool last = (iDim + 1 == nDim);
+    const su2double* src = (iDim == 0) ? in : buffer[(iDim + 1) % 2];
+    su2double* dst = last ? out : buffer[iDim % 2];
+    const unsigned short stride = (iDim == 0) ? strideIn : 1;
+    const bool addDst = last && add;
+
+    switch (nIn) {
+      case 2: TensorContraction<2>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 3: TensorContraction<3>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 4: TensorContraction<4>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 5: TensorContraction<5>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 6: TensorContraction<6>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 7: TensorContraction<7>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      case 8: TensorContraction<8>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+      default: TensorContraction<0>(nOut, nIn, mat[iDim], nBefore, nAfter, NPad, src, stride, dst, addDst); break;
+    }
+    nBefore *= nOut;
+  }
+}
+
 void CFEMStandardElement::DataStandardLine() {
   /*--- Determine the Lagrangian basis functions and its derivatives
         in the integration points. ---*/
@@ -4614,12 +4614,59 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(CConfig* config, const vector<CFa
   /*--------------------------------------------------------------------------*/
   /*--- The final weight is obtained by taking the amount of work in time  ---*/
   /*--- into account. Note that this correction is only relevant when time ---*/
-  /*--- accurate local time stepping is employed.                          ---*/
+  /*--- accurate local time stepping is employed. If the work per time     ---*/
+  /*--- level was measured in a previous run (load balance monitoring of   ---*/
+  /*--- the DG solver), the measured factors are used instead of the       ---*/
+  /*--- a priori estimate 2^(maxTimeLevel-timeLevel).                      ---*/
   /*--------------------------------------------------------------------------*/
 
+  vector<su2double> measuredWork;
+  if (config->GetLoadBalance_Freq_FEM() > 0) {
+    /* The master node reads the file, if it exists. The factors are only
+       used if they correspond to the current number of time levels. */
+    if (rank == MASTER_NODE) {
+      ifstream workFile(config->GetWorkWeights_FileName_FEM());
+      if (workFile.is_open()) {
+        string header;
+        getline(workFile, header);
+
+        unsigned short nLevels = 0;
+        workFile >> nLevels;
+        if (nLevels == maxTimeLevel + 1) {
+          measuredWork.resize(nLevels);
+          for (unsigned short i = 0; i < nLevels; ++i) {
+            unsigned short level;
+            workFile >> level >> measuredWork[i];
+            if (!workFile || level != i || measuredWork[i] <= 0.0) {
+              measuredWork.clear();
+              break;
+            }
+          }
+        }
+
+        if (measuredWork.empty())
+          cout << "Measured work in " << config->GetWorkWeights_FileName_FEM()
+               << " does not match the time levels, a priori estimates are used." << endl;
+        else
+          cout << "Measured work per time level of " << config->GetWorkWeights_FileName_FEM()
+               << " is used for the partitioning." << endl;
+      }
+    }
+
+#ifdef HAVE_MPI
+    unsigned short nLevels = measuredWork.size();
+    SU2_MPI::Bcast(&nLevels, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, SU2_MPI::GetComm());
+    measuredWork.resize(nLevels);
+    SU2_MPI::Bcast(measuredWork.data(), nLevels, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+#endif
+  }
+
   for (unsigned long i = 0; i < nElem; ++i) {
-    const unsigned short diffLevel = maxTimeLevel - elem[i]->GetTimeLevel();
-    vwgt[2 * i] *= pow(2, diffLevel);
+    const unsigned short timeLevel = elem[i]->GetTimeLevel();
+    if (measuredWork.empty())
+      vwgt[2 * i] *= pow(2, maxTimeLevel - timeLevel);
+    else
+      vwgt[2 * i] *= measuredWork[timeLevel];
   }
 
   /*--- Determine the minimum of the workload of the elements, i.e. 1st vertex
@@ -37,6 +37,9 @@ CDummyGeometry::CDummyGeometry(CConfig* config) : CGeometry() {
 
   Tag_to_Marker = new string[config->GetnMarker_All()];
 
+  vertexNodes.resize(config->GetnMarker_All());
+  vertexNormals.resize(config->GetnMarker_All());
+
   nDim = CConfig::GetnDim(config->GetMesh_FileName(), config->GetMesh_FileFormat());
 
   config->SetnSpanWiseSections(0);
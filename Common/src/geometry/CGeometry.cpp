@@ -25,12 +25,14 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <numeric>
 #include <unordered_set>
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/CRuntimeProfiler.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
@@ -39,6 +41,21 @@ CGeometry::~CGeometry() {
   unsigned long iElem, iElem_Bound, iVertex;
   unsigned short iMarker;
 
+#ifdef SU2_OMP_OFFLOAD
+  if (dualGridOnDevice) {
+    const auto* ptr = nodes->GetPoints().outerPtr();
+    const auto* pts = nodes->GetPoints().innerIdx();
+    const auto* edg = nodes->GetEdges().innerIdx();
+    const auto* normal = edges->GetNormal().data();
+    const auto* vol = nodes->GetVolume().data();
+    const auto* pvol = &nodes->GetPeriodicVolume(0);
+    const auto nAdj = nodes->GetPoints().getNumNonZeros();
+    const auto nNormal = edges->GetNormal().size();
+    SU2_OMP(target exit data map(release : ptr[:nPoint + 1], pts[:nAdj], edg[:nAdj], normal[:nNormal], vol[:nPoint],
+                                 pvol[:nPoint]))
+  }
+#endif
+
   if (elem != nullptr) {
     for (iElem = 0; iElem < nElem; iElem++) delete elem[iElem];
     delete[] elem;
@@ -94,9 +111,14 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  FreeP2PPersistentRequests();
+
   delete[] bufD_P2PRecv;
   delete[] bufD_P2PSend;
 
+  delete[] bufF_P2PRecv;
+  delete[] bufF_P2PSend;
+
   delete[] bufS_P2PRecv;
   delete[] bufS_P2PSend;
 
@@ -274,6 +296,9 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
   bufD_P2PSend = nullptr;
   bufD_P2PRecv = nullptr;
 
+  bufF_P2PSend = nullptr;
+  bufF_P2PRecv = nullptr;
+
   bufS_P2PSend = nullptr;
   bufS_P2PRecv = nullptr;
 
@@ -286,6 +311,14 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
     req_P2PRecv = new SU2_MPI::Request[nP2PRecv];
   }
 
+  /*--- The pattern of the comms does not change, the requests can be persistent (not differentiable). ---*/
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  persistentP2P = false;
+#else
+  persistentP2P = config->GetPersistent_P2P_Comms();
+#endif
+
   /*--- Build lists of local index values for send. ---*/
 
   count = 0;
@@ -346,6 +379,10 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     maxCountPerPoint = countPerPoint;
 
+    /*--- The persistent requests refer to the old buffers. ---*/
+
+    FreeP2PPersistentRequests();
+
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
     delete[] bufD_P2PSend;
@@ -354,6 +391,12 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
     delete[] bufD_P2PRecv;
     bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
 
+    delete[] bufF_P2PSend;
+    bufF_P2PSend = new float[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+
+    delete[] bufF_P2PRecv;
+    bufF_P2PRecv = new float[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+
     delete[] bufS_P2PSend;
     bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
 
@@ -363,12 +406,126 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+bool CGeometry::MapDualGridToDevice() {
+#ifdef SU2_OMP_OFFLOAD
+  if (dualGridOnDevice || nPoint == 0 || omp_get_num_devices() == 0) return dualGridOnDevice;
+
+  const auto* ptr = nodes->GetPoints().outerPtr();
+  const auto* pts = nodes->GetPoints().innerIdx();
+  const auto* edg = nodes->GetEdges().innerIdx();
+  const auto* normal = edges->GetNormal().data();
+  const auto* vol = nodes->GetVolume().data();
+  const auto* pvol = &nodes->GetPeriodicVolume(0);
+  const auto nAdj = nodes->GetPoints().getNumNonZeros();
+  const auto nNormal = edges->GetNormal().size();
+
+  SU2_OMP(target enter data map(to : ptr[:nPoint + 1], pts[:nAdj], edg[:nAdj], normal[:nNormal], vol[:nPoint],
+                                pvol[:nPoint]))
+  dualGridOnDevice = true;
+#endif
+  return dualGridOnDevice;
+}
+
+void CGeometry::FreeP2PPersistentRequests() {
+  for (auto& entry : P2PPersistentReq) {
+    for (auto& request : entry.second) SU2_MPI::Request_free(&request);
+  }
+  P2PPersistentReq.clear();
+}
+
+void CGeometry::StartP2PPersistentRecvs(unsigned short commType, unsigned short countPerPoint, bool val_reverse) const {
+  const unsigned long key = (countPerPoint * 16ul + commType) * 2 + val_reverse;
+
+  auto it = P2PPersistentReq.find(key);
+
+  if (it == P2PPersistentReq.end()) {
+    /*--- First time this combination is communicated, create the requests with the same
+     buffers, counts, and tags as the non-persistent comms (sends first, then recvs). ---*/
+
+    vector<SU2_MPI::Request> requests(nP2PSend + nP2PRecv);
+
+    /*--- In reverse mode the send structures are used for the recvs and vice-versa. ---*/
+    const auto* nPointSend = val_reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+    const auto* nPointRecv = val_reverse ? nPoint_P2PSend : nPoint_P2PRecv;
+    const auto* neighborsSend = val_reverse ? Neighbors_P2PRecv : Neighbors_P2PSend;
+    const auto* neighborsRecv = val_reverse ? Neighbors_P2PSend : Neighbors_P2PRecv;
+
+    for (int iSend = 0; iSend < nP2PSend; iSend++) {
+      const auto offset = countPerPoint * nPointSend[iSend];
+      const auto count = countPerPoint * (nPointSend[iSend + 1] - nPointSend[iSend]);
+      const auto dest = neighborsSend[iSend];
+      const auto tag = rank + 1;
+      auto* request = &requests[iSend];
+
+      switch (commType) {
+        case COMM_TYPE_DOUBLE:
+          SU2_MPI::Send_init(&((val_reverse ? bufD_P2PRecv : bufD_P2PSend)[offset]), count, MPI_DOUBLE, dest, tag,
+                             SU2_MPI::GetComm(), request);
+          break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Send_init(&((val_reverse ? bufF_P2PRecv : bufF_P2PSend)[offset]), count, MPI_FLOAT, dest, tag,
+                             SU2_MPI::GetComm(), request);
+          break;
+        case COMM_TYPE_UNSIGNED_SHORT:
+          SU2_MPI::Send_init(&((val_reverse ? bufS_P2PRecv : bufS_P2PSend)[offset]), count, MPI_UNSIGNED_SHORT, dest,
+                             tag, SU2_MPI::GetComm(), request);
+          break;
+        default:
+          SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+          break;
+      }
+    }
+
+    for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      const auto offset = countPerPoint * nPointRecv[iRecv];
+      const auto count = countPerPoint * (nPointRecv[iRecv + 1] - nPointRecv[iRecv]);
+      const auto source = neighborsRecv[iRecv];
+      const auto tag = source + 1;
+      auto* request = &requests[nP2PSend + iRecv];
+
+      switch (commType) {
+        case COMM_TYPE_DOUBLE:
+          SU2_MPI::Recv_init(&((val_reverse ? bufD_P2PSend : bufD_P2PRecv)[offset]), count, MPI_DOUBLE, source, tag,
+                             SU2_MPI::GetComm(), request);
+          break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Recv_init(&((val_reverse ? bufF_P2PSend : bufF_P2PRecv)[offset]), count, MPI_FLOAT, source, tag,
+                             SU2_MPI::GetComm(), request);
+          break;
+        case COMM_TYPE_UNSIGNED_SHORT:
+          SU2_MPI::Recv_init(&((val_reverse ? bufS_P2PSend : bufS_P2PRecv)[offset]), count, MPI_UNSIGNED_SHORT,
+                             source, tag, SU2_MPI::GetComm(), request);
+          break;
+        default:
+          SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+          break;
+      }
+    }
+    it = P2PPersistentReq.emplace(key, std::move(requests)).first;
+  }
+
+  /*--- The handles are copied to the arrays used to wait for the comms. ---*/
+
+  const auto& requests = it->second;
+  for (int iSend = 0; iSend < nP2PSend; iSend++) req_P2PSend[iSend] = requests[iSend];
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) req_P2PRecv[iRecv] = requests[nP2PSend + iRecv];
+
+  SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+}
+
 void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, bool val_reverse) const {
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
 
+  if (persistentP2P) {
+    SU2_OMP_MASTER
+    StartP2PPersistentRecvs(commType, countPerPoint, val_reverse);
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   SU2_OMP_MASTER
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
@@ -408,6 +565,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufD_P2PSend[offset]), count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iRecv]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PSend[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iRecv]));
+          break;
         case COMM_TYPE_UNSIGNED_SHORT:
           SU2_MPI::Irecv(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iRecv]));
@@ -443,6 +604,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
           SU2_MPI::Irecv(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iMessage]));
           break;
+        case COMM_TYPE_FLOAT:
+          SU2_MPI::Irecv(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, source, tag, SU2_MPI::GetComm(),
+                         &(req_P2PRecv[iMessage]));
+          break;
         case COMM_TYPE_UNSIGNED_SHORT:
           SU2_MPI::Irecv(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, source, tag, SU2_MPI::GetComm(),
                          &(req_P2PRecv[iMessage]));
@@ -464,6 +629,15 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
 
+  /*--- The persistent request was set up by PostP2PRecvs. ---*/
+
+  if (persistentP2P) {
+    SU2_OMP_MASTER
+    SU2_MPI::Start(&(req_P2PSend[val_iSend]));
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   SU2_OMP_MASTER
   if (val_reverse) {
     /*--- Compute our location in the buffer using the recv data
@@ -496,6 +670,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufD_P2PRecv[offset]), count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PRecv[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       case COMM_TYPE_UNSIGNED_SHORT:
         SU2_MPI::Isend(&(bufS_P2PRecv[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
@@ -531,6 +709,10 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
         SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_DOUBLE, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
         break;
+      case COMM_TYPE_FLOAT:
+        SU2_MPI::Isend(&(bufF_P2PSend[offset]), count, MPI_FLOAT, dest, tag, SU2_MPI::GetComm(),
+                       &(req_P2PSend[val_iSend]));
+        break;
       case COMM_TYPE_UNSIGNED_SHORT:
         SU2_MPI::Isend(&(bufS_P2PSend[offset]), count, MPI_UNSIGNED_SHORT, dest, tag, SU2_MPI::GetComm(),
                        &(req_P2PSend[val_iSend]));
@@ -675,6 +857,8 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, MPI_QU
 void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QUANTITIES commType) {
   if (nP2PRecv == 0) return;
 
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::COMMUNICATION);
+
   /*--- Local variables ---*/
 
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
@@ -1088,6 +1272,39 @@ void CGeometry::PreprocessPeriodicComms(CGeometry* geometry, CConfig* config) {
 
   delete[] idSend;
   delete[] idRecv;
+
+  /*--- The periodic comms of all pairs can be done in a single exchange if no point receives
+   data from more than one pair, otherwise the pairs are communicated one after the other. ---*/
+
+  const unsigned long nPeriodicPair = config->GetnMarker_Periodic() / 2;
+  vector<bool> updatedByPeriodic(geometry->GetnPoint(), false);
+  vector<unsigned long> pairOfPoint(geometry->GetnPoint(), 0);
+  int disjoint = 1;
+
+  for (iRecv = 0; iRecv < nPoint_PeriodicRecv[nPeriodicRecv]; iRecv++) {
+    iPoint = Local_Point_PeriodicRecv[iRecv];
+    iPeriodic = Local_Marker_PeriodicRecv[iRecv];
+    const auto iPair = (iPeriodic > nPeriodicPair) ? iPeriodic - nPeriodicPair : iPeriodic;
+    if (pairOfPoint[iPoint] != 0 && pairOfPoint[iPoint] != iPair) disjoint = 0;
+    pairOfPoint[iPoint] = iPair;
+    updatedByPeriodic[iPoint] = true;
+  }
+  int allDisjoint = 1;
+  SU2_MPI::Allreduce(&disjoint, &allDisjoint, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  periodicPairsDisjoint = (allDisjoint == 1);
+
+  /*--- Flag the point-to-point sends that depend on the result of the periodic comms
+   (the P2P structures are set up before the periodic ones). ---*/
+
+  P2PSendPeriodic.assign(nP2PSend, false);
+  for (int iMessage = 0; iMessage < nP2PSend; iMessage++) {
+    for (auto iSend = nPoint_P2PSend[iMessage]; iSend < nPoint_P2PSend[iMessage + 1]; iSend++) {
+      if (updatedByPeriodic[Local_Point_P2PSend[iSend]]) {
+        P2PSendPeriodic[iMessage] = true;
+        break;
+      }
+    }
+  }
 }
 
 void CGeometry::AllocatePeriodicComms(unsigned short countPerPeriodicPoint) {
@@ -1247,34 +1464,56 @@ void CGeometry::PostPeriodicSends(CGeometry* geometry, const CConfig* config, un
 }
 
 void CGeometry::SetEdges() {
-  nEdge = 0;
+  /*--- The edges are numbered in the order of their lowest point, then the
+   points with the highest index copy the edge from the symmetric entry.
+   The edges of each point are counted first, their offsets give the numbering. ---*/
+  vector<unsigned long> edgeOffset(nPoint + 1, 0);
+
+  SU2_OMP_PARALLEL_(for schedule(static, roundUpDiv(nPoint, omp_get_max_threads())))
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
     for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
+      edgeOffset[iPoint + 1] += (iPoint < nodes->GetPoint(iPoint, iNode));
+    }
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) edgeOffset[iPoint + 1] += edgeOffset[iPoint];
+  nEdge = edgeOffset[nPoint];
+
+  SU2_OMP_PARALLEL_(for schedule(static, roundUpDiv(nPoint, omp_get_max_threads())))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    auto iEdge = edgeOffset[iPoint];
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      if (iPoint < nodes->GetPoint(iPoint, iNode)) nodes->SetEdge(iPoint, iEdge++, iNode);
+    }
+  }
+  END_SU2_OMP_PARALLEL
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic, roundUpDiv(nPoint, 2 * omp_get_max_threads())))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      const auto jPoint = nodes->GetPoint(iPoint, iNode);
+      if (jPoint > iPoint) continue;
       for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
         if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
-          }
+          nodes->SetEdge(iPoint, nodes->GetEdge(jPoint, jNode), iNode);
           break;
         }
       }
     }
   }
+  END_SU2_OMP_PARALLEL
 
   edges = new CEdge(nEdge, nDim);
 
+  SU2_OMP_PARALLEL_(for schedule(static, roundUpDiv(nPoint, omp_get_max_threads())))
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto jPoint : nodes->GetPoints(iPoint)) {
-      if (iPoint < jPoint) {
-        auto iEdge = FindEdge(iPoint, jPoint);
-        edges->SetNodes(iEdge, iPoint, jPoint);
-      }
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      const auto jPoint = nodes->GetPoint(iPoint, iNode);
+      if (iPoint < jPoint) edges->SetNodes(nodes->GetEdge(iPoint, iNode), iPoint, jPoint);
     }
   }
+  END_SU2_OMP_PARALLEL
   edges->SetPaddingNodes();
 }
 
@@ -1530,6 +1769,202 @@ bool CGeometry::SegmentIntersectsTriangle(su2double point0[3], const su2double p
   return (true);
 }
 
+void CGeometry::SetAirfoil_SectionData(bool original_surface, const CConfig* config, su2activematrix& SectionCoord,
+                                       vector<pair<unsigned short, unsigned long> >& SectionElem) const {
+  /*--- Coordinates of the points, grid movement is stored using vertex information,
+   we should go from vertex to points ---*/
+
+  SectionCoord.resize(nPoint, 3) = su2double(0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++) SectionCoord(iPoint, iDim) = nodes->GetCoord(iPoint, iDim);
+
+  if (!original_surface) {
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+        for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+          const su2double* VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
+          const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+          for (auto iDim = 0u; iDim < nDim; iDim++) SectionCoord(iPoint, iDim) += VarCoord[iDim];
+        }
+      }
+    }
+  }
+
+  /*--- Boundary elements of the markers that are cut ---*/
+
+  SectionElem.clear();
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
+      for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++) SectionElem.emplace_back(iMarker, iElem);
+    }
+  }
+}
+
+void CGeometry::ExtractAirfoil_Segments(const su2double* Plane_P0, const su2double* Plane_Normal, su2double MinXCoord,
+                                        su2double MaxXCoord, su2double MinYCoord, su2double MaxYCoord,
+                                        su2double MinZCoord, su2double MaxZCoord, const su2double* FlowVariable,
+                                        const su2activematrix& SectionCoord,
+                                        const vector<pair<unsigned short, unsigned long> >& SectionElem,
+                                        const vector<unsigned long>& ElemList, CAirfoilSegments& Segments,
+                                        const CConfig* config) {
+  unsigned short iMarker, iNode, jNode, iDim;
+  bool intersect;
+  unsigned long iPoint, jPoint, iElem, PointIndex;
+  su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0,
+            Intersection[3] = {0.0, 0.0, 0.0}, Variable_Interp, v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0},
+            CrossProduct = 1.0;
+
+  auto& Xcoord_Index0 = Segments.Xcoord_Index0;
+  auto& Ycoord_Index0 = Segments.Ycoord_Index0;
+  auto& Zcoord_Index0 = Segments.Zcoord_Index0;
+  auto& Variable_Index0 = Segments.Variable_Index0;
+  auto& Xcoord_Index1 = Segments.Xcoord_Index1;
+  auto& Ycoord_Index1 = Segments.Ycoord_Index1;
+  auto& Zcoord_Index1 = Segments.Zcoord_Index1;
+  auto& Variable_Index1 = Segments.Variable_Index1;
+  auto& IGlobalID_Index0 = Segments.IGlobalID_Index0;
+  auto& JGlobalID_Index0 = Segments.JGlobalID_Index0;
+  auto& IGlobalID_Index1 = Segments.IGlobalID_Index1;
+  auto& JGlobalID_Index1 = Segments.JGlobalID_Index1;
+
+  for (const auto iSectionElem : ElemList) {
+    iMarker = SectionElem[iSectionElem].first;
+    iElem = SectionElem[iSectionElem].second;
+    PointIndex = 0;
+
+    /*--- To decide if an element is going to be used or not should be done element based,
+     The first step is to compute and average coordinate for the element ---*/
+
+    su2double AveXCoord = 0.0;
+    su2double AveYCoord = 0.0;
+    su2double AveZCoord = 0.0;
+
+    for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+      iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      AveXCoord += nodes->GetCoord(iPoint, 0);
+      AveYCoord += nodes->GetCoord(iPoint, 1);
+      if (nDim == 3) AveZCoord += nodes->GetCoord(iPoint, 2);
+    }
+
+    AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+    AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+    AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+
+    /*--- To only cut one part of the nacelle based on the cross product
+     of the normal to the plane and a vector that connect the point
+     with the center line ---*/
+
+    CrossProduct = 1.0;
+
+    if (config->GetGeo_Description() == NACELLE) {
+      su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
+      su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
+
+      /*--- Translate to the origin ---*/
+
+      su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
+      su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
+      su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
+
+      /*--- Apply tilt angle ---*/
+
+      su2double XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
+      su2double YCoord_Trans_Tilt = YCoord_Trans;
+      su2double ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+
+      /*--- Apply toe angle ---*/
+
+      su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
+      su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+
+      /*--- Undo plane rotation, we have already rotated the nacelle ---*/
+
+      /*--- Undo tilt angle ---*/
+
+      su2double XPlane_Normal_Tilt = Plane_Normal[0] * cos(-Tilt_Angle) + Plane_Normal[2] * sin(-Tilt_Angle);
+      su2double YPlane_Normal_Tilt = Plane_Normal[1];
+      su2double ZPlane_Normal_Tilt = Plane_Normal[2] * cos(-Tilt_Angle) - Plane_Normal[0] * sin(-Tilt_Angle);
+
+      /*--- Undo toe angle ---*/
+
+      su2double YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt * sin(-Toe_Angle) + YPlane_Normal_Tilt * cos(-Toe_Angle);
+      su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+
+      v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
+      v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
+      v3[0] = v1[1] * ZPlane_Normal_Tilt_Toe - v1[2] * YPlane_Normal_Tilt_Toe;
+      CrossProduct = v3[0] * 1.0;
+    }
+
+    if ((CrossProduct < 0.0) || (AveXCoord <= MinXCoord) || (AveXCoord >= MaxXCoord) || (AveYCoord <= MinYCoord) ||
+        (AveYCoord >= MaxYCoord) || (AveZCoord <= MinZCoord) || (AveZCoord >= MaxZCoord))
+      continue;
+
+    for (unsigned short iFace = 0; iFace < bound[iMarker][iElem]->GetnFaces(); iFace++) {
+      iNode = bound[iMarker][iElem]->GetFaces(iFace, 0);
+      jNode = bound[iMarker][iElem]->GetFaces(iFace, 1);
+      iPoint = bound[iMarker][iElem]->GetNode(iNode);
+      jPoint = bound[iMarker][iElem]->GetNode(jNode);
+
+      for (iDim = 0; iDim < 3; iDim++) {
+        Segment_P0[iDim] = SectionCoord(iPoint, iDim);
+        Segment_P1[iDim] = SectionCoord(jPoint, iDim);
+      }
+
+      Variable_P0 = 0.0;
+      Variable_P1 = 0.0;
+      if (FlowVariable != nullptr) {
+        Variable_P0 = FlowVariable[iPoint];
+        Variable_P1 = FlowVariable[jPoint];
+      }
+
+      /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
+
+      if (nDim == 2) {
+        Xcoord_Index0.push_back(Segment_P0[0]);
+        Xcoord_Index1.push_back(Segment_P1[0]);
+        Ycoord_Index0.push_back(Segment_P0[2]);
+        Ycoord_Index1.push_back(Segment_P1[2]);
+        Zcoord_Index0.push_back(Segment_P0[1]);
+        Zcoord_Index1.push_back(Segment_P1[1]);
+        Variable_Index0.push_back(Variable_P0);
+        Variable_Index1.push_back(Variable_P1);
+        IGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
+        IGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
+        JGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
+        JGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
+        PointIndex++;
+      }
+
+      /*--- In 3D compute the intersection ---*/
+
+      else if (nDim == 3) {
+        intersect = SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0, Plane_Normal,
+                                           Intersection, Variable_Interp);
+        if (intersect) {
+          if (PointIndex == 0) {
+            Xcoord_Index0.push_back(Intersection[0]);
+            Ycoord_Index0.push_back(Intersection[1]);
+            Zcoord_Index0.push_back(Intersection[2]);
+            Variable_Index0.push_back(Variable_Interp);
+            IGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
+            JGlobalID_Index0.push_back(nodes->GetGlobalIndex(jPoint));
+          }
+          if (PointIndex == 1) {
+            Xcoord_Index1.push_back(Intersection[0]);
+            Ycoord_Index1.push_back(Intersection[1]);
+            Zcoord_Index1.push_back(Intersection[2]);
+            Variable_Index1.push_back(Variable_Interp);
+            IGlobalID_Index1.push_back(nodes->GetGlobalIndex(iPoint));
+            JGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
+          }
+          PointIndex++;
+        }
+      }
+    }
+  }
+}
+
 void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Normal, su2double MinXCoord,
                                        su2double MaxXCoord, su2double MinYCoord, su2double MaxYCoord,
                                        su2double MinZCoord, su2double MaxZCoord, const su2double* FlowVariable,
@@ -1538,44 +1973,6 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
                                        bool original_surface, CConfig* config) {
   const bool wasActive = AD::BeginPassive();
 
-  unsigned short iMarker, iNode, jNode, iDim, Index = 0;
-  bool intersect;
-  long Next_Edge = 0;
-  unsigned long iPoint, jPoint, iElem, Trailing_Point, Airfoil_Point, iVertex, iEdge, PointIndex, jEdge;
-  su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0,
-            Intersection[3] = {0.0, 0.0, 0.0}, Trailing_Coord, *VarCoord = nullptr, Variable_Interp,
-            v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0}, CrossProduct = 1.0;
-  bool Found_Edge;
-  passivedouble Dist_Value;
-  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1,
-      Zcoord_Index1, Variable_Index1;
-  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil,
-      JGlobalID_Airfoil;
-  vector<unsigned short> Conection_Index0, Conection_Index1;
-  vector<unsigned long> Duplicate;
-  su2double** Coord_Variation = nullptr;
-  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
-  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
-  vector<bool> AddExtra;
-  unsigned long EdgeDonor;
-  bool FoundEdge;
-
-#ifdef HAVE_MPI
-  unsigned long nLocalEdge, MaxLocalEdge, *Buffer_Send_nEdge, *Buffer_Receive_nEdge, nBuffer_Coord, nBuffer_Variable,
-      nBuffer_GlobalID;
-  int nProcessor, iProcessor;
-  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
-  su2double *Buffer_Send_Variable, *Buffer_Receive_Variable;
-  unsigned long *Buffer_Send_GlobalID, *Buffer_Receive_GlobalID;
-#endif
-
-  Xcoord_Airfoil.clear();
-  Ycoord_Airfoil.clear();
-  Zcoord_Airfoil.clear();
-  Variable_Airfoil.clear();
-  IGlobalID_Airfoil.clear();
-  JGlobalID_Airfoil.clear();
-
   /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
 
   if (nDim == 2) {
@@ -1587,180 +1984,166 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
     Plane_Normal[2] = 0.0;
   }
 
-  /*--- Grid movement is stored using a vertices information,
-   we should go from vertex to points ---*/
-
-  if (!original_surface) {
-    Coord_Variation = new su2double*[nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++) Coord_Variation[iPoint] = new su2double[nDim];
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetMarker_All_GeoEval(iMarker) == YES) {
-        for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
-          iPoint = vertex[iMarker][iVertex]->GetNode();
-          for (iDim = 0; iDim < nDim; iDim++) Coord_Variation[iPoint][iDim] = VarCoord[iDim];
-        }
-      }
-    }
-  }
+  su2activematrix SectionCoord;
+  vector<pair<unsigned short, unsigned long> > SectionElem;
+  SetAirfoil_SectionData(original_surface, config, SectionCoord, SectionElem);
 
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    if (config->GetMarker_All_GeoEval(iMarker) == YES) {
-      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
-        PointIndex = 0;
+  vector<unsigned long> ElemList(SectionElem.size());
+  iota(ElemList.begin(), ElemList.end(), 0ul);
 
-        /*--- To decide if an element is going to be used or not should be done element based,
-         The first step is to compute and average coordinate for the element ---*/
+  CAirfoilSegments Segments;
+  ExtractAirfoil_Segments(Plane_P0, Plane_Normal, MinXCoord, MaxXCoord, MinYCoord, MaxYCoord, MinZCoord, MaxZCoord,
+                          FlowVariable, SectionCoord, SectionElem, ElemList, Segments, config);
 
-        su2double AveXCoord = 0.0;
-        su2double AveYCoord = 0.0;
-        su2double AveZCoord = 0.0;
+  AssembleAirfoil_Section(Plane_Normal, Segments, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil,
+                          config);
 
-        for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          AveXCoord += nodes->GetCoord(iPoint, 0);
-          AveYCoord += nodes->GetCoord(iPoint, 1);
-          if (nDim == 3) AveZCoord += nodes->GetCoord(iPoint, 2);
-        }
+  AD::EndPassive(wasActive);
+}
 
-        AveXCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveYCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
-        AveZCoord /= su2double(bound[iMarker][iElem]->GetnNodes());
+void CGeometry::ComputeAirfoil_Sections(unsigned short nPlane, su2double** Plane_P0, su2double** Plane_Normal,
+                                        const su2double* FlowVariable, vector<su2double>* Xcoord_Airfoil,
+                                        vector<su2double>* Ycoord_Airfoil, vector<su2double>* Zcoord_Airfoil,
+                                        vector<su2double>* Variable_Airfoil, bool original_surface,
+                                        CConfig* config) {
+  if (nPlane == 0) return;
 
-        /*--- To only cut one part of the nacelle based on the cross product
-         of the normal to the plane and a vector that connect the point
-         with the center line ---*/
+  const bool wasActive = AD::BeginPassive();
 
-        CrossProduct = 1.0;
+  /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
 
-        if (config->GetGeo_Description() == NACELLE) {
-          su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
-          su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
+  if (nDim == 2) {
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+      Plane_P0[iPlane][0] = 0.0;
+      Plane_P0[iPlane][1] = 0.0;
+      Plane_P0[iPlane][2] = 0.0;
+      Plane_Normal[iPlane][0] = 0.0;
+      Plane_Normal[iPlane][1] = 1.0;
+      Plane_Normal[iPlane][2] = 0.0;
+    }
+  }
 
-          /*--- Translate to the origin ---*/
+  /*--- The (deformed) coordinates and the list of elements are shared by all the sections. ---*/
 
-          su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
-          su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
-          su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
+  su2activematrix SectionCoord;
+  vector<pair<unsigned short, unsigned long> > SectionElem;
+  SetAirfoil_SectionData(original_surface, config, SectionCoord, SectionElem);
 
-          /*--- Apply tilt angle ---*/
+  vector<unsigned long> AllElem(SectionElem.size());
+  iota(AllElem.begin(), AllElem.end(), 0ul);
 
-          su2double XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
-          su2double YCoord_Trans_Tilt = YCoord_Trans;
-          su2double ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+  /*--- When all the planes are parallel (e.g. span-wise wing stations) the elements are binned in a single
+   *    pass, each element is only visited by the planes that fall within its extent along the normal.
+   *    The projection uses the same perturbed plane as SegmentIntersectsPlane to not miss any segment. ---*/
 
-          /*--- Apply toe angle ---*/
+  bool parallelPlanes = (nDim == 3);
+  for (auto iPlane = 1u; iPlane < nPlane; iPlane++)
+    for (auto iDim = 0u; iDim < 3; iDim++) parallelPlanes &= (Plane_Normal[iPlane][iDim] == Plane_Normal[0][iDim]);
 
-          su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
-          su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+  vector<vector<unsigned long> > PlaneElem;
 
-          /*--- Undo plane rotation, we have already rotated the nacelle ---*/
+  if (parallelPlanes) {
+    const passivedouble epsilon = 1E-6;
+    passivedouble Normal[3];
+    for (auto iDim = 0u; iDim < 3; iDim++) Normal[iDim] = SU2_TYPE::GetValue(Plane_Normal[0][iDim]) + epsilon;
 
-          /*--- Undo tilt angle ---*/
+    vector<pair<passivedouble, unsigned short> > Offset(nPlane);
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+      Offset[iPlane] = {0.0, iPlane};
+      for (auto iDim = 0u; iDim < 3; iDim++)
+        Offset[iPlane].first += Normal[iDim] * (SU2_TYPE::GetValue(Plane_P0[iPlane][iDim]) + epsilon);
+    }
+    sort(Offset.begin(), Offset.end());
+
+    PlaneElem.resize(nPlane);
+
+    for (auto iSectionElem = 0ul; iSectionElem < SectionElem.size(); iSectionElem++) {
+      const auto iMarker = SectionElem[iSectionElem].first;
+      const auto iElem = SectionElem[iSectionElem].second;
+
+      passivedouble MinProj = numeric_limits<passivedouble>::max();
+      passivedouble MaxProj = numeric_limits<passivedouble>::lowest();
+      for (auto iNode = 0u; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
+        passivedouble Proj = 0.0;
+        for (auto iDim = 0u; iDim < 3; iDim++) Proj += Normal[iDim] * SU2_TYPE::GetValue(SectionCoord(iPoint, iDim));
+        MinProj = min(MinProj, Proj);
+        MaxProj = max(MaxProj, Proj);
+      }
+      const passivedouble Tol = 1E-10 * max(1.0, max(fabs(MinProj), fabs(MaxProj)));
 
-          su2double XPlane_Normal_Tilt = Plane_Normal[0] * cos(-Tilt_Angle) + Plane_Normal[2] * sin(-Tilt_Angle);
-          su2double YPlane_Normal_Tilt = Plane_Normal[1];
-          su2double ZPlane_Normal_Tilt = Plane_Normal[2] * cos(-Tilt_Angle) - Plane_Normal[0] * sin(-Tilt_Angle);
+      auto it = lower_bound(Offset.begin(), Offset.end(), make_pair(MinProj - Tol, static_cast<unsigned short>(0)));
+      for (; (it != Offset.end()) && (it->first <= MaxProj + Tol); ++it) PlaneElem[it->second].push_back(iSectionElem);
+    }
+  }
 
-          /*--- Undo toe angle ---*/
+  /*--- The sections are extracted concurrently, the communication and chaining are done one section at a time. ---*/
 
-          su2double YPlane_Normal_Tilt_Toe =
-              XPlane_Normal_Tilt * sin(-Toe_Angle) + YPlane_Normal_Tilt * cos(-Toe_Angle);
-          su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+  vector<CAirfoilSegments> Segments(nPlane);
 
-          v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
-          v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
-          v3[0] = v1[1] * ZPlane_Normal_Tilt_Toe - v1[2] * YPlane_Normal_Tilt_Toe;
-          CrossProduct = v3[0] * 1.0;
-        }
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(1)
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+      ExtractAirfoil_Segments(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, FlowVariable,
+                              SectionCoord, SectionElem, parallelPlanes ? PlaneElem[iPlane] : AllElem,
+                              Segments[iPlane], config);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-        for (unsigned short iFace = 0; iFace < bound[iMarker][iElem]->GetnFaces(); iFace++) {
-          iNode = bound[iMarker][iElem]->GetFaces(iFace, 0);
-          jNode = bound[iMarker][iElem]->GetFaces(iFace, 1);
-          iPoint = bound[iMarker][iElem]->GetNode(iNode);
-          jPoint = bound[iMarker][iElem]->GetNode(jNode);
-
-          if ((CrossProduct >= 0.0) && ((AveXCoord > MinXCoord) && (AveXCoord < MaxXCoord)) &&
-              ((AveYCoord > MinYCoord) && (AveYCoord < MaxYCoord)) &&
-              ((AveZCoord > MinZCoord) && (AveZCoord < MaxZCoord))) {
-            Segment_P0[0] = 0.0;
-            Segment_P0[1] = 0.0;
-            Segment_P0[2] = 0.0;
-            Variable_P0 = 0.0;
-            Segment_P1[0] = 0.0;
-            Segment_P1[1] = 0.0;
-            Segment_P1[2] = 0.0;
-            Variable_P1 = 0.0;
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+    AssembleAirfoil_Section(Plane_Normal[iPlane], Segments[iPlane], Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane],
+                            Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane], config);
+  }
 
-            for (iDim = 0; iDim < nDim; iDim++) {
-              if (original_surface) {
-                Segment_P0[iDim] = nodes->GetCoord(iPoint, iDim);
-                Segment_P1[iDim] = nodes->GetCoord(jPoint, iDim);
-              } else {
-                Segment_P0[iDim] = nodes->GetCoord(iPoint, iDim) + Coord_Variation[iPoint][iDim];
-                Segment_P1[iDim] = nodes->GetCoord(jPoint, iDim) + Coord_Variation[jPoint][iDim];
-              }
-            }
+  AD::EndPassive(wasActive);
+}
 
-            if (FlowVariable != nullptr) {
-              Variable_P0 = FlowVariable[iPoint];
-              Variable_P1 = FlowVariable[jPoint];
-            }
+void CGeometry::AssembleAirfoil_Section(const su2double* Plane_Normal, CAirfoilSegments& Segments,
+                                        vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
+                                        vector<su2double>& Zcoord_Airfoil, vector<su2double>& Variable_Airfoil,
+                                        const CConfig* config) const {
+  unsigned short Index = 0;
+  long Next_Edge = 0;
+  unsigned long Trailing_Point, Airfoil_Point, iEdge, jEdge;
+  su2double Trailing_Coord;
+  bool Found_Edge;
+  passivedouble Dist_Value;
+  vector<unsigned long> IGlobalID_Airfoil, JGlobalID_Airfoil;
+  vector<unsigned short> Conection_Index0, Conection_Index1;
+  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
+  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
+  vector<bool> AddExtra;
+  unsigned long EdgeDonor;
+  bool FoundEdge;
 
-            /*--- In 2D add the points directly (note the change between Y and Z coordinate) ---*/
-
-            if (nDim == 2) {
-              Xcoord_Index0.push_back(Segment_P0[0]);
-              Xcoord_Index1.push_back(Segment_P1[0]);
-              Ycoord_Index0.push_back(Segment_P0[2]);
-              Ycoord_Index1.push_back(Segment_P1[2]);
-              Zcoord_Index0.push_back(Segment_P0[1]);
-              Zcoord_Index1.push_back(Segment_P1[1]);
-              Variable_Index0.push_back(Variable_P0);
-              Variable_Index1.push_back(Variable_P1);
-              IGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
-              IGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
-              JGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
-              JGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
-              PointIndex++;
-            }
+  auto& Xcoord_Index0 = Segments.Xcoord_Index0;
+  auto& Ycoord_Index0 = Segments.Ycoord_Index0;
+  auto& Zcoord_Index0 = Segments.Zcoord_Index0;
+  auto& Variable_Index0 = Segments.Variable_Index0;
+  auto& Xcoord_Index1 = Segments.Xcoord_Index1;
+  auto& Ycoord_Index1 = Segments.Ycoord_Index1;
+  auto& Zcoord_Index1 = Segments.Zcoord_Index1;
+  auto& Variable_Index1 = Segments.Variable_Index1;
+  auto& IGlobalID_Index0 = Segments.IGlobalID_Index0;
+  auto& JGlobalID_Index0 = Segments.JGlobalID_Index0;
+  auto& IGlobalID_Index1 = Segments.IGlobalID_Index1;
+  auto& JGlobalID_Index1 = Segments.JGlobalID_Index1;
 
-            /*--- In 3D compute the intersection ---*/
-
-            else if (nDim == 3) {
-              intersect = SegmentIntersectsPlane(Segment_P0, Segment_P1, Variable_P0, Variable_P1, Plane_P0,
-                                                 Plane_Normal, Intersection, Variable_Interp);
-              if (intersect) {
-                if (PointIndex == 0) {
-                  Xcoord_Index0.push_back(Intersection[0]);
-                  Ycoord_Index0.push_back(Intersection[1]);
-                  Zcoord_Index0.push_back(Intersection[2]);
-                  Variable_Index0.push_back(Variable_Interp);
-                  IGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
-                  JGlobalID_Index0.push_back(nodes->GetGlobalIndex(jPoint));
-                }
-                if (PointIndex == 1) {
-                  Xcoord_Index1.push_back(Intersection[0]);
-                  Ycoord_Index1.push_back(Intersection[1]);
-                  Zcoord_Index1.push_back(Intersection[2]);
-                  Variable_Index1.push_back(Variable_Interp);
-                  IGlobalID_Index1.push_back(nodes->GetGlobalIndex(iPoint));
-                  JGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
-                }
-                PointIndex++;
-              }
-            }
-          }
-        }
-      }
-    }
-  }
+#ifdef HAVE_MPI
+  unsigned long nLocalEdge, MaxLocalEdge, *Buffer_Send_nEdge, *Buffer_Receive_nEdge, nBuffer_Coord, nBuffer_Variable,
+      nBuffer_GlobalID;
+  int nProcessor, iProcessor;
+  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
+  su2double *Buffer_Send_Variable, *Buffer_Receive_Variable;
+  unsigned long *Buffer_Send_GlobalID, *Buffer_Receive_GlobalID;
+#endif
 
-  if (!original_surface) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++) delete[] Coord_Variation[iPoint];
-    delete[] Coord_Variation;
-  }
+  Xcoord_Airfoil.clear();
+  Ycoord_Airfoil.clear();
+  Zcoord_Airfoil.clear();
+  Variable_Airfoil.clear();
 
 #ifdef HAVE_MPI
 
@@ -2312,8 +2695,6 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
       JGlobalID_Index1.clear();
     }
   }
-
-  AD::EndPassive(wasActive);
 }
 
 void CGeometry::RegisterCoordinates() const {
@@ -2326,6 +2707,68 @@ void CGeometry::RegisterCoordinates() const {
   END_SU2_OMP_FOR
 }
 
+void CGeometry::SetRigidMotionControlVolume(const CConfig* config, const su2double (*rotMatrix)[3]) {
+  auto Rotate = [&](const su2double* vec, su2double* rotVec) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      rotVec[iDim] = 0.0;
+      for (auto jDim = 0u; jDim < nDim; jDim++) rotVec[iDim] += rotMatrix[iDim][jDim] * vec[jDim];
+    }
+  };
+
+  /*--- Rotate the normals of the edges and of the vertices. ---*/
+
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    su2double Normal[MAXNDIM] = {0.0};
+    Rotate(edges->GetNormal(iEdge), Normal);
+    edges->SetNormal(iEdge, Normal);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_DYN(1)
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      su2double Normal[MAXNDIM] = {0.0};
+      Rotate(vertex[iMarker][iVertex]->GetNormal(), Normal);
+      vertex[iMarker][iVertex]->SetNormal(Normal);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- The centers of gravity are cheap to recompute (only the primal grid has elements). ---*/
+
+  auto UpdateCG = [&](CPrimalGrid* element) {
+    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+    for (unsigned short iNode = 0; iNode < element->GetnNodes(); iNode++)
+      Coord[iNode] = nodes->GetCoord(element->GetNode(iNode));
+    element->SetCoord_CG(nDim, Coord);
+  };
+
+  if (elem != nullptr) {
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iElem = 0ul; iElem < nElem; iElem++) UpdateCG(elem[iElem]);
+    END_SU2_OMP_FOR
+  }
+
+  if (bound != nullptr && nElem_Bound != nullptr) {
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++)
+      for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++) UpdateCG(bound[iMarker][iElem]);
+    END_SU2_OMP_FOR
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    /*--- The least-squares weights depend on the orientation of the edges. ---*/
+    ClearLeastSquaresWeights();
+
+    ComputeModifiedSymmetryNormals(config);
+
+    /*--- All the points moved, keep the reference of the incremental update consistent. ---*/
+    if (CoordDualGrid.rows() == nPoint) CoordDualGrid = nodes->GetCoord();
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CGeometry::UpdateGeometry(CGeometry** geometry_container, CConfig* config) {
   geometry_container[MESH_0]->InitiateComms(geometry_container[MESH_0], config, MPI_QUANTITIES::COORDINATES);
   geometry_container[MESH_0]->CompleteComms(geometry_container[MESH_0], config, MPI_QUANTITIES::COORDINATES);
@@ -2901,7 +3344,8 @@ void CGeometry::ComputeSurf_Curvature(CConfig* config) {
 
 void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
                                         const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels,
-                                        const unsigned short search_limit, su2double* values) const {
+                                        const unsigned short search_limit, su2double* values,
+                                        CElementFilterCache* cache) const {
   /*--- Apply a filter to "input_values". The filter is an averaging process over the neighbourhood
   of each element, which is a circle in 2D and a sphere in 3D of radius "filter_radius".
   The filter is characterized by its kernel, i.e. how the weights are computed. Multiple kernels
@@ -2911,16 +3355,47 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
   /*--- Check if we need to do any work. ---*/
   if (kernels.empty()) return;
 
+  /*--- The neighbourhoods only depend on the geometry and on the radii, the weights of the distance-based
+  kernels also depend on the kernel parameters. Both are kept in the cache, such that repeated calls only
+  perform the products of the (sparse) filter matrices with the values. Without a cache they are discarded. ---*/
+  CElementFilterCache localCache;
+  if (cache == nullptr) cache = &localCache;
+
+  const bool buildPattern = (cache->neighbours.size() != kernels.size());
+  if (buildPattern) {
+    cache->neighbours.assign(kernels.size(), CCompressedSparsePatternUL());
+    cache->weights.assign(kernels.size(), vector<passivedouble>());
+  }
+
+  auto distanceBased = [](ENUM_FILTER_KERNEL type) {
+    return type == ENUM_FILTER_KERNEL::CONSTANT_WEIGHT || type == ENUM_FILTER_KERNEL::CONICAL_WEIGHT ||
+           type == ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT;
+  };
+
+  /*--- When recording, the weights are recomputed from the (active) centroids and volumes. ---*/
+  const bool activeWeights = AD::TapeActive();
+  vector<char> computeWeights(kernels.size());
+  bool needGeometry = buildPattern;
+  for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
+    computeWeights[iKernel] =
+        distanceBased(kernels[iKernel].first) && (activeWeights || cache->weights[iKernel].empty());
+    needGeometry |= computeWeights[iKernel];
+  }
+
   /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
   processor, this is required because the filter reaches far into adjacent partitions. ---*/
 
   /*--- Adjacency matrix ---*/
   vector<unsigned long> neighbour_start;
   long* neighbour_idx = nullptr;
-  GetGlobalElementAdjacencyMatrix(neighbour_start, neighbour_idx);
+  if (buildPattern) GetGlobalElementAdjacencyMatrix(neighbour_start, neighbour_idx);
 
   /*--- Element centroids and volumes. ---*/
-  auto *cg_elem = new su2double[Global_nElemDomain * nDim], *vol_elem = new su2double[Global_nElemDomain];
+  su2double *cg_elem = nullptr, *vol_elem = nullptr;
+  if (needGeometry) {
+    cg_elem = new su2double[Global_nElemDomain * nDim];
+    vol_elem = new su2double[Global_nElemDomain];
+  }
 #ifdef HAVE_MPI
   /*--- Number of subdomain each point is part of. ---*/
   vector<char> halo_detect(Global_nElemDomain);
@@ -2933,27 +3408,33 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
   whether an element is already added to the list of neighbors (one vector per thread). ---*/
   vector<vector<bool>> is_neighbor(omp_get_max_threads());
 
+  /*--- Neighbourhoods of the local elements, before conversion to the compressed format. ---*/
+  vector<vector<unsigned long>> neighbourhoods(buildPattern ? nElem : 0);
+
   /*--- Begin OpenMP parallel section, count total number of searches for which
   the recursion limit is reached and the full neighborhood is not considered. ---*/
   unsigned long limited_searches = 0;
 
   SU2_OMP_PARALLEL_(reduction(+ : limited_searches)) {
-    /*--- Initialize ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] = 0.0;
-      vol_elem[iElem] = 0.0;
-    }
-    END_SU2_OMP_FOR
+    if (needGeometry) {
+      /*--- Initialize ---*/
+      SU2_OMP_FOR_STAT(256)
+      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] = 0.0;
+        vol_elem[iElem] = 0.0;
+      }
+      END_SU2_OMP_FOR
 
-    /*--- Populate ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-      auto iElem_global = elem[iElem]->GetGlobalIndex();
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem_global + iDim] = elem[iElem]->GetCG(iDim);
-      vol_elem[iElem_global] = elem[iElem]->GetVolume();
+      /*--- Populate ---*/
+      SU2_OMP_FOR_STAT(256)
+      for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+        auto iElem_global = elem[iElem]->GetGlobalIndex();
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          cg_elem[nDim * iElem_global + iDim] = elem[iElem]->GetCG(iDim);
+        vol_elem[iElem_global] = elem[iElem]->GetVolume();
+      }
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
 
 #ifdef HAVE_MPI
     /*--- Account for the duplication introduced by the halo elements and the
@@ -2968,15 +3449,17 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
 
     /*--- Share with all processors ---*/
     BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      auto* dbl_buffer = new su2double[Global_nElemDomain * nDim];
-      SU2_MPI::Allreduce(cg_elem, dbl_buffer, Global_nElemDomain * nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, cg_elem);
-      delete[] dbl_buffer;
-
-      dbl_buffer = new su2double[Global_nElemDomain];
-      SU2_MPI::Allreduce(vol_elem, dbl_buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, vol_elem);
-      delete[] dbl_buffer;
+      if (needGeometry) {
+        auto* dbl_buffer = new su2double[Global_nElemDomain * nDim];
+        SU2_MPI::Allreduce(cg_elem, dbl_buffer, Global_nElemDomain * nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+        swap(dbl_buffer, cg_elem);
+        delete[] dbl_buffer;
+
+        dbl_buffer = new su2double[Global_nElemDomain];
+        SU2_MPI::Allreduce(vol_elem, dbl_buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+        swap(dbl_buffer, vol_elem);
+        delete[] dbl_buffer;
+      }
 
       vector<char> char_buffer(Global_nElemDomain);
       MPI_Allreduce(halo_detect.data(), char_buffer.data(), Global_nElemDomain, MPI_CHAR, MPI_SUM, SU2_MPI::GetComm());
@@ -2984,25 +3467,62 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
     }
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      su2double numRepeat = halo_detect[iElem];
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] /= numRepeat;
-      vol_elem[iElem] /= numRepeat;
+    if (needGeometry) {
+      SU2_OMP_FOR_STAT(256)
+      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
+        su2double numRepeat = halo_detect[iElem];
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] /= numRepeat;
+        vol_elem[iElem] /= numRepeat;
+      }
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
 #endif
 
-    /*--- SECOND: Each processor performs the average for its elements. For each
+    /*--- SECOND: Each processor determines the neighbourhoods of its elements. For each
     element we look for neighbours of neighbours of... until the distance to the
     closest newly found one is greater than the filter radius.  ---*/
 
-    is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain, false);
+    if (buildPattern) {
+      is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain, false);
+
+      for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
+        const auto kernel_radius = SU2_TYPE::GetValue(filter_radius[iKernel]);
+
+        SU2_OMP_FOR_DYN(128)
+        for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+          int thread = omp_get_thread_num();
+          vector<long> neighbours;
+          limited_searches += !GetRadialNeighbourhood(elem[iElem]->GetGlobalIndex(), kernel_radius, search_limit,
+                                                      neighbour_start, neighbour_idx, cg_elem, neighbours,
+                                                      is_neighbor[thread]);
+          neighbourhoods[iElem].assign(neighbours.begin(), neighbours.end());
+        }
+        END_SU2_OMP_FOR
+
+        BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+          cache->neighbours[iKernel] = CCompressedSparsePatternUL(neighbourhoods);
+        }
+        END_SU2_OMP_SAFE_GLOBAL_ACCESS
+      }
+    }
+
+    /*--- THIRD: Apply the kernels, the weights are computed on the first call (or when recording). ---*/
 
     for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
       auto kernel_type = kernels[iKernel].first;
       su2double kernel_param = kernels[iKernel].second;
       su2double kernel_radius = filter_radius[iKernel];
+      const auto& pattern = cache->neighbours[iKernel];
+      auto& cached_weights = cache->weights[iKernel];
+
+      const bool storeWeights = computeWeights[iKernel] && !activeWeights;
+
+      /*--- The loops that synchronize the values complete the resize. ---*/
+      if (storeWeights) {
+        SU2_OMP_MASTER
+        cached_weights.resize(pattern.getNumNonZeros());
+        END_SU2_OMP_MASTER
+      }
 
       /*--- Synchronize work values ---*/
       /*--- Initialize ---*/
@@ -3037,16 +3557,9 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
       /*--- Filter ---*/
       SU2_OMP_FOR_DYN(128)
       for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-        int thread = omp_get_thread_num();
-
         /*--- Center of the search ---*/
         auto iElem_global = elem[iElem]->GetGlobalIndex();
 
-        /*--- Find the neighbours of iElem ---*/
-        vector<long> neighbours;
-        limited_searches +=
-            !GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius), search_limit, neighbour_start,
-                                    neighbour_idx, cg_elem, neighbours, is_neighbor[thread]);
         /*--- Apply the kernel ---*/
         su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
 
@@ -3056,7 +3569,16 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
           case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
           case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
 
-            for (auto idx : neighbours) {
+            /*--- Product of the cached (normalized) weights with the values. ---*/
+            if (!computeWeights[iKernel]) {
+              for (auto k = pattern.outerPtr()[iElem]; k < pattern.outerPtr()[iElem + 1]; ++k)
+                numerator += cached_weights[k] * work_values[pattern.innerIdx()[k]];
+              values[iElem] = numerator;
+              break;
+            }
+
+            for (auto k = pattern.outerPtr()[iElem]; k < pattern.outerPtr()[iElem + 1]; ++k) {
+              const auto idx = pattern.innerIdx()[k];
               su2double distance = 0.0;
               for (unsigned short iDim = 0; iDim < nDim; ++iDim)
                 distance += pow(cg_elem[nDim * iElem_global + iDim] - cg_elem[nDim * idx + iDim], 2);
@@ -3078,15 +3600,22 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
               weight *= vol_elem[idx];
               numerator += weight * work_values[idx];
               denominator += weight;
+              if (storeWeights) cached_weights[k] = SU2_TYPE::GetValue(weight);
             }
             values[iElem] = numerator / denominator;
+
+            if (storeWeights) {
+              for (auto k = pattern.outerPtr()[iElem]; k < pattern.outerPtr()[iElem + 1]; ++k)
+                cached_weights[k] /= SU2_TYPE::GetValue(denominator);
+            }
             break;
 
           /*--- morphology kernels (image processing) ---*/
           case ENUM_FILTER_KERNEL::DILATE_MORPH:
           case ENUM_FILTER_KERNEL::ERODE_MORPH:
 
-            for (auto idx : neighbours) {
+            for (auto k = pattern.outerPtr()[iElem]; k < pattern.outerPtr()[iElem + 1]; ++k) {
+              const auto idx = pattern.innerIdx()[k];
               switch (kernel_type) {
                 case ENUM_FILTER_KERNEL::DILATE_MORPH:
                   numerator += exp(kernel_param * work_values[idx]);
@@ -3112,14 +3641,16 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
   }
   END_SU2_OMP_PARALLEL
 
-  limited_searches /= kernels.size();
+  if (buildPattern) {
+    limited_searches /= kernels.size();
 
-  unsigned long tmp = limited_searches;
-  SU2_MPI::Reduce(&tmp, &limited_searches, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+    unsigned long tmp = limited_searches;
+    SU2_MPI::Reduce(&tmp, &limited_searches, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
-  if (rank == MASTER_NODE && limited_searches > 0)
-    cout << "Warning: The filter radius was limited for " << limited_searches << " elements ("
-         << limited_searches / (0.01 * Global_nElemDomain) << "%).\n";
+    if (rank == MASTER_NODE && limited_searches > 0)
+      cout << "Warning: The filter radius was limited for " << limited_searches << " elements ("
+           << limited_searches / (0.01 * Global_nElemDomain) << "%).\n";
+  }
 
   delete[] neighbour_idx;
   delete[] cg_elem;
@@ -3553,6 +4084,37 @@ const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(Connecti
   return pattern.transposePtr();
 }
 
+void CGeometry::SetVertexStorage() {
+  vertexNodes.clear();
+  vertexNormals.clear();
+  vertexNodes.resize(nMarker);
+  vertexNormals.resize(nMarker);
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    vertexNodes[iMarker].resize(nVertex[iMarker]);
+    vertexNormals[iMarker].resize(nVertex[iMarker], 3) = su2double(0.0);
+
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      vertexNodes[iMarker][iVertex] = vertex[iMarker][iVertex]->GetNode();
+      vertex[iMarker][iVertex]->SetNormalStorage(vertexNormals[iMarker][iVertex]);
+    }
+  }
+}
+
+CCompressedSparsePatternUL CGeometry::GetEdgePattern() const {
+  su2vector<unsigned long> outerPtr(nEdge + 1);
+  su2vector<unsigned long> innerIdx(nEdge * 2);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
+    outerPtr(iEdge) = 2 * iEdge;
+    innerIdx(iEdge * 2 + 0) = edges->GetNode(iEdge, 0);
+    innerIdx(iEdge * 2 + 1) = edges->GetNode(iEdge, 1);
+  }
+  outerPtr(nEdge) = 2 * nEdge;
+
+  return CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficiency, bool maximizeEdgeColorGroupSize) {
   /*--- Check for dry run mode with dummy geometry. ---*/
   if (nEdge == 0) return edgeColoring;
@@ -3567,17 +4129,7 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
     }
 
     /*--- Create a temporary sparse pattern from the edges. ---*/
-    su2vector<unsigned long> outerPtr(nEdge + 1);
-    su2vector<unsigned long> innerIdx(nEdge * 2);
-
-    for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
-      outerPtr(iEdge) = 2 * iEdge;
-      innerIdx(iEdge * 2 + 0) = edges->GetNode(iEdge, 0);
-      innerIdx(iEdge * 2 + 1) = edges->GetNode(iEdge, 1);
-    }
-    outerPtr(nEdge) = 2 * nEdge;
-
-    CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
+    const auto pattern = GetEdgePattern();
 
     /*--- Color the edges. ---*/
     constexpr bool balanceColors = true;
@@ -3655,6 +4207,114 @@ void CGeometry::SetNaturalEdgeColoring() {
   if (omp_get_max_threads() > 1) edgeColorGroupSize = nEdge;
 }
 
+void CGeometry::AutotuneEdgeColoring(unsigned long nVar, unsigned long granularity) {
+  if (nEdge == 0 || omp_get_max_threads() == 1 || !edgeColoring.empty()) return;
+
+  constexpr bool balanceColors = true;
+  constexpr int nRepeat = 4;
+  constexpr int nGroupSize = 4;
+
+  /*--- Proxy of the edge loops, gather from the points of each edge and scatter a flux. ---*/
+  su2passivematrix var(nPoint, nVar), res(nPoint, nVar), flux(nEdge, nVar);
+  var = 1.0;
+  flux = 0.0;
+
+  auto edgeFlux = [&](unsigned long iEdge, unsigned long iVar) {
+    return 0.5 * (var(edges->GetNode(iEdge, 0), iVar) - var(edges->GetNode(iEdge, 1), iVar));
+  };
+
+  /*--- Reducer, edge loop to store the fluxes followed by a point loop to sum them. ---*/
+  auto timeReducer = [&]() {
+    const auto t0 = SU2_MPI::Wtime();
+    SU2_OMP_PARALLEL {
+      for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge)
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) flux(iEdge, iVar) = edgeFlux(iEdge, iVar);
+        END_SU2_OMP_FOR
+
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) res(iPoint, iVar) = 0.0;
+          for (auto iEdge : nodes->GetEdges(iPoint)) {
+            const passivedouble sign = (iPoint == edges->GetNode(iEdge, 0)) ? 1.0 : -1.0;
+            for (auto iVar = 0ul; iVar < nVar; ++iVar) res(iPoint, iVar) += sign * flux(iEdge, iVar);
+          }
+        }
+        END_SU2_OMP_FOR
+      }
+    }
+    END_SU2_OMP_PARALLEL
+    return SU2_MPI::Wtime() - t0;
+  };
+
+  /*--- Coloring, loop over colors updating the residual of both points of each edge. ---*/
+  auto timeColoring = [&](const CCompressedSparsePatternUL& coloring, unsigned long groupSize) {
+    const auto t0 = SU2_MPI::Wtime();
+    SU2_OMP_PARALLEL {
+      for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+        SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+        for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) res(iPoint, iVar) = 0.0;
+        END_SU2_OMP_FOR
+
+        for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+          const auto edgesOfColor = coloring.innerIdx(iColor);
+          const auto nEdgeColor = coloring.getNumNonZeros(iColor);
+
+          SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, groupSize))
+          for (auto k = 0ul; k < nEdgeColor; ++k) {
+            const auto iEdge = edgesOfColor[k];
+            const auto iPoint = edges->GetNode(iEdge, 0);
+            const auto jPoint = edges->GetNode(iEdge, 1);
+            for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+              const auto f = edgeFlux(iEdge, iVar);
+              res(iPoint, iVar) += f;
+              res(jPoint, iVar) -= f;
+            }
+          }
+          END_SU2_OMP_FOR
+        }
+      }
+    }
+    END_SU2_OMP_PARALLEL
+    return SU2_MPI::Wtime() - t0;
+  };
+
+  /*--- The first (untimed) run touches all the memory. ---*/
+  timeReducer();
+  const auto reducerTime = timeReducer();
+
+  const auto pattern = GetEdgePattern();
+  auto bestTime = reducerTime;
+  auto bestGroupSize = 0ul;
+  bool bestLargestFirst = false;
+
+  auto groupSize = edgeColorGroupSize;
+  for (int i = 0; i < nGroupSize && groupSize >= granularity && groupSize % granularity == 0; ++i, groupSize /= 2) {
+    for (const bool largestFirst : {false, true}) {
+      edgeColoring = colorSparsePattern(pattern, groupSize, balanceColors, nullptr, largestFirst);
+      if (edgeColoring.empty()) continue;
+      if (coloringEfficiency(edgeColoring, omp_get_max_threads(), groupSize) < COLORING_EFF_THRESH) continue;
+
+      const auto time = timeColoring(edgeColoring, groupSize);
+      if (time < bestTime) {
+        bestTime = time;
+        bestGroupSize = groupSize;
+        bestLargestFirst = largestFirst;
+      }
+    }
+  }
+
+  if (bestGroupSize == 0) {
+    SetNaturalEdgeColoring();
+  } else {
+    edgeColorGroupSize = bestGroupSize;
+    edgeColoringLargestFirst = bestLargestFirst;
+    edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors, nullptr, edgeColoringLargestFirst);
+  }
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* efficiency) {
   /*--- Check for dry run mode with dummy geometry. ---*/
   if (nElem == 0) return elemColoring;
@@ -3705,6 +4365,39 @@ void CGeometry::SetNaturalElementColoring() {
   if (omp_get_max_threads() > 1) elemColorGroupSize = nElem;
 }
 
+void CGeometry::SetBoundaryMarkerOverlap(const CConfig* config) {
+  /*--- List the points touched by the vertex loop of each marker, the normal neighbors
+   *    are not defined for the markers excluded by FindNormal_Neighbor. ---*/
+  vector<pair<unsigned long, unsigned short> > pointMarker;
+
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+    const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+    const bool normalNeighbor =
+        (kindBC != SEND_RECEIVE) && (kindBC != INTERNAL_BOUNDARY) && (kindBC != NEARFIELD_BOUNDARY);
+
+    for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      pointMarker.emplace_back(vertex[iMarker][iVertex]->GetNode(), iMarker);
+      if (normalNeighbor) pointMarker.emplace_back(vertex[iMarker][iVertex]->GetNormal_Neighbor(), iMarker);
+    }
+  }
+  sort(pointMarker.begin(), pointMarker.end());
+  pointMarker.erase(unique(pointMarker.begin(), pointMarker.end()), pointMarker.end());
+
+  /*--- Markers overlap if they share any point. ---*/
+  boundaryMarkerOverlap.resize(nMarker, nMarker) = false;
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) boundaryMarkerOverlap(iMarker, iMarker) = true;
+
+  for (auto begin = pointMarker.begin(); begin != pointMarker.end();) {
+    auto end = begin;
+    while (end != pointMarker.end() && end->first == begin->first) ++end;
+
+    for (auto i = begin; i != end; ++i)
+      for (auto j = begin; j != end; ++j) boundaryMarkerOverlap(i->second, j->second) = true;
+
+    begin = end;
+  }
+}
+
 void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const* geometry) {
   using tColor = uint8_t;
   constexpr auto nColor = numeric_limits<tColor>::max();
@@ -3902,11 +4595,48 @@ const CGeometry::CLineletInfo& CGeometry::GetLineletInfo(const CConfig* config)
   return li;
 }
 
-void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container) {
+void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry**** geometry_container,
+                                    bool update) {
   int nZone = config_container[ZONE_0]->GetnZone();
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
 
+  /*--- The wall distance does not change if the grids do not move relative to each other, i.e. if
+   * they do not move at all (frame motion), or if there is a single zone moving as a rigid body. ---*/
+
+  if (update) {
+    bool relativeMotion = false;
+    for (int iZone = 0; iZone < nZone; iZone++) {
+      const auto* config = config_container[iZone];
+      const auto kind = config->GetKind_GridMovement();
+      const bool rigid = (kind == NO_MOVEMENT) || (kind == ROTATING_FRAME) || (kind == STEADY_TRANSLATION) ||
+                         (kind == GUST) || ((kind == RIGID_MOTION) && (nZone == 1));
+      relativeMotion |= !rigid || config->GetDeform_Mesh() || (config->GetnKind_SurfaceMovement() > 0);
+    }
+    if (!relativeMotion) return;
+  }
+
+  /*--- For periodic motions the distances repeat every period, after the first one they are loaded. ---*/
+
+  const unsigned long nPhase = update ? GetPeriodicMotion_Steps(config_container, nZone) : 0;
+  const unsigned long phase = (nPhase > 0) ? config_container[ZONE_0]->GetTimeIter() % nPhase : 0;
+
+  if (nPhase > 0) {
+    int cached = true;
+    for (int iZone = 0; iZone < nZone; iZone++) {
+      cached &= int(geometry_container[iZone][INST_0][MESH_0]->HasPeriodicWallDistance(phase));
+    }
+    int allCached = cached;
+    SU2_MPI::Allreduce(&cached, &allCached, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+    if (allCached) {
+      for (int iZone = 0; iZone < nZone; iZone++) {
+        geometry_container[iZone][INST_0][MESH_0]->LoadPeriodicWallDistance(config_container[iZone], phase);
+      }
+      return;
+    }
+  }
+
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++) {
     for (int iZone = 0; iZone < nZone; iZone++) {
       /*--- Check if a zone needs the wall distance and store a boolean ---*/
@@ -3922,14 +4652,23 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
        * This is necessary, because before a computed distance is set, it will be checked
        * whether the new distance is smaller than the currently stored one. ---*/
       CGeometry* geometry = geometry_container[iZone][iInst][MESH_0];
-      if (wallDistanceNeeded[iZone]) geometry->SetWallDistance(numeric_limits<su2double>::max());
+      if (wallDistanceNeeded[iZone]) geometry->ResetWallDistance(config_container[iZone], update);
     }
 
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
     for (int iZone = 0; iZone < nZone; iZone++) {
       unique_ptr<CADTElemClass> WallADT =
           geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
-      if (WallADT && !WallADT->IsEmpty()) {
+      bool wallsPresent = WallADT && !WallADT->IsEmpty();
+
+      /*--- A distributed ADT only holds the walls of this rank. ---*/
+      if (WallADT && !WallADT->IsGlobal()) {
+        int localWalls = wallsPresent, globalWalls = 0;
+        SU2_MPI::Allreduce(&localWalls, &globalWalls, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+        wallsPresent = globalWalls;
+      }
+
+      if (wallsPresent) {
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
          * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
@@ -3940,6 +4679,11 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
       }
     }
 
+    for (int iZone = 0; iZone < nZone; iZone++) {
+      if (wallDistanceNeeded[iZone])
+        geometry_container[iZone][iInst][MESH_0]->FinalizeWallDistance(config_container[iZone]);
+    }
+
     /*--- If there are no viscous walls in the entire domain, set distances to zero ---*/
     if (allEmpty) {
       for (int iZone = 0; iZone < nZone; iZone++) {
@@ -3970,4 +4714,143 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
       }
     }
   }
+
+  /*--- Store the distances of this phase of the periodic motion. ---*/
+  if (nPhase > 0) {
+    for (int iZone = 0; iZone < nZone; iZone++) {
+      geometry_container[iZone][INST_0][MESH_0]->StorePeriodicWallDistance(config_container[iZone], phase, nPhase);
+    }
+  }
+}
+
+unsigned long CGeometry::GetPeriodicMotion_Steps(const CConfig* const* config_container, int nZone) {
+  const auto* config = config_container[ZONE_0];
+  const auto maxSteps = config->GetWallDistance_PeriodicCache();
+
+  if (maxSteps == 0 || !config->GetTime_Domain() || config->GetContinuous_Adjoint() ||
+      config->GetDiscrete_Adjoint() || config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE)
+    return 0;
+
+  unsigned long nSteps = 0;
+
+  for (int iZone = 0; iZone < nZone; iZone++) {
+    config = config_container[iZone];
+    const auto kind = config->GetKind_GridMovement();
+
+    if (config->GetDeform_Mesh() || (config->GetnKind_SurfaceMovement() > 0)) return 0;
+    if (kind == NO_MOVEMENT) continue;
+    if (kind != RIGID_MOTION) return 0;
+
+    /*--- Only rotation (about one axis, otherwise the sequence of rotations in Rigid_Rotation is not periodic). ---*/
+    unsigned short nAxis = 0;
+    su2double omega = 0.0;
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      if (config->GetTranslation_Rate(iDim) != 0.0 || config->GetPlunging_Ampl(iDim) != 0.0 ||
+          config->GetPitching_Ampl(iDim) != 0.0)
+        return 0;
+      if (config->GetRotation_Rate(iDim) != 0.0) {
+        ++nAxis;
+        omega = fabs(config->GetRotation_Rate(iDim) / config->GetOmega_Ref());
+      }
+    }
+    if (nAxis == 0) continue;
+    if (nAxis > 1) return 0;
+
+    /*--- Number of time steps per revolution, it must be an integer. ---*/
+    const passivedouble steps = SU2_TYPE::GetValue(2 * PI_NUMBER / (omega * config->GetDelta_UnstTimeND()));
+    const auto rounded = static_cast<unsigned long>(std::round(steps));
+
+    if (rounded == 0 || fabs(steps - rounded) > 1e-6 * steps) return 0;
+    if (nSteps != 0 && nSteps != rounded) return 0;
+    nSteps = rounded;
+  }
+  return (nSteps <= maxSteps) ? nSteps : 0;
+}
+
+void CGeometry::UpdatePointCostProfile(const CConfig* config) {
+  const auto nIter = config->GetPointCost_Profiling_Iter();
+  if ((nIter == 0) || (pointCostIter > nIter)) return;
+
+  /*--- The first iteration is not profiled as it includes allocations and other one-off costs. ---*/
+
+  if (pointCostIter == 0) {
+    pointCost.assign(nPoint, 0.0);
+    pointCostStartTime = SU2_MPI::Wtime();
+  } else if (pointCostIter == nIter) {
+    const passivedouble totalTime = SU2_MPI::Wtime() - pointCostStartTime;
+
+    /*--- The cost of a point is its profiled time plus the average time per point of the
+     remaining work, which is estimated from the total time of the iterations. The rank
+     with the smallest estimate is used since on the other ranks it includes waiting. ---*/
+
+    passivedouble profiledTime = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) profiledTime += pointCost[iPoint];
+
+    const passivedouble baseCost = (nPointDomain == 0) ? numeric_limits<passivedouble>::max()
+                                   : max(totalTime - profiledTime, 0.01 * totalTime) / nPointDomain;
+    passivedouble minBaseCost = baseCost;
+#ifdef HAVE_MPI
+    MPI_Allreduce(&baseCost, &minBaseCost, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+#endif
+
+    /*--- Gather the relative costs (1 for the average point) on the master in global index order. ---*/
+
+    const int nLocal = nPointDomain;
+    vector<unsigned long> localIdx(nPointDomain);
+    vector<float> localCost(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      localIdx[iPoint] = nodes->GetGlobalIndex(iPoint);
+      localCost[iPoint] = 1.0 + pointCost[iPoint] / minBaseCost;
+    }
+
+    const bool master = (rank == MASTER_NODE);
+#ifdef HAVE_MPI
+    vector<int> nPointRank(size), displ(size + 1, 0);
+    SU2_MPI::Gather(&nLocal, 1, MPI_INT, nPointRank.data(), 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+    for (int iRank = 0; iRank < size; ++iRank) displ[iRank + 1] = displ[iRank] + nPointRank[iRank];
+
+    vector<unsigned long> globalIdx(master ? displ[size] : 0);
+    vector<float> globalCost(master ? displ[size] : 0);
+    MPI_Gatherv(localIdx.data(), nLocal, MPI_UNSIGNED_LONG, globalIdx.data(), nPointRank.data(), displ.data(),
+                MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+    MPI_Gatherv(localCost.data(), nLocal, MPI_FLOAT, globalCost.data(), nPointRank.data(), displ.data(), MPI_FLOAT,
+                MASTER_NODE, SU2_MPI::GetComm());
+#else
+    const auto& globalIdx = localIdx;
+    const auto& globalCost = localCost;
+#endif
+
+    if (master) {
+      vector<float> cost(Global_nPointDomain, 1.0f);
+      for (size_t i = 0; i < globalIdx.size(); ++i) cost[globalIdx[i]] = globalCost[i];
+
+      const auto& filename = config->GetPointCost_FileName();
+      FILE* file = fopen(filename.c_str(), "wb");
+      if (file == nullptr) SU2_MPI::Error("Unable to open the point cost file " + filename, CURRENT_FUNCTION);
+      const uint64_t header[] = {PointCostFileMagic, Global_nPointDomain};
+      fwrite(header, sizeof(header), 1, file);
+      fwrite(cost.data(), sizeof(float), cost.size(), file);
+      fclose(file);
+
+      const auto maxCost = *max_element(cost.begin(), cost.end());
+      cout << "Wrote the cost of each point, measured over " << nIter << " iterations, to " << filename
+           << " (the most expensive point costs " << maxCost << " times the average)." << endl;
+    }
+    decltype(pointCost)().swap(pointCost);
+  }
+  ++pointCostIter;
+}
+
+bool CGeometry::ReadPointCost(const CConfig* config, unsigned long nPointGlobal, unsigned long firstIndex,
+                              vector<float>& cost) {
+  FILE* file = fopen(config->GetPointCost_FileName().c_str(), "rb");
+  if (file == nullptr) return false;
+
+  uint64_t header[2] = {0, 0};
+  bool ok = (fread(header, sizeof(header), 1, file) == 1) && (header[0] == PointCostFileMagic) &&
+            (header[1] == nPointGlobal);
+  ok = ok && (fseek(file, sizeof(header) + firstIndex * sizeof(float), SEEK_SET) == 0);
+  ok = ok && (fread(cost.data(), sizeof(float), cost.size(), file) == cost.size());
+  fclose(file);
+  return ok;
 }
@@ -60,7 +60,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
 
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
   vector<unsigned long> Suitable_Indirect_Neighbors;
 
   nodes = new CPoint(fine_grid->GetnPoint(), nDim, iMesh, config);
@@ -205,122 +204,42 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
     }
   }
 
-  /*--- Update the queue with the results from the boundary agglomeration ---*/
-
-  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
-    if (fine_grid->nodes->GetAgglomerate(iPoint)) {
-      MGQueue_InnerCV.RemoveCV(iPoint);
-
-    } else {
-      /*--- Count the number of agglomerated neighbors, and modify the queue,
-       Points with more agglomerated neighbors are processed first. ---*/
-
-      short priority = 0;
-      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
-        priority += fine_grid->nodes->GetAgglomerate(jPoint);
-      }
-      MGQueue_InnerCV.MoveCV(iPoint, priority);
-    }
-  }
-
   /*--- Agglomerate the domain points. ---*/
 
-  auto iteration = 0ul;
-  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
-    const auto iPoint = MGQueue_InnerCV.NextCV();
-    iteration++;
-
-    /*--- If the element has not been previously agglomerated, belongs to the physical domain,
-     and satisfies several geometrical criteria then the seed CV is accepted for agglomeration. ---*/
+  if (config->GetMG_ParallelAgglomeration())
+    Index_CoarseCV = AgglomerateDomainParallel(fine_grid, config, Index_CoarseCV);
+  else
+    Index_CoarseCV = AgglomerateDomainQueue(fine_grid, config, Index_CoarseCV);
 
-    if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint)) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
-      unsigned short nChildren = 1;
+  /*--- Convert any point that was not agglomerated into a coarse point. Optionally, interior points
+   are merged into the agglomerated neighbor with fewest children instead, these points are typically
+   surrounded by halos or by points that were taken by other seeds. ---*/
 
-      /*--- We set an index for the parent control volume ---*/
-
-      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
-
-      /*--- We add the seed point (child) to the parent control volume ---*/
-
-      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
-
-      /*--- Update the queue with the seed point (remove the seed and
-       increase the priority of its neighbors) ---*/
+  const bool mergeSingletons = config->GetMG_MergeSingletons();
 
-      MGQueue_InnerCV.Update(iPoint, fine_grid);
-
-      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
-
-      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
-        /*--- Determine if the CVPoint can be agglomerated ---*/
-
-        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint)) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
-          /*--- We set the value of the parent ---*/
-
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
-
-          /*--- We set the value of the child ---*/
-
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
+  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint))) {
+      if (mergeSingletons && !fine_grid->nodes->GetBoundary(iPoint)) {
+        auto target = Index_CoarseCV;
+        for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
+          if (!fine_grid->nodes->GetAgglomerate(jPoint) || !fine_grid->nodes->GetDomain(jPoint)) continue;
+          const auto jCoarse = fine_grid->nodes->GetParent_CV(jPoint);
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of its neighbors) ---*/
+          /*--- Boundary points that were not agglomerated (e.g. corners) are kept alone. ---*/
+          if ((nodes->GetnChildren_CV(jCoarse) == 1) && fine_grid->nodes->GetBoundary(jPoint)) continue;
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+          if ((target == Index_CoarseCV) || (nodes->GetnChildren_CV(jCoarse) < nodes->GetnChildren_CV(target)))
+            target = jCoarse;
         }
-      }
-
-      /*--- Identify the indirect neighbors ---*/
-
-      Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
-        SetSuitableNeighbors(Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
-
-      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
-
-      for (auto CVPoint : Suitable_Indirect_Neighbors) {
-        /*--- The new point can be agglomerated ---*/
-
-        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint))) {
-          /*--- We set the value of the parent ---*/
-
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
-
-          /*--- We set the indirect agglomeration information ---*/
-
-          if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint)) nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
-
-          /*--- We set the value of the child ---*/
-
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
-
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
-
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+        if (target != Index_CoarseCV) {
+          const auto nChildren = nodes->GetnChildren_CV(target);
+          fine_grid->nodes->SetParent_CV(iPoint, target);
+          if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint)) nodes->SetAgglomerate_Indirect(target, true);
+          nodes->SetChildren_CV(target, nChildren, iPoint);
+          nodes->SetnChildren_CV(target, nChildren + 1);
+          continue;
         }
       }
-
-      /*--- Update the number of control of childrens ---*/
-
-      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
-      Index_CoarseCV++;
-    } else {
-      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
-       move the point to the lowest priority ---*/
-
-      MGQueue_InnerCV.MoveCV(iPoint, -1);
-    }
-  }
-
-  /*--- Convert any point that was not agglomerated into a coarse point. ---*/
-
-  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
-    if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint))) {
       fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
       if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint)) nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
       nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
@@ -506,6 +425,274 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
 }
 
+unsigned long CMultiGridGeometry::AgglomerateDomainQueue(CGeometry* fine_grid, const CConfig* config,
+                                                         unsigned long Index_CoarseCV) {
+  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+  vector<unsigned long> Suitable_Indirect_Neighbors;
+
+  /*--- Update the queue with the results from the boundary agglomeration ---*/
+
+  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
+    if (fine_grid->nodes->GetAgglomerate(iPoint)) {
+      MGQueue_InnerCV.RemoveCV(iPoint);
+
+    } else {
+      /*--- Count the number of agglomerated neighbors, and modify the queue,
+       Points with more agglomerated neighbors are processed first. ---*/
+
+      short priority = 0;
+      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
+        priority += fine_grid->nodes->GetAgglomerate(jPoint);
+      }
+      MGQueue_InnerCV.MoveCV(iPoint, priority);
+    }
+  }
+
+  /*--- Agglomerate the domain points. ---*/
+
+  auto iteration = 0ul;
+  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
+    const auto iPoint = MGQueue_InnerCV.NextCV();
+    iteration++;
+
+    /*--- If the element has not been previously agglomerated, belongs to the physical domain,
+     and satisfies several geometrical criteria then the seed CV is accepted for agglomeration. ---*/
+
+    if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint)) &&
+        (GeometricalCheck(iPoint, fine_grid, config))) {
+      unsigned short nChildren = 1;
+
+      /*--- We set an index for the parent control volume ---*/
+
+      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+
+      /*--- We add the seed point (child) to the parent control volume ---*/
+
+      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
+
+      /*--- Update the queue with the seed point (remove the seed and
+       increase the priority of its neighbors) ---*/
+
+      MGQueue_InnerCV.Update(iPoint, fine_grid);
+
+      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+
+      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+        /*--- Determine if the CVPoint can be agglomerated ---*/
+
+        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint)) &&
+            (GeometricalCheck(CVPoint, fine_grid, config))) {
+          /*--- We set the value of the parent ---*/
+
+          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+
+          /*--- We set the value of the child ---*/
+
+          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+          nChildren++;
+
+          /*--- Update the queue with the new control volume (remove the CV and
+           increase the priority of its neighbors) ---*/
+
+          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+        }
+      }
+
+      /*--- Identify the indirect neighbors ---*/
+
+      Suitable_Indirect_Neighbors.clear();
+      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+        SetSuitableNeighbors(Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+
+      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+
+      for (auto CVPoint : Suitable_Indirect_Neighbors) {
+        /*--- The new point can be agglomerated ---*/
+
+        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint))) {
+          /*--- We set the value of the parent ---*/
+
+          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+
+          /*--- We set the indirect agglomeration information ---*/
+
+          if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint)) nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+
+          /*--- We set the value of the child ---*/
+
+          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+          nChildren++;
+
+          /*--- Update the queue with the new control volume (remove the CV and
+           increase the priority of the neighbors) ---*/
+
+          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+        }
+      }
+
+      /*--- Update the number of control of childrens ---*/
+
+      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
+      Index_CoarseCV++;
+    } else {
+      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
+       move the point to the lowest priority ---*/
+
+      MGQueue_InnerCV.MoveCV(iPoint, -1);
+    }
+  }
+
+  return Index_CoarseCV;
+}
+
+unsigned long CMultiGridGeometry::AgglomerateDomainParallel(CGeometry* fine_grid, const CConfig* config,
+                                                            unsigned long Index_CoarseCV) {
+  const auto nPointFine = fine_grid->GetnPoint();
+  const auto* fineNodes = fine_grid->nodes;
+
+  /*--- Deterministic tie-break between seeds of equal priority, the hash avoids
+   the directional bias that the plain point index would introduce. ---*/
+
+  auto hash = [](unsigned long i) {
+    uint64_t h = i + 0x9E3779B97F4A7C15ull;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return h ^ (h >> 31);
+  };
+
+  /*--- Candidate seeds, interior points that have not been agglomerated and pass the geometrical check. ---*/
+
+  vector<char> isCandidate(nPointFine, false), isSeed(nPointFine, false);
+  vector<unsigned short> priority(nPointFine, 0);
+  vector<uint64_t> tieBreak(nPointFine);
+  vector<unsigned long> candidates, seeds;
+  vector<vector<unsigned long> > indirectNeighbors;
+
+  SU2_OMP_PARALLEL_(for schedule(static, roundUpDiv(nPointFine, omp_get_max_threads())))
+  for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+    isCandidate[iPoint] = !fineNodes->GetAgglomerate(iPoint) && fineNodes->GetDomain(iPoint) &&
+                          GeometricalCheck(iPoint, fine_grid, config);
+    tieBreak[iPoint] = hash(iPoint);
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++)
+    if (isCandidate[iPoint]) candidates.push_back(iPoint);
+
+  auto higherPriority = [&](unsigned long i, unsigned long j) {
+    if (priority[i] != priority[j]) return priority[i] > priority[j];
+    if (tieBreak[i] != tieBreak[j]) return tieBreak[i] > tieBreak[j];
+    return i < j;
+  };
+
+  while (!candidates.empty()) {
+    const unsigned long nCandidates = candidates.size();
+
+    SU2_OMP_PARALLEL {
+      /*--- Priority of the candidates, as in the serial method the number of agglomerated neighbors. ---*/
+
+      SU2_OMP_FOR_STAT(roundUpDiv(nCandidates, omp_get_num_threads()))
+      for (auto iCand = 0ul; iCand < nCandidates; iCand++) {
+        const auto iPoint = candidates[iCand];
+        unsigned short nAgglomerated = 0;
+        for (auto jPoint : fineNodes->GetPoints(iPoint)) nAgglomerated += fineNodes->GetAgglomerate(jPoint);
+        priority[iPoint] = nAgglomerated;
+      }
+      END_SU2_OMP_FOR
+
+      /*--- A candidate is a seed if it has the highest priority among the candidates that are its neighbors,
+       or neighbors of its neighbors. Hence the direct neighbors of two seeds never overlap. ---*/
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nCandidates, 4 * omp_get_num_threads()))
+      for (auto iCand = 0ul; iCand < nCandidates; iCand++) {
+        const auto iPoint = candidates[iCand];
+        bool seed = true;
+        for (auto jPoint : fineNodes->GetPoints(iPoint)) {
+          if (isCandidate[jPoint] && higherPriority(jPoint, iPoint)) seed = false;
+          for (auto kPoint : fineNodes->GetPoints(jPoint)) {
+            if ((kPoint != iPoint) && isCandidate[kPoint] && higherPriority(kPoint, iPoint)) seed = false;
+            if (!seed) break;
+          }
+          if (!seed) break;
+        }
+        isSeed[iPoint] = seed;
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+
+    /*--- The coarse CVs are numbered in the order of the seeds. ---*/
+
+    seeds.clear();
+    for (auto iPoint : candidates)
+      if (isSeed[iPoint]) seeds.push_back(iPoint);
+
+    const unsigned long nSeeds = seeds.size();
+    indirectNeighbors.resize(nSeeds);
+
+    SU2_OMP_PARALLEL {
+      /*--- Agglomerate the direct neighbors, they belong to a single seed. ---*/
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nSeeds, 4 * omp_get_num_threads()))
+      for (auto iSeed = 0ul; iSeed < nSeeds; iSeed++) {
+        const auto iPoint = seeds[iSeed];
+        const auto iCoarse = Index_CoarseCV + iSeed;
+        unsigned short nChildren = 1;
+
+        fine_grid->nodes->SetParent_CV(iPoint, iCoarse);
+        nodes->SetChildren_CV(iCoarse, 0, iPoint);
+
+        for (auto CVPoint : fineNodes->GetPoints(iPoint)) {
+          if ((!fineNodes->GetAgglomerate(CVPoint)) && (fineNodes->GetDomain(CVPoint)) &&
+              (GeometricalCheck(CVPoint, fine_grid, config))) {
+            fine_grid->nodes->SetParent_CV(CVPoint, iCoarse);
+            nodes->SetChildren_CV(iCoarse, nChildren, CVPoint);
+            nChildren++;
+          }
+        }
+        nodes->SetnChildren_CV(iCoarse, nChildren);
+
+        /*--- Identify the indirect neighbors, these may be shared by several seeds. ---*/
+
+        indirectNeighbors[iSeed].clear();
+        if (fineNodes->GetAgglomerate_Indirect(iPoint))
+          SetSuitableNeighbors(indirectNeighbors[iSeed], iPoint, iCoarse, fine_grid);
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+
+    /*--- Add the indirect neighbors in the order of the seeds (this is cheap, the search was done above). ---*/
+
+    for (auto iSeed = 0ul; iSeed < nSeeds; iSeed++) {
+      const auto iCoarse = Index_CoarseCV + iSeed;
+      auto nChildren = nodes->GetnChildren_CV(iCoarse);
+
+      for (auto CVPoint : indirectNeighbors[iSeed]) {
+        if ((!fineNodes->GetAgglomerate(CVPoint)) && (fineNodes->GetDomain(CVPoint))) {
+          fine_grid->nodes->SetParent_CV(CVPoint, iCoarse);
+          if (fineNodes->GetAgglomerate_Indirect(CVPoint)) nodes->SetAgglomerate_Indirect(iCoarse, true);
+          nodes->SetChildren_CV(iCoarse, nChildren, CVPoint);
+          nChildren++;
+        }
+      }
+      nodes->SetnChildren_CV(iCoarse, nChildren);
+    }
+    Index_CoarseCV += nSeeds;
+
+    /*--- Remove the agglomerated points from the candidates. ---*/
+
+    unsigned long nRemaining = 0;
+    for (auto iPoint : candidates) {
+      isCandidate[iPoint] = !fineNodes->GetAgglomerate(iPoint);
+      if (isCandidate[iPoint]) candidates[nRemaining++] = iPoint;
+    }
+    candidates.resize(nRemaining);
+  }
+
+  return Index_CoarseCV;
+}
+
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, const CGeometry* fine_grid,
                                                const CConfig* config) const {
   bool agglomerate_CV = false;
@@ -816,6 +1003,8 @@ void CMultiGridGeometry::SetVertex(const CGeometry* fine_grid, const CConfig* co
       }
     }
   }
+
+  SetVertexStorage();
 }
 
 void CMultiGridGeometry::MatchActuator_Disk(const CConfig* config) {
@@ -862,66 +1051,95 @@ void CMultiGridGeometry::MatchPeriodic(const CConfig* config, unsigned short val
 }
 
 void CMultiGridGeometry::SetControlVolume(const CGeometry* fine_grid, unsigned short action) {
+  SU2_OMP_SAFE_GLOBAL_ACCESS(ClearLeastSquaresWeights();)
+
+  /*--- Compute the area of the coarse volume ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    su2double Coarse_Volume = 0.0;
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+      Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
+    }
+    nodes->SetVolume(iCoarsePoint, Coarse_Volume);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Transfer operator between the grids as a sparse matrix, the pattern is built once
+   * and the volume weights are updated with the volumes. ---*/
+
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
-    long FineEdge, CoarseEdge;
-    unsigned short iChildren;
-    bool change_face_orientation;
-    su2double Coarse_Volume, Area;
-
-    /*--- Compute the area of the coarse volume ---*/
-    for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++) {
-      nodes->SetVolume(iCoarsePoint, 0.0);
-      Coarse_Volume = 0.0;
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
+    if (MGTransferPattern.empty()) {
+      vector<unsigned long> outerPtr(nPoint + 1, 0), innerIdx;
+      for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+        for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+          innerIdx.push_back(nodes->GetChildren_CV(iCoarsePoint, iChildren));
+        }
+        outerPtr[iCoarsePoint + 1] = innerIdx.size();
       }
-      nodes->SetVolume(iCoarsePoint, Coarse_Volume);
+      MGTransferPattern = CCompressedSparsePatternUL(outerPtr, innerIdx);
+      MGTransferWeights.resize(innerIdx.size());
     }
 
     /*--- Update or not the values of faces at the edge ---*/
     if (action != ALLOCATE) {
       edges->SetZeroValues();
     }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-    for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint++)
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_num_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    const su2double scale = 1 / nodes->GetVolume(iCoarsePoint);
+    const auto* childPtr = MGTransferPattern.outerPtr();
+    for (auto k = childPtr[iCoarsePoint]; k < childPtr[iCoarsePoint + 1]; ++k) {
+      MGTransferWeights[k] = fine_grid->nodes->GetVolume(MGTransferPattern.innerIdx()[k]) * scale;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- A coarse edge only receives the faces of the children of its point with the highest index,
+   * therefore the coarse points can be processed in parallel. ---*/
 
-        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-          iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
-          if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
-            FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+
+      for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
+        const auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+        if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
+          const auto FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
 
-            change_face_orientation = false;
-            if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
+          const bool change_face_orientation = (iFinePoint < iFinePoint_Neighbor);
 
-            CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          const auto CoarseEdge = FindEdge(iParent, iCoarsePoint);
 
-            const auto Normal = fine_grid->edges->GetNormal(FineEdge);
+          const auto Normal = fine_grid->edges->GetNormal(FineEdge);
 
-            if (change_face_orientation) {
-              edges->SubNormal(CoarseEdge, Normal);
-            } else {
-              edges->AddNormal(CoarseEdge, Normal);
-            }
+          if (change_face_orientation) {
+            edges->SubNormal(CoarseEdge, Normal);
+          } else {
+            edges->AddNormal(CoarseEdge, Normal);
           }
         }
       }
+    }
+  }
+  END_SU2_OMP_FOR
 
-    /*--- Check if there is a normal with null area ---*/
+  /*--- Check if there is a normal with null area ---*/
 
-    for (iEdge = 0; iEdge < nEdge; iEdge++) {
-      const auto NormalFace = edges->GetNormal(iEdge);
-      Area = GeometryToolbox::Norm(nDim, NormalFace);
-      if (Area == 0.0) {
-        su2double DefaultNormal[3] = {EPS * EPS};
-        edges->SetNormal(iEdge, DefaultNormal);
-      }
+  SU2_OMP_FOR_STAT(roundUpDiv(nEdge, omp_get_num_threads()))
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    const auto NormalFace = edges->GetNormal(iEdge);
+    const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
+    if (Area == 0.0) {
+      su2double DefaultNormal[3] = {EPS * EPS};
+      edges->SetNormal(iEdge, DefaultNormal);
     }
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  END_SU2_OMP_FOR
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(const CGeometry* fine_grid, const CConfig* config,
@@ -1046,15 +1264,13 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(const CGeometry* fine_grid)
 }
 
 void CMultiGridGeometry::FindNormal_Neighbor(const CConfig* config) {
-  unsigned short iMarker, iDim;
-  unsigned long iPoint, iVertex;
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE &&
         config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY &&
         config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+      SU2_OMP_PARALLEL_(for schedule(dynamic, OMP_MIN_SIZE))
+      for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+        const auto iPoint = vertex[iMarker][iVertex]->GetNode();
 
         /*--- If the node belong to the domain ---*/
         if (nodes->GetDomain(iPoint)) {
@@ -1067,7 +1283,7 @@ void CMultiGridGeometry::FindNormal_Neighbor(const CConfig* config) {
             scalar_prod = 0.0;
             norm_vect = 0.0;
             norm_Normal = 0.0;
-            for (iDim = 0; iDim < nDim; iDim++) {
+            for (unsigned short iDim = 0; iDim < nDim; iDim++) {
               diff_coord = nodes->GetCoord(jPoint, iDim) - nodes->GetCoord(iPoint, iDim);
               scalar_prod += diff_coord * Normal[iDim];
               norm_vect += diff_coord * diff_coord;
@@ -1086,6 +1302,7 @@ void CMultiGridGeometry::FindNormal_Neighbor(const CConfig* config) {
           vertex[iMarker][iVertex]->SetNormal_Neighbor(Point_Normal);
         }
       }
+      END_SU2_OMP_PARALLEL
     }
   }
 }
@@ -32,6 +32,7 @@
 #include "../../include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
@@ -51,10 +52,24 @@
 #include <iterator>
 #include <unordered_set>
 #include <queue>
+#include <numeric>
+#include <functional>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
 
+namespace {
+/*--- Report the wall time of a preprocessing stage, taken from the slowest rank. ---*/
+void PrintStageTime(const char* stage, passivedouble startTime) {
+  const passivedouble localTime = SU2_MPI::Wtime() - startTime;
+  passivedouble maxTime = localTime;
+#ifdef HAVE_MPI
+  MPI_Reduce(&localTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
+#endif
+  if (SU2_MPI::GetRank() == MASTER_NODE) cout << "  " << stage << " time: " << maxTime << " s." << endl;
+}
+}  // namespace
+
 CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {}
 
 CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone, unsigned short val_nZone)
@@ -95,6 +110,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
   } else {
     switch (val_format) {
       case SU2:
+      case SU2_BINARY:
       case CGNS_GRID:
       case RECTANGLE:
       case BOX:
@@ -174,8 +190,8 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
     boundary_file.close();
   }
 
-  /*--- If the gradient smoothing solver is active, allocate space for the sensitivity and initialize. ---*/
-  if (config->GetSmoothGradient()) {
+  /*--- If the gradient smoothing solver or the inline projection are active, allocate space for the sensitivity. ---*/
+  if (config->GetSmoothGradient() || config->GetInline_Gradient_Projection()) {
     Sensitivity.resize(nPoint, nDim) = su2double(0.0);
   }
 }
@@ -195,20 +211,31 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   /*--- Communicate the coloring data so that each rank has a complete set
    of colors for all points that reside on it, including repeats. ---*/
 
+  /*--- Each stage is timed individually and reported in the log. ---*/
+
+  const bool logTimes = (size != SINGLE_NODE);
+  auto startTime = SU2_MPI::Wtime();
+
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Distributing ParMETIS coloring." << endl;
 
   DistributeColoring(config, geometry);
 
+  if (logTimes) PrintStageTime("Coloring distribution", startTime);
+
   /*--- Redistribute the points to all ranks based on the coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Rebalancing vertices." << endl;
 
+  startTime = SU2_MPI::Wtime();
   DistributePoints(config, geometry);
 
+  if (logTimes) PrintStageTime("Vertex rebalancing", startTime);
+
   /*--- Distribute the element information to all ranks based on coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Rebalancing volume element connectivity." << endl;
 
+  startTime = SU2_MPI::Wtime();
   DistributeVolumeConnectivity(config, geometry, TRIANGLE);
   DistributeVolumeConnectivity(config, geometry, QUADRILATERAL);
   DistributeVolumeConnectivity(config, geometry, TETRAHEDRON);
@@ -216,10 +243,14 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   DistributeVolumeConnectivity(config, geometry, PRISM);
   DistributeVolumeConnectivity(config, geometry, PYRAMID);
 
+  if (logTimes) PrintStageTime("Volume element rebalancing", startTime);
+
   /*--- Distribute the marker information to all ranks based on coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE)) cout << "Rebalancing markers and surface elements." << endl;
 
+  startTime = SU2_MPI::Wtime();
+
   /*--- First, perform a linear partitioning of the marker information, as
    the grid readers currently store all boundary information on the master
    rank. In the future, this process can be moved directly into the grid
@@ -238,6 +269,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   DistributeSurfaceConnectivity(config, geometry, TRIANGLE);
   DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
 
+  if (logTimes) PrintStageTime("Surface element rebalancing", startTime);
+
   /*--- Reduce the total number of elements that we have on each rank. ---*/
 
   nLocal_Elem = (nLocal_Tria + nLocal_Quad + nLocal_Tetr + nLocal_Hexa + nLocal_Pris + nLocal_Pyra);
@@ -250,12 +283,15 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
    on the ParMETIS coloring complete, as a final step, load this data into
    our geometry class data structures. ---*/
 
+  startTime = SU2_MPI::Wtime();
   LoadPoints(config, geometry);
   LoadVolumeElements(config, geometry);
   LoadSurfaceElements(config, geometry);
 
-  /*--- If the gradient smoothing solver is active, allocate space for the sensitivity and initialize. ---*/
-  if (config->GetSmoothGradient()) {
+  if (logTimes) PrintStageTime("Partitioned grid loading", startTime);
+
+  /*--- If the gradient smoothing solver or the inline projection are active, allocate space for the sensitivity. ---*/
+  if (config->GetSmoothGradient() || config->GetInline_Gradient_Projection()) {
     Sensitivity.resize(nPoint, nDim) = su2double(0.0);
   }
 
@@ -448,6 +484,18 @@ void CPhysicalGeometry::SetGlobal_to_Local_Point() {
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     Global_to_Local_Point[nodes->GetGlobalIndex(iPoint)] = iPoint;
   }
+
+  /*--- Sorting the local points avoids scanning all global indices when reading restart files. ---*/
+
+  DomainPoints_GlobalOrder.resize(nPointDomain);
+  iota(DomainPoints_GlobalOrder.begin(), DomainPoints_GlobalOrder.end(), 0ul);
+  sort(DomainPoints_GlobalOrder.begin(), DomainPoints_GlobalOrder.end(),
+       [this](unsigned long a, unsigned long b) { return nodes->GetGlobalIndex(a) < nodes->GetGlobalIndex(b); });
+
+  DomainPoints_GlobalIndex.resize(nPointDomain);
+  for (unsigned long i = 0; i < nPointDomain; i++) {
+    DomainPoints_GlobalIndex[i] = nodes->GetGlobalIndex(DomainPoints_GlobalOrder[i]);
+  }
 }
 
 void CPhysicalGeometry::DistributeColoring(const CConfig* config, CGeometry* geometry) {
@@ -523,11 +571,14 @@ void CPhysicalGeometry::DistributeColoring(const CConfig* config, CGeometry* geo
 
   /*--- Post-process the neighbor lists. ---*/
 
-  for (iPoint = 0; iPoint < Point_Map.size(); iPoint++) {
-    sort(Neighbors[iPoint].begin(), Neighbors[iPoint].end());
-    auto it = unique(Neighbors[iPoint].begin(), Neighbors[iPoint].end());
-    Neighbors[iPoint].resize(it - Neighbors[iPoint].begin());
+  const unsigned long nNeighborLists = Point_Map.size();
+  SU2_OMP_PARALLEL_(for schedule(dynamic, roundUpDiv(nNeighborLists, 2 * omp_get_max_threads())))
+  for (unsigned long iList = 0; iList < nNeighborLists; iList++) {
+    auto& neighbors = Neighbors[iList];
+    sort(neighbors.begin(), neighbors.end());
+    neighbors.resize(unique(neighbors.begin(), neighbors.end()) - neighbors.begin());
   }
+  END_SU2_OMP_PARALLEL
 
   /*--- Prepare structures for communication. ---*/
 
@@ -2907,62 +2958,48 @@ void CPhysicalGeometry::SortAdjacency(const CConfig* config) {
 #ifdef HAVE_MPI
 #ifdef HAVE_PARMETIS
 
-  if ((rank == MASTER_NODE) && (size > SINGLE_NODE)) cout << "Executing the partitioning functions." << endl;
-
   /*--- Post process the adjacency information in order to get it into the
-   CSR format before sending the data to ParMETIS. We need to remove
-   repeats and adjust the size of the array for each local node. ---*/
-
-  if ((rank == MASTER_NODE) && (size > SINGLE_NODE)) cout << "Building the graph adjacency structure." << endl;
-
-  /*--- Create a partitioner object so we can transform the global
-   index values stored in the elements to a local index. ---*/
-
-  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
-
-  /*--- We can already create the array that indexes the adjacency. ---*/
+   final CSR format before sending the data to ParMETIS. The entries of each
+   point are sorted in ascending order and the repeats removed, independently
+   for each point, then the unique entries are compacted into a new array. ---*/
 
-  xadj.resize(pointPartitioner.GetSizeOnRank(rank) + 1);
-  xadj[0] = 0;
-
-  /*--- Here, we transfer the adjacency information from a multi-dim vector
-   on a node-by-node basis into a single vector container. First, we sort
-   the entries and remove the duplicates we find for each node, then we
-   copy it into the single vect and clear memory from the multi-dim vec. ---*/
-
-  unsigned long total_adj_size = 0;
-  for (auto& neighbors : adj_nodes) {
-    /*--- For each point, sort the adjacency in ascending order
-     so that we can remove duplicates and complete the size for
-     unique set of adjacent nodes for that point. ---*/
-
-    sort(neighbors.begin(), neighbors.end());
-    auto it = unique(neighbors.begin(), neighbors.end());
-    const auto local_size = it - neighbors.begin();
-    neighbors.resize(local_size);
-    total_adj_size += local_size;
-  }
+  const unsigned long nPointLocal = xadj.size() - 1;
+  vector<idx_t> xadjUnique(nPointLocal + 1);
+  xadjUnique[0] = 0;
+  vector<idx_t> adjacencyUnique;
 
-  /*--- Now that we know the size, create the final adjacency array. This
-   is the array that we will feed to ParMETIS for partitioning. ---*/
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(roundUpDiv(nPointLocal, 2 * omp_get_max_threads()))
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; iPoint++) {
+      const auto begin = adjacency.begin() + xadj[iPoint];
+      const auto end = adjacency.begin() + xadj[iPoint + 1];
+      sort(begin, end);
+      xadjUnique[iPoint + 1] = unique(begin, end) - begin;
+    }
+    END_SU2_OMP_FOR
 
-  adjacency.resize(0);
-  adjacency.reserve(total_adj_size);
+    /*--- Now that we know the size, create the final adjacency array. ---*/
 
-  unsigned long iPoint = 0;
-  for (const auto& neighbors : adj_nodes) {
-    /*--- Move the sorted adjacency into a 1-D vector for all
-     points for loading into ParMETIS for partitioning next. ---*/
-    for (auto jPoint : neighbors) adjacency.push_back(jPoint);
+    SU2_OMP_MASTER {
+      for (unsigned long iPoint = 0; iPoint < nPointLocal; iPoint++) xadjUnique[iPoint + 1] += xadjUnique[iPoint];
+      adjacencyUnique.resize(xadjUnique[nPointLocal]);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
 
-    /*--- Increment the starting index for the next point (CSR). ---*/
-    xadj[iPoint + 1] = xadj[iPoint] + neighbors.size();
-    ++iPoint;
+    SU2_OMP_FOR_STAT(roundUpDiv(nPointLocal, omp_get_max_threads()))
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; iPoint++) {
+      copy_n(adjacency.begin() + xadj[iPoint], xadjUnique[iPoint + 1] - xadjUnique[iPoint],
+             adjacencyUnique.begin() + xadjUnique[iPoint]);
+    }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
 
-  /*--- Force free the entire old multi-dim. adjacency vector. ---*/
+  /*--- Replace the arrays, which also frees the repeated entries. ---*/
 
-  decltype(adj_nodes)().swap(adj_nodes);
+  xadj.swap(xadjUnique);
+  adjacency.swap(adjacencyUnique);
 
 #endif
 #endif
@@ -3469,6 +3506,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
     case SU2:
       MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
       break;
@@ -3777,10 +3817,10 @@ void CPhysicalGeometry::PrepareAdjacency(const CConfig* config) {
 #ifdef HAVE_MPI
 #ifdef HAVE_PARMETIS
 
-  /*--- Resize the vector for the adjacency information (ParMETIS). ---*/
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE)) cout << "Executing the partitioning functions." << endl;
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE)) cout << "Building the graph adjacency structure." << endl;
 
-  adj_nodes.clear();
-  adj_nodes.resize(nPoint);
+  const auto startTime = SU2_MPI::Wtime();
 
   /*--- Create a partitioner object so we can transform the global
    index values stored in the elements to a local index. ---*/
@@ -3788,183 +3828,135 @@ void CPhysicalGeometry::PrepareAdjacency(const CConfig* config) {
   CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
   const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
 
-  /*--- Loop over all elements that are now loaded and store adjacency. ---*/
-
-  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
-    /*--- Store the connectivity for this element more easily. ---*/
-    unsigned long connectivity[8] = {0};
-    for (unsigned long iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-      connectivity[iNode] = elem[iElem]->GetNode(iNode);
-    }
-
-    /*--- Instantiate this element and build adjacency structure. ---*/
-
-    switch (elem[iElem]->GetVTK_Type()) {
-      case TRIANGLE:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
-
-        for (unsigned long iNode = 0; iNode < N_POINTS_TRIANGLE; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
-
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
-
-            for (unsigned long jNode = 0; jNode < N_POINTS_TRIANGLE; jNode++) {
-              /*--- Build adjacency assuming the VTK connectivity ---*/
-
-              if (iNode != jNode) adj_nodes[local_index].push_back(connectivity[jNode]);
-            }
-          }
-        }
-
-        break;
-
-      case QUADRILATERAL:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
-
-        for (unsigned long iNode = 0; iNode < N_POINTS_QUADRILATERAL; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
+  /*--- Visit the graph edges of an element that start at nodes within our
+   linear partition (assuming the VTK connectivity). The same function is used
+   to count and to store the edges, so that both passes see identical entries.
+   Returns false if the element type is not supported. ---*/
 
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
+  using EdgeFunc = std::function<void(unsigned long, unsigned long)>;
 
-            /*--- Build adjacency assuming the VTK connectivity ---*/
+  auto forEachEdge = [&](unsigned long iElem, const EdgeFunc& addEdge) {
+    const auto nNodes = elem[iElem]->GetnNodes();
+    const auto vtkType = elem[iElem]->GetVTK_Type();
 
-            adj_nodes[local_index].push_back(connectivity[(iNode + 1) % 4]);
-            adj_nodes[local_index].push_back(connectivity[(iNode + 3) % 4]);
-          }
-        }
-
-        break;
+    unsigned long connectivity[N_POINTS_MAXIMUM] = {0};
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) connectivity[iNode] = elem[iElem]->GetNode(iNode);
 
-      case TETRAHEDRON:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const long local_index = connectivity[iNode] - firstIndex;
+      if ((local_index < 0) || (local_index >= (long)nPoint)) continue;
 
-        for (unsigned long iNode = 0; iNode < N_POINTS_TETRAHEDRON; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
+      auto add = [&](unsigned short jNode) { addEdge(local_index, connectivity[jNode]); };
 
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
+      switch (vtkType) {
+        case TRIANGLE:
+        case TETRAHEDRON:
+          for (unsigned short jNode = 0; jNode < nNodes; jNode++)
+            if (iNode != jNode) add(jNode);
+          break;
 
-            for (unsigned long jNode = 0; jNode < N_POINTS_TETRAHEDRON; jNode++) {
-              /*--- Build adjacency assuming the VTK connectivity ---*/
+        case QUADRILATERAL:
+          add((iNode + 1) % 4);
+          add((iNode + 3) % 4);
+          break;
 
-              if (iNode != jNode) adj_nodes[local_index].push_back(connectivity[jNode]);
-            }
+        case HEXAHEDRON:
+          if (iNode < 4) {
+            add((iNode + 1) % 4);
+            add((iNode + 3) % 4);
+          } else {
+            add((iNode - 3) % 4 + 4);
+            add((iNode - 1) % 4 + 4);
           }
-        }
-
-        break;
-
-      case HEXAHEDRON:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
-
-        for (unsigned long iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
-
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
-
-            /*--- Build adjacency assuming the VTK connectivity ---*/
+          add((iNode + 4) % 8);
+          break;
 
-            if (iNode < 4) {
-              adj_nodes[local_index].push_back(connectivity[(iNode + 1) % 4]);
-              adj_nodes[local_index].push_back(connectivity[(iNode + 3) % 4]);
-            } else {
-              adj_nodes[local_index].push_back(connectivity[(iNode - 3) % 4 + 4]);
-              adj_nodes[local_index].push_back(connectivity[(iNode - 1) % 4 + 4]);
-            }
-            adj_nodes[local_index].push_back(connectivity[(iNode + 4) % 8]);
+        case PRISM:
+          if (iNode < 3) {
+            add((iNode + 1) % 3);
+            add((iNode + 2) % 3);
+          } else {
+            add((iNode - 2) % 3 + 3);
+            add((iNode - 1) % 3 + 3);
           }
-        }
-
-        break;
-
-      case PRISM:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
-
-        for (unsigned long iNode = 0; iNode < N_POINTS_PRISM; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
-
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
-
-            /*--- Build adjacency assuming the VTK connectivity ---*/
+          add((iNode + 3) % 6);
+          break;
 
-            if (iNode < 3) {
-              adj_nodes[local_index].push_back(connectivity[(iNode + 1) % 3]);
-              adj_nodes[local_index].push_back(connectivity[(iNode + 2) % 3]);
-            } else {
-              adj_nodes[local_index].push_back(connectivity[(iNode - 2) % 3 + 3]);
-              adj_nodes[local_index].push_back(connectivity[(iNode - 1) % 3 + 3]);
-            }
-            adj_nodes[local_index].push_back(connectivity[(iNode + 3) % 6]);
+        case PYRAMID:
+          if (iNode < 4) {
+            add((iNode + 1) % 4);
+            add((iNode + 3) % 4);
+            add(4);
+          } else {
+            for (unsigned short jNode = 0; jNode < 4; jNode++) add(jNode);
           }
-        }
-
-        break;
-
-      case PYRAMID:
-
-        /*--- Decide whether we need to store the adjacency for any nodes
-         in the current element, i.e., check if any of the nodes have a
-         global index value within the range of our linear partitioning. ---*/
+          break;
 
-        for (unsigned long iNode = 0; iNode < N_POINTS_PYRAMID; iNode++) {
-          const long local_index = connectivity[iNode] - firstIndex;
+        default:
+          return false;
+      }
+    }
+    return true;
+  };
 
-          if ((local_index >= 0) && (local_index < (long)nPoint)) {
-            /*--- This node is within our linear partition.
-             Add the neighboring nodes to this nodes' adjacency list. ---*/
+  /*--- The adjacency is built directly in CSR format, with repeated entries
+   (edges shared by several elements). First the entries of each point are
+   counted, then the offsets are computed, and finally the entries are stored
+   at the position reserved for each point. The repeats are removed by
+   SortAdjacency. Elements are processed in parallel and the points they
+   share are updated atomically. ---*/
 
-            /*--- Build adjacency assuming the VTK connectivity ---*/
+  xadj.assign(nPoint + 1, 0);
+  adjacency.clear();
+  vector<idx_t> cursor;
+  unsigned long nUnsupported = 0;
 
-            if (iNode < 4) {
-              adj_nodes[local_index].push_back(connectivity[(iNode + 1) % 4]);
-              adj_nodes[local_index].push_back(connectivity[(iNode + 3) % 4]);
-              adj_nodes[local_index].push_back(connectivity[4]);
-            } else {
-              adj_nodes[local_index].push_back(connectivity[0]);
-              adj_nodes[local_index].push_back(connectivity[1]);
-              adj_nodes[local_index].push_back(connectivity[2]);
-              adj_nodes[local_index].push_back(connectivity[3]);
-            }
-          }
-        }
+  const auto chunkSize = roundUpDiv(nElem, 2 * omp_get_max_threads());
 
-        break;
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      const bool supported = forEachEdge(iElem, [&](unsigned long iPoint, unsigned long) {
+        SU2_OMP_ATOMIC
+        xadj[iPoint + 1]++;
+      });
+      if (!supported) {
+        SU2_OMP_ATOMIC
+        nUnsupported++;
+      }
+    }
+    END_SU2_OMP_FOR
 
-      default:
-        SU2_MPI::Error("Element type not supported!", CURRENT_FUNCTION);
-        break;
+    SU2_OMP_MASTER {
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) xadj[iPoint + 1] += xadj[iPoint];
+      adjacency.resize(xadj[nPoint]);
+      cursor.assign(xadj.begin(), xadj.end() - 1);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+      forEachEdge(iElem, [&](unsigned long iPoint, unsigned long jPoint) {
+        idx_t pos;
+        SU2_OMP(atomic capture)
+        pos = cursor[iPoint]++;
+        adjacency[pos] = jPoint;
+      });
     }
+    END_SU2_OMP_FOR
   }
+  END_SU2_OMP_PARALLEL
+
+  if (nUnsupported) SU2_MPI::Error("Element type not supported!", CURRENT_FUNCTION);
 
   /*--- Prepare the adjacency information that ParMETIS will need for
    completing the graph partitioning in parallel. ---*/
 
   SortAdjacency(config);
 
+  if (size > SINGLE_NODE) PrintStageTime("Graph adjacency", startTime);
+
 #endif
 #endif
 }
@@ -4403,64 +4395,98 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig* config) {
 }
 
 void CPhysicalGeometry::SetPoint_Connectivity() {
-  vector<vector<unsigned long> > points(nPoint);
+  /*--- Elements of each point, counting sort of the element nodes directly into CSR format. ---*/
 
-  SU2_OMP_PARALLEL {
-    unsigned short Node_Neighbor, iNode, iNeighbor;
-    unsigned long jElem, Point_Neighbor, iPoint, iElem;
-
-    /*--- Loop over all the elements ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      vector<vector<long> > elems(nPoint);
-
-      for (iElem = 0; iElem < nElem; iElem++) {
-        /*--- Loop over all the nodes of an element ---*/
-        for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-          iPoint = elem[iElem]->GetNode(iNode);
-          elems[iPoint].push_back(iElem);
-        }
+  su2vector<su2localindex> elemPtr(nPoint + 1), elemIdx;
+  elemPtr = 0;
+  unsigned long nElemNode = 0;
+
+  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+    for (auto iNode = 0u; iNode < elem[iElem]->GetnNodes(); iNode++) {
+      elemPtr(elem[iElem]->GetNode(iNode) + 1)++;
+      nElemNode++;
+    }
+  }
+  CPoint::CheckLocalIndexRange(max({nPoint, nElem, nElemNode}));
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) elemPtr(iPoint + 1) += elemPtr(iPoint);
+  elemIdx.resize(nElemNode);
+  {
+    vector<su2localindex> next(elemPtr.data(), elemPtr.data() + nPoint);
+    for (auto iElem = 0ul; iElem < nElem; iElem++) {
+      for (auto iNode = 0u; iNode < elem[iElem]->GetnNodes(); iNode++) {
+        elemIdx(next[elem[iElem]->GetNode(iNode)]++) = iElem;
       }
-      nodes->SetElems(elems);
     }
-    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  nodes->SetElems(CCompressedSparsePatternLocal(std::move(elemPtr), std::move(elemIdx)));
+
+  /*--- Neighbors of each point. Each thread stores the neighbors of its points contiguously,
+   these lists are then copied into the CSR structure. ---*/
+
+  vector<vector<su2localindex> > threadNeighbors(omp_get_max_threads());
+  vector<unsigned long> neighborStart(nPoint);
+  vector<int> neighborThread(nPoint);
+  su2vector<su2localindex> pointPtr(nPoint + 1), pointIdx;
+  pointPtr(0) = 0;
 
-    /*--- Loop over all the points ---*/
+  SU2_OMP_PARALLEL {
+    auto& neighbors = threadNeighbors[omp_get_thread_num()];
 
     SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
-      /*--- Loop over all elements shared by the point ---*/
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      const auto start = neighbors.size();
 
-      for (iElem = 0; iElem < nodes->GetnElem(iPoint); iElem++) {
-        jElem = nodes->GetElem(iPoint, iElem);
+      /*--- Loop over all elements shared by the point ---*/
 
+      for (auto jElem : nodes->GetElems(iPoint)) {
         /*--- If we find the point iPoint in the surrounding element ---*/
 
-        for (iNode = 0; iNode < elem[jElem]->GetnNodes(); iNode++) {
+        for (auto iNode = 0u; iNode < elem[jElem]->GetnNodes(); iNode++) {
           if (elem[jElem]->GetNode(iNode) != iPoint) continue;
 
           /*--- Localize the local index of the neighbor of iPoint in the element ---*/
 
-          for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
-            Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
-            Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
+          for (auto iNeighbor = 0u; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
+            const auto Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
+            const su2localindex Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
 
             /*--- Store the point into the point, if it is new ---*/
-            auto End = points[iPoint].end();
-            if (find(points[iPoint].begin(), End, Point_Neighbor) == End) points[iPoint].push_back(Point_Neighbor);
+            auto End = neighbors.end();
+            if (find(neighbors.begin() + start, End, Point_Neighbor) == End) neighbors.push_back(Point_Neighbor);
           }
         }
       }
+      neighborStart[iPoint] = start;
+      neighborThread[iPoint] = omp_get_thread_num();
+      pointPtr(iPoint + 1) = neighbors.size() - start;
 
       /*--- Set the number of neighbors variable, this is important for JST and multigrid in parallel. ---*/
-      nodes->SetnNeighbor(iPoint, points[iPoint].size());
+      nodes->SetnNeighbor(iPoint, neighbors.size() - start);
     }
     END_SU2_OMP_FOR
 
-    SU2_OMP_MASTER
-    nodes->SetPoints(points);
+    SU2_OMP_MASTER {
+      unsigned long nNonZero = 0;
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nNonZero += pointPtr(iPoint + 1);
+      CPoint::CheckLocalIndexRange(nNonZero);
+
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) pointPtr(iPoint + 1) += pointPtr(iPoint);
+      pointIdx.resize(nNonZero);
+    }
     END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      const auto* neighbors = threadNeighbors[neighborThread[iPoint]].data() + neighborStart[iPoint];
+      for (auto k = pointPtr(iPoint); k < pointPtr(iPoint + 1); k++) pointIdx(k) = *(neighbors++);
+    }
+    END_SU2_OMP_FOR
   }
   END_SU2_OMP_PARALLEL
+
+  nodes->SetPoints(CCompressedSparsePatternLocal(std::move(pointPtr), std::move(pointIdx)));
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
@@ -4538,6 +4564,76 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
     Result.push_back(iPoint);
   }
 
+  ApplyPoint_Ordering(Result, config);
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(CConfig* config) {
+  /*--- Bits per coordinate, such that the keys fit in 64 bits. ---*/
+  const int nBits = (nDim == 2) ? 31 : 21;
+  const uint64_t maxCoord = (uint64_t(1) << nBits) - 1;
+
+  /*--- Bounding box of the domain points. ---*/
+  su2double minCoord[MAXNDIM], maxExtent = 0.0;
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    minCoord[iDim] = std::numeric_limits<passivedouble>::max();
+    su2double maxVal = std::numeric_limits<passivedouble>::lowest();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      minCoord[iDim] = min(minCoord[iDim], nodes->GetCoord(iPoint, iDim));
+      maxVal = max(maxVal, nodes->GetCoord(iPoint, iDim));
+    }
+    maxExtent = max(maxExtent, maxVal - minCoord[iDim]);
+  }
+  /*--- Same scale in all directions to preserve the shape of the curve. ---*/
+  const passivedouble scale = maxCoord / max(SU2_TYPE::GetValue(maxExtent), EPS);
+
+  vector<uint64_t> Key(nPointDomain);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    uint64_t X[MAXNDIM] = {0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const passivedouble x = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim) - minCoord[iDim]) * scale;
+      X[iDim] = min(static_cast<uint64_t>(max(x, 0.0)), maxCoord);
+    }
+
+    /*--- Transposed Hilbert index (J. Skilling, AIP Conf. Proc. 707, 2004). ---*/
+    const uint64_t M = uint64_t(1) << (nBits - 1);
+    for (uint64_t Q = M; Q > 1; Q >>= 1) {
+      const uint64_t P = Q - 1;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        if (X[iDim] & Q) {
+          X[0] ^= P;
+        } else {
+          const uint64_t t = (X[0] ^ X[iDim]) & P;
+          X[0] ^= t;
+          X[iDim] ^= t;
+        }
+      }
+    }
+    for (auto iDim = 1u; iDim < nDim; iDim++) X[iDim] ^= X[iDim - 1];
+    uint64_t t = 0;
+    for (uint64_t Q = M; Q > 1; Q >>= 1) {
+      if (X[nDim - 1] & Q) t ^= Q - 1;
+    }
+    for (auto iDim = 0u; iDim < nDim; iDim++) X[iDim] ^= t;
+
+    /*--- Interleave the bits of the transposed index to obtain the key. ---*/
+    uint64_t key = 0;
+    for (int iBit = nBits - 1; iBit >= 0; iBit--) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) key = (key << 1) | ((X[iDim] >> iBit) & 1);
+    }
+    Key[iPoint] = key;
+  }
+
+  /*--- Sort the domain points by key, the halo points keep their positions. ---*/
+  vector<unsigned long> Result(nPoint);
+  iota(Result.begin(), Result.end(), 0ul);
+  stable_sort(Result.begin(), Result.begin() + nPointDomain,
+              [&](unsigned long iPoint, unsigned long jPoint) { return Key[iPoint] < Key[jPoint]; });
+
+  ApplyPoint_Ordering(Result, config);
+}
+
+void CPhysicalGeometry::ApplyPoint_Ordering(const vector<unsigned long>& Result, const CConfig* config) {
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -4743,6 +4839,8 @@ void CPhysicalGeometry::SetVertex(const CConfig* config) {
         }
       }
   }
+
+  SetVertexStorage();
 }
 
 void CPhysicalGeometry::ComputeNSpan(CConfig* config, unsigned short val_iZone, unsigned short marker_flag,
@@ -6378,9 +6476,8 @@ void CPhysicalGeometry::MatchActuator_Disk(const CConfig* config) {
 
   if (nMarker_ActDiskInlet != 0) {
     unsigned short iMarker, iDim;
-    unsigned long iVertex, iPoint, iPointGlobal, pPoint = 0, pPointGlobal = 0, pVertex = 0, pMarker = 0, jVertex,
-                                                 jVertex_, jPoint, jPointGlobal, jMarker;
-    su2double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
+    unsigned long iVertex, iPoint, iPointGlobal, pPoint = 0, pPointGlobal = 0, pVertex = 0, pMarker = 0, jVertex;
+    su2double *Coord_i, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
     int iProcessor, pProcessor = 0;
     unsigned long nLocalVertex_ActDisk = 0, MaxLocalVertex_ActDisk = 0;
     int nProcessor = size;
@@ -6485,78 +6582,83 @@ void CPhysicalGeometry::MatchActuator_Disk(const CConfig* config) {
       SU2_MPI::Allgather(Buffer_Send_Marker, nBuffer_Marker, MPI_UNSIGNED_LONG, Buffer_Receive_Marker, nBuffer_Marker,
                          MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-      /*--- Compute the closest point to an actuator disk inlet point ---*/
+      /*--- Compute the closest point to an actuator disk inlet point, for all the (domain) points of
+       the beneficiary markers with a batched query on an ADT of the donor points. ---*/
 
-      maxdist_local = 0.0;
+      vector<su2double> donorCoord, targetCoord;
+      vector<unsigned long> donorIndex, targetVertex, targetMarker;
+
+      for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+        for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
+          const auto index = iProcessor * MaxLocalVertex_ActDisk + jVertex;
+          donorIndex.push_back(index);
+          donorCoord.insert(donorCoord.end(), &Buffer_Receive_Coord[index * nDim],
+                            &Buffer_Receive_Coord[(index + 1) * nDim]);
+        }
+      }
 
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
         if (config->GetMarker_All_KindBC(iMarker) == Beneficiary) {
           for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
             iPoint = vertex[iMarker][iVertex]->GetNode();
-            iPointGlobal = nodes->GetGlobalIndex(iPoint);
-
             if (nodes->GetDomain(iPoint)) {
-              /*--- Coordinates of the boundary point ---*/
-
+              targetMarker.push_back(iMarker);
+              targetVertex.push_back(iVertex);
               Coord_i = nodes->GetCoord(iPoint);
-              mindist = 1E6;
-              pProcessor = 0;
-              pPoint = 0;
-
-              /*--- Loop over all the boundaries to find the pair ---*/
-
-              Perimeter = false;
-
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                  jPoint = Buffer_Receive_Point[iProcessor * MaxLocalVertex_ActDisk + jVertex];
-                  jPointGlobal = Buffer_Receive_GlobalIndex[iProcessor * MaxLocalVertex_ActDisk + jVertex];
-                  jVertex_ = Buffer_Receive_Vertex[iProcessor * MaxLocalVertex_ActDisk + jVertex];
-                  jMarker = Buffer_Receive_Marker[iProcessor * MaxLocalVertex_ActDisk + jVertex];
-
-                  //                 if (jPointGlobal != iPointGlobal) {
-                  //                 ActDisk_Perimeter
+              targetCoord.insert(targetCoord.end(), Coord_i, Coord_i + nDim);
+            }
+          }
+        }
+      }
 
-                  /*--- Compute the distance ---*/
+      const auto nTarget = targetVertex.size();
+      vector<su2double> closestDist(nTarget, 1E6);
+      vector<unsigned long> closestIndex(nTarget);
+      vector<int> closestRank(nTarget);
 
-                  dist = 0.0;
-                  for (iDim = 0; iDim < nDim; iDim++) {
-                    Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor * MaxLocalVertex_ActDisk + jVertex) * nDim + iDim];
-                    dist += pow(Coord_j[iDim] - Coord_i[iDim], 2.0);
-                  }
-                  dist = sqrt(dist);
+      if (nTarget > 0 && !donorIndex.empty()) {
+        CADTPointsOnlyClass donorADT(nDim, donorIndex.size(), donorCoord.data(), donorIndex.data(), false);
+        donorADT.DetermineNearestNodes(nTarget, targetCoord.data(), nDim, closestDist.data(), closestIndex.data(),
+                                       closestRank.data());
+      }
 
-                  if (dist < mindist) {
-                    mindist = dist;
-                    pProcessor = iProcessor;
-                    pPoint = jPoint;
-                    pPointGlobal = jPointGlobal;
-                    pVertex = jVertex_;
-                    pMarker = jMarker;
-                    if (dist == 0.0) break;
-                  }
+      maxdist_local = 0.0;
 
-                  //                  }
-                  //                  else { Perimeter = true; mindist = 0.0; dist = 0.0; break; }
-                }
-              }
+      for (unsigned long iTarget = 0; iTarget < nTarget; iTarget++) {
+        iMarker = targetMarker[iTarget];
+        iVertex = targetVertex[iTarget];
+        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPointGlobal = nodes->GetGlobalIndex(iPoint);
+
+        /*--- Retrieve the pair ---*/
+
+        mindist = closestDist[iTarget];
+        pProcessor = 0;
+        pPoint = 0;
+        Perimeter = false;
+
+        if (!donorIndex.empty()) {
+          const auto index = closestIndex[iTarget];
+          pProcessor = index / MaxLocalVertex_ActDisk;
+          pPoint = Buffer_Receive_Point[index];
+          pPointGlobal = Buffer_Receive_GlobalIndex[index];
+          pVertex = Buffer_Receive_Vertex[index];
+          pMarker = Buffer_Receive_Marker[index];
+        }
 
-              /*--- Store the value of the pair ---*/
+        /*--- Store the value of the pair ---*/
 
-              maxdist_local = max(maxdist_local, mindist);
-              vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pPointGlobal, pVertex, pMarker, pProcessor);
-              vertex[iMarker][iVertex]->SetActDisk_Perimeter(Perimeter);
+        maxdist_local = max(maxdist_local, mindist);
+        vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pPointGlobal, pVertex, pMarker, pProcessor);
+        vertex[iMarker][iVertex]->SetActDisk_Perimeter(Perimeter);
 
-              if (mindist > epsilon) {
-                cout.precision(10);
-                cout << endl;
-                cout << "   Bad match for point " << iPoint << ".\tNearest";
-                cout << " donor distance: " << scientific << mindist << ".";
-                vertex[iMarker][iVertex]->SetDonorPoint(iPoint, iPointGlobal, pVertex, pMarker, pProcessor);
-                maxdist_local = min(maxdist_local, 0.0);
-              }
-            }
-          }
+        if (mindist > epsilon) {
+          cout.precision(10);
+          cout << endl;
+          cout << "   Bad match for point " << iPoint << ".\tNearest";
+          cout << " donor distance: " << scientific << mindist << ".";
+          vertex[iMarker][iVertex]->SetDonorPoint(iPoint, iPointGlobal, pVertex, pMarker, pProcessor);
+          maxdist_local = min(maxdist_local, 0.0);
         }
       }
 
@@ -7048,137 +7150,253 @@ void CPhysicalGeometry::FindUniqueNode_PeriodicBound(const CConfig* config) {
   }
 }
 
-void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action) {
-  /*--- Update values of faces of the edge ---*/
-  if (action != ALLOCATE) {
-    su2double ZeroArea[MAXNDIM] = {0.0};
+su2double CPhysicalGeometry::AddElemControlVolume(unsigned long iElem, const vector<bool>& updatePoint,
+                                                  const vector<bool>& updateEdge) {
+  const auto nNodes = elem[iElem]->GetnNodes();
+  const bool allPoints = updatePoint.empty(), allEdges = updateEdge.empty();
+  su2double ElemVolume = 0.0;
 
-    SU2_OMP_FOR_STAT(1024)
-    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) edges->SetNormal(iEdge, ZeroArea);
-    END_SU2_OMP_FOR
+  /*--- To make preaccumulation more effective, use as few inputs
+   as possible, recomputing intermediate quantities as needed. ---*/
+  AD::StartPreacc();
 
-    SU2_OMP_FOR_STAT(1024)
-    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nodes->SetVolume(iPoint, 0.0);
-    END_SU2_OMP_FOR
+  /*--- Get pointers to the coordinates of all the element nodes ---*/
+  array<const su2double*, N_POINTS_MAXIMUM> Coord;
+
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+    auto iPoint = elem[iElem]->GetNode(iNode);
+    Coord[iNode] = nodes->GetCoord(iPoint);
+#ifdef CODI_REVERSE_TYPE
+    /*--- The same points and edges will be referenced multiple times as they are common
+     to many of the element's faces, therefore they are "registered" here only once. ---*/
+    AD::SetPreaccIn(nodes->Volume(iPoint));
+    for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
+      auto jPoint = elem[iElem]->GetNode(jNode);
+      auto iEdge = FindEdge(iPoint, jPoint, false);
+      if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
+    }
+#endif
   }
+  AD::SetPreaccIn(Coord, nNodes, nDim);
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { /*--- The following is difficult to parallelize with threads. ---*/
+  /*--- Compute the element median CG coordinates ---*/
+  auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(nDim, Coord);
+  AD::SetPreaccOut(Coord_Elem_CG, nDim);
 
-    su2double my_DomainVolume = 0.0;
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto nNodes = elem[iElem]->GetnNodes();
+  for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+    /*--- In 2D all the faces have only one edge ---*/
+    unsigned short nEdgesFace = 1;
 
-      /*--- To make preaccumulation more effective, use as few inputs
-       as possible, recomputing intermediate quantities as needed. ---*/
-      AD::StartPreacc();
+    /*--- In 3D the number of edges per face is the same as the number of point
+     per face and the median CG of the face is needed. ---*/
+    su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
+    if (nDim == 3) {
+      nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
 
-      /*--- Get pointers to the coordinates of all the element nodes ---*/
-      array<const su2double*, N_POINTS_MAXIMUM> Coord;
+      for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
+        auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim] / nEdgesFace;
+      }
+    }
 
-      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-        auto iPoint = elem[iElem]->GetNode(iNode);
-        Coord[iNode] = nodes->GetCoord(iPoint);
-#ifdef CODI_REVERSE_TYPE
-        /*--- The same points and edges will be referenced multiple times as they are common
-         to many of the element's faces, therefore they are "registered" here only once. ---*/
-        AD::SetPreaccIn(nodes->Volume(iPoint));
-        for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
-          auto jPoint = elem[iElem]->GetNode(jNode);
-          auto iEdge = FindEdge(iPoint, jPoint, false);
-          if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
-        }
-#endif
+    /*-- Loop over the edges of a face ---*/
+    for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+      const auto face_iNode = elem[iElem]->GetFaces(iFace, iEdgesFace);
+      unsigned short face_jNode;
+
+      if (nDim == 2) {
+        /*--- In 2D only one edge (two points) per edge ---*/
+        face_jNode = elem[iElem]->GetFaces(iFace, 1);
+      } else {
+        /*--- In 3D we "circle around" the face ---*/
+        face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace + 1) % nEdgesFace);
       }
-      AD::SetPreaccIn(Coord, nNodes, nDim);
 
-      /*--- Compute the element median CG coordinates ---*/
-      auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(nDim, Coord);
-      AD::SetPreaccOut(Coord_Elem_CG, nDim);
+      const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
+      const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
 
-      for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
-        /*--- In 2D all the faces have only one edge ---*/
-        unsigned short nEdgesFace = 1;
+      /*--- We define a direction (from the smalest index to the greatest) --*/
+      const bool change_face_orientation = (face_iPoint > face_jPoint);
+      const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+      const bool addNormal = allEdges || updateEdge[iEdge];
 
-        /*--- In 3D the number of edges per face is the same as the number of point
-         per face and the median CG of the face is needed. ---*/
-        su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
-        if (nDim == 3) {
-          nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+      su2double Coord_Edge_CG[MAXNDIM] = {0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
+      }
 
-          for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
-            auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
-            for (unsigned short iDim = 0; iDim < nDim; iDim++)
-              Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim] / nEdgesFace;
-          }
+      su2double Volume_i, Volume_j;
+
+      if (nDim == 2) {
+        /*--- Two dimensional problem ---*/
+        if (addNormal) {
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
         }
 
-        /*-- Loop over the edges of a face ---*/
-        for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
-          const auto face_iNode = elem[iElem]->GetFaces(iFace, iEdgesFace);
-          unsigned short face_jNode;
+        Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
+        Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
+      } else {
+        /*--- Three dimensional problem ---*/
+        if (addNormal) {
+          if (change_face_orientation)
+            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+          else
+            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+        }
 
-          if (nDim == 2) {
-            /*--- In 2D only one edge (two points) per edge ---*/
-            face_jNode = elem[iElem]->GetFaces(iFace, 1);
-          } else {
-            /*--- In 3D we "circle around" the face ---*/
-            face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace + 1) % nEdgesFace);
-          }
+        Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+        Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+      }
 
-          const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
-          const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
+      if (allPoints || updatePoint[face_iPoint]) nodes->AddVolume(face_iPoint, Volume_i);
+      if (allPoints || updatePoint[face_jPoint]) nodes->AddVolume(face_jPoint, Volume_j);
 
-          /*--- We define a direction (from the smalest index to the greatest) --*/
-          const bool change_face_orientation = (face_iPoint > face_jPoint);
-          const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+      ElemVolume += Volume_i + Volume_j;
+    }
+  }
 
-          su2double Coord_Edge_CG[MAXNDIM] = {0.0};
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
-          }
+#ifdef CODI_REVERSE_TYPE
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+    auto iPoint = elem[iElem]->GetNode(iNode);
+    AD::SetPreaccOut(nodes->Volume(iPoint));
+    for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
+      auto jPoint = elem[iElem]->GetNode(jNode);
+      auto iEdge = FindEdge(iPoint, jPoint, false);
+      if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
+    }
+  }
+#endif
+  AD::EndPreacc();
 
-          su2double Volume_i, Volume_j;
+  return ElemVolume;
+}
 
-          if (nDim == 2) {
-            /*--- Two dimensional problem ---*/
-            if (change_face_orientation)
-              edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
-            else
-              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+bool CPhysicalGeometry::SetControlVolume_Incremental(CConfig* config) {
+  /*--- Points that moved since the last update, if there are too many a full update is cheaper. ---*/
 
-            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
-            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
-          } else {
-            /*--- Three dimensional problem ---*/
-            if (change_face_orientation)
-              edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-            else
-              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+  vector<bool> movedPoint(nPoint, false);
+  unsigned long nPointMoved = 0;
 
-            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-          }
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      if (nodes->GetCoord(iPoint, iDim) != CoordDualGrid(iPoint, iDim)) movedPoint[iPoint] = true;
+    nPointMoved += movedPoint[iPoint];
+  }
+  if (nPointMoved > config->GetIncremental_DualGrid_Threshold() * nPoint) return false;
 
-          nodes->AddVolume(face_iPoint, Volume_i);
-          nodes->AddVolume(face_jPoint, Volume_j);
+  /*--- The edges and points of the elements around moved points are affected. Their normals and volumes
+   *    are recomputed from all the elements around the affected points, but only the affected quantities
+   *    are updated, such that the contributions of unchanged elements to other points are not repeated. ---*/
 
-          my_DomainVolume += Volume_i + Volume_j;
-        }
-      }
+  vector<bool> updatePoint(nPoint, false), updateEdge(nEdge, false), updateElem(nElem, false);
 
-#ifdef CODI_REVERSE_TYPE
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (!movedPoint[iPoint]) continue;
+    for (auto iElem : nodes->GetElems(iPoint)) {
+      const auto nNodes = elem[iElem]->GetnNodes();
       for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-        auto iPoint = elem[iElem]->GetNode(iNode);
-        AD::SetPreaccOut(nodes->Volume(iPoint));
+        const auto jPoint = elem[iElem]->GetNode(iNode);
+        updatePoint[jPoint] = true;
         for (unsigned short jNode = iNode + 1; jNode < nNodes; jNode++) {
-          auto jPoint = elem[iElem]->GetNode(jNode);
-          auto iEdge = FindEdge(iPoint, jPoint, false);
-          if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
+          const auto iEdge = FindEdge(jPoint, elem[iElem]->GetNode(jNode), false);
+          if (iEdge >= 0) updateEdge[iEdge] = true;
         }
       }
-#endif
-      AD::EndPreacc();
     }
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (!updatePoint[iPoint]) continue;
+    nodes->SetVolume(iPoint, 0.0);
+    for (auto iElem : nodes->GetElems(iPoint)) updateElem[iElem] = true;
+  }
+
+  su2double ZeroArea[MAXNDIM] = {0.0};
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++)
+    if (updateEdge[iEdge]) edges->SetNormal(iEdge, ZeroArea);
+
+  for (auto iElem = 0ul; iElem < nElem; iElem++)
+    if (updateElem[iElem]) AddElemControlVolume(iElem, updatePoint, updateEdge);
+
+  /*--- Check if there is a normal with null area ---*/
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    if (!updateEdge[iEdge]) continue;
+    const auto Area2 = GeometryToolbox::SquaredNorm(nDim, edges->GetNormal(iEdge));
+    su2double DefaultArea[MAXNDIM] = {EPS * EPS};
+    if (Area2 == 0.0) edges->SetNormal(iEdge, DefaultArea);
+  }
+
+  ClearLeastSquaresWeights();
+
+  /*--- The volumes of all points add up to the volume of all elements. ---*/
+  su2double my_DomainVolume = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) my_DomainVolume += nodes->GetVolume(iPoint);
+
+  su2double DomainVolume;
+  SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  config->SetDomainVolume(DomainVolume);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    if (!movedPoint[iPoint]) continue;
+    for (auto iDim = 0u; iDim < nDim; iDim++) CoordDualGrid(iPoint, iDim) = nodes->GetCoord(iPoint, iDim);
+  }
+  return true;
+}
+
+void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action) {
+  /*--- Try to update only the dual grid around the points that moved since the last update. ---*/
+  if (action != ALLOCATE && config->GetIncremental_DualGrid() && CoordDualGrid.rows() == nPoint) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(incrementalUpdate = SetControlVolume_Incremental(config);)
+    if (incrementalUpdate) return;
+  }
+
+  /*--- Update values of faces of the edge ---*/
+  if (action != ALLOCATE) {
+    su2double ZeroArea[MAXNDIM] = {0.0};
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) edges->SetNormal(iEdge, ZeroArea);
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nodes->SetVolume(iPoint, 0.0);
+    END_SU2_OMP_FOR
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    ClearLeastSquaresWeights();
+#ifndef CODI_REVERSE_TYPE
+    GetElementColoring();
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- The elements of one color have no points (hence no edges) in common, their contributions are added in
+   *    parallel and the result does not depend on the number of threads. The preaccumulation of the contributions
+   *    (reverse AD) requires the sequential loop. ---*/
+
+  const vector<bool> all;
+#ifndef CODI_REVERSE_TYPE
+  const auto& coloring = elemColoring;
+
+  for (auto iColor = 0ul; !coloring.empty() && iColor < coloring.getOuterSize(); ++iColor) {
+    const auto* colorElems = coloring.innerIdx(iColor);
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, elemColorGroupSize))
+    for (auto k = 0ul; k < coloring.getNumNonZeros(iColor); ++k) AddElemControlVolume(colorElems[k], all, all);
+    END_SU2_OMP_FOR
+  }
+#else
+  SU2_OMP_SAFE_GLOBAL_ACCESS(for (auto iElem = 0ul; iElem < nElem; iElem++) AddElemControlVolume(iElem, all, all);)
+#endif
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    /*--- The volumes of all points add up to the volume of all elements. ---*/
+    su2double my_DomainVolume = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) my_DomainVolume += nodes->GetVolume(iPoint);
 
     su2double DomainVolume;
     SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
@@ -7188,6 +7406,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig* config, unsigned short action)
       if (nDim == 2) cout << "Area of the computational grid: " << DomainVolume << "." << endl;
       if (nDim == 3) cout << "Volume of the computational grid: " << DomainVolume << "." << endl;
     }
+
+    /*--- Reference coordinates for the next incremental update. ---*/
+    if (config->GetIncremental_DualGrid()) CoordDualGrid = nodes->GetCoord();
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
@@ -7779,21 +8000,62 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
   }
 
+  /*--- Scale the work estimate by the measured relative cost of each point, if available. ---*/
+
+  if (config->GetParMETIS_PointCost()) {
+    vector<float> cost(nPoint);
+    const int ok = ReadPointCost(config, Global_nPointDomain, pointPartitioner.GetFirstIndexOnRank(rank), cost);
+    int allOk = 0;
+    SU2_MPI::Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, comm);
+    if (allOk) {
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+        vwgt[iPoint] = max<idx_t>(1, lround(vwgt[iPoint] * cost[iPoint]));
+      }
+      if (rank == MASTER_NODE) {
+        cout << "Weighting the points by their cost from " << config->GetPointCost_FileName() << "." << endl;
+      }
+    } else if (rank == MASTER_NODE) {
+      cout << "WARNING: The point cost file " << config->GetPointCost_FileName()
+           << " is missing or does not match the grid, the points are not weighted by cost." << endl;
+    }
+  }
+
+  /*--- Reuse the partitioning of a previous run of this grid if possible. ---*/
+
+  string cacheFileName;
+  if (config->GetPartition_Cache()) {
+    cacheFileName = GetPartitionCacheFileName(config, vwgt);
+    if (ReadPartitionCache(cacheFileName)) {
+      if (rank == MASTER_NODE) cout << "Loaded graph partitioning from " << cacheFileName << "." << endl;
+      decltype(xadj)().swap(xadj);
+      decltype(adjacency)().swap(adjacency);
+      return;
+    }
+  }
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
   vector<idx_t> part(nPoint);
 
+  const auto startTime = SU2_MPI::Wtime();
+
+  bool partitioned = false;
+  if (config->GetParMETIS_Hierarchical()) partitioned = PartitionHierarchical(config, vtxdist, vwgt, part);
+
   /*--- Calling ParMETIS ---*/
 
-  if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-  auto err =
-      ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag, &numflag,
-                           &ncon, &nparts, tpwgts.data(), &ubvec, options, &edgecut, part.data(), &comm);
-  if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
-  if (rank == MASTER_NODE) {
-    cout << " graph partitioning complete (" << edgecut << " edge cuts)." << endl;
+  if (!partitioned) {
+    if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
+    auto err =
+        ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag, &numflag,
+                             &ncon, &nparts, tpwgts.data(), &ubvec, options, &edgecut, part.data(), &comm);
+    if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
+    if (rank == MASTER_NODE) {
+      cout << " graph partitioning complete (" << edgecut << " edge cuts)." << endl;
+    }
   }
+  PrintStageTime("Graph partitioning", startTime);
 
   /*--- Store the results of the partitioning (note that this is local
    since each processor is calling ParMETIS in parallel and storing the
@@ -7803,6 +8065,8 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     nodes->SetColor(iPoint, part[iPoint]);
   }
 
+  if (config->GetPartition_Cache()) WritePartitionCache(cacheFileName);
+
   /*--- Force free the connectivity. ---*/
 
   decltype(xadj)().swap(xadj);
@@ -7811,6 +8075,309 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 #endif
 }
 
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+namespace {
+/*--- Header of the partition cache files, followed by one int per global point (its rank). ---*/
+struct PartitionCacheHeader {
+  uint64_t magic, nPointGlobal, nRank;
+};
+constexpr uint64_t PartitionCacheMagic = 0x5355325041525431;  // "SU2PART1"
+
+/*--- Global ranks of each compute node (shared memory domain), ordered by their first rank. ---*/
+vector<vector<int>> GetRanksPerNode() {
+  const auto comm = SU2_MPI::GetComm();
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Each rank learns the global rank of the first rank of its node. ---*/
+
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  int leader = rank;
+  SU2_MPI::Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+  MPI_Comm_free(&nodeComm);
+
+  vector<int> leaderOfRank(size);
+  SU2_MPI::Allgather(&leader, 1, MPI_INT, leaderOfRank.data(), 1, MPI_INT, comm);
+
+  vector<vector<int>> ranksPerNode;
+  vector<int> nodeOfLeader(size, -1);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    auto& iNode = nodeOfLeader[leaderOfRank[iRank]];
+    if (iNode < 0) {
+      iNode = ranksPerNode.size();
+      ranksPerNode.emplace_back();
+    }
+    ranksPerNode[iNode].push_back(iRank);
+  }
+  return ranksPerNode;
+}
+
+/*--- 64-bit FNV-1a hash. ---*/
+uint64_t HashBytes(const void* data, size_t nBytes, uint64_t hash = 14695981039346656037ull) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < nBytes; ++i) hash = (hash ^ bytes[i]) * 1099511628211ull;
+  return hash;
+}
+}  // namespace
+
+string CPhysicalGeometry::GetPartitionCacheFileName(const CConfig* config, const vector<idx_t>& vwgt) const {
+  /*--- The partitioning is a function of the graph given to ParMETIS (the grid
+   and its linear distribution) and of the options, which define the key.
+   Each rank hashes its part of the graph and the master combines them. ---*/
+
+  unsigned long localHash = HashBytes(xadj.data(), xadj.size() * sizeof(idx_t));
+  localHash = HashBytes(adjacency.data(), adjacency.size() * sizeof(idx_t), localHash);
+  localHash = HashBytes(vwgt.data(), vwgt.size() * sizeof(idx_t), localHash);
+
+  vector<unsigned long> rankHash(size);
+  SU2_MPI::Allgather(&localHash, 1, MPI_UNSIGNED_LONG, rankHash.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  const passivedouble tolerance = config->GetParMETIS_Tolerance();
+  const long weights[] = {config->GetParMETIS_PointWeight(), config->GetParMETIS_EdgeWeight()};
+
+  uint64_t key = HashBytes(rankHash.data(), rankHash.size() * sizeof(unsigned long));
+  key = HashBytes(&Global_nPointDomain, sizeof(Global_nPointDomain), key);
+  key = HashBytes(&tolerance, sizeof(tolerance), key);
+  key = HashBytes(weights, sizeof(weights), key);
+
+  /*--- The hierarchical partitioning also depends on how the ranks are grouped by node. ---*/
+
+  if (config->GetParMETIS_Hierarchical()) {
+    for (const auto& ranks : GetRanksPerNode()) {
+      key = HashBytes(ranks.data(), ranks.size() * sizeof(int), key);
+      key = HashBytes("/", 1, key);
+    }
+  }
+
+  std::stringstream name;
+  name << config->GetPartition_Cache_FileName() << "_" << size << "_" << std::hex << key << ".dat";
+  return name.str();
+}
+
+bool CPhysicalGeometry::ReadPartitionCache(const string& filename) {
+  MPI_File fh;
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, filename.c_str(), MAX_STRING_SIZE - 1);
+  fname[MAX_STRING_SIZE - 1] = '\0';
+
+  /*--- A missing file is not an error, the partitioning is computed instead. ---*/
+
+  if (MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) != MPI_SUCCESS) return false;
+
+  PartitionCacheHeader header{};
+  MPI_File_read_at_all(fh, 0, &header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+
+  const bool match = (header.magic == PartitionCacheMagic) && (header.nPointGlobal == Global_nPointDomain) &&
+                     (header.nRank == static_cast<uint64_t>(size));
+
+  /*--- Each rank reads the colors of its linear partition of the points. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  vector<int> part(match ? nPoint : 0);
+  const MPI_Offset offset = sizeof(header) + pointPartitioner.GetFirstIndexOnRank(rank) * sizeof(int);
+
+  int ok = match;
+  if (match) {
+    MPI_Status status;
+    int count = 0;
+    ok = MPI_File_read_at_all(fh, offset, part.data(), nPoint, MPI_INT, &status) == MPI_SUCCESS;
+    MPI_Get_count(&status, MPI_INT, &count);
+    ok = ok && (static_cast<unsigned long>(count) == nPoint);
+    for (auto color : part) ok = ok && (color >= 0) && (color < size);
+  }
+  MPI_File_close(&fh);
+
+  /*--- Only use the cache if it is valid on all ranks. ---*/
+
+  int allOk = 0;
+  SU2_MPI::Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allOk) {
+    if (rank == MASTER_NODE) cout << "WARNING: Ignoring invalid partition cache file " << filename << "." << endl;
+    return false;
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    nodes->SetColor(iPoint, part[iPoint]);
+  }
+  return true;
+}
+
+void CPhysicalGeometry::WritePartitionCache(const string& filename) const {
+  MPI_File fh;
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, filename.c_str(), MAX_STRING_SIZE - 1);
+  fname[MAX_STRING_SIZE - 1] = '\0';
+
+  if (MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh) !=
+      MPI_SUCCESS) {
+    if (rank == MASTER_NODE) cout << "WARNING: Could not write the partition cache file " << filename << "." << endl;
+    return;
+  }
+
+  MPI_File_set_size(fh, 0);
+
+  const PartitionCacheHeader header{PartitionCacheMagic, Global_nPointDomain, static_cast<uint64_t>(size)};
+  if (rank == MASTER_NODE) MPI_File_write_at(fh, 0, &header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  vector<int> part(nPoint);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) part[iPoint] = nodes->GetColor(iPoint);
+
+  const MPI_Offset offset = sizeof(header) + pointPartitioner.GetFirstIndexOnRank(rank) * sizeof(int);
+  MPI_File_write_at_all(fh, offset, part.data(), nPoint, MPI_INT, MPI_STATUS_IGNORE);
+  MPI_File_close(&fh);
+
+  if (rank == MASTER_NODE) cout << "Stored graph partitioning in " << filename << "." << endl;
+}
+
+bool CPhysicalGeometry::PartitionHierarchical(const CConfig* config, vector<idx_t>& vtxdist, vector<idx_t>& vwgt,
+                                              vector<idx_t>& part) {
+  MPI_Comm comm = SU2_MPI::GetComm();
+
+  const auto ranksPerNode = GetRanksPerNode();
+  const int nNode = ranksPerNode.size();
+
+  /*--- With a single node, or with one rank per node, there is only one level. ---*/
+
+  if ((nNode == 1) || (nNode == size)) {
+    if (rank == MASTER_NODE) cout << "Hierarchical partitioning needs several nodes with several ranks each." << endl;
+    return false;
+  }
+
+  /*--- First level, partition the graph across nodes in proportion to their
+   number of ranks, this cut defines the (more expensive) inter-node halos. ---*/
+
+  idx_t wgtflag = 2;
+  idx_t numflag = 0;
+  idx_t ncon = 1;
+  real_t ubvec = 1.0 + config->GetParMETIS_Tolerance();
+  idx_t nparts = nNode;
+  idx_t options[METIS_NOPTIONS];
+  METIS_SetDefaultOptions(options);
+  options[1] = 0;
+
+  vector<real_t> tpwgts(nNode);
+  for (int iNode = 0; iNode < nNode; ++iNode) tpwgts[iNode] = real_t(ranksPerNode[iNode].size()) / size;
+
+  idx_t edgecut = 0;
+  vector<idx_t> nodePart(nPoint);
+
+  if (rank == MASTER_NODE) cout << "Calling ParMETIS for " << nNode << " nodes...";
+  auto err =
+      ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjacency.data(), vwgt.data(), nullptr, &wgtflag, &numflag,
+                           &ncon, &nparts, tpwgts.data(), &ubvec, options, &edgecut, nodePart.data(), &comm);
+  if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
+  if (rank == MASTER_NODE) cout << " node partitioning complete (" << edgecut << " inter-node edge cuts)." << endl;
+
+  /*--- Second level, the first rank of each node gathers the subgraph of its
+   node part and partitions it with METIS across the ranks of the node.
+   Each point is sent as [global index, weight, number of neighbors, neighbors]. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain, 0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<int> nPointSend(size, 0), nDataSend(size, 0);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const int dest = ranksPerNode[nodePart[iPoint]][0];
+    nPointSend[dest]++;
+    nDataSend[dest] += 3 + xadj[iPoint + 1] - xadj[iPoint];
+  }
+  vector<int> nPointRecv(size), nDataRecv(size);
+  SU2_MPI::Alltoall(nPointSend.data(), 1, MPI_INT, nPointRecv.data(), 1, MPI_INT, comm);
+  SU2_MPI::Alltoall(nDataSend.data(), 1, MPI_INT, nDataRecv.data(), 1, MPI_INT, comm);
+
+  auto displacements = [this](const vector<int>& counts) {
+    vector<int> displ(size + 1, 0);
+    for (int iRank = 0; iRank < size; ++iRank) displ[iRank + 1] = displ[iRank] + counts[iRank];
+    return displ;
+  };
+  const auto pointSendDispl = displacements(nPointSend);
+  const auto pointRecvDispl = displacements(nPointRecv);
+  const auto dataSendDispl = displacements(nDataSend);
+  const auto dataRecvDispl = displacements(nDataRecv);
+
+  vector<unsigned long> sendBuf(dataSendDispl[size]);
+  auto cursor = dataSendDispl;
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    auto& pos = cursor[ranksPerNode[nodePart[iPoint]][0]];
+    sendBuf[pos++] = firstIndex + iPoint;
+    sendBuf[pos++] = vwgt[iPoint];
+    sendBuf[pos++] = xadj[iPoint + 1] - xadj[iPoint];
+    for (auto k = xadj[iPoint]; k < xadj[iPoint + 1]; ++k) sendBuf[pos++] = adjacency[k];
+  }
+
+  vector<unsigned long> recvBuf(dataRecvDispl[size]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nDataSend.data(), dataSendDispl.data(), MPI_UNSIGNED_LONG, recvBuf.data(),
+                     nDataRecv.data(), dataRecvDispl.data(), MPI_UNSIGNED_LONG, comm);
+  decltype(sendBuf)().swap(sendBuf);
+
+  /*--- Build the subgraph, numbering the points in the order they were received.
+   Edges to points that were not received (other node parts) are dropped. ---*/
+
+  const idx_t nSubPoint = pointRecvDispl[size];
+
+  unordered_map<unsigned long, idx_t> globalToSub;
+  globalToSub.reserve(nSubPoint);
+  for (size_t pos = 0, iSub = 0; pos < recvBuf.size(); pos += 3 + recvBuf[pos + 2], ++iSub) {
+    globalToSub[recvBuf[pos]] = iSub;
+  }
+
+  vector<idx_t> subXadj(nSubPoint + 1, 0), subAdjacency, subVwgt(nSubPoint);
+  subAdjacency.reserve(recvBuf.size());
+  for (size_t pos = 0, iSub = 0; pos < recvBuf.size(); pos += 3 + recvBuf[pos + 2], ++iSub) {
+    subVwgt[iSub] = recvBuf[pos + 1];
+    for (unsigned long k = 0; k < recvBuf[pos + 2]; ++k) {
+      const auto it = globalToSub.find(recvBuf[pos + 3 + k]);
+      if (it != globalToSub.end()) subAdjacency.push_back(it->second);
+    }
+    subXadj[iSub + 1] = subAdjacency.size();
+  }
+  decltype(recvBuf)().swap(recvBuf);
+  decltype(globalToSub)().swap(globalToSub);
+
+  /*--- Only the first rank of each node receives points. The parts are mapped to the global ranks of the node. ---*/
+
+  vector<int> rankOfSub(nSubPoint, rank);
+  idx_t subEdgecut = 0;
+
+  if (nSubPoint > 0) {
+    const auto& nodeRanks =
+        *find_if(ranksPerNode.begin(), ranksPerNode.end(), [&](const vector<int>& r) { return r[0] == rank; });
+    idx_t nSubParts = nodeRanks.size();
+
+    if (nSubParts > 1) {
+      idx_t nVertex = nSubPoint;
+      idx_t metisOptions[METIS_NOPTIONS];
+      METIS_SetDefaultOptions(metisOptions);
+      metisOptions[METIS_OPTION_NUMBERING] = 0;
+
+      vector<idx_t> subPart(nSubPoint);
+      err = METIS_PartGraphKway(&nVertex, &ncon, subXadj.data(), subAdjacency.data(), subVwgt.data(), nullptr,
+                                nullptr, &nSubParts, nullptr, &ubvec, metisOptions, &subEdgecut, subPart.data());
+      if (err != METIS_OK) SU2_MPI::Error("Partitioning failed.", CURRENT_FUNCTION);
+
+      for (idx_t iSub = 0; iSub < nSubPoint; ++iSub) rankOfSub[iSub] = nodeRanks[subPart[iSub]];
+    }
+  }
+
+  unsigned long localCut = subEdgecut, totalCut = 0;
+  SU2_MPI::Reduce(&localCut, &totalCut, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, comm);
+  if (rank == MASTER_NODE) cout << "Rank partitioning complete (" << totalCut << " intra-node edge cuts)." << endl;
+
+  /*--- Return the ranks to the owners of the points, they arrive in the order the points were sent. ---*/
+
+  vector<int> rankOfPoint(nPoint);
+  SU2_MPI::Alltoallv(rankOfSub.data(), nPointRecv.data(), pointRecvDispl.data(), MPI_INT, rankOfPoint.data(),
+                     nPointSend.data(), pointSendDispl.data(), MPI_INT, comm);
+
+  cursor = pointSendDispl;
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    part[iPoint] = rankOfPoint[cursor[ranksPerNode[nodePart[iPoint]][0]]++];
+  }
+  return true;
+}
+#endif
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
    ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
@@ -8090,36 +8657,29 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
 }
 
 void CPhysicalGeometry::FindNormal_Neighbor(const CConfig* config) {
-  su2double cos_max, scalar_prod, norm_vect, norm_Normal, cos_alpha, diff_coord, *Normal;
-  unsigned long Point_Normal, jPoint;
-  unsigned short iNeigh, iMarker, iDim;
-  unsigned long iPoint, iVertex;
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE &&
         config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY &&
         config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
-        Normal = vertex[iMarker][iVertex]->GetNormal();
+      SU2_OMP_PARALLEL_(for schedule(dynamic, OMP_MIN_SIZE))
+      for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+        const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+        const su2double* Normal = vertex[iMarker][iVertex]->GetNormal();
 
         /*--- Compute closest normal neighbor, note that the normal are oriented inwards ---*/
-        Point_Normal = 0;
-        cos_max = -1.0;
-        for (iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); iNeigh++) {
-          jPoint = nodes->GetPoint(iPoint, iNeigh);
-          scalar_prod = 0.0;
-          norm_vect = 0.0;
-          norm_Normal = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) {
-            diff_coord = nodes->GetCoord(jPoint, iDim) - nodes->GetCoord(iPoint, iDim);
+        unsigned long Point_Normal = 0;
+        su2double cos_max = -1.0;
+        for (auto jPoint : nodes->GetPoints(iPoint)) {
+          su2double scalar_prod = 0.0, norm_vect = 0.0, norm_Normal = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            const su2double diff_coord = nodes->GetCoord(jPoint, iDim) - nodes->GetCoord(iPoint, iDim);
             scalar_prod += diff_coord * Normal[iDim];
             norm_vect += diff_coord * diff_coord;
             norm_Normal += Normal[iDim] * Normal[iDim];
           }
           norm_vect = sqrt(norm_vect);
           norm_Normal = sqrt(norm_Normal);
-          cos_alpha = scalar_prod / (norm_vect * norm_Normal);
+          const su2double cos_alpha = scalar_prod / (norm_vect * norm_Normal);
 
           /*--- Get maximum cosine ---*/
           if (cos_alpha >= cos_max) {
@@ -8129,6 +8689,7 @@ void CPhysicalGeometry::FindNormal_Neighbor(const CConfig* config) {
         }
         vertex[iMarker][iVertex]->SetNormal_Neighbor(Point_Normal);
       }
+      END_SU2_OMP_PARALLEL
     }
   }
 }
@@ -8346,6 +8907,12 @@ void CPhysicalGeometry::SetSensitivity(CConfig* config) {
                      CURRENT_FUNCTION);
     }
 
+    if (Restart_Vars[3] != 0) {
+      SU2_MPI::Error(string("The sensitivities cannot be read from the compressed restart file ") + string(fname) +
+                         string(".\nUse RESTART_COMPRESSION= NONE for the adjoint solution."),
+                     CURRENT_FUNCTION);
+    }
+
     /*--- Store the number of fields for simplicity. ---*/
 
     nFields = Restart_Vars[1];
@@ -8442,6 +9009,12 @@ void CPhysicalGeometry::SetSensitivity(CConfig* config) {
                      CURRENT_FUNCTION);
     }
 
+    if (Restart_Vars[3] != 0) {
+      SU2_MPI::Error(string("The sensitivities cannot be read from the compressed restart file ") + string(fname) +
+                         string(".\nUse RESTART_COMPRESSION= NONE for the adjoint solution."),
+                     CURRENT_FUNCTION);
+    }
+
     /*--- Store the number of fields for simplicity. ---*/
 
     nFields = Restart_Vars[1];
@@ -9658,11 +10231,8 @@ void CPhysicalGeometry::Compute_Wing(CConfig* config, bool original_surface, su2
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, nullptr, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
@@ -9967,11 +10537,8 @@ void CPhysicalGeometry::Compute_Fuselage(CConfig* config, bool original_surface,
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, nullptr, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute the area at each section ---*/
 
@@ -10289,11 +10856,8 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig* config, bool original_surface,
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, nullptr, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
@@ -10580,19 +11144,22 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*--------------------------------------------------------------------------*/
 
   std::unique_ptr<CADTElemClass> WallADT(
-      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, true));
+      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs,
+                        !config->GetWallDistance_Distributed()));
 
   return WallADT;
 }
 
-/*--- Use a thread-sanitizer dependent loop schedule to work around suspected false positives ---*/
-#ifndef __SANITIZE_THREAD__
-#define CPHYSGEO_PARFOR SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2 * omp_get_max_threads()))
-#else
-#define CPHYSGEO_PARFOR SU2_OMP_FOR_()
-#endif
+const su2double* CPhysicalGeometry::GetWallDistanceTargets(vector<su2double>& buffer) const {
+  if (!wallDistanceInBand) return nodes->GetCoord().data();
 
-#define END_CPHYSGEO_PARFOR END_SU2_OMP_FOR
+  buffer.resize(wallDistancePoints.size() * nDim);
+  for (unsigned long iTarget = 0; iTarget < wallDistancePoints.size(); ++iTarget) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      buffer[iTarget * nDim + iDim] = nodes->GetCoord(wallDistancePoints[iTarget], iDim);
+  }
+  return buffer.data();
+}
 
 void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) {
   /*--------------------------------------------------------------------------*/
@@ -10600,29 +11167,265 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
   /*---        distance to a solid wall element                           ---*/
   /*--------------------------------------------------------------------------*/
 
+  if (!WallADT->IsGlobal()) {
+    SetWallDistanceDistributed(WallADT, iZone);
+    return;
+  }
+
   if (!WallADT->IsEmpty()) {
     /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+     distance for all nodes (or for those within the update band). ---*/
 
-    SU2_OMP_PARALLEL {
-      CPHYSGEO_PARFOR
-      for (unsigned long iPoint = 0; iPoint < GetnPoint(); ++iPoint) {
-        unsigned short markerID;
-        unsigned long elemID;
-        int rankID;
-        su2double dist;
+    const unsigned long nTarget = wallDistanceInBand ? wallDistancePoints.size() : nPoint;
+    vector<su2double> targetCoord, dist(nTarget);
+    vector<unsigned short> markerID(nTarget);
+    vector<unsigned long> elemID(nTarget);
+    vector<int> rankID(nTarget);
 
-        WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
+    WallADT->DetermineNearestElements(nTarget, GetWallDistanceTargets(targetCoord), nDim, dist.data(),
+                                      markerID.data(), elemID.data(), rankID.data());
 
-        if (dist < nodes->GetWall_Distance(iPoint)) {
-          nodes->SetWall_Distance(iPoint, dist, rankID, iZone, markerID, elemID);
-        }
+    for (unsigned long iTarget = 0; iTarget < nTarget; ++iTarget) {
+      const auto iPoint = wallDistanceInBand ? wallDistancePoints[iTarget] : iTarget;
+      if (dist[iTarget] < nodes->GetWall_Distance(iPoint)) {
+        nodes->SetWall_Distance(iPoint, dist[iTarget], rankID[iTarget], iZone, markerID[iTarget], elemID[iTarget]);
       }
-      END_CPHYSGEO_PARFOR
     }
-    END_SU2_OMP_PARALLEL
   }
 }
 
-#undef CPHYSGEO_PARFOR
-#undef END_CPHYSGEO_PARFOR
+void CPhysicalGeometry::SetWallDistanceDistributed(CADTElemClass* WallADT, unsigned short iZone) {
+  const unsigned long nTarget = wallDistanceInBand ? wallDistancePoints.size() : nPoint;
+  auto targetPoint = [&](unsigned long iTarget) { return wallDistanceInBand ? wallDistancePoints[iTarget] : iTarget; };
+
+  /*--- Bounding boxes of the walls of all ranks (inverted for ranks without walls). ---*/
+
+  vector<passivedouble> localBox(2 * nDim), wallBoxes(2 * nDim * size);
+  WallADT->GetBoundingBox(localBox.data(), localBox.data() + nDim);
+#ifdef HAVE_MPI
+  MPI_Allgather(localBox.data(), 2 * nDim, MPI_DOUBLE, wallBoxes.data(), 2 * nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+#else
+  wallBoxes = localBox;
+#endif
+
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (wallBoxes[2 * nDim * iRank] <= wallBoxes[2 * nDim * iRank + nDim]) wallRanks.push_back(iRank);
+  }
+
+  /*--- Squared distances from a point to the nearest and farthest points of the wall box of a rank.
+   The walls of the rank are at least as far as the former and at most as far as the latter. ---*/
+
+  auto boxDistances = [&](const su2double* coord, int iRank, passivedouble& nearDist2, passivedouble& farDist2) {
+    const passivedouble* bbMin = wallBoxes.data() + 2 * nDim * iRank;
+    const passivedouble* bbMax = bbMin + nDim;
+    nearDist2 = farDist2 = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const passivedouble x = SU2_TYPE::GetValue(coord[iDim]);
+      const passivedouble outside = max({bbMin[iDim] - x, 0.0, x - bbMax[iDim]});
+      const passivedouble farthest = max(fabs(x - bbMin[iDim]), fabs(x - bbMax[iDim]));
+      nearDist2 += outside * outside;
+      farDist2 += farthest * farthest;
+    }
+  };
+
+  /*--- Nearest local wall element. ---*/
+
+  vector<su2double> dist(nTarget, numeric_limits<su2double>::max());
+  vector<unsigned short> markerID(nTarget, 0);
+  vector<unsigned long> elemID(nTarget, 0);
+  vector<int> rankID(nTarget, rank);
+
+  if (!WallADT->IsEmpty()) {
+    vector<su2double> targetCoord;
+    WallADT->DetermineNearestElements(nTarget, GetWallDistanceTargets(targetCoord), nDim, dist.data(),
+                                      markerID.data(), elemID.data(), rankID.data());
+  }
+
+  /*--- The local distance and the farthest point of each wall box give an upper bound
+   for the distance, the ranks whose wall boxes are closer than that must be queried. ---*/
+
+  vector<vector<unsigned long>> queries(size);
+  for (unsigned long iTarget = 0; iTarget < nTarget; ++iTarget) {
+    const auto coord = nodes->GetCoord(targetPoint(iTarget));
+    passivedouble nearDist2, farDist2;
+
+    const passivedouble localDist = SU2_TYPE::GetValue(dist[iTarget]);
+    passivedouble upperBound2 =
+        (localDist < numeric_limits<passivedouble>::max()) ? localDist * localDist : numeric_limits<passivedouble>::max();
+    for (const auto iRank : wallRanks) {
+      boxDistances(coord, iRank, nearDist2, farDist2);
+      upperBound2 = min(upperBound2, farDist2);
+    }
+    for (const auto iRank : wallRanks) {
+      if (iRank == rank) continue;
+      boxDistances(coord, iRank, nearDist2, farDist2);
+      if (nearDist2 <= upperBound2) queries[iRank].push_back(iTarget);
+    }
+  }
+
+  /*--- Send the coordinates of the queries to the ranks that own the walls. ---*/
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) nSend[iRank] = queries[iRank].size();
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank + 1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank + 1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  auto scaled = [&](vector<int> counts, vector<int> displ, int factor) {
+    for (auto& n : counts) n *= factor;
+    for (auto& n : displ) n *= factor;
+    return make_pair(counts, displ);
+  };
+
+  vector<su2double> sendCoord(nDim * sendDispl[size]), recvCoord(nDim * recvDispl[size]);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (unsigned long k = 0; k < queries[iRank].size(); ++k) {
+      const auto coord = nodes->GetCoord(targetPoint(queries[iRank][k]));
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) sendCoord[nDim * (sendDispl[iRank] + k) + iDim] = coord[iDim];
+    }
+  }
+  const auto sendCoordLayout = scaled(nSend, sendDispl, nDim);
+  const auto recvCoordLayout = scaled(nRecv, recvDispl, nDim);
+  SU2_MPI::Alltoallv(sendCoord.data(), sendCoordLayout.first.data(), sendCoordLayout.second.data(), MPI_DOUBLE,
+                     recvCoord.data(), recvCoordLayout.first.data(), recvCoordLayout.second.data(), MPI_DOUBLE,
+                     SU2_MPI::GetComm());
+
+  /*--- Answer the queries of the other ranks with the local walls. ---*/
+
+  const unsigned long nQuery = recvDispl[size];
+  vector<su2double> queryDist(nQuery);
+  vector<unsigned short> queryMarker(nQuery);
+  vector<unsigned long> queryLocalElem(nQuery), queryElem(2 * nQuery);
+  vector<int> queryRank(nQuery);
+
+  WallADT->DetermineNearestElements(nQuery, recvCoord.data(), nDim, queryDist.data(), queryMarker.data(),
+                                    queryLocalElem.data(), queryRank.data());
+
+  for (unsigned long iQuery = 0; iQuery < nQuery; ++iQuery) {
+    queryElem[2 * iQuery] = queryMarker[iQuery];
+    queryElem[2 * iQuery + 1] = queryLocalElem[iQuery];
+  }
+
+  /*--- Return the answers and keep the nearest wall of each point. ---*/
+
+  vector<su2double> answerDist(sendDispl[size]);
+  vector<unsigned long> answerElem(2 * sendDispl[size]);
+  SU2_MPI::Alltoallv(queryDist.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE, answerDist.data(), nSend.data(),
+                     sendDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  const auto recvElemLayout = scaled(nRecv, recvDispl, 2);
+  const auto sendElemLayout = scaled(nSend, sendDispl, 2);
+  SU2_MPI::Alltoallv(queryElem.data(), recvElemLayout.first.data(), recvElemLayout.second.data(), MPI_UNSIGNED_LONG,
+                     answerElem.data(), sendElemLayout.first.data(), sendElemLayout.second.data(),
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (unsigned long k = 0; k < queries[iRank].size(); ++k) {
+      const auto iTarget = queries[iRank][k];
+      const auto iAnswer = sendDispl[iRank] + k;
+      if (answerDist[iAnswer] < dist[iTarget]) {
+        dist[iTarget] = answerDist[iAnswer];
+        markerID[iTarget] = answerElem[2 * iAnswer];
+        elemID[iTarget] = answerElem[2 * iAnswer + 1];
+        rankID[iTarget] = iRank;
+      }
+    }
+  }
+
+  for (unsigned long iTarget = 0; iTarget < nTarget; ++iTarget) {
+    const auto iPoint = targetPoint(iTarget);
+    if (dist[iTarget] < nodes->GetWall_Distance(iPoint)) {
+      nodes->SetWall_Distance(iPoint, dist[iTarget], rankID[iTarget], iZone, markerID[iTarget], elemID[iTarget]);
+    }
+  }
+}
+
+void CPhysicalGeometry::ResetWallDistance(const CConfig* config, bool update) {
+  const passivedouble band = SU2_TYPE::GetValue(config->GetWallDistance_Band());
+
+  /*--- Largest displacement of the points since the last full computation. The distance
+   of a point changes at most by its displacement plus that of the walls. ---*/
+
+  passivedouble maxDisplacement = numeric_limits<passivedouble>::max();
+
+  if (update && (band > 0.0) && (wallDistanceRef.size() == nPoint)) {
+    passivedouble localMax = 0.0;
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      passivedouble disp2 = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        disp2 += pow(SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - wallDistanceRefCoord[iPoint * nDim + iDim], 2);
+      }
+      localMax = max(localMax, disp2);
+    }
+    maxDisplacement = sqrt(localMax);
+#ifdef HAVE_MPI
+    MPI_Allreduce(&localMax, &maxDisplacement, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    maxDisplacement = sqrt(maxDisplacement);
+#endif
+  }
+
+  /*--- Full computation if the band is not applicable or if the mesh moved too much. ---*/
+
+  if (2 * maxDisplacement >= band) {
+    SetWallDistance(numeric_limits<su2double>::max());
+    return;
+  }
+
+  wallDistanceInBand = true;
+  wallDistancePoints.clear();
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    if (wallDistanceRef[iPoint] < band + 2 * maxDisplacement) {
+      wallDistancePoints.push_back(iPoint);
+      nodes->SetWall_Distance(iPoint, numeric_limits<su2double>::max());
+    } else {
+      nodes->SetWall_Distance(iPoint, wallDistanceRef[iPoint]);
+    }
+  }
+}
+
+void CPhysicalGeometry::FinalizeWallDistance(const CConfig* config) {
+  if (config->GetWallDistance_Band() <= 0.0) {
+    decltype(wallDistanceRef)().swap(wallDistanceRef);
+    decltype(wallDistanceRefCoord)().swap(wallDistanceRefCoord);
+    return;
+  }
+  if (wallDistanceInBand) return;
+
+  /*--- Full computation, store the reference for the next updates. ---*/
+
+  wallDistanceRef.resize(nPoint);
+  wallDistanceRefCoord.resize(nPoint * nDim);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    wallDistanceRef[iPoint] = SU2_TYPE::GetValue(nodes->GetWall_Distance(iPoint));
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      wallDistanceRefCoord[iPoint * nDim + iDim] = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+    }
+  }
+}
+
+void CPhysicalGeometry::StorePeriodicWallDistance(const CConfig* config, unsigned long phase, unsigned long nPhase) {
+  const bool rough = config->GetnRoughWall() > 0;
+
+  wallDistancePeriodic.resize(nPhase);
+  auto& stored = wallDistancePeriodic[phase];
+  stored.resize(rough ? 2 * nPoint : nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    stored[iPoint] = SU2_TYPE::GetValue(nodes->GetWall_Distance(iPoint));
+    if (rough) stored[nPoint + iPoint] = SU2_TYPE::GetValue(nodes->GetRoughnessHeight(iPoint));
+  }
+}
+
+void CPhysicalGeometry::LoadPeriodicWallDistance(const CConfig* config, unsigned long phase) {
+  const auto& stored = wallDistancePeriodic[phase];
+  const bool rough = stored.size() == 2 * nPoint;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    nodes->SetWall_Distance(iPoint, stored[iPoint]);
+    if (rough) nodes->SetRoughnessHeight(iPoint, stored[nPoint + iPoint]);
+  }
+}
+
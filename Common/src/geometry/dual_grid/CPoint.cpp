@@ -134,11 +134,26 @@ void CPoint::FullAllocation(unsigned short imesh, const CConfig* config) {
   SharpEdge_Distance.resize(npoint) = su2double(0.0);
 }
 
-void CPoint::SetElems(const vector<vector<long> >& elemsMatrix) { Elem = CCompressedSparsePatternL(elemsMatrix); }
+void CPoint::CheckLocalIndexRange(unsigned long maxIndex) {
+  if (maxIndex > numeric_limits<su2localindex>::max()) {
+    SU2_MPI::Error("The point connectivity of this rank exceeds the range of 32-bit indices,\n"
+                   "use more ranks or build SU2 with -Denable-64bit-local-indices=true.", CURRENT_FUNCTION);
+  }
+}
+
+void CPoint::SetElems(CCompressedSparsePatternLocal&& elems) { Elem = std::move(elems); }
 
 void CPoint::SetPoints(const vector<vector<unsigned long> >& pointsMatrix) {
-  Point = CCompressedSparsePatternUL(pointsMatrix);
-  Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr() + Point.getOuterSize() + 1, long(-1));
+  unsigned long nNonZero = 0;
+  for (const auto& points : pointsMatrix) nNonZero += points.size();
+  CheckLocalIndexRange(max<unsigned long>(nNonZero, pointsMatrix.size()));
+
+  SetPoints(CCompressedSparsePatternLocal(pointsMatrix));
+}
+
+void CPoint::SetPoints(CCompressedSparsePatternLocal&& points) {
+  Point = std::move(points);
+  Edge = CCompressedSparsePatternLocal(Point.outerPtr(), Point.outerPtr() + Point.getOuterSize() + 1, 0);
 }
 
 void CPoint::SetVolume_n() {
@@ -39,7 +39,7 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig* val_config, unsigned short val_i
   ReadCGNSZoneMetadata();
 
   /*--- Read the point coordinates into linear partitions. ---*/
-  ReadCGNSPointCoordinates();
+  if (!parallelIO) ReadCGNSPointCoordinates();
 
   /*--- Loop over all sections to access the grid connectivity. We
    treat the interior and boundary elements with separate routines.
@@ -51,7 +51,7 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig* val_config, unsigned short val_i
   numberOfMarkers = 0;
   for (int s = 0; s < nSections; s++) {
     if (isInterior[s]) {
-      ReadCGNSVolumeSection(s);
+      if (!parallelIO || !isFixedSize[s]) ReadCGNSVolumeSection(s);
     } else {
       numberOfMarkers++;
       ReadCGNSSurfaceSection(s);
@@ -61,6 +61,22 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig* val_config, unsigned short val_i
   /*--- We have extracted all CGNS data. Close the CGNS file. ---*/
   if (cg_close(cgnsFileID)) cg_error_exit();
 
+  /*--- With parallel CGNS, the coordinates and the volume sections with a
+   single element type are read collectively, each rank reading only its
+   linear slab. This is done after closing the serial handle, since the
+   master-only reads of the markers are not collective. ---*/
+  if (parallelIO) {
+    OpenCGNSFileParallel(config->GetMesh_FileName());
+    ReadCGNSPointCoordinates();
+    for (int s = 0; s < nSections; s++) {
+      if (isInterior[s] && isFixedSize[s]) ReadCGNSVolumeSection(s);
+    }
+#ifdef HAVE_MPI
+    if (cgp_close(cgnsFileID)) cgp_error_exit();
+#endif
+    parallelRead = false;
+  }
+
   /*--- Put our CGNS data into the class data for the mesh reader. ---*/
   ReformatCGNSVolumeConnectivity();
   ReformatCGNSSurfaceConnectivity();
@@ -103,6 +119,28 @@ void CCGNSMeshReaderFVM::OpenCGNSFile(const string& val_filename) {
           << ")  is old and may cause high memory usage issues, consider updating the file with the cgnsupdate tool.\n";
     }
   }
+
+  /*--- Parallel CGNS requires HDF5 files, ADF files are read with partial serial reads. ---*/
+
+#ifdef HAVE_MPI
+  parallelIO = (size > SINGLE_NODE) && (file_type == CG_FILE_HDF5);
+#endif
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE)) {
+    if (parallelIO)
+      cout << "Using parallel CGNS (HDF5) to read the grid." << endl;
+    else
+      cout << "The CGNS file is not in HDF5 format, parallel CGNS reading is disabled." << endl;
+  }
+}
+
+void CCGNSMeshReaderFVM::OpenCGNSFileParallel(const string& val_filename) {
+#ifdef HAVE_MPI
+  if (cgp_mpi_comm(SU2_MPI::GetComm())) cgp_error_exit();
+  if (cgp_open(val_filename.c_str(), CG_MODE_READ, &cgnsFileID)) cgp_error_exit();
+  parallelRead = true;
+#else
+  SU2_MPI::Error("Parallel CGNS requires an MPI build.", CURRENT_FUNCTION);
+#endif
 }
 
 void CCGNSMeshReaderFVM::ReadCGNSDatabaseMetadata() {
@@ -266,6 +304,17 @@ void CCGNSMeshReaderFVM::ReadCGNSPointCoordinates() {
      Ask for datatype RealDouble and let CGNS library do the translation
      when RealSingle is found. ---*/
 
+#ifdef HAVE_MPI
+    if (parallelRead) {
+      /*--- Collective read of our slab, ranks without points pass a null buffer. ---*/
+      const cgsize_t mem_dim = numberOfLocalPoints, mem_min = 1, mem_max = numberOfLocalPoints;
+      void* buffer = numberOfLocalPoints > 0 ? localPointCoordinates[indC].data() : nullptr;
+      if (cgp_coord_general_read_data(cgnsFileID, cgnsBase, cgnsZone, k + 1, &range_min, &range_max, RealDouble, 1,
+                                      &mem_dim, &mem_min, &mem_max, buffer))
+        cgp_error_exit();
+      continue;
+    }
+#endif
     if (cg_coord_read(cgnsFileID, cgnsBase, cgnsZone, coordname, RealDouble, &range_min, &range_max,
                       localPointCoordinates[indC].data()))
       cg_error_exit();
@@ -289,6 +338,7 @@ void CCGNSMeshReaderFVM::ReadCGNSSectionMetadata() {
    pieces of information describing each section. ---*/
 
   isInterior.resize(nSections);
+  isFixedSize.resize(nSections);
   nElems.resize(nSections, 0);
   elemOffset.resize(nSections + 1, 0);
   elemOffset[0] = 0;
@@ -321,6 +371,7 @@ void CCGNSMeshReaderFVM::ReadCGNSSectionMetadata() {
      or entirely boundary elements. */
 
     isInterior[s] = true;
+    isFixedSize[s] = (elemType != MIXED) && (elemType != NGON_n) && (elemType != NFACE_n);
 
     if (elemType == MIXED) {
       /* For a mixed section, we check the type of the first element
@@ -422,7 +473,11 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    number of elements on this rank. ---*/
 
   cgsize_t sizeNeeded = 0, sizeOffset = 0;
-  if (nElems[val_section] > 0) {
+  if (parallelRead) {
+    /*--- Only single element type sections are read in parallel. ---*/
+    if (cg_npe(elemType, &npe)) cg_error_exit();
+    sizeNeeded = nElems[val_section] * npe;
+  } else if (nElems[val_section] > 0) {
     if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank), &sizeNeeded) != CG_OK)
@@ -443,6 +498,16 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
    partial read function in the CGNS API. Only call the CGNS API
    if we have a non-zero number of elements on this rank. ---*/
 
+#ifdef HAVE_MPI
+  if (parallelRead) {
+    /*--- Collective read of our slab, ranks without elements pass a null buffer. ---*/
+    if (cgp_elements_read_data(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
+                               (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank),
+                               (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank),
+                               nElems[val_section] > 0 ? connElemCGNS.data() : nullptr))
+      cgp_error_exit();
+  } else
+#endif
   if (nElems[val_section] > 0) {
     if (elemType == MIXED || elemType == NFACE_n || elemType == NGON_n) {
       if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section + 1,
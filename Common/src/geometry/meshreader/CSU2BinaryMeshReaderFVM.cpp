@@ -0,0 +1,294 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary mesh file into linear partitions
+ *        for the finite volume solver (FVM).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+#include <fstream>
+#include <functional>
+
+static_assert(sizeof(unsigned long) == 8 && sizeof(passivedouble) == 8,
+              "The SU2 binary mesh format requires 64-bit integers and doubles.");
+
+constexpr char CSU2BinaryMeshReaderFVM::FileMagic[];
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(
+        "The SU2 binary mesh format stores a single zone.\n"
+        "Use one mesh file per zone (MULTIZONE_MESH= NO).",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- Open the file on all ranks, every rank reads only what it needs. ---*/
+
+#ifdef HAVE_MPI
+  char fname[MAX_STRING_SIZE];
+  strncpy(fname, meshFilename.c_str(), MAX_STRING_SIZE - 1);
+  fname[MAX_STRING_SIZE - 1] = '\0';
+  if (MPI_File_open(SU2_MPI::GetComm(), fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle) != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  if (!fileHandle) {
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+#endif
+
+  /* Read and store the points, interior elements, and surface elements.
+   We store only the points and interior elements on our rank's linear
+   partition, the surface connectivity is read by all ranks. */
+
+  ReadMetadata();
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+}
+
+unsigned short CSU2BinaryMeshReaderFVM::ReadDimension(const string& val_mesh_filename) {
+  ifstream mesh_file(val_mesh_filename, ios::in | ios::binary);
+  if (mesh_file.fail()) {
+    SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."),
+                   CURRENT_FUNCTION);
+  }
+  char magic[8] = {};
+  unsigned long header[4] = {};
+  mesh_file.read(magic, 8);
+  mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+  if (mesh_file.fail() || strncmp(magic, FileMagic, 8) != 0) {
+    SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+  return static_cast<unsigned short>(header[1]);
+}
+
+void CSU2BinaryMeshReaderFVM::ReadBlock(unsigned long offset, void* buffer, unsigned long nBytes) const {
+  /*--- Large blocks are split to keep the MPI counts within the range of int. ---*/
+
+  constexpr unsigned long maxChunk = 1ul << 30;
+  auto* dest = static_cast<char*>(buffer);
+  bool ok = true;
+
+  while (nBytes > 0 && ok) {
+    const auto chunk = min(nBytes, maxChunk);
+#ifdef HAVE_MPI
+    MPI_Status status;
+    int count = 0;
+    ok = MPI_File_read_at(fileHandle, offset, dest, static_cast<int>(chunk), MPI_BYTE, &status) == MPI_SUCCESS;
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    ok = ok && (static_cast<unsigned long>(count) == chunk);
+#else
+    ok = (fseek(fileHandle, offset, SEEK_SET) == 0) && (fread(dest, 1, chunk, fileHandle) == chunk);
+#endif
+    offset += chunk;
+    dest += chunk;
+    nBytes -= chunk;
+  }
+
+  if (!ok) {
+    SU2_MPI::Error(string("Unexpected end of SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  char magic[8] = {};
+  unsigned long header[4] = {};
+  ReadBlock(0, magic, 8);
+  ReadBlock(8, header, sizeof(header));
+
+  if (strncmp(magic, FileMagic, 8) != 0) {
+    SU2_MPI::Error(meshFilename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+  if (header[0] != FileVersion) {
+    SU2_MPI::Error(string("Unsupported SU2 binary mesh file version ") + to_string(header[0]) + string(" in ") +
+                       meshFilename,
+                   CURRENT_FUNCTION);
+  }
+  dimension = header[1];
+  numberOfGlobalElements = header[2];
+  numberOfGlobalPoints = header[3];
+
+  if (dimension != 2 && dimension != 3) {
+    SU2_MPI::Error(meshFilename + string(" has an invalid dimension."), CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /*--- The points are stored in global index order, the linear partition
+   of this rank is therefore a single contiguous block of the file. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const auto firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  const unsigned long pointOffset = HeaderSize + numberOfGlobalElements * ElemRecordSize * sizeof(unsigned long);
+
+  vector<passivedouble> coords(numberOfLocalPoints * dimension);
+  ReadBlock(pointOffset + firstPoint * dimension * sizeof(passivedouble), coords.data(),
+            coords.size() * sizeof(passivedouble));
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+      localPointCoordinates[iDim][iPoint] = coords[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /*--- Each rank reads a linear partition of the elements, which are then
+   sent to every rank that owns at least one of their points, since the
+   points control the overall partitioning (an element may end up on
+   multiple ranks). ---*/
+
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements, 0);
+  const auto nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const auto firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<unsigned long> records(nElemRead * ElemRecordSize);
+  ReadBlock(HeaderSize + firstElem * ElemRecordSize * sizeof(unsigned long), records.data(),
+            records.size() * sizeof(unsigned long));
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  /*--- Determine the destination ranks of each element, first counting,
+   then filling the send buffer in the format [globalID vtkType n0 ... n7]. ---*/
+
+  vector<int> nSend(size, 0), nRecv(size, 0), sendDisp(size + 1, 0), recvDisp(size + 1, 0);
+  vector<int> elemFlag(size, -1);
+
+  auto forEachDestination = [&](unsigned long iElem, const std::function<void(int)>& func) {
+    const auto* rec = &records[iElem * ElemRecordSize];
+    const auto nPointsElem = nPointsOfElementType(rec[0]);
+    for (unsigned short iNode = 0; iNode < nPointsElem; iNode++) {
+      if (rec[1 + iNode] >= numberOfGlobalPoints) {
+        SU2_MPI::Error(meshFilename + string(" contains an element with an invalid point index."), CURRENT_FUNCTION);
+      }
+      const int iRank = pointPartitioner.GetRankContainingIndex(rec[1 + iNode]);
+      if (elemFlag[iRank] != static_cast<int>(iElem)) {
+        elemFlag[iRank] = iElem;
+        func(iRank);
+      }
+    }
+  };
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const auto vtkType = records[iElem * ElemRecordSize];
+    if (vtkType != TRIANGLE && vtkType != QUADRILATERAL && vtkType != TETRAHEDRON && vtkType != HEXAHEDRON &&
+        vtkType != PRISM && vtkType != PYRAMID) {
+      SU2_MPI::Error(meshFilename + string(" contains an invalid volume element type."), CURRENT_FUNCTION);
+    }
+    forEachDestination(iElem, [&](int iRank) { nSend[iRank] += SU2_CONN_SIZE; });
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDisp[iRank + 1] = sendDisp[iRank] + nSend[iRank];
+    recvDisp[iRank + 1] = recvDisp[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> connSend(sendDisp[size]);
+  vector<int> index(sendDisp.begin(), sendDisp.end() - 1);
+  fill(elemFlag.begin(), elemFlag.end(), -1);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    forEachDestination(iElem, [&](int iRank) {
+      auto* conn = &connSend[index[iRank]];
+      conn[0] = firstElem + iElem;
+      for (unsigned long i = 0; i < ElemRecordSize; i++) conn[1 + i] = records[iElem * ElemRecordSize + i];
+      index[iRank] += SU2_CONN_SIZE;
+    });
+  }
+  vector<unsigned long>().swap(records);
+
+  localVolumeElementConnectivity.resize(recvDisp[size]);
+  SU2_MPI::Alltoallv(connSend.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  numberOfLocalElements = localVolumeElementConnectivity.size() / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  /*--- The markers are small compared to the volume, they are read by all ranks. ---*/
+
+  unsigned long offset = HeaderSize + numberOfGlobalElements * ElemRecordSize * sizeof(unsigned long) +
+                         numberOfGlobalPoints * dimension * sizeof(passivedouble);
+
+  ReadBlock(offset, &numberOfMarkers, sizeof(unsigned long));
+  offset += sizeof(unsigned long);
+
+  markerNames.resize(numberOfMarkers);
+  surfaceElementConnectivity.resize(numberOfMarkers);
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+    unsigned long tagLength = 0;
+    ReadBlock(offset, &tagLength, sizeof(unsigned long));
+    offset += sizeof(unsigned long);
+
+    if (tagLength > MAX_STRING_SIZE) {
+      SU2_MPI::Error(meshFilename + string(" contains an invalid marker tag."), CURRENT_FUNCTION);
+    }
+    markerNames[iMarker].resize(tagLength);
+    ReadBlock(offset, &markerNames[iMarker][0], tagLength);
+    offset += tagLength;
+
+    unsigned long nElemBound = 0;
+    ReadBlock(offset, &nElemBound, sizeof(unsigned long));
+    offset += sizeof(unsigned long);
+
+    vector<unsigned long> records(nElemBound * BoundRecordSize);
+    ReadBlock(offset, records.data(), records.size() * sizeof(unsigned long));
+    offset += records.size() * sizeof(unsigned long);
+
+    auto& conn = surfaceElementConnectivity[iMarker];
+    conn.resize(nElemBound * SU2_CONN_SIZE, 0);
+
+    for (unsigned long iElem = 0; iElem < nElemBound; iElem++) {
+      const auto* rec = &records[iElem * BoundRecordSize];
+      if (dimension == 3 && rec[0] == LINE) {
+        SU2_MPI::Error(
+            "Line boundary conditions are not possible for 3D calculations.\n"
+            "Please check the SU2 binary mesh file.",
+            CURRENT_FUNCTION);
+      }
+      conn[iElem * SU2_CONN_SIZE + 1] = rec[0];
+      for (unsigned long i = 1; i < BoundRecordSize; i++) conn[iElem * SU2_CONN_SIZE + 1 + i] = rec[i];
+    }
+  }
+}
@@ -107,6 +107,48 @@ su2double CBSplineBlending::GetBasis(short val_i, su2double val_t) {
   return N[0][Order - 1];
 }
 
+void CBSplineBlending::GetAllBasis(su2double val_t, su2double* val_basis, su2double* val_deriv) const {
+  /*--- Algorithm A2.2 from "The NURBS Book", the left and right differences are computed on the fly
+   * to avoid temporary storage. Find the knot span first, clamped to the first and last span. ---*/
+
+  const short p = Degree;
+  short span = p;
+  while (span < nControl - 1 && val_t >= U[span + 1]) ++span;
+
+  for (unsigned short i = 0; i < nControl; ++i) {
+    val_basis[i] = 0.0;
+    val_deriv[i] = 0.0;
+  }
+  su2double* N = &val_basis[span - p];
+  auto left = [&](short j) { return val_t - U[span + 1 - j]; };
+  auto right = [&](short j) { return U[span + j] - val_t; };
+
+  N[0] = 1.0;
+  for (short j = 1; j <= p; ++j) {
+    /*--- Before the last step keep the basis of degree p-1 (N_{span-p+1..span}) for the derivative. ---*/
+    if (j == p) {
+      for (short r = 0; r < p; ++r) val_deriv[span - p + 1 + r] = N[r];
+    }
+    su2double saved = 0.0;
+    for (short r = 0; r < j; ++r) {
+      const su2double temp = N[r] / (right(r + 1) + left(j - r));
+      N[r] = saved + right(r + 1) * temp;
+      saved = left(j - r) * temp;
+    }
+    N[j] = saved;
+  }
+
+  /*--- N'_{i,p} = p/(U_{i+p}-U_i) N_{i,p-1} - p/(U_{i+p+1}-U_{i+1}) N_{i+1,p-1}, in place. ---*/
+
+  if (p == 0) return;
+  for (short i = span - p; i <= span; ++i) {
+    const su2double dl = U[i + p] - U[i], dr = U[i + p + 1] - U[i + 1];
+    const su2double Nl = (i > span - p) ? val_deriv[i] : 0.0;
+    const su2double Nr = (i < span) ? val_deriv[i + 1] : 0.0;
+    val_deriv[i] = ((dl > 0) ? p / dl * Nl : 0.0) - ((dr > 0) ? p / dr * Nr : 0.0);
+  }
+}
+
 su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short val_order_der) {
   if ((val_t < U[val_i]) || (val_t >= U[val_i + Order])) {
     return 0.0;
@@ -36,6 +36,14 @@ void CBezierBlending::SetOrder(short val_order, short n_controlpoints) {
   Order = val_order;
   Degree = Order - 1;
   binomial.resize(Order + 1, 0.0);
+
+  /*--- Precompute the coefficients used by GetAllBasis. ---*/
+  binomialDeg.resize(Order);
+  binomialDegM1.resize(Order);
+  for (short i = 0; i < Order; ++i) {
+    binomialDeg[i] = Binomial(Degree, i);
+    binomialDegM1[i] = (i < Degree) ? Binomial(Degree - 1, i) : 0.0;
+  }
 }
 
 su2double CBezierBlending::GetBasis(short val_i, su2double val_t) { return GetBernstein(Degree, val_i, val_t); }
@@ -74,6 +82,26 @@ su2double CBezierBlending::GetDerivative(short val_i, su2double val_t, short val
   return GetBernsteinDerivative(Degree, val_i, val_t, val_order_der);
 }
 
+void CBezierBlending::GetAllBasis(su2double val_t, su2double* val_basis, su2double* val_deriv) const {
+  const short n = Degree;
+
+  /*--- Use the outputs to store t^i and (1-t)^(n-i), the polynomials of degree n-1 are used
+   * for the derivative, B'_i = n (B^{n-1}_{i-1} - B^{n-1}_i). ---*/
+
+  val_basis[0] = 1.0;
+  for (short i = 1; i <= n; ++i) val_basis[i] = val_basis[i - 1] * val_t;
+  val_deriv[n] = 1.0;
+  for (short i = n - 1; i >= 0; --i) val_deriv[i] = val_deriv[i + 1] * (1.0 - val_t);
+
+  su2double prevDegM1 = 0.0;
+  for (short i = 0; i <= n; ++i) {
+    const su2double degM1 = (i < n) ? binomialDegM1[i] * val_basis[i] * val_deriv[i + 1] : 0.0;
+    val_basis[i] *= binomialDeg[i] * val_deriv[i];
+    val_deriv[i] = n * (prevDegM1 - degM1);
+    prevDegM1 = degM1;
+  }
+}
+
 su2double CBezierBlending::GetBernsteinDerivative(short val_n, short val_i, su2double val_t, short val_order_der) {
   su2double value = 0.0;
 
@@ -829,6 +829,139 @@ su2double* CFreeFormDefBox::EvalCartesianCoord(su2double* ParamCoord) const {
   return cart_coord;
 }
 
+void CFreeFormDefBox::SetFlatControlPoints() {
+  FlatControlPoints.resize(3ul * lOrder * mOrder * nOrder);
+  auto* P = FlatControlPoints.data();
+  for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++)
+    for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++)
+      for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++) *(P++) = Coord_Control_Points[iOrder][jOrder][kOrder][iDim];
+}
+
+void CFreeFormDefBox::EvalCartesianCoord(const su2double* uvw, su2double* xyz, su2double (*jac)[3],
+                                         su2double* work) const {
+  su2double* Bu = work;
+  su2double* dBu = Bu + lOrder;
+  su2double* Bv = dBu + lOrder;
+  su2double* dBv = Bv + mOrder;
+  su2double* Bw = dBv + mOrder;
+  su2double* dBw = Bw + nOrder;
+
+  BlendingFunction[0]->GetAllBasis(uvw[0], Bu, dBu);
+  BlendingFunction[1]->GetAllBasis(uvw[1], Bv, dBv);
+  BlendingFunction[2]->GetAllBasis(uvw[2], Bw, dBw);
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    xyz[iDim] = 0.0;
+    if (jac) jac[iDim][0] = jac[iDim][1] = jac[iDim][2] = 0.0;
+  }
+
+  /*--- Contract the innermost direction first (contiguous control points), then the other two. ---*/
+
+  for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++) {
+    for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++) {
+      const su2double* P = &FlatControlPoints[3ul * (iOrder * mOrder + jOrder) * nOrder];
+      su2double S[3] = {0.0, 0.0, 0.0}, dS[3] = {0.0, 0.0, 0.0};
+      for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++) {
+        for (unsigned short iDim = 0; iDim < 3; iDim++) {
+          S[iDim] += Bw[kOrder] * P[3 * kOrder + iDim];
+          dS[iDim] += dBw[kOrder] * P[3 * kOrder + iDim];
+        }
+      }
+      const su2double BuBv = Bu[iOrder] * Bv[jOrder];
+      for (unsigned short iDim = 0; iDim < 3; iDim++) xyz[iDim] += BuBv * S[iDim];
+      if (!jac) continue;
+      for (unsigned short iDim = 0; iDim < 3; iDim++) {
+        jac[iDim][0] += dBu[iOrder] * Bv[jOrder] * S[iDim];
+        jac[iDim][1] += Bu[iOrder] * dBv[jOrder] * S[iDim];
+        jac[iDim][2] += BuBv * dS[iDim];
+      }
+    }
+  }
+}
+
+void CFreeFormDefBox::AddControlPointSensitivity(const su2double* uvw, const su2double* sens, su2double* cpSens,
+                                                 su2double* work) const {
+  su2double* Bu = work;
+  su2double* Bv = Bu + lOrder;
+  su2double* Bw = Bv + mOrder;
+  su2double* dB = Bw + nOrder;
+
+  BlendingFunction[0]->GetAllBasis(uvw[0], Bu, dB);
+  BlendingFunction[1]->GetAllBasis(uvw[1], Bv, dB);
+  BlendingFunction[2]->GetAllBasis(uvw[2], Bw, dB);
+
+  for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++) {
+    for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++) {
+      su2double* S = &cpSens[3ul * (iOrder * mOrder + jOrder) * nOrder];
+      const su2double BuBv = Bu[iOrder] * Bv[jOrder];
+      for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++) {
+        const su2double B = BuBv * Bw[kOrder];
+        for (unsigned short iDim = 0; iDim < 3; iDim++) S[3 * kOrder + iDim] += B * sens[iDim];
+      }
+    }
+  }
+}
+
+su2double CFreeFormDefBox::GetControlPointDisplacementDot(const su2double* cpSens) const {
+  su2double dot = 0.0;
+  for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++)
+    for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++)
+      for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          dot += (Coord_Control_Points[iOrder][jOrder][kOrder][iDim] -
+                  Coord_Control_Points_Copy[iOrder][jOrder][kOrder][iDim]) * *(cpSens++);
+  return dot;
+}
+
+bool CFreeFormDefBox::GetParametricCoord_Newton(const su2double* xyz, su2double* uvw, su2double tol,
+                                                unsigned long it_max, su2double* work) const {
+  su2double X[3], J[3][3], F[3], NormF = 0.0;
+
+  EvalCartesianCoord(uvw, X, J, work);
+  for (unsigned short iDim = 0; iDim < 3; iDim++) F[iDim] = X[iDim] - xyz[iDim];
+  NormF = GeometryToolbox::Norm(3, F);
+
+  for (unsigned long iter = 0; iter < it_max; iter++) {
+    /*--- Solve J du = -F with the adjugate of J. ---*/
+
+    const su2double Adj[3][3] = {{J[1][1] * J[2][2] - J[1][2] * J[2][1], J[0][2] * J[2][1] - J[0][1] * J[2][2],
+                                  J[0][1] * J[1][2] - J[0][2] * J[1][1]},
+                                 {J[1][2] * J[2][0] - J[1][0] * J[2][2], J[0][0] * J[2][2] - J[0][2] * J[2][0],
+                                  J[0][2] * J[1][0] - J[0][0] * J[1][2]},
+                                 {J[1][0] * J[2][1] - J[1][1] * J[2][0], J[0][1] * J[2][0] - J[0][0] * J[2][1],
+                                  J[0][0] * J[1][1] - J[0][1] * J[1][0]}};
+    const su2double Det = J[0][0] * Adj[0][0] + J[0][1] * Adj[1][0] + J[0][2] * Adj[2][0];
+    if (fabs(Det) < EPS * EPS) return false;
+
+    su2double Delta[3];
+    for (unsigned short iDim = 0; iDim < 3; iDim++)
+      Delta[iDim] = -(Adj[iDim][0] * F[0] + Adj[iDim][1] * F[1] + Adj[iDim][2] * F[2]) / Det;
+
+    const bool converged = (fabs(Delta[0]) < tol) && (fabs(Delta[1]) < tol) && (fabs(Delta[2]) < tol);
+
+    /*--- Halve the step until the residual decreases. ---*/
+
+    su2double uvwNew[3], Relax = 1.0, NormNew = NormF;
+    bool decreased = false;
+    for (unsigned short iHalf = 0; iHalf < 10 && !decreased; iHalf++) {
+      for (unsigned short iDim = 0; iDim < 3; iDim++) uvwNew[iDim] = uvw[iDim] + Relax * Delta[iDim];
+      EvalCartesianCoord(uvwNew, X, J, work);
+      for (unsigned short iDim = 0; iDim < 3; iDim++) F[iDim] = X[iDim] - xyz[iDim];
+      NormNew = GeometryToolbox::Norm(3, F);
+      decreased = (NormNew < NormF) || (NormNew == 0.0);
+      Relax *= 0.5;
+    }
+    if (!decreased && !converged) return false;
+
+    for (unsigned short iDim = 0; iDim < 3; iDim++) uvw[iDim] = uvwNew[iDim];
+    NormF = NormNew;
+
+    if (converged) return true;
+  }
+  return false;
+}
+
 su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
   unsigned short iDim, jDim, lmn[3];
 
@@ -602,33 +602,15 @@ vector<vector<su2double> > CSurfaceMovement::SetSurface_Deformation(CGeometry* g
       }
     }
 
-    /*--- Apply the design variables to the control point position ---*/
+    /*--- Apply the bump design variables (Hicks-Henne, CST, surface bump) in one sweep over the surface,
+     the deformation is reset if the first design variable is one of them. ---*/
 
+    vector<CBumpDV> bumps;
     for (iDV = 0; iDV < config->GetnDV(); iDV++) {
-      switch (config->GetDesign_Variable(iDV)) {
-        case HICKS_HENNE:
-          SetHicksHenne(geometry, config, iDV, false);
-          break;
-      }
-    }
-
-    /*--- Apply the design variables to the control point position ---*/
-
-    for (iDV = 0; iDV < config->GetnDV(); iDV++) {
-      if (config->GetDesign_Variable(iDV) == CST) {
-        SetCST(geometry, config, iDV, false);
-      }
-    }
-
-    /*--- Apply the design variables to the control point position ---*/
-
-    for (iDV = 0; iDV < config->GetnDV(); iDV++) {
-      switch (config->GetDesign_Variable(iDV)) {
-        case SURFACE_BUMP:
-          SetSurface_Bump(geometry, config, iDV, false);
-          break;
-      }
+      if (IsBumpDV(config->GetDesign_Variable(iDV))) bumps.push_back(GetBumpDV(config, iDV));
     }
+    if (IsBumpDV(config->GetDesign_Variable(0))) ResetVarCoord(geometry, config);
+    if (!bumps.empty()) SetBump_Deformation(geometry, config, bumps);
 
     /*--- Apply the angle of attack design variable ---*/
 
@@ -729,6 +711,155 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry* geometry, CConfig* confi
   SetSurface_Deformation(geometry, config);
 }
 
+void CSurfaceMovement::SetProjection_AD(CGeometry* geometry, CConfig* config, su2double** Gradient) {
+  su2double *VarCoord = nullptr, Sensitivity, localGradient, *Normal, Area = 0.0;
+  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
+  unsigned long iVertex, nVertex, iPoint;
+
+  nMarker = config->GetnMarker_All();
+  nDim = geometry->GetnDim();
+  nDV = config->GetnDV();
+
+  /*--- Discrete adjoint gradient computation. ---*/
+
+  if (rank == MASTER_NODE)
+    cout << endl
+         << "Evaluate functional gradient using Algorithmic Differentiation (ZONE " << config->GetiZone() << ")."
+         << endl;
+
+  /*--- Start recording of operations. ---*/
+
+  AD::StartRecording();
+
+  /*--- Register design variables as input and set them to zero
+   * (since we want to have the derivative at alpha = 0, i.e. for the current design). ---*/
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      config->SetDV_Value(iDV, iDV_Value, 0.0);
+
+      AD::RegisterInput(config->GetDV_Value(iDV, iDV_Value));
+    }
+  }
+
+  /*--- Call the surface deformation routine. ---*/
+
+  SetSurface_Deformation(geometry, config);
+
+  /*--- Stop the recording. --- */
+
+  AD::StopRecording();
+
+  /*--- Create a structure to identify points that have been already visited.
+   * We need that to make sure to set the sensitivity of surface points only once.
+   * Markers share points, so we would visit them more than once in the loop over the markers below). ---*/
+
+  vector<bool> visited(geometry->GetnPoint(), false);
+
+  /*--- Initialize the derivatives of the output of the surface deformation routine
+   * with the discrete adjoints from the CFD solution. ---*/
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) == YES) {
+      nVertex = geometry->nVertex[iMarker];
+      for (iVertex = 0; iVertex < nVertex; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!visited[iPoint]) {
+          VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+
+          Area = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Area += Normal[iDim] * Normal[iDim];
+          }
+          Area = sqrt(Area);
+
+          for (iDim = 0; iDim < nDim; iDim++) {
+            if (config->GetDiscrete_Adjoint()) {
+              Sensitivity = geometry->GetSensitivity(iPoint, iDim);
+            } else {
+              Sensitivity = -Normal[iDim] * geometry->vertex[iMarker][iVertex]->GetAuxVar() / Area;
+            }
+            SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity));
+          }
+          visited[iPoint] = true;
+        }
+      }
+    }
+  }
+
+  /*--- Compute derivatives and extract gradient. ---*/
+
+  AD::ComputeAdjoint();
+
+  /*--- Reduce the derivatives of all design variables together. ---*/
+
+  vector<passivedouble> my_Gradients, Gradients;
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      my_Gradients.push_back(SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)));
+    }
+  }
+  Gradients.resize(my_Gradients.size());
+  SU2_MPI::Allreduce(my_Gradients.data(), Gradients.data(), my_Gradients.size(), MPI_DOUBLE, MPI_SUM,
+                     SU2_MPI::GetComm());
+  auto iGradient = 0ul;
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      localGradient = Gradients[iGradient++];
+
+      /*--- Angle of Attack design variable (this is different, the value comes form the input file). ---*/
+
+      if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
+          (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK)) {
+        Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
+      }
+
+      Gradient[iDV][iDV_Value] += localGradient;
+    }
+  }
+
+  AD::Reset();
+}
+
+void CSurfaceMovement::OutputGradient(su2double** Gradient, const CConfig* config, ofstream& Gradient_file) {
+  unsigned short nDV, iDV, iDV_Value, nDV_Value;
+
+  int rank = SU2_MPI::GetRank();
+
+  nDV = config->GetnDV();
+
+  /*--- Loop through all design variables and their gradients. ---*/
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    nDV_Value = config->GetnDV_Value(iDV);
+    if (rank == MASTER_NODE) {
+      /*--- Print the kind of design variable on screen. ---*/
+
+      cout << endl << "Design variable (" << config->GetDesign_Variable_Name(iDV) << ") number " << iDV << "." << endl;
+
+      /*--- Print the kind of objective function to screen. ---*/
+
+      const auto objName = config->GetObjFunc_Name();
+      cout << objName << " gradient : ";
+      if (iDV == 0) Gradient_file << objName << " gradient " << endl;
+
+      /*--- Print the gradient to file and screen. ---*/
+
+      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
+        cout << Gradient[iDV][iDV_Value];
+        if (iDV_Value != nDV_Value - 1) {
+          cout << ", ";
+        }
+        Gradient_file << Gradient[iDV][iDV_Value] << endl;
+      }
+      cout << endl;
+      cout << "-------------------------------------------------------------------------" << endl;
+    }
+  }
+}
+
 void CSurfaceMovement::CopyBoundary(CGeometry* geometry, CConfig* config) {
   unsigned short iMarker;
   unsigned long iVertex, iPoint;
@@ -824,95 +955,153 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
                    CURRENT_FUNCTION);
   }
 
+  /*--- Vertices of the DV markers, and their coordinates in the system of the FFD box. ---*/
+
+  vector<pair<unsigned short, unsigned long> > Vertices;
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
-      TotalVertex += geometry->nVertex[iMarker];
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) Vertices.emplace_back(iMarker, iVertex);
+    }
+  }
+  TotalVertex = Vertices.size();
 
-      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        /*--- Get the cartesian coordinates ---*/
+  su2activematrix CartCoords(TotalVertex, 3), ParamCoords(TotalVertex, 3);
+  vector<su2double> Diffs(TotalVertex, 0.0);
+  enum : char { OUTSIDE, INVERTED, NOT_CONVERGED };
+  vector<char> Status(TotalVertex, OUTSIDE);
 
-        su2double CartCoord[3] = {};
-        for (auto iDim = 0u; iDim < nDim; iDim++) CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
+  const su2double Tol = config->GetFFD_Tol() * 1E-3;
+  const unsigned long MaxIter = config->GetnFFD_Iter();
 
-        /*--- Transform the cartesian into polar ---*/
+  /*--- Point inversion, in parallel with Newton's method, each thread starts from the parametric coordinates
+   * of its previous point. The points where it does not converge use the iterative method afterwards. ---*/
 
-        if (!cartesian) {
-          const su2double X_0 = config->GetFFD_Axis(0);
-          const su2double Y_0 = config->GetFFD_Axis(1);
-          const su2double Z_0 = config->GetFFD_Axis(2);
+  FFDBox->SetFlatControlPoints();
 
-          const su2double Xbar = CartCoord[0] - X_0;
-          const su2double Ybar = CartCoord[1] - Y_0;
-          const su2double Zbar = CartCoord[2] - Z_0;
+  SU2_OMP_PARALLEL {
+    vector<su2double> Work(FFDBox->GetEvalWorkSize());
+    su2double Guess[3] = {0.5, 0.5, 0.5};
 
-          CartCoord[1] = atan2(Zbar, Ybar);
-          if (CartCoord[1] > PI_NUMBER / 2.0) CartCoord[1] -= 2.0 * PI_NUMBER;
+    SU2_OMP_FOR_STAT(max<size_t>(1, roundUpDiv(TotalVertex, omp_get_num_threads())))
+    for (auto iVertexList = 0ul; iVertexList < TotalVertex; iVertexList++) {
+      const auto iMarker = Vertices[iVertexList].first;
+      const auto iVertex = Vertices[iVertexList].second;
 
-          if (cylindrical) {
-            CartCoord[0] = sqrt(Ybar * Ybar + Zbar * Zbar);
-            CartCoord[2] = Xbar;
-          } else if (spherical || polar) {
-            CartCoord[0] = sqrt(Xbar * Xbar + Ybar * Ybar + Zbar * Zbar);
-            CartCoord[2] = acos(Xbar / CartCoord[0]);
-          }
+      /*--- Get the cartesian coordinates ---*/
+
+      su2double* CartCoord = CartCoords[iVertexList];
+      for (auto iDim = 0u; iDim < 3; iDim++)
+        CartCoord[iDim] = (iDim < nDim) ? geometry->vertex[iMarker][iVertex]->GetCoord(iDim) : 0.0;
+
+      /*--- Transform the cartesian into polar ---*/
+
+      if (!cartesian) {
+        const su2double X_0 = config->GetFFD_Axis(0);
+        const su2double Y_0 = config->GetFFD_Axis(1);
+        const su2double Z_0 = config->GetFFD_Axis(2);
+
+        const su2double Xbar = CartCoord[0] - X_0;
+        const su2double Ybar = CartCoord[1] - Y_0;
+        const su2double Zbar = CartCoord[2] - Z_0;
+
+        CartCoord[1] = atan2(Zbar, Ybar);
+        if (CartCoord[1] > PI_NUMBER / 2.0) CartCoord[1] -= 2.0 * PI_NUMBER;
+
+        if (cylindrical) {
+          CartCoord[0] = sqrt(Ybar * Ybar + Zbar * Zbar);
+          CartCoord[2] = Xbar;
+        } else if (spherical || polar) {
+          CartCoord[0] = sqrt(Xbar * Xbar + Ybar * Ybar + Zbar * Zbar);
+          CartCoord[2] = acos(Xbar / CartCoord[0]);
         }
+      }
 
-        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      /*--- If the point is inside the FFD, compute the value of the parametric coordinate. ---*/
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate. ---*/
+      if (!FFDBox->CheckPointInsideFFD(CartCoord)) continue;
 
-        if (FFDBox->CheckPointInsideFFD(CartCoord)) {
-          /*--- Find the parametric coordinate ---*/
+      su2double* ParamCoord = ParamCoords[iVertexList];
+      for (auto iDim = 0u; iDim < 3; iDim++) ParamCoord[iDim] = Guess[iDim];
 
-          ++VisitedVertex;
-          auto* ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+      if (!FFDBox->GetParametricCoord_Newton(CartCoord, ParamCoord, Tol, MaxIter, Work.data())) {
+        Status[iVertexList] = NOT_CONVERGED;
+        continue;
+      }
+      Status[iVertexList] = INVERTED;
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+      /*--- Compute the cartesian coordinates using the parametric coordinates
+       to check that everything is correct ---*/
 
-          const auto* CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      su2double CartCoordNew[3];
+      FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew, nullptr, Work.data());
+      Diffs[iVertexList] = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+      for (auto iDim = 0u; iDim < 3; iDim++) Guess[iDim] = ParamCoord[iDim];
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-          const su2double Diff = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+  /*--- Fallback for the points where Newton's method failed. ---*/
 
-          /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
+  for (auto iVertexList = 0ul; iVertexList < TotalVertex; iVertexList++) {
+    if (Status[iVertexList] != NOT_CONVERGED) continue;
 
-          if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 do not work properly. ---*/
+    const auto iPoint = geometry->vertex[Vertices[iVertexList].first][Vertices[iVertexList].second]->GetNode();
+    const auto* ParamCoord =
+        FFDBox->GetParametricCoord_Iterative(iPoint, CartCoords[iVertexList], ParamCoordGuess, config);
+    for (auto iDim = 0u; iDim < 3; iDim++) ParamCoords(iVertexList, iDim) = ParamCoord[iDim];
 
-            const su2double lower_limit = config->GetFFD_Tol();
-            const su2double upper_limit = 1.0 - config->GetFFD_Tol();
+    const auto* CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoords[iVertexList]);
+    Diffs[iVertexList] = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoords[iVertexList]);
+  }
 
-            ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
-            ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
-            ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
+  /*--- Store the points that belong to the box, in the order of the markers and vertices. ---*/
 
-            /*--- Set the value of the parametric coordinate ---*/
+  for (auto iVertexList = 0ul; iVertexList < TotalVertex; iVertexList++) {
+    if (Status[iVertexList] == OUTSIDE) continue;
+    ++VisitedVertex;
 
-            ++MappedVertex;
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
+    const auto iMarker = Vertices[iVertexList].first;
+    const auto iVertex = Vertices[iVertexList].second;
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    su2double* CartCoord = CartCoords[iVertexList];
+    su2double* ParamCoord = ParamCoords[iVertexList];
+    const su2double Diff = Diffs[iVertexList];
 
-            ParamCoordGuess[0] = ParamCoord[0];
-            ParamCoordGuess[1] = ParamCoord[1];
-            ParamCoordGuess[2] = ParamCoord[2];
-          }
+    /*--- Compute max difference between original value and the recomputed value ---*/
 
-          if (Diff >= config->GetFFD_Tol()) {
-            cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
-                 << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
-                 << Diff << " vs " << config->GetFFD_Tol() << "." << endl;
-          }
-        }
-      }
+    my_MaxDiff = max(my_MaxDiff, Diff);
+
+    /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
+
+    if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 do not work properly. ---*/
+
+      const su2double lower_limit = config->GetFFD_Tol();
+      const su2double upper_limit = 1.0 - config->GetFFD_Tol();
+
+      ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
+      ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
+      ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
+
+      /*--- Set the value of the parametric coordinate ---*/
+
+      ++MappedVertex;
+      FFDBox->Set_MarkerIndex(iMarker);
+      FFDBox->Set_VertexIndex(iVertex);
+      FFDBox->Set_PointIndex(iPoint);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
+    }
+
+    if (Diff >= config->GetFFD_Tol()) {
+      cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
+           << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
+           << Diff << " vs " << config->GetFFD_Tol() << "." << endl;
     }
   }
 
@@ -1626,10 +1815,9 @@ void CSurfaceMovement::ApplyDesignVariables(CGeometry* geometry, CConfig* config
 
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
                                               unsigned short iFFDBox, bool ResetDef) {
-  su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff, *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0},
-                                 CartCoordOld[3] = {0.0, 0.0, 0.0};
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
+  su2double my_MaxDiff = 0.0, MaxDiff, VarCoord[3] = {0.0, 0.0, 0.0};
+  unsigned short iMarker;
+  unsigned long iVertex;
 
   bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
   bool spherical = (config->GetFFD_CoordSystem() == SPHERICAL);
@@ -1647,57 +1835,61 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* conf
     }
   }
 
-  /*--- Recompute the cartesians coordinates ---*/
+  /*--- Recompute the cartesians coordinates (in parallel, the surface points are unique). ---*/
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
-    /*--- Get the marker of the surface point ---*/
+  FFDBox->SetFlatControlPoints();
+  const unsigned long nSurfacePoint = FFDBox->GetnSurfacePoint();
 
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+  SU2_OMP_PARALLEL {
+    vector<su2double> Work(FFDBox->GetEvalWorkSize());
+    su2double thread_MaxDiff = 0.0;
 
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      /*--- Get the vertex of the surface point ---*/
+    SU2_OMP_FOR_DYN(256)
+    for (auto iSurfacePoints = 0ul; iSurfacePoints < nSurfacePoint; iSurfacePoints++) {
+      /*--- Get the marker of the surface point ---*/
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
 
-      /*--- Set to zero the variation of the coordinates ---*/
+      if (config->GetMarker_All_DV(iMarker) != YES) continue;
 
-      geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+      /*--- Get the vertex of the surface point ---*/
+
+      const auto iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+      const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
       /*--- Get the parametric coordinate of the surface point ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+      su2double ParamCoord[3], CartCoordNew[3], VarCoord[3] = {0.0, 0.0, 0.0};
+      for (auto iDim = 0u; iDim < 3; iDim++) ParamCoord[iDim] = FFDBox->Get_ParametricCoord(iSurfacePoints, iDim);
 
       /*--- Compute the new cartesian coordinate, and set the value in
        the FFDBox structure ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew, nullptr, Work.data());
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
       if (cylindrical) {
-        su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
-        X_0 = config->GetFFD_Axis(0);
-        Y_0 = config->GetFFD_Axis(1);
-        Z_0 = config->GetFFD_Axis(2);
+        const su2double X_0 = config->GetFFD_Axis(0);
+        const su2double Y_0 = config->GetFFD_Axis(1);
+        const su2double Z_0 = config->GetFFD_Axis(2);
 
-        Xbar = CartCoordNew[2];
-        Ybar = CartCoordNew[0] * cos(CartCoordNew[1]);
-        Zbar = CartCoordNew[0] * sin(CartCoordNew[1]);
+        const su2double Xbar = CartCoordNew[2];
+        const su2double Ybar = CartCoordNew[0] * cos(CartCoordNew[1]);
+        const su2double Zbar = CartCoordNew[0] * sin(CartCoordNew[1]);
 
         CartCoordNew[0] = Xbar + X_0;
         CartCoordNew[1] = Ybar + Y_0;
         CartCoordNew[2] = Zbar + Z_0;
 
       } else if (spherical || polar) {
-        su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
-        X_0 = config->GetFFD_Axis(0);
-        Y_0 = config->GetFFD_Axis(1);
-        Z_0 = config->GetFFD_Axis(2);
+        const su2double X_0 = config->GetFFD_Axis(0);
+        const su2double Y_0 = config->GetFFD_Axis(1);
+        const su2double Z_0 = config->GetFFD_Axis(2);
 
-        Xbar = CartCoordNew[0] * cos(CartCoordNew[2]);
-        Ybar = CartCoordNew[0] * cos(CartCoordNew[1]) * sin(CartCoordNew[2]);
-        Zbar = CartCoordNew[0] * sin(CartCoordNew[1]) * sin(CartCoordNew[2]);
+        const su2double Xbar = CartCoordNew[0] * cos(CartCoordNew[2]);
+        const su2double Ybar = CartCoordNew[0] * cos(CartCoordNew[1]) * sin(CartCoordNew[2]);
+        const su2double Zbar = CartCoordNew[0] * sin(CartCoordNew[1]) * sin(CartCoordNew[2]);
 
         CartCoordNew[0] = Xbar + X_0;
         CartCoordNew[1] = Ybar + Y_0;
@@ -1706,30 +1898,30 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* conf
 
       FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
 
-      /*--- Get the original cartesian coordinates of the surface point ---*/
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CartCoordOld[iDim] = geometry->nodes->GetCoord(iPoint, iDim);
-      }
+      /*--- Set the value of the variation of the coordinates, w.r.t. the original cartesian coordinates ---*/
 
-      /*--- Set the value of the variation of the coordinates ---*/
-
-      Diff = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        VarCoord[iDim] = CartCoordNew[iDim] - CartCoordOld[iDim];
+      su2double Diff = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        VarCoord[iDim] = CartCoordNew[iDim] - geometry->nodes->GetCoord(iPoint, iDim);
         if ((fabs(VarCoord[iDim]) <= EPS) && (config->GetDirectDiff() != D_DESIGN) && (!config->GetAD_Mode()))
           VarCoord[iDim] = 0.0;
         Diff += (VarCoord[iDim] * VarCoord[iDim]);
       }
       Diff = sqrt(Diff);
 
-      my_MaxDiff = max(my_MaxDiff, Diff);
+      thread_MaxDiff = max(thread_MaxDiff, Diff);
 
       /*--- Set the variation of the coordinates ---*/
 
       geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
     }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    my_MaxDiff = max(my_MaxDiff, thread_MaxDiff);
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 
@@ -2722,446 +2914,206 @@ void CSurfaceMovement::SetAngleOfAttack(CGeometry* boundary, CConfig* config, un
   config->SetAoA_Offset(Ampl);
 }
 
-void CSurfaceMovement::SetHicksHenne(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
-  unsigned long iVertex;
-  unsigned short iMarker;
-  su2double VarCoord[3] = {0.0, 0.0, 0.0}, VarCoord_[3] = {0.0, 0.0, 0.0}, *Coord_, *Normal_, ek, fk,
-            Coord[3] = {0.0, 0.0, 0.0}, Normal[3] = {0.0, 0.0, 0.0}, TPCoord[2] = {0.0, 0.0}, LPCoord[2] = {0.0, 0.0},
-            Distance, Chord, AoA, ValCos, ValSin;
-
-  bool upper = true;
-  su2double Scale = config->GetOpt_RelaxFactor();
-
-  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
-
-  if ((iDV == 0) || (ResetDef)) {
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        VarCoord[0] = 0.0;
-        VarCoord[1] = 0.0;
-        VarCoord[2] = 0.0;
-        boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-      }
-  }
-
-  /*--- Compute the angle of attack to apply the deformation ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      Coord_ = boundary->vertex[iMarker][0]->GetCoord();
-      TPCoord[0] = Coord_[0];
-      TPCoord[1] = Coord_[1];
-      for (iVertex = 1; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        if (Coord_[0] > TPCoord[0]) {
-          TPCoord[0] = Coord_[0];
-          TPCoord[1] = Coord_[1];
-        }
+CSurfaceMovement::CBumpDV CSurfaceMovement::GetBumpDV(const CConfig* config, unsigned short iDV) {
+  CBumpDV bump;
+  bump.kind = config->GetDesign_Variable(iDV);
+  bump.ampl = config->GetDV_Value(iDV) * config->GetOpt_RelaxFactor();
+
+  switch (bump.kind) {
+    case HICKS_HENNE: {
+      bump.upper = (config->GetParamDV(iDV, 0) != NO);
+      const su2double xk = config->GetParamDV(iDV, 1);
+      bump.param[0] = log10(0.5) / log10(xk);
+      break;
+    }
+    case SURFACE_BUMP: {
+      const su2double x_start = config->GetParamDV(iDV, 0);
+      const su2double x_end = config->GetParamDV(iDV, 1);
+      const su2double xk = config->GetParamDV(iDV, 2);
+      bump.param[0] = x_start;
+      bump.param[1] = x_end - x_start;
+      bump.param[2] = log10(0.5) / log10((xk - x_start + EPS) / bump.param[1]);
+      break;
+    }
+    case CST: {
+      bump.upper = (config->GetParamDV(iDV, 0) != NO);
+      const su2double KulfanNum = config->GetParamDV(iDV, 1) - 1.0;
+      const su2double maxKulfanNum = config->GetParamDV(iDV, 2) - 1.0;
+      if (KulfanNum < 0) {
+        std::cout << "Warning: Kulfan number should be greater than 1." << std::endl;
       }
-    }
-  }
-
-#ifdef HAVE_MPI
-
-  int iProcessor, nProcessor = size;
-  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
-
-  Buffer_Receive_Coord = new su2double[nProcessor * 2];
-  Buffer_Send_Coord = new su2double[2];
-
-  Buffer_Send_Coord[0] = TPCoord[0];
-  Buffer_Send_Coord[1] = TPCoord[1];
-
-  SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, SU2_MPI::GetComm());
-
-  TPCoord[0] = Buffer_Receive_Coord[0];
-  TPCoord[1] = Buffer_Receive_Coord[1];
-  for (iProcessor = 1; iProcessor < nProcessor; iProcessor++) {
-    Coord[0] = Buffer_Receive_Coord[iProcessor * 2 + 0];
-    Coord[1] = Buffer_Receive_Coord[iProcessor * 2 + 1];
-    if (Coord[0] > TPCoord[0]) {
-      TPCoord[0] = Coord[0];
-      TPCoord[1] = Coord[1];
-    }
-  }
-
-  delete[] Buffer_Send_Coord;
-  delete[] Buffer_Receive_Coord;
-
-#endif
-
-  Chord = 0.0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Distance = sqrt(pow(Coord_[0] - TPCoord[0], 2.0) + pow(Coord_[1] - TPCoord[1], 2.0));
-        if (Chord < Distance) {
-          Chord = Distance;
-          LPCoord[0] = Coord_[0];
-          LPCoord[1] = Coord_[1];
-        }
+      if (KulfanNum > maxKulfanNum) {
+        std::cout << "Warning: Kulfan number should be less than provided maximum." << std::endl;
       }
-    }
-  }
 
-#ifdef HAVE_MPI
-
-  Buffer_Receive_Coord = new su2double[nProcessor * 2];
-  Buffer_Send_Coord = new su2double[2];
-
-  Buffer_Send_Coord[0] = LPCoord[0];
-  Buffer_Send_Coord[1] = LPCoord[1];
+      /*--- Binomial coefficient of the Bernstein polynomial. ---*/
+      su2double fact_n = 1, fact_cst = 1, fact_cst_n = 1;
+      for (int i = 1; i <= maxKulfanNum; i++) fact_n = fact_n * i;
+      for (int i = 1; i <= KulfanNum; i++) fact_cst = fact_cst * i;
+      for (int i = 1; i <= maxKulfanNum - KulfanNum; i++) fact_cst_n = fact_cst_n * i;
 
-  SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, SU2_MPI::GetComm());
-
-  Chord = 0.0;
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-    Coord[0] = Buffer_Receive_Coord[iProcessor * 2 + 0];
-    Coord[1] = Buffer_Receive_Coord[iProcessor * 2 + 1];
-    Distance = sqrt(pow(Coord[0] - TPCoord[0], 2.0) + pow(Coord[1] - TPCoord[1], 2.0));
-    if (Chord < Distance) {
-      Chord = Distance;
-      LPCoord[0] = Coord[0];
-      LPCoord[1] = Coord[1];
+      bump.param[0] = KulfanNum;
+      bump.param[1] = maxKulfanNum;
+      bump.param[2] = fact_n / (fact_cst * fact_cst_n);
+      break;
     }
+    default:
+      SU2_MPI::Error("The design variable is not a bump function.", CURRENT_FUNCTION);
+      break;
   }
+  return bump;
+}
 
-  delete[] Buffer_Send_Coord;
-  delete[] Buffer_Receive_Coord;
-
-#endif
-
-  AoA = atan((LPCoord[1] - TPCoord[1]) / (TPCoord[0] - LPCoord[0])) * 180 / PI_NUMBER;
-
-  /*--- WARNING: AoA currently overwritten to zero. ---*/
-  AoA = 0.0;
-
-  /*--- Perform multiple airfoil deformation ---*/
+su2double CSurfaceMovement::CBumpDV::Eval(const su2double* coord, const su2double* normal) const {
+  /*--- The bump functions should be applied to a basic airfoil without AoA and with unitary chord,
+   the transformation is not applied as the AoA is currently assumed to be zero. ---*/
 
-  su2double Ampl = config->GetDV_Value(iDV) * Scale;
-  su2double xk = config->GetParamDV(iDV, 1);
   const su2double t2 = 3.0;
 
-  if (config->GetParamDV(iDV, 0) == NO) {
-    upper = false;
-  }
-  if (config->GetParamDV(iDV, 0) == YES) {
-    upper = true;
-  }
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-      VarCoord[0] = 0.0;
-      VarCoord[1] = 0.0;
-      VarCoord[2] = 0.0;
-
-      if (config->GetMarker_All_DV(iMarker) == YES) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal_ = boundary->vertex[iMarker][iVertex]->GetNormal();
-
-        /*--- The Hicks Henne bump functions should be applied to a basic airfoil without AoA,
-         and unitary chord, a tranformation is required ---*/
-
-        ValCos = cos(AoA * PI_NUMBER / 180.0);
-        ValSin = sin(AoA * PI_NUMBER / 180.0);
-
-        Coord[0] = Coord_[0] * ValCos - Coord_[1] * ValSin;
-        Coord[0] = max(0.0, Coord[0]);  // Coord x should be always positive
-        Coord[1] = Coord_[1] * ValCos + Coord_[0] * ValSin;
-
-        Normal[0] = Normal_[0] * ValCos - Normal_[1] * ValSin;
-        Normal[1] = Normal_[1] * ValCos + Normal_[0] * ValSin;
+  switch (kind) {
+    case HICKS_HENNE: {
+      if ((upper && normal[1] <= 0) || (!upper && normal[1] >= 0)) return 0.0;
 
-        /*--- Bump computation ---*/
-
-        ek = log10(0.5) / log10(xk);
-        if (Coord[0] > 10 * EPS)
-          fk = pow(sin(PI_NUMBER * pow(Coord[0], ek)), t2);
-        else
-          fk = 0.0;
-
-        /*--- Upper and lower surface ---*/
-
-        if ((upper) && (Normal[1] > 0)) {
-          VarCoord[1] = Ampl * fk;
-        }
-        if ((!upper) && (Normal[1] < 0)) {
-          VarCoord[1] = -Ampl * fk;
-        }
-      }
-
-      /*--- Apply the transformation to the coordinate variation ---*/
-
-      ValCos = cos(-AoA * PI_NUMBER / 180.0);
-      ValSin = sin(-AoA * PI_NUMBER / 180.0);
+      const su2double x = max(0.0, coord[0]);  // Coord x should be always positive
+      const su2double ek = param[0];
+      const su2double fk = (x > 10 * EPS) ? pow(sin(PI_NUMBER * pow(x, ek)), t2) : 0.0;
+      return upper ? ampl * fk : -ampl * fk;
+    }
+    case SURFACE_BUMP: {
+      const su2double BumpLoc = param[0], BumpSize = param[1], ek = param[2];
+      const su2double xCoord = coord[0] - BumpLoc;
+      if ((xCoord <= 0.0) || (xCoord >= BumpSize)) return 0.0;
+      return ampl * pow(sin(PI_NUMBER * pow((xCoord + EPS) / BumpSize, ek)), t2);
+    }
+    case CST: {
+      if ((upper && normal[1] <= 0) || (!upper && normal[1] >= 0)) return 0.0;
 
-      VarCoord_[0] = VarCoord[0] * ValCos - VarCoord[1] * ValSin;
-      VarCoord_[1] = VarCoord[1] * ValCos + VarCoord[0] * ValSin;
+      const su2double x = max(0.0, coord[0]);
+      const su2double KulfanNum = param[0], maxKulfanNum = param[1], Binomial = param[2];
 
-      boundary->vertex[iMarker][iVertex]->AddVarCoord(VarCoord_);
+      /*--- Upper and lower surface change in coordinates based on CST equations by Kulfan et. al
+       * (www.brendakulfan.com/docs/CST3.pdf), class function for 2D NACA type airfoils (N1 = 0.5, N2 = 1). ---*/
+      const su2double N1 = 0.5, N2 = 1.0;
+      const su2double fk = pow(x, N1) * pow((1 - x), N2) * Binomial * pow(x, KulfanNum) *
+                           pow((1 - x), (maxKulfanNum - KulfanNum));
+      return ampl * fk;
     }
   }
+  return 0.0;
 }
 
-void CSurfaceMovement::SetSurface_Bump(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
-  unsigned long iVertex;
-  unsigned short iMarker;
-  su2double VarCoord[3] = {0.0, 0.0, 0.0}, ek, fk, *Coord, xCoord;
-  su2double Scale = config->GetOpt_RelaxFactor();
-
-  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
-
-  if ((iDV == 0) || (ResetDef)) {
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        VarCoord[0] = 0.0;
-        VarCoord[1] = 0.0;
-        VarCoord[2] = 0.0;
-        boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-      }
-  }
-
-  /*--- Perform multiple airfoil deformation ---*/
+void CSurfaceMovement::ResetVarCoord(CGeometry* boundary, const CConfig* config) {
+  const su2double VarCoord[3] = {0.0, 0.0, 0.0};
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+    for (unsigned long iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++)
+      boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+}
 
-  su2double Ampl = config->GetDV_Value(iDV) * Scale;
-  su2double x_start = config->GetParamDV(iDV, 0);
-  su2double x_end = config->GetParamDV(iDV, 1);
-  su2double BumpSize = x_end - x_start;
-  su2double BumpLoc = x_start;
-  su2double xk = config->GetParamDV(iDV, 2);
-  const su2double t2 = 3.0;
+void CSurfaceMovement::SetBump_Deformation(CGeometry* boundary, const CConfig* config,
+                                           const vector<CBumpDV>& bumps) const {
+  /*--- Each point is visited once, accumulating the variations due to all design variables. ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-      VarCoord[0] = 0.0;
-      VarCoord[1] = 0.0;
-      VarCoord[2] = 0.0;
+  SU2_OMP_PARALLEL {
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_DV(iMarker) != YES) continue;
 
-      if (config->GetMarker_All_DV(iMarker) == YES) {
-        Coord = boundary->vertex[iMarker][iVertex]->GetCoord();
+      SU2_OMP_FOR_STAT(256)
+      for (unsigned long iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
+        const su2double* Coord = boundary->vertex[iMarker][iVertex]->GetCoord();
+        const su2double* Normal = boundary->vertex[iMarker][iVertex]->GetNormal();
 
-        xCoord = (Coord[0] - BumpLoc);
-        ek = log10(0.5) / log10((xk - BumpLoc + EPS) / BumpSize);
-        if (xCoord > 0.0)
-          fk = pow(sin(PI_NUMBER * pow((xCoord + EPS) / BumpSize, ek)), t2);
-        else
-          fk = 0.0;
+        su2double VarCoord[3] = {0.0, 0.0, 0.0};
+        for (const auto& bump : bumps) VarCoord[1] += bump.Eval(Coord, Normal);
 
-        if ((xCoord <= 0.0) || (xCoord >= BumpSize))
-          VarCoord[1] = 0.0;
-        else {
-          VarCoord[1] = Ampl * fk;
-        }
+        boundary->vertex[iMarker][iVertex]->AddVarCoord(VarCoord);
       }
-
-      boundary->vertex[iMarker][iVertex]->AddVarCoord(VarCoord);
+      END_SU2_OMP_FOR
     }
   }
+  END_SU2_OMP_PARALLEL
 }
 
-void CSurfaceMovement::SetCST(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
-  unsigned long iVertex;
-  unsigned short iMarker;
-  su2double VarCoord[3] = {0.0, 0.0, 0.0}, VarCoord_[3] = {0.0, 0.0, 0.0}, *Coord_, *Normal_, fk,
-            Coord[3] = {0.0, 0.0, 0.0}, Normal[3] = {0.0, 0.0, 0.0}, TPCoord[2] = {0.0, 0.0}, LPCoord[2] = {0.0, 0.0},
-            Distance, Chord, AoA, ValCos, ValSin;
+void CSurfaceMovement::SetBump_Gradient(CGeometry* boundary, const CConfig* config,
+                                        const vector<unsigned short>& listDV, su2double* gradient) const {
+  const auto nBump = listDV.size();
+  const auto nDim = boundary->GetnDim();
 
-  bool upper = true;
-  su2double Scale = config->GetOpt_RelaxFactor();
+  vector<CBumpDV> bumps;
+  for (auto iDV : listDV) bumps.push_back(GetBumpDV(config, iDV));
 
-  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
+  /*--- Vertices of the DV markers, each owned point is counted once. ---*/
 
-  if ((iDV == 0) || (ResetDef)) {
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        VarCoord[0] = 0.0;
-        VarCoord[1] = 0.0;
-        VarCoord[2] = 0.0;
-        boundary->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
-      }
-  }
-
-  /*--- Compute the angle of attack to apply the deformation ---*/
+  vector<pair<unsigned short, unsigned long> > Vertices;
+  vector<bool> UpdatePoint(boundary->GetnPointDomain(), true);
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      Coord_ = boundary->vertex[iMarker][0]->GetCoord();
-      TPCoord[0] = Coord_[0];
-      TPCoord[1] = Coord_[1];
-      for (iVertex = 1; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        if (Coord_[0] > TPCoord[0]) {
-          TPCoord[0] = Coord_[0];
-          TPCoord[1] = Coord_[1];
-        }
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) != YES) continue;
+    for (unsigned long iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = boundary->vertex[iMarker][iVertex]->GetNode();
+      if ((iPoint < boundary->GetnPointDomain()) && UpdatePoint[iPoint]) {
+        Vertices.emplace_back(iMarker, iVertex);
+        UpdatePoint[iPoint] = false;
       }
     }
   }
 
-#ifdef HAVE_MPI
-
-  int iProcessor, nProcessor = size;
-  su2double *Buffer_Send_Coord, *Buffer_Receive_Coord;
+  /*--- Finite difference steps. ---*/
 
-  Buffer_Receive_Coord = new su2double[nProcessor * 2];
-  Buffer_Send_Coord = new su2double[2];
+  vector<su2double> delta_eps(nBump);
+  for (auto iBump = 0ul; iBump < nBump; iBump++) delta_eps[iBump] = config->GetDV_Value(listDV[iBump]);
 
-  Buffer_Send_Coord[0] = TPCoord[0];
-  Buffer_Send_Coord[1] = TPCoord[1];
+  vector<su2double> localGradient(nBump, 0.0);
 
-  SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_OMP_PARALLEL {
+    vector<su2double> threadGradient(nBump, 0.0);
 
-  TPCoord[0] = Buffer_Receive_Coord[0];
-  TPCoord[1] = Buffer_Receive_Coord[1];
-  for (iProcessor = 1; iProcessor < nProcessor; iProcessor++) {
-    Coord[0] = Buffer_Receive_Coord[iProcessor * 2 + 0];
-    Coord[1] = Buffer_Receive_Coord[iProcessor * 2 + 1];
-    if (Coord[0] > TPCoord[0]) {
-      TPCoord[0] = Coord[0];
-      TPCoord[1] = Coord[1];
-    }
-  }
+    SU2_OMP_FOR_STAT(256)
+    for (auto iList = 0ul; iList < Vertices.size(); iList++) {
+      const auto vertex = boundary->vertex[Vertices[iList].first][Vertices[iList].second];
+      const su2double* Coord = vertex->GetCoord();
+      const su2double* Normal = vertex->GetNormal();
 
-  delete[] Buffer_Send_Coord;
-  delete[] Buffer_Receive_Coord;
+      /*--- The variations are along y, their projection on the unit normal is weighted by the sensitivity. ---*/
 
-#endif
+      const su2double dS = GeometryToolbox::Norm(nDim, Normal);
+      const su2double factor = -vertex->GetAuxVar() * Normal[1] / dS;
 
-  Chord = 0.0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Distance = sqrt(pow(Coord_[0] - TPCoord[0], 2.0) + pow(Coord_[1] - TPCoord[1], 2.0));
-        if (Chord < Distance) {
-          Chord = Distance;
-          LPCoord[0] = Coord_[0];
-          LPCoord[1] = Coord_[1];
-        }
-      }
+      for (auto iBump = 0ul; iBump < nBump; iBump++)
+        threadGradient[iBump] += factor * bumps[iBump].Eval(Coord, Normal) / delta_eps[iBump];
     }
-  }
-
-#ifdef HAVE_MPI
-
-  Buffer_Receive_Coord = new su2double[nProcessor * 2];
-  Buffer_Send_Coord = new su2double[2];
+    END_SU2_OMP_FOR
 
-  Buffer_Send_Coord[0] = LPCoord[0];
-  Buffer_Send_Coord[1] = LPCoord[1];
-
-  SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, SU2_MPI::GetComm());
-
-  Chord = 0.0;
-  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-    Coord[0] = Buffer_Receive_Coord[iProcessor * 2 + 0];
-    Coord[1] = Buffer_Receive_Coord[iProcessor * 2 + 1];
-    Distance = sqrt(pow(Coord[0] - TPCoord[0], 2.0) + pow(Coord[1] - TPCoord[1], 2.0));
-    if (Chord < Distance) {
-      Chord = Distance;
-      LPCoord[0] = Coord[0];
-      LPCoord[1] = Coord[1];
-    }
+    SU2_OMP_CRITICAL
+    for (auto iBump = 0ul; iBump < nBump; iBump++) localGradient[iBump] += threadGradient[iBump];
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
-  delete[] Buffer_Send_Coord;
-  delete[] Buffer_Receive_Coord;
-
-#endif
-
-  AoA = atan((LPCoord[1] - TPCoord[1]) / (TPCoord[0] - LPCoord[0])) * 180 / PI_NUMBER;
-
-  /*--- WARNING: AoA currently overwritten to zero. ---*/
-  AoA = 0.0;
-
-  /*--- Perform multiple airfoil deformation ---*/
-
-  su2double Ampl = config->GetDV_Value(iDV) * Scale;
-  su2double KulfanNum = config->GetParamDV(iDV, 1) - 1.0;
-  su2double maxKulfanNum = config->GetParamDV(iDV, 2) - 1.0;
-  if (KulfanNum < 0) {
-    std::cout << "Warning: Kulfan number should be greater than 1." << std::endl;
-  }
-  if (KulfanNum > maxKulfanNum) {
-    std::cout << "Warning: Kulfan number should be less than provided maximum." << std::endl;
-  }
-
-  if (config->GetParamDV(iDV, 0) == NO) {
-    upper = false;
-  }
-  if (config->GetParamDV(iDV, 0) == YES) {
-    upper = true;
-  }
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    for (iVertex = 0; iVertex < boundary->nVertex[iMarker]; iVertex++) {
-      VarCoord[0] = 0.0;
-      VarCoord[1] = 0.0;
-      VarCoord[2] = 0.0;
-
-      if (config->GetMarker_All_DV(iMarker) == YES) {
-        Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal_ = boundary->vertex[iMarker][iVertex]->GetNormal();
-
-        /*--- The CST functions should be applied to a basic airfoil without AoA,
-         and unitary chord, a tranformation is required ---*/
-
-        ValCos = cos(AoA * PI_NUMBER / 180.0);
-        ValSin = sin(AoA * PI_NUMBER / 180.0);
-
-        Coord[0] = Coord_[0] * ValCos - Coord_[1] * ValSin;
-        Coord[0] = max(0.0, Coord[0]);  // Coord x should be always positive
-        Coord[1] = Coord_[1] * ValCos + Coord_[0] * ValSin;
-
-        Normal[0] = Normal_[0] * ValCos - Normal_[1] * ValSin;
-        Normal[1] = Normal_[1] * ValCos + Normal_[0] * ValSin;
-
-        /*--- CST computation ---*/
-        su2double fact_n = 1;
-        su2double fact_cst = 1;
-        su2double fact_cst_n = 1;
+  SU2_MPI::Allreduce(localGradient.data(), gradient, nBump, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+}
 
-        for (int i = 1; i <= maxKulfanNum; i++) {
-          fact_n = fact_n * i;
-        }
-        for (int i = 1; i <= KulfanNum; i++) {
-          fact_cst = fact_cst * i;
-        }
-        for (int i = 1; i <= maxKulfanNum - KulfanNum; i++) {
-          fact_cst_n = fact_cst_n * i;
-        }
+void CSurfaceMovement::SetHicksHenne(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
+  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
 
-        // CST method only for 2D NACA type airfoils
-        su2double N1, N2;
-        N1 = 0.5;
-        N2 = 1.0;
+  if ((iDV == 0) || (ResetDef)) ResetVarCoord(boundary, config);
 
-        /*--- Upper and lower surface change in coordinates based on CST equations by Kulfan et. al
-         * (www.brendakulfan.com/docs/CST3.pdf)  ---*/
-        fk = pow(Coord[0], N1) * pow((1 - Coord[0]), N2) * fact_n / (fact_cst * (fact_cst_n)) *
-             pow(Coord[0], KulfanNum) * pow((1 - Coord[0]), (maxKulfanNum - (KulfanNum)));
+  SetBump_Deformation(boundary, config, {GetBumpDV(config, iDV)});
+}
 
-        if ((upper) && (Normal[1] > 0)) {
-          VarCoord[1] = Ampl * fk;
-        }
+void CSurfaceMovement::SetSurface_Bump(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
+  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
 
-        if ((!upper) && (Normal[1] < 0)) {
-          VarCoord[1] = Ampl * fk;
-        }
-      }
+  if ((iDV == 0) || (ResetDef)) ResetVarCoord(boundary, config);
 
-      /*--- Apply the transformation to the coordinate variation ---*/
+  SetBump_Deformation(boundary, config, {GetBumpDV(config, iDV)});
+}
 
-      ValCos = cos(-AoA * PI_NUMBER / 180.0);
-      ValSin = sin(-AoA * PI_NUMBER / 180.0);
+void CSurfaceMovement::SetCST(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
+  /*--- Reset airfoil deformation if first deformation or if it required by the solver ---*/
 
-      VarCoord_[0] = VarCoord[0] * ValCos - VarCoord[1] * ValSin;
-      VarCoord_[1] = VarCoord[1] * ValCos + VarCoord[0] * ValSin;
+  if ((iDV == 0) || (ResetDef)) ResetVarCoord(boundary, config);
 
-      boundary->vertex[iMarker][iVertex]->AddVarCoord(VarCoord_);
-    }
-  }
+  SetBump_Deformation(boundary, config, {GetBumpDV(config, iDV)});
 }
 
 void CSurfaceMovement::SetRotation(CGeometry* boundary, CConfig* config, unsigned short iDV, bool ResetDef) {
@@ -28,6 +28,8 @@
 #include "../../include/grid_movement/CVolumetricMovement.hpp"
 #include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/CSymmetricMatrix.hpp"
+#include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
 
 CVolumetricMovement::CVolumetricMovement() : CGridMovement(), System(LINEAR_SOLVER_MODE::MESH_DEFORM) {}
 
@@ -87,26 +89,83 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry* geometry, CConfig* config) {
   geometry->SetControlVolume(config, UPDATE);
   geometry->SetBoundControlVolume(config, UPDATE);
   geometry->SetMaxLength(config);
+
+  fullUpdatePending = true;
+}
+
+void CVolumetricMovement::UpdateDualGrid_Rigid(CGeometry* geometry, CConfig* config, const su2double (*rotMatrix)[3],
+                                               const su2double* center, const su2double* translation) {
+  if (!config->GetIncremental_DualGrid()) {
+    UpdateDualGrid(geometry, config);
+    return;
+  }
+
+  /*--- The volumes and lengths do not change, only the orientation of the normals. ---*/
+
+  geometry->SetRigidMotionControlVolume(config, rotMatrix);
+
+  /*--- Compose with the previous motion, x'' = R2 (R1 x + t1) + t2, where t2 = c + t - R2 c. ---*/
+
+  su2double rotation[3][3] = {{0.0}}, shift[3] = {0.0};
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    shift[iDim] = center[iDim] + translation[iDim];
+    for (auto kDim = 0u; kDim < 3; kDim++) {
+      shift[iDim] += rotMatrix[iDim][kDim] * (rigidTranslation[kDim] - center[kDim]);
+      for (auto jDim = 0u; jDim < 3; jDim++) rotation[iDim][jDim] += rotMatrix[iDim][kDim] * rigidRotation[kDim][jDim];
+    }
+  }
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    rigidTranslation[iDim] = shift[iDim];
+    for (auto jDim = 0u; jDim < 3; jDim++) rigidRotation[iDim][jDim] = rotation[iDim][jDim];
+  }
+  rigidMotionPending = true;
 }
 
 void CVolumetricMovement::UpdateMultiGrid(CGeometry** geometry, CConfig* config) {
   unsigned short iMGfine, iMGlevel, nMGlevel = config->GetnMGLevels();
 
+  /*--- If the fine grid only moved rigidly, the coarse grids undergo the same motion (their coordinates are
+   volume-weighted averages of the fine ones, and the volumes do not change). ---*/
+
+  const bool rigid = rigidMotionPending && !fullUpdatePending;
+
   /*--- Update the multigrid structure after moving the finest grid,
    including computing the grid velocities on the coarser levels. ---*/
 
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel - 1;
-    geometry[iMGlevel]->SetControlVolume(geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGfine], config, UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    if (rigid) {
+      for (auto iPoint = 0ul; iPoint < geometry[iMGlevel]->GetnPoint(); iPoint++) {
+        const auto Coord = geometry[iMGlevel]->nodes->GetCoord(iPoint);
+        su2double newCoord[3] = {0.0, 0.0, 0.0};
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          newCoord[iDim] = rigidTranslation[iDim];
+          for (auto jDim = 0u; jDim < nDim; jDim++) newCoord[iDim] += rigidRotation[iDim][jDim] * Coord[jDim];
+        }
+        geometry[iMGlevel]->nodes->SetCoord(iPoint, newCoord);
+      }
+      geometry[iMGlevel]->SetRigidMotionControlVolume(config, rigidRotation);
+    } else {
+      geometry[iMGlevel]->SetControlVolume(geometry[iMGfine], UPDATE);
+      geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGfine], config, UPDATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    }
     if (config->GetGrid_Movement()) geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine]);
   }
+
+  /*--- The coarse grids are consistent with the fine grid again. ---*/
+
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    rigidTranslation[iDim] = 0.0;
+    for (auto jDim = 0u; jDim < 3; jDim++) rigidRotation[iDim][jDim] = su2double(iDim == jDim);
+  }
+  rigidMotionPending = false;
+  fullUpdatePending = false;
 }
 
 void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* config, bool UpdateGeo, bool Derivative,
                                                 bool ForwardProjectionDerivative) {
-  unsigned long Tot_Iter = 0;
+  unsigned long Tot_Iter = 0, Tot_Iter_Sum = 0;
   su2double MinVolume, MaxVolume;
 
   /*--- Retrieve number or iterations, tol, output, etc. from config ---*/
@@ -123,28 +182,61 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
 
   if (Derivative) Nonlinear_Iter = 1;
 
+  /*--- RBF interpolation of the boundary displacements (the derivatives are always
+   * computed with the elasticity equations). ---*/
+
+  if (!Derivative && config->GetKind_Deform_Method() == DEFORM_METHOD::RADIAL_BASIS_FUNCTION) {
+    SetVolume_Deformation_RBF(geometry, config, UpdateGeo);
+    return;
+  }
+
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
-   particular, the linear elasticity equations hold only for small deformations. ---*/
+   particular, the linear elasticity equations hold only for small deformations.
+   With adaptive increments, the first increment is 1/DEFORM_NONLINEAR_ITER of the
+   deformation, an increment that produces negative volumes is undone and halved,
+   otherwise the next increment is doubled, until all the deformation is imposed. ---*/
+
+  const bool Adaptive = !Derivative && config->GetDeform_Adaptive_Increment();
+  const auto Max_Subdivisions = config->GetDeform_Max_Subdivisions();
+
+  su2double Increment = 1.0 / su2double(config->GetGridDef_Nonlinear_Iter()), Remaining = 1.0;
+  unsigned short nSubdivisions = 0;
+  su2activematrix Coord_Old;
+
+  for (auto iNonlinear_Iter = 0ul; Adaptive ? (Remaining > 0.0) : (iNonlinear_Iter < Nonlinear_Iter);) {
+    if (Adaptive) {
+      if (Increment > Remaining - 1E-8) Increment = Remaining;
+      Coord_Old.resize(nPoint, nDim);
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+        for (auto iDim = 0u; iDim < nDim; iDim++) Coord_Old(iPoint, iDim) = geometry->nodes->GetCoord(iPoint, iDim);
+    }
 
-  for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
     /*--- Initialize vector and sparse matrix ---*/
 
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
 
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
-     elasticity equations (transfers element stiffnesses to point-to-point). ---*/
+     elasticity equations (transfers element stiffnesses to point-to-point).
+     With frozen stiffness this is done only once, only the r.h.s. changes, the
+     boundary rows are set again below but that does not change the matrix. ---*/
 
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    const bool reuseStiffness = config->GetDeform_Frozen_Stiffness() && stiffnessAssembled;
+
+    if (!reuseStiffness) {
+      StiffMatrix.SetValZero();
+      frozenMinVolume = SetFEAMethodContributions_Elem(geometry, config);
+      stiffnessAssembled = true;
+    }
+    MinVolume = frozenMinVolume;
 
     /*--- Set the boundary and volume displacements (as prescribed by the
      design variable perturbations controlling the surface shape)
      as a Dirichlet BC. ---*/
 
-    SetBoundaryDisplacements(geometry, config);
+    SetBoundaryDisplacements(geometry, config, Increment);
 
     /*--- Fix the location of any points in the domain, if requested. ---*/
 
@@ -166,10 +258,35 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
     CSysMatrixComms::Initiate(LinSysRes, geometry, config);
     CSysMatrixComms::Complete(LinSysRes, geometry, config);
 
+    /*--- Warm start, the prescribed displacements are the only nonzero entries of LinSysSol, the
+     previous solution is scaled to best fit them (least squares) and it is used as the initial
+     guess for the other entries. The tolerance is then relative to the r.h.s., which for a zero
+     initial guess is the same as relative to the initial residual. ---*/
+
+    const bool warmStart = !Derivative && config->GetDeform_Warm_Start();
+
+    if (warmStart && warmStartReady) {
+      su2double Dot[2] = {0.0, 0.0}, DotGlobal[2] = {0.0, 0.0};
+      for (auto i = 0ul; i < nPointDomain * nVar; i++) {
+        if (LinSysSol[i] == 0.0) continue;
+        Dot[0] += LinSysSol[i] * LinSysSol_Prev[i];
+        Dot[1] += LinSysSol_Prev[i] * LinSysSol_Prev[i];
+      }
+      SU2_MPI::Allreduce(Dot, DotGlobal, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+      const su2double Scale = (DotGlobal[1] > 0.0) ? DotGlobal[0] / DotGlobal[1] : su2double(0.0);
+      for (auto i = 0ul; i < nPoint * nVar; i++) {
+        if (LinSysSol[i] == 0.0) LinSysSol[i] = Scale * LinSysSol_Prev[i];
+      }
+    }
+
     /*--- Definition of the preconditioner matrix vector multiplication, and linear solver ---*/
 
     /*--- To keep legacy behavior ---*/
-    System.SetToleranceType(LinearToleranceType::RELATIVE);
+    System.SetToleranceType(warmStart ? LinearToleranceType::ABSOLUTE : LinearToleranceType::RELATIVE);
+
+    /*--- The preconditioner of a frozen matrix does not need to be rebuilt. ---*/
+    System.SetMatrixUnchanged(reuseStiffness && !Derivative);
 
     /*--- If we want no derivatives or the direct derivatives, we solve the system using the
      * normal matrix vector product and preconditioner. For the mesh sensitivities using
@@ -182,6 +299,13 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
       Tot_Iter = System.Solve_b(StiffMatrix, LinSysRes, LinSysSol, geometry, config);
     }
     su2double Residual = System.GetResidual();
+    Tot_Iter_Sum += Tot_Iter;
+
+    if (warmStart) {
+      if (!warmStartReady) LinSysSol_Prev.Initialize(nPoint, nPointDomain, nVar, 0.0);
+      LinSysSol_Prev = LinSysSol;
+      warmStartReady = true;
+    }
 
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
@@ -191,18 +315,33 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
     } else {
       UpdateGridCoord_Derivatives(geometry, config, ForwardProjectionDerivative);
     }
-    if (UpdateGeo) {
-      UpdateDualGrid(geometry, config);
-    }
 
     if (!Derivative) {
-      /*--- Check for failed deformation (negative volumes). ---*/
+      /*--- Check for failed deformation (negative volumes) and nonconvex elements, the check
+       stops early if the increment can still be subdivided. ---*/
+
+      const bool CanSubdivide = Adaptive && (nSubdivisions < Max_Subdivisions);
+      const auto nNegative = ComputeDeforming_Element_Quality(geometry, MinVolume, MaxVolume, CanSubdivide,
+                                                              Screen_Output && !CanSubdivide);
 
-      ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
+      /*--- Undo the increment and retry with half of it. ---*/
 
-      /*--- Calculate amount of nonconvex elements ---*/
+      if (CanSubdivide && nNegative != 0) {
+        for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+          for (auto iDim = 0u; iDim < nDim; iDim++) geometry->nodes->SetCoord(iPoint, iDim, Coord_Old(iPoint, iDim));
 
-      ComputenNonconvexElements(geometry, Screen_Output);
+        if (rank == MASTER_NODE && Screen_Output)
+          cout << "Increment of " << Increment << " produced " << nNegative << " negative volumes, subdividing."
+               << endl;
+
+        Increment *= 0.5;
+        nSubdivisions++;
+        continue;
+      }
+    }
+
+    if (UpdateGeo) {
+      UpdateDualGrid(geometry, config);
     }
 
     /*--- Set number of iterations in the mesh update. ---*/
@@ -210,61 +349,434 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
     Set_nIterMesh(Tot_Iter);
 
     if (rank == MASTER_NODE && Screen_Output) {
-      cout << "Non-linear iter.: " << iNonlinear_Iter + 1 << "/" << Nonlinear_Iter << ". Linear iter.: " << Tot_Iter
-           << ". ";
+      if (Adaptive)
+        cout << "Non-linear iter.: " << iNonlinear_Iter + 1 << ". Increment: " << Increment
+             << ". Linear iter.: " << Tot_Iter << ". ";
+      else
+        cout << "Non-linear iter.: " << iNonlinear_Iter + 1 << "/" << Nonlinear_Iter << ". Linear iter.: " << Tot_Iter
+             << ". ";
       if (nDim == 2)
         cout << "Min. area: " << MinVolume << ". Error: " << Residual << "." << endl;
       else
         cout << "Min. volume: " << MinVolume << ". Error: " << Residual << "." << endl;
     }
+
+    iNonlinear_Iter++;
+
+    /*--- The deformation of an increment that did not need to be subdivided is increased. ---*/
+
+    if (Adaptive) {
+      Remaining -= Increment;
+      if (nSubdivisions == 0) Increment *= 2.0;
+      nSubdivisions = 0;
+    }
+  }
+
+  if (rank == MASTER_NODE && Screen_Output && !Derivative) {
+    cout << "Total linear iter.: " << Tot_Iter_Sum;
+    if (config->GetDeform_Warm_Start()) cout << " (warm started)";
+    cout << "." << endl;
   }
 }
 
-void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, su2double& MinVolume,
-                                                          su2double& MaxVolume, bool Screen_Output) {
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+void CVolumetricMovement::SetVolume_Deformation_RBF(CGeometry* geometry, CConfig* config, bool UpdateGeo) {
+  const auto kindRBF = config->GetKind_Deform_RBF();
+  if (kindRBF != RADIAL_BASIS::WENDLAND_C2 && kindRBF != RADIAL_BASIS::GAUSSIAN &&
+      kindRBF != RADIAL_BASIS::INV_MULTI_QUADRIC) {
+    SU2_MPI::Error(
+        "DEFORM_METHOD= RBF requires a positive definite function (WENDLAND_C2, GAUSSIAN, INV_MULTI_QUADRIC).",
+        CURRENT_FUNCTION);
+  }
+  const bool compact = (kindRBF == RADIAL_BASIS::WENDLAND_C2);
+  const passivedouble greedyTol = SU2_TYPE::GetValue(config->GetDeform_RBF_GreedyTol());
+  const auto maxCenters = max<unsigned long>(1, config->GetDeform_RBF_MaxCenters());
 
-  if (rank == MASTER_NODE && Screen_Output) cout << "Computing volumes of the grid elements." << endl;
+  auto Screen_Output = config->GetDeform_Output();
+  if (config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) Screen_Output = false;
+  const auto Nonlinear_Iter = config->GetGridDef_Nonlinear_Iter();
 
-  MaxVolume = -1E22;
-  MinVolume = 1E22;
+  su2double MinVolume = 0.0, MaxVolume = 0.0;
 
-  /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
+  for (auto iNonlinear_Iter = 0ul; iNonlinear_Iter < Nonlinear_Iter; iNonlinear_Iter++) {
+    /*--- Prescribed displacements, the same as for the elasticity method. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+    LinSysSol.SetValZero();
+    LinSysRes.SetValZero();
+    SetBoundaryDisplacements(geometry, config, 1.0 / su2double(Nonlinear_Iter));
+    SetDomainDisplacements(geometry, config);
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+    /*--- Owned boundary points with imposed displacement (candidate centers). The symmetry planes
+     * are not included since they may slide, their normal displacement is imposed at the end. ---*/
+
+    vector<bool> isBound(nPoint, false);
+    vector<unsigned long> bndPoints;
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+      if (kindBC == SYMMETRY_PLANE || kindBC == SEND_RECEIVE || kindBC == INTERNAL_BOUNDARY) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (!geometry->nodes->GetDomain(iPoint) || isBound[iPoint]) continue;
+        isBound[iPoint] = true;
+        bndPoints.push_back(iPoint);
+      }
+    }
+    const auto nBnd = bndPoints.size();
+
+    su2passivematrix bndCoord(nBnd, nDim), bndDisp(nBnd, nDim);
+    for (auto i = 0ul; i < nBnd; ++i) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        bndCoord(i, iDim) = SU2_TYPE::GetValue(geometry->nodes->GetCoord(bndPoints[i], iDim));
+        bndDisp(i, iDim) = SU2_TYPE::GetValue(LinSysSol[bndPoints[i] * nDim + iDim]);
+      }
+    }
+
+    /*--- Maximum displacement, and bounding boxes of the moving and of all boundary points
+     * (the default radius is the size of the deforming surfaces). Packed as maxima. ---*/
+
+    const passivedouble big = numeric_limits<passivedouble>::max();
+    vector<passivedouble> bounds(1 + 4 * nDim), globalBounds(1 + 4 * nDim);
+    bounds[0] = 0.0;
+    for (auto iDim = 0u; iDim < 4 * nDim; iDim++) bounds[1 + iDim] = -big;
+    for (auto i = 0ul; i < nBnd; ++i) {
+      const auto disp = GeometryToolbox::Norm(int(nDim), bndDisp[i]);
+      bounds[0] = max(bounds[0], disp);
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const auto x = bndCoord(i, iDim);
+        bounds[1 + iDim] = max(bounds[1 + iDim], -x);
+        bounds[1 + nDim + iDim] = max(bounds[1 + nDim + iDim], x);
+        if (disp > 0) {
+          bounds[1 + 2 * nDim + iDim] = max(bounds[1 + 2 * nDim + iDim], -x);
+          bounds[1 + 3 * nDim + iDim] = max(bounds[1 + 3 * nDim + iDim], x);
+        }
+      }
+    }
+    SU2_MPI::Allreduce(bounds.data(), globalBounds.data(), bounds.size(), MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    const auto maxDisp = globalBounds[0];
+
+    passivedouble radius = SU2_TYPE::GetValue(config->GetDeform_RBF_Radius());
+    if (radius <= 0) {
+      passivedouble diagMoving = 0, diagAll = 0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        diagAll += pow(globalBounds[1 + nDim + iDim] + globalBounds[1 + iDim], 2);
+        diagMoving += pow(globalBounds[1 + 3 * nDim + iDim] + globalBounds[1 + 2 * nDim + iDim], 2);
+      }
+      radius = (diagMoving > EPS * diagAll) ? sqrt(diagMoving) : sqrt(diagAll);
+    }
+
+    /*--- Centers (replicated on all ranks), coefficients, and bins of size >= radius to only
+     * visit the centers in the neighborhood of a point when the function has compact support. ---*/
+
+    vector<passivedouble> centerCoord, centerDisp;
+    su2passivematrix coeffs;
+    unsigned long nCenters = 0, nRounds = 0;
+    passivedouble binOrigin[3] = {0.0}, binSize = 1.0, maxError = maxDisp;
+    unsigned long nBin[3] = {1, 1, 1};
+    vector<unsigned long> binStart, binCenters;
+
+    auto RBF = [&](passivedouble dist) {
+      return SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(kindRBF, radius, dist));
+    };
+
+    auto BuildBins = [&]() {
+      for (auto iDim = 0u; iDim < 3; iDim++) {
+        binOrigin[iDim] = 0.0;
+        nBin[iDim] = 1;
+      }
+      passivedouble extent[3] = {0.0};
+      if (compact) {
+        /*--- Limit the number of bins to the order of the number of centers. ---*/
+        const auto maxBinsPerDim = max<unsigned long>(1, pow(nCenters, 1.0 / nDim));
+        binSize = radius;
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          passivedouble lo = big, hi = -big;
+          for (auto i = 0ul; i < nCenters; ++i) {
+            lo = min(lo, centerCoord[i * nDim + iDim]);
+            hi = max(hi, centerCoord[i * nDim + iDim]);
+          }
+          binOrigin[iDim] = lo;
+          extent[iDim] = hi - lo;
+          binSize = max(binSize, extent[iDim] / maxBinsPerDim);
+        }
+        for (auto iDim = 0u; iDim < nDim; iDim++) nBin[iDim] = 1 + static_cast<unsigned long>(extent[iDim] / binSize);
+      }
+      auto BinOf = [&](unsigned long i) {
+        unsigned long idx[3] = {0, 0, 0};
+        if (compact) {
+          for (auto iDim = 0u; iDim < nDim; iDim++) {
+            const auto k = static_cast<unsigned long>((centerCoord[i * nDim + iDim] - binOrigin[iDim]) / binSize);
+            idx[iDim] = min(k, nBin[iDim] - 1);
+          }
+        }
+        return (idx[0] * nBin[1] + idx[1]) * nBin[2] + idx[2];
+      };
+      binStart.assign(nBin[0] * nBin[1] * nBin[2] + 1, 0);
+      for (auto i = 0ul; i < nCenters; ++i) ++binStart[BinOf(i) + 1];
+      for (auto iBin = 1ul; iBin < binStart.size(); ++iBin) binStart[iBin] += binStart[iBin - 1];
+      binCenters.resize(nCenters);
+      vector<unsigned long> fill(binStart.begin(), binStart.end() - 1);
+      for (auto i = 0ul; i < nCenters; ++i) binCenters[fill[BinOf(i)]++] = i;
+    };
+
+    auto Interpolate = [&](const passivedouble* coord, passivedouble* disp) {
+      for (auto iDim = 0u; iDim < nDim; iDim++) disp[iDim] = 0.0;
+      if (nCenters == 0) return;
+
+      long lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+      if (compact) {
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          const auto k = static_cast<long>(floor((coord[iDim] - binOrigin[iDim]) / binSize));
+          lo[iDim] = max<long>(k - 1, 0);
+          hi[iDim] = min<long>(k + 1, nBin[iDim] - 1);
+          if (lo[iDim] > hi[iDim]) return;
+        }
+      }
+      for (auto i = lo[0]; i <= hi[0]; ++i) {
+        for (auto j = lo[1]; j <= hi[1]; ++j) {
+          for (auto k = lo[2]; k <= hi[2]; ++k) {
+            const auto iBin = (i * nBin[1] + j) * nBin[2] + k;
+            for (auto c = binStart[iBin]; c < binStart[iBin + 1]; ++c) {
+              const auto iCenter = binCenters[c];
+              const auto dist = GeometryToolbox::Distance(int(nDim), coord, &centerCoord[iCenter * nDim]);
+              if (compact && dist >= radius) continue;
+              const auto phi = RBF(dist);
+              for (auto iDim = 0u; iDim < nDim; iDim++) disp[iDim] += phi * coeffs(iCenter, iDim);
+            }
+          }
+        }
+      }
+    };
+
+    /*--- Greedy selection of centers, the number of points added doubles every round to
+     * limit the number of factorizations of the kernel matrix. ---*/
+
+    vector<passivedouble> error(nBnd);
+    const int stride = 2 * nDim + 1;
+
+    while (maxDisp > 0 && nCenters < maxCenters) {
+      /*--- Interpolation error at the local boundary points. ---*/
+
+      SU2_OMP_PARALLEL {
+        SU2_OMP_FOR_DYN(256)
+        for (auto i = 0ul; i < nBnd; ++i) {
+          passivedouble disp[3] = {0.0};
+          Interpolate(bndCoord[i], disp);
+          for (auto iDim = 0u; iDim < nDim; iDim++) disp[iDim] -= bndDisp(i, iDim);
+          error[i] = GeometryToolbox::Norm(int(nDim), disp);
+        }
+        END_SU2_OMP_FOR
+      }
+      END_SU2_OMP_PARALLEL
+
+      /*--- Local candidates, the points with the largest error above the tolerance. ---*/
+
+      const auto nAdd = min(max<unsigned long>(1, nCenters), maxCenters - nCenters);
+
+      vector<unsigned long> order;
+      passivedouble localMax = 0.0;
+      for (auto i = 0ul; i < nBnd; ++i) {
+        localMax = max(localMax, error[i]);
+        if (error[i] > greedyTol * maxDisp) order.push_back(i);
       }
+      SU2_MPI::Allreduce(&localMax, &maxError, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+      const auto nLocal = min<unsigned long>(nAdd, order.size());
+      partial_sort(order.begin(), order.begin() + nLocal, order.end(),
+                   [&error](unsigned long a, unsigned long b) { return error[a] > error[b]; });
+
+      vector<passivedouble> sendBuf(nLocal * stride);
+      for (auto i = 0ul; i < nLocal; ++i) {
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          sendBuf[i * stride + iDim] = bndCoord(order[i], iDim);
+          sendBuf[i * stride + nDim + iDim] = bndDisp(order[i], iDim);
+        }
+        sendBuf[i * stride + 2 * nDim] = error[order[i]];
+      }
+
+      /*--- Gather the candidates of all ranks and select the global worst. ---*/
+
+      vector<int> recvCounts(size), displs(size);
+      const int sizeLocal = sendBuf.size();
+      SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+      displs[0] = 0;
+      for (int iRank = 1; iRank < size; ++iRank) displs[iRank] = displs[iRank - 1] + recvCounts[iRank - 1];
+      const auto sizeGlobal = displs[size - 1] + recvCounts[size - 1];
+
+      vector<passivedouble> recvBuf(sizeGlobal);
+      SU2_MPI::Allgatherv(sendBuf.data(), sizeLocal, MPI_DOUBLE, recvBuf.data(), recvCounts.data(), displs.data(),
+                          MPI_DOUBLE, SU2_MPI::GetComm());
+
+      vector<unsigned long> candidates(sizeGlobal / stride);
+      iota(candidates.begin(), candidates.end(), 0ul);
+      stable_sort(candidates.begin(), candidates.end(), [&recvBuf, stride](unsigned long a, unsigned long b) {
+        return recvBuf[a * stride + stride - 1] > recvBuf[b * stride + stride - 1];
+      });
+      if (candidates.empty()) break;
+      candidates.resize(min<unsigned long>(nAdd, candidates.size()));
+
+      for (const auto c : candidates) {
+        centerCoord.insert(centerCoord.end(), &recvBuf[c * stride], &recvBuf[c * stride] + nDim);
+        centerDisp.insert(centerDisp.end(), &recvBuf[c * stride + nDim], &recvBuf[c * stride + nDim] + nDim);
+      }
+      nCenters += candidates.size();
+      ++nRounds;
+
+      /*--- Solve for the coefficients of the new set of centers. ---*/
+
+      CSymmetricMatrix kernel(nCenters);
+      for (auto i = 0ul; i < nCenters; ++i)
+        for (auto j = 0ul; j <= i; ++j)
+          kernel(i, j) = RBF(GeometryToolbox::Distance(int(nDim), &centerCoord[i * nDim], &centerCoord[j * nDim]));
+      kernel.Invert(true);
+
+      su2passivematrix values(nCenters, nDim);
+      for (auto i = 0ul; i < nCenters; ++i)
+        for (auto iDim = 0u; iDim < nDim; iDim++) values(i, iDim) = centerDisp[i * nDim + iDim];
+      kernel.MatMatMult('L', values, coeffs);
+
+      BuildBins();
+    }
+
+    /*--- Evaluate the interpolant at all points (including halos, no communication is needed). ---*/
+
+    SU2_OMP_PARALLEL {
+      SU2_OMP_FOR_DYN(256)
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+        passivedouble coord[3] = {0.0}, disp[3] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          coord[iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+        Interpolate(coord, disp);
+        for (auto iDim = 0u; iDim < nDim; iDim++) LinSysSol[iPoint * nDim + iDim] = disp[iDim];
+      }
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+
+    /*--- The interpolation is not exact (greedy tolerance), impose the prescribed displacements
+     * again, this also removes the normal component of the displacement on symmetry planes. ---*/
+
+    SetBoundaryDisplacements(geometry, config, 1.0 / su2double(Nonlinear_Iter));
+    SetDomainDisplacements(geometry, config);
+
+    UpdateGridCoord(geometry, config);
+    if (UpdateGeo) {
+      UpdateDualGrid(geometry, config);
+    }
+
+    /*--- Check for failed deformation (negative volumes) and nonconvex elements. ---*/
+
+    ComputeDeforming_Element_Quality(geometry, MinVolume, MaxVolume, false, Screen_Output);
+
+    Set_nIterMesh(nRounds);
+
+    if (rank == MASTER_NODE && Screen_Output) {
+      cout << "Non-linear iter.: " << iNonlinear_Iter + 1 << "/" << Nonlinear_Iter << ". RBF centers: " << nCenters
+           << ". ";
+      if (nDim == 2)
+        cout << "Min. area: " << MinVolume;
+      else
+        cout << "Min. volume: " << MinVolume;
+      cout << ". Rel. boundary error: " << (maxDisp > 0 ? maxError / maxDisp : 0.0) << "." << endl;
     }
+  }
+}
 
-    /*--- 2D elements ---*/
+su2double CVolumetricMovement::GetElement_Volume(const CGeometry* geometry, unsigned long iElem) const {
+  unsigned short nNodes = 0;
+  su2double Volume = 0.0, CoordCorners[8][3];
 
-    if (nDim == 2) {
-      if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
-      if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
+  if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
+  if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+  if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
+  if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
+  if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
+  if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+
+  for (unsigned short iNodes = 0; iNodes < nNodes; iNodes++) {
+    const auto iPoint = geometry->elem[iElem]->GetNode(iNodes);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(iPoint, iDim);
     }
+  }
+
+  /*--- 2D elements ---*/
+
+  if (nDim == 2) {
+    if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
+    if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
+  }
+
+  /*--- 3D Elementes ---*/
+
+  if (nDim == 3) {
+    if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
+    if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
+    if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
+    if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
+  }
+
+  return Volume;
+}
 
-    /*--- 3D Elementes ---*/
+bool CVolumetricMovement::IsNonconvex_Element(const CGeometry* geometry, unsigned long iElem) const {
+  su2double minCrossProduct = 1.e6, maxCrossProduct = -1.e6;
 
-    if (nDim == 3) {
-      if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
-      if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
-      if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
-      if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
+  const auto nNodes = geometry->elem[iElem]->GetnNodes();
+
+  /*--- Get coordinates of corner points ---*/
+  unsigned short iNodes;
+  const su2double* CoordCorners[8];
+
+  for (iNodes = 0; iNodes < nNodes; iNodes++) {
+    CoordCorners[iNodes] = geometry->nodes->GetCoord(geometry->elem[iElem]->GetNode(iNodes));
+  }
+
+  /*--- Determine whether element is convex ---*/
+  for (iNodes = 0; iNodes < nNodes; iNodes++) {
+    /*--- Calculate minimum and maximum angle between edge vectors adjacent to each node ---*/
+    su2double edgeVector_i[3], edgeVector_j[3];
+
+    for (unsigned short iDim = 0; iDim < 2; iDim++) {
+      if (iNodes == 0) {
+        edgeVector_i[iDim] = CoordCorners[nNodes - 1][iDim] - CoordCorners[iNodes][iDim];
+      } else {
+        edgeVector_i[iDim] = CoordCorners[iNodes - 1][iDim] - CoordCorners[iNodes][iDim];
+      }
+
+      if (iNodes == nNodes - 1) {
+        edgeVector_j[iDim] = CoordCorners[0][iDim] - CoordCorners[iNodes][iDim];
+      } else {
+        edgeVector_j[iDim] = CoordCorners[iNodes + 1][iDim] - CoordCorners[iNodes][iDim];
+      }
     }
 
+    /*--- Calculate cross product of edge vectors ---*/
+    su2double crossProduct;
+    crossProduct = edgeVector_i[1] * edgeVector_j[0] - edgeVector_i[0] * edgeVector_j[1];
+
+    if (crossProduct < minCrossProduct) minCrossProduct = crossProduct;
+    if (crossProduct > maxCrossProduct) maxCrossProduct = crossProduct;
+  }
+
+  /*--- Element is nonconvex if cross product of at least one set of adjacent edges is negative ---*/
+  return (minCrossProduct < 0 && maxCrossProduct > 0);
+}
+
+void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, su2double& MinVolume,
+                                                          su2double& MaxVolume, bool Screen_Output) {
+  unsigned long iElem, ElemCounter = 0;
+  su2double Volume = 0.0;
+  bool RightVol = true;
+
+  if (rank == MASTER_NODE && Screen_Output) cout << "Computing volumes of the grid elements." << endl;
+
+  MaxVolume = -1E22;
+  MinVolume = 1E22;
+
+  /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    Volume = GetElement_Volume(geometry, iElem);
+
     RightVol = true;
     if (Volume < 0.0) RightVol = false;
 
@@ -299,77 +811,84 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, s
 }
 
 void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Screen_Output) {
-  unsigned long iElem;
-  unsigned short iDim;
   unsigned long nNonconvexElements = 0;
 
   /*--- Load up each tetrahedron to check for convex properties. ---*/
   if (nDim == 2) {
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-      su2double minCrossProduct = 1.e6, maxCrossProduct = -1.e6;
+    for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+      if (IsNonconvex_Element(geometry, iElem)) nNonconvexElements++;
+    }
+  } else if (rank == MASTER_NODE) {
+    cout << "\nWARNING: Convexity is not checked for 3D elements (issue #1171).\n" << endl;
+  }
 
-      const auto nNodes = geometry->elem[iElem]->GetnNodes();
+  unsigned long nNonconvexElements_Local = nNonconvexElements;
+  nNonconvexElements = 0;
+  SU2_MPI::Allreduce(&nNonconvexElements_Local, &nNonconvexElements, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
-      /*--- Get coordinates of corner points ---*/
-      unsigned short iNodes;
-      unsigned long PointCorners[8];
-      const su2double* CoordCorners[8];
+  /*--- Set number of nonconvex elements in geometry ---*/
+  geometry->SetnNonconvexElements(nNonconvexElements);
+}
 
-      for (iNodes = 0; iNodes < nNodes; iNodes++) {
-        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-        CoordCorners[iNodes] = geometry->nodes->GetCoord(PointCorners[iNodes]);
-      }
+unsigned long CVolumetricMovement::ComputeDeforming_Element_Quality(CGeometry* geometry, su2double& MinVolume,
+                                                                   su2double& MaxVolume, bool EarlyExit,
+                                                                   bool Screen_Output) {
+  /*--- Volumes and convexity are checked in the same pass over the elements. With early exit the
+   *    pass stops at the first negative volume, then only the number of negative elements is valid. ---*/
 
-      /*--- Determine whether element is convex ---*/
-      for (iNodes = 0; iNodes < nNodes; iNodes++) {
-        /*--- Calculate minimum and maximum angle between edge vectors adjacent to each node ---*/
-        su2double edgeVector_i[3], edgeVector_j[3];
+  if (rank == MASTER_NODE && Screen_Output) cout << "Computing volumes of the grid elements." << endl;
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          if (iNodes == 0) {
-            edgeVector_i[iDim] = CoordCorners[nNodes - 1][iDim] - CoordCorners[iNodes][iDim];
-          } else {
-            edgeVector_i[iDim] = CoordCorners[iNodes - 1][iDim] - CoordCorners[iNodes][iDim];
-          }
+  unsigned long Counter[2] = {0, 0};  // negative volume, nonconvex
+  su2double MinMaxVolume[2] = {1E22, 1E22};  // min, -max
 
-          if (iNodes == nNodes - 1) {
-            edgeVector_j[iDim] = CoordCorners[0][iDim] - CoordCorners[iNodes][iDim];
-          } else {
-            edgeVector_j[iDim] = CoordCorners[iNodes + 1][iDim] - CoordCorners[iNodes][iDim];
-          }
-        }
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+    const su2double Volume = GetElement_Volume(geometry, iElem);
 
-        /*--- Calculate cross product of edge vectors ---*/
-        su2double crossProduct;
-        crossProduct = edgeVector_i[1] * edgeVector_j[0] - edgeVector_i[0] * edgeVector_j[1];
+    MinMaxVolume[0] = min(MinMaxVolume[0], Volume);
+    MinMaxVolume[1] = min(MinMaxVolume[1], -Volume);
+    geometry->elem[iElem]->SetVolume(Volume);
 
-        if (crossProduct < minCrossProduct) minCrossProduct = crossProduct;
-        if (crossProduct > maxCrossProduct) maxCrossProduct = crossProduct;
-      }
+    if (nDim == 2 && IsNonconvex_Element(geometry, iElem)) Counter[1]++;
 
-      /*--- Element is nonconvex if cross product of at least one set of adjacent edges is negative ---*/
-      if (minCrossProduct < 0 && maxCrossProduct > 0) {
-        nNonconvexElements++;
-      }
+    if (Volume < 0.0) {
+      Counter[0]++;
+      if (EarlyExit) break;
     }
-  } else if (rank == MASTER_NODE) {
-    cout << "\nWARNING: Convexity is not checked for 3D elements (issue #1171).\n" << endl;
   }
 
-  unsigned long nNonconvexElements_Local = nNonconvexElements;
-  nNonconvexElements = 0;
-  SU2_MPI::Allreduce(&nNonconvexElements_Local, &nNonconvexElements, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  unsigned long Counter_Local[2] = {Counter[0], Counter[1]};
+  SU2_MPI::Allreduce(Counter_Local, Counter, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (EarlyExit && Counter[0] != 0) return Counter[0];
+
+  su2double MinMaxVolume_Local[2] = {MinMaxVolume[0], MinMaxVolume[1]};
+  SU2_MPI::Allreduce(MinMaxVolume_Local, MinMaxVolume, 2, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  MinVolume = MinMaxVolume[0];
+  MaxVolume = -MinMaxVolume[1];
+
+  /*--- Volume from  0 to 1 ---*/
+
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+    geometry->elem[iElem]->SetVolume(geometry->elem[iElem]->GetVolume() / MaxVolume);
+  }
+
+  if ((Counter[0] != 0) && (rank == MASTER_NODE) && (Screen_Output))
+    cout << "There are " << Counter[0] << " elements with negative volume.\n" << endl;
+
+  if (nDim == 3 && rank == MASTER_NODE)
+    cout << "\nWARNING: Convexity is not checked for 3D elements (issue #1171).\n" << endl;
 
   /*--- Set number of nonconvex elements in geometry ---*/
-  geometry->SetnNonconvexElements(nNonconvexElements);
+  geometry->SetnNonconvexElements(Counter[1]);
+
+  return Counter[0];
 }
 
 void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfig* config, su2double& MinDistance,
                                                      su2double& MaxDistance) const {
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
   su2double dist, MaxDistance_Local, MinDistance_Local;
-  int rankID;
 
   /*--- Initialize min and max distance ---*/
 
@@ -421,8 +940,16 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfi
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
-      WallADT.DetermineNearestNode(geometry->nodes->GetCoord(iPoint), dist, pointID, rankID);
+    const auto nPoint = geometry->GetnPoint();
+    vector<su2double> wallDist(nPoint);
+    vector<unsigned long> wallPointID(nPoint);
+    vector<int> wallRankID(nPoint);
+
+    WallADT.DetermineNearestNodes(nPoint, geometry->nodes->GetCoord().data(), nDim, wallDist.data(),
+                                  wallPointID.data(), wallRankID.data());
+
+    for (iPoint = 0; iPoint < nPoint; ++iPoint) {
+      dist = wallDist[iPoint];
       geometry->nodes->SetWall_Distance(iPoint, dist);
 
       MaxDistance = max(MaxDistance, dist);
@@ -1642,10 +2169,10 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
   delete[] StiffMatrix_Node;
 }
 
-void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig* config) {
+void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig* config, su2double VarIncrement) {
   unsigned short iDim, nDim = geometry->GetnDim(), iMarker, axis = 0;
   unsigned long iPoint, total_index, iVertex;
-  su2double *VarCoord, MeanCoord[3] = {0.0, 0.0, 0.0}, VarIncrement = 1.0;
+  su2double *VarCoord, MeanCoord[3] = {0.0, 0.0, 0.0};
 
   /*--- Get the SU2 module. SU2_CFD will use this routine for dynamically
    deforming meshes (MARKER_MOVING), while SU2_DEF will use it for deforming
@@ -1653,12 +2180,6 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig*
 
   SU2_COMPONENT Kind_SU2 = config->GetKind_SU2();
 
-  /*--- If requested (no by default) impose the surface deflections in
-   increments and solve the grid deformation equations iteratively with
-   successive small deformations. ---*/
-
-  VarIncrement = 1.0 / ((su2double)config->GetGridDef_Nonlinear_Iter());
-
   /*--- As initialization, set to zero displacements of all the surfaces except the symmetry
    plane (which is treated specially, see below), internal and the send-receive boundaries ---*/
 
@@ -2061,9 +2582,13 @@ void CVolumetricMovement::Rigid_Rotation(CGeometry* geometry, CConfig* config, u
     config->SetRefOriginMoment_Z(jMarker, Center[2] + rotCoord[2]);
   }
 
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class (the motion is not rigid if the coordinates are scaled). ---*/
 
-  UpdateDualGrid(geometry, config);
+  const su2double noTranslation[3] = {0.0, 0.0, 0.0};
+  if (Lref == 1.0)
+    UpdateDualGrid_Rigid(geometry, config, rotMatrix, Center, noTranslation);
+  else
+    UpdateDualGrid(geometry, config);
 }
 
 void CVolumetricMovement::Rigid_Pitching(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2207,9 +2732,13 @@ void CVolumetricMovement::Rigid_Pitching(CGeometry* geometry, CConfig* config, u
 
   /*--- For pitching we don't update the motion origin and moment reference origin. ---*/
 
-  /*--- After moving all nodes, update geometry class ---*/
+  /*--- After moving all nodes, update geometry class (the motion is not rigid if the coordinates are scaled). ---*/
 
-  UpdateDualGrid(geometry, config);
+  const su2double noTranslation[3] = {0.0, 0.0, 0.0};
+  if (Lref == 1.0)
+    UpdateDualGrid_Rigid(geometry, config, rotMatrix, Center, noTranslation);
+  else
+    UpdateDualGrid(geometry, config);
 }
 
 void CVolumetricMovement::Rigid_Plunging(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2337,7 +2866,8 @@ void CVolumetricMovement::Rigid_Plunging(CGeometry* geometry, CConfig* config, u
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  const su2double identity[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  UpdateDualGrid_Rigid(geometry, config, identity, Center, deltaX);
 }
 
 void CVolumetricMovement::Rigid_Translation(CGeometry* geometry, CConfig* config, unsigned short iZone,
@@ -2447,7 +2977,8 @@ void CVolumetricMovement::Rigid_Translation(CGeometry* geometry, CConfig* config
 
   /*--- After moving all nodes, update geometry class ---*/
 
-  UpdateDualGrid(geometry, config);
+  const su2double identity[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  UpdateDualGrid_Rigid(geometry, config, identity, Center, deltaX);
 }
 
 void CVolumetricMovement::SetVolume_Scaling(CGeometry* geometry, CConfig* config, bool UpdateGeo) {
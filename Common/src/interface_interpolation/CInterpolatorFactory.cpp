@@ -75,6 +75,11 @@ CInterpolator* CreateInterpolator(CGeometry**** geometry_container, const CConfi
         interpolator = new CRadialBasisFunction(geometry_container, config, iZone, jZone);
         break;
 
+      case INTERFACE_INTERPOLATOR::LOCAL_RADIAL_BASIS_FUNCTION:
+        if (verbose) cout << "using a local radial basis function approach." << endl;
+        interpolator = new CRadialBasisFunction(geometry_container, config, iZone, jZone, true);
+        break;
+
       default:
         SU2_MPI::Error("Unknown type of interpolation.", CURRENT_FUNCTION);
     }
@@ -30,6 +30,8 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+#include <numeric>
 #include <unordered_map>
 
 using namespace GeometryToolbox;
@@ -47,6 +49,8 @@ void CIsoparametric::PrintStatistics() const {
 }
 
 void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
+  ++nUpdates;
+
   const su2double matchingVertexTol = 1e-12;  // 1um^2
 
   const int nProcessor = size;
@@ -58,6 +62,10 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
   /*--- Make space for donor info. ---*/
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  prevDonorPoint.resize(config[targetZone]->GetnMarker_All());
+  prevDonorCoord.resize(config[targetZone]->GetnMarker_All());
+  prevTargetCoord.resize(config[targetZone]->GetnMarker_All());
+  prevDonor.resize(config[targetZone]->GetnMarker_All());
 
   /*--- Init stats. ---*/
   MaxDistance = 0.0;
@@ -148,6 +156,93 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
       }
     }
 
+    /*--- The donor elements found in the previous update are reused for target vertices that did not move,
+     *    if the donor vertices did not change either (static interfaces). ---*/
+
+    bool staticInterface = (markTarget != -1) && (prevDonorPoint[markTarget] == donorPoint) &&
+                           (prevTargetCoord[markTarget].rows() == nVertexTarget);
+
+    for (auto iVertex = 0ul; staticInterface && iVertex < nGlobalVertexDonor; ++iVertex) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        staticInterface &= (donorCoord(iVertex, iDim) == prevDonorCoord[markTarget](iVertex, iDim));
+    }
+    if (markTarget != -1 && !staticInterface) {
+      prevTargetCoord[markTarget].resize(nVertexTarget, nDim);
+      prevDonor[markTarget].clear();
+      prevDonor[markTarget].resize(nVertexTarget);
+    }
+
+    /*--- Gather the target vertices that need to be searched, and find their closest donor vertex with
+     *    a batched ADT query (queries are sorted spatially to traverse similar parts of the tree). ---*/
+
+    vector<unsigned long> searchVertex;
+    vector<su2double> searchCoord;
+
+    for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
+      bool moved = !staticInterface;
+      for (auto iDim = 0u; !moved && iDim < nDim; ++iDim)
+        moved = (coord_i[iDim] != prevTargetCoord[markTarget](iVertexTarget, iDim));
+
+      if (moved) {
+        searchVertex.push_back(iVertexTarget);
+        searchCoord.insert(searchCoord.end(), coord_i, coord_i + nDim);
+      }
+    }
+
+    const auto nSearch = searchVertex.size();
+    vector<unsigned long> closestVertex(nSearch);
+    vector<su2double> closestDist(nSearch);
+
+    if (nSearch > 0) {
+      vector<unsigned long> donorIdx(nGlobalVertexDonor);
+      iota(donorIdx.begin(), donorIdx.end(), 0ul);
+      CADTPointsOnlyClass donorADT(nDim, nGlobalVertexDonor, donorCoord.data(), donorIdx.data(), false);
+
+      vector<int> closestRank(nSearch);
+      donorADT.DetermineNearestNodes(nSearch, searchCoord.data(), nDim, closestDist.data(), closestVertex.data(),
+                                     closestRank.data());
+    }
+    for (auto i = 0ul; i < nSearch; ++i) prevDonor[markTarget][searchVertex[i]].searched = true;
+
+    /*--- Evaluate the interpolation of a target point from a donor element. ---*/
+    auto EvaluateCandidate = [&](unsigned iElem, const su2double* coord_i) {
+      DonorInfo candidate;
+      candidate.iElem = iElem;
+      const auto nNode = elemNumNodes[iElem];
+      su2double coords[4][3] = {{0.0}};
+
+      for (auto iNode = 0u; iNode < nNode; ++iNode) {
+        const auto iVertex = elemIdxNodes(iElem, iNode);
+        for (auto iDim = 0u; iDim < nDim; ++iDim) coords[iNode][iDim] = donorCoord(iVertex, iDim);
+      }
+
+      /*--- Compute the interpolation coefficients. ---*/
+      switch (nNode) {
+        case 2:
+          candidate.error = LineIsoparameters(coords, coord_i, candidate.isoparams);
+          break;
+        case 3:
+          candidate.error = TriangleIsoparameters(coords, coord_i, candidate.isoparams);
+          break;
+        case 4:
+          candidate.error = QuadrilateralIsoparameters(coords, coord_i, candidate.isoparams);
+          break;
+      }
+
+      /*--- Evaluate distance from target to final mapped point. ---*/
+      su2double finalCoord[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        for (auto iNode = 0u; iNode < nNode; ++iNode)
+          finalCoord[iDim] += coords[iNode][iDim] * candidate.isoparams[iNode];
+
+      candidate.distance = Distance(nDim, coord_i, finalCoord);
+      return candidate;
+    };
+
     /*--- Compute transfer coefficients for each target point. ---*/
     SU2_OMP_PARALLEL {
       su2double maxDist = 0.0;
@@ -156,6 +251,7 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
       SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget, 2 * omp_get_max_threads()))
       for (auto iVertexTarget = 0u; iVertexTarget < nVertexTarget; ++iVertexTarget) {
         auto& target_vertex = targetVertices[markTarget][iVertexTarget];
+        auto& cached = prevDonor[markTarget][iVertexTarget];
         const auto iPoint = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
 
         if (!target_geometry->nodes->GetDomain(iPoint)) continue;
@@ -163,73 +259,55 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
         /*--- Coordinates of the target point. ---*/
         const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
+        for (auto iDim = 0u; iDim < nDim; ++iDim) prevTargetCoord[markTarget](iVertexTarget, iDim) = coord_i[iDim];
 
-        /*--- Find the closest donor vertex. ---*/
-        su2double minDist = 1e9;
-        unsigned iClosestVertex = 0;
-        for (auto iVertexDonor = 0u; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-          su2double d = SquaredDistance(nDim, coord_i, donorCoord[iVertexDonor]);
-          if (d < minDist) {
-            minDist = d;
-            iClosestVertex = iVertexDonor;
-          }
-        }
-
-        if (minDist < matchingVertexTol) {
-          /*--- Perfect match. ---*/
-          target_vertex.resize(1);
-          target_vertex.coefficient[0] = 1.0;
-          target_vertex.globalPoint[0] = donorPoint[iClosestVertex];
-          target_vertex.processor[0] = donorProc[iClosestVertex];
-          continue;
-        }
-
-        /*--- Evaluate interpolation for the elements connected to the closest vertex. ---*/
         DonorInfo donor;
         donor.error = 2;
         donor.distance = 1e9;
-        for (auto iElem : vertexElements[iClosestVertex]) {
-          /*--- Fetch element info. ---*/
-          DonorInfo candidate;
-          candidate.iElem = iElem;
-          const auto nNode = elemNumNodes[iElem];
-          su2double coords[4][3] = {{0.0}};
-
-          for (auto iNode = 0u; iNode < nNode; ++iNode) {
-            const auto iVertex = elemIdxNodes(iElem, iNode);
-            for (auto iDim = 0u; iDim < nDim; ++iDim) coords[iNode][iDim] = donorCoord(iVertex, iDim);
-          }
 
-          /*--- Compute the interpolation coefficients. ---*/
-          switch (nNode) {
-            case 2:
-              candidate.error = LineIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
-            case 3:
-              candidate.error = TriangleIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
-            case 4:
-              candidate.error = QuadrilateralIsoparameters(coords, coord_i, candidate.isoparams);
-              break;
+        if (!cached.searched) {
+          /*--- Static target, the coefficients are recomputed for the cached donor (to keep the
+           *    dependency on the coordinates for AD), the result is the same as for a new search. ---*/
+          if (cached.match) {
+            target_vertex.coefficient[0] = 1.0;
+            continue;
+          }
+          donor = EvaluateCandidate(cached.iElem, coord_i);
+        } else {
+          cached.searched = false;
+          cached.match = false;
+
+          /*--- Closest donor vertex, from the batched search. ---*/
+          const auto iSearch = lower_bound(searchVertex.begin(), searchVertex.end(), iVertexTarget) -
+                               searchVertex.begin();
+          const auto iClosestVertex = closestVertex[iSearch];
+
+          if (closestDist[iSearch] * closestDist[iSearch] < matchingVertexTol) {
+            /*--- Perfect match. ---*/
+            cached.match = true;
+            target_vertex.resize(1);
+            target_vertex.coefficient[0] = 1.0;
+            target_vertex.globalPoint[0] = donorPoint[iClosestVertex];
+            target_vertex.processor[0] = donorProc[iClosestVertex];
+            continue;
           }
 
-          /*--- Evaluate distance from target to final mapped point. ---*/
-          su2double finalCoord[3] = {0.0};
-          for (auto iDim = 0u; iDim < nDim; ++iDim)
-            for (auto iNode = 0u; iNode < nNode; ++iNode)
-              finalCoord[iDim] += coords[iNode][iDim] * candidate.isoparams[iNode];
-
-          candidate.distance = Distance(nDim, coord_i, finalCoord);
+          /*--- Evaluate interpolation for the elements connected to the closest vertex. ---*/
+          for (auto iElem : vertexElements[iClosestVertex]) {
+            const auto candidate = EvaluateCandidate(iElem, coord_i);
 
-          /*--- Detect a very bad candidate (NaN). ---*/
-          if (candidate.distance != candidate.distance) continue;
+            /*--- Detect a very bad candidate (NaN). ---*/
+            if (candidate.distance != candidate.distance) continue;
 
-          /*--- Check if the candidate is an improvement, update donor if so. ---*/
-          if (candidate < donor) donor = candidate;
+            /*--- Check if the candidate is an improvement, update donor if so. ---*/
+            if (candidate < donor) donor = candidate;
+          }
         }
 
-        if (donor.error > 1) SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
+        if (donor.error > 1 || donor.distance != donor.distance)
+          SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
 
+        cached.iElem = donor.iElem;
         errorCount += donor.error;
         maxDist = max(maxDist, donor.distance);
 
@@ -254,6 +332,12 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     }
     END_SU2_OMP_PARALLEL
 
+    /*--- Store the donor vertices for the next update. ---*/
+    if (markTarget != -1) {
+      prevDonorPoint[markTarget] = donorPoint;
+      prevDonorCoord[markTarget] = donorCoord;
+    }
+
   }  // end nMarkerInt loop
 
   /*--- Final reduction of statistics. ---*/
@@ -44,6 +44,8 @@ CMirror::CMirror(CGeometry**** geometry_container, const CConfig* const* config,
 }
 
 void CMirror::SetTransferCoeff(const CConfig* const* config) {
+  ++nUpdates;
+
   const int nProcessor = size;
 
   vector<unsigned long> allNumVertexTarget(nProcessor);
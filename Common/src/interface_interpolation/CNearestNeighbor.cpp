@@ -42,6 +42,8 @@ void CNearestNeighbor::PrintStatistics() const {
 }
 
 void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
+  ++nUpdates;
+
   /*--- Desired number of donor points. ---*/
   const auto nDonor = max<unsigned long>(config[donorZone]->GetNumNearestNeighbors(), 1);
 
@@ -55,6 +57,10 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   Buffer_Receive_nVertex_Donor = new unsigned long[nProcessor];
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  prevDonorPoint.resize(config[targetZone]->GetnMarker_All());
+  prevDonorCoord.resize(config[targetZone]->GetnMarker_All());
+  prevTargetCoord.resize(config[targetZone]->GetnMarker_All());
+  nextDonorDist.resize(config[targetZone]->GetnMarker_All());
 
   vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
 
@@ -92,6 +98,32 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     /*--- Collect coordinates and global point indices. ---*/
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
 
+    /*--- Possible donors sorted by global index, to find the previous donors and to compare with the
+     *    previous update, which is reused if the possible donors and the target vertices are the same. ---*/
+    vector<pair<unsigned long, unsigned long> > sortedDonors;
+    sortedDonors.reserve(nPossibleDonor);
+    for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+      for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
+        const auto idx = iProcessor * MaxLocalVertex_Donor + jVertex;
+        sortedDonors.emplace_back(Buffer_Receive_GlobalPoint[idx], idx);
+      }
+    }
+    sort(sortedDonors.begin(), sortedDonors.end());
+
+    bool incremental = (markTarget != -1) && (prevDonorPoint[markTarget].size() == nPossibleDonor) &&
+                       (prevTargetCoord[markTarget].rows() == nVertexTarget);
+    su2double maxDonorDisp = 0.0;
+
+    for (auto iDonor = 0ul; incremental && iDonor < nPossibleDonor; ++iDonor) {
+      incremental = (prevDonorPoint[markTarget][iDonor] == sortedDonors[iDonor].first);
+      const su2double* Coord_j = Buffer_Receive_Coord[sortedDonors[iDonor].second];
+      maxDonorDisp = max(maxDonorDisp, GeometryToolbox::Distance(nDim, prevDonorCoord[markTarget][iDonor], Coord_j));
+    }
+    if (markTarget != -1 && !incremental) {
+      prevTargetCoord[markTarget].resize(nVertexTarget, nDim);
+      nextDonorDist[markTarget].resize(nVertexTarget);
+    }
+
     /*--- Find the closest donor points to each target. ---*/
     SU2_OMP_PARALLEL {
       /*--- Working array for this thread. ---*/
@@ -111,24 +143,56 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
         /*--- Coordinates of the target point. ---*/
         const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
 
-        /*--- Compute all distances. ---*/
-        for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-          for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-            const auto idx = iProcessor * MaxLocalVertex_Donor + jVertex;
-            const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-            const su2double* Coord_j = Buffer_Receive_Coord[idx];
-            const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
+        su2double* prevCoord_i = prevTargetCoord[markTarget][iVertexTarget];
+        auto& nextDist = nextDonorDist[markTarget][iVertexTarget];
+
+        /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
+        auto closer = [](const DonorInfo& a, const DonorInfo& b) {
+          return (a.dist != b.dist) ? (a.dist < b.dist) : (a.pidx < b.pidx);
+        };
+
+        /*--- Keep the previous donors if they are still closer than a lower bound
+         *    for the distance to the other points (see class notes). ---*/
+        bool keep = false;
+        if (incremental && target_vertex.nDonor() == nDonor) {
+          const su2double bound = nextDist - GeometryToolbox::Distance(nDim, Coord_i, prevCoord_i) - maxDonorDisp;
+          su2double maxDist2 = 0.0;
+
+          for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+            const auto pGlobalPoint = target_vertex.globalPoint[iDonor];
+            const auto it = lower_bound(sortedDonors.begin(), sortedDonors.end(), make_pair(pGlobalPoint, 0ul));
+            const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Buffer_Receive_Coord[it->second]);
+            donorInfo[iDonor] = DonorInfo(dist2, pGlobalPoint, it->second / MaxLocalVertex_Donor);
+            maxDist2 = max(maxDist2, dist2);
+          }
+          keep = (bound > 0.0) && (maxDist2 < bound * bound);
 
-            donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
+          if (keep) {
+            sort(donorInfo.begin(), donorInfo.begin() + nDonor, closer);
+            nextDist = bound;
           }
         }
 
-        /*--- Find k closest points. ---*/
-        partial_sort(donorInfo.begin(), donorInfo.begin() + nDonor, donorInfo.end(),
-                     [](const DonorInfo& a, const DonorInfo& b) {
-                       /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-                       return (a.dist != b.dist) ? (a.dist < b.dist) : (a.pidx < b.pidx);
-                     });
+        if (!keep) {
+          /*--- Compute all distances. ---*/
+          for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
+            for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
+              const auto idx = iProcessor * MaxLocalVertex_Donor + jVertex;
+              const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
+              const su2double* Coord_j = Buffer_Receive_Coord[idx];
+              const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
+
+              donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
+            }
+          }
+
+          /*--- Find k closest points, and the next one which bounds the distance to the others. ---*/
+          const auto nSort = min(nDonor + 1, nPossibleDonor);
+          partial_sort(donorInfo.begin(), donorInfo.begin() + nSort, donorInfo.end(), closer);
+
+          nextDist = (nSort > nDonor) ? sqrt(donorInfo[nDonor].dist) : su2double(numeric_limits<passivedouble>::max());
+        }
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) prevCoord_i[iDim] = Coord_i[iDim];
 
         /*--- Update stats. ---*/
         numTarget += 1;
@@ -161,6 +225,17 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
       END_SU2_OMP_CRITICAL
     }
     END_SU2_OMP_PARALLEL
+
+    /*--- Store the possible donors for the next update. ---*/
+    if (markTarget != -1) {
+      prevDonorPoint[markTarget].resize(nPossibleDonor);
+      prevDonorCoord[markTarget].resize(nPossibleDonor, nDim);
+      for (auto iDonor = 0ul; iDonor < nPossibleDonor; ++iDonor) {
+        prevDonorPoint[markTarget][iDonor] = sortedDonors[iDonor].first;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          prevDonorCoord[markTarget](iDonor, iDim) = Buffer_Receive_Coord(sortedDonors[iDonor].second, iDim);
+      }
+    }
   }
 
   delete[] Buffer_Receive_nVertex_Donor;
@@ -45,8 +45,8 @@ extern "C" void dgemm_(const char*, const char*, const int*, const int*, const i
 #endif
 
 CRadialBasisFunction::CRadialBasisFunction(CGeometry**** geometry_container, const CConfig* const* config,
-                                           unsigned int iZone, unsigned int jZone)
-    : CInterpolator(geometry_container, config, iZone, jZone) {
+                                           unsigned int iZone, unsigned int jZone, bool local)
+    : CInterpolator(geometry_container, config, iZone, jZone), localSystems(local) {
   SetTransferCoeff(config);
 }
 
@@ -98,12 +98,81 @@ su2double CRadialBasisFunction::Get_RadialBasisValue(RADIAL_BASIS type, const su
   return rbf;
 }
 
+namespace {
+/*!
+ * \brief Bins the donor points of an interface in cubes of the size of the RBF radius, to find
+ *        the donors that are near a target point without visiting all of them.
+ */
+class CDonorBins {
+  static constexpr int nBits = 21;
+  int nDim = 0;
+  su2double origin[3] = {0.0}, invSize = 0.0;
+  vector<pair<uint64_t, unsigned long> > bins; /*!< \brief (Bin key, donor) sorted by key. */
+
+  uint64_t Key(const long* idx) const {
+    uint64_t key = 0;
+    for (int iDim = 0; iDim < nDim; ++iDim) key = (key << nBits) | uint64_t(idx[iDim]);
+    return key;
+  }
+
+  void Index(const su2double* coord, long* idx) const {
+    constexpr long maxIdx = (1l << nBits) - 1;
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue((coord[iDim] - origin[iDim]) * invSize);
+      idx[iDim] = static_cast<long>(max(-1.0, min(passivedouble(maxIdx), floor(x))));
+    }
+  }
+
+ public:
+  CDonorBins() = default;
+
+  CDonorBins(const su2activematrix& coords, su2double size) : nDim(coords.cols()), invSize(1 / size) {
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      origin[iDim] = coords.rows() ? coords(0, iDim) : 0.0;
+      for (auto iPoint = 0ul; iPoint < coords.rows(); ++iPoint) origin[iDim] = min(origin[iDim], coords(iPoint, iDim));
+    }
+    bins.resize(coords.rows());
+    long idx[3];
+    for (auto iPoint = 0ul; iPoint < coords.rows(); ++iPoint) {
+      Index(coords[iPoint], idx);
+      bins[iPoint] = make_pair(Key(idx), iPoint);
+    }
+    sort(bins.begin(), bins.end());
+  }
+
+  /*!
+   * \brief Call "f" for the donors in the bin of "coord" and in its neighbors, i.e. for a
+   *        superset of the donors closer to "coord" than the size of the bins.
+   */
+  template <class F>
+  void ForEachNear(const su2double* coord, F&& f) const {
+    long center[3], idx[3] = {0};
+    Index(coord, center);
+    const int nNeighbors = (nDim == 3) ? 27 : 9;
+    for (int iNeighbor = 0; iNeighbor < nNeighbors; ++iNeighbor) {
+      bool valid = true;
+      for (int iDim = 0, code = iNeighbor; iDim < nDim; ++iDim, code /= 3) {
+        idx[iDim] = center[iDim] + code % 3 - 1;
+        valid &= (idx[iDim] >= 0) && (idx[iDim] < (1l << nBits));
+      }
+      if (!valid) continue;
+      const auto key = Key(idx);
+      auto it = lower_bound(bins.begin(), bins.end(), make_pair(key, 0ul));
+      for (; it != bins.end() && it->first == key; ++it) f(it->second);
+    }
+  }
+};
+}  // namespace
+
 void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
+  ++nUpdates;
+
   /*--- RBF options. ---*/
   const auto kindRBF = config[donorZone]->GetKindRadialBasisFunction();
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const unsigned long maxLocalDonors = max<unsigned short>(1, config[donorZone]->GetRadialBasisFunctionMaxDonors());
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
   const int nDim = donor_geometry->GetnDim();
@@ -194,6 +263,9 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
     totalWork[iProcessor] += pow(nGlobalVertexDonor, 3);  // based on matrix inversion.
 
+    /*--- With local systems all ranks have work (for their target points) but
+     *    the assigned processor still marks the interfaces that exist. ---*/
+
     assignedProcessor[iMarkerInt] = iProcessor;
   }
   delete[] Buffer_Receive_nVertex_Donor;
@@ -206,7 +278,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   SU2_OMP_PARALLEL_(for schedule(dynamic,1))
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
-    if (rank == assignedProcessor[iMarkerInt]) {
+    if (rank == assignedProcessor[iMarkerInt] && !localSystems) {
       ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF, donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
                              keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
     }
@@ -245,24 +317,26 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     const auto nGlobalVertexDonor = donorCoord.rows();
 
 #ifdef HAVE_MPI
-    /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
-    SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
-
-    /*--- Send C_inv_trunc only to the ranks that need it (those with target points),
-     *    partial broadcast. MPI wrapper not used due to passive double. ---*/
-    vector<unsigned long> allNumVertex(nProcessor);
-    SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG, allNumVertex.data(), 1, MPI_UNSIGNED_LONG,
-                       SU2_MPI::GetComm());
-
-    if (rank == iProcessor) {
-      for (int jProcessor = 0; jProcessor < nProcessor; ++jProcessor)
-        if ((jProcessor != iProcessor) && (allNumVertex[jProcessor] != 0))
-          MPI_Send(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm());
-    } else if (nVertexTarget != 0) {
-      C_inv_trunc.resize(1 + nPolynomial + nGlobalVertexDonor, nGlobalVertexDonor);
-      MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, iProcessor, 0, SU2_MPI::GetComm(),
-               MPI_STATUS_IGNORE);
+    if (!localSystems) {
+      /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
+      SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
+      SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
+
+      /*--- Send C_inv_trunc only to the ranks that need it (those with target points),
+       *    partial broadcast. MPI wrapper not used due to passive double. ---*/
+      vector<unsigned long> allNumVertex(nProcessor);
+      SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG, allNumVertex.data(), 1, MPI_UNSIGNED_LONG,
+                         SU2_MPI::GetComm());
+
+      if (rank == iProcessor) {
+        for (int jProcessor = 0; jProcessor < nProcessor; ++jProcessor)
+          if ((jProcessor != iProcessor) && (allNumVertex[jProcessor] != 0))
+            MPI_Send(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm());
+      } else if (nVertexTarget != 0) {
+        C_inv_trunc.resize(1 + nPolynomial + nGlobalVertexDonor, nGlobalVertexDonor);
+        MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, iProcessor, 0, SU2_MPI::GetComm(),
+                 MPI_STATUS_IGNORE);
+      }
     }
 #endif
 
@@ -283,96 +357,174 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     totalTargetPoints += nVertexTarget;
     denseSize += nVertexTarget * nGlobalVertexDonor;
 
-    /*--- Distribute target slabs over the threads in the rank for processing. ---*/
+    /*--- Donor bins for the nearest donor searches of the local systems. ---*/
+    CDonorBins bins;
+    if (localSystems) bins = CDonorBins(donorCoord, paramRBF);
+
+    /*--- Distribute target slabs (or points) over the threads in the rank for processing. ---*/
 
     SU2_OMP_PARALLEL
     if (nVertexTarget > 0) {
-      constexpr unsigned long targetSlabSize = 32;
-
-      su2passivematrix funcMat(targetSlabSize, 1 + nPolynomial + nGlobalVertexDonor);
-      su2passivematrix interpMat(targetSlabSize, nGlobalVertexDonor);
-
       /*--- Thread-local variables for statistics. ---*/
       unsigned long minDonors = 1 << 30, maxDonors = 0, totalDonors = 0;
       passivedouble sumCorr = 0.0, maxCorr = 0.0;
 
-      SU2_OMP_FOR_DYN(1)
-      for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget += targetSlabSize) {
-        const auto iLastVertex = min(nVertexTarget, iVertexTarget + targetSlabSize);
-        const auto slabSize = iLastVertex - iVertexTarget;
-
-        /*--- Prepare matrix of functions A (the targets to donors matrix). ---*/
-
-        /*--- Polynominal part: ---*/
-        if (usePolynomial) {
-          /*--- Constant term. ---*/
-          for (auto k = 0ul; k < slabSize; ++k) funcMat(k, 0) = 1.0;
-
-          /*--- Linear terms. ---*/
-          for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
-            /*--- Of which one may have been excluded. ---*/
-            if (!keepPolynomialRow[iDim]) continue;
-            for (auto k = 0ul; k < slabSize; ++k)
-              funcMat(k, idx) = SU2_TYPE::GetValue(targetCoord[iVertexTarget + k][iDim]);
-            idx += 1;
-          }
+      /*--- Prunes the coefficients of a target point and sets its donor information,
+       *    "donors" maps the coefficients to donor points (identity if null). ---*/
+      auto setCoefficients = [&](unsigned long iVertexTarget, unsigned long nCoeff, passivedouble* coeffs,
+                                 const unsigned long* donors) {
+        auto& targetVertex = targetVertices[markTarget][iVertexTarget];
+
+        if (nCoeff == 0) {
+          targetVertex.resize(0);
+          minDonors = 0;
+          return;
         }
-        /*--- RBF terms: ---*/
-        for (auto iVertexDonor = 0ul; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-          for (auto k = 0ul; k < slabSize; ++k) {
-            auto dist = GeometryToolbox::Distance(nDim, targetCoord[iVertexTarget + k], donorCoord[iVertexDonor]);
-            auto rbf = Get_RadialBasisValue(kindRBF, paramRBF, dist);
-            funcMat(k, 1 + nPolynomial + iVertexDonor) = SU2_TYPE::GetValue(rbf);
+
+        /*--- Prune small coefficients. ---*/
+        auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), nCoeff, coeffs);
+        auto nnz = info.first;
+        totalDonors += nnz;
+        minDonors = min(minDonors, nnz);
+        maxDonors = max(maxDonors, nnz);
+        auto corr = fabs(info.second - 1.0);  // far from 1 either way is bad;
+        sumCorr += corr;
+        maxCorr = max(maxCorr, corr);
+
+        /*--- Allocate and set donor information for this target point. ---*/
+        targetVertex.resize(nnz);
+
+        for (unsigned long i = 0, iSet = 0; i < nCoeff; ++i) {
+          auto coeff = coeffs[i];
+          if (fabs(coeff) > 0.0) {
+            const auto iVertex = donors ? donors[i] : i;
+            targetVertex.processor[iSet] = donorProc[iVertex];
+            targetVertex.globalPoint[iSet] = donorPoint[iVertex];
+            targetVertex.coefficient[iSet] = coeff;
+            ++iSet;
           }
         }
+      };
+
+      if (localSystems) {
+        /*--- Thread-local work variables of the local systems. ---*/
+        vector<pair<passivedouble, unsigned long> > nearDonors;
+        vector<unsigned long> localDonors;
+        vector<int> localKeepRow;
+        vector<passivedouble> funcVec, coeffs;
+        su2activematrix localCoord;
+        su2passivematrix localCinv;
+        const auto radius = SU2_TYPE::GetValue(paramRBF);
+
+        SU2_OMP_FOR_DYN(64)
+        for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+          const auto coord = targetCoord[iVertexTarget];
+
+          /*--- Nearest donors within the radius, ties are broken by the (MPI-independent) donor order. ---*/
+          nearDonors.clear();
+          bins.ForEachNear(coord, [&](unsigned long iDonor) {
+            const auto dist = SU2_TYPE::GetValue(GeometryToolbox::Distance(nDim, coord, donorCoord[iDonor]));
+            if (dist < radius) nearDonors.emplace_back(dist, iDonor);
+          });
+          const auto nLocal = min(maxLocalDonors, static_cast<unsigned long>(nearDonors.size()));
+          partial_sort(nearDonors.begin(), nearDonors.begin() + nLocal, nearDonors.end());
+
+          if (nLocal == 0) {
+            setCoefficients(iVertexTarget, 0, nullptr, nullptr);
+            continue;
+          }
+          localDonors.resize(nLocal);
+          localCoord.resize(nLocal, nDim);
+          for (auto i = 0ul; i < nLocal; ++i) {
+            localDonors[i] = nearDonors[i].second;
+            for (int iDim = 0; iDim < nDim; ++iDim) localCoord(i, iDim) = donorCoord(localDonors[i], iDim);
+          }
 
-        /*--- Compute slab of the interpolation matrix. ---*/
-#ifdef HAVE_LAPACK
-        /*--- interpMat = funcMat * C_inv_trunc, but order of gemm arguments
-         *    is swapped due to row-major storage of su2passivematrix. ---*/
-        const char op = 'N';
-        const int M = interpMat.cols(), N = slabSize, K = funcMat.cols();
-        // lda = C_inv_trunc.cols() = M; ldb = funcMat.cols() = K; ldc = interpMat.cols() = M;
-        const passivedouble alpha = 1.0, beta = 0.0;
-        DGEMM(&op, &op, &M, &N, &K, &alpha, C_inv_trunc[0], &M, funcMat[0], &K, &beta, interpMat[0], &M);
-#else
-        /*--- Naive product, loop order considers short-wide
-         *    nature of funcMat and interpMat. ---*/
-        interpMat = 0.0;
-        for (auto k = 0ul; k < funcMat.cols(); ++k)
-          for (auto i = 0ul; i < slabSize; ++i)
-            for (auto j = 0ul; j < interpMat.cols(); ++j) interpMat(i, j) += funcMat(i, k) * C_inv_trunc(k, j);
-#endif
-        /*--- Set interpolation coefficients. ---*/
-
-        for (auto k = 0ul; k < slabSize; ++k) {
-          auto& targetVertex = targetVertices[markTarget][iVertexTarget + k];
-
-          /*--- Prune small coefficients. ---*/
-          auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), interpMat.cols(), interpMat[k]);
-          auto nnz = info.first;
-          totalDonors += nnz;
-          minDonors = min(minDonors, nnz);
-          maxDonors = max(maxDonors, nnz);
-          auto corr = fabs(info.second - 1.0);  // far from 1 either way is bad;
-          sumCorr += corr;
-          maxCorr = max(maxCorr, corr);
-
-          /*--- Allocate and set donor information for this target point. ---*/
-          targetVertex.resize(nnz);
-
-          for (unsigned long iVertex = 0, iSet = 0; iVertex < nGlobalVertexDonor; ++iVertex) {
-            auto coeff = interpMat(k, iVertex);
-            if (fabs(coeff) > 0.0) {
-              targetVertex.processor[iSet] = donorProc[iVertex];
-              targetVertex.globalPoint[iSet] = donorPoint[iVertex];
-              targetVertex.coefficient[iSet] = coeff;
-              ++iSet;
-            }
+          /*--- Generator matrix of the local system, the polynomial needs more points than terms. ---*/
+          int nLocalPolynomial = -1;
+          localKeepRow.assign(nDim, 1);
+          const bool localPolynomial = usePolynomial && (nLocal > nDim + 1ul);
+          ComputeGeneratorMatrix(kindRBF, localPolynomial, paramRBF, localCoord, nLocalPolynomial, localKeepRow,
+                                 localCinv);
+
+          /*--- Function vector of the target point (polynomial and RBF terms). ---*/
+          funcVec.clear();
+          if (localPolynomial) {
+            funcVec.push_back(1.0);
+            for (int iDim = 0; iDim < nDim; ++iDim)
+              if (localKeepRow[iDim]) funcVec.push_back(SU2_TYPE::GetValue(coord[iDim]));
           }
+          for (auto i = 0ul; i < nLocal; ++i)
+            funcVec.push_back(SU2_TYPE::GetValue(Get_RadialBasisValue(kindRBF, paramRBF, nearDonors[i].first)));
+
+          /*--- Coefficients = funcVec * C_inv_trunc. ---*/
+          coeffs.assign(nLocal, 0.0);
+          for (auto k = 0ul; k < funcVec.size(); ++k)
+            for (auto i = 0ul; i < nLocal; ++i) coeffs[i] += funcVec[k] * localCinv(k, i);
+
+          setCoefficients(iVertexTarget, nLocal, coeffs.data(), localDonors.data());
         }
-      }  // end target vertex loop
-      END_SU2_OMP_FOR
+        END_SU2_OMP_FOR
+      } else {
+        constexpr unsigned long targetSlabSize = 32;
+
+        su2passivematrix funcMat(targetSlabSize, 1 + nPolynomial + nGlobalVertexDonor);
+        su2passivematrix interpMat(targetSlabSize, nGlobalVertexDonor);
+
+        SU2_OMP_FOR_DYN(1)
+        for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget += targetSlabSize) {
+          const auto iLastVertex = min(nVertexTarget, iVertexTarget + targetSlabSize);
+          const auto slabSize = iLastVertex - iVertexTarget;
+
+          /*--- Prepare matrix of functions A (the targets to donors matrix). ---*/
+
+          /*--- Polynominal part: ---*/
+          if (usePolynomial) {
+            /*--- Constant term. ---*/
+            for (auto k = 0ul; k < slabSize; ++k) funcMat(k, 0) = 1.0;
+
+            /*--- Linear terms. ---*/
+            for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+              /*--- Of which one may have been excluded. ---*/
+              if (!keepPolynomialRow[iDim]) continue;
+              for (auto k = 0ul; k < slabSize; ++k)
+                funcMat(k, idx) = SU2_TYPE::GetValue(targetCoord[iVertexTarget + k][iDim]);
+              idx += 1;
+            }
+          }
+          /*--- RBF terms: ---*/
+          for (auto iVertexDonor = 0ul; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
+            for (auto k = 0ul; k < slabSize; ++k) {
+              auto dist = GeometryToolbox::Distance(nDim, targetCoord[iVertexTarget + k], donorCoord[iVertexDonor]);
+              auto rbf = Get_RadialBasisValue(kindRBF, paramRBF, dist);
+              funcMat(k, 1 + nPolynomial + iVertexDonor) = SU2_TYPE::GetValue(rbf);
+            }
+          }
+
+          /*--- Compute slab of the interpolation matrix. ---*/
+  #ifdef HAVE_LAPACK
+          /*--- interpMat = funcMat * C_inv_trunc, but order of gemm arguments
+           *    is swapped due to row-major storage of su2passivematrix. ---*/
+          const char op = 'N';
+          const int M = interpMat.cols(), N = slabSize, K = funcMat.cols();
+          // lda = C_inv_trunc.cols() = M; ldb = funcMat.cols() = K; ldc = interpMat.cols() = M;
+          const passivedouble alpha = 1.0, beta = 0.0;
+          DGEMM(&op, &op, &M, &N, &K, &alpha, C_inv_trunc[0], &M, funcMat[0], &K, &beta, interpMat[0], &M);
+  #else
+          /*--- Naive product, loop order considers short-wide
+           *    nature of funcMat and interpMat. ---*/
+          interpMat = 0.0;
+          for (auto k = 0ul; k < funcMat.cols(); ++k)
+            for (auto i = 0ul; i < slabSize; ++i)
+              for (auto j = 0ul; j < interpMat.cols(); ++j) interpMat(i, j) += funcMat(i, k) * C_inv_trunc(k, j);
+  #endif
+          /*--- Set interpolation coefficients. ---*/
+
+          for (auto k = 0ul; k < slabSize; ++k)
+            setCoefficients(iVertexTarget + k, interpMat.cols(), interpMat[k], nullptr);
+        }  // end target vertex loop
+        END_SU2_OMP_FOR
+      }
       SU2_OMP_CRITICAL {
         totalDonorPoints += totalDonors;
         MinDonors = min(MinDonors, minDonors);
@@ -37,6 +37,8 @@ CSlidingMesh::CSlidingMesh(CGeometry**** geometry_container, const CConfig* cons
 }
 
 void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
+  ++nUpdates;
+
   /* 0 - Variable declaration */
 
   /* --- General variables --- */
@@ -58,7 +60,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -101,6 +103,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   su2activematrix DonorPoint_Coord;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  closestDonor.resize(config[targetZone]->GetnMarker_All());
 
   /* 1 - Variable pre-processing */
 
@@ -165,6 +168,70 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes = Buffer_Receive_LinkedNodes;
     Donor_Proc = Buffer_Receive_Proc;
 
+    /*--- Boundary vertices sorted by global index, to find them by global index. ---*/
+    auto sortByGlobalIndex = [](const su2vector<unsigned long>& globalPoint, unsigned long nVertex) {
+      vector<pair<unsigned long, unsigned long> > sorted(nVertex);
+      for (auto i = 0ul; i < nVertex; ++i) sorted[i] = make_pair(globalPoint[i], i);
+      sort(sorted.begin(), sorted.end());
+      return sorted;
+    };
+    const auto sortedTargets = sortByGlobalIndex(Target_GlobalPoint, nGlobalVertex_Target);
+    const auto sortedDonors = sortByGlobalIndex(Donor_GlobalPoint, nGlobalVertex_Donor);
+
+    auto findVertex = [](const vector<pair<unsigned long, unsigned long> >& sorted, unsigned long globalIndex) {
+      const auto it = lower_bound(sorted.begin(), sorted.end(), make_pair(globalIndex, 0ul));
+      return (it != sorted.end() && it->first == globalIndex) ? it->second : sorted.size();
+    };
+
+    /*--- Closest donor vertex to a target vertex. If it is known from the previous update of the coefficients it
+     *    is found by walking along the donor boundary from there, as the interface moves little between updates,
+     *    otherwise by brute force. ---*/
+    if (markTarget != -1 && closestDonor[markTarget].size() != nVertexTarget)
+      closestDonor[markTarget].assign(nVertexTarget, -1);
+
+    auto findClosestDonor = [&](const su2double* coord, unsigned long iVertexTarget) {
+      auto& prevClosest = closestDonor[markTarget][iVertexTarget];
+      auto closest = nGlobalVertex_Donor;
+      if (prevClosest >= 0) closest = findVertex(sortedDonors, prevClosest);
+
+      if (closest < nGlobalVertex_Donor) {
+        auto minDist = GeometryToolbox::Distance(nDim, coord, DonorPoint_Coord[closest]);
+        for (bool moved = true; moved;) {
+          moved = false;
+          const auto current = closest;
+          for (auto iNeighbor = 0ul; iNeighbor < Donor_nLinkedNodes[current]; ++iNeighbor) {
+            const auto jPoint = Donor_LinkedNodes[Donor_StartLinkedNodes[current] + iNeighbor];
+            if (jPoint >= nGlobalVertex_Donor) continue;
+            const auto jDist = GeometryToolbox::Distance(nDim, coord, DonorPoint_Coord[jPoint]);
+            if (jDist < minDist) {
+              minDist = jDist;
+              closest = jPoint;
+              moved = true;
+            }
+          }
+        }
+      } else {
+        su2double minDist = 1E6;
+        closest = 0;
+
+        for (auto jPoint = 0ul; jPoint < nGlobalVertex_Donor; jPoint++) {
+          const auto jDist = GeometryToolbox::Distance(nDim, coord, DonorPoint_Coord[jPoint]);
+
+          if (jDist < minDist) {
+            minDist = jDist;
+            closest = jPoint;
+          }
+
+          if (jDist == 0.0) {
+            closest = jPoint;
+            break;
+          }
+        }
+      }
+      prevClosest = Donor_GlobalPoint[closest];
+      return closest;
+    };
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -194,26 +261,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         if (target_geometry->nodes->GetDomain(target_iPoint)) {
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-            Coord_j = DonorPoint_Coord[donor_iPoint];
+          /*--- Find the closest donor_node ---*/
 
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0) {
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex = findClosestDonor(Coord_i, iVertex);
 
           donor_iPoint = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
@@ -221,8 +271,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
           /*--- Contruct information regarding the target cell ---*/
 
           auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if (dPoint == Target_GlobalPoint[jVertexTarget]) break;
+          jVertexTarget = findVertex(sortedTargets, dPoint);
 
           if (Target_nLinkedNodes[jVertexTarget] == 1) {
             target_segment[0] = Target_LinkedNodes[Target_StartLinkedNodes[jVertexTarget]];
@@ -448,9 +497,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++) Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
         auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++) {
-          if (dPoint == Target_GlobalPoint[target_iPoint]) break;
-        }
+        target_iPoint = findVertex(sortedTargets, dPoint);
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -464,26 +511,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
+        /*--- Find the closest donor_node ---*/
 
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-          Coord_j = DonorPoint_Coord[donor_iPoint];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0) {
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        donor_StartIndex = findClosestDonor(Coord_i, iVertex);
 
         donor_iPoint = donor_StartIndex;
 
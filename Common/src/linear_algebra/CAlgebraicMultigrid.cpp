@@ -0,0 +1,703 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the smoothed aggregation algebraic multigrid hierarchy.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/linear_algebra/CSysMatrix.inl"
+#include "../../include/geometry/CGeometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+/*--- Marker for unassigned rows and for columns that are not yet in the current row of a sparse product. ---*/
+constexpr unsigned long AMG_NONE = std::numeric_limits<unsigned long>::max();
+
+/*!
+ * \brief Unknowns without couplings (e.g. discarded modes of small aggregates) get a unit diagonal.
+ */
+void RegularizeDense(unsigned long n, passivedouble* a) {
+  passivedouble scale = 0.0;
+  for (auto i = 0ul; i < n; ++i) scale = std::max(scale, std::abs(a[i * n + i]));
+
+  for (auto i = 0ul; i < n; ++i) {
+    passivedouble rowMax = 0.0;
+    for (auto j = 0ul; j < n; ++j) rowMax = std::max(rowMax, std::abs(a[i * n + j]));
+    if (rowMax <= 1e-12 * scale) a[i * n + i] = (scale > 0.0) ? scale : 1.0;
+  }
+}
+
+/*!
+ * \brief In-place LU factorization with partial pivoting of a dense row-major matrix.
+ */
+void LUFactorize(unsigned long n, passivedouble* a, unsigned long* pivot) {
+  for (auto k = 0ul; k < n; ++k) {
+    auto p = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (std::abs(a[i * n + k]) > std::abs(a[p * n + k])) p = i;
+    pivot[k] = p;
+    if (p != k)
+      for (auto j = 0ul; j < n; ++j) std::swap(a[k * n + j], a[p * n + j]);
+
+    if (a[k * n + k] == 0.0) a[k * n + k] = 1.0;
+
+    for (auto i = k + 1; i < n; ++i) {
+      a[i * n + k] /= a[k * n + k];
+      for (auto j = k + 1; j < n; ++j) a[i * n + j] -= a[i * n + k] * a[k * n + j];
+    }
+  }
+}
+
+/*!
+ * \brief In-place solution of a system factorized with LUFactorize.
+ */
+void LUSolve(unsigned long n, const passivedouble* a, const unsigned long* pivot, passivedouble* b) {
+  for (auto k = 0ul; k < n; ++k) std::swap(b[k], b[pivot[k]]);
+
+  for (auto i = 1ul; i < n; ++i)
+    for (auto j = 0ul; j < i; ++j) b[i] -= a[i * n + j] * b[j];
+
+  for (auto i = n; i-- > 0;) {
+    for (auto j = i + 1; j < n; ++j) b[i] -= a[i * n + j] * b[j];
+    b[i] /= a[i * n + i];
+  }
+}
+}  // namespace
+
+template <class ScalarType>
+typename CAlgebraicMultigrid<ScalarType>::CMatrixView CAlgebraicMultigrid<ScalarType>::GetLevel(
+    const CSysMatrix<ScalarType>& A, unsigned long iLevel, const ScalarType*& invDiag) const {
+  if (iLevel == 0) {
+    invDiag = A.invM;
+    return {A.nPointDomain, A.nPointDomain, A.nVar, A.nVar, A.row_ptr, A.col_ind, A.matrix};
+  }
+  invDiag = levels[iLevel - 1].invDiag.data();
+  return View(levels[iLevel - 1].A);
+}
+
+template <class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(const CMatrixView& fine, passivedouble threshold,
+                                                         std::vector<unsigned long>& parent) {
+  const auto nRow = fine.nRow;
+  const auto blkSize = fine.rowBlk * fine.colBlk;
+
+  auto blockNorm = [&](unsigned long k) {
+    passivedouble sum = 0.0;
+    for (auto i = 0ul; i < blkSize; ++i) sum += pow(SU2_TYPE::GetValue(fine.values[k * blkSize + i]), 2);
+    return sqrt(sum);
+  };
+
+  /*--- Strength of the couplings, a coupling is strong if its norm is greater than a fraction of the
+   * strongest (off-diagonal) coupling of the row. This is not symmetric, but that is not important. ---*/
+
+  std::vector<passivedouble> strength(fine.row_ptr[nRow], 0.0), rowMax(nRow, 0.0);
+
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+    for (auto k = fine.row_ptr[iRow]; k < fine.row_ptr[iRow + 1]; ++k) {
+      const auto jRow = fine.col_ind[k];
+      if (jRow == iRow || jRow >= nRow) continue;
+      strength[k] = blockNorm(k);
+      rowMax[iRow] = max(rowMax[iRow], strength[k]);
+    }
+  }
+
+  auto isStrong = [&](unsigned long iRow, unsigned long k) {
+    const auto jRow = fine.col_ind[k];
+    return (jRow != iRow) && (jRow < nRow) && (strength[k] > 0.0) && (strength[k] >= threshold * rowMax[iRow]);
+  };
+
+  parent.assign(nRow, AMG_NONE);
+  unsigned long nAgg = 0;
+
+  /*--- Phase 1, rows whose strong neighbors are all free become the roots of new aggregates. ---*/
+
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+    if (parent[iRow] != AMG_NONE) continue;
+
+    bool free = true, isolated = true;
+    for (auto k = fine.row_ptr[iRow]; k < fine.row_ptr[iRow + 1] && free; ++k) {
+      if (!isStrong(iRow, k)) continue;
+      isolated = false;
+      free = (parent[fine.col_ind[k]] == AMG_NONE);
+    }
+    if (!free || isolated) continue;
+
+    parent[iRow] = nAgg;
+    for (auto k = fine.row_ptr[iRow]; k < fine.row_ptr[iRow + 1]; ++k)
+      if (isStrong(iRow, k)) parent[fine.col_ind[k]] = nAgg;
+    ++nAgg;
+  }
+
+  /*--- Phase 2, free rows join the aggregate (from phase 1) of their strongest neighbor. ---*/
+
+  const auto phase1 = parent;
+
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+    if (parent[iRow] != AMG_NONE) continue;
+
+    passivedouble maxStrength = 0.0;
+    for (auto k = fine.row_ptr[iRow]; k < fine.row_ptr[iRow + 1]; ++k) {
+      if (!isStrong(iRow, k)) continue;
+      const auto agg = phase1[fine.col_ind[k]];
+      if (agg != AMG_NONE && strength[k] > maxStrength) {
+        maxStrength = strength[k];
+        parent[iRow] = agg;
+      }
+    }
+  }
+
+  /*--- Phase 3, the remaining rows form aggregates with their free strong neighbors (or alone). ---*/
+
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+    if (parent[iRow] != AMG_NONE) continue;
+
+    parent[iRow] = nAgg;
+    for (auto k = fine.row_ptr[iRow]; k < fine.row_ptr[iRow + 1]; ++k) {
+      if (isStrong(iRow, k) && parent[fine.col_ind[k]] == AMG_NONE) parent[fine.col_ind[k]] = nAgg;
+    }
+    ++nAgg;
+  }
+
+  return nAgg;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Multiply(const CMatrixView& X, const CMatrixView& Y, CBlockMatrix& Z) {
+  const auto blkX = X.rowBlk * X.colBlk, blkY = Y.rowBlk * Y.colBlk, blkZ = X.rowBlk * Y.colBlk;
+
+  Z.nRow = X.nRow;
+  Z.nCol = Y.nCol;
+  Z.rowBlk = X.rowBlk;
+  Z.colBlk = Y.colBlk;
+  Z.row_ptr.assign(X.nRow + 1, 0);
+  Z.col_ind.clear();
+  Z.values.clear();
+
+  /*--- Row by row (Gustavson), pos maps the columns of the current row to their position in Z. ---*/
+  std::vector<unsigned long> pos(Y.nCol, AMG_NONE);
+
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow) {
+    const auto start = Z.col_ind.size();
+
+    for (auto k = X.row_ptr[iRow]; k < X.row_ptr[iRow + 1]; ++k) {
+      const auto jRow = X.col_ind[k];
+      if (jRow >= X.nCol || jRow >= Y.nRow) continue;
+
+      for (auto l = Y.row_ptr[jRow]; l < Y.row_ptr[jRow + 1]; ++l) {
+        const auto jCol = Y.col_ind[l];
+        if (jCol >= Y.nCol) continue;
+
+        if (pos[jCol] == AMG_NONE || pos[jCol] < start) {
+          pos[jCol] = Z.col_ind.size();
+          Z.col_ind.push_back(jCol);
+          Z.values.resize(Z.values.size() + blkZ, ScalarType(0));
+        }
+        const auto* x = &X.values[k * blkX];
+        const auto* y = &Y.values[l * blkY];
+        auto* z = &Z.values[pos[jCol] * blkZ];
+
+        for (auto i = 0ul; i < X.rowBlk; ++i)
+          for (auto m = 0ul; m < X.colBlk; ++m)
+            for (auto j = 0ul; j < Y.colBlk; ++j) z[i * Y.colBlk + j] += x[i * X.colBlk + m] * y[m * Y.colBlk + j];
+      }
+    }
+    Z.row_ptr[iRow + 1] = Z.col_ind.size();
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Transpose(const CMatrixView& X, CBlockMatrix& XT) {
+  const auto blk = X.rowBlk * X.colBlk;
+
+  XT.nRow = X.nCol;
+  XT.nCol = X.nRow;
+  XT.rowBlk = X.colBlk;
+  XT.colBlk = X.rowBlk;
+
+  XT.row_ptr.assign(XT.nRow + 1, 0);
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow)
+    for (auto k = X.row_ptr[iRow]; k < X.row_ptr[iRow + 1]; ++k)
+      if (X.col_ind[k] < X.nCol) ++XT.row_ptr[X.col_ind[k] + 1];
+  for (auto iRow = 0ul; iRow < XT.nRow; ++iRow) XT.row_ptr[iRow + 1] += XT.row_ptr[iRow];
+
+  XT.col_ind.resize(XT.row_ptr[XT.nRow]);
+  XT.values.resize(XT.col_ind.size() * blk);
+
+  auto pos = XT.row_ptr;
+  for (auto iRow = 0ul; iRow < X.nRow; ++iRow) {
+    for (auto k = X.row_ptr[iRow]; k < X.row_ptr[iRow + 1]; ++k) {
+      const auto jCol = X.col_ind[k];
+      if (jCol >= X.nCol) continue;
+      const auto dst = pos[jCol]++;
+      XT.col_ind[dst] = iRow;
+      for (auto i = 0ul; i < X.rowBlk; ++i)
+        for (auto j = 0ul; j < X.colBlk; ++j)
+          XT.values[dst * blk + j * X.rowBlk + i] = X.values[k * blk + i * X.colBlk + j];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::InvertDiagonal(const CMatrixView& M, std::vector<ScalarType>& invDiag) {
+  const auto n = M.rowBlk, blk = n * n;
+  invDiag.resize(M.nRow * blk);
+
+  passivedouble block[MAX_BLOCK_SIZE * MAX_BLOCK_SIZE], rhs[MAX_BLOCK_SIZE];
+  unsigned long pivot[MAX_BLOCK_SIZE];
+
+  for (auto iRow = 0ul; iRow < M.nRow; ++iRow) {
+    for (auto i = 0ul; i < blk; ++i) block[i] = 0.0;
+    for (auto k = M.row_ptr[iRow]; k < M.row_ptr[iRow + 1]; ++k) {
+      if (M.col_ind[k] != iRow) continue;
+      for (auto i = 0ul; i < blk; ++i) block[i] = SU2_TYPE::GetValue(M.values[k * blk + i]);
+    }
+    RegularizeDense(n, block);
+    LUFactorize(n, block, pivot);
+
+    /*--- Column by column. ---*/
+    for (auto j = 0ul; j < n; ++j) {
+      for (auto i = 0ul; i < n; ++i) rhs[i] = (i == j) ? 1.0 : 0.0;
+      LUSolve(n, block, pivot, rhs);
+      for (auto i = 0ul; i < n; ++i) invDiag[iRow * blk + i * n + j] = rhs[i];
+    }
+  }
+}
+
+template <class ScalarType>
+passivedouble CAlgebraicMultigrid<ScalarType>::SpectralRadius(const CMatrixView& M, const ScalarType* invDiag) {
+  const auto n = M.rowBlk, blk = n * n, size = M.nRow * n;
+  if (size == 0) return 1.0;
+
+  /*--- The initial vector should not be orthogonal to the dominant eigenvector. ---*/
+  std::vector<passivedouble> v(size), w(size);
+  passivedouble norm = 0.0;
+  for (auto i = 0ul; i < size; ++i) {
+    v[i] = 1.0 + 0.1 * (i % 7);
+    norm += v[i] * v[i];
+  }
+  for (auto& x : v) x /= sqrt(norm);
+
+  passivedouble rho = 0.0;
+  passivedouble t[MAX_BLOCK_SIZE];
+
+  for (auto iter = 0ul; iter < POWER_ITERATIONS; ++iter) {
+    norm = 0.0;
+    for (auto iRow = 0ul; iRow < M.nRow; ++iRow) {
+      for (auto i = 0ul; i < n; ++i) t[i] = 0.0;
+      for (auto k = M.row_ptr[iRow]; k < M.row_ptr[iRow + 1]; ++k) {
+        const auto jRow = M.col_ind[k];
+        if (jRow >= M.nCol) continue;
+        for (auto i = 0ul; i < n; ++i)
+          for (auto j = 0ul; j < n; ++j) t[i] += SU2_TYPE::GetValue(M.values[k * blk + i * n + j]) * v[jRow * n + j];
+      }
+      for (auto i = 0ul; i < n; ++i) {
+        passivedouble sum = 0.0;
+        for (auto j = 0ul; j < n; ++j) sum += SU2_TYPE::GetValue(invDiag[iRow * blk + i * n + j]) * t[j];
+        w[iRow * n + i] = sum;
+        norm += sum * sum;
+      }
+    }
+    /*--- v has unit norm. ---*/
+    rho = sqrt(norm);
+    if (rho == 0.0) return 1.0;
+    for (auto i = 0ul; i < size; ++i) v[i] = w[i] / rho;
+  }
+  return rho;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::TentativeProlongation(const std::vector<unsigned long>& parent,
+                                                                unsigned long nAgg, unsigned long blkSize,
+                                                                unsigned long nNull,
+                                                                const std::vector<passivedouble>& nullSpace,
+                                                                CBlockMatrix& P0,
+                                                                std::vector<passivedouble>& coarseNullSpace) {
+  const auto nRow = parent.size();
+
+  /*--- Children of each aggregate. ---*/
+
+  std::vector<unsigned long> child_ptr(nAgg + 1, 0), child_idx(nRow);
+  for (auto iRow = 0ul; iRow < nRow; ++iRow) ++child_ptr[parent[iRow] + 1];
+  for (auto iAgg = 0ul; iAgg < nAgg; ++iAgg) child_ptr[iAgg + 1] += child_ptr[iAgg];
+  {
+    auto pos = child_ptr;
+    for (auto iRow = 0ul; iRow < nRow; ++iRow) child_idx[pos[parent[iRow]]++] = iRow;
+  }
+
+  /*--- One block per row, in the column of its aggregate. ---*/
+
+  P0.nRow = nRow;
+  P0.nCol = nAgg;
+  P0.rowBlk = blkSize;
+  P0.colBlk = nNull;
+  P0.row_ptr.resize(nRow + 1);
+  for (auto iRow = 0ul; iRow <= nRow; ++iRow) P0.row_ptr[iRow] = iRow;
+  P0.col_ind = parent;
+  P0.values.assign(nRow * blkSize * nNull, ScalarType(0));
+
+  coarseNullSpace.assign(nAgg * nNull * nNull, 0.0);
+
+  std::vector<passivedouble> Q;
+
+  for (auto iAgg = 0ul; iAgg < nAgg; ++iAgg) {
+    const auto nChild = child_ptr[iAgg + 1] - child_ptr[iAgg];
+    const auto m = nChild * blkSize;
+
+    /*--- Null space of the children, column-major. ---*/
+    Q.resize(m * nNull);
+    for (auto c = 0ul; c < nChild; ++c) {
+      const auto iRow = child_idx[child_ptr[iAgg] + c];
+      for (auto iVar = 0ul; iVar < blkSize; ++iVar)
+        for (auto j = 0ul; j < nNull; ++j)
+          Q[j * m + c * blkSize + iVar] = nullSpace[(iRow * blkSize + iVar) * nNull + j];
+    }
+
+    /*--- Gram-Schmidt with one re-orthogonalization, columns that are (almost) linearly dependent on the
+     * previous ones are discarded (e.g. rotations of aggregates with one point), which leaves a zero
+     * column in P0 and a zero diagonal entry in R, the coarse null space. ---*/
+    auto* R = &coarseNullSpace[iAgg * nNull * nNull];
+
+    for (auto j = 0ul; j < nNull; ++j) {
+      auto* q = &Q[j * m];
+      passivedouble norm0 = 0.0;
+      for (auto k = 0ul; k < m; ++k) norm0 += q[k] * q[k];
+      norm0 = sqrt(norm0);
+
+      for (int pass = 0; pass < 2; ++pass) {
+        for (auto i = 0ul; i < j; ++i) {
+          const auto* qi = &Q[i * m];
+          passivedouble dot = 0.0;
+          for (auto k = 0ul; k < m; ++k) dot += qi[k] * q[k];
+          R[i * nNull + j] += dot;
+          for (auto k = 0ul; k < m; ++k) q[k] -= dot * qi[k];
+        }
+      }
+      passivedouble norm = 0.0;
+      for (auto k = 0ul; k < m; ++k) norm += q[k] * q[k];
+      norm = sqrt(norm);
+
+      if (norm <= 1e-10 * norm0 || norm0 == 0.0) {
+        for (auto k = 0ul; k < m; ++k) q[k] = 0.0;
+        continue;
+      }
+      R[j * nNull + j] = norm;
+      for (auto k = 0ul; k < m; ++k) q[k] /= norm;
+    }
+
+    /*--- The orthonormal basis is the tentative prolongation of the children. ---*/
+    for (auto c = 0ul; c < nChild; ++c) {
+      const auto iRow = child_idx[child_ptr[iAgg] + c];
+      for (auto iVar = 0ul; iVar < blkSize; ++iVar)
+        for (auto j = 0ul; j < nNull; ++j)
+          P0.values[(iRow * blkSize + iVar) * nNull + j] = Q[j * m + c * blkSize + iVar];
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SmoothProlongation(const CMatrixView& fine, const ScalarType* invDiag,
+                                                         const CBlockMatrix& P0, CBlockMatrix& P) {
+  const auto blk = fine.rowBlk, nNull = P0.colBlk;
+
+  /*--- P = P0 - w D^-1 A P0, the pattern of A P0 includes that of P0. ---*/
+
+  Multiply(fine, View(P0), P);
+
+  const auto rho = SpectralRadius(fine, invDiag);
+  const ScalarType omega = 4.0 / (3.0 * rho);
+
+  ScalarType tmp[MAX_BLOCK_SIZE * MAX_BLOCK_SIZE];
+
+  for (auto iRow = 0ul; iRow < fine.nRow; ++iRow) {
+    const auto* Dinv = &invDiag[iRow * blk * blk];
+
+    for (auto k = P.row_ptr[iRow]; k < P.row_ptr[iRow + 1]; ++k) {
+      auto* Pk = &P.values[k * blk * nNull];
+
+      for (auto i = 0ul; i < blk; ++i) {
+        for (auto j = 0ul; j < nNull; ++j) {
+          tmp[i * nNull + j] = 0.0;
+          for (auto l = 0ul; l < blk; ++l) tmp[i * nNull + j] += Dinv[i * blk + l] * Pk[l * nNull + j];
+        }
+      }
+      for (auto i = 0ul; i < blk * nNull; ++i) Pk[i] = -omega * tmp[i];
+
+      if (P.col_ind[k] == P0.col_ind[iRow]) {
+        const auto* P0k = &P0.values[iRow * blk * nNull];
+        for (auto i = 0ul; i < blk * nNull; ++i) Pk[i] += P0k[i];
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::GalerkinOperator(const CSysMatrix<ScalarType>& A, unsigned long iLevel) {
+  const ScalarType* invDiag = nullptr;
+  const auto fine = GetLevel(A, iLevel, invDiag);
+  auto& coarse = levels[iLevel];
+
+  SmoothProlongation(fine, invDiag, coarse.P0, coarse.P);
+
+  /*--- Galerkin operator, P^T (A P). ---*/
+
+  CBlockMatrix AP;
+  Multiply(fine, View(coarse.P), AP);
+  Transpose(View(coarse.P), coarse.R);
+  Multiply(View(coarse.R), View(AP), coarse.A);
+
+  InvertDiagonal(View(coarse.A), coarse.invDiag);
+
+  const auto size = coarse.A.nRow * coarse.P0.colBlk;
+  coarse.sol.resize(size);
+  coarse.rhs.resize(size);
+  coarse.work.resize(size);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::FactorizeCoarsest(const CSysMatrix<ScalarType>& A) {
+  const ScalarType* invDiag = nullptr;
+  const auto M = GetLevel(A, levels.size(), invDiag);
+  const auto blk = M.rowBlk, n = M.nRow * blk;
+
+  if (n == 0 || n > MAX_DIRECT_SIZE) {
+    coarseLU.clear();
+    return;
+  }
+  coarseLU.assign(n * n, 0.0);
+  coarsePivot.resize(n);
+  coarseWork.resize(n);
+
+  for (auto iRow = 0ul; iRow < M.nRow; ++iRow) {
+    for (auto k = M.row_ptr[iRow]; k < M.row_ptr[iRow + 1]; ++k) {
+      const auto jRow = M.col_ind[k];
+      if (jRow >= M.nCol) continue;
+      for (auto i = 0ul; i < blk; ++i)
+        for (auto j = 0ul; j < blk; ++j)
+          coarseLU[(iRow * blk + i) * n + jRow * blk + j] = SU2_TYPE::GetValue(M.values[(k * blk + i) * blk + j]);
+    }
+  }
+  RegularizeDense(n, coarseLU.data());
+  LUFactorize(n, coarseLU.data(), coarsePivot.data());
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::BuildHierarchy(const CSysMatrix<ScalarType>& A, const CConfig* config,
+                                                     unsigned long nNull, std::vector<passivedouble> nullSpace,
+                                                     const std::vector<unsigned long>& firstParent) {
+  if (isAggregated) {
+    for (auto iLevel = 0ul; iLevel < levels.size(); ++iLevel) GalerkinOperator(A, iLevel);
+    FactorizeCoarsest(A);
+    return;
+  }
+
+  nSweeps = config->GetLinear_Solver_AMG_Sweeps();
+  nCoarseSweeps = 4 * nSweeps;
+  relaxation = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Relaxation());
+  const auto threshold = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+  const unsigned long maxLevels = max<unsigned short>(config->GetLinear_Solver_AMG_Levels(), 1);
+
+  fineWork.resize(A.nPointDomain * A.nVar);
+
+  /*--- Coarsen until the level can be solved directly, or the maximum number of levels is reached. ---*/
+
+  levels.clear();
+  levels.reserve(maxLevels - 1);
+
+  for (auto iLevel = 0ul; iLevel + 1 < maxLevels; ++iLevel) {
+    const ScalarType* invDiag = nullptr;
+    const auto fine = GetLevel(A, iLevel, invDiag);
+    const auto nUnknowns = fine.nRow * fine.rowBlk;
+    if (nUnknowns <= MAX_DIRECT_SIZE) break;
+
+    std::vector<unsigned long> parent;
+    unsigned long nAgg = 0;
+
+    if (iLevel == 0 && !firstParent.empty()) {
+      parent = firstParent;
+      for (const auto iAgg : parent) nAgg = max(nAgg, iAgg + 1);
+    } else {
+      nAgg = Aggregate(fine, threshold, parent);
+    }
+
+    /*--- Stop if the coarsening stalls. ---*/
+    if (nAgg == 0 || 10 * nAgg * nNull > 9 * nUnknowns) break;
+
+    CLevel coarse;
+    std::vector<passivedouble> coarseNullSpace;
+    TentativeProlongation(parent, nAgg, fine.rowBlk, nNull, nullSpace, coarse.P0, coarseNullSpace);
+    nullSpace.swap(coarseNullSpace);
+
+    levels.push_back(std::move(coarse));
+    GalerkinOperator(A, iLevel);
+  }
+  isAggregated = true;
+
+  FactorizeCoarsest(A);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(const CSysMatrix<ScalarType>& A, const CGeometry* geometry,
+                                            const CConfig* config) {
+  /*--- The setup is sequential. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto nVar = A.nVar;
+    std::vector<passivedouble> nullSpace;
+    std::vector<unsigned long> parent;
+
+    if (!isAggregated) {
+      /*--- One constant mode per variable, the tentative prolongation is piecewise constant. ---*/
+
+      nullSpace.resize(A.nPointDomain * nVar * nVar, 0.0);
+      for (auto iPoint = 0ul; iPoint < A.nPointDomain; ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) nullSpace[(iPoint * nVar + iVar) * nVar + iVar] = 1.0;
+
+      /*--- The agglomeration of the geometric multigrid can be reused if the geometry was agglomerated. ---*/
+
+      bool useGeometry = (config->GetnMGLevels() > 0) && (geometry != nullptr) &&
+                         (geometry->GetnPointDomain() == A.nPointDomain);
+      for (auto iPoint = 0ul; useGeometry && iPoint < A.nPointDomain; ++iPoint)
+        useGeometry = geometry->nodes->GetAgglomerate(iPoint);
+
+      if (useGeometry) {
+        /*--- Renumber the parent control volumes of the domain points. ---*/
+        std::vector<unsigned long> renumber(geometry->GetnPoint() + 1, AMG_NONE);
+        unsigned long nAgg = 0;
+        parent.resize(A.nPointDomain);
+        for (auto iPoint = 0ul; iPoint < A.nPointDomain; ++iPoint) {
+          auto& idx = renumber[min(geometry->nodes->GetParent_CV(iPoint), geometry->GetnPoint())];
+          if (idx == AMG_NONE) idx = nAgg++;
+          parent[iPoint] = idx;
+        }
+      }
+    }
+    BuildHierarchy(A, config, nVar, std::move(nullSpace), parent);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Product(const CMatrixView& M, const ScalarType* x, ScalarType* y,
+                                                  ScalarType scale, const ScalarType* y0) const {
+  const auto blkR = M.rowBlk, blkC = M.colBlk, blk = blkR * blkC;
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iRow = 0ul; iRow < M.nRow; ++iRow) {
+    ScalarType sum[MAX_BLOCK_SIZE] = {0};
+
+    for (auto k = M.row_ptr[iRow]; k < M.row_ptr[iRow + 1]; ++k) {
+      const auto jRow = M.col_ind[k];
+      if (jRow >= M.nCol) continue;
+      for (auto i = 0ul; i < blkR; ++i)
+        for (auto j = 0ul; j < blkC; ++j) sum[i] += M.values[k * blk + i * blkC + j] * x[jRow * blkC + j];
+    }
+    for (auto i = 0ul; i < blkR; ++i)
+      y[iRow * blkR + i] = (y0 ? y0[iRow * blkR + i] : ScalarType(0)) + scale * sum[i];
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CMatrixView& M, const ScalarType* invDiag, const ScalarType* b,
+                                                 ScalarType* x, ScalarType* work, unsigned short sweeps,
+                                                 bool xIsZero) const {
+  const auto n = M.rowBlk, blk = n * n;
+
+  for (auto iSweep = 0u; iSweep < sweeps; ++iSweep) {
+    /*--- With a zero initial solution the residual is b. ---*/
+    const bool first = (iSweep == 0) && xIsZero;
+    if (!first) Product(M, x, work, -1, b);
+    const ScalarType* r = first ? b : work;
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iRow = 0ul; iRow < M.nRow; ++iRow) {
+      for (auto i = 0ul; i < n; ++i) {
+        ScalarType dx = 0.0;
+        for (auto j = 0ul; j < n; ++j) dx += invDiag[iRow * blk + i * n + j] * r[iRow * n + j];
+        x[iRow * n + i] = (first ? ScalarType(0) : x[iRow * n + i]) + relaxation * dx;
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(const CSysMatrix<ScalarType>& A, unsigned long iLevel,
+                                                const ScalarType* b, ScalarType* x) const {
+  const ScalarType* invDiag = nullptr;
+  const auto M = GetLevel(A, iLevel, invDiag);
+  ScalarType* work = (iLevel == 0) ? fineWork.data() : levels[iLevel - 1].work.data();
+
+  /*--- On the coarsest level, solve directly or smooth more. ---*/
+
+  if (iLevel == levels.size()) {
+    if (coarseLU.empty()) {
+      Smooth(M, invDiag, b, x, work, nCoarseSweeps, true);
+      return;
+    }
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      const auto n = coarseWork.size();
+      for (auto i = 0ul; i < n; ++i) coarseWork[i] = SU2_TYPE::GetValue(b[i]);
+      LUSolve(n, coarseLU.data(), coarsePivot.data(), coarseWork.data());
+      for (auto i = 0ul; i < n; ++i) x[i] = coarseWork[i];
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    return;
+  }
+  const auto& coarse = levels[iLevel];
+
+  /*--- Pre-smoothing, residual, and restriction. ---*/
+
+  Smooth(M, invDiag, b, x, work, nSweeps, true);
+  Product(M, x, work, -1, b);
+  Product(View(coarse.R), work, coarse.rhs.data(), 1, nullptr);
+
+  /*--- Coarse grid correction. ---*/
+
+  Cycle(A, iLevel + 1, coarse.rhs.data(), coarse.sol.data());
+  Product(View(coarse.P), coarse.sol.data(), x, 1, x);
+
+  /*--- Post-smoothing. ---*/
+
+  Smooth(M, invDiag, b, x, work, nSweeps, false);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const CSysMatrix<ScalarType>& A, const ScalarType* vec,
+                                                ScalarType* prod) const {
+  Cycle(A, 0, vec, prod);
+}
+
+/*--- Explicit instantiations, same types as CSysMatrix. ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
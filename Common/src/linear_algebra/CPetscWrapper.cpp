@@ -0,0 +1,185 @@
+/*!
+ * \file CPetscWrapper.cpp
+ * \brief An interface to the Krylov solvers and preconditioners of PETSc (https://petsc.org)
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef HAVE_PETSC
+
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/CConfig.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/linear_algebra/CPetscWrapper.hpp"
+
+template <class ScalarType>
+CPetscWrapper<ScalarType>::~CPetscWrapper() {
+  PetscBool finalized = PETSC_FALSE;
+  PetscFinalized(&finalized);
+  if (!isinitialized || finalized) return;
+
+  KSPDestroy(&ksp);
+  MatDestroy(&A);
+  VecDestroy(&b);
+  VecDestroy(&x);
+}
+
+template <class ScalarType>
+void CPetscWrapper<ScalarType>::Initialize(CGeometry* geometry, const CConfig* config) {
+  if (isinitialized) return;
+
+  /*--- PETSc is initialized on first use, over the communicator of SU2. ---*/
+
+  PetscBool started = PETSC_FALSE;
+  Check(PetscInitialized(&started));
+  if (!started) {
+    PETSC_COMM_WORLD = SU2_MPI::GetComm();
+    Check(PetscInitializeNoArguments());
+  }
+
+  const unsigned long nVar = matrix.nVar, nPoint = matrix.nPoint, nPointDomain = matrix.nPointDomain;
+  const unsigned long *row_ptr = matrix.rowptr, *col_ind = matrix.colidx;
+  const int mpi_size = SU2_MPI::GetSize(), mpi_rank = SU2_MPI::GetRank();
+
+  /*--- 1 - Position of this rank in the linear partitioning of the rows. ---*/
+
+  unsigned long globalOffset = 0;
+#ifdef HAVE_MPI
+  vector<unsigned long> domain_sizes(mpi_size);
+  MPI_Allgather(&nPointDomain, 1, MPI_UNSIGNED_LONG, domain_sizes.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  for (int i = 0; i < mpi_rank; ++i) globalOffset += domain_sizes[i];
+#endif
+  offset = PetscInt(globalOffset);
+
+  /*--- 2 - Global indices of the halo points, from their owners (as in CPastixWrapper). ---*/
+
+  vector<PetscInt> map(nPoint - nPointDomain, 0);
+
+#ifdef HAVE_MPI
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) && (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      unsigned short MarkerS = iMarker, MarkerR = iMarker + 1;
+
+      int sender = config->GetMarker_All_SendRecv(MarkerS) - 1;
+      int recver = abs(config->GetMarker_All_SendRecv(MarkerR)) - 1;
+
+      unsigned long nVertexS = geometry->nVertex[MarkerS];
+      unsigned long nVertexR = geometry->nVertex[MarkerR];
+
+      vector<unsigned long> Buffer_Recv(nVertexR), Buffer_Send(nVertexS);
+
+      for (unsigned long iVertex = 0; iVertex < nVertexS; iVertex++)
+        Buffer_Send[iVertex] = geometry->vertex[MarkerS][iVertex]->GetNode() + globalOffset;
+
+      MPI_Sendrecv(Buffer_Send.data(), nVertexS, MPI_UNSIGNED_LONG, sender, 0, Buffer_Recv.data(), nVertexR,
+                   MPI_UNSIGNED_LONG, recver, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+
+      for (unsigned long iVertex = 0; iVertex < nVertexR; iVertex++)
+        map[geometry->vertex[MarkerR][iVertex]->GetNode() - nPointDomain] = PetscInt(Buffer_Recv[iVertex]);
+    }
+  }
+#endif
+
+  /*--- 3 - Global column indices, and number of blocks in the local and off-rank parts of each row. ---*/
+
+  const unsigned long nNonZero = row_ptr[nPointDomain];
+  colGlobal.resize(nNonZero);
+  vector<PetscInt> d_nnz(nPointDomain, 0), o_nnz(nPointDomain, 0);
+  unsigned long maxRowSize = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint + 1]; ++k) {
+      const auto jPoint = col_ind[k];
+      if (jPoint < nPointDomain) {
+        colGlobal[k] = offset + PetscInt(jPoint);
+        ++d_nnz[iPoint];
+      } else {
+        colGlobal[k] = map[jPoint - nPointDomain];
+        ++o_nnz[iPoint];
+      }
+    }
+    maxRowSize = max(maxRowSize, row_ptr[iPoint + 1] - row_ptr[iPoint]);
+  }
+  rowVals.resize(maxRowSize * nVar * nVar);
+
+  /*--- 4 - Create the objects, the blocks are row-major as in SU2 (default MAT_ROW_ORIENTED). ---*/
+
+  const auto bs = PetscInt(nVar);
+  const auto nLocal = PetscInt(matrix.size_rhs());
+
+  Check(MatCreate(SU2_MPI::GetComm(), &A));
+  Check(MatSetSizes(A, nLocal, nLocal, PETSC_DETERMINE, PETSC_DETERMINE));
+  Check(MatSetType(A, MATBAIJ));
+  Check(MatSeqBAIJSetPreallocation(A, bs, 0, d_nnz.data()));
+  Check(MatMPIBAIJSetPreallocation(A, bs, 0, d_nnz.data(), 0, o_nnz.data()));
+
+  Check(VecCreateMPIWithArray(SU2_MPI::GetComm(), bs, nLocal, PETSC_DETERMINE, nullptr, &b));
+  Check(VecCreateMPIWithArray(SU2_MPI::GetComm(), bs, nLocal, PETSC_DETERMINE, nullptr, &x));
+
+  if (!is_same<ScalarType, PetscScalar>::value) {
+    workRhs.resize(matrix.size_rhs());
+    workSol.resize(matrix.size_rhs());
+  }
+
+  /*--- The solver options from the config file are inserted in the options database, they still
+   * can be overridden by the PETSC_OPTIONS environment variable (the tolerances come from SU2). ---*/
+
+  const string options = config->GetPetsc_Options();
+  if (!options.empty()) Check(PetscOptionsInsertString(nullptr, options.c_str()));
+
+  Check(KSPCreate(SU2_MPI::GetComm(), &ksp));
+  Check(KSPSetOperators(ksp, A, A));
+  Check(KSPSetInitialGuessNonzero(ksp, PETSC_TRUE));
+  Check(KSPSetFromOptions(ksp));
+
+  isinitialized = true;
+}
+
+template <class ScalarType>
+void CPetscWrapper<ScalarType>::Update(CGeometry* geometry, const CConfig* config) {
+  Initialize(geometry, config);
+
+  const auto nVar = matrix.nVar;
+  const auto szBlk = nVar * nVar;
+
+  for (unsigned long iPoint = 0; iPoint < matrix.nPointDomain; ++iPoint) {
+    const auto begin = matrix.rowptr[iPoint], end = matrix.rowptr[iPoint + 1];
+    const PetscInt row = offset + PetscInt(iPoint);
+
+    for (auto i = 0ul; i < (end - begin) * szBlk; ++i) {
+      rowVals[i] = SU2_TYPE::GetValue(matrix.values[begin * szBlk + i]);
+    }
+    Check(MatSetValuesBlocked(A, 1, &row, PetscInt(end - begin), &colGlobal[begin], rowVals.data(), INSERT_VALUES));
+  }
+  Check(MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY));
+  Check(MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY));
+}
+
+#ifdef CODI_FORWARD_TYPE
+template class CPetscWrapper<su2double>;
+#else
+template class CPetscWrapper<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CPetscWrapper<passivedouble>;
+#endif
+#endif
+#endif
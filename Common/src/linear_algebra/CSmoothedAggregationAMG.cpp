@@ -0,0 +1,110 @@
+/*!
+ * \file CSmoothedAggregationAMG.cpp
+ * \brief Rigid body modes of the smoothed aggregation AMG for elasticity.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSmoothedAggregationAMG.hpp"
+#include "../../include/linear_algebra/CSysMatrix.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+
+#include <algorithm>
+#include <limits>
+
+template <class ScalarType>
+void CSmoothedAggregationAMG<ScalarType>::Build(const CSysMatrix<ScalarType>& A, const CGeometry* geometry,
+                                                const CConfig* config) {
+  /*--- The setup is sequential. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto nDim = geometry->GetnDim();
+    const unsigned long nNull = (nDim == 2) ? 3 : 6;
+    std::vector<passivedouble> nullSpace;
+
+    if (!this->isAggregated) {
+      const auto nVar = A.nVar;
+
+      if (nVar != nDim || geometry->GetnPointDomain() != A.nPointDomain)
+        SU2_MPI::Error("The SA_AMG preconditioner requires one block of nDim variables per point (elasticity).",
+                       CURRENT_FUNCTION);
+
+      /*--- Rigid body modes, translations and rotations, the coordinates are relative to the center
+       * of the bounding box and scaled by its size for better conditioning. ---*/
+
+      passivedouble xMin[3] = {0.0}, xMax[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        xMin[iDim] = std::numeric_limits<passivedouble>::max();
+        xMax[iDim] = std::numeric_limits<passivedouble>::lowest();
+      }
+      for (auto iPoint = 0ul; iPoint < A.nPointDomain; ++iPoint) {
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          const auto x = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+          xMin[iDim] = std::min(xMin[iDim], x);
+          xMax[iDim] = std::max(xMax[iDim], x);
+        }
+      }
+      passivedouble scale = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) scale = std::max(scale, xMax[iDim] - xMin[iDim]);
+      if (scale <= 0.0) scale = 1.0;
+
+      nullSpace.resize(A.nPointDomain * nVar * nNull, 0.0);
+
+      for (auto iPoint = 0ul; iPoint < A.nPointDomain; ++iPoint) {
+        passivedouble x[3] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; ++iDim)
+          x[iDim] = (SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)) - 0.5 * (xMin[iDim] + xMax[iDim])) /
+                    scale;
+
+        auto B = [&](unsigned long iVar, unsigned long iMode) -> passivedouble& {
+          return nullSpace[(iPoint * nVar + iVar) * nNull + iMode];
+        };
+        for (auto iDim = 0u; iDim < nDim; ++iDim) B(iDim, iDim) = 1.0;
+
+        if (nDim == 2) {
+          B(0, 2) = -x[1];
+          B(1, 2) = x[0];
+        } else {
+          B(1, 3) = -x[2];
+          B(2, 3) = x[1];
+          B(0, 4) = x[2];
+          B(2, 4) = -x[0];
+          B(0, 5) = -x[1];
+          B(1, 5) = x[0];
+        }
+      }
+    }
+    this->BuildHierarchy(A, config, nNull, std::move(nullSpace), {});
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+/*--- Explicit instantiations, same types as CSysMatrix. ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CSmoothedAggregationAMG<su2double>;
+#else
+template class CSmoothedAggregationAMG<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CSmoothedAggregationAMG<passivedouble>;
+#endif
+#endif
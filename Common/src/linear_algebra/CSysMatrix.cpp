@@ -29,12 +29,15 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CRuntimeProfiler.hpp"
 
 #include <cmath>
+#include <limits>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
   nPoint = nPointDomain = nVar = nEqn = 0;
+  kernelBlockSize = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
 
@@ -63,8 +66,20 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::~CSysMatrix() {
+#ifdef SU2_OMP_OFFLOAD
+  if (onDevice) {
+    const auto* rowPtr = row_ptr;
+    const auto* colInd = col_ind;
+    const auto* values = matrix;
+    const auto* invDiag = invM;
+    const auto nBlkVal = nnz * nVar * nEqn;
+    const auto nDiagVal = nPointDomain * nVar * nEqn;
+    SU2_OMP(target exit data map(release: rowPtr[0:nPointDomain+1], colInd[0:nnz], values[0:nBlkVal], \
+                                  invDiag[0:nDiagVal]))
+  }
+#endif
   delete[] omp_partitions;
-  MemoryAllocation::aligned_free(ILU_matrix);
+  if (!ilu_in_place) MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
 
@@ -113,7 +128,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   }
 
   const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET) || (prec == AMG) || (prec == SA_AMG);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -121,6 +136,18 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Select the specialized kernels for common (square) block sizes, see BLOCK_SIZE_DISPATCH. ---*/
+  kernelBlockSize = 0;
+  if (nVar == nEqn) {
+    switch (nVar) {
+      case 1: case 2: case 4: case 5: case 6: case 7:
+        kernelBlockSize = nVar;
+        break;
+      default:
+        break;
+    }
+  }
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -149,22 +176,29 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
-  }
 
-  /*--- Allocate data. ---*/
-  auto allocAndInit = [](ScalarType*& ptr, unsigned long num) {
-    ptr = MemoryAllocation::aligned_alloc<ScalarType, true>(64, num * sizeof(ScalarType));
-  };
+    if (config->GetLinear_Solver_ILU_Level_Scheduling()) SetILULevels();
+  }
 
-  allocAndInit(matrix, nnz * nVar * nEqn);
+  /*--- 32-bit copies of the patterns for the memory bound kernels, if all the local indices fit. ---*/
 
-  /*--- Preconditioners. ---*/
+  const unsigned long maxIndex = std::numeric_limits<uint32_t>::max();
+  compactIndices = (nPoint < maxIndex) && (nnz < maxIndex) && (nnz_ilu < maxIndex);
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+  if (compactIndices) {
+    row_ptr_32.assign(row_ptr, row_ptr + csr.getOuterSize() + 1);
+    col_ind_32.assign(col_ind, col_ind + nnz);
 
-  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+    if (ilu_needed) {
+      const auto nRowsILU = geometry->GetSparsePattern(type, ilu_fill_in).getOuterSize();
+      row_ptr_ilu_32.assign(row_ptr_ilu, row_ptr_ilu + nRowsILU + 1);
+      dia_ptr_ilu_32.assign(dia_ptr_ilu, dia_ptr_ilu + nRowsILU);
+      col_ind_ilu_32.assign(col_ind_ilu, col_ind_ilu + nnz_ilu);
+    }
+  }
 
-  /*--- Thread parallel initialization. ---*/
+  /*--- Allocate data. ---*/
+  const MemoryAllocation::CCategoryScope memCategory(MemoryAllocation::CATEGORY::JACOBIAN);
 
   int num_threads = omp_get_max_threads();
 
@@ -173,6 +207,24 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   omp_light_size = computeStaticChunkSize(nnz * nVar * nEqn, num_threads, OMP_MAX_SIZE_L);
   omp_heavy_size = computeStaticChunkSize(nPointDomain, num_threads, OMP_MAX_SIZE_H);
 
+  /*--- Arithmetic types are zeroed with the schedule of the light loops (NUMA first touch),
+   * the others need to be zeroed before they are constructed by assignment. ---*/
+  auto allocAndInit = [](ScalarType*& ptr, unsigned long num, unsigned long chunk) {
+    constexpr bool firstTouch = std::is_arithmetic<ScalarType>::value;
+    ptr = MemoryAllocation::aligned_alloc<ScalarType, !firstTouch>(64, num * sizeof(ScalarType));
+    if (firstTouch) parallelFirstTouch(num, chunk, ScalarType(0), ptr);
+  };
+
+  allocAndInit(matrix, nnz * nVar * nEqn, omp_light_size);
+
+  /*--- Preconditioners. ---*/
+
+  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn, omp_light_size);
+
+  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn, omp_heavy_size * nVar * nEqn);
+
+  /*--- Thread parallel initialization. ---*/
+
   omp_num_parts = config->GetLinear_Solver_Prec_Threads();
   if (omp_num_parts == 0) omp_num_parts = num_threads;
 
@@ -344,6 +396,8 @@ template <class T>
 void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CConfig* config, MPI_QUANTITIES commType) {
   if (geometry->nP2PRecv == 0) return;
 
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::COMMUNICATION);
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -453,6 +507,45 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 #endif
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetILULevels() {
+  /*--- The level of a row is one more than the maximum level of the rows it depends on, i.e. of the
+   *    columns of its lower part (forward substitution) or of its upper part (backward substitution).
+   *    Couplings with halos are not considered as the ILU is local to each rank. ---*/
+
+  auto sortByLevel = [this](const vector<unsigned long>& level, vector<unsigned long>& ptr,
+                            vector<unsigned long>& row) {
+    const auto nLevel = *max_element(level.begin(), level.end()) + 1;
+    ptr.assign(nLevel + 1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) ++ptr[level[iPoint] + 1];
+    for (auto iLevel = 0ul; iLevel < nLevel; ++iLevel) ptr[iLevel + 1] += ptr[iLevel];
+
+    auto pos = ptr;
+    row.resize(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) row[pos[level[iPoint]]++] = iPoint;
+  };
+
+  vector<unsigned long> level(nPointDomain, 0);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      level[iPoint] = max(level[iPoint], level[col_ind_ilu[index]] + 1);
+  }
+  sortByLevel(level, ilu_lower_level_ptr, ilu_lower_level_row);
+
+  level.assign(nPointDomain, 0);
+
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    iPoint--;  // unsigned type
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; ++index) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      level[iPoint] = max(level[iPoint], level[jPoint] + 1);
+    }
+  }
+  sortByLevel(level, ilu_upper_level_ptr, ilu_upper_level_row);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::SetValZero() {
   const auto size = nnz * nVar * nEqn;
@@ -479,24 +572,7 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf(LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs(LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1);
 #else
-#define A(I, J) matrix[(I)*nVar + (J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar, jVar) / A(jVar, jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++) A(iVar, kVar) -= weight * A(jVar, kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--;  // unsigned type
-    for (auto jVar = iVar + 1; jVar < nVar; jVar++) vec[iVar] -= A(iVar, jVar) * vec[jVar];
-    vec[iVar] /= A(iVar, iVar);
-  }
-#undef A
+  gauss_elimination_impl(nVar, matrix, vec);
 #endif
 }
 
@@ -562,9 +638,58 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   }
 }
 
+/*--- Calls the version of a member function template that is specialized for the block size (kernelBlockSize). ---*/
+#define BLOCK_SIZE_DISPATCH(FUNCTION, ...) \
+  switch (kernelBlockSize) {               \
+    case 1:                                \
+      FUNCTION<1>(__VA_ARGS__);            \
+      break;                               \
+    case 2:                                \
+      FUNCTION<2>(__VA_ARGS__);            \
+      break;                               \
+    case 4:                                \
+      FUNCTION<4>(__VA_ARGS__);            \
+      break;                               \
+    case 5:                                \
+      FUNCTION<5>(__VA_ARGS__);            \
+      break;                               \
+    case 6:                                \
+      FUNCTION<6>(__VA_ARGS__);            \
+      break;                               \
+    case 7:                                \
+      FUNCTION<7>(__VA_ARGS__);            \
+      break;                               \
+    default:                               \
+      FUNCTION<0>(__VA_ARGS__);            \
+      break;                               \
+  }
+
+template <class ScalarType>
+template <size_t N>
+void CSysMatrix<ScalarType>::RowProductLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  if (compactIndices) {
+    RowProductLoop<N>(vec, prod, row_ptr_32.data(), col_ind_32.data());
+  } else {
+    RowProductLoop<N>(vec, prod, row_ptr, col_ind);
+  }
+}
+
+template <class ScalarType>
+template <size_t N, class Index_t>
+void CSysMatrix<ScalarType>::RowProductLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                            const Index_t* rowPtr, const Index_t* colInd) const {
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+    RowProduct<N>(vec, row_i, &prod[row_i * nVar], rowPtr, colInd);
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::SPMV);
+
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
 #ifndef NDEBUG
   if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
@@ -581,11 +706,7 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
-  }
-  END_SU2_OMP_FOR
+  BLOCK_SIZE_DISPATCH(RowProductLoop, vec, prod)
 
   /*--- MPI Parallelization. ---*/
 
@@ -618,11 +739,97 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+bool CSysMatrix<ScalarType>::UpdateDevice() {
+#ifdef SU2_OMP_OFFLOAD
+  if (invM == nullptr || nVar != nEqn || omp_get_num_devices() == 0) return false;
+
+  const auto* rowPtr = row_ptr;
+  const auto* colInd = col_ind;
+  const auto* values = matrix;
+  const auto* invDiag = invM;
+  const auto nBlkVal = nnz * nVar * nEqn;
+  const auto nDiagVal = nPointDomain * nVar * nEqn;
+
+  /*--- The pattern does not change, only the values are copied after the first call. ---*/
+  if (!onDevice) {
+    SU2_OMP(target enter data map(to: rowPtr[0:nPointDomain+1], colInd[0:nnz]) \
+                               map(alloc: values[0:nBlkVal], invDiag[0:nDiagVal]))
+    onDevice = true;
+  }
+  SU2_OMP(target update to(values[0:nBlkVal], invDiag[0:nDiagVal]))
+  return true;
+#else
+  return false;
+#endif
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::DeviceMatrixVectorProduct(const ScalarType* vec, ScalarType* prod) const {
+#ifdef SU2_OMP_OFFLOAD
+  const auto* rowPtr = row_ptr;
+  const auto* colInd = col_ind;
+  const auto* values = matrix;
+  const auto nRows = nPointDomain;
+  const auto nv = nVar;
+  const auto nBlkVal = nnz * nVar * nVar;
+  const auto nVecVal = nPoint * nVar;
+
+  SU2_OMP(target teams distribute parallel for map(to: rowPtr[0:nRows+1], colInd[0:nnz], values[0:nBlkVal], \
+                                                        vec[0:nVecVal]) map(from: prod[0:nRows*nv]))
+  for (unsigned long iPoint = 0; iPoint < nRows; iPoint++) {
+    for (unsigned long iVar = 0; iVar < nv; iVar++) {
+      ScalarType sum = 0.0;
+      for (auto k = rowPtr[iPoint]; k < rowPtr[iPoint + 1]; k++) {
+        const auto* block = &values[(k * nv + iVar) * nv];
+        const auto* x = &vec[colInd[k] * nv];
+        for (unsigned long jVar = 0; jVar < nv; jVar++) sum += block[jVar] * x[jVar];
+      }
+      prod[iPoint * nv + iVar] = sum;
+    }
+  }
+#endif
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::DeviceJacobiPreconditioner(const ScalarType* vec, ScalarType* prod) const {
+#ifdef SU2_OMP_OFFLOAD
+  const auto* invDiag = invM;
+  const auto nRows = nPointDomain;
+  const auto nv = nVar;
+
+  SU2_OMP(target teams distribute parallel for map(to: invDiag[0:nRows*nv*nv], vec[0:nRows*nv]) \
+                                               map(from: prod[0:nRows*nv]))
+  for (unsigned long iPoint = 0; iPoint < nRows; iPoint++) {
+    for (unsigned long iVar = 0; iVar < nv; iVar++) {
+      ScalarType sum = 0.0;
+      const auto* block = &invDiag[(iPoint * nv + iVar) * nv];
+      for (unsigned long jVar = 0; jVar < nv; jVar++) sum += block[jVar] * vec[iPoint * nv + jVar];
+      prod[iPoint * nv + iVar] = sum;
+    }
+  }
+#endif
+}
+
+template <class ScalarType>
+bool CSysMatrix<ScalarType>::SetILUInPlace() {
+  if (ILU_matrix == nullptr || ilu_fill_in != 0) return false;
+
+  if (!ilu_in_place) {
+    MemoryAllocation::aligned_free(ILU_matrix);
+    ILU_matrix = matrix;
+    ilu_in_place = true;
+  }
+  return true;
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
-  if (ilu_fill_in == 0) {
+  if (ilu_in_place) {
+    /*--- ILU0 over the matrix itself, nothing to copy. ---*/
+  } else if (ilu_fill_in == 0) {
     /*--- ILU0, direct copy. ---*/
     SU2_OMP_FOR_STAT(omp_light_size)
     for (auto iVar = 0ul; iVar < nnz * nVar * nVar; ++iVar) ILU_matrix[iVar] = matrix[iVar];
@@ -647,6 +854,22 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (!ilu_lower_level_ptr.empty()) {
+    /*--- Level scheduling, all the rows of a level can be factorized in parallel
+     *    since they only depend on rows of previous levels. ---*/
+
+    for (auto iLevel = 0ul; iLevel + 1 < ilu_lower_level_ptr.size(); ++iLevel) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = ilu_lower_level_ptr[iLevel]; k < ilu_lower_level_ptr[iLevel + 1]; ++k) {
+        const auto iPoint = ilu_lower_level_row[k];
+        FactorizeILURow(iPoint, 0, nPointDomain);
+        InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+      }
+      END_SU2_OMP_FOR
+    }
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -655,71 +878,86 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
 
     /*--- Each thread will work on the submatrix defined from row/col "begin"
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+    for (auto iPoint = begin; iPoint < end; iPoint++) {
+      FactorizeILURow(iPoint, begin, end);
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+      /*--- Invert and store the diagonal block to later compute the weights of the next rows. ---*/
 
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+}
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+template <class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
-        auto jPoint = col_ind_ilu[index];
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+    auto jPoint = col_ind_ilu[index];
 
-        if (jPoint < begin) continue;
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+    if (jPoint < begin) continue;
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-          auto kPoint = col_ind_ilu[index_];
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
 
-          if (kPoint >= end) break;
+      auto kPoint = col_ind_ilu[index_];
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+      if (kPoint >= end) break;
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
-
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
       }
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
   }
-  END_SU2_OMP_FOR
 }
 
 template <class ScalarType>
-void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
-                                                      CGeometry* geometry, const CConfig* config) const {
-  /*--- Coherent view of vectors. ---*/
-  SU2_OMP_BARRIER
+template <size_t N>
+void CSysMatrix<ScalarType>::ILUSubstitutionLoop(const CSysVector<ScalarType>& vec,
+                                                 CSysVector<ScalarType>& prod) const {
+  if (compactIndices) {
+    ILUSubstitutionLoop<N>(vec, prod, row_ptr_ilu_32.data(), dia_ptr_ilu_32.data(), col_ind_ilu_32.data());
+  } else {
+    ILUSubstitutionLoop<N>(vec, prod, row_ptr_ilu, dia_ptr_ilu, col_ind_ilu);
+  }
+}
+
+template <class ScalarType>
+template <size_t N, class Index_t>
+void CSysMatrix<ScalarType>::ILUSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                 const Index_t* rowPtr, const Index_t* diaPtr,
+                                                 const Index_t* colInd) const {
+  const auto nv = N ? N : nVar;
 
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
@@ -728,22 +966,22 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
     const auto end = omp_partitions[thread + 1];
     if (begin == end) continue;
 
-    ScalarType aux_vec[MAXNVAR];
+    ScalarType aux_vec[N ? N : MAXNVAR];
 
     /*--- Copy vector to then work on prod in place ---*/
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+    for (auto iVar = begin * nv; iVar < end * nv; iVar++) prod[iVar] = vec[iVar];
 
     /*--- Forward solve the system using the lower matrix entries that
      were computed and stored during the ILU preprocessing. Note
      that we are overwriting the residual vector as we go. ---*/
 
     for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
+      for (unsigned long index = rowPtr[iPoint]; index < diaPtr[iPoint]; index++) {
+        const unsigned long jPoint = colInd[index];
         if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+        auto Block_ij = &ILU_matrix[index * nv * nv];
+        BlockVectorProductSub<N>(Block_ij, &prod[jPoint * nv], &prod[iPoint * nv]);
       }
     }
 
@@ -751,35 +989,102 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 
     for (auto iPoint = end; iPoint > begin;) {
       iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      for (auto iVar = 0ul; iVar < nv; iVar++) aux_vec[iVar] = prod[iPoint * nv + iVar];
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
+      for (unsigned long index = diaPtr[iPoint] + 1; index < rowPtr[iPoint + 1]; index++) {
+        const unsigned long jPoint = colInd[index];
         if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
+        auto Block_ij = &ILU_matrix[index * nv * nv];
+        BlockVectorProductSub<N>(Block_ij, &prod[jPoint * nv], aux_vec);
       }
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      BlockVectorProduct<N>(&invM[iPoint * nv * nv], aux_vec, &prod[iPoint * nv]);
     }
   }
   END_SU2_OMP_FOR
+}
 
-  /*--- MPI Parallelization ---*/
+template <class ScalarType>
+template <size_t N>
+void CSysMatrix<ScalarType>::ILULevelSubstitutionLoop(const CSysVector<ScalarType>& vec,
+                                                      CSysVector<ScalarType>& prod) const {
+  if (compactIndices) {
+    ILULevelSubstitutionLoop<N>(vec, prod, row_ptr_ilu_32.data(), dia_ptr_ilu_32.data(), col_ind_ilu_32.data());
+  } else {
+    ILULevelSubstitutionLoop<N>(vec, prod, row_ptr_ilu, dia_ptr_ilu, col_ind_ilu);
+  }
+}
 
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+template <class ScalarType>
+template <size_t N, class Index_t>
+void CSysMatrix<ScalarType>::ILULevelSubstitutionLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      const Index_t* rowPtr, const Index_t* diaPtr,
+                                                      const Index_t* colInd) const {
+  const auto nv = N ? N : nVar;
+
+  /*--- Forward solve, the rows of a level only depend on rows of previous levels. ---*/
+
+  for (auto iLevel = 0ul; iLevel + 1 < ilu_lower_level_ptr.size(); ++iLevel) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = ilu_lower_level_ptr[iLevel]; k < ilu_lower_level_ptr[iLevel + 1]; ++k) {
+      const auto iPoint = ilu_lower_level_row[k];
+      for (auto iVar = 0ul; iVar < nv; iVar++) prod[iPoint * nv + iVar] = vec[iPoint * nv + iVar];
+
+      for (unsigned long index = rowPtr[iPoint]; index < diaPtr[iPoint]; index++) {
+        const unsigned long jPoint = colInd[index];
+        BlockVectorProductSub<N>(&ILU_matrix[index * nv * nv], &prod[jPoint * nv], &prod[iPoint * nv]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Backwards substitution, with the levels of the upper factor. ---*/
+
+  for (auto iLevel = 0ul; iLevel + 1 < ilu_upper_level_ptr.size(); ++iLevel) {
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = ilu_upper_level_ptr[iLevel]; k < ilu_upper_level_ptr[iLevel + 1]; ++k) {
+      const auto iPoint = ilu_upper_level_row[k];
+
+      ScalarType aux_vec[N ? N : MAXNVAR];
+      for (auto iVar = 0ul; iVar < nv; iVar++) aux_vec[iVar] = prod[iPoint * nv + iVar];
+
+      for (unsigned long index = diaPtr[iPoint] + 1; index < rowPtr[iPoint + 1]; index++) {
+        const unsigned long jPoint = colInd[index];
+        if (jPoint >= nPointDomain) break;
+        BlockVectorProductSub<N>(&ILU_matrix[index * nv * nv], &prod[jPoint * nv], aux_vec);
+      }
+
+      BlockVectorProduct<N>(&invM[iPoint * nv * nv], aux_vec, &prod[iPoint * nv]);
+    }
+    END_SU2_OMP_FOR
+  }
 }
 
 template <class ScalarType>
-void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
-                                                         CSysVector<ScalarType>& prod, CGeometry* geometry,
-                                                         const CConfig* config) const {
-  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
+void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::ILU);
 
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  if (ilu_lower_level_ptr.empty()) {
+    BLOCK_SIZE_DISPATCH(ILUSubstitutionLoop, vec, prod)
+  } else {
+    BLOCK_SIZE_DISPATCH(ILULevelSubstitutionLoop, vec, prod)
+  }
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
+template <class ScalarType>
+template <size_t N>
+void CSysMatrix<ScalarType>::LU_SGSForwardLoop(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const {
+  const auto nv = N ? N : nVar;
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
@@ -792,23 +1097,23 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
      *    This is NOT exactly equivalent to the MPI implementation on the same
      *    number of domains, for that we would need to define "thread-halos". ---*/
 
-    ScalarType low_prod[MAXNVAR];
+    ScalarType low_prod[N ? N : MAXNVAR];
 
     for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint * nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);         // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]);  // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);               // Solve D.x* = y
+      auto idx = iPoint * nv;
+      LowerProduct<N>(prod, iPoint, begin, low_prod);  // Compute L.x*
+      for (auto iVar = 0ul; iVar < nv; iVar++)         // Compute y = b - L.x*
+        prod[idx + iVar] = vec[idx + iVar] - low_prod[iVar];
+      Gauss_Elimination<N>(iPoint, &prod[idx]);  // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
+}
 
-  /*--- MPI Parallelization ---*/
-
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
-
-  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+template <class ScalarType>
+template <size_t N>
+void CSysMatrix<ScalarType>::LU_SGSBackwardLoop(CSysVector<ScalarType>& prod) const {
+  const auto nv = N ? N : nVar;
 
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
@@ -817,18 +1122,40 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
     const auto row_end = omp_partitions[thread + 1];
     if (begin == row_end) continue;
 
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+    ScalarType up_prod[N ? N : MAXNVAR], dia_prod[N ? N : MAXNVAR];
 
     for (auto iPoint = row_end; iPoint > begin;) {
       iPoint--;  // because of unsigned type
-      auto idx = iPoint * nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);           // Compute D.x*
-      UpperProduct(prod, iPoint, row_end, up_prod);      // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]);  // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);             // Solve D.x* = y
+      auto idx = iPoint * nv;
+      DiagonalProduct<N>(prod, iPoint, dia_prod);       // Compute D.x*
+      UpperProduct<N>(prod, iPoint, row_end, up_prod);  // Compute U.x_(n+1)
+      for (auto iVar = 0ul; iVar < nv; iVar++)          // Compute y = D.x*-U.x_(n+1)
+        prod[idx + iVar] = dia_prod[iVar] - up_prod[iVar];
+      Gauss_Elimination<N>(iPoint, &prod[idx]);  // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
+                                                         CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                         const CConfig* config) const {
+  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  BLOCK_SIZE_DISPATCH(LU_SGSForwardLoop, vec, prod)
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+
+  BLOCK_SIZE_DISPATCH(LU_SGSBackwardLoop, prod)
 
   /*--- MPI Parallelization ---*/
 
@@ -970,6 +1297,49 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CGeometry* geometry, const CConfig* config) {
+  /*--- The fine level is smoothed with block-Jacobi. ---*/
+  BuildJacobiPreconditioner();
+
+  amg_hierarchy.Build(*this, geometry, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  amg_hierarchy.Apply(*this, vec.GetBlock(0), prod.GetBlock(0));
+
+  /*--- MPI Parallelization ---*/
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildSAAMGPreconditioner(const CGeometry* geometry, const CConfig* config) {
+  /*--- The fine level is smoothed with block-Jacobi. ---*/
+  BuildJacobiPreconditioner();
+
+  sa_amg_hierarchy.Build(*this, geometry, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeSAAMGPreconditioner(const CSysVector<ScalarType>& vec,
+                                                        CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                        const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  sa_amg_hierarchy.Apply(*this, vec.GetBlock(0), prod.GetBlock(0));
+
+  /*--- MPI Parallelization ---*/
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                                              CSysVector<ScalarType>& res) const {
@@ -983,6 +1353,25 @@ void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol,
   END_SU2_OMP_FOR
 }
 
+template <class ScalarType>
+template <class OtherType>
+void CSysMatrix<ScalarType>::ComputePromotedResidual(const CSysVector<OtherType>& sol, const CSysVector<OtherType>& f,
+                                                     CSysVector<OtherType>& res) const {
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    OtherType aux_vec[MAXNVAR] = {0.0};
+    for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint + 1]; index++) {
+      const auto* block = &matrix[index * nVar * nVar];
+      const auto* x_j = &sol[col_ind[index] * nVar];
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        for (auto jVar = 0ul; jVar < nVar; jVar++) aux_vec[iVar] += OtherType(block[iVar * nVar + jVar]) * x_j[jVar];
+    }
+    for (auto iVar = 0ul; iVar < nVar; iVar++) res[iPoint * nVar + iVar] = aux_vec[iVar] - f[iPoint * nVar + iVar];
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 template <class OtherType>
 void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, const OtherType* x_i,
@@ -1060,7 +1449,26 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned
 }
 
 template <class ScalarType>
-void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
+void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum(const CGeometry* geometry) {
+  if (edge_ptr) {
+    /*--- The FV way, block ji of each edge of i, where j is the other point of the edge. ---*/
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      auto block_ii = &matrix[dia_ptr[iPoint] * nVar * nEqn];
+
+      for (auto k = 0ul; k < nVar * nEqn; ++k) block_ii[k] = 0.0;
+
+      for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+        const auto iNode = (iPoint == geometry->edges->GetNode(iEdge, 0)) ? 1 : 0;
+        MatrixSubtraction(block_ii, &matrix[edge_ptr(iEdge, iNode) * nVar * nEqn], block_ii);
+      }
+    }
+    END_SU2_OMP_FOR
+    return;
+  }
+
+  if (!col_ptr) SU2_MPI::Error("The transpose sparse pattern map is required.", CURRENT_FUNCTION);
+
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
     auto block_ii = &matrix[dia_ptr[iPoint] * nVar * nEqn];
@@ -1165,6 +1573,26 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
   END_SU2_OMP_FOR
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetSubBlocks(const CSysMatrix<ScalarType>& B, unsigned long offset) {
+  bool ok = (row_ptr == B.row_ptr) && (col_ind == B.col_ind) && (nnz == B.nnz) && (offset + B.nVar <= nVar) &&
+            (offset + B.nEqn <= nEqn);
+
+  if (!ok) {
+    SU2_MPI::Error("Matrices do not have compatible sparsity or block sizes.", CURRENT_FUNCTION);
+  }
+
+  SU2_OMP_FOR_STAT(omp_light_size)
+  for (auto k = 0ul; k < nnz; ++k) {
+    const ScalarType* blockB = &B.matrix[k * B.nVar * B.nEqn];
+    ScalarType* blockA = &matrix[k * nVar * nEqn + offset * nEqn + offset];
+
+    for (auto iVar = 0ul; iVar < B.nVar; ++iVar)
+      for (auto jVar = 0ul; jVar < B.nEqn; ++jVar) blockA[iVar * nEqn + jVar] = blockB[iVar * B.nEqn + jVar];
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildPastixPreconditioner(CGeometry* geometry, const CConfig* config,
                                                        unsigned short kind_fact) {
@@ -1194,6 +1622,34 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template <class ScalarType>
+unsigned long CSysMatrix<ScalarType>::ComputePetscSolution(const CSysVector<ScalarType>& vec,
+                                                           CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                                           const CConfig* config, passivedouble tol,
+                                                           unsigned long maxIter, bool transposed,
+                                                           passivedouble& residual) const {
+#ifdef HAVE_PETSC
+  /*--- PETSc has its own (MPI) parallelization, the results are shared with the other threads. ---*/
+  static unsigned long iter;
+  static passivedouble res;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    petsc_wrapper.SetMatrix(nVar, nPoint, nPointDomain, row_ptr, col_ind, matrix);
+    petsc_wrapper.Update(geometry, config);
+    iter = petsc_wrapper.Solve(vec, prod, tol, maxIter, transposed, res);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  residual = res;
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+  return iter;
+#else
+  SU2_MPI::Error("SU2 was not compiled with -DHAVE_PETSC", CURRENT_FUNCTION);
+  return 0;
+#endif
+}
+
 /*--- Explicit instantiations ---*/
 
 #define INSTANTIATE_COMMS(TYPE)                                                                                       \
@@ -1205,6 +1661,9 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
   template void CSysMatrix<TYPE>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&); \
   template void CSysMatrix<TYPE>::EnforceSolutionAtDOF(unsigned long, unsigned long, su2double,                   \
                                                        CSysVector<su2double>&);                                   \
+  template void CSysMatrix<TYPE>::ComputePromotedResidual(const CSysVector<su2double>&,                           \
+                                                          const CSysVector<su2double>&,                           \
+                                                          CSysVector<su2double>&) const;                          \
   INSTANTIATE_COMMS(TYPE)
 
 #ifdef CODI_FORWARD_TYPE
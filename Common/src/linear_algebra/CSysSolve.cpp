@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CRuntimeProfiler.hpp"
 
 #include <limits>
 
@@ -139,32 +140,39 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
     SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
   }
 
-  /*--- Begin main Gram-Schmidt loop ---*/
+  /*--- Begin main Gram-Schmidt loop, the subtraction of each projection is fused with the
+   * projection on the next vector (or with the final norm). ---*/
+
+  ScalarType prod = w[i + 1].dot(w[0]);
 
   for (int k = 0; k < i + 1; k++) {
-    ScalarType prod = w[i + 1].dot(w[k]);
     ScalarType h_ki = prod;
-    w[i + 1] -= prod * w[k];
 
     /*--- Check if reorthogonalization is necessary ---*/
 
     if (prod * prod > thr) {
+      w[i + 1] -= prod * w[k];
       prod = w[i + 1].dot(w[k]);
       h_ki += prod;
-      w[i + 1] -= prod * w[k];
     }
     SetHsbg(k, i, h_ki);
 
-    /*--- Update the norm and check its size ---*/
+    if (k < i) {
+      prod = w[i + 1].addAndDot(-prod * w[k], w[k + 1]);
 
-    nrm -= pow(h_ki, 2);
-    nrm = max<ScalarType>(nrm, 0.0);
-    thr = nrm * reorth;
+      /*--- Update the norm and check its size ---*/
+
+      nrm -= pow(h_ki, 2);
+      nrm = max<ScalarType>(nrm, 0.0);
+      thr = nrm * reorth;
+    } else {
+      nrm = w[i + 1].addAndSquaredNorm(-prod * w[k]);
+    }
   }
 
   /*--- Test the resulting vector ---*/
 
-  nrm = w[i + 1].norm();
+  nrm = sqrt(nrm);
   SetHsbg(i + 1, i, nrm);
 
   /*--- Scale the resulting vector ---*/
@@ -172,6 +180,44 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::InitiateBlockDot(int i, const vector<CSysVector<ScalarType> >& w, bool lagged) const {
+  const auto nElm = w[i + 1].GetNElmDomain();
+  const auto nDot = i + 2 + (lagged ? i + 1 : 0);
+  const auto chunk = computeStaticChunkSize(nElm, omp_get_max_threads(), 4096);
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(for (auto k = 0; k < nDot; ++k) dotLocal[k] = 0.0;)
+
+  /*--- Local products, the same static schedule is used for all vectors to keep w[i+1] in cache. ---*/
+
+  for (auto k = 0; k < nDot; ++k) {
+    const auto& u = (k < i + 2) ? w[i + 1] : w[i];
+    const auto& v = (k < i + 2) ? w[k] : w[k - i - 2];
+    ScalarType sum = 0.0;
+    SU2_OMP_FOR_(schedule(static, chunk) SU2_NOWAIT)
+    for (auto iElm = 0ul; iElm < nElm; ++iElm) sum += u[iElm] * v[iElm];
+    END_SU2_OMP_FOR
+    atomicAdd(sum, dotLocal[k]);
+  }
+
+  /*--- Start the reduction across all ranks, only the master thread communicates. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    MPIWrapper::Iallreduce(dotLocal.data(), dotGlobal.data(), nDot, mpi_type, MPI_SUM, SU2_MPI::GetComm(),
+                           &dotRequest);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+const ScalarType* CSysSolve<ScalarType>::CompleteBlockDot() const {
+#ifdef HAVE_MPI
+  SU2_OMP_SAFE_GLOBAL_ACCESS(MPIWrapper::Wait(&dotRequest, MPI_STATUS_IGNORE);)
+#endif
+  return dotGlobal.data();
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -290,20 +336,21 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType>&
     /*--- Update solution and residual: ---*/
 
     x += alpha * p;
-    r -= alpha * A_x;
 
-    /*--- Only compute the residuals in full communication mode. ---*/
+    /*--- Only compute the residuals in full communication mode (fused with the update). ---*/
 
     if (config->GetComm_Level() == COMM_FULL) {
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
+      norm_r = sqrt(r.addAndSquaredNorm(-alpha * A_x));
       if (norm_r < tol * norm0) break;
       if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
         SU2_OMP_MASTER
         WriteHistory(i + 1, norm_r / norm0);
         END_SU2_OMP_MASTER
       }
+    } else {
+      r -= alpha * A_x;
     }
 
     precond(r, z);
@@ -454,21 +501,503 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     if (beta < tol * norm0) break;
 
     if (flexible) {
-      /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
-
+      /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+
+      precond(W[i], Z[i]);
+
+      /*---  Add to Krylov subspace ---*/
+
+      mat_vec(Z[i], W[i + 1]);
+    } else {
+      mat_vec(W[i], W[i + 1]);
+    }
+
+    /*---  Modified Gram-Schmidt orthogonalization ---*/
+
+    if (nestedParallel) {
+      /*--- "omp parallel if" does not work well here ---*/
+      SU2_OMP_PARALLEL
+      ModGramSchmidt(true, i, H, W);
+      END_SU2_OMP_PARALLEL
+    } else {
+      ModGramSchmidt(false, i, H, W);
+    }
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i + 1]);
+
+    /*---  Output the relative residual if necessary ---*/
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  const auto& basis = flexible ? Z : W;
+
+  if (nestedParallel) {
+    SU2_OMP_PARALLEL
+    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+    END_SU2_OMP_PARALLEL
+  } else {
+    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+  }
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("FGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long m, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the preconditioned vectors are always needed. ---*/
+
+  if (W.size() <= m || Z.size() <= m || dotLocal.size() <= 2 * m + 2) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      Z.resize(m + 1);
+      for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      dotLocal.resize(2 * m + 3);
+      dotGlobal.resize(2 * m + 3);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Each thread works on its own copy of the small arrays, see FGMRES_LinSolver. ---*/
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m), Hs(m + 1, m);
+  H = ScalarType(0);
+  Hs = ScalarType(0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  } else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= -beta;
+  g[0] = beta;
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PFGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Start the pipeline, w[1] holds the (not yet orthogonal) product A * z[0]. ---*/
+
+  precond(W[0], Z[0]);
+  mat_vec(Z[0], W[1]);
+
+  /*--- Parameter for reorthogonalization, same as ModGramSchmidt. ---*/
+  const ScalarType reorth = 0.98;
+  ScalarType gLast = g[0];
+
+  for (i = 0; i < m; i++) {
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol * norm0) break;
+
+    /*--- Start the reduction for the orthogonalization of w[i+1], which also measures the loss of
+     orthogonality and the norm of w[i] (lagged reorthogonalization and normalization, as in DCGS2,
+     avoid a second reduction and the amplification of errors by the Pythagorean theorem). ---*/
+
+    const bool lagged = (i > 0);
+    InitiateBlockDot(i, W, lagged);
+
+    /*--- Meanwhile apply the preconditioner and the matrix to the non-orthogonal w[i+1]. ---*/
+
+    const bool next = (i + 1 < m);
+    if (next) {
+      precond(W[i + 1], Z[i + 1]);
+      mat_vec(Z[i + 1], W[i + 2]);
+    }
+
+    const auto* dots = CompleteBlockDot();
+    const ScalarType nrmRaw = dots[i + 1];
+
+    /*--- Happy breakdown, the new direction vanished and the first i columns contain the solution. ---*/
+
+    if ((nrmRaw >= 0.0) && (nrmRaw <= eps * eps)) break;
+
+    if (!(nrmRaw > 0.0)) {
+      SU2_MPI::Error("PFGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+
+    for (unsigned long k = 0; k <= i; k++) Hs(k, i) = dots[k];
+
+    /*--- Reorthogonalize w[i], and correct the dependent quantities: column i-1 of the Hessenberg matrix,
+     the product of w[i+1] with w[i], and the Givens rotation of column i-1 (which is recomputed). ---*/
+
+    if (lagged) {
+      const auto* corr = dots + i + 2;
+      ScalarType scale = corr[i];
+      for (unsigned long k = 0; k < i; k++) {
+        W[i] -= corr[k] * W[k];
+        Hs(k, i - 1) += Hs(i, i - 1) * corr[k];
+        Hs(i, i) -= corr[k] * dots[k];
+        scale -= pow(corr[k], 2);
+      }
+      scale = sqrt(max<ScalarType>(scale, eps));
+      W[i] /= scale;
+      Hs(i, i - 1) *= scale;
+      Hs(i, i) /= scale;
+
+      for (unsigned long k = 0; k <= i; k++) H(k, i - 1) = Hs(k, i - 1);
+      for (unsigned long k = 0; k + 1 < i; k++) ApplyGivens(sn[k], cs[k], H[k][i - 1], H[k + 1][i - 1]);
+      g[i - 1] = gLast;
+      g[i] = 0.0;
+      GenerateGivens(H[i - 1][i - 1], H[i][i - 1], sn[i - 1], cs[i - 1]);
+      ApplyGivens(sn[i - 1], cs[i - 1], g[i - 1], g[i]);
+    }
+
+    /*--- Classical Gram-Schmidt, the norm of the result follows from the Pythagorean theorem. ---*/
+
+    ScalarType nrm = nrmRaw;
+    for (unsigned long k = 0; k <= i; k++) {
+      W[i + 1] -= Hs(k, i) * W[k];
+      nrm -= pow(Hs(k, i), 2);
+    }
+
+    /*--- Reorthogonalize if there was significant cancellation (blocking reduction). ---*/
+
+    const bool cancellation = (nrm < (1 - reorth) * nrmRaw);
+    if (cancellation) {
+      InitiateBlockDot(i, W, false);
+      const auto* again = CompleteBlockDot();
+      nrm = again[i + 1];
+      for (unsigned long k = 0; k <= i; k++) {
+        Hs(k, i) += again[k];
+        nrm -= pow(again[k], 2);
+        W[i + 1] -= again[k] * W[k];
+      }
+    }
+    nrm = sqrt(max<ScalarType>(nrm, 0.0));
+    Hs(i + 1, i) = nrm;
+
+    /*--- Normalize the new basis vector, and apply the same combination to the next direction and to its
+     product, using A * z[k] = sum_j H(j,k) * w[j], such that z[i+1] relates to w[i+1] as z[0] to w[0]. ---*/
+
+    if (nrm > eps) {
+      W[i + 1] /= nrm;
+
+      if (next) {
+        for (unsigned long k = 0; k <= i; k++) Z[i + 1] -= Hs(k, i) * Z[k];
+        Z[i + 1] /= nrm;
+
+        for (unsigned long j = 0; j <= i + 1; j++) {
+          ScalarType coeff = 0.0;
+          for (unsigned long k = (j > 0) ? j - 1 : 0; k <= i; k++) coeff += Hs(k, i) * Hs(j, k);
+          W[i + 2] -= coeff * W[j];
+        }
+        W[i + 2] /= nrm;
+
+        /*--- The recurrence amplifies round-off errors, recompute the product when the basis degrades. ---*/
+
+        if (cancellation) mat_vec(Z[i + 1], W[i + 2]);
+      }
+    }
+
+    /*--- The Givens rotations are applied to a copy as the recurrence needs the original H. ---*/
+
+    for (unsigned long k = 0; k <= i + 1; k++) H(k, i) = Hs(k, i);
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    gLast = g[i];
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    beta = fabs(g[i + 1]);
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    /*--- Happy breakdown. ---*/
+
+    if (nrm <= eps) {
+      i++;
+      break;
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  for (unsigned long k = 0; k < i; k++) x += y[k] * Z[k];
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PFGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::RecycledFGMRES_LinSolver(const CSysVector<ScalarType>& b,
+                                                              CSysVector<ScalarType>& x,
+                                                              const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                              const CPreconditioner<ScalarType>& precond,
+                                                              ScalarType tol, unsigned long m, ScalarType& residual,
+                                                              bool monitoring, const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool flexible = !precond.IsIdentity();
+  const bool nestedParallel = !omp_in_parallel() && omp_get_max_threads() > 1;
+  const unsigned long kMax = config->GetLinear_Solver_Recycle_Size();
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, the recycled subspace is kept between calls (it is reset if
+   * the size of the system changes). ---*/
+
+  const bool recycleReady = (RecycleU.size() == kMax) && (RecycleX0.GetLocSize() == x.GetLocSize());
+
+  if (W.size() <= m || (flexible && Z.size() <= m) || !recycleReady) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      W.resize(m + 1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      if (flexible) {
+        Z.resize(m + 1);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+      if (!recycleReady) {
+        RecycleU.resize(kMax);
+        RecycleC.resize(kMax);
+        for (auto& u : RecycleU) u.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        for (auto& c : RecycleC) c.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        RecycleX0.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        nRecycled = 0;
+        recycleNext = 0;
+
+        if (masterRank) {
+          const auto megaBytes = (2 * kMax + 1) * x.GetLocSize() * sizeof(ScalarType) / 1048576.0;
+          cout << "CSysSolve::RecycledFGMRES(): the recycled subspace of " << kMax << " vectors uses "
+               << megaBytes << " MB on the master rank." << endl;
+        }
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Each thread works on its own copy of the small arrays, see FGMRES_LinSolver. ---*/
+
+  const auto k = nRecycled;
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m), B(max(k, 1ul), m);
+  H = ScalarType(0);
+  B = ScalarType(0);
+  std::vector<char> active(k, true);
+
+  if (xIsZero) x = ScalarType(0);
+  RecycleX0 = x;
+
+  /*--- The recycled vectors (U) are the solution updates of the previous calls, their products with the
+   * current operator (C = A U) are orthonormalized, U is transformed consistently. Vectors that became
+   * linearly dependent are ignored. ---*/
+
+  for (unsigned long j = 0; j < k; j++) {
+    mat_vec(RecycleU[j], RecycleC[j]);
+    const ScalarType norm = RecycleC[j].norm();
+
+    for (unsigned long l = 0; l < j; l++) {
+      if (!active[l]) continue;
+      const ScalarType prod = RecycleC[l].dot(RecycleC[j]);
+      RecycleC[j] -= prod * RecycleC[l];
+      RecycleU[j] -= prod * RecycleU[l];
+    }
+    const ScalarType normOrth = RecycleC[j].norm();
+    active[j] = (normOrth > sqrt(eps) * norm);
+
+    if (active[j]) {
+      RecycleC[j] /= normOrth;
+      RecycleU[j] /= normOrth;
+    }
+  }
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial (negative) residual, and project it out of span(C), i.e. minimize the residual
+   * over x + span(U). ---*/
+
+  mat_vec(x, W[0]);
+  W[0] -= b;
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = W[0].norm();
+
+  for (unsigned long j = 0; j < k; j++) {
+    if (!active[j]) continue;
+    const ScalarType prod = RecycleC[j].dot(W[0]);
+    W[0] -= prod * RecycleC[j];
+    x -= prod * RecycleU[j];
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    /*--- System is already solved ---*/
+
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::RecycledFGMRES(): system solved by initial guess and recycled subspace." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= -beta;
+  g[0] = beta;
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("RecycledFGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*---  Loop over all search directions, the Krylov subspace is built with (I - C C^T) A. ---*/
+
+  for (i = 0; i < m; i++) {
+    if (beta < tol * norm0) break;
+
+    if (flexible) {
       precond(W[i], Z[i]);
-
-      /*---  Add to Krylov subspace ---*/
-
       mat_vec(Z[i], W[i + 1]);
     } else {
       mat_vec(W[i], W[i + 1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    for (unsigned long j = 0; j < k; j++) {
+      if (!active[j]) continue;
+      B(j, i) = RecycleC[j].dot(W[i + 1]);
+      W[i + 1] -= B(j, i) * RecycleC[j];
+    }
 
     if (nestedParallel) {
-      /*--- "omp parallel if" does not work well here ---*/
       SU2_OMP_PARALLEL
       ModGramSchmidt(true, i, H, W);
       END_SU2_OMP_PARALLEL
@@ -476,19 +1005,12 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       ModGramSchmidt(false, i, H, W);
     }
 
-    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
-     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
-
-    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    for (unsigned long l = 0; l < i; l++) ApplyGivens(sn[l], cs[l], H[l][i], H[l + 1][i]);
     GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
     ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
 
-    /*---  Set L2 norm of residual and check if solution has converged ---*/
-
     beta = fabs(g[i + 1]);
 
-    /*---  Output the relative residual if necessary ---*/
-
     if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
       SU2_OMP_MASTER
       WriteHistory(i + 1, beta / norm0);
@@ -496,41 +1018,42 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
     }
   }
 
-  /*---  Solve the least-squares system and update solution ---*/
+  /*---  Solve the least-squares system and update the solution, x += Z y - U B y, since the
+   * residual is orthogonal to span(C) the Krylov and recycled parts of the problem decouple. ---*/
 
   SolveReduced(i, H, g, y);
 
   const auto& basis = flexible ? Z : W;
+  for (unsigned long l = 0; l < i; l++) x += y[l] * basis[l];
 
-  if (nestedParallel) {
-    SU2_OMP_PARALLEL
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
-    END_SU2_OMP_PARALLEL
-  } else {
-    for (unsigned long k = 0; k < i; k++) x += y[k] * basis[k];
+  for (unsigned long j = 0; j < k; j++) {
+    if (!active[j]) continue;
+    ScalarType coef = 0;
+    for (unsigned long l = 0; l < i; l++) coef += B(j, l) * y[l];
+    x -= coef * RecycleU[j];
   }
 
-  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL) && masterRank) {
+    SU2_OMP_MASTER
+    WriteFinalResidual("RecycledFGMRES", i, beta / norm0);
+    END_SU2_OMP_MASTER
+  }
 
-  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
-    if (masterRank) {
-      SU2_OMP_MASTER
-      WriteFinalResidual("FGMRES", i, beta / norm0);
-      END_SU2_OMP_MASTER
-    }
+  /*--- Store the update of this call in the recycled subspace, replacing the oldest vector. ---*/
 
-    if (recomputeRes) {
-      mat_vec(x, W[0]);
-      W[0] -= b;
-      ScalarType res = W[0].norm();
+  if (kMax > 0) {
+    auto& u = RecycleU[recycleNext];
+    u = x;
+    u -= RecycleX0;
+    const ScalarType norm = u.norm();
 
-      if (fabs(res - beta) > tol * 10) {
-        if (masterRank) {
-          SU2_OMP_MASTER
-          WriteWarning(beta, res, tol);
-          END_SU2_OMP_MASTER
-        }
+    if (norm > eps) {
+      u /= norm;
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+        recycleNext = (recycleNext + 1) % kMax;
+        nRecycled = min(nRecycled + 1, kMax);
       }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
     }
   }
 
@@ -687,27 +1210,29 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
     /*--- Calculate step-length omega, avoid division by 0. ---*/
 
-    omega = A_x.squaredNorm();
+    ScalarType A_x_r;
+    A_x.dot(A_x, r, omega, A_x_r);
     if (omega == ScalarType(0)) break;
-    omega = A_x.dot(r) / omega;
+    omega = A_x_r / omega;
 
     /*--- Update solution and residual ---*/
 
     x += omega * z;
-    r -= omega * A_x;
 
-    /*--- Only compute the residuals in full communication mode. ---*/
+    /*--- Only compute the residuals in full communication mode (fused with the update). ---*/
 
     if (config->GetComm_Level() == COMM_FULL) {
       /*--- Check if solution has converged, else output the relative residual if necessary ---*/
 
-      norm_r = r.norm();
+      norm_r = sqrt(r.addAndSquaredNorm(-omega * A_x));
       if (norm_r < tol * norm0) break;
       if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
         SU2_OMP_MASTER
         WriteHistory(i + 1, norm_r / norm0);
         END_SU2_OMP_MASTER
       }
+    } else {
+      r -= omega * A_x;
     }
   }
 
@@ -737,6 +1262,321 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+#ifdef SU2_OMP_OFFLOAD
+namespace {
+/*--- Vector kernels of DEVICE_BCGSTAB, the vectors are already on the device. The first "n" entries of the
+ * vectors are owned, "nTot" includes the halos. ---*/
+
+/*!
+ * \brief r = r_0 = b - A_x (or b if A_x is null), p = v = 0, and the local sums of r.r and b.b.
+ */
+template <class T>
+void DeviceInitialResidual(const T* b, const T* A_x, T* r, T* r_0, T* p, T* v, unsigned long n, T* sums) {
+  T rr = 0.0, bb = 0.0;
+  const bool zeroGuess = (A_x == nullptr);
+  if (zeroGuess) A_x = b;
+
+  SU2_OMP(target teams distribute parallel for reduction(+:rr, bb) map(tofrom: rr, bb) \
+          map(to: b[0:n], A_x[0:n]) map(from: r[0:n], r_0[0:n], p[0:n], v[0:n]))
+  for (unsigned long i = 0; i < n; i++) {
+    const T res = zeroGuess ? b[i] : b[i] - A_x[i];
+    r[i] = res;
+    r_0[i] = res;
+    p[i] = 0.0;
+    v[i] = 0.0;
+    rr += res * res;
+    bb += b[i] * b[i];
+  }
+  sums[0] = rr;
+  sums[1] = bb;
+}
+
+/*!
+ * \brief Local sums of u.w and (optionally) u.y.
+ */
+template <class T>
+void DeviceDots(const T* u, const T* w, const T* y, unsigned long n, T* sums) {
+  T uw = 0.0, uy = 0.0;
+  const bool second = (y != nullptr);
+  if (!second) y = w;
+
+  SU2_OMP(target teams distribute parallel for reduction(+:uw, uy) map(tofrom: uw, uy) \
+          map(to: u[0:n], w[0:n], y[0:n]))
+  for (unsigned long i = 0; i < n; i++) {
+    uw += u[i] * w[i];
+    if (second) uy += u[i] * y[i];
+  }
+  sums[0] = uw;
+  sums[1] = uy;
+}
+
+/*!
+ * \brief p = beta * (p - omega * v) + r.
+ */
+template <class T>
+void DeviceUpdateDirection(T beta, T omega, const T* r, const T* v, T* p, unsigned long n) {
+  SU2_OMP(target teams distribute parallel for map(to: r[0:n], v[0:n]) map(tofrom: p[0:n]))
+  for (unsigned long i = 0; i < n; i++) p[i] = beta * (p[i] - omega * v[i]) + r[i];
+}
+
+/*!
+ * \brief x += a * z (including the halos), r -= a * w, and the local sum of r.r.
+ */
+template <class T>
+T DeviceUpdateSolution(T a, const T* z, const T* w, T* x, T* r, unsigned long n, unsigned long nTot) {
+  T rr = 0.0;
+  SU2_OMP(target teams distribute parallel for map(to: z[0:nTot]) map(tofrom: x[0:nTot]))
+  for (unsigned long i = 0; i < nTot; i++) x[i] += a * z[i];
+
+  SU2_OMP(target teams distribute parallel for reduction(+:rr) map(tofrom: rr) map(to: w[0:n]) map(tofrom: r[0:n]))
+  for (unsigned long i = 0; i < n; i++) {
+    r[i] -= a * w[i];
+    rr += r[i] * r[i];
+  }
+  return rr;
+}
+}  // namespace
+#endif
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::DeviceBCGSTAB_LinSolver(const VectorType& b, VectorType& x,
+                                                             const MatrixType& matrix, CGeometry* geometry,
+                                                             ScalarType tol, unsigned long m, ScalarType& residual,
+                                                             bool monitoring, const CConfig* config) const {
+#ifndef SU2_OMP_OFFLOAD
+  SU2_MPI::Error("DEVICE_BCGSTAB requires a build with OpenMP offloading (enable-omp-target).", CURRENT_FUNCTION);
+  return 0;
+#else
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  const bool fullComms = (config->GetComm_Level() == COMM_FULL);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Same work vectors as BCGSTAB, their host memory is used to exchange the halos. ---*/
+
+  if (!bcg_ready) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      r_0.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      p.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      v.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      bcg_ready = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  const unsigned long n = b.GetNBlkDomain() * b.GetNVar();
+  const unsigned long nTot = b.GetLocSize();
+  const bool haloComms = (nTot > n) || (SU2_MPI::GetSize() > 1);
+
+  const ScalarType* b_d = &b[0];
+  ScalarType* x_d = &x[0];
+  ScalarType* r_d = &r[0];
+  ScalarType* r_0_d = &r_0[0];
+  ScalarType* p_d = &p[0];
+  ScalarType* v_d = &v[0];
+  ScalarType* z_d = &z[0];
+  ScalarType* A_x_d = &A_x[0];
+
+  /*--- The kernels are launched by the master thread, the other threads only take part in the halo exchanges,
+   * the sums computed by the master thread are reduced over the ranks and shared with all threads. ---*/
+
+  static ScalarType shared[2];
+
+  auto shareSums = [&](ScalarType (&sums)[2]) {
+    SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(sums, shared, 2, mpi_type, MPI_SUM, SU2_MPI::GetComm());
+#else
+      shared[0] = sums[0];
+      shared[1] = sums[1];
+#endif
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    sums[0] = shared[0];
+    sums[1] = shared[1];
+    SU2_OMP_BARRIER
+  };
+
+  auto exchangeHalos = [&](VectorType& vec, ScalarType* vec_d) {
+    if (!haloComms) return;
+    SU2_OMP_MASTER {
+      SU2_OMP(target update from(vec_d[0:n]))
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    CSysMatrixComms::Initiate(vec, geometry, config);
+    CSysMatrixComms::Complete(vec, geometry, config);
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      SU2_OMP(target update to(vec_d[n:nTot-n]))
+    }
+    END_SU2_OMP_MASTER
+  };
+
+  SU2_OMP_MASTER {
+    SU2_OMP(target enter data map(to: b_d[0:nTot], x_d[0:nTot]) \
+                               map(alloc: r_d[0:nTot], r_0_d[0:nTot], p_d[0:nTot], v_d[0:nTot], z_d[0:nTot], \
+                                          A_x_d[0:nTot]))
+  }
+  END_SU2_OMP_MASTER
+
+  /*--- Initial residual (the halos of x are up to date on entry). ---*/
+
+  ScalarType sums[2] = {0.0, 0.0};
+
+  SU2_OMP_MASTER {
+    if (!xIsZero) matrix.DeviceMatrixVectorProduct(x_d, A_x_d);
+    DeviceInitialResidual<ScalarType>(b_d, xIsZero ? nullptr : A_x_d, r_d, r_0_d, p_d, v_d, n, sums);
+  }
+  END_SU2_OMP_MASTER
+  shareSums(sums);
+
+  bool solved = false;
+
+  if (fullComms) {
+    norm_r = sqrt(sums[0]);
+    norm0 = sqrt(sums[1]);
+
+    if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+    if ((norm_r < tol * norm0) || (norm_r < eps)) {
+      if (masterRank) {
+        SU2_OMP_MASTER
+        cout << "CSysSolve::DEVICE_BCGSTAB(): system solved by initial guess." << endl;
+        END_SU2_OMP_MASTER
+      }
+      solved = true;
+    } else if ((monitoring) && (masterRank)) {
+      SU2_OMP_MASTER {
+        WriteHeader("DEVICE_BCGSTAB", tol, norm_r);
+        WriteHistory(i, norm_r / norm0);
+      }
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  ScalarType alpha = 1.0, omega = 1.0, rho = 1.0, rho_prime = 1.0;
+
+  for (i = 0; i < m && !solved; i++) {
+    /*--- rho_i and the update of p. ---*/
+
+    rho_prime = rho;
+    SU2_OMP_MASTER
+    DeviceDots<ScalarType>(r_d, r_0_d, nullptr, n, sums);
+    END_SU2_OMP_MASTER
+    shareSums(sums);
+    rho = sums[0];
+
+    const ScalarType beta = (rho / rho_prime) * (alpha / omega);
+
+    SU2_OMP_MASTER {
+      DeviceUpdateDirection(beta, omega, r_d, v_d, p_d, n);
+      matrix.DeviceJacobiPreconditioner(p_d, z_d);
+    }
+    END_SU2_OMP_MASTER
+    exchangeHalos(z, z_d);
+
+    /*--- Step length alpha, update of the solution and residual. ---*/
+
+    SU2_OMP_MASTER {
+      matrix.DeviceMatrixVectorProduct(z_d, v_d);
+      DeviceDots<ScalarType>(r_0_d, v_d, nullptr, n, sums);
+    }
+    END_SU2_OMP_MASTER
+    shareSums(sums);
+    alpha = rho / sums[0];
+
+    SU2_OMP_MASTER {
+      DeviceUpdateSolution(alpha, z_d, v_d, x_d, r_d, n, nTot);
+      matrix.DeviceJacobiPreconditioner(r_d, z_d);
+    }
+    END_SU2_OMP_MASTER
+    exchangeHalos(z, z_d);
+
+    /*--- Step length omega (avoid division by 0), update of the solution and residual. ---*/
+
+    SU2_OMP_MASTER {
+      matrix.DeviceMatrixVectorProduct(z_d, A_x_d);
+      DeviceDots<ScalarType>(A_x_d, A_x_d, r_d, n, sums);
+    }
+    END_SU2_OMP_MASTER
+    shareSums(sums);
+    if (sums[0] == ScalarType(0)) break;
+    omega = sums[1] / sums[0];
+
+    SU2_OMP_MASTER {
+      sums[0] = DeviceUpdateSolution(omega, z_d, A_x_d, x_d, r_d, n, nTot);
+      sums[1] = 0.0;
+    }
+    END_SU2_OMP_MASTER
+
+    if (fullComms) {
+      shareSums(sums);
+      norm_r = sqrt(sums[0]);
+      if (norm_r < tol * norm0) break;
+      if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
+        SU2_OMP_MASTER
+        WriteHistory(i + 1, norm_r / norm0);
+        END_SU2_OMP_MASTER
+      }
+    }
+  }
+
+  /*--- Copy the solution back (including the halos), the other vectors are not needed on the host. ---*/
+
+  SU2_OMP_MASTER {
+    SU2_OMP(target exit data map(from: x_d[0:nTot]) \
+                              map(release: b_d[0:nTot], r_d[0:nTot], r_0_d[0:nTot], p_d[0:nTot], v_d[0:nTot], \
+                                           z_d[0:nTot], A_x_d[0:nTot]))
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  if (solved) return 0;
+
+  if ((monitoring) && fullComms && masterRank) {
+    SU2_OMP_MASTER
+    WriteFinalResidual("DEVICE_BCGSTAB", i, norm_r / norm0);
+    END_SU2_OMP_MASTER
+  }
+
+  residual = norm_r / norm0;
+  return i;
+#endif
+}
+
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PETSc_LinSolver(const MatrixType& matrix, const VectorType& b, VectorType& x,
+                                                     ScalarType tol, unsigned long m, bool transposed,
+                                                     ScalarType& residual, bool monitoring, CGeometry* geometry,
+                                                     const CConfig* config) const {
+  passivedouble res = 0.0;
+  const auto iter =
+      matrix.ComputePetscSolution(b, x, geometry, config, SU2_TYPE::GetValue(tol), m, transposed, res);
+  residual = res;
+
+  if (monitoring && (SU2_MPI::GetRank() == MASTER_NODE)) {
+    SU2_OMP_MASTER
+    WriteFinalResidual("PETSc", iter, residual);
+    END_SU2_OMP_MASTER
+  }
+  return iter;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                         const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -876,6 +1716,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
    derivatives of the residual in CSysSolve_b.
   ---*/
 
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::LINEAR_SOLVER);
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter;
   ScalarType SolverTol;
@@ -915,6 +1757,45 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     }
   }
 
+  /*--- Decide if the preconditioner built by a previous call can be reused, this is only done for the
+   * preconditioners whose build dominates the cost (factorizations or inverse of the diagonal), and
+   * until the maximum age is reached or the number of iterations grows too much w.r.t. the first
+   * solve after the last build. ---*/
+
+  const unsigned long maxPrecAge =
+      (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD) ? config->GetLinear_Solver_Prec_Reuse() : 0;
+  const bool reusablePrec = (KindPrecond == ILU) || (KindPrecond == LINELET) || (KindPrecond == AMG) ||
+                            (KindPrecond == SA_AMG);
+
+  /*--- The gradient smoothing system is not recorded, its preconditioner can be reused in adjoint runs. ---*/
+  const bool reuseAllowed = !config->GetDiscrete_Adjoint() || (lin_sol_mode == LINEAR_SOLVER_MODE::GRADIENT_MODE);
+
+  /*--- A direct factorization is only reused if the matrix did not change. ---*/
+  const bool factorizationReused = precReady && reuseAllowed && matrixUnchanged;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto maxIter = SU2_TYPE::GetValue(config->GetLinear_Solver_Prec_Reuse_Growth()) * max(precRefIter, 1ul);
+
+    precReused = precReady && reusablePrec && reuseAllowed &&
+                 (matrixUnchanged || ((precAge < maxPrecAge) && (Iterations <= maxIter)));
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Number of refinement steps, only worthwhile if the linear algebra is done in lower precision. ---*/
+
+  const unsigned long nRefine = (!std::is_same<ScalarType, su2double>::value && !config->GetDiscrete_Adjoint() &&
+                                 lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD)
+                                    ? config->GetLinear_Solver_Refinement_Iter()
+                                    : 0;
+
+  if (nRefine > 0) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      RefineRes.Initialize(LinSysRes.GetNBlk(), LinSysRes.GetNBlkDomain(), LinSysRes.GetNVar(), nullptr);
+      RefineSol.Initialize(LinSysRes.GetNBlk(), LinSysRes.GetNBlkDomain(), LinSysRes.GetNVar(), nullptr);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
   /*--- Stop the recording for the linear solver ---*/
   bool TapeActive = NO;
 
@@ -954,52 +1835,102 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     /*--- Build preconditioner. ---*/
 
-    precond->Build();
+    if (!precReused) {
+      const CRuntimeProfiler::CScope profilePrec(CRuntimeProfiler::SECTION::PRECONDITIONER);
+      precond->Build();
+    }
+
+    /*--- The device solver needs a device, otherwise BCGSTAB is used on the host. ---*/
+
+    if (KindSolver == DEVICE_BCGSTAB) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(deviceSolve = (kindPrec == JACOBI) && Jacobian.UpdateDevice();)
+    }
 
     /*--- Solve system. ---*/
 
+    auto solveSystem = [&](const VectorType& rhs, VectorType& sol, ScalarType& residual) {
+      switch (KindSolver) {
+        case DEVICE_BCGSTAB:
+        case BCGSTAB:
+          if (KindSolver == DEVICE_BCGSTAB && deviceSolve) {
+            return DeviceBCGSTAB_LinSolver(rhs, sol, Jacobian, geometry, SolverTol, MaxIter, residual, ScreenOutput,
+                                           config);
+          }
+          return BCGSTAB_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case FGMRES:
+          return FGMRES_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case RESTARTED_FGMRES:
+          return RFGMRES_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case PIPELINED_FGMRES:
+          return PFGMRES_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case RECYCLED_FGMRES:
+          return RecycledFGMRES_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput,
+                                          config);
+        case CONJUGATE_GRADIENT:
+          return CG_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case SMOOTHER:
+          return Smoother_LinSolver(rhs, sol, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+        case PASTIX_LDLT:
+        case PASTIX_LU:
+          if (!factorizationReused) Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+          Jacobian.ComputePastixPreconditioner(rhs, sol, geometry, config);
+          residual = 1e-20;
+          return 1ul;
+        case PETSC:
+          return PETSc_LinSolver(Jacobian, rhs, sol, SolverTol, MaxIter, false, residual, ScreenOutput, geometry,
+                                 config);
+        default:
+          SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
+      }
+      return 0ul;
+    };
+
     ScalarType residual = 0.0;
 
-    switch (KindSolver) {
-      case BCGSTAB:
-        IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                       ScreenOutput, config);
-        break;
-      case FGMRES:
-        IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                      ScreenOutput, config);
-        break;
-      case RESTARTED_FGMRES:
-        IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                       ScreenOutput, config);
-        break;
-      case CONJUGATE_GRADIENT:
-        IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                  ScreenOutput, config);
-        break;
-      case SMOOTHER:
-        IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                        ScreenOutput, config);
-        break;
-      case PASTIX_LDLT:
-      case PASTIX_LU:
-        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-        Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-        IterLinSol = 1;
-        residual = 1e-20;
-        break;
-      default:
-        SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
+    IterLinSol = solveSystem(*LinSysRes_ptr, *LinSysSol_ptr, residual);
+
+    HandleTemporariesOut(LinSysSol);
+
+    /*--- Iterative refinement, when the matrix and the Krylov solver are in lower precision (mixed precision
+     * builds) the residual of the outer (double) vectors is used to compute corrections to the solution. ---*/
+
+    for (auto iRefine = 0ul; iRefine < nRefine; ++iRefine) {
+      Jacobian.ComputePromotedResidual(LinSysSol, LinSysRes, RefineRes);
+
+      const passivedouble resNorm = SU2_TYPE::GetValue(RefineRes.norm());
+      if (tol_type == LinearToleranceType::RELATIVE) {
+        const passivedouble rhsNorm = SU2_TYPE::GetValue(LinSysRes.norm());
+        residual = resNorm / max(rhsNorm, passivedouble(eps));
+      } else {
+        residual = resNorm;
+      }
+      if (residual <= SolverTol) break;
+
+      RefineRes *= -1.0;
+      RefineSol = su2double(0.0);
+
+      HandleTemporariesIn(RefineRes, RefineSol);
+      ScalarType refineResidual = 0.0;
+      IterLinSol += solveSystem(*LinSysRes_ptr, *LinSysSol_ptr, refineResidual);
+      HandleTemporariesOut(RefineSol);
+
+      LinSysSol += RefineSol;
     }
 
     SU2_OMP_MASTER {
       Residual = residual;
       Iterations = IterLinSol;
+
+      if (precReused) {
+        ++precAge;
+      } else {
+        precReady = true;
+        precAge = 0;
+        precRefIter = IterLinSol;
+      }
     }
     END_SU2_OMP_MASTER
 
-    HandleTemporariesOut(LinSysSol);
-
     delete precond;
 
     if (TapeActive) {
@@ -1026,6 +1957,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(geometry, config);
+          break;
+        case SA_AMG:
+          if (RequiresTranspose) Jacobian.BuildSAAMGPreconditioner(geometry, config);
+          break;
         case LU_SGS:
           /*--- Nothing to build. ---*/
           break;
@@ -1046,7 +1983,11 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
   /*--- Call the external function with appropriate AD handling ---*/
   AD::FuncHelper.callPrimalFuncWithADType(externalFunction);
 
+#ifdef CODI_PRIMAL_TAPE
+  AD::FuncHelper.addToTape(CSysSolve_b<ScalarType>::Solve_b, nullptr, CSysSolve_b<ScalarType>::Solve_p);
+#else
   AD::FuncHelper.addToTape(CSysSolve_b<ScalarType>::Solve_b);
+#endif
 #else
   /*--- Without reverse AD, call the external function directly ---*/
   externalFunction();
@@ -1059,6 +2000,8 @@ template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                              CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                              const CConfig* config, const bool directCall) {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::LINEAR_SOLVER);
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, IterLinSol = 0;
   ScalarType SolverTol;
@@ -1107,6 +2050,7 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
   /*--- If there was no call to solve first the preconditioner needs to be built here. ---*/
   if (directCall) {
     Jacobian.TransposeInPlace();
+    const CRuntimeProfiler::CScope profilePrec(CRuntimeProfiler::SECTION::PRECONDITIONER);
     precond->Build();
   }
 
@@ -1128,7 +2072,16 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                     ScreenOutput, config);
+      break;
+    case RECYCLED_FGMRES:
+      IterLinSol = RecycledFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                            residual, ScreenOutput, config);
+      break;
     case BCGSTAB:
+    case DEVICE_BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
@@ -1147,6 +2100,10 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = 1;
       residual = 1e-20;
       break;
+    case PETSC:
+      IterLinSol = PETSc_LinSolver(Jacobian, *LinSysRes_ptr, *LinSysSol_ptr, SolverTol, MaxIter, true, residual,
+                                   ScreenOutput, geometry, config);
+      break;
     default:
       SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
       break;
@@ -72,6 +72,44 @@ void CSysSolve_b<ScalarType>::Solve_b(const su2double::Real* x, su2double::Real*
   END_SU2_OMP_FOR
 }
 
+template <class ScalarType>
+void CSysSolve_b<ScalarType>::Solve_p(const su2double::Real* x, size_t m, su2double::Real* y, size_t n,
+                                      codi::ExternalFunctionUserData* d) {
+  CSysVector<su2double>* LinSysRes = nullptr;
+  d->getDataByIndex(LinSysRes, 0);
+
+  CSysVector<su2double>* LinSysSol = nullptr;
+  d->getDataByIndex(LinSysSol, 1);
+
+  CSysMatrix<ScalarType>* Jacobian = nullptr;
+  d->getDataByIndex(Jacobian, 2);
+
+  CGeometry* geometry = nullptr;
+  d->getDataByIndex(geometry, 3);
+
+  const CConfig* config = nullptr;
+  d->getDataByIndex(config, 4);
+
+  CSysSolve<ScalarType>* solver = nullptr;
+  d->getDataByIndex(solver, 5);
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(roundUpDiv(m, omp_get_num_threads()))
+  for (unsigned long i = 0; i < m; i++) {
+    (*LinSysRes)[i] = x[i];
+    (*LinSysSol)[i] = 0.0;
+  }
+  END_SU2_OMP_FOR
+
+  solver->Solve_b(*Jacobian, *LinSysRes, *LinSysSol, geometry, config, false);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(n, omp_get_num_threads()))
+  for (unsigned long i = 0; i < n; i++) {
+    y[i] = SU2_TYPE::GetValue((*LinSysSol)[i]);
+  }
+  END_SU2_OMP_FOR
+}
+
 template class CSysSolve_b<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CSysSolve_b<passivedouble>;
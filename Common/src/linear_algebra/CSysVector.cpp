@@ -50,7 +50,13 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
 
   omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
 
-  if (vec_val == nullptr) vec_val = MemoryAllocation::aligned_alloc<ScalarType, true>(64, nElm * sizeof(ScalarType));
+  if (vec_val == nullptr) {
+    /*--- Arithmetic types are initialized with the schedule of the vector loops (NUMA first touch),
+     * the others need to be zeroed before they are constructed by assignment. ---*/
+    constexpr bool firstTouch = std::is_arithmetic<ScalarType>::value;
+    vec_val = MemoryAllocation::aligned_alloc<ScalarType, !firstTouch>(64, nElm * sizeof(ScalarType));
+    if (firstTouch) parallelFirstTouch(nElm, omp_chunk_size, ScalarType(0), vec_val);
+  }
 
   if (val != nullptr) {
     if (!valIsArray) {
@@ -66,20 +66,43 @@ void CBlasStructure::gemm(const int M, const int N, const int K, const su2double
   /* Native implementation of the matrix product. This optimized implementation
      assumes that the matrices are in column major order. This can be
      accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
-  gemm_imp(N, M, K, B, A, C);
+     on https://github.com/flame/how-to-optimize-gemm.
+     The small matrices of the DG solver are handled by the register-blocked
+     microkernels, which work directly with the row major storage. */
+  if (K > kc || !gemm_small(M, N, K, A, B, C)) gemm_imp(N, M, K, B, A, C);
 
 #else
 #ifdef HAVE_LIBXSMM
 
-  /* The gemm function of libxsmm is used to carry out the multiplication.
-     Note that libxsmm_gemm expects the matrices in column major order. That's
-     why the in the calling sequence A and B and M and N are reversed. */
-  su2double alpha = 1.0;
-  su2double beta = 0.0;
-  char trans = 'N';
+  /* A size-specialized (JIT) libxsmm kernel is dispatched the first time
+     this (M,N,K) combination is encountered and is reused afterwards. Note
+     that libxsmm expects the matrices in column major order. That's why in
+     the calling sequence A and B and M and N are reversed. The cache is
+     shared by the threads that carry out the tasks of the DG solver. */
+  const std::array<int, 3> key = {{M, N, K}};
+  libxsmm_dmmfunction kernel = nullptr;
+  SU2_OMP_CRITICAL {
+    auto it = xsmmKernels.find(key);
+    if (it == xsmmKernels.end()) {
+      const su2double alpha = 1.0, beta = 0.0;
+      const libxsmm_blasint lda = N, ldb = K, ldc = N;
+      auto newKernel = libxsmm_dmmdispatch(N, M, K, &lda, &ldb, &ldc, &alpha, &beta, nullptr, nullptr);
+      it = xsmmKernels.emplace(key, newKernel).first;
+    }
+    kernel = it->second;
+  }
+  END_SU2_OMP_CRITICAL
+
+  if (kernel) {
+    kernel(B, A, C);
+  } else {
+    /* No kernel could be generated for this size, use the generic gemm of libxsmm. */
+    su2double alpha = 1.0;
+    su2double beta = 0.0;
+    char trans = 'N';
 
-  libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+    libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+  }
 
 #else  // MKL and BLAS
 
@@ -166,6 +189,51 @@ void CBlasStructure::gemm_imp(const int m, const int n, const int k, const su2do
   }
 }
 
+namespace {
+/* Microkernel for row major matrices, c = a*b, in which the columns of c are
+   processed in blocks of NB. The NB entries of a row block are accumulated
+   in registers over k and the inner loop has a compile time length, which
+   the compiler vectorizes (except for the AD types). */
+template <int NB>
+void gemm_small_kernel(const int m, const int n, const int k, const su2double* a, const su2double* b, su2double* c) {
+  for (int i = 0; i < m; ++i) {
+    const su2double* aRow = a + i * k;
+    for (int j = 0; j < n; j += NB) {
+      su2double acc[NB];
+      for (int jj = 0; jj < NB; ++jj) acc[jj] = 0.0;
+
+      for (int p = 0; p < k; ++p) {
+        const su2double aip = aRow[p];
+        const su2double* bRow = b + p * n + j;
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (int jj = 0; jj < NB; ++jj) acc[jj] += aip * bRow[jj];
+      }
+
+      su2double* cRow = c + i * n + j;
+      for (int jj = 0; jj < NB; ++jj) cRow[jj] = acc[jj];
+    }
+  }
+}
+}  // namespace
+
+/* Select the widest microkernel whose block size divides n. */
+bool CBlasStructure::gemm_small(const int m, const int n, const int k, const su2double* a, const su2double* b,
+                                su2double* c) {
+  if (n % 32 == 0)
+    gemm_small_kernel<32>(m, n, k, a, b, c);
+  else if (n % 24 == 0)
+    gemm_small_kernel<24>(m, n, k, a, b, c);
+  else if (n % 16 == 0)
+    gemm_small_kernel<16>(m, n, k, a, b, c);
+  else if (n % 8 == 0)
+    gemm_small_kernel<8>(m, n, k, a, b, c);
+  else if (n % 4 == 0)
+    gemm_small_kernel<4>(m, n, k, a, b, c);
+  else
+    return false;
+  return true;
+}
+
 /* Compute a portion of the c matrix one block at a time.
    Handle ragged edges with calls to a slow but general function. */
 void CBlasStructure::gemm_inner(int m, int n, int k, const su2double* a, int lda, const su2double* b, int ldb,
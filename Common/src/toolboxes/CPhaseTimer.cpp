@@ -0,0 +1,89 @@
+/*!
+ * \file CPhaseTimer.cpp
+ * \brief Implementation of the timer of program phases (see hpp).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPhaseTimer.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+passivedouble CPhaseTimer::MemoryHighWaterMark() {
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#ifdef __APPLE__
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return usage.ru_maxrss / 1024.0;
+#endif
+#else
+  return 0.0;
+#endif
+}
+
+void CPhaseTimer::Report(const string& title) const {
+
+  const auto nPhase = phases.size();
+  if (nPhase == 0) return;
+
+  /*--- Minimum, sum, and maximum of the times, and maximum of the memory. ---*/
+
+  vector<su2double> local(2 * nPhase), minTime(nPhase), sumTime(nPhase), maxTime(2 * nPhase);
+  for (auto i = 0ul; i < nPhase; ++i) {
+    local[i] = phases[i].time;
+    local[nPhase + i] = phases[i].memory;
+  }
+  const auto comm = SU2_MPI::GetComm();
+  SU2_MPI::Allreduce(local.data(), minTime.data(), nPhase, MPI_DOUBLE, MPI_MIN, comm);
+  SU2_MPI::Allreduce(local.data(), sumTime.data(), nPhase, MPI_DOUBLE, MPI_SUM, comm);
+  SU2_MPI::Allreduce(local.data(), maxTime.data(), 2 * nPhase, MPI_DOUBLE, MPI_MAX, comm);
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  const auto size = SU2_MPI::GetSize();
+  cout << "\n" << title << "\n";
+
+  PrintingToolbox::CTablePrinter table(&cout);
+  table.AddColumn("Phase", 40);
+  table.AddColumn("Min [s]", 11);
+  table.AddColumn("Avg [s]", 11);
+  table.AddColumn("Max [s]", 11);
+  table.AddColumn("Peak mem. [MB]", 15);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+
+  for (auto i = 0ul; i < nPhase; ++i) {
+    if (find(running.begin(), running.end(), i) != running.end()) continue;
+    table << phases[i].name << SU2_TYPE::GetValue(minTime[i]) << SU2_TYPE::GetValue(sumTime[i] / size)
+          << SU2_TYPE::GetValue(maxTime[i]) << SU2_TYPE::GetValue(maxTime[nPhase + i]);
+  }
+  table.PrintFooter();
+}
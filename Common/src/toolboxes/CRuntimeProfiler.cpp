@@ -0,0 +1,177 @@
+/*!
+ * \file CRuntimeProfiler.cpp
+ * \brief Implementation of the profiler of the solver iterations (see hpp).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CRuntimeProfiler.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#if defined(HAVE_LIKWID)
+#include <likwid.h>
+#elif defined(HAVE_PAPI)
+#include <papi.h>
+#endif
+
+using namespace std;
+
+bool CRuntimeProfiler::enabled = false;
+bool CRuntimeProfiler::counters = false;
+passivedouble CRuntimeProfiler::startTime[CRuntimeProfiler::nSections] = {};
+passivedouble CRuntimeProfiler::totalTime[CRuntimeProfiler::nSections] = {};
+unsigned long CRuntimeProfiler::numCalls[CRuntimeProfiler::nSections] = {};
+
+void CRuntimeProfiler::Enable(bool enable) {
+  enabled = enable;
+  for (auto i = 0u; i < nSections; ++i) {
+    totalTime[i] = 0.0;
+    numCalls[i] = 0;
+  }
+}
+
+const char* CRuntimeProfiler::Name(SECTION section) {
+  static const char* names[nSections] = {
+      "FLUID_MODEL",     "GRADIENTS",           "LIMITERS",       "CONVECTIVE_RESIDUAL", "VISCOUS_RESIDUAL",
+      "SOURCE_RESIDUAL", "BOUNDARY_CONDITIONS", "IMPLICIT_SETUP", "PRECONDITIONER",      "SPMV",
+      "ILU",             "LINEAR_SOLVER",       "COMMUNICATION",  "OUTPUT"};
+  return names[Index(section)];
+}
+
+void CRuntimeProfiler::EnableHardwareCounters() {
+#if defined(HAVE_LIKWID)
+  LIKWID_MARKER_INIT;
+  SU2_OMP_PARALLEL {
+    LIKWID_MARKER_THREADINIT;
+    for (auto i = 0u; i < nSections; ++i) LIKWID_MARKER_REGISTER(Name(static_cast<SECTION>(i)));
+  }
+  END_SU2_OMP_PARALLEL
+  counters = enabled;
+#elif defined(HAVE_PAPI)
+  counters = enabled;
+#else
+  SU2_MPI::Error("SU2 was not built with hardware counter support (meson option hardware-counters).",
+                 CURRENT_FUNCTION);
+#endif
+}
+
+void CRuntimeProfiler::CountersBegin(SECTION section) {
+#if defined(HAVE_LIKWID)
+  LIKWID_MARKER_START(Name(section));
+#elif defined(HAVE_PAPI)
+  PAPI_hl_region_begin(Name(section));
+#endif
+}
+
+void CRuntimeProfiler::CountersEnd(SECTION section) {
+#if defined(HAVE_LIKWID)
+  LIKWID_MARKER_STOP(Name(section));
+#elif defined(HAVE_PAPI)
+  PAPI_hl_region_end(Name(section));
+#endif
+}
+
+void CRuntimeProfiler::WriteSummary(const string& fileName) {
+
+  /*--- Minimum, sum, and maximum of the times, and sum of the calls (as doubles to reduce them together). ---*/
+
+  vector<su2double> local(2 * nSections), minVal(2 * nSections), sumVal(2 * nSections), maxVal(2 * nSections);
+  for (auto i = 0u; i < nSections; ++i) {
+    local[i] = totalTime[i];
+    local[nSections + i] = numCalls[i];
+  }
+  const auto comm = SU2_MPI::GetComm();
+  SU2_MPI::Allreduce(local.data(), minVal.data(), 2 * nSections, MPI_DOUBLE, MPI_MIN, comm);
+  SU2_MPI::Allreduce(local.data(), sumVal.data(), 2 * nSections, MPI_DOUBLE, MPI_SUM, comm);
+  SU2_MPI::Allreduce(local.data(), maxVal.data(), 2 * nSections, MPI_DOUBLE, MPI_MAX, comm);
+
+  /*--- Event counts of the LIKWID group measured by likwid-perfctr, summed over the threads and ranks. The
+   * marker file written on close gives likwid-perfctr the derived metrics (e.g. bandwidth, intensity). ---*/
+
+  int nEvents = 0;
+  vector<string> eventNames;
+  vector<su2double> events;
+#ifdef HAVE_LIKWID
+  if (counters) {
+    const int group = perfmon_getIdOfActiveGroup();
+    nEvents = max(perfmon_getNumberOfEvents(group), 0);
+    for (int k = 0; k < nEvents; ++k) eventNames.push_back(perfmon_getEventName(group, k));
+
+    vector<su2double> localEvents(nSections * nEvents, 0.0);
+    SU2_OMP_PARALLEL {
+      vector<double> threadEvents(nEvents);
+      for (auto i = 0u; i < nSections; ++i) {
+        int n = nEvents, count = 0;
+        double time = 0.0;
+        LIKWID_MARKER_GET(Name(static_cast<SECTION>(i)), &n, threadEvents.data(), &time, &count);
+        SU2_OMP_CRITICAL
+        for (int k = 0; k < min(n, nEvents); ++k) localEvents[i * nEvents + k] += threadEvents[k];
+        END_SU2_OMP_CRITICAL
+      }
+    }
+    END_SU2_OMP_PARALLEL
+    events.resize(localEvents.size());
+    SU2_MPI::Allreduce(localEvents.data(), events.data(), localEvents.size(), MPI_DOUBLE, MPI_SUM, comm);
+    LIKWID_MARKER_CLOSE;
+  }
+#endif
+  counters = false;
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  const auto size = SU2_MPI::GetSize();
+
+  ofstream csv(fileName + ".csv");
+  ofstream json(fileName + ".json");
+  csv << setprecision(6);
+  json << setprecision(6);
+
+  csv << "\"Section\", \"Calls\", \"Min_Time\", \"Avg_Time\", \"Max_Time\"\n";
+  json << "{\n  \"ranks\": " << size << ",\n  \"threads\": " << omp_get_max_threads() << ",\n  \"sections\": {\n";
+
+  for (auto i = 0u; i < nSections; ++i) {
+    const auto name = Name(static_cast<SECTION>(i));
+    const auto calls = SU2_TYPE::GetValue(sumVal[nSections + i]) / size;
+    const auto minTime = SU2_TYPE::GetValue(minVal[i]);
+    const auto avgTime = SU2_TYPE::GetValue(sumVal[i]) / size;
+    const auto maxTime = SU2_TYPE::GetValue(maxVal[i]);
+
+    csv << name << ", " << calls << ", " << minTime << ", " << avgTime << ", " << maxTime << "\n";
+    json << "    \"" << name << "\": {\"calls\": " << calls << ", \"min_time\": " << minTime
+         << ", \"avg_time\": " << avgTime << ", \"max_time\": " << maxTime;
+    if (nEvents > 0) {
+      json << ", \"counters\": {";
+      for (int k = 0; k < nEvents; ++k) {
+        json << (k ? ", " : "") << "\"" << eventNames[k] << "\": " << SU2_TYPE::GetValue(events[i * nEvents + k]);
+      }
+      json << "}";
+    }
+    json << "}" << (i + 1 < nSections ? ",\n" : "\n");
+  }
+  json << "  }\n}\n";
+
+  cout << "Runtime profile written to " << fileName << ".csv and " << fileName << ".json." << endl;
+}
@@ -0,0 +1,116 @@
+/*!
+ * \file allocation_toolbox.cpp
+ * \brief Memory accounting report of the aligned allocations (see hpp).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CPhaseTimer.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <fstream>
+#include <limits>
+
+using namespace std;
+
+namespace {
+/*!
+ * \brief Anonymous memory of this process that is actually backed by transparent huge pages, in bytes.
+ */
+size_t AnonHugePageBytes() {
+  size_t kB = 0;
+#if defined(__linux__)
+  ifstream smaps("/proc/self/smaps_rollup");
+  string key;
+  while (smaps >> key) {
+    if (key == "AnonHugePages:") {
+      smaps >> kB;
+      break;
+    }
+    smaps.ignore(numeric_limits<streamsize>::max(), '\n');
+  }
+#endif
+  return kB * 1024;
+}
+}  // namespace
+
+void MemoryAllocation::PrintReport(const string& title) {
+
+  static const char* names[nCategories] = {"Other", "Geometry", "Solver", "Jacobian", "Output"};
+  constexpr su2double MB = 1024.0 * 1024.0;
+
+  /*--- Current and peak usage of each category, plus the totals, the process high-water mark, and the memory
+   * advised to use, and backed by, huge pages. ---*/
+
+  const auto nVal = 2 * (nCategories + 1) + 3;
+  vector<su2double> local(nVal, 0.0), minVal(nVal), sumVal(nVal), maxVal(nVal);
+
+  for (auto i = 0u; i < nCategories; ++i) {
+    const auto category = static_cast<CATEGORY>(i);
+    local[2 * i] = CurrentBytes(category) / MB;
+    local[2 * i + 1] = PeakBytes(category) / MB;
+    local[2 * nCategories] += local[2 * i];
+    local[2 * nCategories + 1] += local[2 * i + 1];
+  }
+  local[nVal - 3] = CPhaseTimer::MemoryHighWaterMark();
+  local[nVal - 2] = HugePageBytes() / MB;
+  local[nVal - 1] = AnonHugePageBytes() / MB;
+
+  const auto comm = SU2_MPI::GetComm();
+  SU2_MPI::Allreduce(local.data(), minVal.data(), nVal, MPI_DOUBLE, MPI_MIN, comm);
+  SU2_MPI::Allreduce(local.data(), sumVal.data(), nVal, MPI_DOUBLE, MPI_SUM, comm);
+  SU2_MPI::Allreduce(local.data(), maxVal.data(), nVal, MPI_DOUBLE, MPI_MAX, comm);
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  const auto size = SU2_MPI::GetSize();
+  cout << "\n" << title << "\n";
+
+  PrintingToolbox::CTablePrinter table(&cout);
+  table.AddColumn("Subsystem", 30);
+  table.AddColumn("Min [MB]", 11);
+  table.AddColumn("Avg [MB]", 11);
+  table.AddColumn("Max [MB]", 11);
+  table.AddColumn("Peak [MB]", 11);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+
+  auto addRow = [&](const string& name, unsigned long i) {
+    table << name << SU2_TYPE::GetValue(minVal[i]) << SU2_TYPE::GetValue(sumVal[i] / size)
+          << SU2_TYPE::GetValue(maxVal[i]) << SU2_TYPE::GetValue(maxVal[i + 1]);
+  };
+  for (auto i = 0u; i < nCategories; ++i) addRow(names[i], 2 * i);
+  addRow("Total (aligned allocations)", 2 * nCategories);
+  table.PrintFooter();
+
+  cout << "Largest process high-water mark: " << SU2_TYPE::GetValue(maxVal[nVal - 3]) << " MB (includes the "
+       << "untracked memory, e.g. STL containers and the AD tape)." << endl;
+
+  if (sumVal[nVal - 2] > 0.0) {
+    cout << "Huge pages (total over the ranks): " << SU2_TYPE::GetValue(sumVal[nVal - 2]) << " MB advised, "
+         << SU2_TYPE::GetValue(sumVal[nVal - 1]) << " MB backed by the kernel (AnonHugePages)." << endl;
+  }
+}
@@ -0,0 +1,133 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Compression of blocks of floating point data.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace CompressionToolbox {
+
+static_assert(sizeof(passivedouble) == sizeof(uint64_t), "The compression assumes 64-bit doubles.");
+
+bool Available() {
+#ifdef HAVE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Quantize(passivedouble* values, unsigned long n, passivedouble tolerance) {
+
+  if (!(tolerance > 0)) return;
+
+  /*--- Removing k of the 52 mantissa bits of x = m 2^e (0.5 <= m < 1), with rounding,
+   *    changes x by at most 2^(e-54+k), which must not exceed the tolerance. ---*/
+
+  const int tolExp = static_cast<int>(std::floor(std::log2(tolerance)));
+
+  for (unsigned long i = 0; i < n; ++i) {
+    if (values[i] == 0 || !std::isfinite(values[i])) continue;
+
+    int exponent;
+    std::frexp(values[i], &exponent);
+    const int k = std::min(std::max(tolExp - exponent + 54, 0), 52);
+    if (k == 0) continue;
+
+    uint64_t bits;
+    std::memcpy(&bits, &values[i], sizeof(bits));
+    bits += uint64_t(1) << (k - 1);
+    bits &= ~((uint64_t(1) << k) - 1);
+    std::memcpy(&values[i], &bits, sizeof(bits));
+  }
+}
+
+void Shuffle(const passivedouble* values, unsigned long n, unsigned char* bytes) {
+  constexpr unsigned long nByte = sizeof(passivedouble);
+  const auto* src = reinterpret_cast<const unsigned char*>(values);
+
+  for (unsigned long i = 0; i < n; ++i)
+    for (unsigned long b = 0; b < nByte; ++b)
+      bytes[b * n + i] = src[i * nByte + b];
+}
+
+void Unshuffle(const unsigned char* bytes, unsigned long n, passivedouble* values) {
+  constexpr unsigned long nByte = sizeof(passivedouble);
+  auto* dst = reinterpret_cast<unsigned char*>(values);
+
+  for (unsigned long i = 0; i < n; ++i)
+    for (unsigned long b = 0; b < nByte; ++b)
+      dst[i * nByte + b] = bytes[b * n + i];
+}
+
+unsigned long Compress(const passivedouble* values, unsigned long n, std::vector<char>& out) {
+
+#ifdef HAVE_ZLIB
+  std::vector<unsigned char> shuffled(n * sizeof(passivedouble));
+  Shuffle(values, n, shuffled.data());
+
+  uLongf nBytes = compressBound(shuffled.size());
+  const auto start = out.size();
+  out.resize(start + nBytes);
+
+  if (compress2(reinterpret_cast<Bytef*>(out.data() + start), &nBytes, shuffled.data(), shuffled.size(),
+                Z_DEFAULT_COMPRESSION) != Z_OK) {
+    SU2_MPI::Error("Compression of the data failed.", CURRENT_FUNCTION);
+  }
+  out.resize(start + nBytes);
+  return nBytes;
+#else
+  SU2_MPI::Error("SU2 was built without compression support (zlib).", CURRENT_FUNCTION);
+  return 0;
+#endif
+}
+
+void Decompress(const char* in, unsigned long nBytes, passivedouble* values, unsigned long n) {
+
+#ifdef HAVE_ZLIB
+  std::vector<unsigned char> shuffled(n * sizeof(passivedouble));
+
+  uLongf size = shuffled.size();
+  if (uncompress(shuffled.data(), &size, reinterpret_cast<const Bytef*>(in), nBytes) != Z_OK ||
+      size != shuffled.size()) {
+    SU2_MPI::Error("Decompression of the data failed, the file may be corrupted.", CURRENT_FUNCTION);
+  }
+
+  Unshuffle(shuffled.data(), n, values);
+#else
+  SU2_MPI::Error("SU2 was built without compression support (zlib).", CURRENT_FUNCTION);
+#endif
+}
+
+}  // namespace CompressionToolbox
@@ -321,6 +321,8 @@ CWallModelLogLaw::CWallModelLogLaw(CConfig* config, const string& Marker_Tag) :
      and set the exchange height. */
   const su2double* doubleInfo = config->GetWallFunction_DoubleInfo(Marker_Tag);
   h_wm = doubleInfo[0];
+
+  if (config->GetwallModel_Table()) table.InitializeReichardt(SU2_TYPE::GetValue(karman), SU2_TYPE::GetValue(C));
 }
 
 void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange, const su2double velExchange,
@@ -350,6 +352,13 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange, con
   unsigned short iter = 0, max_iter = 50;
   const su2double tol = 1e-3;
 
+  /* With the tabulated inverse profile the friction velocity follows directly from U h / nu. */
+  if (!table.empty()) {
+    const su2double Re_h = velExchange * h_wm / nu_wall;
+    if (Re_h > EPS) u_tau = velExchange / table.GetUPlus(Re_h);
+    converged = true;
+  }
+
   while (!converged) {
     iter += 1;
     if (iter == max_iter) converged = true;
@@ -74,7 +74,8 @@ protected:
   vector<string> totalColumnNames; /*!< \brief Names of the columns for the profile, one for each inlet marker. */
   vector<string> totalColumnValues; /*!< \brief Initial values for the profile, constructed from MARKER_INLET. */
 
-  vector<vector<passivedouble> > profileData;  /*!< \brief Auxiliary structure for holding the data values from a profile file. */
+  vector<unsigned long> profileOffset;  /*!< \brief Position of the data of each profile in profileData. */
+  CNodeSharedArray<passivedouble> profileData;  /*!< \brief Data values from a profile file (one copy per compute node). */
   vector<vector<vector<su2double> > > profileCoords;  /*!< \brief Data structure for holding the merged inlet boundary coordinates from all ranks. */
 
 private:
@@ -153,12 +154,12 @@ public:
   }
 
   /*!
-   * \brief Get the 1D vector of data for a profile from the input file.
+   * \brief Get the 1D array of data for a profile from the input file (row major).
    * \param[in] val_iProfile - current profile index.
-   * \returns 1D vector of data for a profile from the input file.
+   * \returns 1D array of data for a profile from the input file.
    */
-  inline const vector<passivedouble> &GetDataForProfile(int val_iProfile) const {
-    return profileData[val_iProfile];
+  inline const passivedouble* GetDataForProfile(int val_iProfile) const {
+    return profileData.data() + profileOffset[val_iProfile];
   }
 
    /*!
@@ -170,9 +171,10 @@ public:
   inline vector<su2double> GetColumnForProfile(int val_iProfile, unsigned short iCol) const {
     auto nRow = numberOfRowsInProfile[val_iProfile];
     auto nCol = numberOfColumnsInProfile[val_iProfile];
+    const auto* data = GetDataForProfile(val_iProfile);
     vector<su2double> ColumnData(nRow);
     for (unsigned long iRow = 0; iRow < nRow; iRow++)
-      ColumnData[iRow]=profileData[val_iProfile][iRow*nCol+iCol];
+      ColumnData[iRow]=data[iRow*nCol+iCol];
     return ColumnData;
   }
 };
@@ -76,6 +76,8 @@ protected:
                                           solution update. */
     OBJECTIVE_FUNCTION_TAPE,  /*!< \brief Record only the dependence of the objective function
                                           w.r.t. solver variables (from all zones). */
+    ZONE_SPECIFIC_TAPE,       /*!< \brief Record only the solution update of one zone, and the transfer
+                                          of data from other zones to it (cross terms). */
   };
 
   /*!
@@ -195,6 +197,12 @@ protected:
    */
   void HandleDataTransfer();
 
+  /*!
+   * \brief Transfer data from the coupled zones to one zone and update its grid when required.
+   * \param[in] targetZone - Zone that receives the data.
+   */
+  void TransferToZone(unsigned short targetZone);
+
   /*!
    * \brief Run one direct iteration in a zone.
    * \param[in] iZone - Zone in which we run an iteration.
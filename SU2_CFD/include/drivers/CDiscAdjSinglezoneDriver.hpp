@@ -28,6 +28,10 @@
 
 #pragma once
 #include "CSinglezoneDriver.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include <set>
 
 /*!
  * \class CDiscAdjSinglezoneDriver
@@ -38,6 +42,43 @@
  */
 class CDiscAdjSinglezoneDriver : public CSinglezoneDriver {
 protected:
+#ifdef CODI_FORWARD_TYPE
+  using Scalar = su2double;
+#else
+  using Scalar = passivedouble;
+#endif
+
+  /*!
+   * \brief Linear part of the adjoint fixed-point iteration u = J^T u + b, i.e. v = (J^T - I) u,
+   *        obtained from one iteration as G(u) - u - b, with -b given.
+   */
+  class AdjointProduct : public CMatrixVectorProduct<Scalar> {
+  public:
+    CDiscAdjSinglezoneDriver* const driver;
+    const CSysVector<Scalar>& minusFixPt0;   /*!< \brief The iteration from a zero solution, with negative sign. */
+    mutable unsigned long nEval = 0;
+
+    AdjointProduct(CDiscAdjSinglezoneDriver* d, const CSysVector<Scalar>& rhs) : driver(d), minusFixPt0(rhs) {}
+
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override {
+      driver->SetAllSolutions(ZONE_0, true, u);
+      driver->AdjointIteration();
+      driver->GetAllSolutions(ZONE_0, true, v);
+      v -= u;
+      v += minusFixPt0;
+      ++nEval;
+    }
+  };
+
+  class Identity : public CPreconditioner<Scalar> {
+  public:
+    inline bool IsIdentity() const override { return true; }
+    inline void operator()(const CSysVector<Scalar> & u, CSysVector<Scalar> & v) const override { v = u; }
+  };
+
+  static constexpr unsigned long KrylovMinIters = 3;  /*!< \brief Minimum number of iterations to use FGMRES. */
+  static constexpr passivedouble ReplayTolFactor = 10; /*!< \brief Tolerated increase of the fixed-point residual
+                                                                  when the primal tape is re-evaluated. */
 
   unsigned long nAdjoint_Iter;                  /*!< \brief The number of adjoint iterations that are run on the fixed-point solver.*/
   RECORDING RecordingState;                     /*!< \brief The kind of recording the tape currently holds.*/
@@ -55,6 +96,13 @@ protected:
   COutput *direct_output;
   CNumerics ***numerics;                        /*!< \brief Container vector with all the numerics. */
 
+  std::set<long> directSnapshots;               /*!< \brief Recomputed direct solutions kept in memory (time iterations). */
+
+  vector<su2passivematrix> VectorAdjSol;        /*!< \brief Adjoint solutions of each objective function (VECTOR_ADJOINT). */
+  vector<su2double> VectorObjFunc;              /*!< \brief Values of each objective function (VECTOR_ADJOINT). */
+  vector<int> VectorObjFunc_Index;              /*!< \brief Tape indices of each objective function (VECTOR_ADJOINT). */
+  passivedouble RecordedResidual = 0.0;         /*!< \brief Fixed-point residual of the recorded iteration (PRIMAL_TAPE_REUSE). */
+
   /*!
    * \brief Record one iteration of a flow iteration in within multiple zones.
    * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
@@ -77,16 +125,105 @@ protected:
    */
   void SetAdjObjFunction(void);
 
+  /*!
+   * \brief One evaluation of the adjoint fixed-point iteration (no monitoring or output).
+   */
+  void AdjointIteration();
+
+  /*!
+   * \brief Solve the adjoint system with restarted FGMRES instead of the fixed-point iterations (NEWTON_KRYLOV),
+   *        each product is one tape evaluation and the restart frequency is QUASI_NEWTON_NUM_SAMPLES.
+   */
+  void KrylovRun();
+
+  /*!
+   * \brief Evaluate each objective function separately and register them as outputs of the tape (VECTOR_ADJOINT).
+   */
+  void SetVectorObjFunction();
+
+  /*!
+   * \brief Seed the adjoint of each objective function in its own direction of the vector mode.
+   */
+  void SetVectorAdjObjFunction();
+
+  /*!
+   * \brief Run the adjoint fixed-point iterations of all objective functions (VECTOR_ADJOINT), with one
+   *        tape evaluation per iteration. The residuals of the first objective function are monitored.
+   */
+  void VectorRun();
+
   /*!
    * \brief Record the main computational path.
    */
   void MainRecording(void);
 
+  /*!
+   * \brief Re-evaluate the main recording (solution and coordinates as inputs) with the current converged solution
+   *        and coordinates, instead of recording it again (PRIMAL_TAPE_REUSE).
+   * \return False if the re-evaluated iteration does not match the solution, i.e. the recording must be repeated.
+   */
+  bool ReplayMainRecording();
+
+  /*!
+   * \brief Get the direct and adjoint solvers whose solution is an input of the main recording.
+   */
+  vector<pair<unsigned short, unsigned short>> RecordedSolvers() const;
+
+  /*!
+   * \brief RMS of the difference between the output and the input solution of the recorded iteration.
+   * \param[in] tape - Use the outputs of the (re-evaluated) tape instead of the solution of the direct solvers.
+   */
+  passivedouble FixedPointResidual(bool tape) const;
+
   /*!
    * \brief Record the secondary computational path.
    */
   void SecondaryRecording(void);
 
+  /*!
+   * \brief Project the mesh sensitivities on the design variables and write the gradient file, as SU2_DOT
+   *        would do with the sensitivity file (INLINE_GRADIENT_PROJECTION).
+   */
+  void ProjectGradient();
+
+  /*!
+   * \brief Make the direct solutions needed by the current time iteration available, recomputing those that
+   *        have no restart file (UNST_ADJOINT_RECOMPUTE).
+   */
+  void PrepareDirectSolutions();
+
+  /*!
+   * \brief Check if the direct solution of a time iteration can be loaded (from memory or file).
+   * \param[in] iter - Direct time iteration, negative iterations use the free-stream.
+   */
+  bool DirectSolutionAvailable(long iter) const;
+
+  /*!
+   * \brief Load consecutive direct solutions, shifting each one to the solution of the previous time step.
+   * \param[in] first - First direct time iteration.
+   * \param[in] last - Last direct time iteration, it is also the current solution on exit.
+   */
+  void LoadDirectSolutions(long first, long last);
+
+  /*!
+   * \brief Recompute a direct solution from the closest earlier available ones, keeping intermediate solutions
+   *        in memory according to a binomial (revolve) schedule.
+   * \param[in] iter - Direct time iteration.
+   */
+  void RecomputeDirectSolution(long iter);
+
+  /*!
+   * \brief Run one time iteration of the direct problem, without recording.
+   * \param[in] iter - Direct time iteration.
+   */
+  void RunDirectTimeIter(long iter);
+
+  /*!
+   * \brief Keep the current direct solution in memory as the restart of a time iteration.
+   * \param[in] iter - Direct time iteration.
+   */
+  void StoreDirectSolution(long iter);
+
   /*!
    * \brief gets Convergence on physical time scale, (deactivated in adjoint case)
    * \return false
@@ -126,4 +263,10 @@ public:
    * \brief Postprocess the adjoint iteration for ZONE_0.
    */
   void Postprocess(void) override;
+
+  /*!
+   * \brief Write the output files, in vector mode one set per objective function with its suffix (e.g. "_cd").
+   * \param[in] TimeIter - Current time iteration.
+   */
+  void Output(unsigned long TimeIter) override;
 };
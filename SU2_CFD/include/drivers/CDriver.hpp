@@ -30,6 +30,7 @@
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimer.hpp"
 #include "../integration/CIntegration.hpp"
 #include "../interfaces/CInterface.hpp"
 #include "../solvers/CSolver.hpp"
@@ -79,6 +80,12 @@ class CDriver : public CDriverBase {
   CInterface*** interface_container; /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                      /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
 
+  unsigned short iInstGroup = 0,  /*!< \brief Group of ranks of this rank (harmonic balance instances or time slices). */
+      nInstGroups = 1;            /*!< \brief Number of groups of ranks that share the instances or time slices. */
+  SU2_Comm instGroupsComm;        /*!< \brief Communicator of the ranks with the same partition in all groups. */
+
+  CPhaseTimer PreprocTimer;       /*!< \brief Timings of the preprocessing phases (reported with WRT_PERFORMANCE). */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -267,6 +274,15 @@ class CDriver : public CDriverBase {
    */
   void PreprocessPythonInterface(CConfig** config, CGeometry**** geometry, CSolver***** solver);
 
+  /*!
+   * \brief Split the ranks into groups that solve different harmonic balance time instances, or different time
+   *        slices of the parareal driver.
+   * \note Each group becomes the communicator of the driver, since all groups have the same size the partitioning of
+   *       each group is the same, which allows the ranks that own the same points to exchange the instances.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessInstanceGroups(const CConfig* config);
+
   /*!
    * \brief Preprocess the output container.
    * \param[in] config - Definition of the particular problem.
@@ -352,6 +368,11 @@ class CDriver : public CDriverBase {
    */
   void PrintDirectResidual(RECORDING kind_recording);
 
+  /*!
+   * \brief Print how the turbulence models are recorded (differentiated or frozen), next to the tape statistics.
+   */
+  void PrintTurbulenceRecording() const;
+
   /*!
    * \brief Set the solution of all solvers (adjoint or primal) in a zone.
    * \param[in] iZone - Index of the zone.
@@ -521,6 +542,20 @@ class CDriver : public CDriverBase {
    */
   void SetFarFieldAoS(passivedouble beta);
 
+  /*!
+   * \brief Set the freestream Mach number (compressible flow), at constant freestream static conditions and
+   *        viscosity, i.e. the Reynolds number changes with the velocity.
+   * \param[in] mach - Mach number.
+   */
+  void SetFarFieldMach(passivedouble mach);
+
+  /*!
+   * \brief Reset the convergence monitoring, iteration counters, and the state of the nonlinear iterations
+   *        (local CFL, etc.) of all solvers, to run the problem again (e.g. StartSolver) from the current solution
+   *        after changing the freestream or the boundary conditions, without rebuilding the driver.
+   */
+  void ResetConvergence();
+
   /*!
    * \brief Set the dynamic mesh translation rates.
    * \param[in] xDot - Value of translational velocity in x-direction.
@@ -654,6 +689,17 @@ class CHBDriver : public CFluidDriver {
    */
   void ComputeHBOperator();
 
+  /*!
+   * \brief Whether the instance is iterated by the group of ranks of this rank.
+   * \param[in] iInst - Instance number.
+   */
+  inline bool OwnsInstance(unsigned short iInst) const { return iInst % nInstGroups == iInstGroup; }
+
+  /*!
+   * \brief Exchange the instances between groups of ranks (the variables needed by the source terms).
+   */
+  void ExchangeInstances();
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -677,4 +723,10 @@ class CHBDriver : public CFluidDriver {
    * \brief Update the solution for the Harmonic Balance.
    */
   void Update() override;
+
+  /*!
+   * \brief Write the result files of the instances of this group of ranks.
+   * \param[in] InnerIter - Current iteration.
+   */
+  void Output(unsigned long InnerIter) override;
 };
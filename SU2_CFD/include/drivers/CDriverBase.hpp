@@ -387,6 +387,27 @@ class CDriverBase {
     }
   }
 
+  /*!
+   * \brief Set the mesh displacements of all the vertices of a marker, with a single call.
+   * \param[in] iMarker - Marker index.
+   * \param[in] values - Node displacements (nVertex x nDim, row-major).
+   */
+  inline void SetMarkerCustomDisplacements(unsigned short iMarker, const vector<passivedouble>& values) {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = GetNumberMarkerNodes(iMarker);
+    if (values.size() != nVertex * nDim) {
+      SU2_MPI::Error("The size of the displacements does not match the marker.", CURRENT_FUNCTION);
+    }
+    auto* nodes = GetSolverAndCheckMarker(MESH_SOL)->GetNodes();
+
+    for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+      const auto iPoint = main_geometry->vertex[iMarker][iVertex]->GetNode();
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        nodes->SetBound_Disp(iPoint, iDim, values[iVertex * nDim + iDim]);
+      }
+    }
+  }
+
   /*!
    * \brief Get the mesh velocities currently imposed on a marker vertex.
    * \param[in] iMarker - Marker index.
@@ -595,6 +616,26 @@ class CDriverBase {
     solver->GetNodes()->Set_FlowTraction(iPoint, load.data());
   }
 
+  /*!
+   * \brief Sets the nodal forces for the structural solver at all the vertices of a marker, with a single call.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] forces - Force vectors (nVertex x nDim, row-major).
+   */
+  inline void SetMarkerCustomFEALoads(unsigned short iMarker, const std::vector<passivedouble>& forces) {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = GetNumberMarkerNodes(iMarker);
+    if (forces.size() != nVertex * nDim) {
+      SU2_MPI::Error("The size of the forces does not match the marker.", CURRENT_FUNCTION);
+    }
+    auto* nodes = GetSolverAndCheckMarker(FEA_SOL, iMarker)->GetNodes();
+
+    for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+      std::array<su2double, 3> load{};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) load[iDim] = forces[iVertex * nDim + iDim];
+      nodes->Set_FlowTraction(main_geometry->vertex[iMarker][iVertex]->GetNode(), load.data());
+    }
+  }
+
   /*!
    * \brief Get the fluid force at a vertex of a solid wall marker of the flow solver.
    * \note This can be the output of the flow solver in an FSI setting to then apply it to a structural solver.
@@ -614,6 +655,27 @@ class CDriverBase {
     return FlowLoad;
   }
 
+  /*!
+   * \brief Get the fluid forces at all the vertices of a solid wall marker of the flow solver, with a single call.
+   * \param[in] iMarker - Marker identifier.
+   * \return Vector of loads (nVertex x nDim, row-major).
+   */
+  inline vector<passivedouble> GetMarkerFlowLoads(unsigned short iMarker) const {
+    const auto nDim = GetNumberDimensions();
+    const auto nVertex = GetNumberMarkerNodes(iMarker);
+    vector<passivedouble> FlowLoads(nVertex * nDim, 0.0);
+    const auto* solver = GetSolverAndCheckMarker(FLOW_SOL, iMarker);
+
+    if (main_config->GetSolid_Wall(iMarker)) {
+      for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          FlowLoads[iVertex * nDim + iDim] = SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim));
+        }
+      }
+    }
+    return FlowLoads;
+  }
+
   /*!
    * \brief Set the adjoint of the flow tractions of the flow solver.
    * \note This can be the input of the flow solver in an adjoint FSI setting.
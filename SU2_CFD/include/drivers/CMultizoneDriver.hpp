@@ -57,6 +57,12 @@ protected:
 
   bool *prefixed_motion;     /*!< \brief Determines if a fixed motion is imposed in the config file. */
 
+  bool concurrentZones = false;  /*!< \brief Solve the zones concurrently in block-Jacobi iterations. */
+  vector<int> zoneThreads;       /*!< \brief Number of threads of each zone in concurrent solves. */
+#ifdef HAVE_MPI
+  vector<SU2_MPI::Comm> zoneComm;  /*!< \brief Communicator of each zone in concurrent solves. */
+#endif
+
   /*!
    * \brief Perform a dynamic mesh deformation, including grid velocity computation and update of the multigrid structure.
    */
@@ -77,6 +83,17 @@ protected:
    */
   void RunJacobi();
 
+  /*!
+   * \brief Setup the concurrent solution of the zones (MULTIZONE_CONCURRENT_ZONES).
+   */
+  void SetConcurrentZones();
+
+  /*!
+   * \brief Solve all zones concurrently, each on its own thread with its own communicator, and with
+   *        a share of the OpenMP threads of the rank proportional to its number of points.
+   */
+  void SolveZonesConcurrently();
+
   /*!
    * \brief Routine to provide all the desired physical transfers between the different zones during one iteration.
    * \return Boolean that determines whether the mesh needs to be updated for this particular transfer
@@ -0,0 +1,95 @@
+/*!
+ * \file CPararealDriver.hpp
+ * \brief Headers of the time-parallel (parareal) driver for unsteady single zone problems.
+ *        The subroutines and functions are in the <i>CPararealDriver.cpp</i> file.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CPararealDriver
+ * \ingroup Drivers
+ * \brief Time-parallel driver for unsteady (dual time stepping) single zone problems, based on parareal.
+ * \details The time iterations are split into slices, one per group of ranks (TIME_PARALLEL_GROUPS). All groups
+ *          have the same partitioning of the mesh, therefore the ranks that own the same points in consecutive
+ *          groups exchange the states of the slice boundaries directly. The fine propagator is the normal dual
+ *          time stepping, the coarse propagator uses a time step PARAREAL_COARSENING times larger. Each parareal
+ *          iteration propagates all slices in parallel with the fine propagator, and then corrects the initial
+ *          states of the slices with a sequential sweep of the coarse propagator,
+ *          U_{n+1} = G(U_n) + F(U_n^old) - G(U_n^old). After the iterations, each group runs its slice once more
+ *          with output.
+ */
+class CPararealDriver final : public CSinglezoneDriver {
+ private:
+  unsigned long sliceStart = 0;  /*!< \brief First time iteration of the slice of this group. */
+  unsigned long sliceLength = 0; /*!< \brief Number of (fine) time iterations of each slice. */
+  unsigned short coarsening = 1; /*!< \brief Ratio between the coarse and fine time steps. */
+  bool secondOrder = false;      /*!< \brief Second order dual time stepping, the state includes two time levels. */
+
+  /*!
+   * \brief Copy the unsteady state (solution at time n, and n-1 for 2nd order) of all solvers into a vector.
+   * \param[out] state - The state.
+   */
+  void GetState(vector<su2double>& state);
+
+  /*!
+   * \brief Set the unsteady state of all solvers (the current solution is initialized with time n).
+   * \param[in] state - The state.
+   */
+  void SetState(const vector<su2double>& state);
+
+  /*!
+   * \brief Change the time spacing of the second time level of a state, u_n1 := u_n - factor * (u_n - u_n1).
+   * \param[in,out] state - The state.
+   * \param[in] factor - Ratio between the new and old time steps.
+   */
+  void ScaleTimeSpacing(vector<su2double>& state, su2double factor) const;
+
+  /*!
+   * \brief Integrate the slice of this group from the state currently set in the solvers.
+   * \param[in] coarse - Use the coarse propagator.
+   * \param[in] output - Monitor and write the output of each time iteration.
+   */
+  void Propagate(bool coarse, bool output);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   */
+  CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CPararealDriver() override;
+
+  /*!
+   * \brief Launch the parareal iterations.
+   */
+  void StartSolver() override;
+};
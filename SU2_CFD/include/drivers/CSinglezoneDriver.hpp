@@ -29,6 +29,8 @@
 #pragma once
 #include "CDriver.hpp"
 
+class CCheckpoint;
+
 /*!
  * \class CSinglezoneDriver
  * \ingroup Drivers
@@ -41,6 +43,8 @@ protected:
 
   unsigned long TimeIter;
 
+  std::unique_ptr<CCheckpoint> checkpoint; /*!< \brief Node-local checkpoints of unsteady simulations. */
+
   /*!
      * \brief  Returns whether all specified windowed-time-averaged ouputs have been converged
      * \return Boolean indicating whether the problem is converged.
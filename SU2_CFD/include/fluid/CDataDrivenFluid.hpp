@@ -106,6 +106,10 @@ class CDataDrivenFluid final : public CFluidModel {
   unsigned long outside_dataset, /*!< \brief Density-energy combination lies outside data set. */
       nIter_Newton;              /*!< \brief Number of Newton solver iterations. */
 
+  vector<su2double> batch_rho, batch_e, /*!< \brief Clipped density and energy of the last batch. */
+      batch_outputs;                    /*!< \brief Entropy and its derivatives of the last batch (point-major). */
+  vector<unsigned long> batch_outside;  /*!< \brief Extrapolation of the points of the last batch. */
+
   /*!
    * \brief Map dataset variables to specific look-up operations.
    */
@@ -134,6 +138,13 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void Evaluate_Dataset(su2double rho, su2double e);
 
+  /*!
+   * \brief Compute the states of a block of points from the entropy derivatives, same expressions as SetTDState_rhoe.
+   */
+  static void ComputeStateBlock(unsigned long nPoint, const su2double* rho, const su2double* ds_de,
+                                const su2double* ds_drho, const su2double* d2s_de2, const su2double* d2s_dedrho,
+                                const su2double* d2s_drho2, TDStateBlock& state);
+
   /*!
    * \brief 2D Newton solver for computing the density and energy corresponding to Y1_target and Y2_target.
    * \param[in] Y1_target - Target value for output quantity 1.
@@ -172,6 +183,41 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Set the Dimensionless State of a block of points using Density and Internal Energy. The data set is
+   *        evaluated for all points first, the state is then computed in a vectorized loop without the
+   *        derivatives needed only by the Giles boundary conditions.
+   * \param[in] nPoint - Number of points.
+   * \param[in] rho - first thermodynamic variable (density).
+   * \param[in] e - second thermodynamic variable (static energy).
+   * \param[out] state - Thermodynamic states of the points, including entropy and extrapolation.
+   */
+  void SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                            TDStateBlock& state) override;
+
+  /*!
+   * \brief Batches are evaluated when the look-up table uses an offload device.
+   */
+  bool HasBatchEvaluation() const override;
+
+  /*!
+   * \brief Evaluate the data set for a batch of points (on the offload device).
+   * \param[in] nPoint - Number of points.
+   * \param[in] rho - Density of the points.
+   * \param[in] e - Static energy of the points.
+   */
+  void SetTDStateBatch_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e) override;
+
+  /*!
+   * \brief Compute the states of a block of points of the last batch.
+   * \param[in] offset - Index of the first point of the block in the batch.
+   * \param[in] nPoint - Number of points, at most BlockSize.
+   * \param[in] rho - Density of the points.
+   * \param[out] state - Thermodynamic states of the points, including entropy and extrapolation.
+   */
+  void GetTDStateBatch(unsigned long offset, unsigned long nPoint, const su2double* rho,
+                       TDStateBlock& state) const override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature.
    * \param[in] P - first thermodynamic variable (pressure).
@@ -91,6 +91,40 @@ class CFluidModel {
   static unique_ptr<CDiffusivityModel> MakeMassDiffusivityModel(const CConfig* config, unsigned short iSpecies);
 
  public:
+  /*!
+   * \brief Maximum number of points in a block of thermodynamic states.
+   */
+  static constexpr unsigned long BlockSize = 64;
+
+  /*!
+   * \brief Thermodynamic states of a block of points, in structure-of-arrays layout.
+   */
+  struct TDStateBlock {
+    su2double Pressure[BlockSize];    /*!< \brief Pressure. */
+    su2double Temperature[BlockSize]; /*!< \brief Temperature. */
+    su2double SoundSpeed2[BlockSize]; /*!< \brief Speed of sound squared. */
+    su2double dPdrho_e[BlockSize];    /*!< \brief DpDd_e. */
+    su2double dPde_rho[BlockSize];    /*!< \brief DpDe_d. */
+    su2double Entropy[BlockSize];     /*!< \brief Entropy, only set by data-driven models. */
+    unsigned long Extrapolation[BlockSize]; /*!< \brief Outside of the data set, only set by data-driven models. */
+  };
+
+  /*!
+   * \brief Layout of the transport properties of a point cached by ComputeTransportCached.
+   */
+  enum TransportCacheIndex : unsigned short {
+    CACHE_DENSITY,     /*!< \brief Density at which the properties were computed. */
+    CACHE_TEMPERATURE, /*!< \brief Temperature at which the properties were computed. */
+    CACHE_MU_TURB,     /*!< \brief Eddy viscosity at which the properties were computed. */
+    CACHE_MU,          /*!< \brief Laminar viscosity. */
+    CACHE_DMUDRHO_T,   /*!< \brief Partial derivative of viscosity w.r.t. density. */
+    CACHE_DMUDT_RHO,   /*!< \brief Partial derivative of viscosity w.r.t. temperature. */
+    CACHE_KT,          /*!< \brief Thermal conductivity. */
+    CACHE_DKTDRHO_T,   /*!< \brief Partial derivative of conductivity w.r.t. density. */
+    CACHE_DKTDT_RHO,   /*!< \brief Partial derivative of conductivity w.r.t. temperature. */
+    CACHE_SIZE
+  };
+
   virtual ~CFluidModel() {}
 
   /*!
@@ -186,6 +220,17 @@ class CFluidModel {
     return mass_diffusivity;
   }
 
+  /*!
+   * \brief Compute the laminar viscosity and thermal conductivity at the current state, or reuse the values cached
+   *        for a point if its density, temperature, and eddy viscosity changed by less than a relative tolerance.
+   * \note After this call the viscosity and conductivity of the model are those of the cache.
+   * \param[in,out] cache - Transport properties of the point (layout given by TransportCacheIndex), updated when
+   *                        they are recomputed.
+   * \param[in] tol - Relative tolerance on the changes of the state.
+   * \return True if the cached values were used.
+   */
+  bool ComputeTransportCached(su2double* cache, su2double tol);
+
   /*!
    * \brief Get fluid pressure partial derivative.
    */
@@ -274,6 +319,44 @@ class CFluidModel {
    */
   virtual void SetTDState_rhoe(su2double rho, su2double e) {}
 
+  /*!
+   * \brief Set the thermodynamic states of a block of points from density and static energy.
+   * \note The default evaluates the points one at a time with SetTDState_rhoe, models with closed-form
+   *       expressions override it with loops that can be vectorized. The state of the model itself is
+   *       unspecified afterwards.
+   * \param[in] nPoint - Number of points, at most BlockSize.
+   * \param[in] rho - Density of the points.
+   * \param[in] e - Static energy of the points.
+   * \param[out] state - Thermodynamic states of the points.
+   */
+  virtual void SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                    TDStateBlock& state);
+
+  /*!
+   * \brief Whether the model evaluates all points at once (SetTDStateBatch_rhoe), e.g. on an offload device,
+   *        instead of block by block.
+   */
+  virtual bool HasBatchEvaluation() const { return false; }
+
+  /*!
+   * \brief Evaluate the thermodynamic states of a batch of points from density and static energy, which are then
+   *        retrieved in blocks with GetTDStateBatch.
+   * \param[in] nPoint - Number of points.
+   * \param[in] rho - Density of the points.
+   * \param[in] e - Static energy of the points.
+   */
+  virtual void SetTDStateBatch_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e) {}
+
+  /*!
+   * \brief Get the thermodynamic states of a block of points of the last batch (SetTDStateBatch_rhoe).
+   * \param[in] offset - Index of the first point of the block in the batch.
+   * \param[in] nPoint - Number of points, at most BlockSize.
+   * \param[in] rho - Density of the points.
+   * \param[out] state - Thermodynamic states of the points.
+   */
+  virtual void GetTDStateBatch(unsigned long offset, unsigned long nPoint, const su2double* rho,
+                               TDStateBlock& state) const {}
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("PT").
@@ -0,0 +1,123 @@
+/*!
+ * \file CFluidTableGenerator.hpp
+ * \brief Generation of lookup tables for the data-driven fluid model from other fluid models.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CFluidModel.hpp"
+
+class CConfig;
+
+/*!
+ * \class CFluidTableGenerator
+ * \brief Samples a fluid model on an adaptive quadtree in (density, static energy) and writes a lookup table
+ *        with the entropy and its derivatives, as required by CDataDrivenFluid.
+ * \note Cells are refined until the pressure, temperature, and speed of sound at their center are within a
+ *       relative tolerance of the average of their corners. This concentrates points where the properties vary
+ *       quickly, e.g. near the critical point and the saturation dome. Each leaf is split into a fan of triangles
+ *       around its center, which includes the corners of finer neighbors, so the triangulation is conforming.
+ *       The density is sampled logarithmically.
+ */
+class CFluidTableGenerator {
+ public:
+  static constexpr unsigned short nVar = 8; /*!< \brief Density, energy, entropy and its derivatives. */
+  static const std::array<std::string, nVar> VarNames; /*!< \brief Names of the table variables. */
+
+ private:
+  CFluidModel* fluid;               /*!< \brief The tabulated fluid model. */
+  passivedouble rho_min, rho_max;   /*!< \brief Density range. */
+  passivedouble e_min, e_max;       /*!< \brief Static energy range. */
+  unsigned short base_level;        /*!< \brief Level of the uniform base grid. */
+  unsigned short max_level;         /*!< \brief Maximum refinement level. */
+  passivedouble tolerance;          /*!< \brief Relative tolerance of the refinement criterion. */
+  unsigned long n_res;              /*!< \brief Resolution of the integer coordinates of the points. */
+
+  std::unordered_map<uint64_t, unsigned long> point_ids;    /*!< \brief Map from coordinates to points. */
+  std::vector<std::array<passivedouble, nVar>> point_data;  /*!< \brief Table variables of the points. */
+  std::vector<std::array<passivedouble, 3>> point_check;    /*!< \brief Pressure, temperature, speed of sound. */
+  std::vector<bool> point_valid;                            /*!< \brief Whether the fluid model is valid there. */
+  std::vector<std::array<unsigned long, 3>> triangles;      /*!< \brief Triangles of the table. */
+  std::vector<unsigned long> hull;                          /*!< \brief Points on the boundary of the table. */
+
+  /*!
+   * \brief Get the point at integer coordinates (ix, iy), evaluating the fluid model if it does not exist yet.
+   */
+  unsigned long GetPoint(unsigned long ix, unsigned long iy);
+
+  /*!
+   * \brief Get the point at integer coordinates (ix, iy) if it exists.
+   */
+  bool FindPoint(unsigned long ix, unsigned long iy, unsigned long& id) const;
+
+  /*!
+   * \brief Check the refinement criterion of the cell with lower left corner (ix, iy).
+   */
+  bool NeedsRefinement(unsigned long ix, unsigned long iy, unsigned long size);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] fluid_model - The (dimensional) fluid model to tabulate.
+   * \param[in] range - Minimum and maximum density, minimum and maximum static energy.
+   * \param[in] levels - Level of the uniform base grid, and maximum level of the adaptive refinement.
+   * \param[in] tol - Relative tolerance of the refinement criterion.
+   */
+  CFluidTableGenerator(CFluidModel* fluid_model, const std::array<su2double, 4>& range,
+                       const std::array<unsigned short, 2>& levels, su2double tol);
+
+  /*!
+   * \brief Sample the fluid model and build the triangulation.
+   */
+  void Generate();
+
+  /*!
+   * \brief Write the table in the ASCII format (.drg) read by CLookUpTable.
+   * \param[in] file_name - Name of the file.
+   */
+  void WriteTable(const std::string& file_name) const;
+
+  /*!
+   * \brief Get the number of points of the table.
+   */
+  unsigned long GetnPoints() const { return point_data.size(); }
+
+  /*!
+   * \brief Get the number of triangles of the table.
+   */
+  unsigned long GetnTriangles() const { return triangles.size(); }
+
+  /*!
+   * \brief Generate the lookup table of the data-driven fluid model as specified in the config (LUT_GENERATE
+   *        options), on the master rank. A binary table (.drb) is written if the file name has that extension.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static void GenerateFromConfig(const CConfig* config);
+};
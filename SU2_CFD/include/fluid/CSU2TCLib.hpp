@@ -95,6 +95,8 @@ private:
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
 
+  vector<su2activematrix> RxnConstantTables; /*!< \brief Equilibrium constants table of each reaction. */
+
   C3DDoubleMatrix Omega11,       /*!< \brief Collision integrals (Omega^(1,1)) */
   Omega22;                       /*!< \brief Collision integrals (Omega^(2,2)) */
 
@@ -224,8 +226,9 @@ public:
    * \brief Calculates constants used for Keq correlation.
    * \param[out] A - Reference to coefficient array.
    * \param[in] val_reaction - Reaction number indicator.
+   * \param[in] N - Mixture number density [1/cm^3].
    */
-  void ComputeKeqConstants(unsigned short val_Reaction);
+  void ComputeKeqConstants(unsigned short val_Reaction, su2double N);
 
   /*!
    * \brief Calculate species diffusion coefficients with Wilke/Blottner/Eucken transport model.
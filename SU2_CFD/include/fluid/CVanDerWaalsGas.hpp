@@ -53,6 +53,16 @@ class CVanDerWaalsGas final : public CIdealGas {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Set the Dimensionless State of a block of points using Density and Internal Energy (vectorized).
+   * \param[in] nPoint - Number of points.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   * \param[out] state - Thermodynamic states of the points.
+   */
+  void SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                            TDStateBlock& state) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Temperature
    * \param[in] P - first thermodynamic variable.
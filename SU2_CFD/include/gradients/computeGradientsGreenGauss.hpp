@@ -27,15 +27,104 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
 #include "correctGradientsSymmetry.hpp"
+#include "gradientHooks.hpp"
 
 namespace detail {
 
+/*!
+ * \brief Contributions of the interior faces (edges) to the Green-Gauss gradients, computed on the offload device.
+ * \note Generic fields and gradients are computed on the host (returns false).
+ */
+template <size_t nDim, class FieldType, class GradientType>
+inline bool computeGradientsGreenGaussDevice(CGeometry&, const CConfig&, const FieldType&, size_t, size_t,
+                                             GradientType&) {
+  return false;
+}
+
+/*!
+ * \brief Version of the above for the containers of the solvers (contiguous storage), when a device is available
+ *        and the grid is static (see CGeometry::MapDualGridToDevice, which keeps the dual grid on the device).
+ * \note The field is transferred to the device and the gradients of the domain points retrieved at each call,
+ *       the threads are synchronized before returning.
+ */
+template <size_t nDim>
+bool computeGradientsGreenGaussDevice(CGeometry& geometry, const CConfig& config, const su2activematrix& field,
+                                      size_t varBegin, size_t varEnd, CVectorOfMatrix& gradient) {
+#ifdef SU2_OMP_OFFLOAD
+  static constexpr size_t MAXNVAR = 20;
+  const size_t nVarGrad = varEnd - varBegin;
+
+  if (config.GetDynamic_Grid() || nVarGrad > MAXNVAR || omp_get_num_devices() == 0) return false;
+
+  const size_t nPoint = geometry.GetnPoint();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+  /*--- Gradients of the domain points (variables in the range only) computed on the device. ---*/
+  static std::vector<su2double> buffer;
+
+  SU2_OMP_MASTER {
+    geometry.MapDualGridToDevice();
+    buffer.resize(nPointDomain * nVarGrad * nDim);
+
+    /*--- The dual grid is present on the device, mapping it again does not transfer it. ---*/
+    const auto* ptr = geometry.nodes->GetPoints().outerPtr();
+    const auto* pts = geometry.nodes->GetPoints().innerIdx();
+    const auto* edg = geometry.nodes->GetEdges().innerIdx();
+    const auto* normal = geometry.edges->GetNormal().data();
+    const auto* vol = geometry.nodes->GetVolume().data();
+    const auto* pvol = &geometry.nodes->GetPeriodicVolume(0);
+    const auto nAdj = geometry.nodes->GetPoints().getNumNonZeros();
+    const auto nNormal = geometry.edges->GetNormal().size();
+
+    const su2double* fld = field.data();
+    const size_t nFld = field.cols();
+    su2double* grad = buffer.data();
+
+    SU2_OMP(target teams distribute parallel for map(to : ptr[:nPoint + 1], pts[:nAdj], edg[:nAdj], \
+            normal[:nNormal], vol[:nPoint], pvol[:nPoint], fld[:nPoint * nFld]) map(from : grad[:buffer.size()]))
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      su2double g[MAXNVAR * nDim] = {0.0};
+      const su2double halfOnVol = 0.5 / (vol[iPoint] + pvol[iPoint]);
+
+      for (auto k = ptr[iPoint]; k < ptr[iPoint + 1]; ++k) {
+        const size_t jPoint = pts[k];
+        const su2double weight = (iPoint < jPoint ? 1.0 : -1.0) * halfOnVol;
+        const su2double* area = &normal[edg[k] * nDim];
+
+        for (size_t iVar = 0; iVar < nVarGrad; ++iVar) {
+          const su2double flux = weight * (fld[iPoint * nFld + varBegin + iVar] + fld[jPoint * nFld + varBegin + iVar]);
+          for (size_t iDim = 0; iDim < nDim; ++iDim) g[iVar * nDim + iDim] += flux * area[iDim];
+        }
+      }
+      for (size_t i = 0; i < nVarGrad * nDim; ++i) grad[iPoint * nVarGrad * nDim + i] = g[i];
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain, omp_get_num_threads()))
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    for (size_t iVar = 0; iVar < nVarGrad; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, varBegin + iVar, iDim) = buffer[(iPoint * nVarGrad + iVar) * nDim + iDim];
+  }
+  END_SU2_OMP_FOR
+  return true;
+#else
+  return false;
+#endif
+}
+
 /*!
  * \brief Compute the gradient of a field using the Green-Gauss theorem.
  * \ingroup FvmAlgos
@@ -56,11 +145,13 @@ namespace detail {
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[in] idxVel - Index of velocity, or -1 if no velocity present.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] hook - Optional, point-wise work fused with the gradient computation (see NoPointHook).
  */
-template <size_t nDim, class FieldType, class GradientType>
+template <size_t nDim, class FieldType, class GradientType, class PointHook = NoPointHook>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
-                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+                                const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient,
+                                const PointHook& hook = PointHook()) {
   const size_t nPointDomain = geometry.GetnPointDomain();
 
 #ifdef HAVE_OMP
@@ -71,57 +162,68 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
 
   static constexpr size_t MAXNVAR = 20;
 
-  /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
+  /*--- For each (non-halo) volume integrate over its faces (edges), on the offload device if possible. ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
-    auto nodes = geometry.nodes;
+  const bool onDevice = std::is_same<PointHook, NoPointHook>::value &&
+                        computeGradientsGreenGaussDevice<nDim>(geometry, config, field, varBegin, varEnd, gradient);
+
+  if (!onDevice) {
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      auto nodes = geometry.nodes;
+
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(nodes->GetVolume(iPoint));
+      AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(nodes->GetVolume(iPoint));
-    AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) AD::SetPreaccIn(field(iPoint, iVar));
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) AD::SetPreaccIn(field(iPoint, iVar));
+      /*--- Clear the gradient. --*/
 
-    /*--- Clear the gradient. --*/
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) = 0.0;
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) = 0.0;
+      hook.begin(iPoint);
 
-    /*--- Handle averaging and division by volume in one constant. ---*/
+      /*--- Handle averaging and division by volume in one constant. ---*/
 
-    su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
+      su2double halfOnVol = 0.5 / (nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint));
 
-    /*--- Add a contribution due to each neighbor. ---*/
+      /*--- Add a contribution due to each neighbor. ---*/
 
-    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh) {
-      size_t iEdge = nodes->GetEdge(iPoint, iNeigh);
-      size_t jPoint = nodes->GetPoint(iPoint, iNeigh);
+      for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh) {
+        size_t iEdge = nodes->GetEdge(iPoint, iNeigh);
+        size_t jPoint = nodes->GetPoint(iPoint, iNeigh);
 
-      /*--- Determine if edge points inwards or outwards of iPoint.
-       *    If inwards we need to flip the area vector. ---*/
+        hook.neighbor(iPoint, jPoint);
 
-      su2double dir = (iPoint < jPoint) ? 1.0 : -1.0;
-      su2double weight = dir * halfOnVol;
+        /*--- Determine if edge points inwards or outwards of iPoint.
+         *    If inwards we need to flip the area vector. ---*/
 
-      const auto area = geometry.edges->GetNormal(iEdge);
-      AD::SetPreaccIn(area, nDim);
+        su2double dir = (iPoint < jPoint) ? 1.0 : -1.0;
+        su2double weight = dir * halfOnVol;
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
-        AD::SetPreaccIn(field(jPoint, iVar));
-        su2double flux = weight * (field(iPoint, iVar) + field(jPoint, iVar));
+        const auto area = geometry.edges->GetNormal(iEdge);
+        AD::SetPreaccIn(area, nDim);
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) += flux * area[iDim];
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          AD::SetPreaccIn(field(jPoint, iVar));
+          su2double flux = weight * (field(iPoint, iVar) + field(jPoint, iVar));
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim) gradient(iPoint, iVar, iDim) += flux * area[iDim];
+        }
       }
-    }
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim) AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim) AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+
+      AD::EndPreacc();
 
-    AD::EndPreacc();
+      hook.end(iPoint);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   su2double flux[MAXNVAR] = {0.0};
 
@@ -167,17 +269,9 @@ void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PER
 
   if (solver == nullptr) return;
 
-  /*--- Account for periodic contributions. ---*/
+  /*--- Account for periodic contributions, and obtain the gradients at halo points from the ranks that own them. ---*/
 
-  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic() / 2; ++iPeriodic) {
-    solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-  }
-
-  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
-
-  solver->InitiateComms(&geometry, &config, kindMpiComm);
-  solver->CompleteComms(&geometry, &config, kindMpiComm);
+  solver->PeriodicAndHaloComms(&geometry, &config, kindPeriodicComm, kindMpiComm);
 }
 }  // namespace detail
 
@@ -191,6 +285,8 @@ template <class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
                                 const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::GRADIENTS);
+
   switch (geometry.GetnDim()) {
     case 2:
       detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
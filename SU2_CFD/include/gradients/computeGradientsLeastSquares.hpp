@@ -26,9 +26,13 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
 #include "correctGradientsSymmetry.hpp"
+#include "gradientHooks.hpp"
 
 namespace detail {
 
@@ -66,6 +70,46 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
   Smatrix[2][2] = (z33*z33)/detR2;
 }
 
+/*!
+ * \brief Compute Smatrix := inv(R)*transpose(inv(R)) from the entries of Rmatrix.
+ * \ingroup FvmAlgos
+ * \note Only the upper triangular part of Smatrix is set (it is zero for singular matrices),
+ *       the entries of the 3rd row and column are ignored in 2D.
+ */
+template<size_t nDim>
+FORCEINLINE void computeLeastSquaresSmatrix(su2double r11, su2double r12, su2double r22, su2double r13,
+                                            su2double r23_a, su2double r23_b, su2double r33,
+                                            su2double Smatrix[][nDim]) {
+  const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
+
+  /*--- Entries of upper triangular matrix R. ---*/
+
+  su2double r23 = 0.0;
+
+  r11 = sqrt(max(r11, eps));
+  r12 /= r11;
+  r22 = sqrt(max(r22 - r12*r12, eps));
+
+  if (nDim == 3) {
+    r13 /= r11;
+    r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+    r33 = sqrt(max(r33 - r23*r23 - r13*r13, eps));
+  } else {
+    r13 = 0.0;
+    r33 = 1.0;
+  }
+
+  /*--- Compute determinant ---*/
+
+  const su2double detR2 = pow(r11*r22*r33, 2);
+
+  /*--- Detect singular matrix ---*/
+
+  if (detR2 > eps) {
+    computeSmatrix(r11, r12, r13, r22, r23, r33, detR2, Smatrix);
+  }
+}
+
 /*!
  * \brief Solve the least-squares problem for one point.
  * \ingroup FvmAlgos
@@ -79,56 +123,30 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
                                    const RMatrixType& Rmatrix,
                                    GradientType& gradient)
 {
-  const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
-
-  /*--- Entries of upper triangular matrix R. ---*/
-
   if (periodic) {
     AD::StartPreacc();
     AD::SetPreaccIn(Rmatrix(iPoint,0,0));
     AD::SetPreaccIn(Rmatrix(iPoint,0,1));
     AD::SetPreaccIn(Rmatrix(iPoint,1,1));
-  }
-
-  su2double r11 = Rmatrix(iPoint,0,0);
-  su2double r12 = Rmatrix(iPoint,0,1);
-  su2double r22 = Rmatrix(iPoint,1,1);
-  su2double r13 = 0.0, r23 = 0.0, r33 = 1.0;
-
-  r11 = sqrt(max(r11, eps));
-  r12 /= r11;
-  r22 = sqrt(max(r22 - r12*r12, eps));
-
-  if (nDim == 3) {
-    if (periodic) {
+    if (nDim == 3) {
       AD::SetPreaccIn(Rmatrix(iPoint,0,2));
       AD::SetPreaccIn(Rmatrix(iPoint,1,2));
       AD::SetPreaccIn(Rmatrix(iPoint,2,1));
       AD::SetPreaccIn(Rmatrix(iPoint,2,2));
     }
-
-    r13 = Rmatrix(iPoint,0,2);
-    r33 = Rmatrix(iPoint,2,2);
-    const auto r23_a = Rmatrix(iPoint,1,2);
-    const auto r23_b = Rmatrix(iPoint,2,1);
-
-    r13 /= r11;
-    r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-    r33 = sqrt(max(r33 - r23*r23 - r13*r13, eps));
   }
 
-  /*--- Compute determinant ---*/
-
-  const su2double detR2 = pow(r11*r22*r33, 2);
-
   /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
   su2double Smatrix[nDim][nDim] = {{0.0}};
 
-  /*--- Detect singular matrix ---*/
-
-  if (detR2 > eps) {
-    computeSmatrix(r11, r12, r13, r22, r23, r33, detR2, Smatrix);
+  if (nDim == 3) {
+    computeLeastSquaresSmatrix<nDim>(Rmatrix(iPoint,0,0), Rmatrix(iPoint,0,1), Rmatrix(iPoint,1,1),
+                                     Rmatrix(iPoint,0,2), Rmatrix(iPoint,1,2), Rmatrix(iPoint,2,1),
+                                     Rmatrix(iPoint,2,2), Smatrix);
+  } else {
+    computeLeastSquaresSmatrix<nDim>(Rmatrix(iPoint,0,0), Rmatrix(iPoint,0,1), Rmatrix(iPoint,1,1),
+                                     0.0, 0.0, 0.0, 1.0, Smatrix);
   }
 
   if (periodic) {
@@ -162,11 +180,98 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   }
 }
 
+/*!
+ * \brief Compute the least-squares weights of the neighbors of each point, such that the gradient
+ *        of a field at iPoint is the sum over neighbors of weights(k,:) * (field_j - field_i).
+ * \ingroup FvmAlgos
+ * \note The weights are S * w_ij * d_ij, where S is the Smatrix of iPoint, w_ij the (inverse-distance)
+ *       weight of the neighbor, and d_ij the distance vector. "k" follows the sparse structure of the
+ *       neighbors of each point, see CPoint::GetPoints. This must be called by all threads.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[out] weights - The weights, nDim per neighbor of each non-halo point.
+ */
+template<size_t nDim>
+void computeLeastSquaresWeights(CGeometry& geometry, bool weighted, su2activematrix& weights)
+{
+  const auto nodes = geometry.nodes;
+  const auto& points = nodes->GetPoints();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+  SU2_OMP_MASTER
+  weights.resize(points.outerPtr()[nPointDomain], nDim) = su2double(0.0);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_DYN(512)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    /*--- Same Rmatrix as in computeGradientsLeastSquares. ---*/
+
+    su2double Rmatrix[3][3] = {{0.0}};
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, nodes->GetCoord(jPoint), coord_i, dist_ij);
+
+      su2double weight = 1.0;
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+      if (weight > 0.0)
+      {
+        weight = 1.0 / weight;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = iDim; jDim < nDim; ++jDim)
+            Rmatrix[iDim][jDim] += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+        if (nDim == 3)
+          Rmatrix[2][1] += dist_ij[0]*dist_ij[nDim-1]*weight;
+      }
+    }
+
+    su2double Smatrix[nDim][nDim] = {{0.0}};
+
+    computeLeastSquaresSmatrix<nDim>(Rmatrix[0][0], Rmatrix[0][1], Rmatrix[1][1], Rmatrix[0][2],
+                                     Rmatrix[1][2], Rmatrix[2][1], (nDim == 3) ? Rmatrix[2][2] : 1.0, Smatrix);
+
+    /*--- Weights of each neighbor. ---*/
+
+    auto k = points.outerPtr()[iPoint];
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, nodes->GetCoord(jPoint), coord_i, dist_ij);
+
+      su2double weight = 1.0;
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+      if (weight > 0.0)
+      {
+        weight = 1.0 / weight;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            weights(k,iDim) += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * dist_ij[jDim] * weight;
+      }
+      ++k;
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
  * \ingroup FvmAlgos
- * \note See notes from computeGradientsGreenGauss.hpp.
+ * \note See notes from computeGradientsGreenGauss.hpp. For static meshes, without periodicity,
+ *       and without AD, the weights can be stored (see CConfig::GetCache_LeastSquares_Weights and
+ *       computeLeastSquaresWeights), the gradient is then a weighted sum over neighbors, and Rmatrix
+ *       is not used.
  * \param[in] solver - Optional, solver associated with the field (used only for MPI).
  * \param[in] kindMpiComm - Type of MPI communication required.
  * \param[in] kindPeriodicComm - Type of periodic communication required.
@@ -179,8 +284,9 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] idxVel - Index to velocity, -1 if no velocity is present in the solver.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in] hook - Optional, point-wise work fused with the gradient computation (see NoPointHook).
  */
-template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+template<size_t nDim, class FieldType, class GradientType, class RMatrixType, class PointHook = NoPointHook>
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -192,7 +298,8 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const size_t varEnd,
                                   const int idxVel,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  const PointHook& hook = PointHook())
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
@@ -205,107 +312,158 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
-  /*--- First loop over non-halo points of the grid. ---*/
+  /*--- The weights can be stored for static meshes, without periodicity (Rmatrix is communicated),
+   *    and without AD (the weights would be constants in the recording). ---*/
 
-  SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  const bool cached = !periodic && config.GetCache_LeastSquares_Weights() &&
+                      !config.GetDynamic_Grid() && !config.GetDiscrete_Adjoint();
+
+  if (cached)
   {
-    auto nodes = geometry.nodes;
-    const auto coord_i = nodes->GetCoord(iPoint);
+    auto& weights = geometry.GetLeastSquaresWeights(weighted);
 
-    /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
-    if (omp_get_num_threads() == 1) AD::StartPreacc();
-    AD::SetPreaccIn(coord_i, nDim);
+    /*--- All threads must check before the weights are (possibly) allocated. ---*/
+    const bool compute = weights.empty();
+    SU2_OMP_BARRIER
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      AD::SetPreaccIn(field(iPoint,iVar));
+    if (compute) computeLeastSquaresWeights<nDim>(geometry, weighted, weights);
 
-    /*--- Clear gradient and Rmatrix. ---*/
+    const auto& points = geometry.nodes->GetPoints();
 
-    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        gradient(iPoint, iVar, iDim) = 0.0;
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
 
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Rmatrix(iPoint, iDim, jDim) = 0.0;
+      hook.begin(iPoint);
 
+      auto k = points.outerPtr()[iPoint];
 
-    for (auto jPoint : nodes->GetPoints(iPoint))
-    {
-      const auto coord_j = geometry.nodes->GetCoord(jPoint);
-      AD::SetPreaccIn(coord_j, nDim);
+      for (auto jPoint : geometry.nodes->GetPoints(iPoint))
+      {
+        hook.neighbor(iPoint, jPoint);
 
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          const su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
 
-      /*--- Distance vector from iPoint to jPoint ---*/
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += weights(k,iDim) * delta_ij;
+        }
+        ++k;
+      }
 
-      su2double dist_ij[nDim] = {0.0};
-      GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+      hook.end(iPoint);
+    }
+    END_SU2_OMP_FOR
+  }
+  else
+  {
+    /*--- First loop over non-halo points of the grid. ---*/
 
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      auto nodes = geometry.nodes;
+      const auto coord_i = nodes->GetCoord(iPoint);
 
-      /*--- Compute inverse weight, default 1 (unweighted). ---*/
+      /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
+      if (omp_get_num_threads() == 1) AD::StartPreacc();
+      AD::SetPreaccIn(coord_i, nDim);
 
-      su2double weight = 1.0;
-      if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        AD::SetPreaccIn(field(iPoint,iVar));
 
-      /*--- Summations for entries of upper triangular matrix R. ---*/
+      /*--- Clear gradient and Rmatrix. ---*/
 
-      if (weight > 0.0)
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rmatrix(iPoint, iDim, jDim) = 0.0;
+
+      hook.begin(iPoint);
+
+      for (auto jPoint : nodes->GetPoints(iPoint))
       {
-        weight = 1.0 / weight;
+        hook.neighbor(iPoint, jPoint);
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = iDim; jDim < nDim; ++jDim)
-            Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+        const auto coord_j = geometry.nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
 
-        if (nDim == 3)
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
 
-        /*--- Entries of c:= transpose(A)*b ---*/
+        /*--- Distance vector from iPoint to jPoint ---*/
 
-        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
-        {
-          AD::SetPreaccIn(field(jPoint,iVar));
+        su2double dist_ij[nDim] = {0.0};
+        GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+
+        /*--- Compute inverse weight, default 1 (unweighted). ---*/
 
-          su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+        su2double weight = 1.0;
+        if(weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+        /*--- Summations for entries of upper triangular matrix R. ---*/
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
 
           for (size_t iDim = 0; iDim < nDim; ++iDim)
-            gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+            for (size_t jDim = iDim; jDim < nDim; ++jDim)
+              Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+          if (nDim == 3)
+            Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+          /*--- Entries of c:= transpose(A)*b ---*/
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            AD::SetPreaccIn(field(jPoint,iVar));
+
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+          }
         }
       }
-    }
-
-    if (periodic)
-    {
-      /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
 
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
+      if (periodic)
+      {
+        /*--- A second loop is required after periodic comms, checkpoint the preacc. ---*/
 
-      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
         for (size_t iDim = 0; iDim < nDim; ++iDim)
-          AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            AD::SetPreaccOut(Rmatrix(iPoint, iDim, jDim));
 
-      AD::EndPreacc();
-    }
-    else {
-      /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            AD::SetPreaccOut(gradient(iPoint, iVar, iDim));
+
+        AD::EndPreacc();
+      }
+      else {
+        /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
+
+        solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      }
 
-      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+      hook.end(iPoint);
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- Correct the gradient values across any periodic boundaries. ---*/
 
   if (periodic)
   {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
-    }
+    solver->PeriodicComms(&geometry, &config, kindPeriodicComm);
 
     /*--- Second loop over points of the grid to compute final gradient. ---*/
 
@@ -349,6 +507,8 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const int idxVel,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::GRADIENTS);
+
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
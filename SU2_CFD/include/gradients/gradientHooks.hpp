@@ -0,0 +1,53 @@
+/*!
+ * \file gradientHooks.hpp
+ * \brief Point-wise hooks for the gradient algorithms.
+ * \note These allow other point-wise work (e.g. limiters) to be fused with
+ *       the computation of gradients, see computeGradientsAndLimiters.hpp.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+
+namespace detail {
+
+/*!
+ * \brief Default hook of the gradient algorithms, does nothing.
+ * \ingroup FvmAlgos
+ * \note The methods of a hook are called, for each non-halo point, by the thread that owns the point:
+ *       - begin(iPoint), before the contributions of the neighbors are added to the gradient of iPoint;
+ *       - neighbor(iPoint, jPoint), once for each direct neighbor of iPoint;
+ *       - end(iPoint), after the point loop of the algorithm is done with iPoint. At that stage the gradient
+ *         is final only for points that are not on a boundary (and if there is no periodicity), boundary
+ *         contributions and symmetry corrections are added afterwards.
+ *       The methods are const since hooks are passed by const reference, they can still write to the data
+ *       they refer to. They are called outside of AD preaccumulation regions only at "end".
+ */
+struct NoPointHook {
+  FORCEINLINE void begin(size_t) const {}
+  FORCEINLINE void neighbor(size_t, size_t) const {}
+  FORCEINLINE void end(size_t) const {}
+};
+
+}  // namespace detail
@@ -34,6 +34,7 @@
 #include "../solvers/CSolver.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 using namespace std;
 
@@ -49,6 +50,8 @@ protected:
   int rank,      /*!< \brief MPI Rank. */
   size;          /*!< \brief MPI Size. */
 
+  CQuasiNewtonInvLeastSquares<passivedouble> NonlinearAccelerator; /*!< \brief Anderson acceleration. */
+
   /*!
    * \brief Do the space integration of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -74,6 +77,16 @@ protected:
   void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                         unsigned short iRKStep, unsigned short RunTime_EqSystem);
 
+  /*!
+   * \brief Anderson acceleration of the nonlinear iterations, the solution is replaced by a least squares
+   *        combination of the results of the previous iterations (NONLINEAR_ACCELERATION).
+   * \note The history starts at the first inner iteration (of each time step, or of each run of a steady problem).
+   * \param[in] geometry - Geometrical definition of the problem (finest mesh).
+   * \param[in] solver - Solver whose solution is accelerated.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AccelerateNonlinearIteration(const CGeometry *geometry, CSolver *solver, const CConfig *config);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -31,6 +31,7 @@
  * \class CMultiGridIntegration
  * \ingroup Drivers
  * \brief Class for time integration using a multigrid method.
+ * \note Used for the flow solvers and, optionally (MG_SCALAR_SOLVERS), for the turbulence and species solvers.
  * \author F. Palacios
  */
 class CMultiGridIntegration final : public CIntegration {
@@ -72,13 +73,14 @@ private:
 
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                        CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
@@ -90,11 +92,25 @@ private:
 
   /*!
    * \brief Set the value of the corrected fine grid solution.
+   * \note For the scalar solvers (turbulence and species) the correction is limited to preserve positivity.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
+  void SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CGeometry *geo_fine,
+                                 CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Update the auxiliary variables of a scalar solver (e.g. the eddy viscosity) after the cycle and
+   *        restrict its solution to the coarse grids, the flow solver uses them on those grids.
+   * \param[in] geometry - Geometrical definition of the problem (all grids).
+   * \param[in] solver_container - Container vector with all the solutions (all grids).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void ScalarPostprocessing(CGeometry **geometry, CSolver ***solver_container, CConfig *config,
+                            unsigned short RunTime_EqSystem);
 
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
@@ -133,6 +149,28 @@ private:
   void SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config);
 
+  /*!
+   * \brief Grid sequencing (full multigrid) start-up, once the current finest grid has done its iterations
+   *        (FULLMG_ITER), the flow and scalar solutions are prolongated to the next finer grid, which becomes
+   *        the finest grid of the cycle.
+   * \param[in] geometry - Geometrical definition of the problem (all grids).
+   * \param[in,out] solver_container - Container vector with all the solutions (all grids).
+   * \param[in,out] config - Definition of the particular problem.
+   */
+  void FullMG_Startup(CGeometry **geometry, CSolver ***solver_container, CConfig *config);
+
+  /*!
+   * \brief Set the local CFL of the flow and scalar solvers of a grid, either to the CFL used while the grid is
+   *        the finest grid of the grid sequencing (FULLMG_CFL) or back to its multigrid CFL.
+   * \param[in] iMesh - Index of the grid.
+   * \param[in] finest - Whether the grid is the current finest grid.
+   * \param[in] geometry - Geometrical definition of the problem (all grids).
+   * \param[in,out] solver_container - Container vector with all the solutions (all grids).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetFullMG_CFL(unsigned short iMesh, bool finest, CGeometry **geometry, CSolver ***solver_container,
+                     const CConfig *config);
+
   /*!
    * \brief Compute the fine grid correction from the coarse solution.
    * \param[out] sol_fine - Pointer to the solution on the fine grid.
@@ -69,6 +69,8 @@ private:
   bool setup = false;
   Scalar finDiffStepND = 0.0;
   Scalar finDiffStep = 0.0; /*!< \brief Based on RMS(solution), used in matrix-free products. */
+  bool frozenGradients = false; /*!< \brief Gradients and limiters are not recomputed in matrix-free products. */
+  bool assembledJacobian = false; /*!< \brief Use the assembled Jacobian instead of matrix-free products. */
   unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
 
   /*--- Number of iterations and tolerance for the linear preconditioner,
@@ -99,6 +101,11 @@ private:
   CSysVector<Scalar> LinSysRes;
   CSysSolve<Scalar> LinSolver;
 
+  /*--- Jacobian of the second order residual (with frozen gradients and limiters), and the coloring
+   * of the points (no two points of a color have common neighbors) used to assemble it. ---*/
+  CSysMatrix<Scalar> Jacobian;
+  CCompressedSparsePatternUL jacobianColoring;
+
   /*--- If possible the solution vector of the solver is re-used, otherwise this temporary is used. ---*/
   CSysVector<Scalar> LinSysSol;
 
@@ -181,6 +188,14 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Assemble the Jacobian of the nonlinear residuals by finite differences, one residual evaluation per
+   *        variable and color of the points. The gradients and limiters are frozen, which makes the stencil of
+   *        each column the neighbors of the point, this also keeps the assembly local to each rank.
+   * \note Must be called after ComputeFinDiffStep.
+   */
+  void AssembleJacobian();
+
 public:
   /*!
    * \brief Constructor.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -36,6 +37,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -73,6 +75,25 @@ protected:
   unsigned short nVar = 0;
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*!
+   * \brief Point-to-point communication pattern of an interface, each rank sends the variables of its donor
+   *        vertices only to the ranks whose target vertices use them.
+   */
+  struct CTransferPattern {
+    bool active = false;                  /*!< \brief Whether the interface connects the two zones. */
+    vector<int> sendProc, recvProc;       /*!< \brief Ranks to which data is sent / from which it is received. */
+    vector<unsigned long> sendStart;      /*!< \brief Start of the data of each send rank in sendVertex (CSR). */
+    vector<unsigned long> recvStart;      /*!< \brief Start of the data of each recv rank in recvGlobalIdx (CSR). */
+    vector<unsigned long> sendVertex;     /*!< \brief Donor vertices (marker index) that are sent. */
+    vector<unsigned long> recvGlobalIdx;  /*!< \brief Global index of the donors received, sorted for each rank. */
+    vector<int> recvProcIdx;              /*!< \brief Map from rank to index in recvProc (-1 if none). */
+    su2activematrix sendBuf, recvBuf;     /*!< \brief Buffers of donor variables. */
+    vector<SU2_MPI::Request> requests;    /*!< \brief Requests of the non-blocking communications. */
+  };
+  vector<CTransferPattern> transferPattern;      /*!< \brief Communication pattern of each interface marker. */
+  const CInterpolator* patternInterpolator = nullptr; /*!< \brief Interpolator from which the pattern was built. */
+  unsigned long patternUpdates = 0;              /*!< \brief Number of updates of that interpolator at the time. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -92,7 +113,8 @@ public:
   virtual ~CInterface(void);
 
   /*!
-   * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \brief Interpolate data for nonmatching meshes, the donor data is sent point-to-point (non-blocking)
+   *        to the ranks that need it, following the pattern built from the donors of the interpolator.
    * \param[in] interpolator - Object defining the interpolation.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
@@ -107,6 +129,19 @@ public:
                      const CConfig *donor_config, const CConfig *target_config);
 
 protected:
+  /*!
+   * \brief Build the point-to-point communication patterns of the interface markers from the
+   *        donors of the interpolator (collective, only when the interpolator changes).
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void BuildTransferPattern(const CInterpolator& interpolator, CGeometry *donor_geometry,
+                            CGeometry *target_geometry, const CConfig *donor_config,
+                            const CConfig *target_config);
+
   /*!
    * \brief A virtual member.
    */
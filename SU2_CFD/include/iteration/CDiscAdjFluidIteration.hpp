@@ -42,6 +42,7 @@ class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
 
+ public:
   /*!
    * \brief load unsteady solution for unsteady problems
    * \param[in] geometry - Geometrical definition of the problem.
@@ -52,9 +53,8 @@ class CDiscAdjFluidIteration final : public CIteration {
    * \param[in] val_DirectIter - Direct iteration to load.
    */
   void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short val_iZone,
-                             unsigned short val_iInst, int val_DirectIter);
+                             unsigned short val_iInst, int val_DirectIter) override;
 
- public:
   /*!
    * \brief Constructor of the class.
    * \param[in] config - Definition of the particular problem.
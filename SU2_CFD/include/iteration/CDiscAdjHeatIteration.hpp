@@ -48,7 +48,7 @@ class CDiscAdjHeatIteration final : public CIteration {
    * \param[in] val_DirectIter - Direct iteration to load.
    */
   void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config, unsigned short val_iZone,
-                             unsigned short val_iInst, int val_DirectIter);
+                             unsigned short val_iInst, int val_DirectIter) override;
 
  public:
   /*!
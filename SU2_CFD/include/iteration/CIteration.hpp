@@ -295,4 +295,16 @@ class CIteration {
 
   virtual void RegisterOutput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                               unsigned short iZone, unsigned short iInst) {}
+
+  /*!
+   * \brief Load the direct solution of a time iteration, for unsteady adjoints.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Index of the zone.
+   * \param[in] val_iInst - Index of the instance.
+   * \param[in] val_DirectIter - Direct iteration to load, the free-stream is set if negative.
+   */
+  virtual void LoadUnsteady_Solution(CGeometry**** geometry, CSolver***** solver, CConfig** config,
+                                     unsigned short val_iZone, unsigned short val_iInst, int val_DirectIter) {}
 };
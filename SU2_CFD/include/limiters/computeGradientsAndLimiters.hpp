@@ -0,0 +1,250 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Computation of gradients and limiters in a single pass over the grid.
+ * \note See computeGradientsGreenGauss.hpp, computeGradientsLeastSquares.hpp,
+ *       and computeLimiters_impl.hpp for the methods being fused.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../gradients/computeGradientsGreenGauss.hpp"
+#include "../gradients/computeGradientsLeastSquares.hpp"
+#include "computeLimiters.hpp"
+
+namespace detail {
+
+/*!
+ * \brief Gradient hook that computes the min/max of the field over the direct neighbors
+ *        of each point, and the limiters of the points whose gradient is final in the
+ *        point loop of the gradient algorithm (i.e. points that are not on boundaries).
+ * \ingroup FvmAlgos
+ */
+template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType, class LimiterType>
+struct CFusedLimiterHook {
+  static constexpr size_t MAXNVAR = 32;
+
+  CGeometry& geometry;
+  const CLimiterDetails<LimiterKind>& details;
+  const size_t varBegin, varEnd;
+  const FieldType& field;
+  const GradientType& gradient;
+  FieldType& fieldMin;
+  FieldType& fieldMax;
+  LimiterType& limiter;
+
+  FORCEINLINE void begin(size_t iPoint) const {
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      fieldMax(iPoint,iVar) = fieldMin(iPoint,iVar) = field(iPoint,iVar);
+  }
+
+  FORCEINLINE void neighbor(size_t iPoint, size_t jPoint) const {
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+      fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+    }
+  }
+
+  FORCEINLINE void end(size_t iPoint) const {
+    if (!geometry.nodes->GetBoundary(iPoint)) computeLimiter(iPoint);
+  }
+
+  /*!
+   * \brief Limiter of iPoint from its (final) gradient and the min/max over its neighbors.
+   * \note Same as the second part of the point loop of computeLimiters_impl.
+   */
+  void computeLimiter(size_t iPoint) const {
+    const auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      projMax[iVar] = projMin[iVar] = 0.0;
+
+    for (auto jPoint : nodes->GetPoints(iPoint)) {
+      const auto coord_j = nodes->GetCoord(jPoint);
+
+      su2double dist_ij[nDim] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        su2double proj = 0.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+        projMax[iVar] = max(projMax[iVar], proj);
+        projMin[iVar] = min(projMin[iVar], proj);
+      }
+    }
+
+    const su2double geoFactor = details.geometricFactor(iPoint, geometry);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      su2double limMax = details.limiterFunction(iVar, projMax[iVar], fieldMax(iPoint,iVar) - field(iPoint,iVar));
+      su2double limMin = details.limiterFunction(iVar, projMin[iVar], fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+    }
+  }
+};
+
+/*!
+ * \brief Compute the gradients (Green-Gauss or least-squares) and the limiters of a field.
+ * \ingroup FvmAlgos
+ * \note The min/max over neighbors, and the limiters of interior points, are computed in the
+ *       point loop of the gradient method, while the neighbor data is still in cache. Only the
+ *       limiters of boundary points are computed in a second (short) loop, after their gradients
+ *       are corrected, and while the gradients of halo points are being communicated.
+ */
+template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType, class RMatrixType,
+         class LimiterType>
+void computeGradientsAndLimiters(CSolver* solver, MPI_QUANTITIES kindMpiComm, CGeometry& geometry,
+                                 const CConfig& config, unsigned short kindGradient, const FieldType& field,
+                                 size_t varBegin, size_t varEnd, int idxVel, GradientType& gradient,
+                                 RMatrixType& Rmatrix, FieldType& fieldMin, FieldType& fieldMax,
+                                 LimiterType& limiter) {
+  using Hook = CFusedLimiterHook<nDim, LimiterKind, FieldType, GradientType, LimiterType>;
+
+  if (varEnd > Hook::MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  const Hook hook{geometry, limiterDetails, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter};
+
+  /*--- The gradient methods do not communicate without a solver, that is done below. ---*/
+
+  switch (kindGradient) {
+    case GREEN_GAUSS:
+      computeGradientsGreenGauss<nDim>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config, field,
+                                       varBegin, varEnd, idxVel, gradient, hook);
+      break;
+    case LEAST_SQUARES:
+    case WEIGHTED_LEAST_SQUARES:
+      computeGradientsLeastSquares<nDim>(nullptr, kindMpiComm, PERIODIC_NONE, geometry, config,
+                                         kindGradient == WEIGHTED_LEAST_SQUARES, field, varBegin, varEnd,
+                                         idxVel, gradient, Rmatrix, hook);
+      break;
+    default:
+      SU2_MPI::Error("Unsupported gradient method.", CURRENT_FUNCTION);
+      break;
+  }
+
+  if (solver != nullptr) solver->InitiateComms(&geometry, &config, kindMpiComm);
+
+  /*--- Limiters of boundary points, their gradients are now final. ---*/
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+  SU2_OMP_FOR_DYN(256)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    if (geometry.nodes->GetBoundary(iPoint)) hook.computeLimiter(iPoint);
+  }
+  END_SU2_OMP_FOR
+
+  if (solver != nullptr) solver->CompleteComms(&geometry, &config, kindMpiComm);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Compute the gradients of a field and their limiters in a single pass over the grid.
+ * \ingroup FvmAlgos
+ * \note Equivalent to computeGradientsGreenGauss/LeastSquares followed by computeLimiters
+ *       for problems without periodicity, and without AD recording (the min/max are computed
+ *       inside the preaccumulation regions of the gradients), see notes in those functions.
+ *       The limiters of halo points are not communicated, that is left to the caller, which
+ *       may then overlap them with other work.
+ * \param[in] kindLimiter - Kind of limiter, NONE or VAN_ALBADA_EDGE are not supported.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiComm - Type of MPI communication required for the gradients.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[in] idxVel - Index to velocity, -1 if no velocity is present in the solver.
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim), for least-squares.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field.
+ */
+template<class FieldType, class GradientType, class RMatrixType, class LimiterType>
+void computeGradientsAndLimiters(LIMITER kindLimiter, CSolver* solver, MPI_QUANTITIES kindMpiComm,
+                                 CGeometry& geometry, const CConfig& config, unsigned short kindGradient,
+                                 const FieldType& field, size_t varBegin, size_t varEnd, int idxVel,
+                                 GradientType& gradient, RMatrixType& Rmatrix, FieldType& fieldMin,
+                                 FieldType& fieldMax, LimiterType& limiter) {
+  if (config.GetnMarker_Periodic() > 0)
+    SU2_MPI::Error("Fused gradients and limiters are not compatible with periodicity.", CURRENT_FUNCTION);
+
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+
+#define INSTANTIATE(KIND)\
+if (geometry.GetnDim() == 2) {\
+  detail::computeGradientsAndLimiters<2,KIND>(solver, kindMpiComm, geometry, config, kindGradient, field, varBegin,\
+                                              varEnd, idxVel, gradient, Rmatrix, fieldMin, fieldMax, limiter);\
+} else {\
+  detail::computeGradientsAndLimiters<3,KIND>(solver, kindMpiComm, geometry, config, kindGradient, field, varBegin,\
+                                              varEnd, idxVel, gradient, Rmatrix, fieldMin, fieldMax, limiter);\
+}
+  switch (kindLimiter) {
+    case LIMITER::BARTH_JESPERSEN:
+      INSTANTIATE(LIMITER::BARTH_JESPERSEN);
+      break;
+    case LIMITER::VENKATAKRISHNAN:
+      INSTANTIATE(LIMITER::VENKATAKRISHNAN);
+      break;
+    case LIMITER::NISHIKAWA_R3:
+      INSTANTIATE(LIMITER::NISHIKAWA_R3);
+      break;
+    case LIMITER::NISHIKAWA_R4:
+      INSTANTIATE(LIMITER::NISHIKAWA_R4);
+      break;
+    case LIMITER::NISHIKAWA_R5:
+      INSTANTIATE(LIMITER::NISHIKAWA_R5);
+      break;
+    case LIMITER::VENKATAKRISHNAN_WANG:
+      INSTANTIATE(LIMITER::VENKATAKRISHNAN_WANG);
+      break;
+    case LIMITER::WALL_DISTANCE:
+      INSTANTIATE(LIMITER::WALL_DISTANCE);
+      break;
+    case LIMITER::SHARP_EDGES:
+      INSTANTIATE(LIMITER::SHARP_EDGES);
+      break;
+    default:
+      SU2_MPI::Error("Unsupported limiter type.", CURRENT_FUNCTION);
+      break;
+  }
+#undef INSTANTIATE
+}
@@ -25,6 +25,9 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
 
@@ -35,7 +38,7 @@
  *        of "CLimiterDetails". See corresponding hpp files for further details.
  * \ingroup FvmAlgos
  */
-template<class FieldType, class GradientType>
+template<class FieldType, class GradientType, class LimiterType>
 void computeLimiters(LIMITER LimiterKind,
                      CSolver* solver,
                      MPI_QUANTITIES kindMpiComm,
@@ -49,8 +52,10 @@ void computeLimiters(LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     LimiterType& limiter)
 {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::LIMITERS);
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
@@ -27,6 +27,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 
 /*!
  * \brief Generic limiter computation for methods based on one limiter
@@ -60,8 +62,9 @@
  * \param LimiterKind - Used to instantiate the right details class.
  * \param FieldType - Generic object with operator (iPoint,iVar).
  * \param GradientType - Generic object with operator (iPoint,iVar,iDim).
+ * \param LimiterType - As FieldType, possibly with lower precision storage.
  */
-template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType>
+template<size_t nDim, LIMITER LimiterKind, class FieldType, class GradientType, class LimiterType>
 void computeLimiters_impl(CSolver* solver,
                           MPI_QUANTITIES kindMpiComm,
                           PERIODIC_QUANTITIES kindPeriodicComm1,
@@ -74,7 +77,7 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          LimiterType& limiter)
 {
   constexpr size_t MAXNVAR = 32;
 
@@ -118,11 +121,7 @@ void computeLimiters_impl(CSolver* solver,
         fieldMax(iPoint,iVar) = fieldMin(iPoint,iVar) = field(iPoint,iVar);
     END_SU2_OMP_FOR
 
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm1);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm1);
-    }
+    solver->PeriodicComms(&geometry, &config, kindPeriodicComm1);
   }
 
   /*--- Compute limiter for each point. ---*/
@@ -220,22 +219,12 @@ void computeLimiters_impl(CSolver* solver,
   }
   END_SU2_OMP_FOR
 
-  /*--- Account for periodic effects, take the minimum limiter on each periodic pair. ---*/
-  if (periodic)
-  {
-    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
-    {
-      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
-      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm2);
-    }
-  }
-
-  /*--- Obtain the limiters at halo points from the MPI ranks that own them.
+  /*--- Account for periodic effects, take the minimum limiter on each periodic pair, and
+   *    obtain the limiters at halo points from the MPI ranks that own them.
    *    If no solver was provided we do not communicate. ---*/
   if (solver != nullptr)
   {
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    solver->PeriodicAndHaloComms(&geometry, &config, periodic ? kindPeriodicComm2 : PERIODIC_NONE, kindMpiComm);
   }
 
   AD::EndPassive(wasActive);
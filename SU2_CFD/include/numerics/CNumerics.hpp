@@ -1428,6 +1428,23 @@ public:
    */
   inline virtual void Compute_Tangent_Matrix(CElement *element_container, const CConfig* config) { }
 
+  /*!
+   * \brief A virtual member to compute the product of the stiffness matrix of an element with its nodal
+   *        displacements (current minus reference coordinates) without forming the matrix.
+   * \param[in] element_container - Element structure for the particular element integrated.
+   */
+  inline virtual void Compute_Stiffness_Product(CElement *element_container, const CConfig* config) { }
+
+  /*!
+   * \brief A virtual member to get the Lame parameters of the (isotropic, linear) material of an element.
+   * \note For plane stress, lambda is modified such that the 2D constitutive matrix has the plane strain form.
+   * \param[in] element_container - Element structure with the properties of the particular element.
+   * \param[out] lambda - First Lame parameter.
+   * \param[out] mu - Second Lame parameter.
+   */
+  inline virtual void Get_LameParameters(const CElement *element_container, const CConfig* config,
+                                         su2double& lambda, su2double& mu) { }
+
   /*!
    * \brief A virtual member to compute the nodal stress term in non-linear structural problems
    * \param[in] element_container - Definition of the particular element integrated.
@@ -43,6 +43,8 @@ private:
 
   su2double*  residual = nullptr;        /*!< \brief The source residual. */
   su2double** jacobian = nullptr;
+
+  vector<su2double> rhos;                /*!< \brief Species densities, to set the state of the fluid model. */
 public:
 
   /*!
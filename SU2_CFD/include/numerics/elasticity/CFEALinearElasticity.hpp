@@ -67,6 +67,25 @@ public:
    */
   void Compute_Tangent_Matrix(CElement *element_container, const CConfig *config) final;
 
+  /*!
+   * \brief Product of the stiffness matrix of an element with its nodal displacements, computed at the
+   *        Gauss points as B^T D (B u), without forming the matrix. The result is stored in Kt_a.
+   * \note Not differentiated, used by the matrix-free mesh solver.
+   * \param[in,out] element_container - Element whose stiffness product is computed.
+   * \param[in] config - Definition of the problem.
+   */
+  void Compute_Stiffness_Product(CElement *element_container, const CConfig *config) final;
+
+  /*!
+   * \brief Get the Lame parameters of the material of an element, used by the vectorized element kernels.
+   * \param[in] element_container - Element with the properties of the material.
+   * \param[in] config - Definition of the problem.
+   * \param[out] lambda - First Lame parameter (modified for plane stress).
+   * \param[out] mu - Second Lame parameter.
+   */
+  void Get_LameParameters(const CElement *element_container, const CConfig *config,
+                          su2double& lambda, su2double& mu) final;
+
   /*!
    * \brief Compute averaged nodal stresses (for post processing).
    * \param[in,out] element_container - The finite element.
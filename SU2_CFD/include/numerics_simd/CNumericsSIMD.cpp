@@ -29,8 +29,14 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/scalar_fluxes.hpp"
+#include "scalar/scalar_sources.hpp"
+#include "../solvers/CSolver.hpp"
 
 namespace {
 
@@ -44,6 +50,20 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::TURKEL:
+      obj = new CRoeTurkelScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -83,11 +103,31 @@ CNumericsSIMD* createCenteredNumerics(const CConfig& config, int iMesh, const CV
   return obj;
 }
 
+/*!
+ * \brief Incompressible factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createIncNumerics(const CConfig& config, int iMesh, const CVariable* turbVars, su2double* massFluxes) {
+  CNumericsSIMD* obj = nullptr;
+  if ((config.GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) ||
+      (config.GetKind_Upwind_Flow() != UPWIND::FDS)) return obj;
+
+  if (config.GetViscous())
+    obj = new CFDSIncScheme<CIncompressibleViscousFlux<nDim> >(config, iMesh, massFluxes, turbVars);
+  else
+    obj = new CFDSIncScheme<CNoViscousFlux<nDim> >(config, iMesh, massFluxes, turbVars);
+
+  return obj;
+}
+
 /*!
  * \brief Generic factory implementation.
  */
 template<int nDim>
-CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable* turbVars, su2double* massFluxes) {
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE)
+    return createIncNumerics<nDim>(config, iMesh, turbVars, massFluxes);
+
   CNumericsSIMD* obj = nullptr;
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
@@ -126,6 +166,110 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Boundary flux factory implementation, the same scheme as the non-vectorized boundary numerics,
+ * i.e. Roe for the centered schemes (compressible ideal gas only). Roe-Turkel differs from the scalar
+ * scheme (entropy fix), like the edge numerics it is only used if requested (USE_VECTORIZATION).
+ */
+template<int nDim>
+CNumericsSIMD* createBoundaryNumerics(const CConfig& config, int iMesh) {
+  const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config.GetKind_FluidModel() == IDEAL_GAS);
+  if ((config.GetKind_Regime() != ENUM_REGIME::COMPRESSIBLE) || !ideal_gas) return nullptr;
+
+  const CVariable* turbVars = nullptr;
+  CNumericsSIMD* obj = nullptr;
+
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_CENTERED:
+      obj = new CRoeScheme<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+      break;
+    case SPACE_UPWIND:
+      if (config.GetKind_Upwind_Flow() == UPWIND::ROE)
+        obj = new CRoeScheme<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+      else if ((config.GetKind_Upwind_Flow() == UPWIND::TURKEL) && config.GetUseVectorization())
+        obj = new CRoeTurkelScheme<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Scalar (turbulence, transition, species) factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, int nVar, int iSol,
+                                    const CSolver& flowSolver, const su2double* constants) {
+  const CPrimitiveIndices<unsigned short> idx(config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+                                              config.GetNEMOProblem(), nDim, config.GetnSpecies());
+  const auto& flowVars = *flowSolver.GetNodes();
+  const bool bounded = (iSol == SPECIES_SOL)? config.GetBounded_Species() : config.GetBounded_Turb();
+  const su2activevector* massFluxes = bounded? flowSolver.GetEdgeMassFluxes() : nullptr;
+
+  CNumericsSIMD* obj = nullptr;
+  switch (iSol) {
+    case TURB_SOL:
+      if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) break;
+      switch (TurbModelFamily(config.GetKind_Turb_Model())) {
+        case TURB_FAMILY::SA:
+          obj = new CSAScalarFlux<nDim>(config, flowVars, massFluxes, idx);
+          break;
+        case TURB_FAMILY::KW:
+          obj = new CSSTScalarFlux<nDim>(config, constants, flowVars, massFluxes, idx);
+          break;
+        default:
+          break;
+      }
+      break;
+    case TRANS_SOL:
+      if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) break;
+      if (config.GetKind_Trans_Model() == TURB_TRANS_MODEL::LM)
+        obj = new CLMScalarFlux<nDim>(config, flowVars, massFluxes, idx);
+      break;
+    case SPECIES_SOL:
+      if (config.GetKind_ConvNumScheme_Species() != SPACE_UPWIND) break;
+      switch (nVar) {
+        case 1: obj = new CSpeciesScalarFlux<1,nDim>(config, flowVars, massFluxes, idx); break;
+        case 2: obj = new CSpeciesScalarFlux<2,nDim>(config, flowVars, massFluxes, idx); break;
+        case 3: obj = new CSpeciesScalarFlux<3,nDim>(config, flowVars, massFluxes, idx); break;
+        case 4: obj = new CSpeciesScalarFlux<4,nDim>(config, flowVars, massFluxes, idx); break;
+        case 5: obj = new CSpeciesScalarFlux<5,nDim>(config, flowVars, massFluxes, idx); break;
+        case 6: obj = new CSpeciesScalarFlux<6,nDim>(config, flowVars, massFluxes, idx); break;
+        case 7: obj = new CSpeciesScalarFlux<7,nDim>(config, flowVars, massFluxes, idx); break;
+        case 8: obj = new CSpeciesScalarFlux<8,nDim>(config, flowVars, massFluxes, idx); break;
+        default: break;
+      }
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Scalar source terms factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createScalarSourceNumerics(const CConfig& config, int iSol, const CSolver& flowSolver,
+                                          const CSolver* turbSolver) {
+  const CPrimitiveIndices<unsigned short> idx(config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+                                              config.GetNEMOProblem(), nDim, config.GetnSpecies());
+  const auto& flowVars = *su2staticcast_p<const CFlowVariable*>(flowSolver.GetNodes());
+
+  CNumericsSIMD* obj = nullptr;
+  switch (iSol) {
+    case TRANS_SOL:
+      if (config.GetKind_Trans_Model() == TURB_TRANS_MODEL::LM && turbSolver != nullptr)
+        obj = new CLMScalarSource<nDim>(config, flowVars, *turbSolver->GetNodes(), idx);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
 } // namespace
 
 /*!
@@ -133,15 +277,40 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
  * createNumerics, which in turn instantiates the class templates of the different
  * numerical methods.
  */
-CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars) {
+CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars,
+                                             su2double* massFluxes) {
 #ifndef CODI_REVERSE_TYPE
-  if ((Double::Size < 4) && (SU2_MPI::GetRank() == MASTER_NODE)) {
-    cout << "WARNING: SU2 was not compiled for an AVX-capable architecture. Performance could be better,\n"
-            "         see https://su2code.github.io/docs_v7/Build-SU2-Linux-MacOS/#compiler-optimizations" << endl;
+  if ((simd::hostISA() > simd::compiledISA()) && (SU2_MPI::GetRank() == MASTER_NODE)) {
+    cout << "WARNING: SU2 was compiled for " << simd::isaName(simd::compiledISA()) << " but the host supports "
+         << simd::isaName(simd::hostISA()) << ". Performance could be better, see the \"simd-dispatch\" build option\n"
+            "         and https://su2code.github.io/docs_v7/Build-SU2-Linux-MacOS/#compiler-optimizations" << endl;
   }
 #endif
-  if (nDim == 2) return createNumerics<2>(config, iMesh, turbVars);
-  if (nDim == 3) return createNumerics<3>(config, iMesh, turbVars);
+  if (nDim == 2) return createNumerics<2>(config, iMesh, turbVars, massFluxes);
+  if (nDim == 3) return createNumerics<3>(config, iMesh, turbVars, massFluxes);
+
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateBoundaryNumerics(const CConfig& config, int nDim, int iMesh) {
+  if (nDim == 2) return createBoundaryNumerics<2>(config, iMesh);
+  if (nDim == 3) return createBoundaryNumerics<3>(config, iMesh);
+
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, int nVar, int iSol,
+                                                   const CSolver& flowSolver, const su2double* constants) {
+  if (nDim == 2) return createScalarNumerics<2>(config, nVar, iSol, flowSolver, constants);
+  if (nDim == 3) return createScalarNumerics<3>(config, nVar, iSol, flowSolver, constants);
+
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarSourceNumerics(const CConfig& config, int nDim, int iSol,
+                                                         const CSolver& flowSolver, const CSolver* turbSolver) {
+  if (nDim == 2) return createScalarSourceNumerics<2>(config, iSol, flowSolver, turbSolver);
+  if (nDim == 3) return createScalarSourceNumerics<3>(config, iSol, flowSolver, turbSolver);
 
   return nullptr;
 }
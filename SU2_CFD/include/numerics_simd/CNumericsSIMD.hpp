@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 /*!
  * \enum UpdateType
@@ -49,6 +50,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CSolver;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -85,6 +87,49 @@ public:
                            CSysVector<su2double>& vector,
                            SparseMatrixType& matrix) const = 0;
 
+  /*!
+   * \brief Interface for the source terms of a block of points, implemented by point-based numerics.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal blocks).
+   */
+  virtual void ComputeSource(Int iPoint,
+                             const CConfig& config,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double updateMask,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) const {}
+
+  /*!
+   * \brief Interface for the convective flux of a block of boundary vertices, between the domain state of their
+   *        points and a ghost state (weak boundary conditions), implemented by the boundary numerics.
+   * \param[in] iVertex - The vertices of the marker.
+   * \param[in] iPoint - The points of the vertices.
+   * \param[in] iMarker - The marker.
+   * \param[in] ghostPrimitives - Ghost primitive variables of the vertices of the marker.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the fluxes.
+   * \param[in,out] matrix - Target for the flux Jacobians (diagonal blocks).
+   */
+  virtual void ComputeBoundaryFlux(Int iVertex,
+                                   Int iPoint,
+                                   unsigned short iMarker,
+                                   const su2activematrix& ghostPrimitives,
+                                   const CConfig& config,
+                                   const CGeometry& geometry,
+                                   const CVariable& solution,
+                                   Double updateMask,
+                                   CSysVector<su2double>& vector,
+                                   SparseMatrixType& matrix) const {}
+
   /*! \brief Destructor of the class. */
   virtual ~CNumericsSIMD(void) = default;
 
@@ -94,7 +139,43 @@ public:
    * \param[in] nDim - 2D or 3D.
    * \param[in] iMesh - Grid index.
    * \param[in] turbVars - Turbulence variables.
+   * \param[out] massFluxes - If not null, the convective mass flux of each edge is stored here (incompressible only).
+   */
+  static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr,
+                                       su2double* massFluxes = nullptr);
+
+  /*!
+   * \brief Factory method for the convective flux of the weak boundary conditions (ComputeBoundaryFlux).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \return nullptr if the boundary scheme (or gas model) is not supported.
+   */
+  static CNumericsSIMD* CreateBoundaryNumerics(const CConfig& config, int nDim, int iMesh);
+
+  /*!
+   * \brief Factory method for the convection-diffusion edge fluxes of scalar transport equations.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] nVar - Number of scalar variables.
+   * \param[in] iSol - Position of the scalar solver in the container (TURB_SOL, TRANS_SOL, SPECIES_SOL).
+   * \param[in] flowSolver - Flow solver, provides the primitives and (for bounded scalars) the mass fluxes.
+   * \param[in] constants - Model constants (SST only).
+   * \return nullptr if the model (or number of variables) is not supported.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, int nVar, int iSol,
+                                             const CSolver& flowSolver, const su2double* constants = nullptr);
+
+  /*!
+   * \brief Factory method for the point source terms of scalar transport equations.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iSol - Position of the scalar solver in the container (TRANS_SOL).
+   * \param[in] flowSolver - Flow solver, provides the primitives, gradients, vorticity, and strain rate.
+   * \param[in] turbSolver - Turbulence solver (for transition models).
+   * \return nullptr if the model is not supported.
    */
-  static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
+  static CNumericsSIMD* CreateScalarSourceNumerics(const CConfig& config, int nDim, int iSol,
+                                                   const CSolver& flowSolver, const CSolver* turbSolver = nullptr);
 
 };
@@ -0,0 +1,156 @@
+/*!
+ * \file linear_simplex.hpp
+ * \brief Vectorized element kernels of linear elasticity for linear simplices
+ *        (triangles and tetrahedra), one element per SIMD lane.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../util.hpp"
+
+/*--- The gradients of the shape functions of linear simplices are constant, the element
+ * integrals are exact with one integration point (as in CTRIA1 and CTETRA1) and need neither
+ * the CElement nor the numerics objects, this allows processing a batch of elements of the
+ * same type at once, one per SIMD lane. The isotropic material is defined by the Lame
+ * parameters (for plane stress lambda must be 2*lambda*mu/(lambda+2*mu)). ---*/
+
+namespace LinearSimplex {
+
+/*!
+ * \brief Gradients of the shape functions and volume (area in 2D) of linear simplices.
+ * \param[in] coord - Coordinates of the nDim+1 nodes.
+ * \param[out] grad - Gradients of the shape functions of the nodes.
+ * \return Volume of the elements.
+ */
+template<size_t nDim>
+FORCEINLINE Double gradients(const MatrixDbl<nDim+1,nDim>& coord, MatrixDbl<nDim+1,nDim>& grad) {
+
+  /*--- Jacobian of the mapping from the reference element, jac(iDim,jDim) = d x_jDim / d xi_iDim,
+   * the gradient of the shape function of node iDim+1 is column iDim of its inverse. ---*/
+  MatrixDbl<nDim> jac;
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      jac(iDim,jDim) = coord(iDim+1,jDim) - coord(0,jDim);
+
+  Double det;
+  if (nDim == 2) {
+    det = jac(0,0)*jac(1,1) - jac(0,1)*jac(1,0);
+    const Double invDet = 1 / det;
+    grad(1,0) =  jac(1,1)*invDet;  grad(1,1) = -jac(1,0)*invDet;
+    grad(2,0) = -jac(0,1)*invDet;  grad(2,1) =  jac(0,0)*invDet;
+  }
+  else {
+    const size_t k = nDim-1; // avoids out of bounds indices when nDim is 2.
+    const Double c00 = jac(1,1)*jac(k,k) - jac(1,k)*jac(k,1);
+    const Double c01 = jac(1,k)*jac(k,0) - jac(1,0)*jac(k,k);
+    const Double c02 = jac(1,0)*jac(k,1) - jac(1,1)*jac(k,0);
+    det = jac(0,0)*c00 + jac(0,1)*c01 + jac(0,k)*c02;
+    const Double invDet = 1 / det;
+
+    grad(1,0) = c00*invDet;
+    grad(1,1) = c01*invDet;
+    grad(1,k) = c02*invDet;
+    grad(2,0) = (jac(0,k)*jac(k,1) - jac(0,1)*jac(k,k))*invDet;
+    grad(2,1) = (jac(0,0)*jac(k,k) - jac(0,k)*jac(k,0))*invDet;
+    grad(2,k) = (jac(0,1)*jac(k,0) - jac(0,0)*jac(k,1))*invDet;
+    grad(k+1,0) = (jac(0,1)*jac(1,k) - jac(0,k)*jac(1,1))*invDet;
+    grad(k+1,1) = (jac(0,k)*jac(1,0) - jac(0,0)*jac(1,k))*invDet;
+    grad(k+1,k) = (jac(0,0)*jac(1,1) - jac(0,1)*jac(1,0))*invDet;
+  }
+
+  /*--- The shape functions sum to one. ---*/
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    grad(0,jDim) = 0.0;
+    for (size_t iNode = 1; iNode <= nDim; ++iNode) grad(0,jDim) -= grad(iNode,jDim);
+  }
+
+  return abs(det) / (nDim == 2 ? 2 : 6);
+}
+
+/*!
+ * \brief Product of the stiffness matrix of linear simplices with their nodal displacements.
+ * \param[in] grad - Gradients of the shape functions.
+ * \param[in] volume - Volume of the elements.
+ * \param[in] lambda - First Lame parameter.
+ * \param[in] mu - Second Lame parameter (shear modulus).
+ * \param[in] disp - Nodal displacements.
+ * \param[out] force - Nodal forces, i.e. K u.
+ */
+template<size_t nDim>
+FORCEINLINE void stiffnessProduct(const MatrixDbl<nDim+1,nDim>& grad, const Double& volume, const Double& lambda,
+                                  const Double& mu, const MatrixDbl<nDim+1,nDim>& disp,
+                                  MatrixDbl<nDim+1,nDim>& force) {
+
+  /*--- Displacement gradient and (integrated) Cauchy stress, sigma = lambda tr(eps) I + 2 mu eps. ---*/
+  MatrixDbl<nDim> dudx;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      dudx(iDim,jDim) = 0.0;
+      for (size_t iNode = 0; iNode <= nDim; ++iNode) dudx(iDim,jDim) += disp(iNode,iDim) * grad(iNode,jDim);
+    }
+  }
+  Double trace = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) trace += dudx(iDim,iDim);
+
+  MatrixDbl<nDim> stress;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      stress(iDim,jDim) = volume * mu * (dudx(iDim,jDim) + dudx(jDim,iDim));
+    stress(iDim,iDim) += volume * lambda * trace;
+  }
+
+  /*--- Nodal forces, B_a^T sigma. ---*/
+  for (size_t iNode = 0; iNode <= nDim; ++iNode) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      force(iNode,iDim) = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) force(iNode,iDim) += stress(iDim,jDim) * grad(iNode,jDim);
+    }
+  }
+}
+
+/*!
+ * \brief Block (iNode,jNode) of the stiffness matrix of linear simplices,
+ *        K_ab = V (lambda g_a g_b^T + mu g_b g_a^T + mu (g_a . g_b) I).
+ * \param[in] grad - Gradients of the shape functions.
+ * \param[in] volume - Volume of the elements.
+ * \param[in] lambda - First Lame parameter.
+ * \param[in] mu - Second Lame parameter (shear modulus).
+ * \param[in] iNode - Row node.
+ * \param[in] jNode - Column node.
+ * \param[out] block - Stiffness block.
+ */
+template<size_t nDim>
+FORCEINLINE void stiffnessBlock(const MatrixDbl<nDim+1,nDim>& grad, const Double& volume, const Double& lambda,
+                                const Double& mu, size_t iNode, size_t jNode, MatrixDbl<nDim>& block) {
+  const Double muDot = mu * dot<nDim>(grad[iNode], grad[jNode]);
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      block(iDim,jDim) = volume * (lambda * grad(iNode,iDim) * grad(jNode,jDim) +
+                                   mu * grad(iNode,jDim) * grad(jNode,iDim));
+    block(iDim,iDim) += volume * muDot;
+  }
+}
+
+}  // namespace LinearSimplex
@@ -0,0 +1,267 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM-family of convective schemes (AUSM+up, AUSM+up2, SLAU, SLAU2).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "upwind.hpp"
+
+/*!
+ * \brief Flux of the AUSM-family of schemes given the face mass flux and pressure.
+ * \note F = 0.5 * mdot * (psi_i+psi_j) - 0.5 * |mdot| * (psi_i-psi_j) + N * pf,
+ * with psi = (1, velocity, enthalpy).
+ */
+template<size_t nVar, size_t nDim, class PrimVarType>
+FORCEINLINE void ausmFlux(Double mdot, Double pressure, Double area,
+                          const VectorDbl<nDim>& unitNormal,
+                          const CPair<PrimVarType>& V,
+                          VectorDbl<nVar>& flux) {
+  const Double dissFlux = abs(mdot);
+
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = 0.5 * mdot * (V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                   0.5 * dissFlux * (V.i.velocity(iDim) - V.j.velocity(iDim)) + unitNormal(iDim) * pressure;
+  }
+  flux(nDim+1) = 0.5 * mdot * (V.i.enthalpy() + V.j.enthalpy()) +
+                 0.5 * dissFlux * (V.i.enthalpy() - V.j.enthalpy());
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    flux(iVar) *= area;
+  }
+}
+
+/*!
+ * \brief Mach and pressure splitting polynomials of the AUSM+up schemes,
+ * sign = 1 for the "+" functions of the left state, -1 for the "-" of the right state.
+ */
+FORCEINLINE void ausmSplitting(passivedouble sign, Double mach, Double alpha,
+                               Double& machSplit, Double& pressureSplit) {
+  constexpr passivedouble beta = 1.0 / 8.0;
+
+  const Double subsonic = abs(mach) <= 1.0;
+  const Double p1 = 0.25 * pow(mach + sign, 2);
+  const Double p2 = pow(mach * mach - 1.0, 2);
+
+  /*--- The supersonic pressure function (M +/- |M|) / 2M is written as a
+   * step function to avoid dividing by M. ---*/
+  machSplit = subsonic * sign * (p1 + beta * p2) + (1-subsonic) * 0.5 * (mach + sign * abs(mach));
+  pressureSplit = subsonic * (p1 * (2.0 - sign * mach) + sign * alpha * mach * p2) +
+                  (1-subsonic) * (sign * mach > 0.0);
+}
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up and AUSM+up2 schemes (ideal gas).
+ * \note The Jacobians are approximated (see CUpwindBase), grid velocities are not considered.
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CUpwindBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CUpwindBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::gamma;
+  const su2double Minf;
+  const bool up2;
+  const su2double Kp = 0.25;
+  const su2double Ku = 0.75;
+  const su2double sigma = 1.0;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, false, args...),
+    Minf(config.GetMach()),
+    up2(config.GetKind_Upwind_Flow() == UPWIND::AUSMPLUSUP2) {
+    if (Minf < EPS)
+      SU2_MPI::Error(string(up2? "AUSM+Up2" : "AUSM+Up") + " requires a reference Mach number (\"MACH_NUMBER\") greater than 0.",
+                     CURRENT_FUNCTION);
+    if (config.GetDynamic_Grid() && (SU2_MPI::GetRank() == MASTER_NODE))
+      cout << "WARNING: Grid velocities are NOT yet considered in AUSM-type schemes." << endl;
+  }
+
+  /*!
+   * \brief Computes the AUSM+up(2) flux.
+   * \note "Ts" is here just in case other schemes in the family need extra args.
+   */
+  template<class PrimVarType, class ConsVarType, class... Ts>
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                const CPair<PrimVarType>& V,
+                                const CPair<ConsVarType>&,
+                                Ts&...) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Compute interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1) * V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1) * V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / fmax(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / fmax(astarR, -projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5 * (mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+    const Double alpha = 3.0/16.0 * (-4 + 5*fa*fa);
+
+    Double mLP, betaLP, mRM, betaRM;
+    ausmSplitting(1, mL, alpha, mLP, betaLP);
+    ausmSplitting(-1, mR, alpha, mRM, betaRM);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5 * (V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa) * fmax(1 - sigma*MFsq, 0.0) * (V.j.pressure() - V.i.pressure()) / (rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    const Double mdot = aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+
+    /*--- Pressure flux with velocity diffusion term. ---*/
+
+    Double pressure;
+    if (!up2) {
+      const Double Pu = -Ku * fa * betaLP * betaRM * 2 * rhoF * aF * (projVel_j - projVel_i);
+      pressure = betaLP * V.i.pressure() + betaRM * V.j.pressure() + Pu;
+    }
+    else {
+      const Double sqVel = 0.5 * (squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5 * (V.j.pressure() + V.i.pressure()) + 0.5 * (betaLP - betaRM) * (V.i.pressure() - V.j.pressure()) +
+                 sqrt(sqVel) * (betaLP + betaRM - 1) * rhoF * aF;
+    }
+
+    ausmFlux(mdot, pressure, area, unitNormal, V, flux);
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU and SLAU2 schemes (ideal gas), with optional low dissipation (ROE_LOW_DISSIPATION).
+ * \note The Jacobians are approximated (see CUpwindBase), grid velocities are not considered.
+ */
+template<class Decorator>
+class CSLAUScheme : public CUpwindBase<CSLAUScheme<Decorator>,Decorator> {
+private:
+  using Base = CUpwindBase<CSLAUScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::gamma;
+  const bool slau2;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, false, args...),
+    slau2(config.GetKind_Upwind_Flow() == UPWIND::SLAU2),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+    if (config.GetDynamic_Grid() && (SU2_MPI::GetRank() == MASTER_NODE))
+      cout << "WARNING: Grid velocities are NOT yet considered in AUSM-type schemes." << endl;
+  }
+
+  /*!
+   * \brief Computes the SLAU(2) flux.
+   * \note "Ts" is here just in case other schemes in the family need extra args.
+   */
+  template<class PrimVarType, class ConsVarType, class... Ts>
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                const CPair<PrimVarType>& V,
+                                const CPair<ConsVarType>& U,
+                                const CRoeVariables<nDim>&,
+                                Double,
+                                Int iPoint,
+                                Int jPoint,
+                                const CEulerVariable& solution,
+                                Ts&...) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1) * (U.i.energy() - 0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1) * (U.j.energy() - 0.5*sqVel_j)));
+
+    /*--- Compute interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double machTilde = fmin(1.0, sqrt(0.5*(sqVel_i+sqVel_j)) / aF);
+    const Double chi = pow(1 - machTilde, 2);
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double vnMag = (V.i.density()*abs(projVel_i) + V.j.density()*abs(projVel_j)) / (V.i.density() + V.j.density());
+    const Double vnMagL = (1 - fRho)*vnMag + fRho*abs(projVel_i);
+    const Double vnMagR = (1 - fRho)*vnMag + fRho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    const Double mdot = 0.5 * (V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                               (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function, the supersonic values are step functions of the Mach number. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double subR = abs(mR) < 1.0;
+    const Double betaL = subL * 0.25*(2-mL)*pow(mL+1, 2) + (1-subL) * (mL >= 0.0);
+    const Double betaR = subR * 0.25*(2+mR)*pow(mR-1, 2) + (1-subR) * (mR < 0.0);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    Double pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!slau2) pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    else pressure += dissipation*sqrt(0.5*(sqVel_i+sqVel_j))*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+
+    ausmFlux(mdot, pressure, area, unitNormal, V, flux);
+  }
+};
@@ -139,8 +139,10 @@ public:
 
     MatrixDbl<nVar> jac_i, jac_j;
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
       jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+      AD::EndPassive(wasActive);
     }
 
     /*--- Grid motion. ---*/
@@ -257,10 +259,12 @@ public:
     }
 
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       const Double dissip_i = fixFactor * (eps2 + eps4*(ni+1)) * lambda;
       const Double dissip_j = -fixFactor * (eps2 + eps4*(nj+1)) * lambda;
       scalarDissipationJacobian(V.i, gamma, dissip_i, jac_i);
       scalarDissipationJacobian(V.j, gamma, dissip_j, jac_j);
+      AD::EndPassive(wasActive);
     }
   }
 };
@@ -336,9 +340,11 @@ public:
 
     MatrixDbl<nVar> scalarJac;
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       scalarJac = Double(0.0);
       Double factor = fixFactor * (eps2 + 0.5*eps4*(ni+nj+2));
       scalarDissipationJacobian(avgV, gamma, factor, scalarJac);
+      AD::EndPassive(wasActive);
     }
 
     /*--- Compute matrix dissipation terms. ---*/
@@ -457,8 +463,10 @@ public:
     }
 
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       scalarDissipationJacobian(V.i, gamma, fixFactor*dissip, jac_i);
       scalarDissipationJacobian(V.j, gamma, -fixFactor*dissip, jac_j);
+      AD::EndPassive(wasActive);
     }
   }
 };
@@ -524,8 +532,10 @@ public:
     }
 
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       scalarDissipationJacobian(V.i, gamma, fixFactor*dissip, jac_i);
       scalarDissipationJacobian(V.j, gamma, -fixFactor*dissip, jac_j);
+      AD::EndPassive(wasActive);
     }
   }
 };
@@ -31,6 +31,7 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "../../../variables/CNSVariable.hpp"
+#include "../../../variables/CIncNSVariable.hpp"
 
 /*!
  * \brief Unlimited reconstruction.
@@ -161,6 +162,68 @@ FORCEINLINE CPair<ReconVarType> reconstructPrimitives(Int iEdge, Int iPoint, Int
   return V;
 }
 
+/*!
+ * \brief Incompressible version of "reconstructPrimitives", the pressure is the
+ * dynamic pressure (can be negative), only temperature and density are checked,
+ * and only if the energy equation is solved.
+ * \param[in] iEdge, iPoint, jPoint - Edge and its nodes.
+ * \param[in] muscl - If true, reconstruct, else simply fetch.
+ * \param[in] checkPhysical - If true, revert to first order on non-physical states.
+ * \param[in] V1st - Pair of incompressible flow primitives for nodes i,j.
+ * \param[in] vector_ij - Distance vector from i to j.
+ * \param[in] solution - Entire solution container (a derived CVariable).
+ * \return Pair of primitive variables.
+ */
+template<class ReconVarType, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<ReconVarType> reconstructIncPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                         bool muscl, LIMITER limiterType,
+                                                         bool checkPhysical,
+                                                         const CPair<PrimVarType>& V1st,
+                                                         const VectorDbl<nDim>& vector_ij,
+                                                         const VariableType& solution) {
+  static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
+
+  const auto& gradients = solution.GetGradient_Reconstruction();
+  const auto& limiters = solution.GetLimiter_Primitive();
+
+  CPair<ReconVarType> V;
+
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = V1st.i.all(iVar);
+    V.j.all(iVar) = V1st.j.all(iVar);
+  }
+
+  if (muscl) {
+    switch (limiterType) {
+    case LIMITER::NONE:
+      musclUnlimited(iPoint, vector_ij, 0.5, gradients, V.i.all);
+      musclUnlimited(jPoint, vector_ij,-0.5, gradients, V.j.all);
+      break;
+    case LIMITER::VAN_ALBADA_EDGE:
+      musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, V);
+      break;
+    default:
+      musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V.i.all);
+      musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V.j.all);
+      break;
+    }
+    if (!checkPhysical) return V;
+
+    /*--- Detect a non-physical reconstruction based on negative temperature or density. ---*/
+    Double bad_recon = fmax(fmin(V.i.temperature(), V.j.temperature()) < 0.0,
+                            fmin(V.i.density(), V.j.density()) < 0.0);
+    /*--- Handle SIMD dimensions 1 by 1. ---*/
+    for (size_t k = 0; k < Double::Size; ++k) {
+      bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
+    }
+    for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+      V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * V.i.all(iVar);
+      V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * V.j.all(iVar);
+    }
+  }
+  return V;
+}
+
 /*!
  * \brief Compute and return the P tensor (compressible flow, ideal gas).
  */
@@ -0,0 +1,369 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting scheme for incompressible flow.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Projected inviscid flux (incompressible flow).
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(const PrimVarType& V,
+                                                  Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  const Double mdot = V.density() * dot<nDim>(V.velocity(), normal.data());
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot * V.velocity(iDim) + V.pressure() * normal(iDim);
+  }
+  flux(nDim+1) = mdot * enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the projected inviscid flux w.r.t. the primitives (incompressible flow).
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(const PrimVarType& V,
+                                                 Double cp,
+                                                 Double dRhodT,
+                                                 const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  constexpr size_t nVar = nDim+2;
+  const Double projVel = dot<nDim>(V.velocity(), normal.data());
+  const Double rho = V.density();
+  const Double h = cp * V.temperature();
+  const Double dRhodP = projVel / V.beta2();
+  const Double dRhodT_proj = dRhodT * projVel;
+
+  MatrixDbl<nVar> jac;
+  jac(0,0) = scale * dRhodP;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(0,jDim+1) = scale * rho * normal(jDim);
+  }
+  jac(0,nDim+1) = scale * dRhodT_proj;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + V.velocity(iDim) * dRhodP);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * rho * V.velocity(iDim) * normal(jDim);
+    }
+    jac(iDim+1,iDim+1) += scale * rho * projVel;
+    jac(iDim+1,nDim+1) = scale * V.velocity(iDim) * dRhodT_proj;
+  }
+
+  jac(nDim+1,0) = scale * h * dRhodP;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(nDim+1,jDim+1) = scale * h * rho * normal(jDim);
+  }
+  jac(nDim+1,nDim+1) = scale * cp * (V.temperature() * dRhodT + rho) * projVel;
+  return jac;
+}
+
+/*!
+ * \class CFDSIncScheme
+ * \ingroup ConvDiscr
+ * \brief Flux difference splitting with low-speed preconditioning for incompressible flow,
+ * the vectorized counterpart of CUpwFDSInc_Flow. The decorator (see CNoViscousFlux) must
+ * handle incompressible primitives, e.g. CIncompressibleViscousFlux.
+ * \note If a mass flux container is provided, the convective mass flux of each edge is
+ * stored in it (used by the upwind schemes of bounded scalars).
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool variableDensity;
+  const bool energy;
+  const LIMITER typeLimiter;
+  su2double* const massFluxes;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, su2double* massFluxes_, Ts&... args) :
+    Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    variableDensity(config.GetVariable_Density_Model()),
+    energy(config.GetEnergy_Equation()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    massFluxes(massFluxes_) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal, unitNormalEps;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+      /*--- The preconditioned Jacobian uses components of at least EPS. ---*/
+      const Double small = abs(unitNormal(iDim)) < EPS;
+      unitNormalEps(iDim) = small * EPS + (1-small) * unitNormal(iDim);
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructIncPrimitives<CIncompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, energy, V1st, vector_ij, solution);
+
+    /*--- The specific heat is not reconstructed. ---*/
+
+    const Double cp_i = V1st.i.cp(), cp_j = V1st.j.cp();
+    const Double enthalpy_i = cp_i * V.i.temperature();
+    const Double enthalpy_j = cp_j * V.j.temperature();
+
+    /*--- Mean variables. ---*/
+
+    VectorDbl<nDim> meanVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      meanVel(iDim) = 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim));
+    }
+    const Double meanDensity = 0.5 * (V.i.density() + V.j.density());
+    const Double meanBeta2 = 0.5 * (V.i.beta2() + V.j.beta2());
+    const Double meanCp = 0.5 * (cp_i + cp_j);
+    const Double meanTemperature = 0.5 * (V.i.temperature() + V.j.temperature());
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double projVel = dot(meanVel, normal) - projGridVel;
+
+    /*--- Artificial sound speed based on eigs of preconditioned system. ---*/
+
+    const Double sqrtBeta2 = sqrt(meanBeta2);
+    const Double speedSound = sqrtBeta2 * area;
+
+    /*--- Derivative of the equation of state (ideal gas law only). ---*/
+
+    Double meanDRhoDT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      meanDRhoDT = -meanDensity / meanTemperature;
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Absolute value of the eigenvalues of the preconditioned system. ---*/
+
+    const Double lambda = abs(projVel);
+    const Double lambdaM = abs(projVel - speedSound);
+    const Double lambdaP = abs(projVel + speedSound);
+
+    /*--- Preconditioning matrix using mean values. ---*/
+
+    MatrixDbl<nVar> precon;
+    const Double meanH = meanCp * meanTemperature;
+    precon(0,0) = 1 / meanBeta2;
+    precon(nDim+1,0) = meanH / meanBeta2;
+    precon(0,nDim+1) = meanDRhoDT;
+    precon(nDim+1,nDim+1) = meanCp * (meanDRhoDT * meanTemperature + meanDensity);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,0) = meanVel(iDim) / meanBeta2;
+      precon(iDim+1,nDim+1) = meanVel(iDim) * meanDRhoDT;
+      precon(0,iDim+1) = 0.0;
+      precon(nDim+1,iDim+1) = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        precon(iDim+1,jDim+1) = 0.0;
+      }
+      precon(iDim+1,iDim+1) = meanDensity;
+    }
+
+    /*--- Absolute value of the preconditioned Jacobian, |A_precon| = P x |Lambda| x inv(P),
+     *    where P diagonalizes the matrix inv(Precon) x dF/dV. ---*/
+
+    MatrixDbl<nVar> absJac;
+    const Double sumLambda = 0.5 * (lambdaM + lambdaP);
+    const Double diffLambda = 0.5 * (lambdaP - lambdaM);
+    absJac(0,0) = sumLambda;
+    absJac(nDim+1,0) = 0.0;
+    absJac(0,nDim+1) = 0.0;
+    absJac(nDim+1,nDim+1) = lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double n_i = unitNormalEps(iDim);
+      absJac(iDim+1,0) = n_i * diffLambda / (sqrtBeta2 * meanDensity);
+      absJac(0,iDim+1) = sqrtBeta2 * n_i * meanDensity * diffLambda;
+      absJac(iDim+1,nDim+1) = 0.0;
+      absJac(nDim+1,iDim+1) = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        absJac(iDim+1,jDim+1) = n_i * unitNormalEps(jDim) * (sumLambda - lambda);
+      }
+      absJac(iDim+1,iDim+1) = sumLambda * pow(n_i,2);
+      for (size_t kDim = 0; kDim < nDim; ++kDim) {
+        if (kDim != iDim) absJac(iDim+1,iDim+1) += 2 * lambda * pow(unitNormalEps(kDim),2);
+      }
+    }
+
+    /*--- Difference of primitive variables at jPoint and iPoint. ---*/
+
+    VectorDbl<nVar> deltaV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      deltaV(iVar) = V.j.all(iVar) - V.i.all(iVar);
+    }
+
+    /*--- Inviscid fluxes and Jacobians (w.r.t. the primitives). ---*/
+
+    auto flux_i = inviscidIncProjFlux(V.i, enthalpy_i, normal);
+    auto flux_j = inviscidIncProjFlux(V.j, enthalpy_j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      jac_i = inviscidIncProjJac(V.i, cp_i, dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j, cp_j, dRhodT_j, normal, 0.5);
+      AD::EndPassive(wasActive);
+    }
+
+    /*--- Dissipation, Precon x |A_precon| x dV. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dDdV = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dDdV += precon(iVar,kVar) * absJac(kVar,jVar);
+        }
+        dDdV *= 0.5;
+
+        flux(iVar) -= dDdV * deltaV(jVar);
+
+        if (implicit) {
+          jac_i(iVar,jVar) += dDdV;
+          jac_j(iVar,jVar) -= dDdV;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      const Double halfVel = 0.5 * projGridVel;
+      flux(0) -= halfVel * (V.i.density() + V.j.density());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        flux(iDim+1) -= halfVel * (V.i.density()*V.i.velocity(iDim) + V.j.density()*V.j.velocity(iDim));
+      }
+      flux(nDim+1) -= halfVel * (V.i.density()*enthalpy_i + V.j.density()*enthalpy_j);
+
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= halfVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= halfVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= halfVel * V.i.density() * cp_i;
+        jac_j(nDim+1,nDim+1) -= halfVel * V.j.density() * cp_j;
+      }
+    }
+
+    /*--- Without energy equation the temperature is decoupled. ---*/
+
+    if (!energy) {
+      flux(nDim+1) = 0.0;
+      if (implicit) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_i(iVar,nDim+1) = 0.0;  jac_i(nDim+1,iVar) = 0.0;
+          jac_j(iVar,nDim+1) = 0.0;  jac_j(nDim+1,iVar) = 0.0;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Store the mass flux (there is no viscous contribution to it). ---*/
+
+    if (massFluxes) {
+      for (size_t k = 0; k < Double::Size; ++k) {
+        if (updateMask[k] != 0) massFluxes[iEdge[k]] = flux(0)[k];
+      }
+    }
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,133 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "upwind.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (ideal gas), the wave structure is resolved by blending instead of
+ * branching, that is, only the state (i or j) on the upwind side of the contact surface is
+ * used to compute the star-state flux.
+ * \note The Jacobians are approximated (see CUpwindBase).
+ */
+template<class Decorator>
+class CHLLCScheme : public CUpwindBase<CHLLCScheme<Decorator>,Decorator> {
+private:
+  using Base = CUpwindBase<CHLLCScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::gamma;
+
+public:
+  /*!
+   * \brief Constructor, forward to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, Ts&... args) : Base(config, true, args...) {
+  }
+
+  /*!
+   * \brief Computes the HLLC flux.
+   * \note "Ts" is here just in case other schemes in the family need extra args.
+   */
+  template<class PrimVarType, class ConsVarType, class... Ts>
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                const CPair<PrimVarType>& V,
+                                const CPair<ConsVarType>& U,
+                                const CRoeVariables<nDim>& roeAvg,
+                                Double projGridVel,
+                                Ts&...) const {
+
+    /*--- Projected velocities and speeds of sound, relative to the grid. ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal) - projGridVel;
+    const Double projVel_j = dot(V.j.velocity(), unitNormal) - projGridVel;
+
+    const Double soundSpeed_i = sqrt((gamma-1) * (V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity()))) - projGridVel;
+    const Double soundSpeed_j = sqrt((gamma-1) * (V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity()))) + projGridVel;
+
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSoundSpeed = roeAvg.speedSound - projGridVel;
+
+    /*--- Speeds of the left and right waves, and of the contact surface. ---*/
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    const Double rhoDen = V.j.density() * (sR - projVel_j) - V.i.density() * (sL - projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density() * projVel_i * (sL - projVel_i) +
+                       V.j.density() * projVel_j * (sR - projVel_j)) / rhoDen;
+
+    /*--- Pressure at the contact surface. ---*/
+
+    const Double pStar = V.j.density() * (projVel_j - sR) * (projVel_j - sM) + V.j.pressure();
+
+    /*--- Select the upwind state "K" w.r.t. the contact surface, and whether
+     * the flux is that of the state (supersonic) or that of its star state. ---*/
+
+    const Double left = sM > 0.0;
+    const Double supersonic = left * (sL > 0.0) + (1-left) * (sR < 0.0);
+
+    const Double sK = left * sL + (1-left) * sR;
+    const Double projVel = left * projVel_i + (1-left) * projVel_j;
+    const Double pressure = left * V.i.pressure() + (1-left) * V.j.pressure();
+    VectorDbl<nVar> conserv;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      conserv(iVar) = left * U.i.all(iVar) + (1-left) * U.j.all(iVar);
+    }
+
+    /*--- Star state. ---*/
+
+    const Double omega = 1 / (sK - sM);
+    const Double rhoStar = (sK - projVel) * omega;
+
+    VectorDbl<nVar> conservStar;
+    conservStar(0) = rhoStar * conserv(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      conservStar(iDim+1) = rhoStar * conserv(iDim+1) + (pStar - pressure) * unitNormal(iDim) * omega;
+    }
+    conservStar(nDim+1) = rhoStar * conserv(nDim+1) - (pressure * projVel - pStar * sM) * omega;
+
+    /*--- Blend the fluxes of the state and of the star state. ---*/
+
+    flux(0) = supersonic * conserv(0) * projVel + (1-supersonic) * sM * conservStar(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = supersonic * (conserv(iDim+1) * projVel + pressure * unitNormal(iDim)) +
+                     (1-supersonic) * (sM * conservStar(iDim+1) + pStar * unitNormal(iDim));
+    }
+    flux(nDim+1) = supersonic * (conserv(nDim+1) + pressure) * projVel +
+                   (1-supersonic) * (sM * (conservStar(nDim+1) + pStar) + pStar * projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+  }
+};
@@ -76,48 +76,22 @@ protected:
     typeLimiter(config.GetKind_SlopeLimit_Flow()) {
   }
 
-public:
   /*!
-   * \brief Implementation of the base Roe flux.
+   * \brief Roe flux and Jacobians between two states, common to the edges and to the boundary vertices.
    */
-  void ComputeFlux(Int iEdge,
-                   const CConfig& config,
-                   const CGeometry& geometry,
-                   const CVariable& solution_,
-                   UpdateType updateType,
-                   Double updateMask,
-                   CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
-
-    /*--- Start preaccumulation, inputs are registered
-     *    automatically in "gatherVariables". ---*/
-    AD::StartPreacc();
-
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
-    const auto& solution = static_cast<const CEulerVariable&>(solution_);
-
-    const auto iPoint = geometry.edges->GetNode(iEdge,0);
-    const auto jPoint = geometry.edges->GetNode(iEdge,1);
-
-    /*--- Geometric properties. ---*/
-
-    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
-
-    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
-    const auto area = norm(normal);
-    VectorDbl<nDim> unitNormal;
-    for (size_t iDim = 0; iDim < nDim; ++iDim) {
-      unitNormal(iDim) = normal(iDim) / area;
-    }
-
-    /*--- Reconstructed primitives. ---*/
-
-    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
-    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
-    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
-
-    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
-                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+  template<class PrimVarType>
+  FORCEINLINE void roeFlux(Int iPoint,
+                           Int jPoint,
+                           const CGeometry& geometry,
+                           const CEulerVariable& solution,
+                           bool implicit,
+                           Double area,
+                           const VectorDbl<nDim>& normal,
+                           const VectorDbl<nDim>& unitNormal,
+                           const CPair<PrimVarType>& V,
+                           VectorDbl<nVar>& flux,
+                           MatrixDbl<nVar>& jac_i,
+                           MatrixDbl<nVar>& jac_j) const {
 
     /*--- Compute conservative variables. ---*/
 
@@ -166,15 +140,15 @@ public:
     auto flux_i = inviscidProjFlux(V.i, U.i, normal);
     auto flux_j = inviscidProjFlux(V.j, U.j, normal);
 
-    VectorDbl<nVar> flux;
     for (size_t iVar = 0; iVar < nVar; ++iVar) {
       flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
     }
 
-    MatrixDbl<nVar> jac_i, jac_j;
     if (implicit) {
+      const bool wasActive = AD::BeginPassive();
       jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, kappa);
       jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, kappa);
+      AD::EndPassive(wasActive);
     }
 
     /*--- Correct for grid motion. ---*/
@@ -196,7 +170,57 @@ public:
     const auto derived = static_cast<const Derived*>(this);
 
     derived->finalizeFlux(flux, jac_i, jac_j, implicit, area, unitNormal, V,
-                          U, roeAvg, lambda, pMat, iPoint, jPoint, solution);
+                          U, roeAvg, lambda, pMat, iPoint, jPoint, solution, projVel);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base Roe flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Roe flux. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    roeFlux(iPoint, jPoint, geometry, solution, implicit, area, normal, unitNormal, V, flux, jac_i, jac_j);
 
     /*--- Add the contributions from the base class (static decorator). ---*/
 
@@ -212,6 +236,75 @@ public:
     updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
                        updateMask, flux, jac_i, jac_j, vector, matrix);
   }
+
+  /*!
+   * \brief Roe flux between the domain state of boundary points and the ghost state of their vertices.
+   * \note There is no reconstruction (as for the non-vectorized boundary numerics), the viscous
+   * terms of the boundaries are not included.
+   */
+  void ComputeBoundaryFlux(Int iVertex,
+                           Int iPoint,
+                           unsigned short iMarker,
+                           const su2activematrix& ghostPrimitives,
+                           const CConfig& config,
+                           const CGeometry& geometry,
+                           const CVariable& solution_,
+                           Double updateMask,
+                           CSysVector<su2double>& vector,
+                           SparseMatrixType& matrix) const final {
+
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    /*--- Outward normals (the vertex normals point into the domain). ---*/
+
+    VectorDbl<nDim> normal;
+    for (size_t k = 0; k < Double::Size; ++k) {
+      const su2double* vertexNormal = geometry.vertex[iMarker][iVertex[k]]->GetNormal();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        AD::SetPreaccIn(vertexNormal[iDim]);
+        normal(iDim)[k] = -vertexNormal[iDim];
+      }
+    }
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Domain and ghost primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVarGrad> > V;
+    V.i.all = gatherVariables<nPrimVarGrad>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVarGrad>(iVertex, ghostPrimitives);
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    roeFlux(iPoint, iPoint, geometry, solution, implicit, area, normal, unitNormal, V, flux, jac_i, jac_j);
+
+    stopPreacc(flux);
+
+    /*--- Update the points of the block one by one (the diagonal blocks are not contiguous). ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (updateMask[k] == 0) continue;
+
+      su2double residual[nVar];
+      for (size_t iVar = 0; iVar < nVar; ++iVar) residual[iVar] = flux(iVar)[k];
+      vector.AddBlock(iPoint[k], residual);
+
+      if (implicit) {
+        const bool wasActive = AD::BeginPassive();
+        su2double block[nVar][nVar];
+        for (size_t iVar = 0; iVar < nVar; ++iVar)
+          for (size_t jVar = 0; jVar < nVar; ++jVar) block[iVar][jVar] = jac_i(iVar,jVar)[k];
+        matrix.AddBlock2Diag(iPoint[k], block);
+        AD::EndPassive(wasActive);
+      }
+    }
+  }
 };
 
 /*!
@@ -297,3 +390,177 @@ public:
     }
   }
 };
+
+/*!
+ * \class CRoeTurkelScheme
+ * \ingroup ConvDiscr
+ * \brief Roe scheme with Weiss-Smith / Turkel low-Mach preconditioning of the dissipation.
+ * \note Vectorized counterpart of CUpwTurkel_Flow, the dissipation is P^-1 |P A| written in terms of
+ * the entropic variables (p, u, s), i.e. invRinvPe x |PeJac| x R. The preconditioned eigenvalues use
+ * the unit normal and the dissipation is scaled by the area, as for the other Roe schemes.
+ */
+template<class Decorator>
+class CRoeTurkelScheme : public CRoeBase<CRoeTurkelScheme<Decorator>,Decorator> {
+private:
+  using Base = CRoeBase<CRoeTurkelScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::gamma;
+  using Base::kappa;
+  using Base::entropyFix;
+  const su2double betaMin;
+  const su2double betaMax;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CRoeTurkelScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    betaMin(config.GetminTurkelBeta()),
+    betaMax(config.GetmaxTurkelBeta()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with the preconditioned Roe dissipation.
+   * \note The eigenvalues and P tensor of the base class do not apply, the projected velocity
+   * (relative to the grid) is used to compute the preconditioned eigenvalues.
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                const CPair<PrimVarType>&,
+                                const CPair<ConsVarType>& U,
+                                const CRoeVariables<nDim>& roeAvg,
+                                const VectorDbl<nVar>&,
+                                const MatrixDbl<nVar>&,
+                                Int,
+                                Int,
+                                const CEulerVariable&,
+                                Double projVel) const {
+    const Double gm1 = gamma - 1;
+    const Double rho = roeAvg.density;
+    const Double c = roeAvg.speedSound;
+    const Double sqVel = squaredNorm(roeAvg.velocity);
+
+    /*--- Preconditioning parameter (local Mach number bounded by the config limits). ---*/
+
+    const Double beta = fmax(betaMin, fmin(sqrt(sqVel) / c, betaMax));
+    const Double beta2 = pow(beta, 2);
+
+    /*--- Preconditioned eigenvalues. ---*/
+
+    const Double radical = sqrt(pow((1-beta2)*projVel, 2) + pow(2*beta*c, 2));
+    const Double lambdaP = 0.5 * ((1+beta2)*projVel + radical);
+    const Double lambdaM = 0.5 * ((1+beta2)*projVel - radical);
+
+    const Double r = lambdaP - projVel*beta2;
+    const Double s = lambdaM - projVel*beta2;
+    const Double t = 0.5 * (lambdaM - lambdaP);
+    const Double rhoB2a2 = rho * beta2 * pow(c, 2);
+
+    /*--- Absolute values with Mavriplis' entropy correction. ---*/
+
+    const Double maxLambda = fmax(abs(lambdaP), abs(lambdaM));
+    const Double absU = fmax(abs(projVel), entropyFix*maxLambda);
+    const Double absP = fmax(abs(lambdaP), entropyFix*maxLambda);
+    const Double absM = fmax(abs(lambdaM), entropyFix*maxLambda);
+
+    /*--- |PeJac|, absolute value of the preconditioned Jacobian in entropic variables. ---*/
+
+    MatrixDbl<nVar> absPeJac;
+    const Double inv2t = 0.5 / t;
+    absPeJac(0,0) = (absP*s - absM*r) * inv2t;
+    absPeJac(0,nVar-1) = 0.0;
+    absPeJac(nVar-1,0) = 0.0;
+    absPeJac(nVar-1,nVar-1) = absU;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      absPeJac(0,iDim+1) = (absM - absP) * rhoB2a2 * unitNormal(iDim) * inv2t;
+      absPeJac(iDim+1,0) = (absP - absM) * r * s * unitNormal(iDim) * inv2t / rhoB2a2;
+      absPeJac(iDim+1,nVar-1) = 0.0;
+      absPeJac(nVar-1,iDim+1) = 0.0;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        const Double nn = unitNormal(iDim) * unitNormal(jDim);
+        absPeJac(iDim+1,jDim+1) = absU * ((iDim == jDim) - nn) + (absM*s - absP*r) * nn * inv2t;
+      }
+    }
+
+    /*--- invRinvPe, from entropic to conservative variables including the inverse preconditioner. ---*/
+
+    MatrixDbl<nVar> invRinvPe;
+    const Double factor = 1 / (beta2 * pow(c, 2));
+    invRinvPe(0,0) = factor;
+    invRinvPe(0,nVar-1) = -rho / gamma;
+    invRinvPe(nVar-1,0) = roeAvg.enthalpy * factor;
+    invRinvPe(nVar-1,nVar-1) = -0.5 * rho * sqVel / gamma;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      invRinvPe(0,iDim+1) = 0.0;
+      invRinvPe(iDim+1,0) = roeAvg.velocity(iDim) * factor;
+      invRinvPe(iDim+1,nVar-1) = -rho * roeAvg.velocity(iDim) / gamma;
+      invRinvPe(nVar-1,iDim+1) = rho * roeAvg.velocity(iDim);
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        invRinvPe(iDim+1,jDim+1) = (iDim == jDim) * rho;
+      }
+    }
+
+    /*--- R, from conservative to entropic variables (with the Roe pressure). ---*/
+
+    MatrixDbl<nVar> rMat;
+    const Double invPressure = gamma / (rho * pow(c, 2));
+    rMat(0,0) = 0.5 * gm1 * sqVel;
+    rMat(0,nVar-1) = gm1;
+    rMat(nVar-1,0) = 0.5 * gm1 * sqVel * invPressure - gamma / rho;
+    rMat(nVar-1,nVar-1) = gm1 * invPressure;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      rMat(0,iDim+1) = -gm1 * roeAvg.velocity(iDim);
+      rMat(iDim+1,0) = -roeAvg.velocity(iDim) / rho;
+      rMat(iDim+1,nVar-1) = 0.0;
+      rMat(nVar-1,iDim+1) = -gm1 * roeAvg.velocity(iDim) * invPressure;
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        rMat(iDim+1,jDim+1) = (iDim == jDim) / rho;
+      }
+    }
+
+    /*--- Diference between conservative variables at jPoint and iPoint. ---*/
+
+    VectorDbl<nVar> deltaU;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      deltaU(iVar) = U.j.all(iVar) - U.i.all(iVar);
+    }
+
+    /*--- Dissipation terms. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      VectorDbl<nVar> prod;
+      for (size_t kVar = 0; kVar < nVar; ++kVar) {
+        prod(kVar) = 0.0;
+        for (size_t lVar = 0; lVar < nVar; ++lVar) {
+          prod(kVar) += invRinvPe(iVar,lVar) * absPeJac(lVar,kVar);
+        }
+      }
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        /*--- Compute |projModJacTensor| = invRinvPe x |PeJac| x R. ---*/
+
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += prod(kVar) * rMat(kVar,jVar);
+        }
+
+        Double dDdU = projModJacTensor * (1-kappa) * area;
+
+        /*--- Update flux and Jacobians. ---*/
+
+        flux(iVar) -= dDdU * deltaU(jVar);
+
+        if(implicit) {
+          jac_i(iVar,jVar) += dDdU;
+          jac_j(iVar,jVar) -= dDdU;
+        }
+      }
+    }
+  }
+};
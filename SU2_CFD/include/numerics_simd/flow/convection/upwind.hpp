@@ -0,0 +1,210 @@
+/*!
+ * \file upwind.hpp
+ * \brief Base class of upwind schemes with approximate (Roe) Jacobians.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CUpwindBase
+ * \ingroup ConvDiscr
+ * \brief Base class for upwind schemes whose flux is not based on a linearization of the
+ * Riemann problem (e.g. HLLC, AUSM), derived classes implement the flux in a const
+ * "finalizeFlux" method. The Jacobians are those of the Roe scheme, i.e. the Roe dissipation
+ * matrix is used as the approximation of the upwind part of the flux derivatives.
+ * \note See CRoeBase for the role of Base.
+ */
+template<class Derived, class Base>
+class CUpwindBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const su2double entropyFix;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \param[in] gridMotion - Whether the derived scheme accounts for grid velocities.
+   */
+  template<class... Ts>
+  CUpwindBase(const CConfig& config, bool gridMotion, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    entropyFix(config.GetEntropyFix_Coeff()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(gridMotion && config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base upwind flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Roe averaged variables. ---*/
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Flux of the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    VectorDbl<nVar> flux;
+    derived->finalizeFlux(flux, area, unitNormal, V, U, roeAvg, projGridVel, iPoint, jPoint, solution);
+
+    /*--- Approximate Jacobians, central part plus Roe dissipation. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+      jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+      auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                          roeAvg.projVel, roeAvg.speedSound, unitNormal);
+      auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                                roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+      /*--- Convective eigenvalues with Mavriplis' entropy correction. ---*/
+
+      const Double projVel = roeAvg.projVel - projGridVel;
+      const Double maxLambda = abs(projVel) + roeAvg.speedSound;
+
+      VectorDbl<nVar> lambda;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        lambda(iDim) = projVel;
+      }
+      lambda(nDim) = projVel + roeAvg.speedSound;
+      lambda(nDim+1) = projVel - roeAvg.speedSound;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        lambda(iVar) = fmax(abs(lambda(iVar)), entropyFix*maxLambda);
+      }
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          /*--- Compute |projModJacTensor| = P x |Lambda| x P^-1. ---*/
+
+          Double projModJacTensor = 0.0;
+          for (size_t kVar = 0; kVar < nVar; ++kVar) {
+            projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+          }
+          jac_i(iVar,jVar) += 0.5 * area * projModJacTensor;
+          jac_j(iVar,jVar) -= 0.5 * area * projModJacTensor;
+        }
+      }
+
+      /*--- Correct for grid motion. ---*/
+
+      if (dynamicGrid) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_i(iVar,iVar) -= 0.5 * projGridVel * area;
+          jac_j(iVar,iVar) -= 0.5 * projGridVel * area;
+        }
+      }
+      AD::EndPassive(wasActive);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,512 @@
+/*!
+ * \file scalar_fluxes.hpp
+ * \brief Upwind convection and average-gradient diffusion of scalar transport equations.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CPrimitiveIndices.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief MUSCL reconstruction of a single column of a 2D container (e.g. flow primitives).
+ */
+template<size_t nDim, class Gradient_t, class Limiter_t>
+FORCEINLINE void musclColumn(Int iPoint, Int jPoint, size_t iVar,
+                             const VectorDbl<nDim>& vector_ij,
+                             bool limited,
+                             const Gradient_t& gradient,
+                             const Limiter_t& limiter,
+                             CPair<Double>& var) {
+  Double proj_i = 0.5 * dot(gatherVariables<nDim>(iPoint, iVar, gradient), vector_ij);
+  Double proj_j =-0.5 * dot(gatherVariables<nDim>(jPoint, iVar, gradient), vector_ij);
+  if (limited) {
+    proj_i *= gatherVariables(iPoint, iVar, limiter);
+    proj_j *= gatherVariables(jPoint, iVar, limiter);
+  }
+  var.i += proj_i;
+  var.j += proj_j;
+}
+
+/*!
+ * \brief MUSCL reconstruction of scalar variables with point-based limiter (optional).
+ * \note Flat access to the gradients as "nVar = 1" containers are vectors.
+ */
+template<size_t nVar, size_t nDim, class Gradient_t, class Limiter_t>
+FORCEINLINE void musclScalars(Int iPoint,
+                              const VectorDbl<nDim>& vector_ij,
+                              Double scale,
+                              bool limited,
+                              const Limiter_t& limiter,
+                              const Gradient_t& gradient,
+                              VectorDbl<nVar>& vars) {
+  const auto grad = gatherVariables<nVar,nDim>(iPoint, gradient);
+  VectorDbl<nVar> lim;
+  if (limited) lim = gatherVariables<nVar>(iPoint, limiter);
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    const Double proj = scale * dot<nDim>(&grad.data()[iVar*nDim], vector_ij.data());
+    vars(iVar) += limited? Double(lim(iVar) * proj) : proj;
+  }
+}
+
+/*!
+ * \class CScalarFluxBase
+ * \ingroup ConvDiscr
+ * \brief Base class for the edge fluxes of scalar transport equations (turbulence,
+ * transition, species), it combines the scalar upwind convection (CUpwScalar) with the
+ * average-gradient diffusion (CAvgGrad_Scalar), i.e. it replaces the pair of CNumerics
+ * used in CScalarSolver::Upwind_Residual and Viscous_Residual for the edges of the domain.
+ * Derived classes implement the model-specific diffusion coefficients in a const
+ * "viscousTerms" method, which subtracts its contribution from the flux and Jacobians.
+ * \note The flow solution is accessed via references passed at construction, the
+ * scalar solution is the CVariable passed to ComputeFlux.
+ */
+template<class Derived, size_t nVar_, size_t nDim_>
+class CScalarFluxBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nVar_;
+
+  const CVariable& flowNodes;
+  const su2activevector* edgeMassFluxes;
+  const unsigned short idxVel, idxRho, idxMu, idxMut;
+  const bool conservative;
+  const bool dynamicGrid;
+  const bool musclFlow;
+  const bool limiterFlow;
+
+  /*!
+   * \brief Constructor, store some constants.
+   * \param[in] config - Problem definitions.
+   * \param[in] conservative_ - If the transported variable is multiplied by density.
+   * \param[in] flowNodes_ - Flow solution.
+   * \param[in] massFluxes - Edge mass fluxes of the flow solver, only for bounded scalars (else nullptr).
+   * \param[in] idx - Indices of the flow primitives.
+   */
+  CScalarFluxBase(const CConfig& config, bool conservative_, const CVariable& flowNodes_,
+                  const su2activevector* massFluxes, const CPrimitiveIndices<unsigned short>& idx) :
+    flowNodes(flowNodes_),
+    edgeMassFluxes(massFluxes),
+    idxVel(idx.Velocity()),
+    idxRho(idx.Density()),
+    idxMu(idx.LaminarViscosity()),
+    idxMut(idx.EddyViscosity()),
+    conservative(conservative_),
+    dynamicGrid(config.GetDynamic_Grid()),
+    /*--- For bounded scalars the flow is only used via the mass flux, see CScalarSolver::Upwind_Residual. ---*/
+    musclFlow(config.GetMUSCL_Flow() && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+              (massFluxes == nullptr)),
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE)) {
+  }
+
+  /*!
+   * \brief Diagonal entry of a Jacobian (flat access as "nVar = 1" matrices are vectors).
+   */
+  FORCEINLINE static Double& diag(MatrixDbl<nVar>& jac, size_t iVar) { return jac.data()[iVar*(nVar+1)]; }
+
+  /*!
+   * \brief Gather a flow primitive for the points of the edge.
+   */
+  FORCEINLINE CPair<Double> flowPair(Int iPoint, Int jPoint, size_t iVar) const {
+    CPair<Double> var;
+    var.i = gatherVariables(iPoint, iVar, flowNodes.GetPrimitive());
+    var.j = gatherVariables(jPoint, iVar, flowNodes.GetPrimitive());
+    return var;
+  }
+
+  /*!
+   * \brief Diffusion with diagonal coefficients, and Jacobians w.r.t. the conservative
+   * variables via the thin shear layer approximation (CAvgGrad_TurbSST, CAvgGrad_Species).
+   */
+  FORCEINLINE static void diagonalDiffusion(const VectorDbl<nVar>& diff,
+                                            const CPair<Double>& density,
+                                            const VectorDbl<nVar>& projGrad,
+                                            Double proj_vector_ij,
+                                            bool implicit,
+                                            VectorDbl<nVar>& flux,
+                                            MatrixDbl<nVar>& jac_i,
+                                            MatrixDbl<nVar>& jac_j) {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      const Double proj_on_rho_i = proj_vector_ij / density.i;
+      const Double proj_on_rho_j = proj_vector_ij / density.j;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diag(jac_i, iVar) += diff(iVar) * proj_on_rho_i;
+        diag(jac_j, iVar) -= diff(iVar) * proj_on_rho_j;
+      }
+      AD::EndPassive(wasActive);
+    }
+  }
+
+public:
+  /*!
+   * \brief Implementation of the scalar edge flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    /*--- The MUSCL settings of scalar solvers are set in config before each
+     *    solver is called (global parameters), thus they are not constants. ---*/
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limited = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Density and scalars without reconstruction. ---*/
+
+    const auto density = flowPair(iPoint, jPoint, idxRho);
+
+    CPair<VectorDbl<nVar> > scalar1st;
+    scalar1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    scalar1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Upwind splitting of the face-normal velocity (or of the mass flux). ---*/
+
+    CPair<Double> rho = density, a;
+
+    if (edgeMassFluxes) {
+      const Double mdot = gatherVariables(iEdge, *edgeMassFluxes);
+      a.i = fmax(0.0, mdot) / density.i;
+      a.j = fmin(0.0, mdot) / density.j;
+    }
+    else {
+      const auto& primitives = flowNodes.GetPrimitive();
+      CPair<VectorDbl<nDim> > velocity;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        velocity.i(iDim) = gatherVariables(iPoint, idxVel+iDim, primitives);
+        velocity.j(iDim) = gatherVariables(jPoint, idxVel+iDim, primitives);
+      }
+      if (musclFlow && muscl) {
+        const auto& gradients = flowNodes.GetGradient_Reconstruction();
+        const auto& limiters = flowNodes.GetLimiter_Primitive();
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          CPair<Double> vel = {velocity.i(iDim), velocity.j(iDim)};
+          musclColumn(iPoint, jPoint, idxVel+iDim, vector_ij, limiterFlow, gradients, limiters, vel);
+          velocity.i(iDim) = vel.i;
+          velocity.j(iDim) = vel.j;
+        }
+        if (conservative) musclColumn(iPoint, jPoint, idxRho, vector_ij, limiterFlow, gradients, limiters, rho);
+      }
+      Double q_ij = 0.5 * (dot(velocity.i, normal) + dot(velocity.j, normal));
+      if (dynamicGrid) {
+        const auto& gridVel = geometry.nodes->GetGridVel();
+        q_ij -= 0.5 * (dot(gatherVariables<nDim>(iPoint, gridVel), normal) +
+                       dot(gatherVariables<nDim>(jPoint, gridVel), normal));
+      }
+      a.i = fmax(0.0, q_ij);
+      a.j = fmin(0.0, q_ij);
+    }
+
+    /*--- Reconstructed scalars. ---*/
+
+    auto scalar = scalar1st;
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      musclScalars(iPoint, vector_ij, 0.5, limited, solution.GetLimiter(), gradients, scalar.i);
+      musclScalars(jPoint, vector_ij,-0.5, limited, solution.GetLimiter(), gradients, scalar.j);
+    }
+
+    /*--- Convective flux, the Jacobians are w.r.t. the conservative variables. ---*/
+
+    if (!conservative) rho.i = rho.j = 1.0;
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a.i * rho.i * scalar.i(iVar) + a.j * rho.j * scalar.j(iVar);
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      jac_i.setConstant(0.0);
+      jac_j.setConstant(0.0);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diag(jac_i, iVar) = a.i;
+        diag(jac_j, iVar) = a.j;
+      }
+      AD::EndPassive(wasActive);
+    }
+
+    /*--- Corrected average of the gradients projected on the normal (see
+     *    CNumerics::ComputeProjectedGradient), for the diffusion terms. ---*/
+
+    const auto& gradients = solution.GetGradient();
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradients);
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradients);
+
+    const Double proj_vector_ij = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      VectorDbl<nDim> meanGrad;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        meanGrad(iDim) = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+      }
+      const Double delta = scalar1st.j(iVar) - scalar1st.i(iVar);
+      projGrad(iVar) = dot(meanGrad, normal) - (dot(meanGrad, vector_ij) - delta) * proj_vector_ij;
+    }
+
+    /*--- Model-specific diffusion. ---*/
+
+    static_cast<const Derived*>(this)->viscousTerms(iPoint, jPoint, solution, density, scalar1st,
+                                                    projGrad, proj_vector_ij, implicit, flux, jac_i, jac_j);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    stopPreacc(flux);
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CSAScalarFlux
+ * \ingroup ConvDiscr
+ * \brief Spalart-Allmaras fluxes, see CUpwSca_TurbSA, CAvgGrad_TurbSA, and CAvgGrad_TurbSA_Neg.
+ */
+template<size_t nDim>
+class CSAScalarFlux final : public CScalarFluxBase<CSAScalarFlux<nDim>, 1, nDim> {
+private:
+  using Base = CScalarFluxBase<CSAScalarFlux<nDim>, 1, nDim>;
+  using Base::nVar;
+  friend Base;
+
+  const su2double sigma = 2.0/3.0;
+  const su2double cn1 = 16.0;
+  const bool negative;
+
+  FORCEINLINE void viscousTerms(Int iPoint, Int jPoint, const CVariable&,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >& scalar,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+    const auto mu = this->flowPair(iPoint, jPoint, this->idxMu);
+
+    const Double nu_ij = 0.5 * (mu.i / density.i + mu.j / density.j);
+    const Double nu_tilde_ij = 0.5 * (scalar.i(0) + scalar.j(0));
+
+    /*--- For negative SA the modification only applies to negative nu_tilde,
+     *    where fn = 1 is recovered for positive values. ---*/
+    Double fn = 1.0;
+    if (negative) {
+      const Double Xi3 = pow(fmin(nu_tilde_ij, 0.0) / nu_ij, 3);
+      fn = (cn1 + Xi3) / (cn1 - Xi3);
+    }
+    const Double nu_e = nu_ij + fn * nu_tilde_ij;
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      Base::diag(jac_i, 0) -= (0.5 * projGrad(0) - nu_e * proj_vector_ij) / sigma;
+      Base::diag(jac_j, 0) -= (0.5 * projGrad(0) + nu_e * proj_vector_ij) / sigma;
+      AD::EndPassive(wasActive);
+    }
+  }
+
+public:
+  template<class... Ts>
+  CSAScalarFlux(const CConfig& config, Ts&... args) : Base(config, false, args...),
+    negative(config.GetSAParsedOptions().version == SA_OPTIONS::NEG) {
+  }
+};
+
+/*!
+ * \class CSSTScalarFlux
+ * \ingroup ConvDiscr
+ * \brief Menter SST fluxes, see CUpwSca_TurbSST and CAvgGrad_TurbSST.
+ */
+template<size_t nDim>
+class CSSTScalarFlux final : public CScalarFluxBase<CSSTScalarFlux<nDim>, 2, nDim> {
+private:
+  using Base = CScalarFluxBase<CSSTScalarFlux<nDim>, 2, nDim>;
+  using Base::nVar;
+  friend Base;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  FORCEINLINE void viscousTerms(Int iPoint, Int jPoint, const CVariable& solution,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >&,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+    const auto mu = this->flowPair(iPoint, jPoint, this->idxMu);
+    const auto mut = this->flowPair(iPoint, jPoint, this->idxMut);
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    /*--- Blended constants and mean effective dynamic viscosities. ---*/
+    const Double sigma_kine_i = F1_i*sigma_k1 + (1.0 - F1_i)*sigma_k2;
+    const Double sigma_kine_j = F1_j*sigma_k1 + (1.0 - F1_j)*sigma_k2;
+    const Double sigma_omega_i = F1_i*sigma_om1 + (1.0 - F1_i)*sigma_om2;
+    const Double sigma_omega_j = F1_j*sigma_om1 + (1.0 - F1_j)*sigma_om2;
+
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (mu.i + sigma_kine_i*mut.i + mu.j + sigma_kine_j*mut.j);
+    diff(1) = 0.5 * (mu.i + sigma_omega_i*mut.i + mu.j + sigma_omega_j*mut.j);
+
+    Base::diagonalDiffusion(diff, density, projGrad, proj_vector_ij, implicit, flux, jac_i, jac_j);
+  }
+
+public:
+  template<class... Ts>
+  CSSTScalarFlux(const CConfig& config, const su2double* constants, Ts&... args) :
+    Base(config, true, args...),
+    sigma_k1(constants[0]), sigma_k2(constants[1]),
+    sigma_om1(constants[2]), sigma_om2(constants[3]) {
+  }
+};
+
+/*!
+ * \class CLMScalarFlux
+ * \ingroup ConvDiscr
+ * \brief Langtry-Menter transition fluxes, see CUpwSca_TransLM and CAvgGrad_TransLM.
+ */
+template<size_t nDim>
+class CLMScalarFlux final : public CScalarFluxBase<CLMScalarFlux<nDim>, 2, nDim> {
+private:
+  using Base = CScalarFluxBase<CLMScalarFlux<nDim>, 2, nDim>;
+  using Base::nVar;
+  friend Base;
+
+  FORCEINLINE void viscousTerms(Int iPoint, Int jPoint, const CVariable&,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >&,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+    const auto mu = this->flowPair(iPoint, jPoint, this->idxMu);
+    const auto mut = this->flowPair(iPoint, jPoint, this->idxMut);
+
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (mu.i + mut.i + mu.j + mut.j);
+    diff(1) = 2.0 * diff(0);
+
+    Base::diagonalDiffusion(diff, density, projGrad, proj_vector_ij, implicit, flux, jac_i, jac_j);
+  }
+
+public:
+  template<class... Ts>
+  CLMScalarFlux(const CConfig& config, Ts&... args) : Base(config, true, args...) {}
+};
+
+/*!
+ * \class CSpeciesScalarFlux
+ * \ingroup ConvDiscr
+ * \brief Species transport fluxes, see CUpwSca_Species and CAvgGrad_Species.
+ * \note When the diffusivity model gives the same coefficient to all species, the diffusion
+ * coefficient is gathered and computed once per edge and applied to all species.
+ */
+template<size_t nVar_, size_t nDim>
+class CSpeciesScalarFlux final : public CScalarFluxBase<CSpeciesScalarFlux<nVar_,nDim>, nVar_, nDim> {
+private:
+  using Base = CScalarFluxBase<CSpeciesScalarFlux<nVar_,nDim>, nVar_, nDim>;
+  using Base::nVar;
+  friend Base;
+
+  const bool turbulence;
+  const bool sharedDiffusivity;
+  const su2double Sc_t;
+
+  FORCEINLINE void viscousTerms(Int iPoint, Int jPoint, const CVariable& solution,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >&,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+
+    Double diff_turb = 0.0;
+    if (turbulence) {
+      const auto mut = this->flowPair(iPoint, jPoint, this->idxMut);
+      diff_turb = 0.5 * (mut.i + mut.j) / Sc_t;
+    }
+
+    VectorDbl<nVar> diff;
+    if (sharedDiffusivity) {
+      const Double coeff_i = gatherVariables(iPoint, 0, diffusivity);
+      const Double coeff_j = gatherVariables(jPoint, 0, diffusivity);
+      diff.setConstant(0.5 * (density.i * coeff_i + density.j * coeff_j) + diff_turb);
+    } else {
+      const auto coeff_i = gatherVariables<nVar>(iPoint, diffusivity);
+      const auto coeff_j = gatherVariables<nVar>(jPoint, diffusivity);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diff(iVar) = 0.5 * (density.i * coeff_i(iVar) + density.j * coeff_j(iVar)) + diff_turb;
+      }
+    }
+
+    Base::diagonalDiffusion(diff, density, projGrad, proj_vector_ij, implicit, flux, jac_i, jac_j);
+  }
+
+public:
+  template<class... Ts>
+  CSpeciesScalarFlux(const CConfig& config, Ts&... args) : Base(config, true, args...),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    sharedDiffusivity(config.GetSpecies_SharedDiffusivity()),
+    Sc_t(config.GetSchmidt_Number_Turbulent()) {
+  }
+};
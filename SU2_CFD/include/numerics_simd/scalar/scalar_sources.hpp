@@ -0,0 +1,395 @@
+/*!
+ * \file scalar_sources.hpp
+ * \brief Point source terms of scalar transport equations.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CPrimitiveIndices.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Branch-free selection, mask is a SIMD array of 1's and 0's.
+ * \note Both values are evaluated, they must be finite for all lanes.
+ */
+FORCEINLINE Double select(Double mask, Double a, Double b) { return mask * a + (1.0 - mask) * b; }
+
+/*!
+ * \class CScalarSourceBase
+ * \ingroup SourceDiscr
+ * \brief Base class for the point source terms of scalar transport equations, evaluated for
+ * blocks of Double::Size consecutive points. Derived classes implement a const "pointSource"
+ * method that computes the source (to be subtracted from the residual, with the sign convention
+ * of the CNumerics source terms) and its Jacobian for the block.
+ * \note The data-dependent branches of the models should be replaced by masks (see select), the
+ * branches on constants of the problem (e.g. the model options) are uniform across the lanes.
+ */
+template<class Derived, size_t nVar_, size_t nDim_>
+class CScalarSourceBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nVar_;
+
+  const CFlowVariable& flowNodes;
+  const unsigned short idxVel, idxRho, idxMu, idxMut;
+
+  /*!
+   * \brief Constructor, store some constants.
+   * \param[in] flowNodes_ - Flow solution.
+   * \param[in] idx - Indices of the flow primitives.
+   */
+  CScalarSourceBase(const CFlowVariable& flowNodes_, const CPrimitiveIndices<unsigned short>& idx) :
+    flowNodes(flowNodes_),
+    idxVel(idx.Velocity()),
+    idxRho(idx.Density()),
+    idxMu(idx.LaminarViscosity()),
+    idxMut(idx.EddyViscosity()) {
+  }
+
+  /*!
+   * \brief Gather a flow primitive for the points of the block.
+   */
+  FORCEINLINE Double flowPrimitive(Int iPoint, size_t iVar) const {
+    return gatherVariables(iPoint, iVar, flowNodes.GetPrimitive());
+  }
+
+public:
+  /*!
+   * \brief Point-based numerics, there are no edge fluxes.
+   */
+  void ComputeFlux(Int, const CConfig&, const CGeometry&, const CVariable&, UpdateType, Double,
+                   CSysVector<su2double>&, SparseMatrixType&) const final {}
+
+  /*!
+   * \brief Implementation of the point sources.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    VectorDbl<nVar> source;
+    MatrixDbl<nVar> jac;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      source(iVar) = 0.0;
+      for (size_t jVar = 0; jVar < nVar; ++jVar) jac(iVar,jVar) = 0.0;
+    }
+
+    static_cast<const Derived*>(this)->pointSource(iPoint, config, geometry, solution, implicit, source, jac);
+
+    stopPreacc(source);
+
+    /*--- Update the points of the block one by one (the diagonal blocks are not contiguous). ---*/
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (updateMask[k] == 0) continue;
+
+      su2double residual[nVar];
+      for (size_t iVar = 0; iVar < nVar; ++iVar) residual[iVar] = source(iVar)[k];
+      vector.SubtractBlock(iPoint[k], residual);
+
+      if (implicit) {
+        const bool wasActive = AD::BeginPassive();
+        su2double block[nVar][nVar];
+        for (size_t iVar = 0; iVar < nVar; ++iVar)
+          for (size_t jVar = 0; jVar < nVar; ++jVar) block[iVar][jVar] = jac(iVar,jVar)[k];
+        matrix.SubtractBlock2Diag(iPoint[k], block);
+        AD::EndPassive(wasActive);
+      }
+    }
+  }
+};
+
+/*!
+ * \class CLMScalarSource
+ * \ingroup SourceDiscr
+ * \brief Langtry-Menter transition sources, see CSourcePieceWise_TransLM and TransLMCorrelations.
+ * \note The correlations are evaluated branch-free, the fixed point iterations for Re_theta_t
+ * (and Re_theta_t_SCF for LM2015) run until all lanes converge, converged lanes are frozen.
+ */
+template<size_t nDim>
+class CLMScalarSource final : public CScalarSourceBase<CLMScalarSource<nDim>, 2, nDim> {
+private:
+  using Base = CScalarSourceBase<CLMScalarSource<nDim>, 2, nDim>;
+  using Base::nVar;
+  friend Base;
+
+  const CVariable& turbNodes;
+  const LM_ParsedOptions options;
+  const bool turbKW;
+  const su2double Tu_SA;
+  const su2double hRoughness;
+
+  /*--- LM Closure constants ---*/
+  const passivedouble c_e1 = 1.0;
+  const passivedouble c_a1 = 2.0;
+  const passivedouble c_e2 = 50.0;
+  const passivedouble c_a2 = 0.06;
+  const passivedouble c_theta = 0.03;
+  const passivedouble c_CF = 0.6;
+
+  /*!
+   * \brief Re_theta_c correlation, see TransLMCorrelations::ReThetaC_Correlations.
+   */
+  FORCEINLINE Double ReThetaC(Double Tu, Double ReThetaT) const {
+    switch (options.Correlation) {
+      case TURB_TRANS_CORRELATION::MALAN:
+        return fmin(0.615 * ReThetaT + 61.5, ReThetaT);
+      case TURB_TRANS_CORRELATION::SULUKSNA:
+        return fmin(0.1 * exp(-0.0022 * ReThetaT + 12.0), 300.0);
+      case TURB_TRANS_CORRELATION::KRAUSE:
+        return 0.91 * ReThetaT + 5.32;
+      case TURB_TRANS_CORRELATION::KRAUSE_HYPER:
+        return ReThetaT / (((-0.042 * Tu + 0.4233) * Tu + 0.0118) * Tu + 1.0744);
+      case TURB_TRANS_CORRELATION::MEDIDA_BAEDER:
+        return (((4.45 * Tu - 5.7) * Tu + 1.37) * Tu + 0.585) * ReThetaT;
+      case TURB_TRANS_CORRELATION::MEDIDA:
+        return 0.62 * ReThetaT;
+      case TURB_TRANS_CORRELATION::MENTER_LANGTRY: {
+        const Double poly = (((-174.105e-12 * ReThetaT + 696.506e-9) * ReThetaT - 868.230e-6) * ReThetaT +
+                             10120.656e-4) * ReThetaT - 396.035e-2;
+        const Double linear = ReThetaT - (593.11 + 0.482 * (ReThetaT - 1870.0));
+        return select(ReThetaT <= 1870.0, poly, linear);
+      }
+      default:
+        return 0.0;
+    }
+  }
+
+  /*!
+   * \brief F_length correlation, see TransLMCorrelations::FLength_Correlations.
+   */
+  FORCEINLINE Double FLength(Double Tu, Double ReThetaT) const {
+    switch (options.Correlation) {
+      case TURB_TRANS_CORRELATION::MALAN:
+        return fmin(exp(7.168 - 0.01173 * ReThetaT) + 0.5, 300.0);
+      case TURB_TRANS_CORRELATION::SULUKSNA: {
+        const Double value = -pow(0.025 * ReThetaT, 2) + 1.47 * ReThetaT - 120.0;
+        return fmin(fmax(value, 125.0), ReThetaT);
+      }
+      case TURB_TRANS_CORRELATION::KRAUSE:
+        return 3.39 * ReThetaT + 55.03;
+      case TURB_TRANS_CORRELATION::KRAUSE_HYPER:
+        return log(ReThetaT + 1.0) * select(Tu <= 1.0, 1.0 / Tu, (0.2337 * Tu - 1.3493) * Tu + 2.1449);
+      case TURB_TRANS_CORRELATION::MEDIDA_BAEDER:
+        return (0.171 * Tu - 0.0083) * Tu + 0.0306;
+      case TURB_TRANS_CORRELATION::MEDIDA:
+        return 40.0;
+      case TURB_TRANS_CORRELATION::MENTER_LANGTRY: {
+        const Double f1 = 39.8189 + (-119.270e-4 + -132.567e-6 * ReThetaT) * ReThetaT;
+        const Double f2 = 263.404 + ((-101.695e-8 * ReThetaT + 194.548e-5) * ReThetaT - 123.939e-2) * ReThetaT;
+        const Double f3 = 0.5 - 3.0e-4 * (ReThetaT - 596.0);
+        return select(ReThetaT < 400.0, f1, select(ReThetaT < 596.0, f2, select(ReThetaT < 1200.0, f3, 0.3188)));
+      }
+      default:
+        return 0.0;
+    }
+  }
+
+  FORCEINLINE void pointSource(Int iPoint, const CConfig&, const CGeometry& geometry, const CVariable& solution,
+                               bool implicit, VectorDbl<nVar>& source, MatrixDbl<nVar>& jac) const {
+
+    const auto& nodes = *geometry.nodes;
+
+    /*--- Points at the wall have no sources, their inputs are replaced by benign values. ---*/
+
+    const Double wallDist = gatherVariables(iPoint, nodes.GetWall_Distance());
+    const Double inside = wallDist > 1e-10;
+
+    const Double dist = select(inside, wallDist, 1.0);
+    const Double volume = gatherVariables(iPoint, nodes.GetVolume());
+    const Double gamma = select(inside, gatherVariables(iPoint, 0, solution.GetSolution()), 1.0);
+    const Double reThetaT = gatherVariables(iPoint, 1, solution.GetSolution());
+
+    const Double rho = this->flowPrimitive(iPoint, this->idxRho);
+    const Double mu = this->flowPrimitive(iPoint, this->idxMu);
+    const Double mut = this->flowPrimitive(iPoint, this->idxMut);
+    const Double strainMag = gatherVariables(iPoint, this->flowNodes.GetStrainMag());
+    const auto vorticity = gatherVariables<3>(iPoint, this->flowNodes.GetVorticity());
+    const Double vorticityMag = norm(vorticity);
+
+    VectorDbl<nDim> vel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) vel(iDim) = this->flowPrimitive(iPoint, this->idxVel + iDim);
+    const Double velMag = select(inside, norm(vel), 1.0);
+
+    Double k = 0.0, omega = 1.0;
+    if (turbKW) {
+      k = gatherVariables(iPoint, 0, turbNodes.GetSolution());
+      omega = gatherVariables(iPoint, 1, turbNodes.GetSolution());
+    }
+
+    /*--- Turbulence intensity and the correlations. ---*/
+
+    const Double Tu = turbKW ? Double(fmax(100.0 * sqrt(2.0 * k / 3.0) / velMag, 0.027)) : Double(Tu_SA);
+
+    const Double corrRec = ReThetaC(Tu, reThetaT);
+    const Double corrFLength = FLength(Tu, reThetaT);
+
+    const Double d2 = dist * dist;
+    Double F_length = corrFLength;
+    if (turbKW) {
+      const Double f_sub = exp(-pow(rho * d2 * omega / mu / 200.0, 2));
+      F_length = corrFLength * (1.0 - f_sub) + 40.0 * f_sub;
+    }
+
+    /*--- F_onset ---*/
+
+    const Double R_t = turbKW ? Double(rho * k / (mu * omega)) : Double(mut / mu);
+    const Double Re_v = rho * d2 * strainMag / mu;
+    const Double F_onset1 = Re_v / (2.193 * corrRec);
+    const Double F_onset2 = fmin(fmax(F_onset1, pow(F_onset1, 4)), turbKW ? 2.0 : 4.0);
+    const Double F_onset3 = fmax((turbKW ? 1.0 : 2.0) - pow(R_t / 2.5, 3), 0.0);
+    const Double F_onset = fmax(F_onset2 - F_onset3, 0.0);
+
+    /*--- Acceleration along the streamline. ---*/
+
+    const auto& velGrad = this->flowNodes.GetGradient_Primitive();
+    Double du_ds = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const auto grad = gatherVariables<nDim>(iPoint, this->idxVel + iDim, velGrad);
+      du_ds += vel(iDim) * dot(grad, vel);
+    }
+    du_ds /= velMag * velMag;
+
+    /*--- Blending function f_theta. ---*/
+
+    Double time_scale = 500.0 * mu / (rho * velMag * velMag);
+    if (options.LM2015) {
+      const Double length = gatherVariables(iPoint, nodes.GetMaxLength());
+      time_scale = fmin(time_scale, rho * length * length / (mu + mut));
+    }
+    const Double theta_bl = reThetaT * mu / (rho * velMag);
+    const Double delta = 50.0 * vorticityMag * dist / velMag * 7.5 * theta_bl + 1e-20;
+
+    Double f_wake = 1.0;
+    if (turbKW) f_wake = exp(-pow(rho * omega * d2 / mu / 1.0e5, 2));
+
+    const Double var1 = (gamma - 1.0 / c_e2) / (1.0 - 1.0 / c_e2);
+    const Double var2 = 1.0 - var1 * var1;
+    const Double f_wall = f_wake * exp(-pow(dist / delta, 4));
+    const Double f_theta = fmin(fmax(f_wall, var2), 1.0);
+    const Double f_turb = exp(-pow(R_t / 4.0, 4));
+
+    /*--- Re_theta_t correlation, the factors that only depend on Tu are hoisted out of the iterations. ---*/
+
+    const Double expTuNeg = exp(-pow(Tu / 1.5, 1.5));
+    const Double expTuPos = 0.275 * exp(-Tu / 0.5);
+    const Double corrTu = select(Tu <= 1.3, 1173.51 - 589.428 * Tu + 0.2196 / (Tu * Tu),
+                                 331.5 * pow(fmax(Tu - 0.5658, 1e-6), -0.671));
+    const Double lambdaScale = rho * du_ds / mu * pow(mu / (rho * velMag), 2);
+
+    Double corrRet = 20.0, corrRetOld = 0.0, active = 1.0;
+    for (int iter = 0; iter < 100 && active.sum() > 0; iter++) {
+      const Double lambda = fmin(fmax(-0.1, lambdaScale * corrRet * corrRet), 0.1);
+      const Double f_lambda =
+          select(lambda <= 0.0, 1.0 - (-12.986 - (123.66 + 405.689 * lambda) * lambda) * lambda * expTuNeg,
+                 1.0 + (1.0 - exp(-35.0 * lambda)) * expTuPos);
+      const Double value = fmax(f_lambda * corrTu, 20.0);
+      corrRet = select(active, value, corrRet);
+      active *= abs(corrRetOld - value) >= 1e-7 * corrRetOld;
+      corrRetOld = corrRet;
+    }
+
+    /*--- Cross-flow Re_theta_t_SCF (LM2015). ---*/
+
+    Double reThetaSCF = 0.0, f_theta_2 = 0.0;
+    if (options.LM2015) {
+      f_theta_2 = fmin(f_wall, 1.0);
+
+      Double streamwiseVort = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) streamwiseVort += vel(iDim) / velMag * vorticity(iDim);
+
+      const Double H_CF = abs(streamwiseVort) * dist / velMag;
+      const Double DeltaH_CF = H_CF * (1.0 + fmin(mut / mu, 0.4));
+      const Double DeltaH_CF_Minus = fmax(DeltaH_CF - 0.1066, 0.0);
+      const Double DeltaH_CF_Plus = fmax(0.1066 - DeltaH_CF, 0.0);
+      const Double fDeltaH_CF = (6200.0 + 50000.0 * DeltaH_CF_Plus) * DeltaH_CF_Plus -
+                                75.0 * tanh(DeltaH_CF_Minus / 0.0125);
+      const Double thetaScale = 0.82 * mu / (rho * velMag);
+
+      Double reThetaOld = 20.0;
+      active = 1.0;
+      for (int iter = 0; iter < 100 && active.sum() > 0; iter++) {
+        const Double thetat_SCF = fmax(1e-20, reThetaOld * thetaScale);
+        const Double value = -35.088 * log(hRoughness / thetat_SCF) + 319.51 + fDeltaH_CF;
+        reThetaSCF = select(active, value, reThetaSCF);
+        active *= abs(value - reThetaOld) > 1e-5 * reThetaOld;
+        reThetaOld = reThetaSCF;
+      }
+    }
+
+    /*--- Production and destruction of intermittency and Re_theta_t. ---*/
+
+    const Double Pg = F_length * c_a1 * rho * strainMag * sqrt(F_onset * gamma) * (1.0 - c_e1 * gamma);
+    const Double Dg = c_a2 * rho * vorticityMag * gamma * f_turb * (c_e2 * gamma - 1.0);
+    const Double PRethetat = c_theta * rho / time_scale * (corrRet - reThetaT) * (1.0 - f_theta);
+    Double DRethetat = 0.0;
+    if (options.LM2015)
+      DRethetat = -c_theta * rho / time_scale * c_CF * fmin(reThetaSCF - reThetaT, 0.0) * f_theta_2;
+
+    source(0) = inside * (Pg - Dg) * volume;
+    source(1) = inside * (PRethetat - DRethetat) * volume;
+
+    if (implicit) {
+      const bool wasActive = AD::BeginPassive();
+      jac(0,0) = inside * volume *
+                 (F_length * c_a1 * strainMag * sqrt(F_onset) * (0.5 / sqrt(gamma) - 1.5 * c_e1 * sqrt(gamma)) -
+                  c_a2 * vorticityMag * f_turb * (2.0 * c_e2 * gamma - 1.0));
+      Double jac11 = -c_theta / time_scale * (1.0 - f_theta);
+      if (options.LM2015) jac11 += (reThetaSCF - reThetaT < 0.0) * c_theta / time_scale * c_CF * f_theta_2;
+      jac(1,1) = inside * volume * jac11;
+      AD::EndPassive(wasActive);
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants.
+   * \param[in] config - Problem definitions.
+   * \param[in] flowNodes - Flow solution.
+   * \param[in] turbNodes_ - Turbulence solution.
+   * \param[in] idx - Indices of the flow primitives.
+   */
+  CLMScalarSource(const CConfig& config, const CFlowVariable& flowNodes, const CVariable& turbNodes_,
+                  const CPrimitiveIndices<unsigned short>& idx) :
+    Base(flowNodes, idx),
+    turbNodes(turbNodes_),
+    options(config.GetLMParsedOptions()),
+    turbKW(TurbModelFamily(config.GetKind_Turb_Model()) == TURB_FAMILY::KW),
+    Tu_SA(config.GetTurbulenceIntensity_FreeStream() * 100),
+    hRoughness(config.GethRoughness()) {
+  }
+};
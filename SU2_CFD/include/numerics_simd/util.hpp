@@ -157,6 +157,29 @@ template<size_t nRows, size_t nCols, class Container>
 FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
   return vars.template get<MatrixDbl<nRows,nCols> >(iPoint);
 }
+
+/*!
+ * \brief Gather the variable in column iVar from row iPoint of a 2D container.
+ * \note Use this when the column is only known at runtime.
+ */
+template<class Container>
+FORCEINLINE Double gatherVariables(Int iPoint, size_t iVar, const Container& vars) {
+  Double x;
+  for (size_t k=0; k<Double::Size; ++k) x[k] = vars(iPoint[k],iVar);
+  return x;
+}
+
+/*!
+ * \brief Gather row iVar (size nCols) of the matrix at outer index iPoint of a 3D container.
+ */
+template<size_t nCols, class Container>
+FORCEINLINE VectorDbl<nCols> gatherVariables(Int iPoint, size_t iVar, const Container& vars) {
+  VectorDbl<nCols> x;
+  for (size_t j=0; j<nCols; ++j) {
+    for (size_t k=0; k<Double::Size; ++k) x[j][k] = vars(iPoint[k],iVar,j);
+  }
+  return x;
+}
 #else
 
 namespace {
@@ -203,6 +226,28 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
   }
   return x;
 }
+
+template<class Container>
+FORCEINLINE Double gatherVariables(Int iPoint, size_t iVar, const Container& vars) {
+  Double x;
+  for (size_t k=0; k<Double::Size; ++k) {
+    AD::SetPreaccIn(vars(iPoint[k],iVar));
+    x[k] = vars(iPoint[k],iVar);
+  }
+  return x;
+}
+
+template<size_t nCols, class Container>
+FORCEINLINE VectorDbl<nCols> gatherVariables(Int iPoint, size_t iVar, const Container& vars) {
+  VectorDbl<nCols> x;
+  for (size_t j=0; j<nCols; ++j) {
+    for (size_t k=0; k<Double::Size; ++k) {
+      AD::SetPreaccIn(vars(iPoint[k],iVar,j));
+      x[j][k] = vars(iPoint[k],iVar,j);
+    }
+  }
+  return x;
+}
 #endif
 
 /*!
@@ -92,4 +92,18 @@ class CAdjFlowOutput : public COutput {
    * \param[in] iPoint - Index of the point.
    */
   void LoadVolumeDataAdjScalar(const CConfig* config, const CSolver* const* solver, const unsigned long iPoint);
+
+  /*!
+   * \brief Add the adjoint-weighted mesh refinement indicator volume field (FVMComp, FVMInc).
+   */
+  void SetVolumeOutputFieldsAdjIndicator();
+
+  /*!
+   * \brief Set the adjoint-weighted mesh refinement indicator for a point, largest product of the jumps of the
+   *        adjoint and flow solutions between the point and its neighbors (an estimate of h^2 |grad(Psi)| |grad(U)|).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   * \param[in] iPoint - Index of the point.
+   */
+  void LoadVolumeDataAdjIndicator(const CGeometry* geometry, const CSolver* const* solver, const unsigned long iPoint);
 };
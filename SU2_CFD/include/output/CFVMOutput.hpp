@@ -30,6 +30,10 @@
 #include "COutput.hpp"
 
 class CFVMOutput : public COutput{
+ private:
+  bool multiGridRequested = true;  /*!< \brief Whether the coarse grids are written. */
+  bool lineletRequested = true;    /*!< \brief Whether the linelets are written. */
+
  protected:
   /*!
    * \brief Constructor of the class
@@ -61,4 +65,9 @@ class CFVMOutput : public COutput{
    * \brief Load common FVM outputs.
    */
   void LoadCommonFVMOutputs(const CConfig* config, const CGeometry* geometry, unsigned long iPoint);
+
+  /*!
+   * \brief Find which of the common FVM outputs need to be computed.
+   */
+  void SetRequestedVolumeOutputs(const CConfig* config) override;
 };
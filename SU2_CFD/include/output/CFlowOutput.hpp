@@ -28,16 +28,28 @@
 #pragma once
 
 #include "CFVMOutput.hpp"
+#include "tools/CTimeStatistics.hpp"
 #include "../variables/CVariable.hpp"
 
 /*--- Forward declare to avoid including here. ---*/
 template <class>
 struct CPrimitiveIndices;
+class CADTElemClass;
 
 class CFlowOutput : public CFVMOutput{
 protected:
   unsigned long lastInnerIter;
 
+  bool vorticityRequested = true;     /*!< \brief Whether the vorticity is written. */
+  bool qCriterionRequested = true;    /*!< \brief Whether the Q-criterion is written. */
+  bool featureIndicatorRequested = true; /*!< \brief Whether the feature-based refinement indicator is written. */
+  bool timeAveragesRequested = true;  /*!< \brief Whether the time averaged fields are written. */
+  bool timeStatisticsRequested = false; /*!< \brief Whether the running statistics are written. */
+
+  std::unique_ptr<CTimeStatistics> timeStatistics;  /*!< \brief Running statistics (TIME_STATISTICS). */
+  vector<CStreamingSpectrum> spectralProbes;        /*!< \brief Spectra of the SPECTRAL_PROBES. */
+  unsigned long lastStatisticsIter = std::numeric_limits<unsigned long>::max(); /*!< \brief Last time step added. */
+
   /*!
    * \brief Constructor of the class
    * \param[in] config - Definition of the particular problem.
@@ -170,6 +182,12 @@ protected:
   void LoadVolumeDataScalar(const CConfig* config, const CSolver* const* solver, const CGeometry* geometry,
                              const unsigned long iPoint);
 
+  /*!
+   * \brief Find which of the derived flow quantities need to be computed for the volume output.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRequestedVolumeOutputs(const CConfig* config) override;
+
   /*!
    * \brief Add aerodynamic coefficients as output fields
    * \param[in] config - Definition of the particular problem.
@@ -241,6 +259,16 @@ protected:
    */
   void SetCustomOutputs(const CSolver* const* solver, const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Helper for probe, line, and plane custom outputs, finds the elements that contain the samples with
+   * an ADT of the local volume elements, the lowest rank containing a sample owns it. Samples outside the
+   * domain use the nearest domain point.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] adt - ADT of the local volume elements (the element IDs are the local element indices).
+   * \param[in,out] output - The custom output.
+   */
+  void LocateProbeSamples(const CGeometry* geometry, CADTElemClass& adt, CustomOutput& output) const;
+
   /*!
    * \brief Helper for custom outputs, converts variable names to indices and pointers which are then used
    * to evaluate the custom expressions.
@@ -287,6 +315,17 @@ protected:
     return Q;
   }
 
+  /*!
+   * \brief Feature-based mesh refinement indicator, largest velocity jump between a point and its neighbors.
+   * \note This is an undivided (cell size times) velocity gradient, it does not require the gradients to
+   *       be computed and it highlights shocks, shear layers, and wakes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] flowNodes - Flow variables.
+   * \param[in] iPoint - Index of the point.
+   * \return Value of the indicator at the node.
+   */
+  su2double GetFeatureIndicator(const CGeometry* geometry, const CVariable* flowNodes, unsigned long iPoint) const;
+
   /*!
    * \brief Returns the axisymmetric factor for a point on a marker.
    */
@@ -336,9 +375,10 @@ protected:
   void WriteForcesBreakdown(const CConfig *config, const CSolver *flow_solver) const;
 
   /*!
-   * \brief Set the time averaged output fields.
+   * \brief Set the time averaged output fields, and the running statistics fields.
+   * \param[in] config - Definition of the particular problem.
    */
-  void SetTimeAveragedFields();
+  void SetTimeAveragedFields(const CConfig *config);
 
   /*!
    * \brief Load the time averaged output fields.
@@ -347,6 +387,21 @@ protected:
    */
   void LoadTimeAveragedData(unsigned long iPoint, const CVariable *node_flow);
 
+  /*!
+   * \brief Add the current time step to the running statistics and spectral probes.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  void UpdateTimeStatistics(const CConfig *config, const CGeometry *geometry, CSolver **solver_container) override;
+
+  /*!
+   * \brief Write the state of the running statistics, and the spectra of the probes.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void WriteTimeStatistics(const CConfig *config, const CGeometry *geometry) const;
+
   /*!
    * \brief Write additional output for fixed CL mode.
    * \param[in] config - Definition of the particular problem per zone.
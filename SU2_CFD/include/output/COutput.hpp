@@ -34,7 +34,9 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <thread>
 
+#include "../../../Common/include/parallelization/mpi_structure.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
 #include "../../../Common/include/option_structure.hpp"
@@ -49,11 +51,13 @@ inline su2double hypot(const su2double& a, const su2double& b) {
 }
 }
 #include "mel.hpp"
+#include "tools/CCompiledExpression.hpp"
 
 class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+class CSurfaceStreamWriter;
 class CConfig;
 
 using namespace std;
@@ -164,9 +168,26 @@ protected:
   PrintingToolbox::CTablePrinter* multiZoneHeaderTable; //!< Multizone header output structure
   PrintingToolbox::CTablePrinter* historyFileTable;     //!< Table structure for writing to history file
   PrintingToolbox::CTablePrinter* fileWritingTable;     //!< File writing header
+  std::stringstream fileWritingLog;                     //!< Buffer for fileWritingTable with asynchronous output
   std::string multiZoneHeaderString;                    //!< Multizone header string
   bool headerNeeded;                                    //!< Boolean that stores whether a screen header is needed
 
+  /*!
+   * \brief Iteration counters and times that identify a set of result files.
+   * \note Copied when the files are requested, since the solver advances while they are written asynchronously.
+   */
+  struct OutputStamp {
+    unsigned long timeIter, outerIter, innerIter;
+    su2double timeStep, curTime;
+  };
+
+  bool asyncOutput = false;               //!< Sort and write the result files on a background thread
+  std::thread asyncOutputThread;          //!< Thread writing the last set of result files
+  su2double pendingRestartBandwidth = 0;  //!< Bandwidth of the restart files not yet added to the config
+#ifdef HAVE_MPI
+  SU2_MPI::Comm asyncOutputComm = MPI_COMM_NULL; //!< Duplicate communicator used by asyncOutputThread
+#endif
+
   //! Structure to store the value of the running averages
   map<string, CWindowedAverage> windowedTimeAverages;
 
@@ -188,7 +209,7 @@ protected:
   CustomHistoryOutput customObjFunc;  /*!< \brief User-defined expression for a custom objective. */
 
   /*! \brief Type of operation for custom outputs. */
-  enum class OperationType { MACRO, FUNCTION, AREA_AVG, AREA_INT, MASSFLOW_AVG, MASSFLOW_INT, PROBE };
+  enum class OperationType { MACRO, FUNCTION, AREA_AVG, AREA_INT, MASSFLOW_AVG, MASSFLOW_INT, PROBE, LINE, PLANE };
 
   /*! \brief Struct to hold a parsed custom output function. */
   struct CustomOutput {
@@ -202,9 +223,23 @@ protected:
     mel::ExpressionTree<passivedouble> expression;
     std::vector<std::string> varSymbols;
     std::vector<unsigned short> markerIndices;
-    static constexpr long PROBE_NOT_SETUP = -2;
-    static constexpr long PROBE_NOT_OWNED = -1;
-    long iPoint = PROBE_NOT_SETUP;
+
+    /*--- Linear form of the expression to evaluate integrals for blocks of points, not ready if the expression
+     uses features that it does not support (then the expression tree is evaluated for each point). ---*/
+    CCompiledExpression compiled;
+
+    /*--- Probes, lines, and planes are sets of samples, each with its history output name and, on the rank that
+     owns it, the points and weights that interpolate the expression (no points on the other ranks). ---*/
+    struct ProbeSample {
+      std::vector<unsigned long> points;
+      std::vector<su2double> weights;
+    };
+    std::vector<std::string> sampleNames;
+    std::vector<ProbeSample> samples;
+
+    bool IsProbe() const {
+      return type == OperationType::PROBE || type == OperationType::LINE || type == OperationType::PLANE;
+    }
 
     /*--- The symbols (strings) are associated with an integer index for efficiency. For evaluation this index
      is passed to a functor that returns the value associated with the symbol. This functor is an input to "eval()"
@@ -238,13 +273,17 @@ protected:
   };
 
   std::vector<CustomOutput> customOutputs;  /*!< \brief User-defined outputs. */
+  bool customOutputsDeferred = false;       /*!< \brief The custom outputs were not evaluated in this iteration. */
 
   /*----------------------------- Volume output ----------------------------*/
 
   CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
   CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
+  CSurfaceStreamWriter* surfaceStreamWriter = nullptr; //!< Writer of the surface stream (kept open between outputs)
 
   vector<string> volumeFieldNames;     //!< Vector containing the volume field names
+  vector<string> catalystFieldNames;   //!< Volume field names passed to Catalyst (in-situ output)
+  vector<string> streamFieldNames;     //!< Volume field names of the surface stream output
   unsigned short nVolumeFields;        //!< Number of fields in the volume output
 
   string volumeFilename,               //!< Volume output filename
@@ -446,6 +485,12 @@ public:
    */
   inline string GetRestartFilename() {return restartFilename;}
 
+  /*!
+   * \brief Enable or disable the screen and history output (e.g. during intermediate passes of a driver).
+   * \param[in] wrt - If the output should be written.
+   */
+  inline void SetHistoryWriting(bool wrt) {noWriting = !wrt;}
+
   /*!
    * \brief Set the current iteration indices
    * \param[in] TimeIter  - Timer iteration index
@@ -603,6 +648,13 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName = "");
 
+  /*!
+   * \brief Wait for the asynchronous output to finish, then print its summary and account for its bandwidth.
+   * \note Must be called before the geometry is deleted, the destructor only waits as a last resort.
+   * \param[in] config - Definition of the particular problem, nullptr to skip the bandwidth.
+   */
+  void WaitForAsyncOutput(CConfig* config);
+
 protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
@@ -764,6 +816,15 @@ protected:
    */
   void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
+  /*!
+   * \brief Check if a volume output field, or any field of a group, is written.
+   * \note This is used to skip computing fields that are not written, which must be skipped for all points
+   *       (the field index cache assumes the same sequence of calls for every point).
+   * \param[in] name - Name of the field or of the group.
+   * \return <TRUE> if the field (or some field of the group) was requested.
+   */
+  bool VolumeOutputRequested(const string& name) const;
+
   /*!
    * \brief CheckHistoryOutput
    */
@@ -783,6 +844,30 @@ protected:
    */
   void LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver);
 
+  /*!
+   * \brief Get the iteration counters and times of the current iteration, for the names and headers of the files.
+   * \note The times are 0 if the history output was not set up (e.g. when only converting files).
+   */
+  OutputStamp GetOutputStamp() const {
+    auto value = [this](const string& name) {
+      const auto it = historyOutput_Map.find(name);
+      return it != historyOutput_Map.end() ? it->second.value : su2double(0.0);
+    };
+    return {curTimeIter, curOuterIter, curInnerIter, value("TIME_STEP"), value("CUR_TIME")};
+  }
+
+  /*!
+   * \brief Allocates the appropriate file writer based on the chosen format and writes sorted data to file.
+   * \note Only uses the data sorters and the arguments, such that it can run concurrently with the solver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] format - The output format.
+   * \param[in] fileName - The file name. If empty, the filenames are automatically determined.
+   * \param[in] stamp - Iterations and times of the data.
+   */
+  void WriteSortedData(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName,
+                       const OutputStamp& stamp);
+
   /*!
    * \brief Postprocess_HistoryData
    * \param[in] config - Definition of the particular problem.
@@ -837,6 +922,14 @@ protected:
    */
   void ComputeSimpleCustomOutputs(const CConfig *config);
 
+  /*!
+   * \brief Whether the custom outputs are consumed in this iteration (written to screen or history, monitored
+   *        for convergence, used by the custom objective, etc.), otherwise their evaluation can be deferred.
+   * \param[in] config - Definition of the particular problem.
+   * \return <TRUE> if the custom outputs must be evaluated.
+   */
+  bool CustomOutputsNeeded(const CConfig *config);
+
   /*!
    * \brief Load values of the history fields common for all solvers.
    * \param[in] config - Definition of the particular problem.
@@ -942,6 +1035,12 @@ protected:
    */
   inline virtual void SetVolumeOutputFields(CConfig *config){}
 
+  /*!
+   * \brief Called once the requested volume output fields are known, to find which need to be computed.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetRequestedVolumeOutputs(const CConfig *config){}
+
   /*!
    * \brief Load the history output field values
    * \param[in] config - Definition of the particular problem.
@@ -1013,6 +1112,14 @@ protected:
    */
   inline virtual void WriteAdditionalFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
 
+  /*!
+   * \brief Add the current time step to the running statistics (if any) of the current solver.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  inline virtual void UpdateTimeStatistics(const CConfig *config, const CGeometry* geometry, CSolver** solver_container){}
+
   /*!
    * \brief Write any additional output defined for the current solver.
    * \param[in] config - Definition of the particular problem per zone.
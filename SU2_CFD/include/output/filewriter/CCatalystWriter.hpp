@@ -0,0 +1,82 @@
+/*!
+ * \file CCatalystWriter.hpp
+ * \brief Headers for the in-situ (Catalyst) output class.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFileWriter.hpp"
+
+class CConfig;
+
+/*!
+ * \class CCatalystWriter
+ * \brief Passes the sorted volume data to Catalyst (in-situ/in-transit processing) instead of writing a file.
+ * \note The data is described with the Conduit Mesh Blueprint, which makes the writer independent of the
+ *       Catalyst implementation loaded at runtime (e.g. ParaView for in-situ pipelines, or ADIOS2 to stream
+ *       the data to another job). Each rank passes its linear partition of the points, plus copies of the
+ *       points owned by other ranks that its elements need, which are flagged in the field "vtkGhostType".
+ *       The data is only referenced during the call to Catalyst, nothing is written by SU2 itself.
+ */
+class CCatalystWriter final : public CFileWriter {
+ private:
+  const unsigned long timeIter;      /*!< \brief Time (or outer) iteration of the data. */
+  const passivedouble timeValue;     /*!< \brief Physical time of the data. */
+  const vector<string> sentFields;   /*!< \brief Names of the fields to pass to Catalyst. */
+
+  static bool initialized; /*!< \brief Whether Catalyst was initialized in this process. */
+
+ public:
+  /*!
+   * \brief File extension (there is no file).
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a Catalyst writer.
+   * \param[in] valDataSorter - The parallel sorted data (volume) to pass to Catalyst.
+   * \param[in] valTimeIter - Iteration of the data.
+   * \param[in] valTime - Physical time of the data.
+   * \param[in] valFields - Names of the fields to pass, the coordinates are always passed.
+   */
+  CCatalystWriter(CParallelDataSorter* valDataSorter, unsigned long valTimeIter, su2double valTime,
+                  vector<string> valFields);
+
+  /*!
+   * \brief Pass the sorted data to the Catalyst pipelines.
+   * \param[in] val_filename - Name of the Catalyst channel (the directory part is removed).
+   */
+  void WriteData(string val_filename) override;
+
+  /*!
+   * \brief Initialize Catalyst with the pipeline scripts of the config, does nothing if already initialized.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static void Initialize(const CConfig* config);
+
+  /*!
+   * \brief Finalize Catalyst, does nothing if it was not initialized.
+   */
+  static void Finalize();
+};
@@ -0,0 +1,157 @@
+/*!
+ * \file CHDF5FileWriter.hpp
+ * \brief Headers for the HDF5/XDMF file writer class.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef HAVE_HDF5
+#include "hdf5.h"
+#endif
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CHDF5FileWriter
+ * \brief Writes the sorted data into a single HDF5 file, described for visualization tools by an XDMF file.
+ * \note The layout of the HDF5 file is:
+ *       - /Mesh/Topology: XDMF "Mixed" connectivity of all elements (type ID, [number of nodes], nodes), int64.
+ *       - /Mesh/Coordinates: number of points x 3 coordinates, float32.
+ *       - /Step_<time iteration>/<field>: one float32 dataset per output field, and the attributes Time and TimeIter.
+ *         With a dynamic grid the coordinates are stored in each step instead of in /Mesh.
+ *       Time-dependent problems append one step per call to the same file; otherwise the file is overwritten.
+ *       The datasets are chunked, and compressed (deflate) if a compression level is given.
+ */
+class CHDF5FileWriter final : public CFileWriter {
+ private:
+  const unsigned long timeIter;     /*!< \brief Time iteration of the data. */
+  const passivedouble timeValue;    /*!< \brief Physical time of the data. */
+  const bool timeSeries;            /*!< \brief Append the data to an existing file as a new step. */
+  const bool dynamicGrid;           /*!< \brief Write the coordinates with every step. */
+  const unsigned short compression; /*!< \brief Deflate level of the datasets (0 is no compression). */
+
+  static constexpr unsigned long ChunkSize = 65536; /*!< \brief Number of points (or integers) per chunk. */
+
+#ifdef HAVE_HDF5
+  hid_t fileID = -1; /*!< \brief HDF5 file handle. */
+  hid_t dxplID = -1; /*!< \brief Transfer properties of the writes (collective with MPI). */
+#endif
+
+ public:
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Extension of the XDMF descriptor.
+   */
+  const static string descriptorExt;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valDataSorter - The parallel sorted data to write.
+   * \param[in] valTimeIter - Time iteration of the data.
+   * \param[in] valTime - Physical time of the data.
+   * \param[in] valTimeSeries - Append the data to an existing file.
+   * \param[in] valDynamicGrid - Store the coordinates with every step.
+   * \param[in] valCompression - Deflate level between 0 (none) and 9.
+   */
+  CHDF5FileWriter(CParallelDataSorter* valDataSorter, unsigned long valTimeIter, su2double valTime,
+                  bool valTimeSeries, bool valDynamicGrid, unsigned short valCompression);
+
+  /*!
+   * \brief Write sorted data to file in HDF5 file format, and the XDMF descriptor.
+   * \param[in] val_filename - The name of the file.
+   */
+  void WriteData(string val_filename) override;
+
+ private:
+#ifdef HAVE_HDF5
+  /*!
+   * \brief Check the return value of an HDF5 function.
+   * \param[in] ier - Return value (negative on failure).
+   */
+  static inline void CallHDF5(int64_t ier) {
+    if (ier < 0) SU2_MPI::Error("The HDF5 library reported an error.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Return the XDMF element type ID of a GEO_TYPE.
+   */
+  static inline int GetXDMFType(unsigned short elementType) {
+    switch (elementType) {
+      case LINE: return 2;
+      case TRIANGLE: return 4;
+      case QUADRILATERAL: return 5;
+      case TETRAHEDRON: return 6;
+      case PYRAMID: return 7;
+      case PRISM: return 8;
+      case HEXAHEDRON: return 9;
+      default:
+        assert(false && "Invalid element type.");
+        return 0;
+    }
+  }
+
+  /*!
+   * \brief Create (or open for appending) the file.
+   * \param[in] val_filename - Name of the file with extension.
+   */
+  void OpenFile(const string& val_filename);
+
+  /*!
+   * \brief Collectively write a dataset distributed over the ranks.
+   * \param[in] location - Group of the dataset.
+   * \param[in] name - Name of the dataset.
+   * \param[in] fileType, memType - HDF5 types of the data in the file and in memory.
+   * \param[in] data - Local part of the data.
+   * \param[in] nLocal - Local number of rows.
+   * \param[in] offset - Position of the first local row in the dataset.
+   * \param[in] nGlobal - Global number of rows.
+   * \param[in] nComp - Number of columns.
+   */
+  void WriteDataset(hid_t location, const string& name, hid_t fileType, hid_t memType, const void* data,
+                    unsigned long nLocal, unsigned long offset, unsigned long nGlobal, unsigned long nComp);
+
+  /*!
+   * \brief Write the mixed connectivity of all elements.
+   * \param[in] location - Group of the dataset.
+   */
+  void WriteTopology(hid_t location);
+
+  /*!
+   * \brief Write the coordinates (always 3 components).
+   * \param[in] location - Group of the dataset.
+   */
+  void WriteCoordinates(hid_t location);
+
+  /*!
+   * \brief Write the XDMF descriptor of all the steps in the file (collective, the master node writes it).
+   * \param[in] descriptorName - Name of the XDMF file.
+   * \param[in] dataFileName - Name of the HDF5 file, as referenced by the descriptor.
+   */
+  void WriteDescriptor(const string& descriptorName, const string& dataFileName) const;
+#endif
+};
@@ -30,6 +30,13 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  const RESTART_COMPRESSION compression; /*!< \brief Compression of the data. */
+  const passivedouble tolerance;         /*!< \brief Relative error bound of lossy compression. */
+
+  /*!
+   * \brief Write the data in compressed blocks (see CompressionToolbox).
+   */
+  void WriteCompressedData();
 
 public:
 
@@ -41,8 +48,12 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Compression of the data.
+   * \param[in] valTolerance - Error bound of lossy compression, relative to the magnitude of each field.
    */
-  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter,
+                       RESTART_COMPRESSION valCompression = RESTART_COMPRESSION::NONE,
+                       su2double valTolerance = 0.0);
 
   /*!
    * \brief Destructor
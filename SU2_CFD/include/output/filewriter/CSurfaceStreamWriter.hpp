@@ -0,0 +1,103 @@
+/*!
+ * \file CSurfaceStreamWriter.hpp
+ * \brief Headers for the surface stream (high-frequency sampling) output class.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "CFileWriter.hpp"
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CSurfaceStreamWriter
+ * \brief Appends the values of some fields on some markers to a binary stream, e.g. every time step for acoustics.
+ * \note Unlike the other writers, the data is neither sorted nor communicated. Each rank writes the points it owns
+ *       at offsets fixed when the stream is created, and the file stays open between steps. The layout is:
+ *       - Header: int32 {535532, format (1), number of fields, number of markers}, the field names, and for each
+ *         marker its name and int64 {number of points, number of elements}. Names use CGNS_STRING_SIZE chars.
+ *       - For each marker: the global indices of its points (int64), their coordinates (3 doubles per point), and
+ *         its elements as int64 {VTK type, 4 nodes (global indices, -1 if unused)}.
+ *       - One record per step: double {iteration, time}, then for each marker the values of its points
+ *         (number of points x number of fields doubles).
+ *       The records have a fixed size, and the points have the same order in all records.
+ */
+class CSurfaceStreamWriter final : public CFileWriter {
+ private:
+  /*!
+   * \brief Points and elements of a marker owned by this rank.
+   */
+  struct StreamMarker {
+    string tag;                    /*!< \brief Name of the marker. */
+    vector<unsigned long> points;  /*!< \brief Local indices of the points. */
+    vector<int64_t> elements;      /*!< \brief Element records (type and nodes). */
+    unsigned long pointOffset = 0; /*!< \brief Position of the first local point within the marker. */
+    unsigned long elemOffset = 0;  /*!< \brief Position of the first local element within the marker. */
+    unsigned long nPointGlobal = 0;/*!< \brief Number of points of the marker. */
+    unsigned long nElemGlobal = 0; /*!< \brief Number of elements of the marker. */
+  };
+
+  static constexpr unsigned short NodesPerElem = 4; /*!< \brief Nodes per element record (quadrilaterals). */
+
+  vector<StreamMarker> markers;          /*!< \brief The markers of the stream. */
+  vector<unsigned short> fieldIndex;     /*!< \brief Index of the fields in the data sorter. */
+  vector<passivedouble> buffer;          /*!< \brief Values of one marker before writing. */
+  unsigned long nRecord = 0;             /*!< \brief Number of records written. */
+
+ public:
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Create the stream, and write its header and geometry (collective).
+   * \param[in] valDataSorter - The volume data sorter, the unsorted data of the local points is used.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] valFields - Names of the fields in the stream.
+   * \param[in] val_filename - Name of the file without extension.
+   */
+  CSurfaceStreamWriter(CParallelDataSorter* valDataSorter, const CConfig* config, const CGeometry* geometry,
+                       const vector<string>& valFields, const string& val_filename);
+
+  /*!
+   * \brief Close the file.
+   */
+  ~CSurfaceStreamWriter() override;
+
+  /*!
+   * \brief Append the current values to the stream (collective).
+   * \param[in] iter - Time (or outer) iteration.
+   * \param[in] time - Physical time.
+   */
+  void WriteStep(unsigned long iter, su2double time);
+
+  /*!
+   * \brief Get the number of records written.
+   */
+  unsigned long GetnRecord() const { return nRecord; }
+};
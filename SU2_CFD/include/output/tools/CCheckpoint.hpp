@@ -0,0 +1,103 @@
+/*!
+ * \file CCheckpoint.hpp
+ * \brief Headers of the node-local (buddy) checkpoints of unsteady simulations.
+ *        The subroutines and functions are in the <i>CCheckpoint.cpp</i> file.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "../../../../Common/include/code_config.hpp"
+
+class CConfig;
+class CGeometry;
+class CSolver;
+
+/*!
+ * \class CCheckpoint
+ * \brief Checkpoints of the solution of each rank, kept in memory and written to a node-local directory, together
+ *        with a copy of the checkpoint of another rank (the ward) on a different compute node (the buddy rank keeps
+ *        the copy of this rank). This is much faster than writing restart files to a parallel file system.
+ * \details A restart reads the file of each rank, the state of ranks whose files were lost with their node is sent
+ *          by the rank that holds the copy. The data has the layout of the restart files of the flow solvers, it is
+ *          read by the regular restart routines from memory (same number of ranks and partitioning are required).
+ */
+class CCheckpoint {
+ public:
+  /*!
+   * \brief Constructor of the class, determines the buddy and the wards of this rank (collective).
+   * \param[in] config - Definition of the particular problem.
+   */
+  explicit CCheckpoint(const CConfig* config);
+
+  /*!
+   * \brief Save the state after a time iteration, and exchange it with the buddy rank (collective).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Solvers of the finest grid.
+   * \param[in] timeIter - Current time iteration (completed).
+   */
+  void Save(const CConfig* config, const CGeometry* geometry, CSolver* const* solver, unsigned long timeIter);
+
+  /*!
+   * \brief Recover the checkpoint of this rank (own file or from the holder of the copy) and set the restart
+   *        iteration, this must be done before the output is set up (collective).
+   * \param[in,out] config - Definition of the particular problem.
+   */
+  static void Recover(CConfig* config);
+
+  /*!
+   * \brief Check the recovered checkpoint against the partition and keep it as in-memory restarts.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  static void SetRestarts(const CConfig* config, const CGeometry* geometry);
+
+  /*!
+   * \brief Data of the domain points in the layout of the restart files (coordinates, then the flow, turbulence,
+   *        and species variables) in the order of GetDomainPoints_GlobalOrder.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Solvers of the finest grid.
+   * \param[in] previous - Use the solution of the previous time step (time n-1) instead of the current.
+   * \return The data, its size is the number of fields (without the point ID) times the number of domain points.
+   */
+  static std::vector<passivedouble> GetRestartData(const CConfig* config, const CGeometry* geometry,
+                                                   CSolver* const* solver, bool previous = false);
+
+ private:
+  int rank, size;
+  int buddy;               /*!< \brief Rank that keeps the copy of the checkpoint of this rank. */
+  std::vector<int> wards;  /*!< \brief Ranks whose checkpoint copies are kept by this rank. */
+  std::vector<char> own;   /*!< \brief Checkpoint of this rank. */
+  std::map<int, std::vector<char> > copies;  /*!< \brief Checkpoints of the wards. */
+
+  static std::vector<char> recovered;  /*!< \brief Checkpoint recovered on restart, until it is set as restart. */
+
+  static std::string FileName(const CConfig* config, int owner, bool copy);
+  static void WriteFile(const std::string& fileName, const std::vector<char>& data);
+  static bool ReadFile(const std::string& fileName, std::vector<char>& data);
+};
@@ -0,0 +1,90 @@
+/*!
+ * \file CCompiledExpression.hpp
+ * \brief Header of the linear (bytecode) form of the custom output expressions.
+ *        The subroutines and functions are in the <i>CCompiledExpression.cpp</i> file.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../../../../Common/include/code_config.hpp"
+
+/*!
+ * \class CCompiledExpression
+ * \brief Custom output expression compiled once into a linear list of instructions, which is evaluated for blocks
+ *        of points (each instruction is a simple loop over the block instead of a tree traversal per point).
+ * \details Supports numbers, symbols, + - * / ^, parentheses, and the functions sqrt, exp, log, log10, sin, cos, tan,
+ *          asin, acos, atan, sinh, cosh, tanh, abs, pow, min, max. Compile returns false for anything else, in
+ *          which case the expression tree (interpreter) must be used.
+ */
+class CCompiledExpression {
+ public:
+  static constexpr unsigned long BLOCK_SIZE = 64; /*!< \brief Maximum number of points evaluated together. */
+
+  /*!
+   * \brief Compile an expression.
+   * \param[in] expression - The expression.
+   * \param[in] symbols - Symbols of the expression, the index in this list is the row of the inputs of Eval.
+   * \return False if the expression is not supported.
+   */
+  bool Compile(const std::string& expression, const std::vector<std::string>& symbols);
+
+  /*!
+   * \brief Whether the expression was compiled.
+   */
+  bool Ready() const { return !code.empty(); }
+
+  /*!
+   * \brief Size of the work array required by Eval.
+   */
+  unsigned long GetWorkSize() const { return code.size() * BLOCK_SIZE; }
+
+  /*!
+   * \brief Evaluate the expression for a block of points.
+   * \param[in] nPoints - Number of points in the block (at most BLOCK_SIZE).
+   * \param[in] inputs - Values of the symbols, inputs[iSymbol * BLOCK_SIZE + i] for the i-th point.
+   * \param[in] work - Work array of size GetWorkSize().
+   * \return Pointer to the nPoints results (in the work array).
+   */
+  const su2double* Eval(unsigned long nPoints, const su2double* inputs, su2double* work) const;
+
+ private:
+  enum class OpCode : unsigned char {
+    CONSTANT, SYMBOL, NEG, ADD, SUB, MUL, DIV, POW, MIN, MAX,
+    SQRT, EXP, LOG, LOG10, SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH, ABS
+  };
+
+  /*--- Each instruction writes a new slot of the work array, its operands are previous slots (or
+   * the symbol index). ---*/
+  struct Instruction {
+    OpCode op;
+    unsigned long a, b;
+    passivedouble value;
+  };
+  std::vector<Instruction> code;
+
+  /*--- Recursive descent parser state. ---*/
+  struct Parser;
+};
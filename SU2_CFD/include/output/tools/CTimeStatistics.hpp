@@ -0,0 +1,182 @@
+/*!
+ * \file CTimeStatistics.hpp
+ * \brief Headers of the running (streaming) statistics and spectra of unsteady simulations.
+ *        The subroutines and functions are in the <i>CTimeStatistics.cpp</i> file.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "../../../../Common/include/code_config.hpp"
+
+class CGeometry;
+
+/*!
+ * \class CTimeStatistics
+ * \brief Running statistics of point variables: the mean, the co-variances of all pairs of variables (e.g. the
+ *        Reynolds stresses), and the third and fourth central moments of each variable (skewness and flatness).
+ * \details The moments are updated with the one-pass formulas of Welford and Pebay, which are accurate without
+ *          storing the samples. The central moments can be stored in single precision (the update of each point is
+ *          computed in double precision), the means are always stored in double precision since their increments
+ *          become very small. The state can be written and read with any partitioning of the mesh.
+ */
+class CTimeStatistics {
+ public:
+  static constexpr unsigned short MAX_VARS = 16; /*!< \brief Maximum number of variables. */
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nPoint - Number of points (local).
+   * \param[in] nVar - Number of variables of each point.
+   * \param[in] singlePrecision - Store the moments in single precision.
+   */
+  CTimeStatistics(unsigned long nPoint, unsigned short nVar, bool singlePrecision);
+
+  /*!
+   * \brief Add a sample of the variables of a point, Advance must be called after all points are updated.
+   * \note Thread-safe for different points.
+   * \param[in] iPoint - Point index.
+   * \param[in] values - Values of the variables.
+   */
+  void Update(unsigned long iPoint, const passivedouble* values);
+
+  /*!
+   * \brief Finish the update of all points with one sample.
+   */
+  void Advance() { ++nSamples; }
+
+  /*!
+   * \brief Get the number of samples.
+   */
+  unsigned long GetnSamples() const { return nSamples; }
+
+  /*!
+   * \brief Get the mean of a variable.
+   */
+  passivedouble GetMean(unsigned long iPoint, unsigned short iVar) const { return means[iPoint * nVar + iVar]; }
+
+  /*!
+   * \brief Get the co-variance of two variables, e.g. u'v'.
+   */
+  passivedouble GetCovariance(unsigned long iPoint, unsigned short iVar, unsigned short jVar) const;
+
+  /*!
+   * \brief Get the skewness (normalized third central moment) of a variable.
+   */
+  passivedouble GetSkewness(unsigned long iPoint, unsigned short iVar) const;
+
+  /*!
+   * \brief Get the flatness (normalized fourth central moment, kurtosis) of a variable.
+   */
+  passivedouble GetFlatness(unsigned long iPoint, unsigned short iVar) const;
+
+  /*!
+   * \brief Write the state of the statistics of the domain points (in global order) to a binary file.
+   * \param[in] fileName - Name of the file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] extra - Additional (global) data written by the master rank.
+   */
+  void Write(const std::string& fileName, const CGeometry* geometry, const std::vector<passivedouble>& extra) const;
+
+  /*!
+   * \brief Read the state of the statistics from a binary file.
+   * \param[in] fileName - Name of the file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[out] extra - Additional (global) data.
+   * \return False if the file does not exist.
+   */
+  bool Read(const std::string& fileName, const CGeometry* geometry, std::vector<passivedouble>& extra);
+
+ private:
+  const unsigned long nPoint;
+  const unsigned short nVar;
+  const unsigned long nMoment; /*!< \brief Per point, nVar(nVar+1)/2 co-moments, nVar M3, and nVar M4. */
+  const bool singlePrecision;
+  unsigned long nSamples = 0;
+  std::vector<passivedouble> means;
+  std::vector<float> momentsFloat;
+  std::vector<passivedouble> momentsDouble;
+
+  /*--- Position of the co-moment of iVar and jVar (iVar <= jVar), and of the third and fourth moments. ---*/
+  unsigned long CoMoment(unsigned short iVar, unsigned short jVar) const {
+    return iVar * nVar - iVar * (iVar - 1) / 2 + (jVar - iVar);
+  }
+  unsigned long Moment3(unsigned short iVar) const { return nVar * (nVar + 1) / 2 + iVar; }
+  unsigned long Moment4(unsigned short iVar) const { return nVar * (nVar + 3) / 2 + iVar; }
+
+  passivedouble GetMoment(unsigned long iPoint, unsigned long iMoment) const {
+    const auto idx = iPoint * nMoment + iMoment;
+    return singlePrecision ? momentsFloat[idx] : momentsDouble[idx];
+  }
+
+  template <class T>
+  void UpdateImpl(passivedouble* mean, T* moments, const passivedouble* values) const;
+};
+
+/*!
+ * \class CStreamingSpectrum
+ * \brief One-sided power spectral density of a signal, averaged over consecutive Hann windows (Welch method without
+ *        overlap). Only the samples of the current window are stored, each full window is transformed with a FFT.
+ */
+class CStreamingSpectrum {
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] windowSize - Number of samples of each window (power of 2).
+   */
+  explicit CStreamingSpectrum(unsigned long windowSize);
+
+  /*!
+   * \brief Add a sample of the signal.
+   */
+  void AddSample(passivedouble value);
+
+  /*!
+   * \brief Get the number of complete windows.
+   */
+  unsigned long GetnWindows() const { return nWindows; }
+
+  /*!
+   * \brief Get the power spectral density of the frequencies k / (windowSize * timeStep), k = 0, ..., windowSize/2.
+   * \param[in] timeStep - Time between samples.
+   */
+  std::vector<passivedouble> GetPSD(passivedouble timeStep) const;
+
+  /*!
+   * \brief Append the state (window samples and sums) to a vector.
+   */
+  void Pack(std::vector<passivedouble>& state) const;
+
+  /*!
+   * \brief Set the state from the data written by Pack, the pointer is advanced past the data.
+   */
+  void Unpack(const passivedouble*& state);
+
+ private:
+  unsigned long windowSize;
+  std::vector<passivedouble> samples;
+  std::vector<passivedouble> psdSum;
+  unsigned long nWindows = 0;
+};
@@ -56,6 +56,8 @@ protected:
   vector<su2double> Exhaust_Area;        /*!< \brief Boundary total area. */
   vector<su2double> Exhaust_Pressure;    /*!< \brief Fan face pressure for each boundary. */
   vector<su2double> Exhaust_Temperature; /*!< \brief Fan face mach number for each boundary. */
+  vector<su2double> BatchDensity;        /*!< \brief Density of all points, for batch fluid models. */
+  vector<su2double> BatchEnergy;         /*!< \brief Static energy of all points, for batch fluid models. */
   su2double
   Inflow_MassFlow_Total = 0.0,   /*!< \brief Mass flow rate for each boundary. */
   Exhaust_MassFlow_Total = 0.0,  /*!< \brief Mass flow rate for each boundary. */
@@ -83,6 +85,8 @@ protected:
   vector<vector<su2double> > ActDisk_Fx_BEM; /*!< \brief Value of the actuator disk X component of the radial and tangential forces per Unit Area resultant. */
   vector<vector<su2double> > ActDisk_Fy_BEM; /*!< \brief Value of the actuator disk Y component of the radial and tangential forces per Unit Area resultant. */
   vector<vector<su2double> > ActDisk_Fz_BEM; /*!< \brief Value of the actuator disk Z component of the radial and tangential forces per Unit Area resultant. */
+  vector<unsigned long> ActDiskBF_Point; /*!< \brief Domain points inside the body force actuator disks. */
+  su2activematrix ActDiskBF_Force;       /*!< \brief Body force at those points, integrated over the control volume. */
 
   su2double
   Total_CL_Prev = 0.0,        /*!< \brief Total lift coefficient for all the boundaries (fixed lift mode). */
@@ -139,6 +143,7 @@ protected:
   su2activematrix ExtAverageKine;
   su2activematrix ExtAverageOmega;
   su2activevector AverageMassFlowRate;
+  su2activematrix TurboAverageTotals;   /*!< \brief Pitch-wise sums of each span (rows) used by TurboAverageProcess. */
 
   su2activematrix DensityIn;
   su2activematrix PressureIn;
@@ -153,6 +158,12 @@ protected:
   su2activematrix OmegaOut;
   su2activematrix NuOut;
 
+  static constexpr unsigned short nTurboPerfVar = 8; /*!< \brief Averages per marker and span in the reduction. */
+  vector<su2double> TurboPerfSendBuf;   /*!< \brief Local in/outflow averages of all markers and spans. */
+  vector<su2double> TurboPerfRecvBuf;   /*!< \brief Reduced in/outflow averages of all markers and spans. */
+  SU2_MPI::Request TurboPerfRequest;    /*!< \brief Request of the non-blocking reduction of the averages. */
+  bool TurboPerfPending = false;        /*!< \brief The reduction of the averages was started but not completed. */
+
   vector<su2matrix<complex<su2double> > > CkInflow, CkOutflow1, CkOutflow2;
 
   /*--- End of Turbomachinery Solver Variables ---*/
@@ -225,6 +236,16 @@ protected:
   void ReadActDisk_InputFile(CGeometry *geometry, CSolver **solver_container,
                            CConfig *config, unsigned short iMesh, bool Output);
 
+  /*!
+   * \brief Find the points inside the body force actuator disks (ACTDISK_BODY_FORCE) and compute their (constant)
+   *        force from the radial load distributions of the actuator disk input file.
+   * \note This is done once, the source term then only adds the stored forces (see Source_Residual).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - current mesh level for the multigrid.
+   */
+  void SetActDisk_BodyForce(const CGeometry *geometry, const CConfig *config, unsigned short iMesh);
+
   /*!
    * \author: Chandukrishna Y., T. N. Venkatesh and Josy P. Pullockara
    * \brief Read and update the variable load actuator disk from input file for the BLADE_ELEMENT type.
@@ -316,6 +337,16 @@ public:
    */
   ~CEulerSolver(void) override;
 
+  /*!
+   * \brief Update the Mach number, energy, and reference values of the freestream (the velocity is shared with
+   *        the config, which must be updated before).
+   */
+  inline void UpdateFreestreamMach(const CConfig* config) final {
+    Mach_Inf = config->GetMach();
+    Energy_Inf = config->GetEnergy_FreeStreamND();
+    SetReferenceValues(*config);
+  }
+
   /*!
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
@@ -1084,6 +1115,7 @@ public:
 
   /*!
    * \brief It computes average quantities along the span for turbomachinery analysis.
+   * \note Must be called by all threads of a parallel region (the spans are shared among them).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
@@ -1110,12 +1142,19 @@ public:
                          su2double& density_mix);
 
   /*!
-   * \brief It gathers into the master node average quantities at inflow and outflow needed for turbomachinery analysis.
+   * \brief It starts gathering on all ranks the average quantities at inflow and outflow needed for turbomachinery
+   *        analysis, the values are available after CompleteInOutAverageValues.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    */
   void GatherInOutAverageValues(CConfig *config, CGeometry *geometry) final;
 
+  /*!
+   * \brief Complete the gathering started by GatherInOutAverageValues (if any).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteInOutAverageValues(const CConfig *config) final;
+
   /*!
    * \brief it take a velocity in the cartesian reference of framework and transform into the turbomachinery frame of reference.
    * \param[in] cartesianVelocity - cartesian components of velocity vector.
@@ -28,6 +28,8 @@
 #pragma once
 
 #include "CFEASolverBase.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquaresQR.hpp"
+#include "../numerics_simd/elasticity/linear_simplex.hpp"
 
 /*!
  * \class CFEASolver
@@ -55,6 +57,10 @@ protected:
   su2double WAitken_Dyn;            /*!< \brief Aitken's dynamic coefficient. */
   su2double WAitken_Dyn_tn1;        /*!< \brief Aitken's dynamic coefficient in the previous iteration. */
 
+  CQuasiNewtonInvLeastSquaresQR<passivedouble> InterfaceQN; /*!< \brief Quasi-Newton accelerator of the FSI interface. */
+  vector<unsigned long> InterfacePoints;  /*!< \brief Points of the FSI interface (domain points first). */
+  bool InterfaceQN_Ready = false;         /*!< \brief Whether the interface quasi-Newton was allocated. */
+
   su2double PenaltyValue;           /*!< \brief Penalty value to maintain total stiffness constant. */
 
   su2double Total_OFRefGeom;        /*!< \brief Total Objective Function: Reference Geometry. */
@@ -97,6 +103,7 @@ protected:
 
   bool element_based;          /*!< \brief Bool to determine if an element-based file is used. */
   bool topol_filter_applied;   /*!< \brief True if density filtering has been performed. */
+  CElementFilterCache topol_filter_cache; /*!< \brief Neighbourhoods and weights of the density filter. */
   bool initial_calc = true;    /*!< \brief Becomes false after first call to Preprocessing. */
 
   /*!
@@ -128,6 +135,106 @@ protected:
     }
   }
 
+#ifndef CODI_REVERSE_TYPE
+  static constexpr bool SimplexKernels = true;  /*!< \brief Use the vectorized kernels for linear simplices. */
+#else
+  static constexpr bool SimplexKernels = false; /*--- The scalar kernels are preaccumulated. ---*/
+#endif
+
+  /*!
+   * \brief Loop over the elements of one color (must be called by all threads). The linear simplices
+   *        (linear elastic kernels) are collected in batches of SIMD size, the other elements are
+   *        treated one at a time. The chunks of the loop are the same as for the scalar loops.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] color - Elements of the color.
+   * \param[in] simplexBatch - Functor called with the indices and number (<= Double::Size) of simplices.
+   * \param[in] singleElement - Functor called with the index of any other element.
+   */
+  template<class Color, class SimplexBatch, class SingleElement>
+  void ElementColorLoop(const CGeometry* geometry, const Color& color, const SimplexBatch& simplexBatch,
+                        const SingleElement& singleElement) const {
+#ifdef HAVE_OMP
+    const unsigned long chunkSize = nextMultiple(OMP_MIN_SIZE, color.groupSize);
+#else
+    const unsigned long chunkSize = max<unsigned long>(color.size, 1);
+#endif
+    const auto nChunk = roundUpDiv(color.size, chunkSize);
+    const unsigned short simplexType = (nDim == 2) ? TRIANGLE : TETRAHEDRON;
+
+    SU2_OMP_FOR_DYN(1)
+    for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+      unsigned long batch[Double::Size];
+      unsigned short nLanes = 0;
+
+      const auto end = min<unsigned long>(color.size, (iChunk+1)*chunkSize);
+      for (auto k = iChunk*chunkSize; k < end; ++k) {
+        const unsigned long iElem = color.indices[k];
+
+        if (SimplexKernels && (geometry->elem[iElem]->GetVTK_Type() == simplexType)) {
+          batch[nLanes++] = iElem;
+          if (nLanes == Double::Size) {
+            simplexBatch(batch, nLanes);
+            nLanes = 0;
+          }
+        }
+        else singleElement(iElem);
+      }
+      if (nLanes) simplexBatch(batch, nLanes);
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Gather the data of a batch of linear simplices, unused lanes repeat the first element.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread), provide the material.
+   * \param[in] config - Definition of the problem.
+   * \param[in] batch - Indices of the elements.
+   * \param[in] nLanes - Number of elements.
+   * \param[out] indexNode - Nodes of the elements, per lane.
+   * \param[out] coord - Reference coordinates.
+   * \param[out] lambda - First Lame parameter.
+   * \param[out] mu - Second Lame parameter.
+   */
+  template<size_t NDIM>
+  void GatherSimplices(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                       const unsigned long* batch, unsigned short nLanes,
+                       unsigned long indexNode[][NDIM+1], MatrixDbl<NDIM+1,NDIM>& coord,
+                       Double& lambda, Double& mu) const {
+    const int thread = omp_get_thread_num();
+    const int EL_KIND = (NDIM == 2) ? EL_TRIA : EL_TETRA;
+    CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+    for (auto iLane = 0ul; iLane < Double::Size; ++iLane) {
+      const auto iElem = batch[iLane < nLanes ? iLane : 0];
+
+      for (auto iNode = 0ul; iNode <= NDIM; ++iNode) {
+        indexNode[iLane][iNode] = geometry->elem[iElem]->GetNode(iNode);
+        for (auto iDim = 0ul; iDim < NDIM; ++iDim)
+          coord(iNode,iDim)[iLane] = Get_ValCoord(geometry, indexNode[iLane][iNode], iDim);
+      }
+
+      element->Set_ElProperties(element_properties[iElem]);
+      su2double lambda_i, mu_i;
+      numerics[thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod()]->
+        Get_LameParameters(element, config, lambda_i, mu_i);
+      lambda[iLane] = lambda_i;
+      mu[iLane] = mu_i;
+    }
+  }
+
+  /*!
+   * \brief Residual and stiffness matrix contributions of a batch of linear simplices.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread), provide the material.
+   * \param[in] config - Definition of the problem.
+   * \param[in] batch - Indices of the elements.
+   * \param[in] nLanes - Number of elements.
+   */
+  template<size_t NDIM>
+  void StiffMatrixSimplices(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                            const unsigned long* batch, unsigned short nLanes);
+
   /*!
    * \brief Actions required to initialize the supporting variables for hybrid parallel execution.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -214,6 +321,25 @@ protected:
    */
   void Compute_OFCompliance(CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Eliminate the equations of a node with known solution from the linear system.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] val_sol - Known solution at the node.
+   */
+  inline virtual void EnforceSolutionAtNode(unsigned long iPoint, const su2double* val_sol) {
+    Jacobian.EnforceSolutionAtNode(iPoint, val_sol, LinSysRes);
+  }
+
+  /*!
+   * \brief Eliminate one equation of a node with known solution from the linear system.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] iVar - Index of the variable.
+   * \param[in] val_sol - Known solution of the variable.
+   */
+  inline virtual void EnforceSolutionAtDOF(unsigned long iPoint, unsigned short iVar, su2double val_sol) {
+    Jacobian.EnforceSolutionAtDOF(iPoint, iVar, val_sol, LinSysRes);
+  }
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -658,6 +784,14 @@ public:
    */
   void SetAitken_Relaxation(CGeometry *geometry, const CConfig *config) final;
 
+  /*!
+   * \brief Interface quasi-Newton (IQN-ILS) update of the predicted displacements of the FSI interface.
+   * \note The fixed-point input is the old predicted solution, and its result the calculated solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetInterface_QuasiNewton(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Compute the penalty due to the stiffness increase
    * \param[in] geometry - Geometrical definition of the problem.
@@ -750,6 +884,7 @@ public:
 
   /*!
    * \brief Filter the density field for topology optimization applications
+   * \note The filter is built on the first call and reused by subsequent calls (e.g. adjoint recordings).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -29,6 +29,8 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -146,6 +148,11 @@ protected:
                                                                         between local elements. Cumulative storage. */
 
   CInternalFaceElementFEM *matchingInternalFaces;    /*!< \brief Array of the local matching internal faces. */
+
+  vector<unsigned long> elemNeighborPtr; /*!< \brief Pointers into elemNeighbors for the local elements. */
+  vector<unsigned long> elemNeighbors;   /*!< \brief Elements that share a matching face with each local element. */
+  vector<char> shockSensorBuffer;        /*!< \brief Elements for which the full shock sensor is evaluated (troubled
+                                                     elements of the previous evaluation and their neighbors). */
   CBoundaryFEM *boundaries;                          /*!< \brief Array of the boundaries of the FEM mesh. */
 
   unsigned short nStandardBoundaryFacesSol; /*!< \brief Number of standard boundary faces used for solution of the DG solver. */
@@ -170,12 +177,24 @@ protected:
 
   unsigned int sizeWorkArray;     /*!< \brief The size of the work array needed. */
 
+  vector<su2double> workTimeLevels; /*!< \brief Measured compute time per time level since the last load
+                                                 balance report of ADER-DG. */
+  su2double waitTimeComm = 0.0;     /*!< \brief Measured time spent in completing communication since the
+                                                 last load balance report of ADER-DG. */
+  vector<su2double> timeTaskTypes;  /*!< \brief Measured time per type of task since the last load balance
+                                                 report of ADER-DG. */
+  unsigned long nStepsLoadBalance = 0; /*!< \brief Number of ADER-DG steps since the last load balance report. */
+
   vector<su2double> TolSolADER;   /*!< \brief Vector, which stores the tolerances for the conserved
                                               variables in the ADER predictor step. */
 
   vector<su2double> VecSolDOFs;    /*!< \brief Vector, which stores the solution variables in the owned DOFs. */
   vector<su2double> VecSolDOFsNew; /*!< \brief Vector, which stores the new solution variables in the owned DOFs (needed for classical RK4 scheme). */
   vector<su2double> VecDeltaTime;  /*!< \brief Vector, which stores the time steps of the owned volume elements. */
+  vector<su2double> VecSolDOFsTimeN1;   /*!< \brief Vector, which stores the solution of the previous time step in
+                                                   the owned DOFs (needed for BDF2 of the implicit scheme). */
+  vector<su2double> VecDeltaTimeTimeN1; /*!< \brief Vector, which stores the time steps of the owned volume elements
+                                                   in the previous time step (needed for BDF2). */
 
   vector<su2double> VecSolDOFsPredictorADER; /*!< \brief Vector, which stores the ADER predictor solution in the owned
                                                          DOFs. These are both space and time DOFs. */
@@ -231,6 +250,60 @@ protected:
 
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
+  vector<su2double> VecSolDOFsJFNK;   /*!< \brief Vector, which stores the Newton iterate of the implicit scheme
+                                                 in the owned DOFs. */
+  vector<su2double> VecResDOFsJFNK;   /*!< \brief Vector, which stores the spatial residual of the Newton iterate
+                                                 in the owned DOFs. */
+  vector<su2double> TimeCoefJFNK;     /*!< \brief Coefficient of the new solution in the time derivative, divided
+                                                 by the time step, for the owned volume elements. */
+  su2double EpsNumeratorJFNK = 0.0;   /*!< \brief Numerator of the finite difference step of the
+                                                 Jacobian-vector products. */
+
+  vector<su2activematrix> InvBlocksJFNK;      /*!< \brief Inverse of the diagonal element blocks of the Newton
+                                                         matrix of the owned volume elements. */
+  vector<vector<unsigned long> > elemPerColorJFNK; /*!< \brief Owned volume elements per color, face neighbors
+                                                              never have the same color. */
+  unsigned long ageBlocksJFNK = 0;            /*!< \brief Number of time steps since the blocks were built. */
+  su2double timeCoefBlocksJFNK = 0.0;         /*!< \brief Time coefficient with which the blocks were built. */
+
+#ifndef CODI_REVERSE_TYPE
+  CSysSolve<su2double> SystemJFNK;  /*!< \brief Matrix-free Krylov solver of the implicit scheme. */
+#endif
+
+  /*!
+   * \brief Jacobian-free product with the Newton matrix of the implicit scheme.
+   */
+  class JFNK_Product final : public CMatrixVectorProduct<su2double> {
+  public:
+    CFEM_DG_EulerSolver* const solver;
+    CGeometry* const geometry;
+    CSolver** const solver_container;
+    CNumerics** const numerics;
+    CConfig* const config;
+    const unsigned short iMesh;
+
+    JFNK_Product(CFEM_DG_EulerSolver* s, CGeometry* g, CSolver** sc, CNumerics** n, CConfig* c, unsigned short m) :
+      solver(s), geometry(g), solver_container(sc), numerics(n), config(c), iMesh(m) {}
+
+    inline void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+      solver->JacobianProductJFNK(u, v, geometry, solver_container, numerics, config, iMesh);
+    }
+  };
+
+  /*!
+   * \brief Element block Jacobi preconditioner of the implicit scheme.
+   */
+  class JFNK_BlockJacobi final : public CPreconditioner<su2double> {
+  public:
+    const CFEM_DG_EulerSolver* const solver;
+
+    JFNK_BlockJacobi(const CFEM_DG_EulerSolver* s) : solver(s) {}
+
+    inline void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+      solver->ApplyBlockJacobiJFNK(u, v);
+    }
+  };
+
 private:
 
 #ifdef HAVE_MPI
@@ -463,6 +536,23 @@ public:
                                  unsigned short iMesh,
                                  unsigned short RunTime_EqSystem) final;
 
+  /*!
+   * \brief Function, to carry out one time step of the implicit scheme with a Jacobian-free
+            Newton-Krylov method. BDF2 is used for time accurate simulations (BDF1 in the first
+            time step) and the backward Euler method with local time steps for steady problems.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void JFNK_SpaceTimeIntegration(CGeometry      *geometry,
+                                 CSolver        **solver_container,
+                                 CNumerics      **numerics,
+                                 CConfig        *config,
+                                 unsigned short iMesh,
+                                 unsigned short RunTime_EqSystem) final;
+
   /*!
    * \brief Function, which controls the computation of the spatial Jacobian.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -478,6 +568,14 @@ public:
                               unsigned short iMesh,
                               unsigned short RunTime_EqSystem) final;
 
+  /*!
+   * \brief Function, which reports the load imbalance of ADER-DG from the measured compute
+            time per time level and writes the measured work per time level, relative to the
+            a priori estimate of the partitioning, to the work weights file.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MonitorLoadBalance(CConfig *config);
+
   /*!
    * \brief Function, which determines the values of the tolerances in
             the predictor step of ADER-DG.
@@ -537,6 +635,12 @@ public:
                                   const unsigned long elemEnd,
                                   su2double           *workArray);
 
+  /*!
+   * \brief Flag the elements that were troubled in the previous evaluation of the shock
+            sensor, and their neighbors, for which the cheap first pass of the sensor is skipped.
+   */
+  void UpdateShockSensorBuffer();
+
   /*!
    * \brief Compute the volume contributions to the spatial residual. It is a virtual
             function, because this function is overruled for Navier-Stokes.
@@ -1539,6 +1643,72 @@ private:
                                                       su2double            *res,
                                                       su2double            *work);
 
+  /*!
+   * \brief Function, which computes the spatial residual of the Newton iterate of the implicit scheme,
+            which is stored in VecResDOFs on exit.
+   * \param[in] sol - Solution of the owned DOFs, in the layout of VecSolDOFs.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void SpatialResidualJFNK(const su2double *sol,
+                           CGeometry       *geometry,
+                           CSolver         **solver_container,
+                           CNumerics       **numerics,
+                           CConfig         *config,
+                           unsigned short  iMesh);
+
+  /*!
+   * \brief Function, which carries out a distance-1 coloring of the owned volume elements
+            for the finite difference computation of the diagonal element blocks.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ColorElementsJFNK(CConfig *config);
+
+  /*!
+   * \brief Function, which computes the inverse of the diagonal element blocks of the Newton
+            matrix with finite differences. VecSolDOFsJFNK and VecResDOFsJFNK must be set.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void BuildBlockJacobiJFNK(CGeometry      *geometry,
+                            CSolver        **solver_container,
+                            CNumerics      **numerics,
+                            CConfig        *config,
+                            unsigned short iMesh);
+
+  /*!
+   * \brief Function, which computes the product of the Newton matrix with a vector, by
+            finite differences of the spatial residual around VecSolDOFsJFNK.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void JacobianProductJFNK(const CSysVector<su2double> &u,
+                           CSysVector<su2double>       &v,
+                           CGeometry                   *geometry,
+                           CSolver                     **solver_container,
+                           CNumerics                   **numerics,
+                           CConfig                     *config,
+                           unsigned short              iMesh);
+
+  /*!
+   * \brief Function, which applies the element block Jacobi preconditioner of the implicit scheme.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   */
+  void ApplyBlockJacobiJFNK(const CSysVector<su2double> &u,
+                            CSysVector<su2double>       &v) const;
+
   /*!
    * \brief Function, which computes the graph of the spatial discretization
             for the locally owned DOFs.
@@ -1564,6 +1734,45 @@ private:
    */
   void SetUpTaskList(CConfig *config);
 
+  /*!
+   * \brief Function, which carries out the given task of the list of tasks.
+   * \param[in]  iTask     - Index of the task in tasksList.
+   * \param[in]  numerics  - Description of the numerical method.
+   * \param[in]  config    - Definition of the particular problem.
+   * \param[in]  waitComm  - Whether or not the completion of a communication
+                             must wait for the outstanding requests.
+   * \param[out] workArray - Work array.
+   * \return Whether or not the task has been carried out. Only the completion of
+             a communication, for which waitComm is false, may not be carried out.
+   */
+  bool CarryOutTask_DG(const unsigned long iTask,
+                       CNumerics           **numerics,
+                       CConfig             *config,
+                       const bool          waitComm,
+                       su2double           *workArray);
+
+  /*!
+   * \brief Function, which processes the list of tasks with a pool of OpenMP threads.
+            A task is executed as soon as the tasks it depends on are completed. The
+            communication is carried out by the master thread only (MPI is initialized
+            as MPI_THREAD_FUNNELED), the other threads carry out the computations.
+   * \param[in] numerics    - Description of the numerical method.
+   * \param[in] config      - Definition of the particular problem.
+   * \param[in] measureWork - Whether or not the time of the tasks must be measured.
+   */
+  void ProcessTaskListThreads_DG(CNumerics  **numerics,
+                                 CConfig    *config,
+                                 const bool measureWork);
+
+  /*!
+   * \brief Function, which accumulates the measured time of a task for the
+            load balance monitoring.
+   * \param[in] iTask   - Index of the task in tasksList.
+   * \param[in] elapsed - Elapsed time of the task.
+   */
+  void AccumulateTaskTime_DG(const unsigned long iTask,
+                             const su2double     elapsed);
+
   /*!
    * \brief Function, which sets up the persistent communication of the flow
             variables in the DOFs.
@@ -133,7 +133,9 @@ public:
                           su2double           *workArray) override;
 
   /*!
-   * \brief Per-Olof Persson's method for capturing shock in DG
+   * \brief Per-Olof Persson's method for capturing shock in DG. The Mach number based sensor is only
+   *        evaluated for the elements flagged by a cheap first pass (modal decay of the density), and
+   *        for the troubled elements of the previous evaluation and their neighbors.
    * \param[in]  elemBeg   - Begin index of the element range to be computed.
    * \param[in]  elemEnd   - End index (not included) of the element range to be computed.
    * \param[out] workArray - Work array.
@@ -818,7 +820,7 @@ private:
                                    const su2double      halfTheta,
                                    const su2double      *symmFluxes,
                                    const su2double      *weights,
-                                   const su2double      *metricCoorFace,
+                                   const su2metricfloat *metricCoorFace,
                                          su2double      *paramFluxes);
 
   /*!
@@ -854,7 +856,7 @@ private:
                              const bool              HeatFlux_Prescribed,
                              const su2double         *solInt,
                              const su2double         *gradSolInt,
-                             const su2double         *metricCoorDerivFace,
+                             const su2metricfloat    *metricCoorDerivFace,
                              const su2double         *metricNormalsFace,
                              const su2double         *wallDistanceInt,
                                    su2double         *viscNormFluxes,
@@ -27,6 +27,8 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
+#include "../../../Common/include/toolboxes/CWallLawTable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "CSolver.hpp"
 
@@ -83,6 +85,7 @@ class CFVMFlowSolverBase : public CSolver {
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
   unsigned long ErrorCounter = 0;    /*!< \brief Counter for number of un-physical states. */
+  unsigned long TransportCacheHits = 0; /*!< \brief Counter for points that reused their transport properties. */
 
   /*!
    * \brief Auxilary types to store common aero coefficients (avoids repeating oneself so much).
@@ -181,10 +184,22 @@ class CFVMFlowSolverBase : public CSolver {
   vector<vector<su2double> > YPlus;             /*!< \brief Yplus for each boundary and vertex. */
   vector<vector<su2double> > UTau;                 /*!< \brief UTau for each boundary and vertex. */
   vector<vector<su2double> > EddyViscWall;         /*!< \brief Eddy viscosuty at the wall for each boundary and vertex. */
+  CWallLawTable WallLawTable;                      /*!< \brief Inverse law of the wall of the wall functions. */
 
   bool space_centered;       /*!< \brief True if space centered scheme used. */
   bool euler_implicit;       /*!< \brief True if euler implicit scheme used. */
   bool least_squares;        /*!< \brief True if computing gradients by least squares. */
+  bool frozenGradients = false; /*!< \brief True if the gradients and limiters are not recomputed. */
+  CSysVector<su2double> SmoothedRes; /*!< \brief Iterate of the implicit residual smoothing. */
+  const CGeometry::CLineletInfo* Linelets = nullptr; /*!< \brief Lines of the line-implicit smoothing. */
+  su2activematrix LineCoeff; /*!< \brief Line couplings (previous, next point) and line eigenvalues (inv., visc.). */
+
+  /*--- Active set (freezing of the converged regions). ---*/
+  vector<char> FrozenPoint;               /*!< \brief Points that are not updated (halos are never frozen). */
+  vector<unsigned long> ConvergedIter;    /*!< \brief Consecutive iterations with the residual below the threshold. */
+  su2double ActiveSetRes0 = 0.0;          /*!< \brief Largest local residual norm of the first iteration. */
+  su2double ActivePointFraction = 1.0;    /*!< \brief Fraction of the domain points that are active (not frozen). */
+  unsigned long ActiveSetIter = 0;        /*!< \brief Number of iterations since the start of the active set. */
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
@@ -213,6 +228,43 @@ class CFVMFlowSolverBase : public CSolver {
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
+  CNumericsSIMD* boundaryNumerics = nullptr; /*!< \brief Object for the convective flux of weak boundary conditions. */
+
+  /*--- Overlap of the halo comms of gradients and limiters with the edge flux computation. ---*/
+
+  bool overlapComms = false;           /*!< \brief The last comms before the edge loop are completed during it. */
+  unsigned long overlapGroupSize = 0;  /*!< \brief Size of the groups of edges (color groups if coloring is used). */
+  vector<array<vector<unsigned long>, 2> > OverlapEdgeGroups; /*!< \brief Start of each group of edges of each color,
+                                                    [0] groups that do not touch halo points, [1] all others. */
+
+  /*!
+   * \brief Set up the groups of edges for the overlap of halo comms and edge flux computation.
+   */
+  void SetupOverlapEdgeGroups(const CConfig& config, const CGeometry& geometry);
+
+  /*--- Software prefetch of the data of the edges ahead in the vectorized edge loops. ---*/
+
+  unsigned long prefetchDistance = 0;  /*!< \brief Number of SIMD groups ahead, 0 if disabled. */
+  vector<vector<unsigned long> > EdgeGatherPlan; /*!< \brief End points of the edges of each color, in loop order. */
+
+  /*!
+   * \brief Set up the gather plan of the edge colors used to prefetch the point data of the edge loops.
+   */
+  void SetupEdgeGatherPlan(const CConfig& config, const CGeometry& geometry);
+
+  /*!
+   * \brief Prefetch the normals and point data of the edges [k, k+Double::Size) of a color.
+   */
+  void PrefetchEdgeData(const CGeometry& geometry, unsigned long iColor, unsigned long k, bool gradients) const;
+
+  /*!
+   * \brief If the overlap of comms is enabled, leave the comms of the next gradient or limiter computation
+   *        in flight so that they are completed during the edge loop.
+   * \param[in] defer - Set (or reset after the computation) the deferral.
+   */
+  inline void DeferGradientComms(bool defer) {
+    if (overlapComms && edgeNumerics) ompMasterAssignBarrier(deferCompleteComms, defer);
+  }
 
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
@@ -271,7 +323,7 @@ class CFVMFlowSolverBase : public CSolver {
   /*!
    * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
    */
-  void EdgeFluxResidual(const CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
@@ -294,7 +346,7 @@ class CFVMFlowSolverBase : public CSolver {
     if (ReducerStrategy) {
       SumEdgeFluxes(geometry);
       if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
-        Jacobian.SetDiagonalAsColumnSum();
+        Jacobian.SetDiagonalAsColumnSum(geometry);
       }
     }
 
@@ -388,6 +440,46 @@ class CFVMFlowSolverBase : public CSolver {
                                (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
     const su2double K_v = 0.25;
 
+    /*--- Line-implicit smoothing, the lines are built on the first call (for the mesh level of this solver). ---*/
+
+    const bool lineImplicit = config->GetLineImplicit_Smoothing();
+    if (lineImplicit) {
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+      if (Linelets == nullptr) {
+        Linelets = &geometry->GetLineletInfo(config);
+        LineCoeff.resize(nPoint, 4) = su2double(0.0);
+      }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    }
+
+    /*--- Inviscid and viscous spectral radii of an edge. ---*/
+
+    auto edgeLambdas = [&](unsigned long iPoint, unsigned long jPoint, unsigned long iEdge,
+                           su2double& edgeInv, su2double& edgeVisc) {
+      auto Normal = geometry->edges->GetNormal(iEdge);
+      auto Area2 = GeometryToolbox::SquaredNorm(nDim, Normal);
+
+      /*--- Mean Values ---*/
+
+      su2double Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
+      su2double Mean_SoundSpeed = soundSpeed(*nodes, iPoint, jPoint) * sqrt(Area2);
+
+      /*--- Adjustment for grid movement ---*/
+
+      if (dynamic_grid) {
+        const su2double *GridVel_i = geometry->nodes->GetGridVel(iPoint);
+        const su2double *GridVel_j = geometry->nodes->GetGridVel(jPoint);
+
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
+      }
+
+      /*--- Inviscid and viscous contributions ---*/
+
+      edgeInv = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      edgeVisc = viscous ? lambdaVisc(*nodes, iPoint, jPoint) * Area2 : su2double(0.0);
+    };
+
     /*--- Init thread-shared variables to compute min/max values.
      *    Critical sections are used for this instead of reduction
      *    clauses for compatibility with OpenMP 2.0 (Windows...). ---*/
@@ -411,41 +503,51 @@ class CFVMFlowSolverBase : public CSolver {
       for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh)
       {
         auto jPoint = geometry->nodes->GetPoint(iPoint,iNeigh);
-
         auto iEdge = geometry->nodes->GetEdge(iPoint,iNeigh);
-        auto Normal = geometry->edges->GetNormal(iEdge);
-        auto Area2 = GeometryToolbox::SquaredNorm(nDim, Normal);
 
-        /*--- Mean Values ---*/
+        su2double LambdaInv, LambdaVisc;
+        edgeLambdas(iPoint, jPoint, iEdge, LambdaInv, LambdaVisc);
 
-        su2double Mean_ProjVel = 0.5 * (nodes->GetProjVel(iPoint,Normal) + nodes->GetProjVel(jPoint,Normal));
-        su2double Mean_SoundSpeed = soundSpeed(*nodes, iPoint, jPoint) * sqrt(Area2);
+        nodes->AddMax_Lambda_Inv(iPoint, LambdaInv);
+        if (viscous) nodes->AddMax_Lambda_Visc(iPoint, LambdaVisc);
+      }
 
-        /*--- Adjustment for grid movement ---*/
+    }
+    END_SU2_OMP_FOR
 
-        if (dynamic_grid) {
-          const su2double *GridVel_i = geometry->nodes->GetGridVel(iPoint);
-          const su2double *GridVel_j = geometry->nodes->GetGridVel(jPoint);
+    /*--- Loop over the lines to store the coefficients of the line-implicit systems. The first point of each
+     line (on the wall) is updated explicitly, the others exclude the line edges from their time step. ---*/
 
-          for (unsigned short iDim = 0; iDim < nDim; iDim++)
-            Mean_ProjVel -= 0.5 * (GridVel_i[iDim] + GridVel_j[iDim]) * Normal[iDim];
-        }
+    if (lineImplicit) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto iLine = 0ul; iLine < Linelets->linelets.size(); ++iLine) {
+        const auto& line = Linelets->linelets[iLine];
 
-        /*--- Inviscid contribution ---*/
+        for (const auto iPoint : line)
+          for (unsigned short iCoeff = 0; iCoeff < 4; ++iCoeff) LineCoeff(iPoint, iCoeff) = 0.0;
 
-        su2double Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-        nodes->AddMax_Lambda_Inv(iPoint,Lambda);
+        for (auto k = 1ul; k < line.size(); ++k) {
+          const auto iPoint = line[k-1], jPoint = line[k];
 
-        /*--- Viscous contribution ---*/
+          su2double LambdaInv, LambdaVisc;
+          edgeLambdas(iPoint, jPoint, geometry->FindEdge(iPoint, jPoint), LambdaInv, LambdaVisc);
 
-        if (!viscous) continue;
+          /*--- The viscous radius is converted to the scaling of the inviscid one. ---*/
+          const su2double Vol = geometry->nodes->GetVolume(jPoint);
+          const su2double coeff = LambdaInv + LambdaVisc / (K_v * Vol);
 
-        Lambda = lambdaVisc(*nodes, iPoint, jPoint) * Area2;
-        nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+          if (k > 1) {
+            LineCoeff(iPoint, 1) = coeff;
+            LineCoeff(iPoint, 2) += LambdaInv;
+            LineCoeff(iPoint, 3) += LambdaVisc;
+          }
+          LineCoeff(jPoint, 0) = coeff;
+          LineCoeff(jPoint, 2) += LambdaInv;
+          LineCoeff(jPoint, 3) += LambdaVisc;
+        }
       }
-
+      END_SU2_OMP_FOR
     }
-    END_SU2_OMP_FOR
 
     /*--- Loop boundary edges ---*/
 
@@ -506,10 +608,19 @@ class CFVMFlowSolverBase : public CSolver {
         su2double Vol = geometry->nodes->GetVolume(iPoint);
 
         if (Vol != 0.0) {
-          su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
+          su2double Lambda_Inv = nodes->GetMax_Lambda_Inv(iPoint);
+          su2double Lambda_Visc = viscous ? nodes->GetMax_Lambda_Visc(iPoint) : su2double(0.0);
+
+          /*--- The line edges are implicit, the time step increase is limited to a factor of 100. ---*/
+          if (lineImplicit && Linelets->lineletIdx[iPoint] != CGeometry::CLineletInfo::NO_LINELET) {
+            Lambda_Inv = max(Lambda_Inv - LineCoeff(iPoint, 2), 0.01 * Lambda_Inv);
+            Lambda_Visc = max(Lambda_Visc - LineCoeff(iPoint, 3), 0.01 * Lambda_Visc);
+          }
+
+          su2double Local_Delta_Time = nodes->GetLocalCFL(iPoint)*Vol / Lambda_Inv;
 
           if(viscous) {
-            su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / nodes->GetMax_Lambda_Visc(iPoint);
+            su2double dt_visc = nodes->GetLocalCFL(iPoint)*K_v*Vol*Vol / Lambda_Visc;
             Local_Delta_Time = min(Local_Delta_Time, dt_visc);
           }
 
@@ -705,17 +816,9 @@ class CFVMFlowSolverBase : public CSolver {
       }
     }
 
-    /*--- Correct the eigenvalue values across any periodic boundaries. ---*/
-
-    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_MAX_EIG);
-    }
-
-    /*--- MPI parallelization ---*/
+    /*--- Correct the eigenvalue values across any periodic boundaries and MPI parallelization. ---*/
 
-    InitiateComms(geometry, config, MPI_QUANTITIES::MAX_EIGENVALUE);
-    CompleteComms(geometry, config, MPI_QUANTITIES::MAX_EIGENVALUE);
+    PeriodicAndHaloComms(geometry, config, PERIODIC_MAX_EIG, MPI_QUANTITIES::MAX_EIGENVALUE);
   }
 
   /*!
@@ -769,10 +872,7 @@ class CFVMFlowSolverBase : public CSolver {
     if (isPeriodic) {
       /*--- Correct the sensor values across any periodic boundaries. ---*/
 
-      for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-        InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-        CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_SENSOR);
-      }
+      PeriodicComms(geometry, config, PERIODIC_SENSOR);
 
       /*--- Set final pressure switch for each point ---*/
 
@@ -789,6 +889,152 @@ class CFVMFlowSolverBase : public CSolver {
 
   }
 
+  /*!
+   * \brief Check if the fluxes of an edge can be skipped because both its points are frozen.
+   */
+  inline bool FrozenEdge(unsigned long iPoint, unsigned long jPoint) const {
+    return !FrozenPoint.empty() && FrozenPoint[iPoint] && FrozenPoint[jPoint];
+  }
+
+  /*!
+   * \brief Update the active set from the local residuals of the current iteration. Points whose residual stays
+   *        below the threshold for the required number of iterations are frozen, all points are released at the
+   *        global sweeps (and those that are still converged are frozen again after one iteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdateActiveSet(const CGeometry *geometry, const CConfig *config);
+
+ public:
+  /*!
+   * \brief Reset the state of the nonlinear iterations, including the local CFL and the active set.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void ResetNonlinearIterations(const CConfig* config, unsigned short iMesh) final {
+    CSolver::ResetNonlinearIterations(config, iMesh);
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) nodes->SetLocalCFL(iPoint, config->GetCFL(iMesh));
+    fill(FrozenPoint.begin(), FrozenPoint.end(), false);
+    fill(ConvergedIter.begin(), ConvergedIter.end(), 0ul);
+    ActiveSetIter = 0;
+  }
+
+ protected:
+
+  /*!
+   * \brief Central implicit residual smoothing, the smoothed residuals solve
+   *        (1 + eps n_i) R*_i - eps sum_j R*_j = R_i, where n_i is the number of neighbors of i,
+   *        approximately with a few Jacobi iterations. The multigrid forcing term is included in R.
+   */
+  void SmoothResidual(CGeometry *geometry, const CConfig *config) {
+
+    const su2double eps = config->GetResidualSmoothing_Coeff();
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        LinSysRes(iPoint,iVar) += Res_TruncError[iVar];
+        SmoothedRes(iPoint,iVar) = LinSysRes(iPoint,iVar);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    for (unsigned short iIter = 0; iIter < config->GetResidualSmoothing_Iter(); iIter++) {
+
+      CSysMatrixComms::Initiate(SmoothedRes, geometry, config);
+      CSysMatrixComms::Complete(SmoothedRes, geometry, config);
+
+      /*--- Jacobi update, LinSysSol (unused by the explicit schemes) holds the new iterate. ---*/
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        su2double sum[MAXNVAR] = {0.0};
+        for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) sum[iVar] += SmoothedRes(jPoint,iVar);
+
+        const su2double diag = 1.0 + eps * geometry->nodes->GetnPoint(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          LinSysSol(iPoint,iVar) = (LinSysRes(iPoint,iVar) + eps * sum[iVar]) / diag;
+      }
+      END_SU2_OMP_FOR
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          SmoothedRes(iPoint,iVar) = LinSysSol(iPoint,iVar);
+      END_SU2_OMP_FOR
+    }
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint,iVar) = SmoothedRes(iPoint,iVar);
+    END_SU2_OMP_FOR
+  }
+
+  /*!
+   * \brief Line-implicit smoothing of the explicit schemes. Along the lines normal to the walls (linelets) the
+   *        scalar tridiagonal systems (V_i/dt_i + 0.5 sum_j a_ij) x_i - 0.5 sum_j a_ij x_j = R_i are solved,
+   *        where a_ij are the spectral radii of the line edges (excluded from dt_i by SetTime_Step), and the
+   *        residual is replaced by x_i V_i/dt_i. The other points, and the first point of each line, are not
+   *        modified (scalar point-implicit). The multigrid forcing term is included in R.
+   */
+  void LineImplicitSmoothing(CGeometry *geometry, const CConfig *config) {
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint,iVar) += Res_TruncError[iVar];
+    }
+    END_SU2_OMP_FOR
+
+    if (Linelets == nullptr) return;
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iLine = 0ul; iLine < Linelets->linelets.size(); ++iLine) {
+      const auto& line = Linelets->linelets[iLine];
+      const auto nPts = line.size();
+
+      su2double diag[CGeometry::CLineletInfo::MAX_LINELET_POINTS];
+      su2double upper[CGeometry::CLineletInfo::MAX_LINELET_POINTS];
+
+      /*--- Thomas algorithm, forward elimination. Row 0 is decoupled from the line. ---*/
+
+      for (auto k = 0ul; k < nPts; ++k) {
+        const auto iPoint = line[k];
+        const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+        const su2double lower = (k > 0) ? -0.5 * LineCoeff(iPoint, 0) : su2double(0.0);
+        upper[k] = (k > 0 && k+1 < nPts) ? -0.5 * LineCoeff(iPoint, 1) : su2double(0.0);
+        diag[k] = Vol / nodes->GetDelta_Time(iPoint) - lower - upper[k];
+
+        if (k > 0) {
+          const su2double factor = lower / diag[k-1];
+          diag[k] -= factor * upper[k-1];
+          for (unsigned short iVar = 0; iVar < nVar; iVar++)
+            LinSysRes(iPoint,iVar) -= factor * LinSysRes(line[k-1],iVar);
+        }
+      }
+
+      /*--- Back substitution, the solution is scaled back to a residual. ---*/
+
+      for (auto k = nPts; k-- > 0;) {
+        const auto iPoint = line[k];
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          if (k+1 < nPts) LinSysRes(iPoint,iVar) -= upper[k] * LinSysSol(line[k+1],iVar);
+          LinSysSol(iPoint,iVar) = LinSysRes(iPoint,iVar) / diag[k];
+        }
+      }
+      for (const auto iPoint : line) {
+        const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          LinSysRes(iPoint,iVar) = LinSysSol(iPoint,iVar) * Vol / nodes->GetDelta_Time(iPoint);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
   /*!
    * \brief Generic implementation of explicit iterations with a preconditioner.
    * \note The preconditioner is a functor implementing the methods:
@@ -805,6 +1051,7 @@ class CFVMFlowSolverBase : public CSolver {
                   IntegrationType == EULER_EXPLICIT, "");
 
     const bool adjoint = config->GetContinuous_Adjoint();
+    const bool smoothing = (config->GetResidualSmoothing() || config->GetLineImplicit_Smoothing()) && !adjoint;
 
     const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
 
@@ -816,6 +1063,14 @@ class CFVMFlowSolverBase : public CSolver {
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    /*--- The smoothed residuals already include the multigrid forcing term. ---*/
+
+    if (smoothing) {
+      if (config->GetResidualSmoothing()) SmoothResidual(geometry, config);
+      else LineImplicitSmoothing(geometry, config);
+    }
+    const su2double zeros[MAXNVAR] = {0.0};
+
     /*--- Update the solution and residuals ---*/
 
     if (!adjoint) {
@@ -825,7 +1080,7 @@ class CFVMFlowSolverBase : public CSolver {
         su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
         su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-        const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+        const su2double* Res_TruncError = smoothing ? zeros : nodes->GetResTruncError(iPoint);
         const su2double* Residual = LinSysRes.GetBlock(iPoint);
 
         preconditioner.compute(config, iPoint);
@@ -910,6 +1165,8 @@ class CFVMFlowSolverBase : public CSolver {
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
 
+    const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::IMPLICIT_SETUP);
+
     const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
     /*--- Local residual variables for current thread ---*/
@@ -944,6 +1201,10 @@ class CFVMFlowSolverBase : public CSolver {
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
+    /*--- Residual norms for the local CFL adaption, when multigrid is used the fine grid
+     *    system is also solved after the coarse grid correction, the last one is kept. ---*/
+    const bool localResidual = !LocalResidual.empty();
+
     SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
     for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
@@ -958,20 +1219,28 @@ class CFVMFlowSolverBase : public CSolver {
         }
       }
 
+      /*--- The residual of frozen points is incomplete (some edges are skipped) and is not used. ---*/
+
+      const bool frozen = !FrozenPoint.empty() && FrozenPoint[iPoint];
+
       for (unsigned short iVar = 0; iVar < nVar; iVar++) {
         unsigned long total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
+        LinSysRes[total_index] = frozen ? 0.0 : - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
         LinSysSol[total_index] = 0.0;
 
         /*--- "Add" residual at (iPoint,iVar) to local residual variables. ---*/
         ResidualReductions_PerThread(iPoint, iVar, LinSysRes[total_index], resRMS, resMax, idxMax);
       }
+
+      if (localResidual) LocalResidual[iPoint] = GeometryToolbox::Norm(nVar, LinSysRes.GetBlock(iPoint));
     }
     END_SU2_OMP_FOR
 
     /*--- "Add" residuals from all threads to global residual variables. ---*/
     ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
+    if (!FrozenPoint.empty()) UpdateActiveSet(geometry, config);
+
   }
 
   /*!
@@ -988,6 +1257,7 @@ class CFVMFlowSolverBase : public CSolver {
     if (!config->GetContinuous_Adjoint()) {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        if (!FrozenPoint.empty() && FrozenPoint[iPoint]) continue;
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
           nodes->AddSolution(iPoint, iVar, nodes->GetUnderRelaxation(iPoint)*LinSysSol[iPoint*nVar+iVar]);
         }
@@ -995,13 +1265,7 @@ class CFVMFlowSolverBase : public CSolver {
       END_SU2_OMP_FOR
     }
 
-    for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-      InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-      CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-    }
-
-    InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
-    CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+    PeriodicAndHaloComms(geometry, config, PERIODIC_IMPLICIT, MPI_QUANTITIES::SOLUTION);
 
     /*--- For verification cases, compute the global error metrics. ---*/
     ComputeVerificationError(geometry, config);
@@ -1012,6 +1276,15 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void ComputeVorticityAndStrainMag(const CConfig& config, const CGeometry *geometry, unsigned short iMesh);
 
+  /*!
+   * \brief Sum scalars and arrays over all ranks in place, with a single reduction.
+   * \param[in,out] scalars - The scalars.
+   * \param[in] size - Size of each array.
+   * \param[in,out] arrays - The arrays.
+   */
+  static void AllreduceSum(std::initializer_list<su2double*> scalars, int size,
+                           std::initializer_list<su2double*> arrays);
+
   /*!
    * \brief Destructor.
    */
@@ -1043,6 +1316,12 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetInitialCondition(CGeometry **geometry, CSolver ***solver_container, CConfig *config, unsigned long ExtIter) override;
 
+  /*!
+   * \brief Freeze the gradients and limiters, i.e. keep their current values during preprocessing.
+   * \param[in] frozen - Whether the gradients and limiters are frozen.
+   */
+  inline void SetFrozenGradients(bool frozen) final { frozenGradients = frozen; }
+
   /*!
    * \brief Compute the gradient of the primitive variables using Green-Gauss method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -1068,6 +1347,20 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the gradient of the primitive variables and, optionally, their limiters.
+   * \note With FUSED_GRADIENT_LIMITER, and if the problem allows it, the limiters are computed in the same
+   *       pass over the grid as the gradient, otherwise this is the same as SetPrimitive_Gradient_GG/LS
+   *       followed by SetPrimitive_Limiter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   * \param[in] limiter - Compute the limiters (which always use the reconstruction gradient).
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config, unsigned short kindGradient,
+                                     bool reconstruction, bool limiter);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
@@ -1182,6 +1475,11 @@ class CFVMFlowSolverBase : public CSolver {
    */
   inline su2double GetDensity_Inf(void) const final { return Density_Inf; }
 
+  /*!
+   * \brief Get the fraction of the domain points that are active (not frozen by the active set).
+   */
+  inline su2double GetActivePointFraction(void) const final { return ActivePointFraction; }
+
   /*!
    * \brief Compute 2-norm of the velocity at the infinity.
    * \return Value of the 2-norm of the velocity at the infinity.
@@ -29,6 +29,7 @@
 #include "../gradients/computeGradientsGreenGauss.hpp"
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
+#include "../limiters/computeGradientsAndLimiters.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
@@ -98,6 +99,22 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
     jPoint_UndLapl.resize(nPointDomain);
   }
 
+  /*--- Residual norm of each point for the local residual CFL adaption (fine grid only). ---*/
+
+  if (config.GetCFL_Adapt() && (config.GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL) &&
+      (MGLevel == MESH_0)) {
+    LocalResidual.resize(nPointDomain, 0.0);
+    LocalResidual_Old.resize(nPointDomain, 0.0);
+  }
+
+  /*--- Active set, the points are frozen based on their local residual. ---*/
+
+  if (config.GetActiveSet() && (MGLevel == MESH_0)) {
+    LocalResidual.resize(nPointDomain, 0.0);
+    FrozenPoint.resize(nPoint, false);
+    ConvergedIter.resize(nPointDomain, 0);
+  }
+
   /*--- Initialize the solution and right hand side vectors for storing
    the residuals and updating the solution (always needed even for
    explicit schemes). ---*/
@@ -105,6 +122,8 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  if (config.GetResidualSmoothing()) SmoothedRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
   /*--- LinSysSol will always be init to 0. ---*/
   System.SetxIsZero(true);
 
@@ -180,6 +199,13 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
 
   AllocVectorOfVectors(nVertex, EddyViscWall);
 
+  /*--- Inverse law of the wall (Spalding) used by the wall functions ---*/
+
+  if (config.GetwallModel_Table()) {
+    WallLawTable.InitializeSpalding(SU2_TYPE::GetValue(config.GetwallModel_Kappa()),
+                                    SU2_TYPE::GetValue(config.GetwallModel_B()));
+  }
+
   /*--- Skin friction in all the markers ---*/
 
   AllocVectorOfMatrices(nVertex, nDim, CSkinFriction);
@@ -293,9 +319,13 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
   /*--- For the discrete adjoint, the reducer strategy is costly. Prefer coloring, possibly with reduced edge color
    *    group size. Find the maximum edge color group size that yields an efficient coloring. Also, allow larger numbers
    *    of colors. ---*/
+  constexpr bool autotune = false;
   const bool relax =  config.GetEdgeColoringRelaxDiscAdj();
   const auto& coloring = geometry.GetEdgeColoring(&parallelEff, relax);
 #else
+  /*--- If requested, time the strategies and keep the coloring of the fastest (natural coloring for the reducer). ---*/
+  const bool autotune = config.GetEdgeColoringAutotune() && (config.GetEdgeColoringGroupSize() != 1 << 30);
+  if (autotune) geometry.AutotuneEdgeColoring(nVar, Double::Size);
   const auto& coloring = geometry.GetEdgeColoring(&parallelEff);
 #endif
 
@@ -324,7 +354,15 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
     int tmp = ReducerStrategy, numRanksUsingReducer = 0;
     SU2_MPI::Reduce(&tmp, &numRanksUsingReducer, 1, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
 
-    if (minEff < COLORING_EFF_THRESH) {
+    if (autotune) {
+      int largestFirst = !ReducerStrategy && geometry.GetEdgeColoringLargestFirst(), numRanksLargestFirst = 0;
+      SU2_MPI::Reduce(&largestFirst, &numRanksLargestFirst, 1, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+
+      if (SU2_MPI::GetRank() == MASTER_NODE) {
+        cout << "Edge loops autotuned, " << numRanksUsingReducer << " MPI ranks use the reducer strategy "
+             << "and the others edge coloring (" << numRanksLargestFirst << " in largest-degree-first order)." << endl;
+      }
+    } else if (minEff < COLORING_EFF_THRESH) {
       cout << "WARNING: On " << numRanksUsingReducer << " MPI ranks the coloring efficiency was less than "
            << COLORING_EFF_THRESH << " (min value was " << minEff << ").\n"
            << "         Those ranks will now use a fallback strategy, better performance may be possible\n"
@@ -365,6 +403,9 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 #else
   EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
 #endif
+
+  SetupOverlapEdgeGroups(config, geometry);
+  SetupEdgeGatherPlan(config, geometry);
 }
 
 template <class V, ENUM_REGIME R>
@@ -376,22 +417,32 @@ CFVMFlowSolverBase<V, R>::~CFVMFlowSolverBase() {
 
   delete nodes;
   delete edgeNumerics;
+  delete boundaryNumerics;
 }
 
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, const CConfig* config,
                                                         bool reconstruction) {
+  if (frozenGradients) return;
+
   const auto& primitives = nodes->GetPrimitive();
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
+  /*--- The reconstruction gradients of halo points are only needed by the edge fluxes. ---*/
+  if (reconstruction) DeferGradientComms(true);
+
   computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient);
+
+  if (reconstruction) DeferGradientComms(false);
 }
 
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, const CConfig* config,
                                                         bool reconstruction) {
+  if (frozenGradients) return;
+
   /*--- Set a flag for unweighted or weighted least-squares. ---*/
   bool weighted;
   PERIODIC_QUANTITIES commPer;
@@ -410,12 +461,18 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
 
+  if (reconstruction) DeferGradientComms(true);
+
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
                                primitives, 0, nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix);
+
+  if (reconstruction) DeferGradientComms(false);
 }
 
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) {
+  if (frozenGradients) return;
+
   const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
   const auto& primitives = nodes->GetPrimitive();
   const auto& gradient = nodes->GetGradient_Reconstruction();
@@ -423,8 +480,69 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  /*--- The limiters of halo points are only needed by the edge fluxes. ---*/
+  DeferGradientComms(true);
+
   computeLimiters(kindLimiter, this, MPI_QUANTITIES::PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+
+  DeferGradientComms(false);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config,
+                                                             unsigned short kindGradient, bool reconstruction,
+                                                             bool limiter) {
+  const auto kindLimiter = config->GetKind_SlopeLimit_Flow();
+
+  /*--- The fused kernel needs the limiters to be based on this gradient, it does not support
+   *    periodicity, edge-based limiters, or recording the AD tape (see computeGradientsAndLimiters). ---*/
+  const bool fused = limiter && config->GetFused_Gradient_Limiter() &&
+                     (reconstruction || !config->GetReconstructionGradientRequired()) &&
+                     (config->GetnMarker_Periodic() == 0) && !config->GetDiscrete_Adjoint() &&
+                     (kindLimiter != LIMITER::NONE) && (kindLimiter != LIMITER::VAN_ALBADA_EDGE) &&
+                     (kindGradient == GREEN_GAUSS || kindGradient == LEAST_SQUARES ||
+                      kindGradient == WEIGHTED_LEAST_SQUARES);
+  if (!fused) {
+    AD::BeginTapeSection(AD::TapeSection::GRADIENTS);
+    switch (kindGradient) {
+      case GREEN_GAUSS:
+        SetPrimitive_Gradient_GG(geometry, config, reconstruction); break;
+      case LEAST_SQUARES:
+      case WEIGHTED_LEAST_SQUARES:
+        SetPrimitive_Gradient_LS(geometry, config, reconstruction); break;
+      default: break;
+    }
+    AD::EndTapeSection();
+
+    if (limiter) {
+      AD::BeginTapeSection(AD::TapeSection::LIMITERS);
+      SetPrimitive_Limiter(geometry, config);
+      AD::EndTapeSection();
+    }
+    return;
+  }
+
+  if (frozenGradients) return;
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiterPrim = nodes->GetLimiter_Primitive();
+
+  computeGradientsAndLimiters(kindLimiter, this, comm, *geometry, *config, kindGradient, primitives, 0,
+                              nPrimVarGrad, prim_idx.Velocity(), gradient, rmatrix, primMin, primMax, limiterPrim);
+
+  /*--- The limiters of halo points are only needed by the edge fluxes. ---*/
+  DeferGradientComms(true);
+
+  InitiateComms(geometry, config, MPI_QUANTITIES::PRIMITIVE_LIMITER);
+  CompleteComms(geometry, config, MPI_QUANTITIES::PRIMITIVE_LIMITER);
+
+  DeferGradientComms(false);
 }
 
 template <class V, ENUM_REGIME R>
@@ -595,6 +713,10 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
 
   PrepareImplicitIteration(geometry, nullptr, config);
 
+  /*--- The coupled system of the flow and turbulence is solved by the turbulence solver. ---*/
+
+  if (config->GetCoupled_Turb_Solve()) return;
+
   /*--- Solve or smooth the linear system. ---*/
 
   SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
@@ -604,13 +726,24 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
   }
   END_SU2_OMP_FOR
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (config->GetKind_ROMProjection() != ROM_PROJECTION::NONE) {
+    /*--- Online reduced order model, the update is in the span of the POD basis. ---*/
+    const su2double residual = SolveReducedOrder(geometry, config);
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      SetIterLinSolver(ROM_Basis.size());
+      SetResLinSolver(residual);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  } else {
+    auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      SetIterLinSolver(iter);
+      SetResLinSolver(System.GetResidual());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
   CompleteImplicitIteration(geometry, nullptr, config);
 }
@@ -857,73 +990,64 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+      /*--- We need to store this point's data, so jump to the correct
+      offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- Retrieve local index. If this node from the restart file lives
-      on the current processor, we will load and instantiate the vars. ---*/
+      auto index = counter * Restart_Vars[1] + skipVars;
 
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+      if (SolutionRestart == nullptr) {
+        for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
+          nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
+      }
+      else {
+        /*--- Used as buffer, allows defaults for nVar > nVar_Restart. ---*/
+        for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
+          SolutionRestart[iVar] = Restart_Data[index + iVar];
+        nodes->SetSolution(iPoint_Local, SolutionRestart);
+      }
 
-      if (iPoint_Local > -1) {
+      /*--- For dynamic meshes, read in and store the
+      grid coordinates and grid velocities for each node. ---*/
 
-        /*--- We need to store this point's data, so jump to the correct
-        offset in the buffer of data from the restart file and load it. ---*/
+      if (dynamic_grid && update_geo) {
 
-        auto index = counter * Restart_Vars[1] + skipVars;
+        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-        if (SolutionRestart == nullptr) {
-          for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
-            nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
-        }
-        else {
-          /*--- Used as buffer, allows defaults for nVar > nVar_Restart. ---*/
-          for (auto iVar = 0u; iVar < nVar_Restart; iVar++)
-            SolutionRestart[iVar] = Restart_Data[index + iVar];
-          nodes->SetSolution(iPoint_Local, SolutionRestart);
+        /*--- Rewind the index to retrieve the Coords. ---*/
+        index = counter * Restart_Vars[1];
+        const auto* Coord = &Restart_Data[index];
+
+        su2double GridVel[MAXNDIM] = {0.0};
+        if (!steady_restart) {
+          /*--- Move the index forward to get the grid velocities. ---*/
+          index += skipVars + nVar_Restart + config->GetnTurbVar();
+          for (auto iDim = 0u; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
         }
 
-        /*--- For dynamic meshes, read in and store the
-        grid coordinates and grid velocities for each node. ---*/
-
-        if (dynamic_grid && update_geo) {
-
-          /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-          /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-          /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
-
-          /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter * Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
-
-          su2double GridVel[MAXNDIM] = {0.0};
-          if (!steady_restart) {
-            /*--- Move the index forward to get the grid velocities. ---*/
-            index += skipVars + nVar_Restart + config->GetnTurbVar();
-            for (auto iDim = 0u; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
-          }
-
-          for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-            geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
-          }
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+          geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
         }
+      }
 
-        /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
-        grid coordinates for each node (but not the grid velocities, as there are none). ---*/
+      /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
+      grid coordinates for each node (but not the grid velocities, as there are none). ---*/
 
-        if (static_fsi && update_geo) {
-        /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter*Restart_Vars[1];
-          const auto* Coord = &Restart_Data[index];
+      if (static_fsi && update_geo) {
+      /*--- Rewind the index to retrieve the Coords. ---*/
+        index = counter*Restart_Vars[1];
+        const auto* Coord = &Restart_Data[index];
 
-          for (auto iDim = 0u; iDim < nDim; iDim++) {
-            geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-          }
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
         }
-
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
       }
+
+      /*--- Increment the overall counter for how many points have been loaded. ---*/
+      counter++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -1120,7 +1244,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::BC_Sym_Plane(CGeometry* geometry, CSolve
 
   /*--- Loop over all the vertices on this boundary marker. ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -1241,10 +1365,7 @@ void CFVMFlowSolverBase<V, R>::BC_Periodic(CGeometry* geometry, CSolver** solver
    accumulated correctly during the communications. For implicit calculations,
    the Jacobians and linear system are also correctly adjusted here. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-  }
+  PeriodicComms(geometry, config, PERIODIC_RESIDUAL);
 }
 
 template <class V, ENUM_REGIME FlowRegime>
@@ -1422,10 +1543,9 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 
     bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
-    /*--- Get the physical time. ---*/
+    /*--- Get the states of the verification solution (computed once for steady problems). ---*/
 
-    su2double time = 0.0;
-    if (config->GetTime_Marching() != TIME_MARCHING::STEADY) time = config->GetPhysicalTime();
+    const auto& bcStates = GetVerificationBCStates(geometry, config, val_marker);
 
     /*--- Loop over all the vertices on this boundary marker ---*/
 
@@ -1438,14 +1558,9 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
       /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
       if (geometry->nodes->GetDomain(iPoint)) {
-        /*--- Get the coordinates for the current node. ---*/
-
-        const su2double* coor = geometry->nodes->GetCoord(iPoint);
-
         /*--- Get the conservative state from the verification solution. ---*/
 
-        su2double Solution[MAXNVAR] = {0.0};
-        VerificationSolution->GetBCState(coor, time, Solution);
+        const su2double* Solution = bcStates[iVertex];
 
         /*--- For verification cases, we will apply a strong Dirichlet
          condition by setting the solution values at the boundary nodes
@@ -1475,7 +1590,53 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
+void CFVMFlowSolverBase<V, R>::UpdateActiveSet(const CGeometry *geometry, const CConfig *config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+
+  const su2double tol = config->GetActiveSet_Param(0);
+  const auto nIter = static_cast<unsigned long>(SU2_TYPE::Int(config->GetActiveSet_Param(1)));
+  const auto sweepFreq = static_cast<unsigned long>(SU2_TYPE::Int(config->GetActiveSet_Param(2)));
+
+  /*--- The threshold is relative to the largest local residual of the first iteration. ---*/
+
+  if (ActiveSetIter == 0) {
+    su2double maxRes = 0.0;
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) maxRes = max(maxRes, LocalResidual[iPoint]);
+    SU2_MPI::Allreduce(&maxRes, &ActiveSetRes0, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  }
+  const su2double threshold = tol * ActiveSetRes0;
+
+  unsigned long nActive = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (!FrozenPoint[iPoint]) {
+      if (LocalResidual[iPoint] < threshold) {
+        if (++ConvergedIter[iPoint] >= nIter) FrozenPoint[iPoint] = true;
+      } else {
+        ConvergedIter[iPoint] = 0;
+      }
+    }
+    nActive += !FrozenPoint[iPoint];
+  }
+
+  unsigned long nActiveGlobal = nActive;
+  SU2_MPI::Allreduce(&nActive, &nActiveGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  ActivePointFraction = su2double(nActiveGlobal) / geometry->GetGlobal_nPointDomain();
+
+  /*--- Safeguard global sweep, all points are updated in the next iteration. ---*/
+
+  ActiveSetIter++;
+  if ((sweepFreq > 0) && (ActiveSetIter % sweepFreq == 0)) {
+    fill(FrozenPoint.begin(), FrozenPoint.end(), false);
+  }
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
   if (!edgeNumerics) {
@@ -1499,35 +1660,159 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
-    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-    for(auto k = 0ul; k < color.size; k += Double::Size) {
-      Int iEdge;
-      Double mask;
-      for (auto j = 0ul; j < Double::Size; ++j) {
-        bool in = (k+j < color.size);
-        mask[j] = in;
-        iEdge[j] = color.indices[k+j*in];
+  const bool gradients = config->GetMUSCL_Flow() && (MGLevel == MESH_0);
+
+  /*--- Fluxes of the edges [k, k+Double::Size) of a color, limited to "end". ---*/
+  auto computeFluxes = [&](unsigned long iColor, unsigned long k, unsigned long end) {
+    const auto& color = EdgeColoring[iColor];
+
+    /*--- Prefetch the data of the edges some groups ahead (in the same color). ---*/
+    if (prefetchDistance) {
+      const auto kAhead = k + prefetchDistance * Double::Size;
+      if (kAhead < color.size) PrefetchEdgeData(*geometry, iColor, kAhead, gradients);
+    }
+
+    /*--- Skip the groups in which all edges are between frozen points. ---*/
+    if (!FrozenPoint.empty()) {
+      bool frozen = true;
+      for (auto j = 0ul; j < Double::Size && k+j < end && frozen; ++j) {
+        const auto iEdge = color.indices[k+j];
+        frozen = FrozenEdge(geometry->edges->GetNode(iEdge,0), geometry->edges->GetNode(iEdge,1));
       }
+      if (frozen) return;
+    }
 
-      if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
-      } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+    Int iEdge;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < end);
+      mask[j] = in;
+      iEdge[j] = color.indices[k+j*in];
+    }
+
+    if (ReducerStrategy) {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+    } else {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+    }
+    if (MGLevel == MESH_0) {
+      for (auto j = 0ul; j < Double::Size; ++j)
+        counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+    }
+  };
+
+  if (!overlapComms) {
+    /*--- Loop over edge colors. ---*/
+    for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+      const auto& color = EdgeColoring[iColor];
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for(auto k = 0ul; k < color.size; k += Double::Size) {
+        computeFluxes(iColor, k, color.size);
       }
-      if (MGLevel == MESH_0) {
-        for (auto j = 0ul; j < Double::Size; ++j)
-          counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+      END_SU2_OMP_FOR
+    }
+  } else {
+    /*--- First the groups of edges that do not touch halo points, while the comms
+     *    of gradients and limiters (if pending) complete, and then the others. ---*/
+    for (auto iType = 0ul; iType < 2; ++iType) {
+      if (iType == 1) CompletePendingComms(geometry, config);
+
+      for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+        const auto& color = EdgeColoring[iColor];
+        const auto& groups = OverlapEdgeGroups[iColor][iType];
+
+        SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, overlapGroupSize))
+        for (auto iGroup = 0ul; iGroup < groups.size(); ++iGroup) {
+          const auto end = min(groups[iGroup] + overlapGroupSize, color.size);
+          for (auto k = groups[iGroup]; k < end; k += Double::Size) {
+            computeFluxes(iColor, k, end);
+          }
+        }
+        END_SU2_OMP_FOR
       }
     }
-    END_SU2_OMP_FOR
   }
 
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetupOverlapEdgeGroups(const CConfig& config, const CGeometry& geometry) {
+
+  /*--- Only useful with MPI, not used for the discrete adjoint (recording order). ---*/
+  overlapComms = config.GetOverlap_Halo_Comms() && (size > 1) && !config.GetDiscrete_Adjoint();
+  if (!overlapComms) return;
+
+  /*--- The groups of colored edges cannot be split without creating race conditions,
+   *    otherwise any group size is valid, it needs to be a multiple of the SIMD size. ---*/
+#ifdef HAVE_OMP
+  overlapGroupSize = ReducerStrategy ? OMP_MIN_SIZE : EdgeColoring[0].groupSize;
+#else
+  overlapGroupSize = OMP_MIN_SIZE;
+#endif
+
+  OverlapEdgeGroups.resize(EdgeColoring.size());
+
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    const auto& color = EdgeColoring[iColor];
+
+    for (auto begin = 0ul; begin < color.size; begin += overlapGroupSize) {
+      const auto end = min(begin + overlapGroupSize, color.size);
+      bool interior = true;
+      for (auto k = begin; k < end && interior; ++k) {
+        const auto iEdge = color.indices[k];
+        interior = geometry.nodes->GetDomain(geometry.edges->GetNode(iEdge,0)) &&
+                   geometry.nodes->GetDomain(geometry.edges->GetNode(iEdge,1));
+      }
+      OverlapEdgeGroups[iColor][!interior].push_back(begin);
+    }
+  }
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetupEdgeGatherPlan(const CConfig& config, const CGeometry& geometry) {
+
+  /*--- Only for the vectorized edge loops. ---*/
+  prefetchDistance = config.GetUseVectorization() ? config.GetEdgePrefetchDistance() : 0;
+  if (prefetchDistance == 0) return;
+
+  /*--- The edges of a color are scattered over the edge arrays, storing their end points in loop
+   *    order makes the indices of the edges ahead a contiguous read. ---*/
+  EdgeGatherPlan.resize(EdgeColoring.size());
+
+  for (auto iColor = 0ul; iColor < EdgeColoring.size(); ++iColor) {
+    const auto& color = EdgeColoring[iColor];
+    auto& plan = EdgeGatherPlan[iColor];
+    plan.resize(2 * color.size);
+
+    for (auto k = 0ul; k < color.size; ++k) {
+      const auto iEdge = color.indices[k];
+      plan[2*k] = geometry.edges->GetNode(iEdge,0);
+      plan[2*k+1] = geometry.edges->GetNode(iEdge,1);
+    }
+  }
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::PrefetchEdgeData(const CGeometry& geometry, unsigned long iColor,
+                                                unsigned long k, bool gradients) const {
+  const auto& color = EdgeColoring[iColor];
+  const auto* plan = EdgeGatherPlan[iColor].data();
+  const auto& primitives = nodes->GetPrimitive();
+  const auto& gradient = nodes->GetGradient_Reconstruction();
+
+  for (auto j = k; j < min(k + Double::Size, color.size); ++j) {
+    su2prefetch(geometry.edges->GetNormal(color.indices[j]), nDim * sizeof(su2double));
+
+    for (auto iNode = 0ul; iNode < 2; ++iNode) {
+      const auto iPoint = plan[2*j + iNode];
+      su2prefetch(primitives[iPoint], nPrimVar * sizeof(su2double));
+      if (gradients) su2prefetch(&gradient(iPoint,0,0), nPrimVarGrad * nDim * sizeof(su2double));
+    }
+  }
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
 
@@ -1736,6 +2021,27 @@ void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry
 
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::AllreduceSum(std::initializer_list<su2double*> scalars, int size,
+                                            std::initializer_list<su2double*> arrays) {
+  /*--- Pack everything into one buffer, the reductions are latency bound. ---*/
+
+  vector<su2double> send, recv;
+  send.reserve(scalars.size() + size * arrays.size());
+  for (const auto* x : scalars) send.push_back(*x);
+  for (const auto* x : arrays) send.insert(send.end(), x, x + size);
+  recv.resize(send.size());
+
+  SU2_MPI::Allreduce(send.data(), recv.data(), send.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  auto it = recv.cbegin();
+  for (auto* x : scalars) *x = *(it++);
+  for (auto* x : arrays) {
+    std::copy(it, it + size, x);
+    it += size;
+  }
+}
+
 template <class V, ENUM_REGIME FlowRegime>
 void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometry, const CConfig* config) {
   unsigned long iVertex, iPoint;
@@ -1805,10 +2111,13 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
       NFPressOF = 0.0;
 
-      /*--- Loop over the vertices to compute the forces ---*/
+      /*--- Loop over the vertices to compute the forces (using the contiguous vertex storage). ---*/
+
+      const auto& vertexNodes = geometry->GetVertexNodes(iMarker);
+      const auto& vertexNormals = geometry->GetVertexNormals(iMarker);
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexNodes[iVertex];
 
         Pressure = nodes->GetPressure(iPoint);
 
@@ -1818,7 +2127,7 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
          halo cells (for visualization purposes), but not the forces ---*/
 
         if ((geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES)) {
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = vertexNormals[iVertex];
           Coord = geometry->nodes->GetCoord(iPoint);
 
           /*--- Quadratic objective function for the near-field.
@@ -1951,70 +2260,26 @@ void CFVMFlowSolverBase<V, FlowRegime>::Pressure_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundInvCoeff.CD = Allreduce(AllBoundInvCoeff.CD);
-    AllBoundInvCoeff.CL = Allreduce(AllBoundInvCoeff.CL);
-    AllBoundInvCoeff.CSF = Allreduce(AllBoundInvCoeff.CSF);
-    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
-
-    AllBoundInvCoeff.CMx = Allreduce(AllBoundInvCoeff.CMx);
-    AllBoundInvCoeff.CMy = Allreduce(AllBoundInvCoeff.CMy);
-    AllBoundInvCoeff.CMz = Allreduce(AllBoundInvCoeff.CMz);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundInvCoeff.CoPx = Allreduce(AllBoundInvCoeff.CoPx);
-    AllBoundInvCoeff.CoPy = Allreduce(AllBoundInvCoeff.CoPy);
-    AllBoundInvCoeff.CoPz = Allreduce(AllBoundInvCoeff.CoPz);
+    AllreduceSum({&AllBoundInvCoeff.CD, &AllBoundInvCoeff.CL, &AllBoundInvCoeff.CSF, &AllBoundInvCoeff.CMx,
+                  &AllBoundInvCoeff.CMy, &AllBoundInvCoeff.CMz, &AllBoundInvCoeff.CoPx, &AllBoundInvCoeff.CoPy,
+                  &AllBoundInvCoeff.CoPz, &AllBoundInvCoeff.CFx, &AllBoundInvCoeff.CFy, &AllBoundInvCoeff.CFz,
+                  &AllBoundInvCoeff.CT, &AllBoundInvCoeff.CQ, &AllBound_CNearFieldOF_Inv},
+                 nMarkerMon,
+                 {SurfaceInvCoeff.CL, SurfaceInvCoeff.CD, SurfaceInvCoeff.CSF, SurfaceInvCoeff.CFx,
+                  SurfaceInvCoeff.CFy, SurfaceInvCoeff.CFz, SurfaceInvCoeff.CMx, SurfaceInvCoeff.CMy,
+                  SurfaceInvCoeff.CMz});
 
-    AllBoundInvCoeff.CFx = Allreduce(AllBoundInvCoeff.CFx);
-    AllBoundInvCoeff.CFy = Allreduce(AllBoundInvCoeff.CFy);
-    AllBoundInvCoeff.CFz = Allreduce(AllBoundInvCoeff.CFz);
-
-    AllBoundInvCoeff.CT = Allreduce(AllBoundInvCoeff.CT);
-    AllBoundInvCoeff.CQ = Allreduce(AllBoundInvCoeff.CQ);
+    AllBoundInvCoeff.CEff = AllBoundInvCoeff.CL / (AllBoundInvCoeff.CD + EPS);
     AllBoundInvCoeff.CMerit = AllBoundInvCoeff.CT / (AllBoundInvCoeff.CQ + EPS);
-    AllBound_CNearFieldOF_Inv = Allreduce(AllBound_CNearFieldOF_Inv);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CSF);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceInvCoeff.CEff[iMarker_Monitoring] =
           SurfaceInvCoeff.CL[iMarker_Monitoring] / (SurfaceInvCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceInvCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2233,70 +2498,26 @@ void CFVMFlowSolverBase<V, FlowRegime>::Momentum_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-
-    AllBoundMntCoeff.CD = Allreduce(AllBoundMntCoeff.CD);
-    AllBoundMntCoeff.CL = Allreduce(AllBoundMntCoeff.CL);
-    AllBoundMntCoeff.CSF = Allreduce(AllBoundMntCoeff.CSF);
-    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
-
-    AllBoundMntCoeff.CFx = Allreduce(AllBoundMntCoeff.CFx);
-    AllBoundMntCoeff.CFy = Allreduce(AllBoundMntCoeff.CFy);
-    AllBoundMntCoeff.CFz = Allreduce(AllBoundMntCoeff.CFz);
-
-    AllBoundMntCoeff.CMx = Allreduce(AllBoundMntCoeff.CMx);
-    AllBoundMntCoeff.CMy = Allreduce(AllBoundMntCoeff.CMy);
-    AllBoundMntCoeff.CMz = Allreduce(AllBoundMntCoeff.CMz);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundMntCoeff.CoPx = Allreduce(AllBoundMntCoeff.CoPx);
-    AllBoundMntCoeff.CoPy = Allreduce(AllBoundMntCoeff.CoPy);
-    AllBoundMntCoeff.CoPz = Allreduce(AllBoundMntCoeff.CoPz);
+    AllreduceSum({&AllBoundMntCoeff.CD, &AllBoundMntCoeff.CL, &AllBoundMntCoeff.CSF, &AllBoundMntCoeff.CMx,
+                  &AllBoundMntCoeff.CMy, &AllBoundMntCoeff.CMz, &AllBoundMntCoeff.CoPx, &AllBoundMntCoeff.CoPy,
+                  &AllBoundMntCoeff.CoPz, &AllBoundMntCoeff.CFx, &AllBoundMntCoeff.CFy, &AllBoundMntCoeff.CFz,
+                  &AllBoundMntCoeff.CT, &AllBoundMntCoeff.CQ},
+                 nMarkerMon,
+                 {SurfaceMntCoeff.CL, SurfaceMntCoeff.CD, SurfaceMntCoeff.CSF, SurfaceMntCoeff.CFx,
+                  SurfaceMntCoeff.CFy, SurfaceMntCoeff.CFz, SurfaceMntCoeff.CMx, SurfaceMntCoeff.CMy,
+                  SurfaceMntCoeff.CMz});
 
-    AllBoundMntCoeff.CT = Allreduce(AllBoundMntCoeff.CT);
-    AllBoundMntCoeff.CQ = Allreduce(AllBoundMntCoeff.CQ);
+    AllBoundMntCoeff.CEff = AllBoundMntCoeff.CL / (AllBoundMntCoeff.CD + EPS);
     AllBoundMntCoeff.CMerit = AllBoundMntCoeff.CT / (AllBoundMntCoeff.CQ + EPS);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CSF);
 
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceMntCoeff.CEff[iMarker_Monitoring] =
           SurfaceMntCoeff.CL[iMarker_Monitoring] / (SurfaceMntCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceMntCoeff.CMz);
-
-    delete[] buffer;
   }
 
 #endif
@@ -2675,75 +2896,26 @@ void CFVMFlowSolverBase<V, FlowRegime>::Friction_Forces(const CGeometry* geometr
 
 #ifdef HAVE_MPI
 
-  /*--- Add AllBound information using all the nodes ---*/
+  /*--- Add AllBound information and the forces on the surfaces using all the nodes ---*/
 
   if (config->GetComm_Level() == COMM_FULL) {
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x;
-      x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
-    AllBoundViscCoeff.CD = Allreduce(AllBoundViscCoeff.CD);
-    AllBoundViscCoeff.CL = Allreduce(AllBoundViscCoeff.CL);
-    AllBoundViscCoeff.CSF = Allreduce(AllBoundViscCoeff.CSF);
-    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
+    const int nMarkerMon = config->GetnMarker_Monitoring();
 
-    AllBoundViscCoeff.CMx = Allreduce(AllBoundViscCoeff.CMx);
-    AllBoundViscCoeff.CMy = Allreduce(AllBoundViscCoeff.CMy);
-    AllBoundViscCoeff.CMz = Allreduce(AllBoundViscCoeff.CMz);
+    AllreduceSum({&AllBoundViscCoeff.CD, &AllBoundViscCoeff.CL, &AllBoundViscCoeff.CSF, &AllBoundViscCoeff.CMx,
+                  &AllBoundViscCoeff.CMy, &AllBoundViscCoeff.CMz, &AllBoundViscCoeff.CoPx, &AllBoundViscCoeff.CoPy,
+                  &AllBoundViscCoeff.CoPz, &AllBoundViscCoeff.CFx, &AllBoundViscCoeff.CFy, &AllBoundViscCoeff.CFz,
+                  &AllBoundViscCoeff.CT, &AllBoundViscCoeff.CQ, &AllBound_HF_Visc, &AllBound_MaxHF_Visc},
+                 nMarkerMon,
+                 {SurfaceViscCoeff.CL, SurfaceViscCoeff.CD, SurfaceViscCoeff.CSF, SurfaceViscCoeff.CFx,
+                  SurfaceViscCoeff.CFy, SurfaceViscCoeff.CFz, SurfaceViscCoeff.CMx, SurfaceViscCoeff.CMy,
+                  SurfaceViscCoeff.CMz, Surface_HF_Visc.data(), Surface_MaxHF_Visc.data()});
 
-    AllBoundViscCoeff.CFx = Allreduce(AllBoundViscCoeff.CFx);
-    AllBoundViscCoeff.CFy = Allreduce(AllBoundViscCoeff.CFy);
-    AllBoundViscCoeff.CFz = Allreduce(AllBoundViscCoeff.CFz);
-
-    AllBoundViscCoeff.CoPx = Allreduce(AllBoundViscCoeff.CoPx);
-    AllBoundViscCoeff.CoPy = Allreduce(AllBoundViscCoeff.CoPy);
-    AllBoundViscCoeff.CoPz = Allreduce(AllBoundViscCoeff.CoPz);
-
-    AllBoundViscCoeff.CT = Allreduce(AllBoundViscCoeff.CT);
-    AllBoundViscCoeff.CQ = Allreduce(AllBoundViscCoeff.CQ);
+    AllBoundViscCoeff.CEff = AllBoundViscCoeff.CL / (AllBoundViscCoeff.CD + EPS);
     AllBoundViscCoeff.CMerit = AllBoundViscCoeff.CT / (AllBoundViscCoeff.CQ + EPS);
 
-    AllBound_HF_Visc = Allreduce(AllBound_HF_Visc);
-    AllBound_MaxHF_Visc = Allreduce(AllBound_MaxHF_Visc);
-  }
-
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-
-  if (config->GetComm_Level() == COMM_FULL) {
-    int nMarkerMon = config->GetnMarker_Monitoring();
-
-    /*--- Use the same buffer for all reductions. We could avoid the copy back into
-     *    the original variable by swaping pointers, but it is safer this way... ---*/
-
-    su2double* buffer = new su2double[nMarkerMon];
-
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for (int i = 0; i < size; ++i) x[i] = buffer[i];
-    };
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CL);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CD);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CSF);
-
     for (iMarker_Monitoring = 0; iMarker_Monitoring < nMarkerMon; iMarker_Monitoring++)
       SurfaceViscCoeff.CEff[iMarker_Monitoring] =
           SurfaceViscCoeff.CL[iMarker_Monitoring] / (SurfaceViscCoeff.CD[iMarker_Monitoring] + EPS);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CFz);
-
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMx);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMy);
-    Allreduce_inplace(nMarkerMon, SurfaceViscCoeff.CMz);
-
-    Allreduce_inplace(nMarkerMon, Surface_HF_Visc.data());
-    Allreduce_inplace(nMarkerMon, Surface_MaxHF_Visc.data());
-
-    delete[] buffer;
   }
 
 #endif
@@ -67,6 +67,9 @@ public:
 
   std::vector<bool> visited;                 /*! <\brief Stores already visited points for surface applications with multiple markers. */
 
+  std::vector<passivedouble> cachedCoord;    /*!< \brief Coordinates of the assembled stiffness matrix (empty if none). */
+  bool stiffMatrixSolved = false;            /*!< \brief The stiffness matrix was already used in a solve. */
+
   /*!
    * \brief The highest level in the variable hierarchy all derived solvers can safely use,
    * CVariable is the common denominator between the FEA and Mesh deformationd variables.
@@ -243,6 +246,16 @@ public:
     return geometry->nodes->GetCoord(indexNode, iDim);
   }
 
+  /*!
+   * \brief Check if the stiffness matrix assembled by a previous call is still valid for the mesh, i.e. if the
+   *        coordinates did not change, otherwise store the current coordinates as the new reference.
+   * \note The operator does not depend on the sensitivities, its assembly and preconditioner (or factorization)
+   *       are reused for all the right hand sides smoothed while the mesh is unchanged.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return True if the matrix can be reused, the decision is consistent across ranks.
+   */
+  bool StiffMatrixIsCached(const CGeometry* geometry);
+
   /*!
    * \brief Extra entries to eliminate in the linear system
    */
@@ -67,7 +67,7 @@ protected:
     const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
     if (!geometry->nodes->GetDomain(iPoint)) return;
 
-    const bool implicit = config->GetKind_TimeIntScheme() == EULER_IMPLICIT;
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) && !frozenJacobian;
     const su2double prandtl_lam = config->GetPrandtl_Lam();
     const su2double const_diffusivity = config->GetThermalDiffusivity();
 
@@ -31,6 +31,8 @@
 #include "CFEASolver.hpp"
 #include "../variables/CMeshBoundVariable.hpp"
 #include "../variables/CMeshElement.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 
 /*!
  * \brief Mesh deformation solver (pseudo elasticity).
@@ -55,6 +57,129 @@ protected:
 
   vector<CMeshElement> element; /*!< \brief Vector which stores element information for each problem. */
 
+  bool matrix_free = false;      /*!< \brief The stiffness is applied on the fly, the Jacobian is not allocated. */
+  vector<bool> ConstrainedDOF;   /*!< \brief Degrees of freedom with known solution (matrix-free mode). */
+  su2activematrix InvDiagBlocks; /*!< \brief Inverse of the diagonal blocks of the stiffness (matrix-free mode). */
+  CSysVector<su2double> MatrixFreeAux; /*!< \brief Work vector of the matrix-free products. */
+#ifndef CODI_REVERSE_TYPE
+  CSysSolve<su2double> MatrixFreeSystem{LINEAR_SOLVER_MODE::MESH_DEFORM}; /*!< \brief Matrix-free Krylov solver. */
+#endif
+
+  /*!
+   * \brief Matrix-free product with the stiffness matrix, including the eliminated (known) degrees of freedom.
+   */
+  class StiffnessProduct final : public CMatrixVectorProduct<su2double> {
+  public:
+    CMeshSolver* const solver;
+    CGeometry* const geometry;
+    CNumerics** const numerics;
+    const CConfig* const config;
+
+    StiffnessProduct(CMeshSolver* s, CGeometry* g, CNumerics** n, const CConfig* c) :
+      solver(s), geometry(g), numerics(n), config(c) {}
+
+    inline void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+      solver->ApplyConstrainedStiffness(u, v, geometry, numerics, config);
+    }
+  };
+
+  /*!
+   * \brief Block Jacobi preconditioner of the matrix-free stiffness.
+   */
+  class BlockJacobi final : public CPreconditioner<su2double> {
+  public:
+    const CMeshSolver* const solver;
+    CGeometry* const geometry;
+    const CConfig* const config;
+
+    BlockJacobi(const CMeshSolver* s, CGeometry* g, const CConfig* c) : solver(s), geometry(g), config(c) {}
+
+    inline void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+      solver->ApplyBlockJacobi(u, v, geometry, config);
+    }
+  };
+
+  /*!
+   * \brief Eliminate the equations of a node with known solution from the linear system.
+   * \note In matrix-free mode the degrees of freedom are only flagged, the solution is kept in LinSysSol.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] val_sol - Known solution at the node.
+   */
+  void EnforceSolutionAtNode(unsigned long iPoint, const su2double* val_sol) override;
+
+  /*!
+   * \brief Eliminate one equation of a node with known solution from the linear system.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] iVar - Index of the variable.
+   * \param[in] val_sol - Known solution of the variable.
+   */
+  void EnforceSolutionAtDOF(unsigned long iPoint, unsigned short iVar, su2double val_sol) override;
+
+  /*!
+   * \brief Product of the stiffness matrix with a vector, element by element without assembling the matrix.
+   * \note Must be called by all threads, the result is communicated to the halo points.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result, v = K u.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeStiffnessProduct(const CSysVector<su2double>& u, CSysVector<su2double>& v, CGeometry *geometry,
+                               CNumerics **numerics, const CConfig *config);
+
+  /*!
+   * \brief Product of the stiffness matrix of a batch of linear simplices with a vector, added to the result.
+   * \param[in] u - Input vector.
+   * \param[in,out] v - Result, v += K u.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread), provide the material.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] batch - Indices of the elements.
+   * \param[in] nLanes - Number of elements.
+   */
+  template<size_t NDIM>
+  void StiffnessProductSimplices(const CSysVector<su2double>& u, CSysVector<su2double>& v, const CGeometry *geometry,
+                                 CNumerics **numerics, const CConfig *config, const unsigned long* batch,
+                                 unsigned short nLanes);
+
+  /*!
+   * \brief Product with the stiffness matrix whose known degrees of freedom have been eliminated,
+   *        i.e. with identity rows and columns for those, as done by CSysMatrix::EnforceSolutionAtNode.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ApplyConstrainedStiffness(const CSysVector<su2double>& u, CSysVector<su2double>& v, CGeometry *geometry,
+                                 CNumerics **numerics, const CConfig *config);
+
+  /*!
+   * \brief Compute the inverse of the diagonal blocks of the (constrained) stiffness matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeBlockJacobi(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
+  /*!
+   * \brief Apply the block Jacobi preconditioner, v = D^{-1} u.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ApplyBlockJacobi(const CSysVector<su2double>& u, CSysVector<su2double>& v, CGeometry *geometry,
+                        const CConfig *config) const;
+
+  /*!
+   * \brief Solve the linear system of the mesh deformation without assembling the stiffness matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Element kernels (one per thread).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solve_System_MatrixFree(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
   /*!
    * \brief Compute the min and max volume of the elements in the domain.
    * \param[in] geometry - Geometrical definition of the problem.
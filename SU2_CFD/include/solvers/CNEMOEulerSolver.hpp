@@ -60,6 +60,7 @@ protected:
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
   CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> ChemistryFluidModels; /*!< \brief Fluid model of each thread for the split chemistry. */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -90,6 +91,14 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Integrate the chemical source terms over the local time step of each point (operator splitting),
+   *        with an adaptive stiff (Rosenbrock) integrator. Does nothing if CHEMISTRY_SPLITTING is not active.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void IntegrateChemistry(CGeometry *geometry, CConfig *config);
+
 public:
   CNEMOEulerSolver() = delete;
 
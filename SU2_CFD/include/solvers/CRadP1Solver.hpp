@@ -35,6 +35,7 @@ private:
 protected:
 
   su2double Temperature_Inf;      /*!< \brief Temperature at the infinity. */
+  bool assembleJacobian = true;   /*!< \brief False once the (constant) matrix is frozen. */
 
   /*!
    * \brief Impose the Marshak boundary condition.
@@ -29,12 +29,15 @@
 #include <vector>
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../variables/CScalarVariable.hpp"
 #include "../variables/CFlowVariable.hpp"
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +81,14 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr;  /*!< \brief Object for (vectorized) edge flux computation. */
+  bool edgeNumericsInstantiated = false;  /*!< \brief If the creation of edgeNumerics was attempted. */
+  CNumericsSIMD* sourceNumerics = nullptr;  /*!< \brief Object for (vectorized) point source computation. */
+  bool sourceNumericsInstantiated = false;  /*!< \brief If the creation of sourceNumerics was attempted. */
+
+  bool frozenSystem = false;    /*!< \brief The (linear) system matrix is assembled only once. */
+  bool frozenJacobian = false;  /*!< \brief The matrix of the previous iteration is kept, with its preconditioner. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -88,6 +99,33 @@ class CScalarSolver : public CSolver {
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Create the vectorized numerics for the convection and diffusion terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return nullptr if the model does not support vectorization (the default).
+   */
+  inline virtual CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solver_container,
+                                                   const CConfig* config) const { return nullptr; }
+
+  /*!
+   * \brief Create the vectorized numerics for the source terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return nullptr if the model does not support vectorization (the default).
+   */
+  inline virtual CNumericsSIMD* CreateSourceNumerics(const CSolver* const* solver_container,
+                                                     const CConfig* config) const { return nullptr; }
+
+  /*!
+   * \brief Compute the source residual contribution using vectorized numerics (USE_VECTORIZATION).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the model does not support vectorized sources, the caller then uses its CNumerics.
+   */
+  bool PointSourceResidual(const CGeometry* geometry, const CSolver* const* solver_container, const CConfig* config);
+
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
    * \tparam SolverSpecificNumericsFunc - lambda-function, that implements solver specific contributions to numerics.
@@ -102,7 +140,7 @@ class CScalarSolver : public CSolver {
   FORCEINLINE void Viscous_Residual_impl(const SolverSpecificNumericsFunc& SolverSpecificNumerics, const unsigned long iEdge,
                                          const CGeometry* geometry, CSolver** solver_container, CNumerics* numerics,
                                          const CConfig* config) {
-    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) && !frozenJacobian;
     CFlowVariable* flowNodes = solver_container[FLOW_SOL] ?
         su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes()) : nullptr;
 
@@ -326,6 +364,20 @@ class CScalarSolver : public CSolver {
    */
   virtual void ComputeUnderRelaxationFactor(const CConfig* config) {}
 
+  /*!
+   * \brief Instantiate the SIMD numerics object, once, via CreateEdgeNumerics.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config);
+
+  /*!
+   * \brief Compute the convective and viscous residual contribution using vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(const CGeometry* geometry, const CConfig* config);
+
  public:
   /*!
    * \brief Destructor of the class.
@@ -482,7 +534,7 @@ class CScalarSolver : public CSolver {
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
    */
-  void ImplicitEuler_Iteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) final;
+  void ImplicitEuler_Iteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) override;
 
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time-Stepping Strategy.
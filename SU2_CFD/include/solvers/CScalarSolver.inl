@@ -28,6 +28,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config, bool conservative)
@@ -85,6 +86,8 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
+  delete sourceNumerics;
 }
 
 template <class VariableType>
@@ -100,7 +103,7 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
    * reducer strategy as we write over the entire matrix. ---*/
   if (!ReducerStrategy && !Output) {
     LinSysRes.SetValZero();
-    if (implicit) {
+    if (implicit && !frozenJacobian) {
       Jacobian.SetValZero();
     } else {
       SU2_OMP_BARRIER
@@ -109,6 +112,8 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
 
   /*--- Upwind second order reconstruction and gradients ---*/
 
+  AD::BeginTapeSection(AD::TapeSection::GRADIENTS);
+
   if (config->GetReconstructionGradientRequired()) {
     switch(config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS: SetSolution_Gradient_GG(geometry, config, -1, true); break;
@@ -122,7 +127,13 @@ void CScalarSolver<VariableType>::CommonPreprocessing(CGeometry *geometry, const
     case WEIGHTED_LEAST_SQUARES: SetSolution_Gradient_LS(geometry, config, -1); break;
   }
 
-  if (limiter && muscl) SetSolution_Limiter(geometry, config);
+  AD::EndTapeSection();
+
+  if (limiter && muscl) {
+    AD::BeginTapeSection(AD::TapeSection::LIMITERS);
+    SetSolution_Limiter(geometry, config);
+    AD::EndTapeSection();
+  }
 }
 
 template <class VariableType>
@@ -132,7 +143,8 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Define booleans that are solver specific through CConfig's GlobalParams which have to be set in CFluidIteration
    * before calling these solver functions. ---*/
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL();
+  /*--- The coarse levels of the multigrid are first order (as for the flow solvers). ---*/
+  const bool muscl = config->GetMUSCL() && (iMesh == MESH_0);
   const bool limiter = (config->GetKind_SlopeLimit() != LIMITER::NONE) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
 
@@ -151,6 +163,10 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Apply scalar advection correction terms for bounded scalar problems ---*/
   const bool bounded_scalar = numerics->GetBoundedScalar();
 
+  /*--- Vectorized edge fluxes, if the model supports them (only on the fine grid, they are second order). ---*/
+  const bool vectorized = config->GetUseVectorization() && (iMesh == MESH_0);
+  if (vectorized && !edgeNumericsInstantiated) InstantiateEdgeNumerics(solver_container, config);
+
   /*--- Static arrays of MUSCL-reconstructed flow primitives and turbulence variables (thread safety). ---*/
   su2double solution_i[MAXNVAR] = {0.0}, flowPrimVar_i[MAXNVARFLOW] = {0.0};
   su2double solution_j[MAXNVAR] = {0.0}, flowPrimVar_j[MAXNVARFLOW] = {0.0};
@@ -163,151 +179,156 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   else
     AD::StartNoSharedReading();
 
-  /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
-    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-    for (auto k = 0ul; k < color.size; ++k) {
-      auto iEdge = color.indices[k];
+  if (vectorized && edgeNumerics) {
+    /*--- Vectorized convection and diffusion. ---*/
+    EdgeFluxResidual(geometry, config);
+  } else {
+    /*--- Loop over edge colors. ---*/
+    for (auto color : EdgeColoring) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) {
+        auto iEdge = color.indices[k];
 
-      unsigned short iDim, iVar;
+        unsigned short iDim, iVar;
 
-      /*--- Points in edge and normal vectors ---*/
+        /*--- Points in edge and normal vectors ---*/
 
-      auto iPoint = geometry->edges->GetNode(iEdge, 0);
-      auto jPoint = geometry->edges->GetNode(iEdge, 1);
+        auto iPoint = geometry->edges->GetNode(iEdge, 0);
+        auto jPoint = geometry->edges->GetNode(iEdge, 1);
 
-      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+        numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-      /*--- Primitive variables w/o reconstruction ---*/
+        /*--- Primitive variables w/o reconstruction ---*/
 
-      const auto V_i = flowNodes->GetPrimitive(iPoint);
-      const auto V_j = flowNodes->GetPrimitive(jPoint);
-      numerics->SetPrimitive(V_i, V_j);
+        const auto V_i = flowNodes->GetPrimitive(iPoint);
+        const auto V_j = flowNodes->GetPrimitive(jPoint);
+        numerics->SetPrimitive(V_i, V_j);
 
-      /*--- Scalar variables w/o reconstruction ---*/
+        /*--- Scalar variables w/o reconstruction ---*/
 
-      const auto Scalar_i = nodes->GetSolution(iPoint);
-      const auto Scalar_j = nodes->GetSolution(jPoint);
-      numerics->SetScalarVar(Scalar_i, Scalar_j);
+        const auto Scalar_i = nodes->GetSolution(iPoint);
+        const auto Scalar_j = nodes->GetSolution(jPoint);
+        numerics->SetScalarVar(Scalar_i, Scalar_j);
 
-      /*--- Grid Movement ---*/
+        /*--- Grid Movement ---*/
 
-      if (dynamic_grid) numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(jPoint));
+        if (dynamic_grid) numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(jPoint));
 
-      if (muscl || musclFlow) {
-        const su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+        if (muscl || musclFlow) {
+          const su2limiterfloat *Limiter_i = nullptr, *Limiter_j = nullptr;
 
-        const auto Coord_i = geometry->nodes->GetCoord(iPoint);
-        const auto Coord_j = geometry->nodes->GetCoord(jPoint);
+          const auto Coord_i = geometry->nodes->GetCoord(iPoint);
+          const auto Coord_j = geometry->nodes->GetCoord(jPoint);
 
-        su2double Vector_ij[MAXNDIM] = {0.0};
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Vector_ij[iDim] = 0.5 * (Coord_j[iDim] - Coord_i[iDim]);
-        }
+          su2double Vector_ij[MAXNDIM] = {0.0};
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Vector_ij[iDim] = 0.5 * (Coord_j[iDim] - Coord_i[iDim]);
+          }
 
-        if (musclFlow && !bounded_scalar) {
-          /*--- Reconstruct mean flow primitive variables, note that in bounded scalar mode this is
-           * not necessary because the edge mass flux is read directly from the flow solver, instead
-           * of being computed from the primitive flow variables. ---*/
+          if (musclFlow && !bounded_scalar) {
+            /*--- Reconstruct mean flow primitive variables, note that in bounded scalar mode this is
+             * not necessary because the edge mass flux is read directly from the flow solver, instead
+             * of being computed from the primitive flow variables. ---*/
 
-          auto Gradient_i = flowNodes->GetGradient_Reconstruction(iPoint);
-          auto Gradient_j = flowNodes->GetGradient_Reconstruction(jPoint);
+            auto Gradient_i = flowNodes->GetGradient_Reconstruction(iPoint);
+            auto Gradient_j = flowNodes->GetGradient_Reconstruction(jPoint);
 
-          if (limiterFlow) {
-            Limiter_i = flowNodes->GetLimiter_Primitive(iPoint);
-            Limiter_j = flowNodes->GetLimiter_Primitive(jPoint);
-          }
-
-          for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
-            su2double Project_Grad_i = 0.0;
-            su2double Project_Grad_j = 0.0;
-            for (iDim = 0; iDim < nDim; iDim++) {
-              Project_Grad_i += Vector_ij[iDim] * Gradient_i[iVar][iDim];
-              Project_Grad_j -= Vector_ij[iDim] * Gradient_j[iVar][iDim];
-            }
             if (limiterFlow) {
-              Project_Grad_i *= Limiter_i[iVar];
-              Project_Grad_j *= Limiter_j[iVar];
+              Limiter_i = flowNodes->GetLimiter_Primitive(iPoint);
+              Limiter_j = flowNodes->GetLimiter_Primitive(jPoint);
             }
-            flowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
-            flowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
-          }
 
-          numerics->SetPrimitive(flowPrimVar_i, flowPrimVar_j);
-        }
+            for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
+              su2double Project_Grad_i = 0.0;
+              su2double Project_Grad_j = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Project_Grad_i += Vector_ij[iDim] * Gradient_i[iVar][iDim];
+                Project_Grad_j -= Vector_ij[iDim] * Gradient_j[iVar][iDim];
+              }
+              if (limiterFlow) {
+                Project_Grad_i *= Limiter_i[iVar];
+                Project_Grad_j *= Limiter_j[iVar];
+              }
+              flowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
+              flowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
+            }
 
-        if (muscl) {
-          /*--- Reconstruct scalar variables. ---*/
+            numerics->SetPrimitive(flowPrimVar_i, flowPrimVar_j);
+          }
 
-          auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-          auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+          if (muscl) {
+            /*--- Reconstruct scalar variables. ---*/
 
-          if (limiter) {
-            Limiter_i = nodes->GetLimiter(iPoint);
-            Limiter_j = nodes->GetLimiter(jPoint);
-          }
+            auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+            auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
 
-          for (iVar = 0; iVar < nVar; iVar++) {
-            su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
-            for (iDim = 0; iDim < nDim; iDim++) {
-              Project_Grad_i += Vector_ij[iDim] * Gradient_i[iVar][iDim];
-              Project_Grad_j -= Vector_ij[iDim] * Gradient_j[iVar][iDim];
-            }
             if (limiter) {
-              Project_Grad_i *= Limiter_i[iVar];
-              Project_Grad_j *= Limiter_j[iVar];
+              Limiter_i = nodes->GetLimiter(iPoint);
+              Limiter_j = nodes->GetLimiter(jPoint);
+            }
+
+            for (iVar = 0; iVar < nVar; iVar++) {
+              su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Project_Grad_i += Vector_ij[iDim] * Gradient_i[iVar][iDim];
+                Project_Grad_j -= Vector_ij[iDim] * Gradient_j[iVar][iDim];
+              }
+              if (limiter) {
+                Project_Grad_i *= Limiter_i[iVar];
+                Project_Grad_j *= Limiter_j[iVar];
+              }
+              solution_i[iVar] = Scalar_i[iVar] + Project_Grad_i;
+              solution_j[iVar] = Scalar_j[iVar] + Project_Grad_j;
             }
-            solution_i[iVar] = Scalar_i[iVar] + Project_Grad_i;
-            solution_j[iVar] = Scalar_j[iVar] + Project_Grad_j;
-          }
 
-          numerics->SetScalarVar(solution_i, solution_j);
+            numerics->SetScalarVar(solution_i, solution_j);
+          }
         }
-      }
 
-      /*--- Convective flux ---*/
-      su2double EdgeMassFlux = 0.0;
-      if (bounded_scalar) {
-        EdgeMassFlux = edgeMassFluxes[iEdge];
-        numerics->SetMassFlux(EdgeMassFlux);
-      }
+        /*--- Convective flux ---*/
+        su2double EdgeMassFlux = 0.0;
+        if (bounded_scalar) {
+          EdgeMassFlux = edgeMassFluxes[iEdge];
+          numerics->SetMassFlux(EdgeMassFlux);
+        }
 
-      /*--- Update convective residual value ---*/
+        /*--- Update convective residual value ---*/
 
-      auto residual = numerics->ComputeResidual(config);
+        auto residual = numerics->ComputeResidual(config);
 
-      if (ReducerStrategy) {
-        EdgeFluxes.SetBlock(iEdge, residual);
-        if (implicit) Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
-      } else {
-        LinSysRes.AddBlock(iPoint, residual);
-        LinSysRes.SubtractBlock(jPoint, residual);
-        if (implicit) Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-      }
+        if (ReducerStrategy) {
+          EdgeFluxes.SetBlock(iEdge, residual);
+          if (implicit) Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+        } else {
+          LinSysRes.AddBlock(iPoint, residual);
+          LinSysRes.SubtractBlock(jPoint, residual);
+          if (implicit) Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+        }
 
-      /*--- Apply convective flux correction to negate the effects of flow divergence in case of incompressible flow.
-       * Note that for the bounded scalar model, we explicitly put div(v)=0.
-       * If the ReducerStrategy is used, the corrections need to be applied in a loop over nodes
-       * to avoid race conditions in accessing nodes shared by edges handled by different threads. ---*/
+        /*--- Apply convective flux correction to negate the effects of flow divergence in case of incompressible flow.
+         * Note that for the bounded scalar model, we explicitly put div(v)=0.
+         * If the ReducerStrategy is used, the corrections need to be applied in a loop over nodes
+         * to avoid race conditions in accessing nodes shared by edges handled by different threads. ---*/
 
-      if (bounded_scalar && !ReducerStrategy) {
-        LinSysRes.AddBlock(iPoint, nodes->GetSolution(iPoint), -EdgeMassFlux);
-        LinSysRes.AddBlock(jPoint, nodes->GetSolution(jPoint), EdgeMassFlux);
+        if (bounded_scalar && !ReducerStrategy) {
+          LinSysRes.AddBlock(iPoint, nodes->GetSolution(iPoint), -EdgeMassFlux);
+          LinSysRes.AddBlock(jPoint, nodes->GetSolution(jPoint), EdgeMassFlux);
 
-        if (implicit) {
-          Jacobian.AddVal2Diag(iPoint, -EdgeMassFlux);
-          Jacobian.AddVal2Diag(jPoint, EdgeMassFlux);
+          if (implicit) {
+            Jacobian.AddVal2Diag(iPoint, -EdgeMassFlux);
+            Jacobian.AddVal2Diag(jPoint, EdgeMassFlux);
+          }
         }
-      }
 
-      /*--- Viscous contribution. ---*/
+        /*--- Viscous contribution. ---*/
 
-      Viscous_Residual(iEdge, geometry, solver_container,
-                       numerics_container[VISC_TERM + omp_get_thread_num() * MAX_TERMS], config);
-    }
-    END_SU2_OMP_FOR
-  }  // end color loop
+        Viscous_Residual(iEdge, geometry, solver_container,
+                         numerics_container[VISC_TERM + omp_get_thread_num() * MAX_TERMS], config);
+      }
+      END_SU2_OMP_FOR
+    }  // end color loop
+  }
 
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
@@ -315,28 +336,106 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
 
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
-    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+    if (implicit) Jacobian.SetDiagonalAsColumnSum(geometry);
+  }
 
-    /*--- Bounded scalar correction that cannot be applied in the edge loop when using the ReducerStrategy. ---*/
-    if (bounded_scalar) {
-      SU2_OMP_FOR_STAT(omp_chunk_size)
-      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
-        const auto* solution = nodes->GetSolution(iPoint);
-        su2double divergence = 0;
-
-        for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
-          const auto sign = (iPoint == geometry->edges->GetNode(iEdge,0)) ? 1 : -1;
-          const su2double EdgeMassFlux = sign * edgeMassFluxes[iEdge];
-          divergence += EdgeMassFlux;
-          LinSysRes.AddBlock(iPoint, solution, -EdgeMassFlux);
-        }
-        if (implicit) {
-          Jacobian.AddVal2Diag(iPoint, -divergence);
-        }
+  /*--- Bounded scalar correction that cannot be applied in the edge loop when using the ReducerStrategy,
+   * or the vectorized edge fluxes. ---*/
+  if (bounded_scalar && (ReducerStrategy || edgeNumerics)) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      const auto* solution = nodes->GetSolution(iPoint);
+      su2double divergence = 0;
+
+      for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+        const auto sign = (iPoint == geometry->edges->GetNode(iEdge,0)) ? 1 : -1;
+        const su2double EdgeMassFlux = sign * edgeMassFluxes[iEdge];
+        divergence += EdgeMassFlux;
+        LinSysRes.AddBlock(iPoint, solution, -EdgeMassFlux);
       }
-      END_SU2_OMP_FOR
+      if (implicit) {
+        Jacobian.AddVal2Diag(iPoint, -divergence);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(const CGeometry* geometry, const CConfig* config) {
+  /*--- Fluxes of the edges [k, k+Double::Size) of each color, the remainder is masked. ---*/
+  for (const auto& color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k+j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k+j*in];
+      }
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class VariableType>
+bool CScalarSolver<VariableType>::PointSourceResidual(const CGeometry* geometry, const CSolver* const* solver_container,
+                                                      const CConfig* config) {
+  if (!config->GetUseVectorization()) return false;
+
+  if (!sourceNumericsInstantiated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      sourceNumerics = CreateSourceNumerics(solver_container, config);
+      sourceNumericsInstantiated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  if (!sourceNumerics) return false;
+
+  AD::StartNoSharedReading();
+
+  /*--- Sources of the points [k, k+Double::Size), the remainder is masked. Each block only
+   *    updates its own diagonal entries, therefore no coloring is needed. ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, Double::Size))
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k+j*in;
     }
+    sourceNumerics->ComputeSource(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
   }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+
+  return true;
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
+        (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
+      SU2_MPI::Error("When using vectorization, the EDGE_COLORING_GROUP_SIZE must be divisible "
+                     "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
+    }
+    /*--- Models without vectorized numerics keep using the CNumerics of the container. ---*/
+    edgeNumerics = CreateEdgeNumerics(solver_container, config);
+    edgeNumericsInstantiated = true;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 template <class VariableType>
@@ -364,10 +463,7 @@ void CScalarSolver<VariableType>::BC_Periodic(CGeometry* geometry, CSolver** sol
    accumulated corectly during the communications. For implicit calculations
    the Jacobians and linear system are also correctly adjusted here. ---*/
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_RESIDUAL);
-  }
+  PeriodicComms(geometry, config, PERIODIC_RESIDUAL);
 }
 
 template <class VariableType>
@@ -447,6 +543,8 @@ void CScalarSolver<VariableType>::SetTime_Step(CGeometry *geometry, CSolver **so
 template <class VariableType>
 void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry, CSolver** solver_container,
                                                            CConfig* config) {
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::IMPLICIT_SETUP);
+
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
 
@@ -455,6 +553,8 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
   su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  const bool multigrid = config->GetMG_ScalarSolvers();
+
   /*--- Build implicit system ---*/
 
   SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
@@ -464,12 +564,17 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
 
     if (dt != 0.0) {
       su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Vol / dt);
+      if (!frozenJacobian) Jacobian.AddVal2Diag(iPoint, Vol / dt);
     } else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
       LinSysRes.SetBlock_Zero(iPoint);
+      if (multigrid) nodes->SetRes_TruncErrorZero(iPoint);
     }
 
+    /*--- Multigrid contribution to residual. ---*/
+
+    if (multigrid) LinSysRes.AddBlock(iPoint, nodes->GetResTruncError(iPoint));
+
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -526,13 +631,7 @@ void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry,
     }
   }
 
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic() / 2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
-  }
-
-  InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
-  CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+  PeriodicAndHaloComms(geometry, config, PERIODIC_IMPLICIT, MPI_QUANTITIES::SOLUTION);
 }
 
 template <class VariableType>
@@ -549,11 +648,16 @@ void CScalarSolver<VariableType>::ImplicitEuler_Iteration(CGeometry* geometry, C
   }
   END_SU2_OMP_FOR
 
+  /*--- The preconditioner of a frozen matrix is reused. ---*/
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(System.SetMatrixUnchanged(frozenJacobian);)
+
   auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
     SetIterLinSolver(iter);
     SetResLinSolver(System.GetResidual());
+    frozenJacobian = frozenSystem;
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
@@ -567,11 +671,16 @@ void CScalarSolver<VariableType>::ExplicitEuler_Iteration(CGeometry* geometry, C
   su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  const bool multigrid = config->GetMG_ScalarSolvers();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     const su2double dt = nodes->GetDelta_Time(iPoint);
     const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
 
+    /*--- Multigrid contribution to residual. ---*/
+    if (multigrid) LinSysRes.AddBlock(iPoint, nodes->GetResTruncError(iPoint));
+
     for (auto iVar = 0u; iVar < nVar; iVar++) {
       /*--- "Add" residual at (iPoint,iVar) to local residual variables. ---*/
       ResidualReductions_PerThread(iPoint, iVar, LinSysRes(iPoint, iVar), resRMS, resMax, idxMax);
@@ -669,7 +778,7 @@ void CScalarSolver<VariableType>::SetResidual_DualTime(CGeometry* geometry, CSol
       }
 
       /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
-      if (implicit) {
+      if (implicit && !frozenJacobian) {
         if (first_order) Jacobian.AddVal2Diag(iPoint, Volume_nP1 / TimeStep);
         if (second_order) Jacobian.AddVal2Diag(iPoint, (Volume_nP1 * 3.0) / (2.0 * TimeStep));
       }
@@ -816,7 +925,7 @@ void CScalarSolver<VariableType>::SetResidual_DualTime(CGeometry* geometry, CSol
       }
 
       /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
-      if (implicit) {
+      if (implicit && !frozenJacobian) {
         if (first_order) Jacobian.AddVal2Diag(iPoint, Volume_nP1 / TimeStep);
         if (second_order) Jacobian.AddVal2Diag(iPoint, (Volume_nP1 * 3.0) / (2.0 * TimeStep));
       }
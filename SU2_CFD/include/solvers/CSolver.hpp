@@ -36,6 +36,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <set>
 #include <stdlib.h>
 #include <stdio.h>
@@ -91,6 +92,13 @@ protected:
   su2double Max_CFL_Local;  /*!< \brief Maximum value of the CFL across all the control volumes. */
   su2double Min_CFL_Local;  /*!< \brief Minimum value of the CFL across all the control volumes. */
   su2double Avg_CFL_Local;  /*!< \brief Average value of the CFL across all the control volumes. */
+  su2double Reduced_CFL_Fraction; /*!< \brief Fraction of the control volumes whose CFL was last reduced. */
+  unsigned long nBacktrack_CFL;   /*!< \brief Number of global CFL backtracks (local residual CFL adaption). */
+  vector<su2double> LocalResidual;     /*!< \brief Residual norm of each point (local residual CFL adaption). */
+  vector<su2double> LocalResidual_Old; /*!< \brief Residual norm of each point at the previous CFL adaption. */
+  vector<su2double> TimeExtrapolation_Res0; /*!< \brief Initial RMS residuals of the previous time step. */
+  bool extrapolatedTimeStep = false;  /*!< \brief The current time step started from extrapolated time levels. */
+  bool skipTimeExtrapolation = false; /*!< \brief The next time step starts from the solution at time n. */
   vector<su2double> Residual_RMS;      /*!< \brief Vector with the mean residual for each variable. */
   vector<su2double> Residual_Max;      /*!< \brief Vector with the maximal residual for each variable. */
   vector<su2double> Residual_BGS;      /*!< \brief Vector with the mean residual for each variable for BGS subiterations. */
@@ -151,6 +159,19 @@ protected:
 
   string SolverName;      /*!< \brief Store the name of the solver for output purposes. */
 
+  /*--- Deferred completion of point-to-point comms, to overlap them with computation. ---*/
+  bool deferCompleteComms = false;     /*!< \brief The next call to CompleteComms only marks the comms as pending. */
+  bool pendingComms = false;           /*!< \brief Comms were initiated but not completed. */
+  MPI_QUANTITIES pendingCommsType{};   /*!< \brief Quantity of the pending comms. */
+
+  /*!
+   * \brief Complete the comms deferred by "deferCompleteComms", if there are any.
+   * \note Must be called by all threads, this is done automatically before initiating new comms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void CompletePendingComms(CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Pure virtual function, all derived solvers MUST implement a method returning their "nodes".
    * \note Don't forget to call SetBaseClassPointerToNodes() in the constructor of the derived CSolver.
@@ -174,12 +195,39 @@ protected:
 private:
 
   /*!
-   * \brief Interpolate Restart_Data after reading it.
+   * \brief Interpolate Restart_Data after reading it, each target point takes the values of the
+   *        nearest point of the restart (the coordinates of the old mesh are the first fields).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
   void InterpolateRestartData(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Read the data of a compressed binary restart file into Restart_Data, after the header was read.
+   * \note Each rank reads (collectively) and decompresses only the blocks that contain its points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] fname - Name of the restart file.
+   */
+  void ReadCompressedRestartData(const CGeometry *geometry, const CConfig *config, const string& fname);
+
+  /*!
+   * \brief Restart data kept in memory instead of a file.
+   */
+  struct RestartInMemory {
+    vector<string> fields;       /*!< \brief Names of the fields, starting with "Point_ID". */
+    vector<passivedouble> data;  /*!< \brief Values for the domain points, in the order of GetDomainPoints_GlobalOrder. */
+  };
+  static map<string, RestartInMemory> RestartsInMemory;  /*!< \brief Restarts in memory, by file name without extension. */
+
+  /*!
+   * \brief Set Restart_Data from a restart kept in memory, if there is one with this name.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] filename - Name of the restart file, without extension.
+   * \return True if the restart was found in memory.
+   */
+  bool ReadRestartInMemory(const CGeometry *geometry, const string& filename);
+
   /*--- Private to prevent use by derived solvers, each solver MUST have its own "nodes" member of the
    most derived type possible, e.g. CEulerSolver has nodes of CEulerVariable* and not CVariable*.
    This variable is to avoid two virtual functions calls per call i.e. CSolver::GetNodes() returns
@@ -202,12 +250,18 @@ public:
   string* OutputHeadingNames;               /*!< \brief vector of strings to store the headings for the exra variables */
 
   CVerificationSolution *VerificationSolution; /*!< \brief Verification solution class used within the solver. */
+  su2activematrix VerificationSourceTerms;      /*!< \brief MMS source terms of the domain points. */
+  vector<su2activematrix> VerificationBCStates; /*!< \brief Boundary states of the verification solution per vertex. */
 
   vector<string> fields;
 
 #ifdef HAVE_LIBROM
   std::unique_ptr<CAROM::BasisGenerator> u_basis_generator;
 #endif
+  vector<CSysVector<su2mixedfloat> > ROM_Basis;    /*!< \brief POD modes of the online reduced order model. */
+  vector<CSysVector<su2mixedfloat> > ROM_JacBasis; /*!< \brief Jacobian times the POD modes. */
+  CSysVector<su2mixedfloat> ROM_Rhs;               /*!< \brief Right hand side of the full order system. */
+  vector<passivedouble> ROM_System;                /*!< \brief Reduced system, nModes x (nModes+1), column major. */
 
   /*!
    * \brief Constructor of the class.
@@ -244,15 +298,23 @@ public:
                            unsigned short &COUNT_PER_POINT,
                            unsigned short &MPI_TYPE) const;
 
+  /*!
+   * \brief Subsets of the point-to-point messages, those that do not contain points updated by periodic comms
+   *        can be sent together with the periodic comms.
+   */
+  enum class P2P_SUBSET {ALL, NOT_PERIODIC, PERIODIC};
+
   /*!
    * \brief Routine to load a solver quantity into the data structures for MPI point-to-point communication and to launch non-blocking sends and recvs.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config   - Definition of the particular problem.
    * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] subset   - Messages to send, NOT_PERIODIC also posts all recvs, PERIODIC sends the remaining messages.
    */
   void InitiateComms(CGeometry *geometry,
                      const CConfig *config,
-                     MPI_QUANTITIES commType);
+                     MPI_QUANTITIES commType,
+                     P2P_SUBSET subset = P2P_SUBSET::ALL);
 
   /*!
    * \brief Routine to complete the set of non-blocking communications launched by InitiateComms() and unpacking of the data in the solver class.
@@ -304,6 +366,30 @@ public:
                              unsigned short val_periodic_index,
                              unsigned short commType);
 
+  /*!
+   * \brief Periodic communication of all pairs of periodic markers, in a single exchange (val_periodic_index = 0)
+   *        when no point is on more than one pair, otherwise one pair after the other.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void PeriodicComms(CGeometry *geometry,
+                     const CConfig *config,
+                     unsigned short commType);
+
+  /*!
+   * \brief Periodic communication of a quantity followed by the halo (point-to-point) communication of the result.
+   *        The halo messages without periodic points are sent in the same phase as the periodic messages.
+   * \param[in] geometry     - Geometrical definition of the problem.
+   * \param[in] config       - Definition of the particular problem.
+   * \param[in] periodicType - Enumerated type for the periodic quantity (PERIODIC_NONE for halo comms only).
+   * \param[in] commType     - Enumerated type for the halo quantity.
+   */
+  void PeriodicAndHaloComms(CGeometry *geometry,
+                            const CConfig *config,
+                            unsigned short periodicType,
+                            MPI_QUANTITIES commType);
+
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -393,6 +479,21 @@ public:
    */
   inline su2double GetAvg_CFL_Local(void) const { return Avg_CFL_Local; }
 
+  /*!
+   * \brief Get the fraction of the control volumes whose CFL number was reduced by the last adaption.
+   */
+  inline su2double GetReduced_CFL_Fraction(void) const { return Reduced_CFL_Fraction; }
+
+  /*!
+   * \brief Get the fraction of the points that are updated (not frozen by the active set).
+   */
+  inline virtual su2double GetActivePointFraction(void) const { return 1.0; }
+
+  /*!
+   * \brief Get the number of global CFL backtracks performed by the local residual CFL adaption.
+   */
+  inline unsigned long GetnBacktrack_CFL(void) const { return nBacktrack_CFL; }
+
   /*!
    * \brief Get the number of variables of the problem.
    */
@@ -652,6 +753,21 @@ public:
                                                 unsigned short iMesh,
                                                 unsigned short RunTime_EqSystem) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline virtual void JFNK_SpaceTimeIntegration(CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CNumerics **numerics,
+                                                CConfig *config,
+                                                unsigned short iMesh,
+                                                unsigned short RunTime_EqSystem) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1420,6 +1536,29 @@ public:
    */
   void ResetCFLAdapt();
 
+  /*!
+   * \brief Reset the state of the nonlinear iterations (under-relaxation, CFL adaption) to iterate
+   *        again from the current solution, e.g. after the boundary conditions or freestream are modified.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  virtual void ResetNonlinearIterations(const CConfig* config, unsigned short iMesh);
+
+  /*!
+   * \brief Initialize the solution of a new physical time step (dual time stepping) by linear extrapolation
+   *        of the time levels n and n-1, if TIME_EXTRAPOLATION is active.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ExtrapolateSolutionInTime(const CConfig *config);
+
+  /*!
+   * \brief Compare the RMS residuals of the first inner iteration with the ones of the previous time step,
+   *        if they grew by more than TIME_EXTRAPOLATION_TOL the extrapolated solution is replaced by the
+   *        solution at time n, and the next time step is not extrapolated.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CheckTimeExtrapolation(const CConfig *config);
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -2878,6 +3017,11 @@ public:
    */
   inline virtual void UpdateFarfieldVelocity(const CConfig* config) {}
 
+  /*!
+   * \brief Update the freestream quantities that depend on the Mach number (after it is changed in the config).
+   */
+  inline virtual void UpdateFreestreamMach(const CConfig* config) {}
+
   /*!
    * \brief A virtual member
    * \param[in] iMarker - Marker identifier.
@@ -3373,6 +3517,27 @@ public:
                                   int val_iter,
                                   bool val_update_geo) { }
 
+  /*!
+   * \brief Keep restart data in memory, the restart readers use it instead of the file with the same name.
+   * \note The data is local to each rank, it must be stored for the same partition that reads it.
+   * \param[in] filename - Name of the restart file, without extension.
+   * \param[in] fields - Names of the fields, starting with "Point_ID".
+   * \param[in] data - Values for the domain points (fields.size()-1 per point), in the order of GetDomainPoints_GlobalOrder.
+   */
+  static void StoreRestartInMemory(const string& filename, vector<string> fields, vector<passivedouble> data);
+
+  /*!
+   * \brief Release a restart kept in memory.
+   * \param[in] filename - Name of the restart file, without extension.
+   */
+  static void EraseRestartInMemory(const string& filename) { RestartsInMemory.erase(filename); }
+
+  /*!
+   * \brief Check if a restart is kept in memory.
+   * \param[in] filename - Name of the restart file, without extension.
+   */
+  static bool IsRestartInMemory(const string& filename) { return RestartsInMemory.count(filename) != 0; }
+
   /*!
    * \brief Read a native SU2 restart file in ASCII format.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3792,6 +3957,12 @@ public:
    */
   inline virtual void GatherInOutAverageValues(CConfig *config, CGeometry *geometry) { }
 
+  /*!
+   * \brief virtual member.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CompleteInOutAverageValues(const CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] val_marker - bound marker.
@@ -4291,6 +4462,13 @@ public:
    */
   inline virtual bool GetHasHybridParallel() const { return false; }
 
+  /*!
+   * \brief Freeze the gradients and limiters, i.e. keep their current values during preprocessing.
+   * \note Used by matrix-free products of Newton-Krylov methods to re-evaluate only the fluxes.
+   * \param[in] frozen - Whether the gradients and limiters are frozen.
+   */
+  inline virtual void SetFrozenGradients(bool frozen) { }
+
   /*!
    * \brief Get values for streamwise periodic flow: delta P, m_dot, inlet T, integrated heat, etc.
    * \return Struct holding streamwise periodic values.
@@ -4306,7 +4484,18 @@ public:
   void SavelibROM(CGeometry *geometry, CConfig *config, bool converged);
 
   /*!
-   * \brief Interpolate variables to a coarser grid level.
+   * \brief Solve the implicit system (Jacobian, LinSysRes) on the POD basis of a previous SAVE_LIBROM run,
+   *        LinSysSol is set to the update in the span of the basis.
+   * \note LSPG solves (J Phi)^T (J Phi) q = (J Phi)^T b, Galerkin solves Phi^T J Phi q = Phi^T b.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Relative residual of the full order system for the reduced solution.
+   */
+  su2double SolveReducedOrder(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Interpolate variables to a coarser grid level (volume weighted average of the children), with the
+   *        transfer operator of the coarse grid, which is applied to all variables of each point at once.
    * \note Halo values are not communicated in this function.
    * \param[in] geoFine - Fine grid.
    * \param[in] varsFine - Matrix of variables on the fine grid.
@@ -4315,19 +4504,20 @@ public:
    */
   inline static void MultigridRestriction(const CGeometry& geoFine, const su2activematrix& varsFine,
                                           const CGeometry& geoCoarse, su2activematrix& varsCoarse) {
+    const auto& children = geoCoarse.GetMGTransferPattern();
+    const auto& weights = geoCoarse.GetMGTransferWeights();
+    const auto nVar = varsCoarse.cols();
+
     SU2_OMP_FOR_STAT(roundUpDiv(geoCoarse.GetnPointDomain(), omp_get_num_threads()))
     for (auto iPointCoarse = 0ul; iPointCoarse < geoCoarse.GetnPointDomain(); ++iPointCoarse) {
 
-      for (auto iVar = 0ul; iVar < varsCoarse.cols(); iVar++) {
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
         varsCoarse(iPointCoarse, iVar) = 0.0;
       }
-      const su2double scale = 1 / geoCoarse.nodes->GetVolume(iPointCoarse);
-
-      for (auto iChildren = 0ul; iChildren < geoCoarse.nodes->GetnChildren_CV(iPointCoarse); ++iChildren) {
-        const auto iPointFine = geoCoarse.nodes->GetChildren_CV(iPointCoarse, iChildren);
-        const su2double w = geoFine.nodes->GetVolume(iPointFine) * scale;
-        for (auto iVar = 0ul; iVar < varsCoarse.cols(); ++iVar) {
-          varsCoarse(iPointCoarse, iVar) += w * varsFine(iPointFine, iVar);
+      for (auto k = children.outerPtr()[iPointCoarse]; k < children.outerPtr()[iPointCoarse + 1]; ++k) {
+        const auto iPointFine = children.innerIdx()[k];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          varsCoarse(iPointCoarse, iVar) += weights[k] * varsFine(iPointFine, iVar);
         }
       }
     }
@@ -4345,6 +4535,28 @@ protected:
                                unsigned short nVar,
                                CConfig        *config);
 
+  /*!
+   * \brief Get the MMS source terms of the domain points (without the volume), they only depend on the
+   *        coordinates and time, and are therefore only computed once for steady problems on static meshes.
+   * \note Must be called by all threads.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Source terms, nPointDomain by nVar.
+   */
+  const su2activematrix& GetVerificationSourceTerms(const CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Get the states of the verification solution at the vertices of a marker, computed once for
+   *        steady problems on static meshes.
+   * \note Must be called by all threads.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Marker index.
+   * \return States, nVertex by nVar.
+   */
+  const su2activematrix& GetVerificationBCStates(const CGeometry *geometry, const CConfig *config,
+                                                 unsigned short val_marker);
+
   /*!
    * \brief "Add" residual at (iPoint,iVar) to residual variables local to the thread.
    *  \param[in] iPoint - Point index.
@@ -107,6 +107,13 @@ class CSpeciesFlameletSolver final : public CSpeciesSolver {
   unsigned long SetPreferentialDiffusionScalars(const CConfig* config, CFluidModel* fluid_model_local,
                                                 unsigned long iPoint, const vector<su2double>& scalars);
 
+  /*!
+   * \brief Create the vectorized numerics, not available with preferential diffusion.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const override;
+
  public:
   /*!
    * \brief Define a Flamelet Generated Manifold species solver.
@@ -41,6 +41,13 @@ class CSpeciesSolver : public CScalarSolver<CSpeciesVariable> {
   unsigned short Inlet_Position;             /*!< \brief Column index for scalar variables in inlet files. */
   vector<su2activematrix> Inlet_SpeciesVars; /*!< \brief Species variables at inlet profiles. */
 
+  /*!
+   * \brief Create the vectorized numerics for the convection and diffusion terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const override;
+
  public:
   /*!
    * \brief Constructor of the class.
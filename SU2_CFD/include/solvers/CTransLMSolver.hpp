@@ -45,6 +45,20 @@ private:
 
   TransLMCorrelations TransCorrelations;
 
+  /*!
+   * \brief Create the vectorized numerics for the convection and diffusion terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const override;
+
+  /*!
+   * \brief Create the vectorized numerics for the source terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateSourceNumerics(const CSolver* const* solver_container, const CConfig* config) const override;
+
 public:
   /*!
    * \overload
@@ -41,6 +41,17 @@ class CTurbSASolver final : public CTurbSolver {
 private:
   su2double nu_tilde_Engine, nu_tilde_ActDisk;
 
+  su2activematrix DES_Delta;          /*!< \brief Largest coordinate differences to the neighbors (ZDES). */
+  su2activematrix DES_NeighborDelta;  /*!< \brief Coordinate differences to each neighbor (EDDES), as GetPoints. */
+  bool DES_GeometryReady = false;     /*!< \brief The geometric parts of the length scale are computed. */
+
+  /*!
+   * \brief Compute the geometric (flow independent) parts of the DES length scales.
+   * \param[in] geometry - Geometrical definition.
+   * \param[in] kindHybridRANSLES - Kind of hybrid RANS/LES model.
+   */
+  void SetDES_GeometricLengths(const CGeometry *geometry, unsigned short kindHybridRANSLES);
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Solver container
@@ -296,6 +296,11 @@ public:
    */
   inline su2double GetTke_Inf(void) const override { return Solution_Inf[0]; }
 
+  /*!
+   * \brief Update the farfield turbulence variables, which depend on the magnitude of the freestream velocity.
+   */
+  void UpdateFarfieldVelocity(const CConfig* config) override;
+
   /*!
    * \brief Get the value of the turbulent frequency.
    * \return Value of the turbulent frequency.
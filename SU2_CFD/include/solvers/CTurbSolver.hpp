@@ -42,6 +42,32 @@ protected:
 
   vector<su2activematrix> Inlet_TurbVars;  /*!< \brief Turbulence variables at inlet profiles */
 
+  /*--- Single linear system of the mean flow and turbulence equations (COUPLED_TURBULENCE_SOLVE),
+   * the flow variables are followed by the turbulence variables in each block. ---*/
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> CoupledJacobian; /*!< \brief Jacobian of the coupled system. */
+  CSysSolve<su2mixedfloat> CoupledSystem;    /*!< \brief Linear solver of the coupled system. */
+#else
+  CSysMatrix<su2double> CoupledJacobian;
+  CSysSolve<su2double> CoupledSystem;
+#endif
+  CSysVector<su2double> CoupledRes; /*!< \brief Right hand side of the coupled system. */
+  CSysVector<su2double> CoupledSol; /*!< \brief Solution of the coupled system. */
+
+  /*!
+   * \brief Allocate the coupled system of the mean flow and turbulence equations, if it is used.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeCoupledSystem(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Create the vectorized numerics for the convection and diffusion terms of the model.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const override;
+
 public:
   /*!
    * \brief Destructor of the class.
@@ -110,6 +136,16 @@ public:
    */
   void LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig* config, int val_iter, bool val_update_geo) override;
 
+  /*!
+   * \brief Update the solution using an implicit solver, with COUPLED_TURBULENCE_SOLVE the systems of the mean flow
+   *        (prepared but not solved by the flow solver) and of the turbulence model are solved together, and the
+   *        solutions of both solvers are updated.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ImplicitEuler_Iteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) final;
+
   /*!
    * \brief Impose fixed values to turbulence quantities.
    * \details Turbulence quantities are set to far-field values in an upstream half-plane
@@ -135,6 +135,18 @@ class CEulerVariable : public CFlowVariable {
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a range of points, evaluating the fluid model
+   *        in blocks of points (SetTDStateBlock_rhoe), or retrieving the blocks of a batch (GetTDStateBatch).
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] iPointEnd - One past the last point of the range.
+   * \param[in] FluidModel - Fluid model.
+   * \param[in] batch - The fluid model was evaluated for all points (SetTDStateBatch_rhoe).
+   * \return Number of non-physical points, their solution is reset to the old solution as in SetPrimVar.
+   */
+  unsigned long SetPrimVarBlock(unsigned long iPointBegin, unsigned long iPointEnd, CFluidModel *FluidModel,
+                                bool batch = false);
+
   /*!
    * \brief A virtual member.
    */
@@ -41,7 +41,7 @@ class CFlowVariable : public CVariable {
                                                reconstruction for the convective term */
   CVectorOfMatrix
       Gradient_Aux; /*!< \brief Auxiliary structure to store a second gradient for reconstruction, if required. */
-  MatrixType Limiter_Primitive; /*!< \brief Limiter of the primitive variables. */
+  LimiterType Limiter_Primitive; /*!< \brief Limiter of the primitive variables. */
   VectorType Velocity2;         /*!< \brief Squared norm of velocity. */
 
   MatrixType Solution_New; /*!< \brief New solution container for Classical RK4. */
@@ -52,6 +52,20 @@ class CFlowVariable : public CVariable {
   MatrixType Vorticity; /*!< \brief Vorticity of the flow field. */
   VectorType StrainMag; /*!< \brief Magnitude of rate of strain tensor. */
 
+  MatrixType TransportCache;          /*!< \brief Transport properties of the last evaluation (see CFluidModel). */
+  su2vector<bool> TransportCacheHit;  /*!< \brief Whether the last transport properties came from the cache. */
+  su2double TransportCacheTol = 0.0;  /*!< \brief Relative tolerance for reusing the cached transport properties. */
+
+  /*!
+   * \brief Compute the laminar viscosity and thermal conductivity of a point with the fluid model, reusing the
+   *        values of the previous evaluation if the state of the point changed little (TRANSPORT_CACHE_TOLERANCE).
+   * \param[in] iPoint - Point index.
+   * \param[in] FluidModel - Fluid model, set to the state of the point.
+   * \param[out] mu - Laminar viscosity.
+   * \param[out] kt - Thermal conductivity.
+   */
+  void ComputeTransportProperties(unsigned long iPoint, CFluidModel* FluidModel, su2double& mu, su2double& kt);
+
   /*!
    * \brief Constructor of the class.
    * \note This class is not meant to be instantiated directly, it is only a building block.
@@ -83,6 +97,14 @@ class CFlowVariable : public CVariable {
     return static_cast<T>(NonPhysicalEdgeCounter[iEdge] > 0);
   }
 
+  /*!
+   * \brief Get whether the transport properties of a point were reused in the last update of the primitives.
+   * \param[in] iPoint - Point index.
+   */
+  inline bool GetTransportCacheHit(unsigned long iPoint) const {
+    return TransportCacheHit.size() != 0 && TransportCacheHit(iPoint);
+  }
+
   /*!
    * \brief Get a primitive variable.
    * \param[in] iPoint - Point index.
@@ -193,14 +215,14 @@ class CFlowVariable : public CVariable {
    * \param[in] iPoint - Point index.
    * \return Value of the primitive variables gradient.
    */
-  inline su2double* GetLimiter_Primitive(unsigned long iPoint) final { return Limiter_Primitive[iPoint]; }
+  inline su2limiterfloat* GetLimiter_Primitive(unsigned long iPoint) final { return Limiter_Primitive[iPoint]; }
 
   /*!
    * \brief Get the primitive variables limiter.
    * \return Primitive variables limiter for the entire domain.
    */
-  inline MatrixType& GetLimiter_Primitive() final { return Limiter_Primitive; }
-  inline const MatrixType& GetLimiter_Primitive() const final { return Limiter_Primitive; }
+  inline LimiterType& GetLimiter_Primitive() final { return Limiter_Primitive; }
+  inline const LimiterType& GetLimiter_Primitive() const final { return Limiter_Primitive; }
 
   /*!
    * \brief Get the new solution of the problem (Classical RK4).
@@ -255,6 +277,11 @@ class CFlowVariable : public CVariable {
   inline su2double* GetVorticity(unsigned long iPoint) final { return Vorticity[iPoint]; }
   inline const su2double* GetVorticity(unsigned long iPoint) const final { return Vorticity[iPoint]; }
 
+  /*!
+   * \brief Get the entire matrix of vorticity.
+   */
+  inline const MatrixType& GetVorticity() const { return Vorticity; }
+
   /*!
    * \brief Get the magnitude of rate of strain.
    * \param[in] iPoint - Point index.
@@ -267,4 +294,5 @@ class CFlowVariable : public CVariable {
    * \return Vector of magnitudes.
    */
   inline su2activevector& GetStrainMag() { return StrainMag; }
+  inline const su2activevector& GetStrainMag() const { return StrainMag; }
 };
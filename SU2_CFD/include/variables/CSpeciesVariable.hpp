@@ -74,4 +74,10 @@ class CSpeciesVariable : public CScalarVariable {
    * \return Pointer to the mass diffusivities
    */
   inline const su2double* GetDiffusivity(unsigned long iPoint) const { return Diffusivity[iPoint]; }
+
+  /*!
+   * \brief Get the mass diffusivities of all points.
+   * \return Reference to the mass diffusivities.
+   */
+  inline const MatrixType& GetDiffusivity() const { return Diffusivity; }
 };
@@ -51,6 +51,7 @@ class CVariable {
 protected:
   using VectorType = C2DContainer<unsigned long, su2double, StorageType::ColumnMajor, 64, DynamicSize, 1>;
   using MatrixType = C2DContainer<unsigned long, su2double, StorageType::RowMajor,    64, DynamicSize, DynamicSize>;
+  using LimiterType = C2DContainer<unsigned long, su2limiterfloat, StorageType::RowMajor, 64, DynamicSize, DynamicSize>;
 
   MatrixType Solution;       /*!< \brief Solution of the problem. */
   MatrixType Solution_Old;   /*!< \brief Old solution of the problem R-K. */
@@ -72,7 +73,7 @@ protected:
   CVectorOfMatrix Gradient;  /*!< \brief Gradient of the solution of the problem. */
   C3DDoubleMatrix Rmatrix;   /*!< \brief Geometry-based matrix for weighted least squares gradient calculations. */
 
-  MatrixType Limiter;        /*!< \brief Limiter of the solution of the problem. */
+  LimiterType Limiter;       /*!< \brief Limiter of the solution of the problem. */
   MatrixType Solution_Max;   /*!< \brief Max solution for limiter computation. */
   MatrixType Solution_Min;   /*!< \brief Min solution for limiter computation. */
 
@@ -464,6 +465,13 @@ public:
   inline const MatrixType& GetSolution() const { return Solution; }
   inline MatrixType& GetSolution() { return Solution; }
 
+  /*!
+   * \brief Get the entire old solution of the problem.
+   * \return Reference to the old solution matrix.
+   */
+  inline const MatrixType& GetSolution_Old() const { return Solution_Old; }
+  inline MatrixType& GetSolution_Old() { return Solution_Old; }
+
   /*!
    * \brief Get the solution of the problem.
    * \param[in] iPoint - Point index.
@@ -728,6 +736,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -773,14 +782,15 @@ public:
    * \brief Get the slope limiter.
    * \return Reference to the limiters vector.
    */
-  inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline LimiterType& GetLimiter(void) { return Limiter; }
+  inline const LimiterType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
    * \param[in] iPoint - Point index.
    * \return Pointer to the limiters vector.
    */
-  inline su2double *GetLimiter(unsigned long iPoint) { return Limiter[iPoint]; }
+  inline su2limiterfloat *GetLimiter(unsigned long iPoint) { return Limiter[iPoint]; }
 
   /*!
    * \brief Get the value of the slope limiter.
@@ -818,6 +828,12 @@ public:
    */
   inline su2double GetDelta_Time(unsigned long iPoint) const {return Delta_Time(iPoint); }
 
+  /*!
+   * \brief Get the time step of all points.
+   * \return Reference to the time step vector.
+   */
+  inline VectorType& GetDelta_Time() { return Delta_Time; }
+
   /*!
    * \brief Set the value of the maximum eigenvalue for the inviscid terms of the PDE.
    * \param[in] iPoint - Point index.
@@ -1599,8 +1615,8 @@ public:
    * \brief Get the primitive variables limiter.
    * \return Primitive variables limiter for the entire domain.
    */
-  inline virtual MatrixType& GetLimiter_Primitive() { AssertOverride(); return Limiter; }
-  inline virtual const MatrixType& GetLimiter_Primitive() const { AssertOverride(); return Limiter; }
+  inline virtual LimiterType& GetLimiter_Primitive() { AssertOverride(); return Limiter; }
+  inline virtual const LimiterType& GetLimiter_Primitive() const { AssertOverride(); return Limiter; }
 
   /*!
    * \brief A virtual member.
@@ -1619,7 +1635,7 @@ public:
    * \brief A virtual member.
    * \return Value of the primitive variables gradient.
    */
-  inline virtual su2double *GetLimiter_Primitive(unsigned long iPoint) { return nullptr; }
+  inline virtual su2limiterfloat *GetLimiter_Primitive(unsigned long iPoint) { return nullptr; }
 
   /*!
    * \brief Get the value of the primitive gradient for MUSCL reconstruction.
@@ -2179,6 +2195,25 @@ public:
       adj_sol[iVar] = AD::GetDerivative(AD_InputIndex(iPoint,iVar));
   }
 
+  /*!
+   * \brief Set the primal values of the solution inputs of a primal value tape.
+   * \param[in] iPoint - Point index.
+   * \param[in] values - The new values of the solution.
+   */
+  inline void SetTapeSolution(unsigned long iPoint, const su2double *values) const {
+    for (unsigned long iVar = 0; iVar < AD_InputIndex.cols(); iVar++)
+      AD::SetPrimal(AD_InputIndex(iPoint,iVar), SU2_TYPE::GetValue(values[iVar]));
+  }
+
+  /*!
+   * \brief Get the primal value of a solution output of a primal value tape.
+   * \param[in] iPoint - Point index.
+   * \param[in] iVar - Variable index.
+   */
+  inline passivedouble GetTapeSolution(unsigned long iPoint, unsigned long iVar) const {
+    return AD::GetPrimal(AD_OutputIndex(iPoint,iVar));
+  }
+
   inline void GetAdjointSolution_time_n(unsigned long iPoint, su2double *adj_sol) const {
     int index = 0;
     for (unsigned long iVar = 0; iVar < Solution_time_n.cols(); iVar++) {
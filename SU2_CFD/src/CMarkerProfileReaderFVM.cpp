@@ -25,6 +25,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "../include/CMarkerProfileReaderFVM.hpp"
@@ -140,12 +141,22 @@ void CMarkerProfileReaderFVM::ReadMarkerProfile() {
     SU2_MPI::Error("While opening profile file, no \"NMARK=\" specification was found", CURRENT_FUNCTION);
   }
 
-  /*--- Compute array bounds and offsets. Allocate data structure. ---*/
+  /*--- Compute array bounds and offsets. Allocate data structure, the data is read by one rank
+   of each compute node into memory shared by the ranks of the node. ---*/
 
-  profileData.resize(numberOfProfiles);
+  profileOffset.resize(numberOfProfiles+1, 0);
   for (unsigned short iMarker = 0; iMarker < numberOfProfiles; iMarker++) {
-    profileData[iMarker].resize(numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker], 0.0);
+    const auto nData = numberOfRowsInProfile[iMarker]*numberOfColumnsInProfile[iMarker];
+    profileOffset[iMarker+1] = profileOffset[iMarker] + nData;
   }
+  profileData.Allocate(profileOffset.back());
+  passivedouble* data = profileData.WritableData();
+
+  if (!profileData.IsWriter()) {
+    profileData.Publish();
+    return;
+  }
+  fill(data, data + profileData.size(), 0.0);
 
   /*--- Read all lines in the profile file and extract data. ---*/
 
@@ -179,7 +190,7 @@ void CMarkerProfileReaderFVM::ReadMarkerProfile() {
           /*--- Store the values (starting with node coordinates) --*/
 
           for (unsigned short iVar = 0; iVar < numberOfColumnsInProfile[iMarker]; iVar++)
-            point_line >> profileData[iMarker][iRow*numberOfColumnsInProfile[iMarker] + iVar];
+            point_line >> data[profileOffset[iMarker] + iRow*numberOfColumnsInProfile[iMarker] + iVar];
 
           /*--- Increment our local row counter. ---*/
 
@@ -192,6 +203,8 @@ void CMarkerProfileReaderFVM::ReadMarkerProfile() {
 
   profile_file.close();
 
+  profileData.Publish();
+
 }
 
 void CMarkerProfileReaderFVM::MergeProfileMarkers() {
@@ -32,13 +32,215 @@
 #include "libxsmm.h"
 #endif
 
+/* Variants of SU2_CFD compiled for other instruction sets, see the "simd-dispatch" build option. */
+#if defined(SU2_SIMD_DISPATCH_AVX2) || defined(SU2_SIMD_DISPATCH_AVX512)
+#define SU2_SIMD_DISPATCH
+#include <unistd.h>
+#include "../../Common/include/parallelization/vectorization.hpp"
+#endif
+
 /* Include file, needed for the runtime NaN catching. You also have to include feenableexcept(...) below. */
 //#include <fenv.h>
 
 using namespace std;
 
+#ifdef SU2_SIMD_DISPATCH
+/*!
+ * \brief Replace this process by the variant of SU2_CFD (installed next to it) compiled for the
+ *        best instruction set supported by the host. Nothing happens if there is no such variant.
+ */
+void DispatchSIMDVariant(char *argv[]) {
+  const auto host = simd::hostISA();
+  string suffix;
+#ifdef SU2_SIMD_DISPATCH_AVX512
+  if (suffix.empty() && host >= simd::ISA::AVX512) suffix = "_avx512";
+#endif
+#ifdef SU2_SIMD_DISPATCH_AVX2
+  if (suffix.empty() && host >= simd::ISA::AVX2) suffix = "_avx2";
+#endif
+  if (suffix.empty()) return;
+
+  string self = argv[0];
+#ifdef __linux__
+  char buffer[4096];
+  const auto len = readlink("/proc/self/exe", buffer, sizeof(buffer)-1);
+  if (len > 0) self.assign(buffer, len);
+#endif
+  const string variant = self + suffix;
+  if (access(variant.c_str(), X_OK) != 0) return;
+
+  /*--- Only returns if the exec fails, in which case we continue with this executable. ---*/
+  execv(variant.c_str(), argv);
+}
+#endif
+
+/*!
+ * \brief Instantiate the driver for the problem defined by a config file, and perform all the preprocessing.
+ * \param[in] config - The config (only used to select the driver).
+ * \param[in] config_file_name - The config file.
+ * \param[in] dry_run - Dry run mode.
+ * \param[in] MPICommunicator - MPI communicator of the driver.
+ * \return The driver.
+ */
+CDriver* CreateDriver(const CConfig& config, char* config_file_name, bool dry_run, SU2_Comm MPICommunicator) {
+
+  CDriver* driver = nullptr;
+  const unsigned short nZone = config.GetnZone();
+
+  /*--- First, given the basic information about the number of zones and the
+   solver types from the config, instantiate the appropriate driver for the problem
+   and perform all the preprocessing. ---*/
+
+  const bool disc_adj = config.GetDiscrete_Adjoint();
+  const bool multizone = config.GetMultizone_Problem();
+  const bool harmonic_balance = (config.GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
+
+  if (dry_run) {
+
+    /*--- Dry Run. ---*/
+    driver = new CDummyDriver(config_file_name, nZone, MPICommunicator);
+
+  }
+  else if (!multizone && !harmonic_balance) {
+
+    /*--- Generic single zone problem: instantiate the single zone driver class. ---*/
+    if (nZone != 1)
+      SU2_MPI::Error("The required solver doesn't support multizone simulations", CURRENT_FUNCTION);
+
+    if (disc_adj) {
+      driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
+    }
+    else if (config.GetTimeParallelGroups() > 1) {
+      driver = new CPararealDriver(config_file_name, nZone, MPICommunicator);
+    }
+    else {
+      driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
+    }
+
+  }
+  else if (multizone) {
+
+    /*--- Generic multizone problems. ---*/
+    if (disc_adj) {
+      driver = new CDiscAdjMultizoneDriver(config_file_name, nZone, MPICommunicator);
+    }
+    else {
+      driver = new CMultizoneDriver(config_file_name, nZone, MPICommunicator);
+    }
+
+  }
+  else {
+    assert(harmonic_balance);
+
+    /*--- Harmonic balance problem: instantiate the Harmonic Balance driver class. ---*/
+    driver = new CHBDriver(config_file_name, nZone, MPICommunicator);
+
+  }
+
+  return driver;
+}
+
+/*!
+ * \brief Run the independent cases of an ensemble (ENSEMBLE_CONFIGS). The ranks are split into ENSEMBLE_GROUPS
+ *        groups, each group runs one case at a time and takes the next case of the list when it finishes one.
+ * \param[in] config - The config that defines the ensemble.
+ * \param[in] dry_run - Dry run mode.
+ */
+void RunEnsemble(const CConfig& config, bool dry_run) {
+
+  const int nCases = config.GetnEnsemble_Configs();
+  const int nGroups = config.GetEnsembleGroups();
+  const int worldRank = SU2_MPI::GetRank();
+  const int worldSize = SU2_MPI::GetSize();
+  const SU2_Comm worldComm = SU2_MPI::GetComm();
+
+  if (worldSize % nGroups != 0) {
+    SU2_MPI::Error("ENSEMBLE_GROUPS must divide the number of MPI ranks.", CURRENT_FUNCTION);
+  }
+  const int groupSize = worldSize / nGroups;
+  const int iGroup = worldRank / groupSize;
+  const bool groupMaster = (worldRank % groupSize == 0);
+
+  if (worldRank == MASTER_NODE) {
+    cout << "\nEnsemble of " << nCases << " cases, run by " << nGroups << " groups of " << groupSize << " ranks.\n";
+  }
+
+  SU2_Comm groupComm = worldComm;
+  int nextCase = 0;
+
+#ifdef HAVE_MPI
+  MPI_Comm_split(worldComm, iGroup, worldRank, &groupComm);
+
+  /*--- The job queue is a counter on the first rank, that the group masters increment atomically. ---*/
+
+  MPI_Win queueWin;
+  MPI_Win_create(&nextCase, sizeof(int), sizeof(int), MPI_INFO_NULL, worldComm, &queueWin);
+#endif
+
+  auto NextCase = [&]() {
+    int iCase = 0;
+#ifdef HAVE_MPI
+    if (groupMaster) {
+      const int one = 1;
+      MPI_Win_lock(MPI_LOCK_EXCLUSIVE, MASTER_NODE, 0, queueWin);
+      MPI_Fetch_and_op(&one, &iCase, MPI_INT, MASTER_NODE, 0, MPI_SUM, queueWin);
+      MPI_Win_unlock(MASTER_NODE, queueWin);
+    }
+    MPI_Bcast(&iCase, 1, MPI_INT, 0, groupComm);
+#else
+    iCase = nextCase++;
+#endif
+    return iCase;
+  };
+
+  /*--- Only the first group writes to the screen, the others only report the cases they run. ---*/
+
+  auto* coutBuffer = cout.rdbuf();
+
+  for (auto iCase = NextCase(); iCase < nCases; iCase = NextCase()) {
+
+    char case_file_name[MAX_STRING_SIZE];
+    strcpy(case_file_name, config.GetEnsemble_Config(iCase).c_str());
+
+    if (groupMaster && iGroup != 0) {
+      cout << "Ensemble group " << iGroup << " running case " << iCase << " (" << case_file_name << ")." << endl;
+    }
+    if (iGroup != 0) cout.rdbuf(nullptr);
+
+    /*--- The communicator of the group is set by the driver, but the case config is read before that. ---*/
+
+    SU2_MPI::SetComm(groupComm);
+    const CConfig caseConfig(case_file_name, SU2_COMPONENT::SU2_CFD);
+
+    if (caseConfig.GetnEnsemble_Configs() > 0) {
+      SU2_MPI::Error("The cases of an ensemble cannot be ensembles.", CURRENT_FUNCTION);
+    }
+
+    auto* driver = CreateDriver(caseConfig, case_file_name, dry_run, groupComm);
+    driver->StartSolver();
+    driver->Finalize();
+    delete driver;
+
+    cout.rdbuf(coutBuffer);
+  }
+
+  SU2_MPI::SetComm(worldComm);
+
+#ifdef HAVE_MPI
+  MPI_Win_free(&queueWin);
+  MPI_Comm_free(&groupComm);
+#endif
+
+  if (worldRank == MASTER_NODE) cout << "\nAll the cases of the ensemble are finished." << endl;
+}
+
 int main(int argc, char *argv[]) {
 
+#ifdef SU2_SIMD_DISPATCH
+  /*--- Before anything else (e.g. MPI initialization). ---*/
+  DispatchSIMDVariant(argv);
+#endif
+
   char config_file_name[MAX_STRING_SIZE];
   bool dry_run = false;
   int num_threads = omp_get_max_threads();
@@ -95,70 +297,36 @@ int main(int argc, char *argv[]) {
    for variables allocation). ---*/
 
   const CConfig config(config_file_name, SU2_COMPONENT::SU2_CFD);
-  const unsigned short nZone = config.GetnZone();
-
-  /*--- First, given the basic information about the number of zones and the
-   solver types from the config, instantiate the appropriate driver for the problem
-   and perform all the preprocessing. ---*/
-
-  const bool disc_adj = config.GetDiscrete_Adjoint();
-  const bool multizone = config.GetMultizone_Problem();
-  const bool harmonic_balance = (config.GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
-
-  if (dry_run) {
-
-    /*--- Dry Run. ---*/
-    driver = new CDummyDriver(config_file_name, nZone, MPICommunicator);
-
-  }
-  else if (!multizone && !harmonic_balance) {
-
-    /*--- Generic single zone problem: instantiate the single zone driver class. ---*/
-    if (nZone != 1)
-      SU2_MPI::Error("The required solver doesn't support multizone simulations", CURRENT_FUNCTION);
-
-    if (disc_adj) {
-      driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
-    }
-    else {
-      driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
-    }
-
-  }
-  else if (multizone) {
-
-    /*--- Generic multizone problems. ---*/
-    if (disc_adj) {
-      driver = new CDiscAdjMultizoneDriver(config_file_name, nZone, MPICommunicator);
-    }
-    else {
-      driver = new CMultizoneDriver(config_file_name, nZone, MPICommunicator);
-    }
 
+  if (config.GetnEnsemble_Configs() > 0) {
+    RunEnsemble(config, dry_run);
   }
   else {
-    assert(harmonic_balance);
+    driver = CreateDriver(config, config_file_name, dry_run, MPICommunicator);
 
-    /*--- Harmonic balance problem: instantiate the Harmonic Balance driver class. ---*/
-    driver = new CHBDriver(config_file_name, nZone, MPICommunicator);
-
-  }
+    /*--- Launch the main external loop of the solver. ---*/
 
-  /*--- Launch the main external loop of the solver. ---*/
+    driver->StartSolver();
 
-  driver->StartSolver();
+    /*--- Finalize solver, delete all the containers, close history file, exit SU2. ---*/
 
-  /*--- Finalize solver, delete all the containers, close history file, exit SU2. ---*/
+    driver->Finalize();
 
-  driver->Finalize();
-
-  delete driver;
+    delete driver;
+  }
 
   /*---Finalize libxsmm, if supported. ---*/
 #ifdef HAVE_LIBXSMM
   libxsmm_finalize();
 #endif
 
+  /*--- Finalize PETSc (if it was used), before MPI. ---*/
+#ifdef HAVE_PETSC
+  PetscBool petscStarted = PETSC_FALSE;
+  PetscInitialized(&petscStarted);
+  if (petscStarted) PetscFinalize();
+#endif
+
   /*--- Finalize AD. ---*/
   AD::Finalize();
 
@@ -351,7 +351,9 @@ void CDiscAdjMultizoneDriver::Run() {
     /*--- If we want to set up zone-specific tapes (retape), we do not need to record
      *    here. Otherwise, the whole tape of a coupled run will be created. ---*/
 
-    if (RecordingState != RECORDING::SOLUTION_VARIABLES) {
+    const bool retape = driver_config->GetZone_Tapes() && (nZone > 1);
+
+    if (!retape && (RecordingState != RECORDING::SOLUTION_VARIABLES)) {
       SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
       SetRecording(RECORDING::SOLUTION_VARIABLES, Kind_Tape::FULL_TAPE, ZONE_0);
     }
@@ -362,6 +364,17 @@ void CDiscAdjMultizoneDriver::Run() {
 
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
 
+      /*--- Record the tape of this zone, the tape memory is bounded by the largest zone (plus the
+       *    interfaces) instead of the sum over all zones, at the cost of recording every outer iteration.
+       *    The indices are cleared with a passive iteration of all zones. ---*/
+
+      if (retape) {
+        const auto recordZone = iZone;
+        SetRecording(RECORDING::CLEAR_INDICES, Kind_Tape::FULL_TAPE, ZONE_0);
+        SetRecording(RECORDING::SOLUTION_VARIABLES, Kind_Tape::ZONE_SPECIFIC_TAPE, recordZone);
+        iZone = recordZone;
+      }
+
       /*--- Start inner iterations from where we stopped in previous outer iteration. ---*/
 
       Set_Solution_To_BGSSolution_k(iZone);
@@ -568,7 +581,12 @@ void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long Iter, bool for
 
 void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape tape_type, unsigned short record_zone) {
 
+  /*--- The evaluations of the previous tape are timed per section. ---*/
+
+  AD::PrintTapeSectionStatistics(rank == MASTER_NODE, true);
+
   AD::Reset();
+  AD::EnableTapeSections(driver_config->GetWrt_AD_Statistics());
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -650,7 +668,10 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
      *    For recording w.r.t. mesh coordinates the transfer was included before the
      *    objective function, so we do not repeat it here. ---*/
 
-    if (kind_recording != RECORDING::MESH_COORDS) {
+    if (tape_type == Kind_Tape::ZONE_SPECIFIC_TAPE) {
+      TransferToZone(record_zone);
+    }
+    else if (kind_recording != RECORDING::MESH_COORDS) {
       HandleDataTransfer();
     }
 
@@ -660,17 +681,23 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
 
       AD::Push_TapePosition(); /// enter_zone
 
-      DirectIteration(iZone, kind_recording);
+      /*--- The tape positions of the other zones are kept (empty) to evaluate all tapes in the same way. ---*/
+
+      if (tape_type != Kind_Tape::ZONE_SPECIFIC_TAPE || iZone == record_zone) {
+        DirectIteration(iZone, kind_recording);
 
-      iteration_container[iZone][INST_0]->RegisterOutput(solver_container, geometry_container,
-                                                         config_container, iZone, INST_0);
+        iteration_container[iZone][INST_0]->RegisterOutput(solver_container, geometry_container,
+                                                           config_container, iZone, INST_0);
+      }
       AD::Push_TapePosition(); /// leave_zone
     }
-    PrintDirectResidual(kind_recording);
+    if (tape_type == Kind_Tape::FULL_TAPE) PrintDirectResidual(kind_recording);
   }
 
   if (kind_recording != RECORDING::CLEAR_INDICES && driver_config->GetWrt_AD_Statistics()) {
     AD::PrintStatistics(SU2_MPI::GetComm(), rank == MASTER_NODE);
+    AD::PrintTapeSectionStatistics(rank == MASTER_NODE);
+    PrintTurbulenceRecording();
   }
 
   AD::StopRecording();
@@ -844,24 +871,27 @@ void CDiscAdjMultizoneDriver::InitializeCrossTerms() {
 void CDiscAdjMultizoneDriver::HandleDataTransfer() {
 
   for(iZone = 0; iZone < nZone; iZone++) {
+    TransferToZone(iZone);
+  }
+}
 
-    /*--- In principle, the mesh does not need to be updated ---*/
-    bool DeformMesh = false;
+void CDiscAdjMultizoneDriver::TransferToZone(unsigned short targetZone) {
 
-    /*--- Transfer from all the remaining zones ---*/
-    for (unsigned short jZone = 0; jZone < nZone; jZone++){
-      /*--- The target zone is iZone ---*/
-      if (jZone != iZone && interface_container[jZone][iZone] != nullptr) {
-        DeformMesh |= TransferData(jZone, iZone);
-      }
+  /*--- In principle, the mesh does not need to be updated ---*/
+  bool DeformMesh = false;
+
+  /*--- Transfer from all the remaining zones ---*/
+  for (unsigned short jZone = 0; jZone < nZone; jZone++){
+    if (jZone != targetZone && interface_container[jZone][targetZone] != nullptr) {
+      DeformMesh |= TransferData(jZone, targetZone);
     }
+  }
 
-    /*--- If a mesh update is required due to the transfer of data ---*/
-    const unsigned long ExtIter = 0;
-    if (DeformMesh) DynamicMeshUpdate(iZone, ExtIter);
+  /*--- If a mesh update is required due to the transfer of data ---*/
+  const unsigned long ExtIter = 0;
+  if (DeformMesh) DynamicMeshUpdate(targetZone, ExtIter);
 
-    Has_Deformation(iZone) = DeformMesh;
-  }
+  Has_Deformation(targetZone) = DeformMesh;
 }
 
 void CDiscAdjMultizoneDriver::AddSolutionToExternal(unsigned short iZone) {
@@ -27,6 +27,7 @@
 
 #include "../../include/drivers/CDiscAdjSinglezoneDriver.hpp"
 #include "../../include/output/tools/CWindowingTools.hpp"
+#include "../../include/output/tools/CCheckpoint.hpp"
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIterationFactory.hpp"
@@ -78,6 +79,9 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
       SecondaryVariables = RECORDING::MESH_DEFORM;
     }
     else { SecondaryVariables = RECORDING::MESH_COORDS; }
+
+    /*--- A single recording, which can be re-evaluated, serves the adjoint iterations and the sensitivities. ---*/
+    if (config->GetPrimal_Tape_Reuse()) MainVariables = RECORDING::SOLUTION_AND_MESH;
     MainSolver = ADJFLOW_SOL;
     break;
 
@@ -118,6 +122,10 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- One adjoint per objective function, the tape is evaluated for all of them at once. ---*/
+
+  if (config->GetVector_Adjoint()) AD::BeginVectorMode();
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver() {
@@ -125,6 +133,8 @@ CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver() {
   delete direct_iteration;
   delete direct_output;
 
+  AD::EndVectorMode();
+
 }
 
 void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
@@ -135,6 +145,12 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
   this->TimeIter = TimeIter;
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
+  /*--- For the unsteady adjoint, recompute the direct solutions without restart file. ---*/
+
+  if (config->GetTime_Domain() && config->GetUnst_Adjoint_Recompute()) {
+    PrepareDirectSolutions();
+  }
+
   /*--- Preprocess the adjoint iteration ---*/
 
   iteration->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
@@ -148,11 +164,25 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
   if (RecordingState != MainVariables){
     MainRecording();
   }
+  else if (config->GetPrimal_Tape_Reuse() && !ReplayMainRecording()) {
+    MainRecording();
+  }
 
 }
 
 void CDiscAdjSinglezoneDriver::Run() {
 
+  if (config->GetVector_Adjoint()) {
+    VectorRun();
+    return;
+  }
+
+  if (config->GetNewtonKrylov() && config->GetnQuasiNewtonSamples() >= KrylovMinIters &&
+      nAdjoint_Iter >= KrylovMinIters) {
+    KrylovRun();
+    return;
+  }
+
   CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
   if (config->GetnQuasiNewtonSamples() > 1) {
     fixPtCorrector.resize(config->GetnQuasiNewtonSamples(),
@@ -216,6 +246,137 @@ void CDiscAdjSinglezoneDriver::Run() {
 
 }
 
+void CDiscAdjSinglezoneDriver::AdjointIteration() {
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  SetAdjObjFunction();
+
+  AD::ComputeAdjoint();
+
+  iteration->IterateDiscAdj(geometry_container, solver_container, config_container, ZONE_0, INST_0, false);
+
+  AD::ClearAdjoints();
+}
+
+void CDiscAdjSinglezoneDriver::KrylovRun() {
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, true);
+
+  /*--- Without relaxation (first inner iteration, see CDiscAdjSolver::ExtractAdjoint_Solution)
+   *    the iteration G(u) = J^T u + b is affine, and the adjoint solves (J^T - I) u = -b. ---*/
+
+  config->SetInnerIter(0);
+
+  CSysVector<Scalar> rhs(nPoint, nPointDomain, nVar), sol(nPoint, nPointDomain, nVar);
+  GetAllSolutions(ZONE_0, true, sol);
+
+  /*--- The right hand side is the iteration from a zero solution, i.e. -b. ---*/
+
+  SetAllSolutions(ZONE_0, true, rhs);
+  AdjointIteration();
+  GetAllSolutions(ZONE_0, true, rhs);
+  rhs *= -1.0;
+
+  const auto product = AdjointProduct(this, rhs);
+
+  CSysSolve<Scalar> linSolver;
+  linSolver.SetToleranceType(LinearToleranceType::RELATIVE);
+
+  /*--- Restarted FGMRES, the tolerance is the full tolerance residual drop of NEWTON_KRYLOV_DPARAM. ---*/
+
+  const Scalar tol = pow(10.0, SU2_TYPE::GetValue(config->GetNewtonKrylovDblParam()[2]));
+  const unsigned long nRestart = config->GetnQuasiNewtonSamples();
+
+  Scalar eps = 1.0;
+  for (auto totalIter = nAdjoint_Iter; totalIter >= KrylovMinIters && eps > tol;) {
+    Scalar eps_l = 0.0;
+    Scalar tol_l = tol / eps;
+    auto iter = min(totalIter-2ul, nRestart-2ul);
+    iter = linSolver.FGMRES_LinSolver(rhs, sol, product, Identity(), tol_l, iter, eps_l, false, config);
+    totalIter -= iter+1;
+    eps *= eps_l;
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "FGMRES adjoint: " << product.nEval << " iterations, relative residual " << eps << "." << endl;
+  }
+
+  /*--- Iterate once more from the FGMRES solution to compute the residuals, monitor, and write the output. ---*/
+
+  SetAllSolutions(ZONE_0, true, sol);
+  config->SetInnerIter(product.nEval + 1);
+
+  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+
+  SetAdjObjFunction();
+
+  AD::ComputeAdjoint();
+
+  iteration->IterateDiscAdj(geometry_container, solver_container, config_container, ZONE_0, INST_0, false);
+
+  StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+                                solver_container, numerics_container, config_container,
+                                surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+  AD::ClearAdjoints();
+
+  if (!config->GetTime_Domain()) {
+    iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
+                      config_container, config->GetInnerIter(), false, ZONE_0, INST_0);
+  }
+}
+
+void CDiscAdjSinglezoneDriver::VectorRun() {
+
+  const auto nObj = config->GetnObj();
+
+  /*--- The solvers hold the adjoint solution of one objective function at a time, all start from zero. ---*/
+
+  if (VectorAdjSol.empty()) {
+    VectorAdjSol.resize(nObj);
+    for (auto& adjSol : VectorAdjSol) adjSol.resize(geometry->GetnPoint(), GetTotalNumberOfVariables(ZONE_0, true)) = 0.0;
+  }
+
+  for (auto Adjoint_Iter = 0ul; Adjoint_Iter < nAdjoint_Iter; Adjoint_Iter++) {
+
+    config->SetInnerIter(Adjoint_Iter);
+
+    /*--- Seed the outputs of the iteration with the adjoint solution of each objective function. ---*/
+
+    for (auto iObj = 0u; iObj < nObj; iObj++) {
+      AD::SetAdjointDirection(iObj);
+      SetAllSolutions(ZONE_0, true, VectorAdjSol[iObj]);
+      iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    }
+    SetVectorAdjObjFunction();
+
+    /*--- One evaluation of the tape for all objective functions. ---*/
+
+    AD::ComputeAdjoint();
+
+    /*--- Extract the new adjoint solutions, in reverse order such that the first objective function
+     *    stays in the solvers for monitoring. ---*/
+
+    for (auto iObj = nObj; iObj-- > 0;) {
+      AD::SetAdjointDirection(iObj);
+      SetAllSolutions(ZONE_0, true, VectorAdjSol[iObj]);
+      iteration->IterateDiscAdj(geometry_container, solver_container, config_container, ZONE_0, INST_0, false);
+      GetAllSolutions(ZONE_0, true, VectorAdjSol[iObj]);
+    }
+
+    StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+                                  solver_container, numerics_container, config_container,
+                                  surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+    AD::ClearAdjoints();
+
+    if (StopCalc) break;
+  }
+}
+
 void CDiscAdjSinglezoneDriver::Postprocess() {
 
   switch(config->GetKind_Solver())
@@ -226,6 +387,8 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 
       /*--- Compute the geometrical sensitivities ---*/
       SecondaryRecording();
+
+      if (config->GetInline_Gradient_Projection()) ProjectGradient();
       break;
 
     case MAIN_SOLVER::DISC_ADJ_FEM :
@@ -247,7 +410,12 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 
 void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
+  /*--- The evaluations of the previous tape are timed per section. ---*/
+
+  AD::PrintTapeSectionStatistics(rank == MASTER_NODE, true);
+
   AD::Reset();
+  AD::EnableTapeSections(config_container[ZONE_0]->GetWrt_AD_Statistics());
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -267,6 +435,8 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     switch(kind_recording) {
     case RECORDING::CLEAR_INDICES: cout << "Clearing the computational graph." << endl; break;
     case RECORDING::MESH_COORDS:   cout << "Storing computational graph wrt MESH COORDINATES." << endl; break;
+    case RECORDING::SOLUTION_AND_MESH:
+      cout << "Storing computational graph wrt SOLUTION and MESH COORDINATES." << endl; break;
     case RECORDING::SOLUTION_VARIABLES:
       cout << "Direct iteration to store the primal computational graph." << endl;
       cout << "Computing residuals to check the convergence of the direct problem." << endl; break;
@@ -306,6 +476,8 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   if (kind_recording != RECORDING::CLEAR_INDICES && config_container[ZONE_0]->GetWrt_AD_Statistics()) {
     AD::PrintStatistics(SU2_MPI::GetComm(), rank == MASTER_NODE);
+    AD::PrintTapeSectionStatistics(rank == MASTER_NODE);
+    PrintTurbulenceRecording();
   }
 
   AD::StopRecording();
@@ -374,6 +546,49 @@ void CDiscAdjSinglezoneDriver::SetObjFunction(){
     AD::RegisterOutput(ObjFunc);
   }
 
+  if (config->GetVector_Adjoint()) SetVectorObjFunction();
+
+}
+
+void CDiscAdjSinglezoneDriver::SetVectorObjFunction() {
+
+  const auto nObj = config->GetnObj();
+
+  /*--- Each objective function is the combo objective with a unit weight for it and zero for the others. ---*/
+
+  vector<su2double> weights(nObj);
+  for (auto iObj = 0u; iObj < nObj; iObj++) weights[iObj] = config->GetWeight_ObjFunc(iObj);
+
+  VectorObjFunc.resize(nObj);
+  VectorObjFunc_Index.resize(nObj);
+
+  for (auto iObj = 0u; iObj < nObj; iObj++) {
+    for (auto jObj = 0u; jObj < nObj; jObj++) config->SetWeight_ObjFunc(jObj, (iObj == jObj) ? 1.0 : 0.0);
+    solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+    VectorObjFunc[iObj] = solver[FLOW_SOL]->GetTotal_ComboObj();
+  }
+
+  for (auto iObj = 0u; iObj < nObj; iObj++) config->SetWeight_ObjFunc(iObj, weights[iObj]);
+  solver[FLOW_SOL]->Evaluate_ObjFunc(config, solver);
+
+  if (rank == MASTER_NODE) {
+    for (auto iObj = 0u; iObj < nObj; iObj++) {
+      AD::RegisterOutput(VectorObjFunc[iObj]);
+      AD::SetIndex(VectorObjFunc_Index[iObj], VectorObjFunc[iObj]);
+    }
+  }
+}
+
+void CDiscAdjSinglezoneDriver::SetVectorAdjObjFunction() {
+
+  if (rank != MASTER_NODE) return;
+
+  AD::BeginUseAdjoints();
+  for (auto iObj = 0u; iObj < config->GetnObj(); iObj++) {
+    AD::SetAdjointDirection(iObj);
+    AD::SetDerivative(VectorObjFunc_Index[iObj], 1.0);
+  }
+  AD::EndUseAdjoints();
 }
 
 void CDiscAdjSinglezoneDriver::DirectRun(RECORDING kind_recording){
@@ -400,6 +615,179 @@ void CDiscAdjSinglezoneDriver::DirectRun(RECORDING kind_recording){
 
 }
 
+void CDiscAdjSinglezoneDriver::PrepareDirectSolutions() {
+
+  const long order = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) ? 2 : 1;
+
+  /*--- The adjoint iteration loads the direct solutions "current-order" to "current" on the first
+   *    time iteration, and then only "current-order" as the others are shifted from the previous one. ---*/
+
+  const long current = config->GetUnst_AdjointIter() - static_cast<long>(TimeIter) - 1;
+
+  /*--- Solutions after the current one are no longer needed. ---*/
+
+  for (auto it = directSnapshots.begin(); it != directSnapshots.end();) {
+    if (*it > current) {
+      CSolver::EraseRestartInMemory(config->GetFilename(config->GetSolution_FileName(), "", *it));
+      it = directSnapshots.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  const su2double physicalTime = config->GetPhysicalTime();
+  bool recomputed = false;
+
+  for (auto iter = (TimeIter == 0) ? current : current - order; iter >= current - order; --iter) {
+    if (!DirectSolutionAvailable(iter)) {
+      RecomputeDirectSolution(iter);
+      recomputed = true;
+    }
+  }
+  if (!recomputed) return;
+
+  /*--- Recomputing overwrote the solutions of the previous time steps, restore them. ---*/
+
+  if (TimeIter > 0) LoadDirectSolutions(current - order + 1, current);
+
+  config->SetTimeIter(TimeIter);
+  config->SetPhysicalTime(physicalTime);
+}
+
+bool CDiscAdjSinglezoneDriver::DirectSolutionAvailable(long iter) const {
+
+  if (iter < 0 || directSnapshots.count(iter)) return true;
+
+  const string ext = config->GetRead_Binary_Restart() ? ".dat" : ".csv";
+  const string filename = config->GetFilename(config->GetSolution_FileName(), ext, iter);
+
+  int found = 0;
+  if (rank == MASTER_NODE) found = ifstream(filename).good();
+  SU2_MPI::Bcast(&found, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  return found;
+}
+
+void CDiscAdjSinglezoneDriver::LoadDirectSolutions(long first, long last) {
+
+  vector<unsigned short> solvers = {FLOW_SOL};
+  if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) solvers.push_back(TURB_SOL);
+  if (config->GetKind_Species_Model() != SPECIES_MODEL::NONE) solvers.push_back(SPECIES_SOL);
+  if (config->AddRadiation()) solvers.push_back(RAD_SOL);
+
+  for (auto iter = first; iter <= last; ++iter) {
+    iteration->LoadUnsteady_Solution(geometry_container, solver_container, config_container, ZONE_0, INST_0, iter);
+
+    for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+      for (const auto iSol : solvers) {
+        solver_container[ZONE_0][INST_0][iMesh][iSol]->GetNodes()->Set_Solution_time_n1();
+        solver_container[ZONE_0][INST_0][iMesh][iSol]->GetNodes()->Set_Solution_time_n();
+      }
+    }
+  }
+}
+
+void CDiscAdjSinglezoneDriver::RecomputeDirectSolution(long iter) {
+
+  const long order = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND) ? 2 : 1;
+
+  /*--- Closest earlier time iteration from which the direct problem can be restarted. ---*/
+
+  long start = iter - 1;
+  while (!DirectSolutionAvailable(start) || !DirectSolutionAvailable(start - order + 1)) --start;
+
+  if (rank == MASTER_NODE) {
+    cout << "\n Recomputing the direct solution of time iteration " << iter << " from time iteration "
+         << start << "." << endl;
+  }
+
+  /*--- The last "order" solutions are always kept since the adjoint needs them next, the remaining
+   *    snapshots are used as checkpoints (each one is "order" consecutive solutions). ---*/
+
+  const unsigned long nUsed = directSnapshots.size() + order;
+  const unsigned long nMax = config->GetUnst_Adjoint_Snapshots();
+  unsigned long nCheckpoint = (nMax > nUsed) ? (nMax - nUsed) / order : 0;
+
+  /*--- Binomial (revolve) schedule: with c checkpoints, and each step recomputed at most r times,
+   *    beta(c,r) = (c+r)!/(c!r!) steps can be reversed. The next checkpoint is placed such that the
+   *    steps to its right can be reversed with the c-1 other checkpoints. ---*/
+
+  auto beta = [](unsigned long c, unsigned long r) {
+    passivedouble b = 1.0;
+    for (auto i = 1ul; i <= c; ++i) b = b * (r + i) / i;
+    return b;
+  };
+  auto nextCheckpoint = [&](long from) {
+    const long nSteps = iter - order - from;
+    if (nCheckpoint == 0 || nSteps < 2) return iter + 1;
+    unsigned long r = 1;
+    while (beta(nCheckpoint, r) < nSteps) ++r;
+    return from + max(1l, nSteps - static_cast<long>(beta(nCheckpoint - 1, r)));
+  };
+
+  LoadDirectSolutions(start - order + 1, start);
+
+  long next = nextCheckpoint(start);
+
+  for (auto x = start + 1; x <= iter; ++x) {
+    RunDirectTimeIter(x);
+
+    if (x > iter - order || x > next - order) StoreDirectSolution(x);
+
+    if (x == next) {
+      --nCheckpoint;
+      next = nextCheckpoint(x);
+    }
+  }
+}
+
+void CDiscAdjSinglezoneDriver::RunDirectTimeIter(long iter) {
+
+  config->SetTimeIter(iter);
+  config->SetPhysicalTime(static_cast<su2double>(iter)*config->GetDelta_UnstTimeND());
+
+  direct_iteration->Preprocess(direct_output, integration_container, geometry_container, solver_container,
+                               numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                               ZONE_0, INST_0);
+
+  for (auto Inner_Iter = 0ul; Inner_Iter < config->GetnInner_Iter(); Inner_Iter++) {
+    config->SetInnerIter(Inner_Iter);
+
+    direct_iteration->Iterate(direct_output, integration_container, geometry_container, solver_container,
+                              numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                              ZONE_0, INST_0);
+
+    if (direct_iteration->Monitor(direct_output, integration_container, geometry_container, solver_container,
+                                  numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                                  ZONE_0, INST_0)) break;
+  }
+
+  /*--- Shift the solutions in time, the current one becomes the solution at time n. ---*/
+
+  direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container,
+                           numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                           ZONE_0, INST_0);
+}
+
+void CDiscAdjSinglezoneDriver::StoreDirectSolution(long iter) {
+
+  /*--- Same layout as the restart files. ---*/
+
+  auto data = CCheckpoint::GetRestartData(config, geometry, solver);
+  const unsigned long nFields = data.size() / max<unsigned long>(1, geometry->GetnPointDomain());
+
+  /*--- Names of the restart that was loaded last, they are only informative. ---*/
+
+  vector<string> fields = {"Point_ID"};
+  const auto& loaded = solver[FLOW_SOL]->fields;
+  for (auto iField = 1ul; iField <= nFields; ++iField) {
+    fields.push_back(iField < loaded.size() ? loaded[iField] : "Field_" + to_string(iField));
+  }
+
+  CSolver::StoreRestartInMemory(config->GetFilename(config->GetSolution_FileName(), "", iter), std::move(fields),
+                                std::move(data));
+  directSnapshots.insert(iter);
+}
+
 void CDiscAdjSinglezoneDriver::MainRecording(){
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with
    *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed. ---*/
@@ -410,17 +798,89 @@ void CDiscAdjSinglezoneDriver::MainRecording(){
 
   SetRecording(MainVariables);
 
+  if (MainVariables == RECORDING::SOLUTION_AND_MESH) RecordedResidual = FixedPointResidual(false);
+
+}
+
+bool CDiscAdjSinglezoneDriver::ReplayMainRecording() {
+
+  /*--- The inputs are the converged solution (stored by the adjoint iteration) and the current coordinates. ---*/
+
+  for (const auto& sol : RecordedSolvers()) {
+    auto* adjNodes = solver[sol.second]->GetNodes();
+    const auto* nodes = solver[sol.first]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+      nodes->SetTapeSolution(iPoint, adjNodes->GetSolution_Direct(iPoint));
+    }
+  }
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    geometry->nodes->SetTapeCoord(iPoint);
+  }
+
+  AD::EvaluatePrimal();
+
+  /*--- Branches and other decisions of the recording are not revisited, if they no longer hold the re-evaluated
+   *    iteration is not the one of the direct solver, and the converged solution is not its fixed point. ---*/
+
+  const auto residual = FixedPointResidual(true);
+  const bool valid = residual <= ReplayTolFactor * RecordedResidual;
+
+  if (rank == MASTER_NODE) {
+    cout << "\n-------------------------------------------------------------------------\n";
+    cout << "Re-evaluated the primal tape, fixed-point residual " << log10(residual) << " (recorded "
+         << log10(RecordedResidual) << ")." << endl;
+    if (!valid) cout << "The re-evaluated iteration does not match the solution, recording it again." << endl;
+  }
+  return valid;
+}
+
+passivedouble CDiscAdjSinglezoneDriver::FixedPointResidual(bool tape) const {
+
+  passivedouble local[2] = {0.0, 0.0}, global[2] = {0.0, 0.0};
+
+  for (const auto& sol : RecordedSolvers()) {
+    auto* adjNodes = solver[sol.second]->GetNodes();
+    const auto* nodes = solver[sol.first]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      const auto* input = adjNodes->GetSolution_Direct(iPoint);
+      for (auto iVar = 0ul; iVar < solver[sol.first]->GetnVar(); iVar++) {
+        const auto output = tape ? nodes->GetTapeSolution(iPoint, iVar)
+                                 : SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+        local[0] += pow(output - SU2_TYPE::GetValue(input[iVar]), 2);
+      }
+      local[1] += solver[sol.first]->GetnVar();
+    }
+  }
+  SU2_MPI::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  return sqrt(global[0] / max(global[1], 1.0));
 }
 
 void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with
-   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed. ---*/
+   *    RECORDING::CLEAR_INDICES as argument ensures that all information from a previous recording is removed.
+   *    The main recording already has the coordinates as input when it is reused (PRIMAL_TAPE_REUSE). ---*/
 
-  SetRecording(RECORDING::CLEAR_INDICES);
+  if (MainVariables != RECORDING::SOLUTION_AND_MESH) {
+    SetRecording(RECORDING::CLEAR_INDICES);
+
+    /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
+
+    SetRecording(SecondaryVariables);
+  }
 
-  /*--- Store the computational graph of one direct iteration with the secondary variables as input. ---*/
+  /*--- In vector mode the sensitivities of each objective function are extracted when writing the output. ---*/
 
-  SetRecording(SecondaryVariables);
+  if (config->GetVector_Adjoint()) {
+    for (auto iObj = 0u; iObj < config->GetnObj(); iObj++) {
+      AD::SetAdjointDirection(iObj);
+      SetAllSolutions(ZONE_0, true, VectorAdjSol[iObj]);
+      iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    }
+    SetVectorAdjObjFunction();
+    AD::ComputeAdjoint();
+    return;
+  }
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
    *    of the current iteration. The values are passed to the AD tool. ---*/
@@ -449,3 +909,105 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::ProjectGradient() {
+
+  if (rank == MASTER_NODE)
+    cout << "\n---------- Start gradient evaluation using sensitivity information ----------" << endl;
+
+  auto* geo = geometry_container[ZONE_0][INST_0][MESH_0];
+  const auto nDim = geo->GetnDim();
+
+  /*--- The projection works on the sensitivities stored in the geometry, as if read from the sensitivity file. ---*/
+
+  for (auto iPoint = 0ul; iPoint < geo->GetnPoint(); iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      geo->SetSensitivity(iPoint, iDim, solver[MainSolver]->GetNodes()->GetSensitivity(iPoint, iDim));
+
+  /*--- The grid movement classes use the design variable markers, and the transposed mesh deformation,
+   *    only when they run as SU2_DOT. The tape of the adjoint solver is no longer needed. ---*/
+
+  const auto kindSU2 = config->GetKind_SU2();
+  config->SetKind_SU2(SU2_COMPONENT::SU2_DOT);
+  AD::Reset();
+
+  /*--- Volume to surface sensitivities, unless the mesh deformation was part of the secondary recording. ---*/
+
+  if (SecondaryVariables == RECORDING::MESH_COORDS) {
+    if (rank == MASTER_NODE)
+      cout << "\n---------------------- Mesh sensitivity computation ---------------------" << endl;
+
+    if (grid_movement[ZONE_0][INST_0] == nullptr)
+      grid_movement[ZONE_0][INST_0] = new CVolumetricMovement(geo, config);
+    grid_movement[ZONE_0][INST_0]->SetVolume_Deformation(geo, config, false, true);
+  }
+
+  if (surface_movement[ZONE_0] == nullptr) surface_movement[ZONE_0] = new CSurfaceMovement();
+  surface_movement[ZONE_0]->CopyBoundary(geo, config);
+
+  const auto nDV = config->GetnDV();
+  auto** Gradient = new su2double*[nDV];
+  for (auto iDV = 0u; iDV < nDV; iDV++) {
+    Gradient[iDV] = new su2double[config->GetnDV_Value(iDV)]();
+  }
+
+  surface_movement[ZONE_0]->SetProjection_AD(geo, config, Gradient);
+
+  config->SetKind_SU2(kindSU2);
+
+  /*--- Write the gradient to a file. ---*/
+
+  ofstream Gradient_file;
+  Gradient_file.precision(config->OptionIsSet("OUTPUT_PRECISION") ? config->GetOutput_Precision() : 6);
+  if (rank == MASTER_NODE) Gradient_file.open(config->GetObjFunc_Grad_FileName().c_str(), ios::out);
+
+  CSurfaceMovement::OutputGradient(Gradient, config, Gradient_file);
+
+  for (auto iDV = 0u; iDV < nDV; iDV++) delete [] Gradient[iDV];
+  delete [] Gradient;
+}
+
+void CDiscAdjSinglezoneDriver::Output(unsigned long TimeIter) {
+
+  if (!config->GetVector_Adjoint() || VectorAdjSol.empty()) {
+    CSinglezoneDriver::Output(TimeIter);
+    return;
+  }
+
+  /*--- One set of files per objective function, named with its suffix, the first one is written last
+   *    such that its adjoint solution stays in the solvers. ---*/
+
+  auto* output = output_container[ZONE_0];
+  const auto restartName = output->GetRestartFilename();
+  const auto volumeName = output->GetVolumeFilename();
+  const auto surfaceName = output->GetSurfaceFilename();
+
+  for (auto iObj = config->GetnObj(); iObj-- > 0;) {
+    AD::SetAdjointDirection(iObj);
+    SetAllSolutions(ZONE_0, true, VectorAdjSol[iObj]);
+
+    if (SecondaryVariables == RECORDING::MESH_COORDS) {
+      solver[MainSolver]->SetSensitivity(geometry, config);
+    }
+    else { // MESH_DEFORM
+      solver[ADJMESH_SOL]->SetSensitivity(geometry, config, solver[MainSolver]);
+    }
+
+    /*--- Same naming as the restart file of a single objective function, see CConfig::GetObjFunc_Extension. ---*/
+
+    const auto suffix = config->GetObjFunc_Suffix(iObj);
+    const auto restartAdj = config->GetRestart_AdjFileName();
+    output->SetRestartFilename(restartAdj.substr(0, restartAdj.find_last_of('.')) + suffix + ".dat");
+    output->SetVolumeFilename(volumeName + suffix);
+    output->SetSurfaceFilename(surfaceName + suffix);
+
+    CSinglezoneDriver::Output(TimeIter);
+  }
+
+  output->SetRestartFilename(restartName);
+  output->SetVolumeFilename(volumeName);
+  output->SetSurfaceFilename(surfaceName);
+
+  AD::SetAdjointDirection(0);
+  AD::ClearAdjoints();
+}
@@ -31,12 +31,15 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
+#include "../../../Common/include/toolboxes/allocation_toolbox.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
 
 #include "../../include/output/COutputFactory.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../include/output/tools/CCheckpoint.hpp"
 
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
@@ -116,16 +119,33 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   /*--- Preprocessing of the config files. ---*/
 
+  PreprocTimer.Start("Input");
+
   PreprocessInput(config_container, driver_config);
 
+  MemoryAllocation::SetHugePages(config_container[ZONE_0]->GetHuge_Pages());
+
+  /*--- Distribution of harmonic balance instances over groups of ranks. ---*/
+
+  PreprocessInstanceGroups(config_container[ZONE_0]);
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
                           config_container[ZONE_0]->GetMesh_FileFormat());
 
+  PreprocTimer.Stop();
+
+  /*--- The restart iteration of a restart from node-local checkpoints is needed by the output. ---*/
+
+  const bool checkpointRestart = (nZone == 1) && config_container[ZONE_0]->GetCheckpoint_Restart();
+  if (checkpointRestart) CCheckpoint::Recover(config_container[ZONE_0]);
+
   /*--- Output preprocessing ---*/
 
+  PreprocTimer.Start("Output");
   PreprocessOutput(config_container, driver_config, output_container, driver_output);
+  PreprocTimer.Stop();
 
 
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -155,7 +175,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
+      PreprocTimer.Start("Geometry (zone " + to_string(iZone) + ")");
       InitializeGeometry(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      PreprocTimer.Stop();
 
     }
   }
@@ -165,7 +187,16 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
-  CGeometry::ComputeWallDistance(config_container, geometry_container);
+  PreprocTimer.Start("Wall distance");
+  {
+    const MemoryAllocation::CCategoryScope memCategory(MemoryAllocation::CATEGORY::GEOMETRY);
+    CGeometry::ComputeWallDistance(config_container, geometry_container);
+  }
+  PreprocTimer.Stop();
+
+  /*--- The recovered checkpoints are read by the solvers as in-memory restarts. ---*/
+
+  if (checkpointRestart) CCheckpoint::SetRestarts(config_container[ZONE_0], geometry_container[ZONE_0][INST_0][MESH_0]);
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -178,7 +209,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        fluxes, loops over the nodes to compute source terms, and routines for
        imposing various boundary condition type for the PDE. ---*/
 
+      PreprocTimer.Start("Solvers (zone " + to_string(iZone) + ")");
       InitializeSolver(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      PreprocTimer.Stop();
 
       /*--- Definition of the numerical method class:
        numerics_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
@@ -187,8 +220,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
 
+      PreprocTimer.Start("Numerics (zone " + to_string(iZone) + ")");
       InitializeNumerics(config_container[iZone], geometry_container[iZone][iInst],
                              solver_container[iZone][iInst], numerics_container[iZone][iInst]);
+      PreprocTimer.Stop();
 
       /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
        The integration class orchestrates the execution of the spatial integration
@@ -196,6 +231,7 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        the residual at each node, R(U) and then integrates the equations to a
        steady state or time-accurately. ---*/
 
+      PreprocTimer.Start("Integration and iteration (zone " + to_string(iZone) + ")");
       InitializeIntegration(config_container[iZone], solver_container[iZone][iInst][MESH_0],
                                 integration_container[iZone][iInst]);
 
@@ -214,6 +250,7 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
       /*--- Static mesh processing.  ---*/
 
       PreprocessStaticMesh(config_container[iZone], geometry_container[iZone][iInst]);
+      PreprocTimer.Stop();
 
     }
 
@@ -230,8 +267,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    PreprocTimer.Start("Multizone interface");
     InitializeInterface(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    PreprocTimer.Stop();
   }
 
   if (fsi) {
@@ -247,7 +286,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     if (rank == MASTER_NODE)
       cout << endl <<"---------------------- Turbomachinery Preprocessing ---------------------" << endl;
 
+    PreprocTimer.Start("Turbomachinery");
     PreprocessTurbomachinery(config_container, geometry_container, solver_container, interface_container, dummy_geo);
+    PreprocTimer.Stop();
   } else {
     mixingplane = false;
   }
@@ -288,6 +329,19 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   UsedTime = StopTime-StartTime;
   UsedTimePreproc = UsedTime;
 
+  if (driver_config->GetWrt_Performance()) {
+    PreprocTimer.Report("Preprocessing timings (over " + to_string(size) + " ranks):");
+    MemoryAllocation::PrintReport("Memory allocated by subsystem (over " + to_string(size) + " ranks):");
+  }
+  PreprocTimer.Clear();
+
+  /*--- The runtime profile covers the iterations, not the preprocessing. ---*/
+
+  CRuntimeProfiler::Enable(driver_config->GetRuntime_Profiling());
+  if (driver_config->GetRuntime_Profiling() && driver_config->GetHardware_Counters()) {
+    CRuntimeProfiler::EnableHardwareCounters();
+  }
+
   /*--- Reset timer for compute performance benchmarking. ---*/
 
   StartTime = SU2_MPI::Wtime();
@@ -346,6 +400,19 @@ void CDriver::Finalize() {
 
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
+  /*--- Finish writing the result files before anything they use is deleted. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (output_container[iZone] != nullptr) output_container[iZone]->WaitForAsyncOutput(config_container[iZone]);
+  }
+
+  if (CRuntimeProfiler::IsEnabled()) {
+    CRuntimeProfiler::WriteSummary("runtime_profile");
+    CRuntimeProfiler::Enable(false);
+  }
+
+  BandwidthSum = config_container[ZONE_0]->GetRestart_Bandwidth_Agg();
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -599,6 +666,8 @@ void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
 
 void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  const MemoryAllocation::CCategoryScope memCategory(MemoryAllocation::CATEGORY::GEOMETRY);
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -693,7 +762,9 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
+  PreprocTimer.Start("Mesh reading");
   CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  PreprocTimer.Stop();
 
   /*--- Set the dimension --- */
 
@@ -701,7 +772,9 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
 
+  PreprocTimer.Start("Partitioning");
   geometry_aux->SetColorGrid_Parallel(config);
+  PreprocTimer.Stop();
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -710,6 +783,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Build the grid data structures using the ParMETIS coloring. ---*/
 
+  PreprocTimer.Start("Distribution");
   geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
 
   /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
@@ -721,21 +795,31 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetBoundaries(config);
+  PreprocTimer.Stop();
 
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
+  PreprocTimer.Start("Connectivity and renumbering");
+
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points for data locality ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (config->GetKind_PointOrdering() != POINT_ORDERING::NONE) {
+    if (config->GetKind_PointOrdering() == POINT_ORDERING::RCM) {
+      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      geometry[MESH_0]->SetRCM_Ordering(config);
+    } else {
+      if (rank == MASTER_NODE) cout << "Renumbering points (Hilbert Curve Ordering)." << endl;
+      geometry[MESH_0]->SetHilbert_Ordering(config);
+    }
 
-  /*--- recompute elements surrounding points, points surrounding points ---*/
+    /*--- recompute elements surrounding points, points surrounding points ---*/
 
-  if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-  geometry[MESH_0]->SetPoint_Connectivity();
+    if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+    geometry[MESH_0]->SetPoint_Connectivity();
+  }
 
   /*--- Compute elements surrounding elements ---*/
 
@@ -751,8 +835,11 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[MESH_0]->Check_BoundElem_Orientation(config);
   }
 
+  PreprocTimer.Stop();
+
   /*--- Create the edge structure ---*/
 
+  PreprocTimer.Start("Dual grid");
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
   geometry[MESH_0]->SetVertex(config);
@@ -776,6 +863,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
   geometry[MESH_0]->FindNormal_Neighbor(config);
+  geometry[MESH_0]->SetBoundaryMarkerOverlap(config);
 
   /*--- Store the global to local mapping. ---*/
 
@@ -806,10 +894,14 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
   }
 
+  PreprocTimer.Stop();
+
   geometry[MESH_0]->SetMGLevel(MESH_0);
   if ((config->GetnMGLevels() != 0) && (rank == MASTER_NODE))
     cout << "Setting the multigrid structure." << endl;
 
+  PreprocTimer.Start("Multigrid");
+
   /*--- Loop over all the new grid ---*/
 
   for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
@@ -829,13 +921,17 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
     /*--- Create the control volume structures ---*/
 
-    geometry[iMGlevel]->SetControlVolume(geometry[iMGlevel-1], ALLOCATE);
-    geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGlevel-1], config, ALLOCATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    SU2_OMP_PARALLEL {
+      geometry[iMGlevel]->SetControlVolume(geometry[iMGlevel-1], ALLOCATE);
+      geometry[iMGlevel]->SetBoundControlVolume(geometry[iMGlevel-1], config, ALLOCATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    }
+    END_SU2_OMP_PARALLEL
 
     /*--- Find closest neighbor to a surface point ---*/
 
     geometry[iMGlevel]->FindNormal_Neighbor(config);
+    geometry[iMGlevel]->SetBoundaryMarkerOverlap(config);
 
     /*--- Store our multigrid index. ---*/
 
@@ -856,6 +952,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   if (config->GetWrt_MultiGrid()) geometry[MESH_0]->ColorMGLevels(config->GetnMGLevels(), geometry);
 
+  PreprocTimer.Stop();
+
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
 
@@ -877,6 +975,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   /*--- Create the data structure for MPI point-to-point communications. ---*/
 
+  PreprocTimer.Start("Communication patterns");
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
     geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
 
@@ -901,6 +1000,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[iMGlevel]->InitiateComms(geometry[iMGlevel], config, MPI_QUANTITIES::NEIGHBORS);
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, MPI_QUANTITIES::NEIGHBORS);
   }
+  PreprocTimer.Stop();
 
 }
 
@@ -962,6 +1062,7 @@ void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
   /*--- Compute the metric terms of the surface elements. ---*/
   if (rank == MASTER_NODE) cout << "Computing metric terms surface elements." << endl;
   DGMesh->MetricTermsSurfaceElements(config);
+  DGMesh->ReportMemoryMetricTerms();
 
   /*--- Compute a length scale of the volume elements. ---*/
   if (rank == MASTER_NODE) cout << "Computing length scale volume elements." << endl;
@@ -998,6 +1099,8 @@ void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
 
 void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver ***&solver) {
 
+  const MemoryAllocation::CCategoryScope memCategory(MemoryAllocation::CATEGORY::SOLVER);
+
   MAIN_SOLVER kindSolver = config->GetKind_Solver();
 
   if (rank == MASTER_NODE)
@@ -1177,6 +1280,16 @@ void CDriver::InitializeIntegration(CConfig *config, CSolver **solver, CIntegrat
 
   integration = CIntegrationFactory::CreateIntegrationContainer(kindMainSolver, solver);
 
+  /*--- The turbulence and species solvers can also use the multigrid integration. ---*/
+
+  if (config->GetMG_ScalarSolvers()) {
+    for (auto iSol : {TURB_SOL, SPECIES_SOL}) {
+      if (integration[iSol] == nullptr) continue;
+      delete integration[iSol];
+      integration[iSol] = CIntegrationFactory::CreateIntegration(INTEGRATION_TYPE::MULTIGRID);
+    }
+  }
+
 }
 
 void CDriver::FinalizeIntegration(CIntegration ***integration, CGeometry **geometry, CConfig *config, unsigned short val_iInst) {
@@ -2589,6 +2702,57 @@ void CDriver::PreprocessStaticMesh(const CConfig *config, CGeometry** geometry){
 
 }
 
+void CDriver::PreprocessInstanceGroups(const CConfig* config) {
+
+  const bool hbGroups = (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) &&
+                        (config->GetHB_InstanceGroups() > 1);
+  const bool timeGroups = (config->GetTimeParallelGroups() > 1);
+
+  if (!hbGroups && !timeGroups) return;
+
+  if (hbGroups) {
+    nInstGroups = config->GetHB_InstanceGroups();
+
+    if (size % nInstGroups != 0 || nInstGroups > config->GetnTimeInstances()) {
+      SU2_MPI::Error("HB_INSTANCE_GROUPS must divide the number of MPI ranks and not exceed TIME_INSTANCES.",
+                     CURRENT_FUNCTION);
+    }
+  } else {
+    /*--- Time slices of the parareal driver. ---*/
+    nInstGroups = config->GetTimeParallelGroups();
+
+    if (size % nInstGroups != 0) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS must divide the number of MPI ranks.", CURRENT_FUNCTION);
+    }
+  }
+
+#ifdef HAVE_MPI
+  /*--- Groups of consecutive ranks, the ranks with the same index in each group own the same points. ---*/
+
+  const int groupSize = size / nInstGroups;
+  iInstGroup = rank / groupSize;
+
+  SU2_Comm groupComm;
+  MPI_Comm_split(SU2_MPI::GetComm(), iInstGroup, rank, &groupComm);
+  MPI_Comm_split(SU2_MPI::GetComm(), rank % groupSize, rank, &instGroupsComm);
+
+  if (rank == MASTER_NODE) {
+    if (hbGroups) cout << "The " << config->GetnTimeInstances() << " time instances are";
+    else cout << "The time slices are";
+    cout << " distributed over " << nInstGroups << " groups of " << groupSize << " ranks." << endl;
+  }
+
+  SU2_MPI::SetComm(groupComm);
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  /*--- Only the first group writes to the screen. ---*/
+
+  if (iInstGroup != 0) cout.rdbuf(nullptr);
+#endif
+
+}
+
 void CDriver::PreprocessOutput(CConfig **config, CConfig *driver_config, COutput **&output, COutput *&driver_output){
 
   /*--- Definition of the output class (one for each zone). The output class
@@ -2606,7 +2770,7 @@ void CDriver::PreprocessOutput(CConfig **config, CConfig *driver_config, COutput
     output[iZone] = COutputFactory::CreateOutput(kindSolver, config[iZone], nDim);
 
     /*--- If dry-run is used, do not open/overwrite history file. ---*/
-    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run);
+    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run && iInstGroup == 0);
 
     output[iZone]->PreprocessVolumeOutput(config[iZone]);
 
@@ -2742,6 +2906,7 @@ void CDriver::PreprocessTurbomachinery(CConfig** config, CGeometry**** geometry,
     solver[iZone][INST_0][MESH_0][FLOW_SOL]->TurboAverageProcess(solver[iZone][INST_0][MESH_0], geometry[iZone][INST_0][MESH_0],config[iZone],INFLOW);
     solver[iZone][INST_0][MESH_0][FLOW_SOL]->TurboAverageProcess(solver[iZone][INST_0][MESH_0], geometry[iZone][INST_0][MESH_0],config[iZone],OUTFLOW);
     solver[iZone][INST_0][MESH_0][FLOW_SOL]->GatherInOutAverageValues(config[iZone], geometry[iZone][INST_0][MESH_0]);
+    solver[iZone][INST_0][MESH_0][FLOW_SOL]->CompleteInOutAverageValues(config[iZone]);
     if (rank == MASTER_NODE){
       flowAngleIn = solver[iZone][INST_0][MESH_0][FLOW_SOL]->GetTurboVelocityIn(iZone, config[iZone]->GetnSpanWiseSections())[1];
       flowAngleIn /= solver[iZone][INST_0][MESH_0][FLOW_SOL]->GetTurboVelocityIn(iZone, config[iZone]->GetnSpanWiseSections())[0];
@@ -2759,6 +2924,25 @@ void CDriver::PreprocessTurbomachinery(CConfig** config, CGeometry**** geometry,
 
 CDriver::~CDriver() = default;
 
+void CDriver::PrintTurbulenceRecording() const {
+
+  if (rank != MASTER_NODE) return;
+
+  for (unsigned short iZone = 0; iZone < nZone; iZone++) {
+    const auto* config = config_container[iZone];
+    if (config->GetKind_Turb_Model() == TURB_MODEL::NONE) continue;
+
+    cout << "  Zone " << iZone << ": ";
+    if (config->GetFrozen_Visc_Disc()) {
+      cout << "turbulence frozen (FROZEN_VISC_DISC), its variables are passive on the tape.\n";
+    } else {
+      cout << "turbulence differentiated, FROZEN_VISC_DISC= YES removes the \"Turbulence\" section\n"
+           << "  from the tape and its adjoint, at the cost of frozen-turbulence sensitivities.\n";
+    }
+  }
+  cout << "-------------------------------------------------------" << endl;
+}
+
 void CDriver::PrintDirectResidual(RECORDING kind_recording) {
 
   if (rank != MASTER_NODE || kind_recording != RECORDING::SOLUTION_VARIABLES) return;
@@ -3126,28 +3310,81 @@ CHBDriver::~CHBDriver() {
   /*--- delete dynamic memory for the Harmonic Balance operator ---*/
   for (kInst = 0; kInst < nInstHB; kInst++) delete [] D[kInst];
   delete [] D;
+
+#ifdef HAVE_MPI
+  if (nInstGroups > 1) MPI_Comm_free(&instGroupsComm);
+#endif
 }
 
 
 void CHBDriver::Run() {
 
   /*--- Run a single iteration of a Harmonic Balance problem. Preprocess all
-   all zones before beginning the iteration. ---*/
+   all zones before beginning the iteration. Each group of ranks only iterates
+   its own instances, which are then exchanged with the other groups. ---*/
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (!OwnsInstance(iInst)) continue;
     iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (!OwnsInstance(iInst)) continue;
     iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+
+  ExchangeInstances();
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (!OwnsInstance(iInst)) continue;
     iteration_container[ZONE_0][iInst]->Monitor(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+  }
+
+}
+
+void CHBDriver::ExchangeInstances() {
+
+  if (nInstGroups < 2) return;
+
+#ifdef HAVE_MPI
+  /*--- The owner of each instance broadcasts the variables used by the harmonic balance source terms to
+   the ranks that own the same points in the other groups (their rank in instGroupsComm is the group). ---*/
+
+  const bool adjoint = config_container[ZONE_0]->GetContinuous_Adjoint();
+  const bool rans = (config_container[ZONE_0]->GetKind_Solver() == MAIN_SOLVER::RANS);
+  const bool precondition = (config_container[ZONE_0]->GetHB_Precondition() == YES);
+  const auto nMGlevels = config_container[ZONE_0]->GetnMGLevels();
+
+  auto Broadcast = [this](su2double* data, size_t count, unsigned short root) {
+    SU2_MPI::Bcast(data, static_cast<int>(count), MPI_DOUBLE, root, instGroupsComm);
+  };
+
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    const unsigned short root = iInst % nInstGroups;
+
+    for (auto iMGlevel = 0u; iMGlevel <= nMGlevels; iMGlevel++) {
+      auto* nodes = solver_container[ZONE_0][iInst][iMGlevel][adjoint ? ADJFLOW_SOL : FLOW_SOL]->GetNodes();
+      Broadcast(nodes->GetSolution().data(), nodes->GetSolution().size(), root);
+      Broadcast(nodes->GetSolution_Old().data(), nodes->GetSolution_Old().size(), root);
+
+      /*--- The preconditioner uses the time step of the first instance. ---*/
+      if (precondition && iInst == INST_0) {
+        auto* flowNodes = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes();
+        Broadcast(flowNodes->GetDelta_Time().data(), flowNodes->GetDelta_Time().size(), root);
+      }
+    }
+    if (rans) {
+      auto* nodes = solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes();
+      Broadcast(nodes->GetSolution().data(), nodes->GetSolution().size(), root);
+    }
+  }
+#endif
 
 }
 
@@ -3155,7 +3392,7 @@ void CHBDriver::Update() {
 
   for (iInst = 0; iInst < nInstHB; iInst++) {
     /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
+    if (OwnsInstance(iInst)) SetHarmonicBalance(iInst);
 
   }
 
@@ -3166,6 +3403,7 @@ void CHBDriver::Update() {
   }
 
   for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (!OwnsInstance(iInst)) continue;
 
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
@@ -3176,6 +3414,22 @@ void CHBDriver::Update() {
 
 }
 
+void CHBDriver::Output(unsigned long InnerIter) {
+
+  /*--- Each group of ranks writes the files of its own instances. ---*/
+
+  const auto inst = config_container[ZONE_0]->GetiInst();
+
+  for (iInst = 0; iInst < nInstHB; ++iInst) {
+    if (!OwnsInstance(iInst)) continue;
+    config_container[ZONE_0]->SetiInst(iInst);
+    output_container[ZONE_0]->SetResultFiles(geometry_container[ZONE_0][iInst][MESH_0], config_container[ZONE_0],
+                                             solver_container[ZONE_0][iInst][MESH_0], InnerIter, StopCalc);
+  }
+  config_container[ZONE_0]->SetiInst(inst);
+
+}
+
 void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
   unsigned short iVar, jInst, iMGlevel;
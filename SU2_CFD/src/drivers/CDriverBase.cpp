@@ -58,6 +58,8 @@ CDriverBase::CDriverBase(char* confFile, unsigned short val_nZone, SU2_Comm MPIC
   /*--- OpenMP initialization ---*/
   omp_initialize();
 
+  if (rank == MASTER_NODE) cout << omp_affinity_report() << endl;
+
   /*--- Initialize AD ---*/
   AD::Initialize();
 }
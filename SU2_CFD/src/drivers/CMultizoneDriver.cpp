@@ -30,6 +30,7 @@
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
+#include <thread>
 
 CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator) :
                   CDriver(confFile, val_nZone, MPICommunicator, false) {
@@ -115,6 +116,8 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
     }
   }
 
+  SetConcurrentZones();
+
 }
 
 CMultizoneDriver::~CMultizoneDriver() {
@@ -132,6 +135,89 @@ CMultizoneDriver::~CMultizoneDriver() {
 
   delete [] prefixed_motion;
 
+#ifdef HAVE_MPI
+  for (auto& comm : zoneComm) MPI_Comm_free(&comm);
+#endif
+
+}
+
+void CMultizoneDriver::SetConcurrentZones() {
+
+  if (!driver_config->GetMultizone_ConcurrentZones() || nZone < 2) return;
+
+  if (driver_config->GetKind_MZSolver() != ENUM_MULTIZONE::MZ_BLOCK_JACOBI) {
+    if (rank == MASTER_NODE)
+      cout << "WARNING: MULTIZONE_CONCURRENT_ZONES requires MULTIZONE_SOLVER= BLOCK_JACOBI, "
+              "the zones will be solved sequentially." << endl;
+    return;
+  }
+
+#if defined(CODI_FORWARD_TYPE) || defined(CODI_REVERSE_TYPE)
+  /*--- The AD tape is not thread safe at this level. ---*/
+  if (rank == MASTER_NODE)
+    cout << "WARNING: MULTIZONE_CONCURRENT_ZONES is not available in AD builds, "
+            "the zones will be solved sequentially." << endl;
+  return;
+#endif
+
+#ifdef HAVE_MPI
+  /*--- Each zone communicates on a duplicate communicator, which is only safe with MPI_THREAD_MULTIPLE. ---*/
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided < MPI_THREAD_MULTIPLE) {
+    if (rank == MASTER_NODE)
+      cout << "WARNING: MULTIZONE_CONCURRENT_ZONES requires MPI_THREAD_MULTIPLE (start SU2_CFD with --thread_multiple).\n"
+              "         The zones will be solved sequentially." << endl;
+    return;
+  }
+  zoneComm.resize(nZone);
+  for (auto& comm : zoneComm) MPI_Comm_dup(SU2_MPI::GetComm(), &comm);
+#endif
+
+  concurrentZones = true;
+
+  /*--- Share the threads of this rank among the zones in proportion to their number of points,
+   *    the load of each zone is balanced across ranks by the partitioning. ---*/
+  const int nThreads = omp_get_max_threads();
+  unsigned long nPointTotal = 0;
+  for (iZone = 0; iZone < nZone; iZone++) nPointTotal += geometry_container[iZone][INST_0][MESH_0]->GetnPointDomain();
+
+  zoneThreads.resize(nZone);
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto nPoint = geometry_container[iZone][INST_0][MESH_0]->GetnPointDomain();
+    zoneThreads[iZone] = max(1, static_cast<int>(nThreads * nPoint / max(nPointTotal, 1ul)));
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "The zones will be solved concurrently, threads of the master rank per zone:";
+    for (auto n : zoneThreads) cout << " " << n;
+    cout << endl;
+  }
+
+}
+
+void CMultizoneDriver::SolveZonesConcurrently() {
+
+  vector<std::thread> zoneThread;
+  zoneThread.reserve(nZone);
+
+  for (unsigned short jZone = 0; jZone < nZone; jZone++) {
+    zoneThread.emplace_back([this](unsigned short iZone) {
+#ifdef HAVE_MPI
+      SU2_MPI::SetThreadComm(zoneComm[iZone]);
+#endif
+      omp_set_num_threads(zoneThreads[iZone]);
+
+      config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
+
+      iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
+                                                solver_container, numerics_container, config_container,
+                                                surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    }, jZone);
+  }
+
+  for (auto& thread : zoneThread) thread.join();
+
 }
 
 void CMultizoneDriver::StartSolver() {
@@ -363,8 +449,17 @@ void CMultizoneDriver::RunJacobi() {
 
     }
 
+    /*--- The zones are independent within a block-Jacobi iteration, they may be solved concurrently. ---*/
+    if (concurrentZones) {
+      for (iZone = 0; iZone < nZone; iZone++) config_container[iZone]->SetOuterIter(iOuter_Iter);
+
+      SolveZonesConcurrently();
+
+      for (iZone = 0; iZone < nZone; iZone++) Corrector(iZone);
+    }
+
       /*--- Loop over the number of zones (IZONE) ---*/
-    for (iZone = 0; iZone < nZone; iZone++) {
+    for (iZone = 0; iZone < nZone && !concurrentZones; iZone++) {
 
       /*--- Set the OuterIter ---*/
       config_container[iZone]->SetOuterIter(iOuter_Iter);
@@ -501,7 +596,7 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned long TimeIter) {
   }
   /*--- Update the wall distances if the mesh was deformed. ---*/
   if (AnyDeformMesh) {
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, true);
   }
 }
 
@@ -526,7 +621,7 @@ void CMultizoneDriver::DynamicMeshUpdate(unsigned short val_iZone, unsigned long
   /*--- Update the wall distances if the mesh was deformed. ---*/
   if (config_container[val_iZone]->GetGrid_Movement() ||
       config_container[val_iZone]->GetDeform_Mesh()) {
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, true);
   }
 }
 
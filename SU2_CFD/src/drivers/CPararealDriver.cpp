@@ -0,0 +1,286 @@
+/*!
+ * \file CPararealDriver.cpp
+ * \brief The main subroutines for driving time-parallel (parareal) unsteady single zone problems.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPararealDriver.hpp"
+#include "../../include/output/COutput.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+namespace {
+/*--- Solvers whose unsteady state is transferred between the time slices. ---*/
+constexpr unsigned short PararealSolvers[] = {FLOW_SOL, TURB_SOL, SPECIES_SOL, HEAT_SOL};
+}  // namespace
+
+CPararealDriver::CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator)
+    : CSinglezoneDriver(confFile, val_nZone, MPICommunicator) {
+
+  const auto* config = config_container[ZONE_0];
+
+  coarsening = config->GetParareal_Coarsening();
+  secondOrder = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  /*--- The divisibility of the time iterations was checked by CConfig. ---*/
+  const unsigned long startIter = config->GetRestart() ? config->GetRestart_Iter() : 0;
+  sliceLength = (config->GetnTime_Iter() - startIter) / nInstGroups;
+  sliceStart = startIter + iInstGroup * sliceLength;
+}
+
+CPararealDriver::~CPararealDriver() {
+#ifdef HAVE_MPI
+  if (nInstGroups > 1) MPI_Comm_free(&instGroupsComm);
+#endif
+}
+
+void CPararealDriver::GetState(vector<su2double>& state) {
+
+  state.clear();
+
+  for (const auto iSol : PararealSolvers) {
+    auto* solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (solver == nullptr) continue;
+
+    const auto& time_n = solver->GetNodes()->GetSolution_time_n();
+    state.insert(state.end(), time_n.data(), time_n.data() + time_n.size());
+
+    if (secondOrder) {
+      const auto& time_n1 = solver->GetNodes()->GetSolution_time_n1();
+      state.insert(state.end(), time_n1.data(), time_n1.data() + time_n1.size());
+    }
+  }
+}
+
+void CPararealDriver::SetState(const vector<su2double>& state) {
+
+  const auto nMGLevels = config_container[ZONE_0]->GetnMGLevels();
+  auto** geometry = geometry_container[ZONE_0][INST_0];
+  const su2double* data = state.data();
+
+  for (const auto iSol : PararealSolvers) {
+    auto* solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (solver == nullptr) continue;
+
+    auto* nodes = solver->GetNodes();
+    auto& time_n = nodes->GetSolution_time_n();
+    copy_n(data, time_n.size(), time_n.data());
+    data += time_n.size();
+
+    if (secondOrder) {
+      auto& time_n1 = nodes->GetSolution_time_n1();
+      copy_n(data, time_n1.size(), time_n1.data());
+      data += time_n1.size();
+    }
+    copy_n(time_n.data(), time_n.size(), nodes->GetSolution().data());
+
+    /*--- The coarse grids also integrate the dual time source terms, restrict the time levels to them
+     (volume weighted average of the children, as for the solution in the multigrid cycle). ---*/
+
+    const auto nVar = solver->GetnVar();
+    vector<su2double> sol_n(nVar), sol_n1(nVar);
+
+    for (auto iMesh = 1u; iMesh <= nMGLevels; iMesh++) {
+      auto* coarseSolver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (coarseSolver == nullptr) break;
+
+      auto* coarseNodes = coarseSolver->GetNodes();
+      const auto* fineNodes = solver_container[ZONE_0][INST_0][iMesh-1][iSol]->GetNodes();
+
+      for (auto iPoint = 0ul; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+        const su2double volume = geometry[iMesh]->nodes->GetVolume(iPoint);
+        fill(sol_n.begin(), sol_n.end(), 0.0);
+        fill(sol_n1.begin(), sol_n1.end(), 0.0);
+
+        for (auto iChild = 0u; iChild < geometry[iMesh]->nodes->GetnChildren_CV(iPoint); iChild++) {
+          const auto jPoint = geometry[iMesh]->nodes->GetChildren_CV(iPoint, iChild);
+          const su2double weight = geometry[iMesh-1]->nodes->GetVolume(jPoint) / volume;
+
+          for (auto iVar = 0u; iVar < nVar; iVar++) {
+            sol_n[iVar] += weight * fineNodes->GetSolution_time_n(jPoint, iVar);
+            if (secondOrder) sol_n1[iVar] += weight * fineNodes->GetSolution_time_n1(jPoint, iVar);
+          }
+        }
+        coarseNodes->Set_Solution_time_n(iPoint, sol_n.data());
+        if (secondOrder) coarseNodes->Set_Solution_time_n1(iPoint, sol_n1.data());
+        coarseNodes->SetSolution(iPoint, sol_n.data());
+      }
+    }
+  }
+}
+
+void CPararealDriver::ScaleTimeSpacing(vector<su2double>& state, su2double factor) const {
+
+  if (!secondOrder) return;
+
+  /*--- Linear extrapolation (or interpolation) of time level n-1 for a different time step. ---*/
+
+  su2double* data = state.data();
+
+  for (const auto iSol : PararealSolvers) {
+    auto* solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (solver == nullptr) continue;
+
+    const auto size = solver->GetNodes()->GetSolution_time_n().size();
+    for (auto i = 0ul; i < size; i++) {
+      data[size + i] = data[i] - factor * (data[i] - data[size + i]);
+    }
+    data += 2 * size;
+  }
+}
+
+void CPararealDriver::Propagate(bool coarse, bool output) {
+
+  auto* config = config_container[ZONE_0];
+  const su2double dtFine = config->GetDelta_UnstTimeND();
+  const unsigned long step = coarse ? coarsening : 1;
+
+  config->SetDelta_UnstTimeND(dtFine * step);
+  output_container[ZONE_0]->SetHistoryWriting(output && !dry_run && iInstGroup == 0);
+
+  for (auto iter = sliceStart; iter < sliceStart + sliceLength; iter += step) {
+
+    /*--- The initial condition was set by SetState, the rest of the preprocessing does not apply
+     to the problems supported by this driver (static meshes). ---*/
+
+    TimeIter = iter;
+    config->SetTimeIter(iter);
+    config->SetPhysicalTime(static_cast<su2double>(iter) * dtFine);
+
+    Run();
+
+    Postprocess();
+
+    Update();
+
+    if (output) {
+      Monitor(iter);
+      Output(iter);
+      if (StopCalc) break;
+    }
+  }
+
+  config->SetDelta_UnstTimeND(dtFine);
+  output_container[ZONE_0]->SetHistoryWriting(!dry_run && iInstGroup == 0);
+}
+
+void CPararealDriver::StartSolver() {
+
+  StartTime = SU2_MPI::Wtime();
+
+  config_container[ZONE_0]->Set_StartTime(StartTime);
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+    cout << endl << "Simulation Run using the Parareal Driver" << endl;
+    cout << "The simulation will run for " << nInstGroups * sliceLength << " time steps, in " << nInstGroups
+         << " slices of " << sliceLength << " time steps." << endl;
+  }
+
+  const auto nIter = config_container[ZONE_0]->GetParareal_Iter();
+  const su2double tol = config_container[ZONE_0]->GetParareal_Tol();
+  const bool first = (iInstGroup == 0);
+  const bool last = (iInstGroup + 1 == nInstGroups);
+
+  /*--- The ranks that own the same points in consecutive groups exchange the states at the slice
+   boundaries, their rank in instGroupsComm is the group. ---*/
+
+  auto Receive = [&](vector<su2double>& state) {
+#ifdef HAVE_MPI
+    SU2_MPI::Status status;
+    SU2_MPI::Recv(state.data(), state.size(), MPI_DOUBLE, iInstGroup - 1, 0, instGroupsComm, &status);
+#endif
+  };
+  auto Send = [&](vector<su2double>& state) {
+#ifdef HAVE_MPI
+    SU2_MPI::Send(state.data(), state.size(), MPI_DOUBLE, iInstGroup + 1, 0, instGroupsComm);
+#endif
+  };
+
+  /*--- Coarse propagation of a state, with the time levels converted to the coarse time step. ---*/
+
+  auto PropagateCoarse = [&](vector<su2double> state, vector<su2double>& result) {
+    ScaleTimeSpacing(state, coarsening);
+    SetState(state);
+    Propagate(true, false);
+    GetState(result);
+    ScaleTimeSpacing(result, 1.0 / coarsening);
+  };
+
+  /*--- Initial condition of the first slice, the other slices start from a coarse sequential sweep. ---*/
+
+  Preprocess(sliceStart);
+
+  vector<su2double> start, fine, coarseOld, coarseNew, end;
+  GetState(start);
+
+  if (!first) Receive(start);
+  PropagateCoarse(start, coarseOld);
+  if (!last) Send(coarseOld);
+
+  end = coarseOld;
+
+  for (auto iIter = 0ul; iIter < nIter; iIter++) {
+
+    /*--- Fine propagation of all slices in parallel. ---*/
+
+    SetState(start);
+    Propagate(false, false);
+    GetState(fine);
+
+    /*--- Sequential correction sweep, U_{n+1} = G(U_n) + F(U_n^old) - G(U_n^old). ---*/
+
+    if (!first) Receive(start);
+    PropagateCoarse(start, coarseNew);
+
+    su2double norms[2] = {0.0, 0.0};
+    for (auto i = 0ul; i < end.size(); i++) {
+      const su2double value = coarseNew[i] + fine[i] - coarseOld[i];
+      norms[0] += pow(value - end[i], 2);
+      norms[1] += pow(value, 2);
+      end[i] = value;
+    }
+    swap(coarseOld, coarseNew);
+
+    if (!last) Send(end);
+
+    /*--- Largest relative change of the slice end states. ---*/
+
+    su2double globalNorms[2] = {0.0, 0.0};
+    SU2_MPI::Allreduce(norms, globalNorms, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    su2double change = sqrt(globalNorms[0] / max(globalNorms[1], EPS));
+#ifdef HAVE_MPI
+    const su2double localChange = change;
+    SU2_MPI::Allreduce(&localChange, &change, 1, MPI_DOUBLE, MPI_MAX, instGroupsComm);
+#endif
+
+    if (rank == MASTER_NODE) {
+      cout << "Parareal iteration " << iIter + 1 << ", relative change of the slice states: " << change << endl;
+    }
+    if (change < tol) break;
+  }
+
+  /*--- Final fine propagation of each slice with output. ---*/
+
+  SetState(start);
+  Propagate(false, true);
+}
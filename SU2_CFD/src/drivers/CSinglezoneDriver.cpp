@@ -29,6 +29,7 @@
 #include "../../include/definition_structure.hpp"
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIteration.hpp"
+#include "../../include/output/tools/CCheckpoint.hpp"
 
 CSinglezoneDriver::CSinglezoneDriver(char* confFile,
                        unsigned short val_nZone,
@@ -39,6 +40,14 @@ CSinglezoneDriver::CSinglezoneDriver(char* confFile,
 
   /*--- Initialize the counter for TimeIter ---*/
   TimeIter = 0;
+
+  const auto config = config_container[ZONE_0];
+  if (driver_config->GetTime_Domain() && config->GetCheckpoint_Freq() > 0 && !config->GetDiscrete_Adjoint()) {
+    if (solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL] == nullptr) {
+      SU2_MPI::Error("CHECKPOINT_FREQ is only available for flow solvers.", CURRENT_FUNCTION);
+    }
+    checkpoint = std::unique_ptr<CCheckpoint>(new CCheckpoint(config));
+  }
 }
 
 CSinglezoneDriver::~CSinglezoneDriver() = default;
@@ -92,6 +101,13 @@ void CSinglezoneDriver::StartSolver() {
 
     Output(TimeIter);
 
+    /*--- Save the node-local checkpoint. ---*/
+
+    if (checkpoint && (TimeIter + 1) % config_container[ZONE_0]->GetCheckpoint_Freq() == 0) {
+      checkpoint->Save(config_container[ZONE_0], geometry_container[ZONE_0][INST_0][MESH_0],
+                       solver_container[ZONE_0][INST_0][MESH_0], TimeIter);
+    }
+
     /*--- If the convergence criteria has been met, terminate the simulation. ---*/
 
     if (StopCalc) break;
@@ -242,7 +258,7 @@ void CSinglezoneDriver::DynamicMeshUpdate(unsigned long TimeIter) {
   /*--- Update the wall distances if the mesh was deformed. ---*/
   if (config_container[ZONE_0]->GetGrid_Movement() ||
       config_container[ZONE_0]->GetDeform_Mesh()) {
-    CGeometry::ComputeWallDistance(config_container, geometry_container);
+    CGeometry::ComputeWallDistance(config_container, geometry_container, true);
   }
 }
 
@@ -49,7 +49,10 @@ CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluid
 #endif
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
-      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e);
+      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e,
+                                      display && config->GetLUT_Write_Binary());
+      if (config->GetLUT_Search_Grid()) lookup_table->BuildSearchGrid();
+      if (config->GetLUT_Structured()) lookup_table->DetectStructuredLevels();
       break;
     default:
       break;
@@ -177,6 +180,90 @@ void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
   dsdP_rho = dsde_rho / dPde_rho;
 }
 
+void CDataDrivenFluid::SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                            TDStateBlock& state) {
+  /*--- Entropy derivatives of all points, the data set is evaluated at clipped density and energy. ---*/
+  su2double ds_de[BlockSize], ds_drho[BlockSize], d2s_de2[BlockSize], d2s_dedrho[BlockSize], d2s_drho2[BlockSize];
+
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    Evaluate_Dataset(min(rho_max, max(rho_min, rho[i])), min(e_max, max(e_min, e[i])));
+
+    state.Entropy[i] = Entropy;
+    state.Extrapolation[i] = outside_dataset;
+    ds_de[i] = dsde_rho;
+    ds_drho[i] = dsdrho_e;
+    d2s_de2[i] = d2sde2;
+    d2s_dedrho[i] = d2sdedrho;
+    d2s_drho2[i] = d2sdrho2;
+  }
+
+  ComputeStateBlock(nPoint, rho, ds_de, ds_drho, d2s_de2, d2s_dedrho, d2s_drho2, state);
+}
+
+void CDataDrivenFluid::ComputeStateBlock(unsigned long nPoint, const su2double* rho, const su2double* ds_de,
+                                         const su2double* ds_drho, const su2double* d2s_de2,
+                                         const su2double* d2s_dedrho, const su2double* d2s_drho2,
+                                         TDStateBlock& state) {
+  /*--- Same expressions as SetTDState_rhoe. ---*/
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    const su2double blue_term = (ds_drho[i] * (2 - rho[i] * pow(ds_de[i], -1) * d2s_dedrho[i]) + rho[i] * d2s_drho2[i]);
+    const su2double green_term = (-pow(ds_de[i], -1) * d2s_de2[i] * ds_drho[i] + d2s_dedrho[i]);
+
+    state.SoundSpeed2[i] = -rho[i] * pow(ds_de[i], -1) * (blue_term - rho[i] * green_term * (ds_drho[i] / ds_de[i]));
+
+    const su2double T = 1.0 / ds_de[i];
+    const su2double dTde = -pow(ds_de[i], -2) * d2s_de2[i];
+    const su2double dTdrho = -pow(ds_de[i], -2) * d2s_dedrho[i];
+
+    state.Temperature[i] = T;
+    state.Pressure[i] = -pow(rho[i], 2) * T * ds_drho[i];
+    state.dPde_rho[i] = -pow(rho[i], 2) * (dTde * ds_drho[i] + T * d2s_dedrho[i]);
+    state.dPdrho_e[i] = -2 * rho[i] * T * ds_drho[i] - pow(rho[i], 2) * (dTdrho * ds_drho[i] + T * d2s_drho2[i]);
+  }
+}
+
+bool CDataDrivenFluid::HasBatchEvaluation() const {
+  return Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT && lookup_table->UsesDevice();
+}
+
+void CDataDrivenFluid::SetTDStateBatch_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e) {
+  const auto nOutput = LUT_lookup_indices.size();
+  batch_rho.resize(nPoint);
+  batch_e.resize(nPoint);
+  batch_outputs.resize(nPoint * nOutput);
+  batch_outside.resize(nPoint);
+
+  /*--- The data set is evaluated at clipped density and energy. ---*/
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    batch_rho[i] = min(rho_max, max(rho_min, rho[i]));
+    batch_e[i] = min(e_max, max(e_min, e[i]));
+  }
+  lookup_table->LookUp_XY_Batch(nPoint, LUT_lookup_indices, batch_rho.data(), batch_e.data(), batch_outputs.data(),
+                                batch_outside.data());
+}
+
+void CDataDrivenFluid::GetTDStateBatch(unsigned long offset, unsigned long nPoint, const su2double* rho,
+                                       TDStateBlock& state) const {
+  /*--- Outputs in the order of LUT_lookup_indices (see MapInputs_to_Outputs). ---*/
+  su2double ds_de[BlockSize], ds_drho[BlockSize], d2s_de2[BlockSize], d2s_dedrho[BlockSize], d2s_drho2[BlockSize];
+
+  const auto nOutput = LUT_lookup_indices.size();
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    const su2double* outputs = &batch_outputs[(offset + i) * nOutput];
+    state.Entropy[i] = outputs[0];
+    state.Extrapolation[i] = batch_outside[offset + i];
+    ds_de[i] = outputs[1];
+    ds_drho[i] = outputs[2];
+    d2s_de2[i] = outputs[3];
+    d2s_dedrho[i] = outputs[4];
+    d2s_drho2[i] = outputs[5];
+  }
+
+  ComputeStateBlock(nPoint, rho, ds_de, ds_drho, d2s_de2, d2s_dedrho, d2s_drho2, state);
+}
+
 void CDataDrivenFluid::SetTDState_PT(su2double P, su2double T) {
 
   /*--- Approximate density and static energy with ideal gas law. ---*/
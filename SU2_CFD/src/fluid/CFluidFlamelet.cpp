@@ -74,7 +74,9 @@ CFluidFlamelet::CFluidFlamelet(CConfig* config, su2double value_pressure_operati
         cout << "*****************************************" << endl;
       }
       look_up_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], table_scalar_names[I_PROGVAR],
-                                       table_scalar_names[I_ENTH]);
+                                       table_scalar_names[I_ENTH], config->GetLUT_Write_Binary());
+      if (config->GetLUT_Search_Grid()) look_up_table->BuildSearchGrid();
+      if (config->GetLUT_Structured()) look_up_table->DetectStructuredLevels();
       break;
     default:
       if (rank == MASTER_NODE) {
@@ -153,3 +153,44 @@ unique_ptr<CDiffusivityModel> CFluidModel::MakeMassDiffusivityModel(const CConfi
 void CFluidModel::SetMassDiffusivityModel(const CConfig* config) {
   MassDiffusivity = MakeMassDiffusivityModel(config, 0);
 }
+
+void CFluidModel::SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                       TDStateBlock& state) {
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    SetTDState_rhoe(rho[i], e[i]);
+    state.Pressure[i] = Pressure;
+    state.Temperature[i] = Temperature;
+    state.SoundSpeed2[i] = SoundSpeed2;
+    state.dPdrho_e[i] = dPdrho_e;
+    state.dPde_rho[i] = dPde_rho;
+    state.Entropy[i] = Entropy;
+    state.Extrapolation[i] = GetExtrapolation();
+  }
+}
+
+bool CFluidModel::ComputeTransportCached(su2double* cache, su2double tol) {
+  const bool hit = (fabs(Density - cache[CACHE_DENSITY]) <= tol * fabs(cache[CACHE_DENSITY])) &&
+                   (fabs(Temperature - cache[CACHE_TEMPERATURE]) <= tol * fabs(cache[CACHE_TEMPERATURE])) &&
+                   (fabs(Mu_Turb - cache[CACHE_MU_TURB]) <= tol * (fabs(cache[CACHE_MU_TURB]) + fabs(cache[CACHE_MU])));
+
+  if (hit) {
+    Mu = cache[CACHE_MU];
+    dmudrho_T = cache[CACHE_DMUDRHO_T];
+    dmudT_rho = cache[CACHE_DMUDT_RHO];
+    Kt = cache[CACHE_KT];
+    dktdrho_T = cache[CACHE_DKTDRHO_T];
+    dktdT_rho = cache[CACHE_DKTDT_RHO];
+    return true;
+  }
+
+  cache[CACHE_DENSITY] = Density;
+  cache[CACHE_TEMPERATURE] = Temperature;
+  cache[CACHE_MU_TURB] = Mu_Turb;
+  cache[CACHE_MU] = GetLaminarViscosity();
+  cache[CACHE_DMUDRHO_T] = dmudrho_T;
+  cache[CACHE_DMUDT_RHO] = dmudT_rho;
+  cache[CACHE_KT] = GetThermalConductivity();
+  cache[CACHE_DKTDRHO_T] = dktdrho_T;
+  cache[CACHE_DKTDT_RHO] = dktdT_rho;
+  return false;
+}
@@ -0,0 +1,276 @@
+/*!
+ * \file CFluidTableGenerator.cpp
+ * \brief Generation of lookup tables for the data-driven fluid model from other fluid models.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid/CFluidTableGenerator.hpp"
+
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/containers/CLookUpTable.hpp"
+#include "../../include/fluid/CCoolProp.hpp"
+#include "../../include/fluid/CIdealGas.hpp"
+#include "../../include/fluid/CPengRobinson.hpp"
+#include "../../include/fluid/CVanDerWaalsGas.hpp"
+
+const std::array<std::string, CFluidTableGenerator::nVar> CFluidTableGenerator::VarNames = {
+    {"Density", "Energy", "s", "dsde_rho", "dsdrho_e", "d2sde2", "d2sdedrho", "d2sdrho2"}};
+
+CFluidTableGenerator::CFluidTableGenerator(CFluidModel* fluid_model, const std::array<su2double, 4>& range,
+                                           const std::array<unsigned short, 2>& levels, su2double tol)
+    : fluid(fluid_model),
+      rho_min(SU2_TYPE::GetValue(range[0])),
+      rho_max(SU2_TYPE::GetValue(range[1])),
+      e_min(SU2_TYPE::GetValue(range[2])),
+      e_max(SU2_TYPE::GetValue(range[3])),
+      base_level(levels[0]),
+      max_level(levels[1]),
+      tolerance(SU2_TYPE::GetValue(tol)) {
+  if (!(rho_min > 0 && rho_max > rho_min && e_max > e_min))
+    SU2_MPI::Error("Invalid LUT_GENERATE_RANGE, the density must be positive.", CURRENT_FUNCTION);
+  if (base_level > max_level || max_level > 14)
+    SU2_MPI::Error("Invalid LUT_GENERATE_LEVELS, the base level cannot exceed the maximum level (at most 14).",
+                   CURRENT_FUNCTION);
+
+  /*--- Cells of the finest level have a size of 2, so that their centers have integer coordinates. ---*/
+  n_res = 2ul << max_level;
+}
+
+bool CFluidTableGenerator::FindPoint(unsigned long ix, unsigned long iy, unsigned long& id) const {
+  const auto it = point_ids.find(uint64_t(ix) * (n_res + 1) + iy);
+  if (it == point_ids.end()) return false;
+  id = it->second;
+  return true;
+}
+
+unsigned long CFluidTableGenerator::GetPoint(unsigned long ix, unsigned long iy) {
+  unsigned long id;
+  if (FindPoint(ix, iy, id)) return id;
+
+  id = point_data.size();
+  point_ids[uint64_t(ix) * (n_res + 1) + iy] = id;
+
+  const passivedouble rho = rho_min * pow(rho_max / rho_min, passivedouble(ix) / n_res);
+  const passivedouble e = e_min + (e_max - e_min) * passivedouble(iy) / n_res;
+
+  std::array<passivedouble, nVar> data{};
+  std::array<passivedouble, 3> check{};
+  bool valid = true;
+
+  try {
+    fluid->SetTDState_rhoe(rho, e);
+  } catch (const std::exception&) {
+    /*--- E.g. CoolProp outside of the validity range of the equation of state. ---*/
+    valid = false;
+  }
+
+  if (valid) {
+    const passivedouble P = SU2_TYPE::GetValue(fluid->GetPressure());
+    const passivedouble T = SU2_TYPE::GetValue(fluid->GetTemperature());
+    const passivedouble dPdrho = SU2_TYPE::GetValue(fluid->GetdPdrho_e());
+    const passivedouble dTdrho = SU2_TYPE::GetValue(fluid->GetdTdrho_e());
+    const passivedouble dTde = SU2_TYPE::GetValue(fluid->GetdTde_rho());
+
+    /*--- Entropy derivatives from the Gibbs relation T ds = de - P / rho^2 drho. ---*/
+    data[0] = rho;
+    data[1] = e;
+    data[2] = SU2_TYPE::GetValue(fluid->GetEntropy());
+    data[3] = 1 / T;
+    data[4] = -P / (rho * rho * T);
+    data[5] = -dTde / (T * T);
+    data[6] = -dTdrho / (T * T);
+    data[7] = -dPdrho / (rho * rho * T) + 2 * P / (rho * rho * rho * T) + P * dTdrho / (rho * rho * T * T);
+
+    check = {{P, T, sqrt(std::max(SU2_TYPE::GetValue(fluid->GetSoundSpeed2()), 0.0))}};
+
+    valid = T > 0;
+    for (const auto value : data) valid = valid && std::isfinite(value);
+    for (const auto value : check) valid = valid && std::isfinite(value);
+  }
+
+  point_data.push_back(data);
+  point_check.push_back(check);
+  point_valid.push_back(valid);
+  return id;
+}
+
+bool CFluidTableGenerator::NeedsRefinement(unsigned long ix, unsigned long iy, unsigned long size) {
+  const unsigned long corners[] = {GetPoint(ix, iy), GetPoint(ix + size, iy), GetPoint(ix + size, iy + size),
+                                   GetPoint(ix, iy + size)};
+  const auto center = GetPoint(ix + size / 2, iy + size / 2);
+
+  if (size <= 2) return false;
+
+  /*--- Refine towards regions where the fluid model fails, to delimit them. ---*/
+  bool valid = point_valid[center];
+  for (const auto corner : corners) valid = valid && point_valid[corner];
+  if (!valid) return true;
+
+  for (auto iCheck = 0u; iCheck < 3; ++iCheck) {
+    passivedouble average = 0;
+    for (const auto corner : corners) average += 0.25 * point_check[corner][iCheck];
+    const passivedouble value = point_check[center][iCheck];
+    if (fabs(value - average) > tolerance * std::max(fabs(value), 1e-12)) return true;
+  }
+  return false;
+}
+
+void CFluidTableGenerator::Generate() {
+  /*--- Refine the cells of the base grid, leaves are stored as {ix, iy, size}. ---*/
+
+  std::vector<std::array<unsigned long, 3>> cells, leaves;
+  const unsigned long base_size = n_res >> base_level;
+  for (unsigned long ix = 0; ix < n_res; ix += base_size)
+    for (unsigned long iy = 0; iy < n_res; iy += base_size) cells.push_back({{ix, iy, base_size}});
+
+  while (!cells.empty()) {
+    const auto cell = cells.back();
+    cells.pop_back();
+    if (NeedsRefinement(cell[0], cell[1], cell[2])) {
+      const auto half = cell[2] / 2;
+      for (auto jx = 0u; jx < 2; ++jx)
+        for (auto jy = 0u; jy < 2; ++jy) cells.push_back({{cell[0] + jx * half, cell[1] + jy * half, half}});
+    } else {
+      leaves.push_back(cell);
+    }
+  }
+
+  /*--- Points on the boundary of the region [x0, x1] x [y0, y1] in counter-clockwise order. All points are
+   *    corners or centers of cells, the centers are interior, so these are the corners of the adjacent leaves. ---*/
+
+  auto Perimeter = [&](unsigned long x0, unsigned long y0, unsigned long x1, unsigned long y1) {
+    std::vector<unsigned long> ids;
+    unsigned long id;
+    for (auto ix = x0; ix < x1; ix += 2) if (FindPoint(ix, y0, id)) ids.push_back(id);
+    for (auto iy = y0; iy < y1; iy += 2) if (FindPoint(x1, iy, id)) ids.push_back(id);
+    for (auto ix = x1; ix > x0; ix -= 2) if (FindPoint(ix, y1, id)) ids.push_back(id);
+    for (auto iy = y1; iy > y0; iy -= 2) if (FindPoint(x0, iy, id)) ids.push_back(id);
+    return ids;
+  };
+
+  triangles.clear();
+  for (const auto& leaf : leaves) {
+    const auto center = GetPoint(leaf[0] + leaf[2] / 2, leaf[1] + leaf[2] / 2);
+    const auto ids = Perimeter(leaf[0], leaf[1], leaf[0] + leaf[2], leaf[1] + leaf[2]);
+
+    for (auto k = 0ul; k < ids.size(); ++k) {
+      const auto id = ids[k];
+      if (!point_valid[id] || !point_valid[center]) {
+        SU2_MPI::Error("The fluid model cannot be evaluated at density " + std::to_string(point_data[id][0]) +
+                       " and static energy " + std::to_string(point_data[id][1]) +
+                       ", reduce LUT_GENERATE_RANGE.", CURRENT_FUNCTION);
+      }
+      triangles.push_back({{center, id, ids[(k + 1) % ids.size()]}});
+    }
+  }
+
+  hull = Perimeter(0, 0, n_res, n_res);
+}
+
+void CFluidTableGenerator::WriteTable(const std::string& file_name) const {
+  std::ofstream file(file_name);
+  if (!file.is_open()) SU2_MPI::Error("Unable to open " + file_name + " to write the lookup table.", CURRENT_FUNCTION);
+
+  file << "Dragon library\n\n<Header>\n\n[Version]\n1.0.1\n\n";
+  file << "[Number of points]\n" << point_data.size() << "\n\n";
+  file << "[Number of triangles]\n" << triangles.size() << "\n\n";
+  file << "[Number of hull points]\n" << hull.size() << "\n\n";
+  file << "[Number of variables]\n" << nVar << "\n\n";
+  file << "[Variable names]\n";
+  for (const auto& name : VarNames) file << name << "\n";
+  file << "\n</Header>\n\n<Data>\n";
+
+  file << std::scientific << std::setprecision(16);
+  for (const auto& data : point_data) {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) file << (iVar ? " " : "") << data[iVar];
+    file << "\n";
+  }
+
+  /*--- Indices of the ASCII format start at 1. ---*/
+  file << "</Data>\n\n<Connectivity>\n";
+  for (const auto& triangle : triangles)
+    file << triangle[0] + 1 << " " << triangle[1] + 1 << " " << triangle[2] + 1 << "\n";
+  file << "</Connectivity>\n\n<Hull>\n";
+  for (const auto id : hull) file << id + 1 << "\n";
+  file << "</Hull>\n";
+
+  if (!file.good()) SU2_MPI::Error("Writing the lookup table " + file_name + " failed.", CURRENT_FUNCTION);
+}
+
+void CFluidTableGenerator::GenerateFromConfig(const CConfig* config) {
+  if (config->GetKind_DataDriven_Method() != ENUM_DATADRIVEN_METHOD::LUT)
+    SU2_MPI::Error("LUT_GENERATE requires INTERPOLATION_METHOD= LUT.", CURRENT_FUNCTION);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    CFluidModel* source = nullptr;
+
+    switch (config->GetKind_LUT_Generate_FluidModel()) {
+      case IDEAL_GAS:
+        source = new CIdealGas(config->GetGamma(), config->GetGas_Constant());
+        break;
+      case VW_GAS:
+        source = new CVanDerWaalsGas(config->GetGamma(), config->GetGas_Constant(), config->GetPressure_Critical(),
+                                     config->GetTemperature_Critical());
+        break;
+      case PR_GAS:
+        source = new CPengRobinson(config->GetGamma(), config->GetGas_Constant(), config->GetPressure_Critical(),
+                                   config->GetTemperature_Critical(), config->GetAcentric_Factor());
+        break;
+      case COOLPROP:
+        source = new CCoolProp(config->GetFluid_Name());
+        break;
+      default:
+        SU2_MPI::Error("LUT_GENERATE_FLUID_MODEL must be IDEAL_GAS, VW_GAS, PR_GAS, or COOLPROP.", CURRENT_FUNCTION);
+        break;
+    }
+
+    const std::string file_name = config->GetDataDriven_FileNames()[0];
+    const auto dot = file_name.find_last_of('.');
+    const bool binary = (dot != std::string::npos) && file_name.substr(dot) == ".drb";
+    const std::string file_name_ascii = binary ? file_name.substr(0, dot) + ".drg" : file_name;
+
+    std::cout << "Generating the lookup table " << file_name << " ..." << std::endl;
+    const su2double startTime = SU2_MPI::Wtime();
+
+    CFluidTableGenerator generator(source, config->GetLUT_Generate_Range(), config->GetLUT_Generate_Levels(),
+                                   config->GetLUT_Generate_Tolerance());
+    generator.Generate();
+    generator.WriteTable(file_name_ascii);
+    delete source;
+
+    std::cout << "Table with " << generator.GetnPoints() << " points and " << generator.GetnTriangles()
+              << " triangles generated in " << SU2_MPI::Wtime() - startTime << " seconds." << std::endl;
+
+    /*--- The binary table is written from the ASCII one, which includes the preprocessing for the lookups. ---*/
+    if (binary) {
+      CLookUpTable table(file_name_ascii, VarNames[0], VarNames[1]);
+      table.WriteBinary(file_name);
+    }
+  }
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+}
@@ -51,6 +51,18 @@ void CIdealGas::SetTDState_rhoe(su2double rho, su2double e) {
   if (ComputeEntropy) Entropy = (1.0 / Gamma_Minus_One * log(Temperature) + log(1.0 / Density)) * Gas_Constant;
 }
 
+void CIdealGas::SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                     TDStateBlock& state) {
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    state.Pressure[i] = Gamma_Minus_One * rho[i] * e[i];
+    state.Temperature[i] = Gamma_Minus_One * e[i] / Gas_Constant;
+    state.SoundSpeed2[i] = Gamma * state.Pressure[i] / rho[i];
+    state.dPdrho_e[i] = Gamma_Minus_One * e[i];
+    state.dPde_rho[i] = Gamma_Minus_One * rho[i];
+  }
+}
+
 void CIdealGas::SetTDState_PT(su2double P, su2double T) {
   su2double e = T * Gas_Constant / Gamma_Minus_One;
   su2double rho = P / (T * Gas_Constant);
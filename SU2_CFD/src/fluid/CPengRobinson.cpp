@@ -143,6 +143,49 @@ void CPengRobinson::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CPengRobinson::SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                         TDStateBlock& state) {
+#ifdef CODI_REVERSE_TYPE
+  CFluidModel::SetTDStateBlock_rhoe(nPoint, rho, e, state);
+#else
+  const su2double sqrt2 = sqrt(2.0);
+  const su2double Cv0 = Gas_Constant / Gamma_Minus_One;
+
+  /*--- Same expressions as SetTDState_rhoe, without the entropy. ---*/
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    const su2double rho2 = rho[i] * rho[i];
+    const su2double fv =
+        (log(1.0 + (rho[i] * b * sqrt2 / (1 + rho[i] * b))) - log(1.0 - (rho[i] * b * sqrt2 / (1 + rho[i] * b)))) / 2.0;
+
+    su2double A = Cv0;
+    su2double B = a * k * (k + 1) * fv / (b * sqrt2 * sqrt(TstarCrit));
+    const su2double C = a * (k + 1) * (k + 1) * fv / (b * sqrt2) + e[i];
+
+    su2double T = (-B + sqrt(B * B + 4 * A * C)) / (2 * A);
+    T *= T;
+
+    const su2double a2T = alpha2(T);
+
+    A = (1 / rho2 + 2 * b / rho[i] - b * b);
+    B = 1 / rho[i] - b;
+
+    const su2double P = T * Gas_Constant / B - a * a2T / A;
+    const su2double DpDd_T = (T * Gas_Constant / (B * B) - 2 * a * a2T * (1 / rho[i] + b) / (A * A)) / (rho2);
+    const su2double DpDT_d = Gas_Constant / B + a * k / A * sqrt(a2T / (T * TstarCrit));
+    const su2double Cv = Cv0 + (a * k * (k + 1) * fv) / (2 * b * sqrt(2 * T * TstarCrit));
+    const su2double DeDd_T = -a * (1 + k) * sqrt(a2T) / A / (rho2);
+
+    state.Pressure[i] = P;
+    state.Temperature[i] = T;
+    state.dPde_rho[i] = DpDT_d / Cv;
+    state.dPdrho_e[i] = DpDd_T - state.dPde_rho[i] * DeDd_T;
+    state.SoundSpeed2[i] = state.dPdrho_e[i] + P / (rho2)*state.dPde_rho[i];
+  }
+#endif
+}
+
 void CPengRobinson::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-6;
   su2double A, B, Z, DZ = 1.0, F, F1, atanh;
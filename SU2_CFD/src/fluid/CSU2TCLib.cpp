@@ -1158,6 +1158,13 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Tabulate the equilibrium constants of each reaction once, instead of for every evaluation. ---*/
+  RxnConstantTables.resize(nReactions);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    RxnConstantTables[iReaction] = RxnConstantTable;
+  }
 }
 
 CSU2TCLib::~CSU2TCLib()= default;
@@ -1215,8 +1222,9 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
       /*--- Electronic energy ---*/
       if (nElStates[iSpecies] != 0) {
         num = 0.0; num2 = 0.0;
-        denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
+        exptv = exp(-CharElTemp[iSpecies][0]/val_T);
+        denom = ElDegeneracy[iSpecies][0] * exptv;
+        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exptv;
         for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
           thoTve = CharElTemp[iSpecies][iEl]/val_T;
           exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
@@ -1272,8 +1280,9 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
     num = 0.0;
     denom = ElDegeneracy(iSpecies,0) * exp(-CharElTemp(iSpecies,0)/Tve);
     for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
-      denom += ElDegeneracy(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
+      const su2double gexp = ElDegeneracy(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
+      num   += gexp * CharElTemp(iSpecies,iEl);
+      denom += gexp;
     }
     Ee = Ru/MolarMass[iSpecies] * (num/denom);
 
@@ -1322,8 +1331,9 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
       num = 0.0;
       denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
       for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+        const su2double gexp = ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+        num   += gexp * CharElTemp[iSpecies][iEl];
+        denom += gexp;
       }
       Eel = Ru/MolarMass[iSpecies] * (num/denom);
     }
@@ -1358,6 +1368,12 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
+  /*--- Mixture number density in 1/cm^3, for the equilibrium constants ---*/
+  su2double N = 0.0;
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+  N *= 1E-6;
+
   /*--- Loop over all reactions ---*/
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -1374,7 +1390,7 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
 
     /*--- Get the Keq & Arrhenius coefficients ---*/
-    ComputeKeqConstants(iReaction);
+    ComputeKeqConstants(iReaction, N);
 
     /*--- Calculate Keq ---*/
     const su2double Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
@@ -1555,21 +1571,12 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   } // ii
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction, su2double N) {
 
   unsigned short ii;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
-  /*--- Calculate mixture number density ---*/
-  su2double N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
-  }
-
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
+  /*--- Database constants of the reaction ---*/
+  const su2activematrix& RxnConstantTable = RxnConstantTables[val_Reaction];
 
   /*--- Determine table index based on mixture N ---*/
   unsigned short tbl_offset = 14;
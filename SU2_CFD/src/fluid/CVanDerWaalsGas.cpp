@@ -53,6 +53,20 @@ void CVanDerWaalsGas::SetTDState_rhoe(su2double rho, su2double e) {
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 }
 
+void CVanDerWaalsGas::SetTDStateBlock_rhoe(unsigned long nPoint, const su2double* rho, const su2double* e,
+                                           TDStateBlock& state) {
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    state.Pressure[i] = Gamma_Minus_One * rho[i] / (1.0 - rho[i] * b) * (e[i] + rho[i] * a) - a * rho[i] * rho[i];
+    state.Temperature[i] = (state.Pressure[i] + rho[i] * rho[i] * a) * ((1 - rho[i] * b) / (rho[i] * Gas_Constant));
+    state.dPde_rho[i] = rho[i] * Gamma_Minus_One / (1.0 - rho[i] * b);
+    state.dPdrho_e[i] = Gamma_Minus_One / (1.0 - rho[i] * b) *
+                            ((e[i] + 2 * rho[i] * a) + rho[i] * b * (e[i] + rho[i] * a) / (1.0 - rho[i] * b)) -
+                        2 * rho[i] * a;
+    state.SoundSpeed2[i] = state.dPdrho_e[i] + state.Pressure[i] / (rho[i] * rho[i]) * state.dPde_rho[i];
+  }
+}
+
 void CVanDerWaalsGas::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-5;
   unsigned short nmax = 20, count = 0;
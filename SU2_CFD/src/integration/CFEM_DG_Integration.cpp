@@ -59,13 +59,15 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
         while for ADER-DG this information is not used, because a more
         complicated algorithm must be used to facilitate time accurate
         local time stepping.  Note that we are currently hard-coding
-        the classical RK4 scheme. ---*/
-  bool useADER = false;
+        the classical RK4 scheme. The implicit scheme (Jacobian-free
+        Newton-Krylov) carries out its own nonlinear iterations. ---*/
+  bool useADER = false, useJFNK = false;
   switch (config[iZone]->GetKind_TimeIntScheme()) {
     case RUNGE_KUTTA_EXPLICIT: iLimit = config[iZone]->GetnRKStep(); break;
     case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
     case ADER_DG: iLimit = 1; useADER = true; break;
-    case EULER_EXPLICIT: case EULER_IMPLICIT: iLimit = 1; break; }
+    case EULER_IMPLICIT: iLimit = 1; useJFNK = true; break;
+    case EULER_EXPLICIT: iLimit = 1; break; }
 
   /*--- In case an unsteady simulation is carried out, it is possible that a
         synchronization time step is specified. If so, set the boolean
@@ -106,6 +108,11 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
                                                                                               numerics_container[iZone][iInst][iMesh][SolContainer_Position],
                                                                                               config[iZone], iMesh, RunTime_EqSystem);
     }
+    else if( useJFNK ) {
+      solver_container[iZone][iInst][iMesh][SolContainer_Position]->JFNK_SpaceTimeIntegration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                                                              numerics_container[iZone][iInst][iMesh][SolContainer_Position],
+                                                                                              config[iZone], iMesh, RunTime_EqSystem);
+    }
     else {
 
       /*--- Time and space integration can be decoupled. ---*/
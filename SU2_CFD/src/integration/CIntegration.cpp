@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -48,6 +49,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Compute inviscid residuals ---*/
 
+  AD::BeginTapeSection(AD::TapeSection::CONVECTIVE_RESIDUAL);
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::CONVECTIVE_RESIDUAL);
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -56,12 +59,20 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
       break;
   }
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::CONVECTIVE_RESIDUAL);
+  AD::EndTapeSection();
 
   /*--- Compute viscous residuals ---*/
+  AD::BeginTapeSection(AD::TapeSection::VISCOUS_RESIDUAL);
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::VISCOUS_RESIDUAL);
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::VISCOUS_RESIDUAL);
+  AD::EndTapeSection();
 
   /*--- Compute source term residuals ---*/
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::SOURCE_RESIDUAL);
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::SOURCE_RESIDUAL);
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -79,6 +90,9 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
+  AD::BeginTapeSection(AD::TapeSection::BOUNDARY_CONDITIONS);
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::BOUNDARY_CONDITIONS);
+
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
 
   /*--- Compute Fourier Transformations for markers where NRBC_BOUNDARY is applied---*/
@@ -89,19 +103,49 @@ void CIntegration::Space_Integration(CGeometry *geometry,
     solver_container[MainSolver]->PreprocessBC_Giles(geometry, config, conv_bound_numerics, OUTFLOW);
   }
 
-  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    if (config->GetBoolTurbomachinery()){
-        /*--- Average quantities at the inflow and outflow boundaries ---*/
-      solver_container[MainSolver]->TurboAverageProcess(solver_container, geometry,config,INFLOW);
-      solver_container[MainSolver]->TurboAverageProcess(solver_container, geometry, config, OUTFLOW);
-    }
+  if (config->GetBoolTurbomachinery()){
+    /*--- Average quantities at the inflow and outflow boundaries (all threads share the work). ---*/
+    solver_container[MainSolver]->TurboAverageProcess(solver_container, geometry,config,INFLOW);
+    solver_container[MainSolver]->TurboAverageProcess(solver_container, geometry, config, OUTFLOW);
   }
-  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Some boundary conditions do not synchronize the threads at the end of their vertex loops (SU2_NOWAIT).
+   *    Before processing a marker, the threads only need to wait for the markers processed since the last
+   *    barrier if they touch the same points. A barrier is also needed before operations on the whole domain. ---*/
+
+  vector<unsigned short> markersSinceBarrier;
+  markersSinceBarrier.reserve(config->GetnMarker_All());
+
+  auto SynchronizeMarker = [&](unsigned short iMarker) {
+    for (auto jMarker : markersSinceBarrier) {
+      if (geometry->GetBoundaryMarkersOverlap(iMarker, jMarker)) {
+        SU2_OMP_BARRIER
+        markersSinceBarrier.clear();
+        break;
+      }
+    }
+    markersSinceBarrier.push_back(iMarker);
+  };
+
+  auto SynchronizeAll = [&]() {
+    if (markersSinceBarrier.empty()) return;
+    SU2_OMP_BARRIER
+    markersSinceBarrier.clear();
+  };
 
   /*--- Weak boundary conditions ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     KindBC = config->GetMarker_All_KindBC(iMarker);
+    switch (KindBC) {
+      case ACTDISK_INLET: case ENGINE_INFLOW: case INLET_FLOW: case ACTDISK_OUTLET: case ENGINE_EXHAUST:
+      case SUPERSONIC_INLET: case OUTLET_FLOW: case SUPERSONIC_OUTLET: case GILES_BOUNDARY:
+      case RIEMANN_BOUNDARY: case FAR_FIELD:
+        SynchronizeMarker(iMarker);
+        break;
+      default:
+        continue;
+    }
     switch (KindBC) {
       case ACTDISK_INLET:
         solver_container[MainSolver]->BC_ActDisk_Inlet(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
@@ -145,12 +189,22 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   }
 
   /*--- Modification of the system on the whole domain, like for a strong BC. ---*/
+  SynchronizeAll();
   solver_container[MainSolver]->Impose_Fixed_Values(geometry, config);
 
   /*--- Strong boundary conditions (Navier-Stokes and Dirichlet type BCs) ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    switch (config->GetMarker_All_KindBC(iMarker)) {
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    KindBC = config->GetMarker_All_KindBC(iMarker);
+    switch (KindBC) {
+      case ISOTHERMAL: case HEAT_FLUX: case HEAT_TRANSFER: case CUSTOM_BOUNDARY:
+      case CHT_WALL_INTERFACE: case SMOLUCHOWSKI_MAXWELL:
+        SynchronizeMarker(iMarker);
+        break;
+      default:
+        continue;
+    }
+    switch (KindBC) {
       case ISOTHERMAL:
         solver_container[MainSolver]->BC_Isothermal_Wall(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
         break;
@@ -179,6 +233,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         solver_container[MainSolver]->BC_Smoluchowski_Maxwell(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
         break;
     }
+  }
+  SynchronizeAll();
 
   /*--- Complete residuals for periodic boundary conditions. We loop over
    the periodic BCs in matching pairs so that, in the event that there are
@@ -191,13 +247,20 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker)==SYMMETRY_PLANE)
+    KindBC = config->GetMarker_All_KindBC(iMarker);
+    if (KindBC != SYMMETRY_PLANE && KindBC != EULER_WALL) continue;
+    SynchronizeMarker(iMarker);
+    if (KindBC==SYMMETRY_PLANE)
         solver_container[MainSolver]->BC_Sym_Plane(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
-    else if (config->GetMarker_All_KindBC(iMarker)==EULER_WALL)
+    else if (KindBC==EULER_WALL)
         solver_container[MainSolver]->BC_Euler_Wall(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
   }
+  SynchronizeAll();
   //AD::ResumePreaccumulation(pausePreacc);
 
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::BOUNDARY_CONDITIONS);
+  AD::EndTapeSection();
+
 }
 
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
@@ -222,6 +285,48 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+void CIntegration::AccelerateNonlinearIteration(const CGeometry *geometry, CSolver *solver, const CConfig *config) {
+
+  if (!config->GetNonlinearAcceleration()) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+  auto& solution = solver->GetNodes()->GetSolution();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nVar = solver->GetnVar();
+
+  bool restart = (config->GetInnerIter() == 0);
+
+  if (NonlinearAccelerator.size() == 0) {
+    NonlinearAccelerator.resize(config->GetNonlinearAcceleration_Depth() + 1, nPoint, nVar,
+                                geometry->GetnPointDomain());
+    restart = true;
+  }
+
+  if (restart) {
+    /*--- The result of this iteration is the first input of the accelerated iterations. ---*/
+    NonlinearAccelerator.reset();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        NonlinearAccelerator(iPoint, iVar) = SU2_TYPE::GetValue(solution(iPoint, iVar));
+  }
+  else {
+    /*--- The halos are included, their values are consistent with the owners
+     * since the corrections are computed with global dot products. ---*/
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        NonlinearAccelerator.FPresult(iPoint, iVar) = SU2_TYPE::GetValue(solution(iPoint, iVar));
+
+    const auto& newSolution = NonlinearAccelerator.compute();
+
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        solution(iPoint, iVar) = newSolution(iPoint, iVar);
+  }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CIntegration::SetDualTime_Geometry(CGeometry *geometry, CSolver *mesh_solver, const CConfig *config, unsigned short iMesh) {
 
   SU2_OMP_PARALLEL
@@ -50,6 +50,9 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
     case MAIN_SOLVER::FEM_NAVIER_STOKES:
     case MAIN_SOLVER::FEM_RANS:
     case MAIN_SOLVER::FEM_LES:
+    case MAIN_SOLVER::INC_EULER:
+    case MAIN_SOLVER::INC_NAVIER_STOKES:
+    case MAIN_SOLVER::INC_RANS:
     case MAIN_SOLVER::DISC_ADJ_EULER:
     case MAIN_SOLVER::DISC_ADJ_NAVIER_STOKES:
     case MAIN_SOLVER::DISC_ADJ_FEM_EULER:
@@ -81,32 +84,26 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   /*--- Full multigrid strategy and start up with fine grid only works with the direct problem ---*/
 
-  unsigned short FinestMesh = config[iZone]->GetFinestMesh();
-
-  /// TODO: This was always false.
-  const bool Convergence_FullMG = false;
-
-  if (!config[iZone]->GetRestart() && FullMG && direct && ( Convergence_FullMG && (FinestMesh != MESH_0 ))) {
-
-    SetProlongated_Solution(RunTime_EqSystem,
-                            solver_container[iZone][iInst][FinestMesh-1][Solver_Position],
-                            solver_container[iZone][iInst][FinestMesh][Solver_Position],
-                            geometry[iZone][iInst][FinestMesh-1],
-                            geometry[iZone][iInst][FinestMesh],
-                            config[iZone]);
-
-    SU2_OMP_SAFE_GLOBAL_ACCESS(config[iZone]->SubtractFinestMesh();)
+  if (!config[iZone]->GetRestart() && FullMG && direct && (RunTime_EqSystem == RUNTIME_FLOW_SYS)) {
+    FullMG_Startup(geometry[iZone][iInst], solver_container[iZone][iInst], config[iZone]);
   }
 
   /*--- Set the current finest grid (full multigrid strategy) ---*/
 
-  FinestMesh = config[iZone]->GetFinestMesh();
+  const unsigned short FinestMesh = config[iZone]->GetFinestMesh();
 
   /*--- Perform the Full Approximation Scheme multigrid ---*/
 
   MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
                   FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
 
+  /*--- Anderson acceleration of the flow iterations, the scalar solvers are not accelerated since
+   the least squares combination does not preserve the positivity of their variables. ---*/
+
+  if ((RunTime_EqSystem == RUNTIME_FLOW_SYS) && (FinestMesh == MESH_0)) {
+    AccelerateNonlinearIteration(geometry[iZone][iInst][MESH_0],
+                                 solver_container[iZone][iInst][MESH_0][Solver_Position], config[iZone]);
+  }
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
@@ -121,6 +118,12 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                             numerics_container[iZone][iInst], config[iZone],
                             FinestMesh, RunTime_EqSystem, &monitor);
 
+  /*--- Scalar solvers, update the auxiliary variables and restrict the solution for the next flow iteration. ---*/
+
+  if ((RunTime_EqSystem == RUNTIME_TURB_SYS) || (RunTime_EqSystem == RUNTIME_SPECIES_SYS)) {
+    ScalarPostprocessing(geometry[iZone][iInst], solver_container[iZone][iInst], config[iZone], RunTime_EqSystem);
+  }
+
   }
   END_SU2_OMP_PARALLEL
 
@@ -248,7 +251,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
 
     /*--- Restore the time integration settings. ---*/
 
@@ -274,7 +277,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SmoothProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
 
-    SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
+    SetProlongated_Correction(RunTime_EqSystem, solver_fine, geometry_fine, config, iMesh);
 
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
@@ -307,42 +310,32 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children;
-  const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
+  unsigned long Point_Coarse, iVertex;
+  unsigned short iMarker, iVar;
 
   const unsigned short nVar = sol_coarse->GetnVar();
 
-  auto *Solution = new su2double[nVar];
+  /*--- Precomputed transfer operator (children and volume weights) of the coarse grid. ---*/
+
+  const auto& children = geo_coarse->GetMGTransferPattern();
+  const auto& weights = geo_coarse->GetMGTransferWeights();
+  const auto& Solution_Fine = sol_fine->GetNodes()->GetSolution();
+  const auto& Solution_Coarse = sol_coarse->GetNodes()->GetSolution();
+  auto& Correction = sol_coarse->GetNodes()->GetSolution_Old();
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      Correction(Point_Coarse, iVar) = Solution_Coarse(Point_Coarse, iVar);
 
-    Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
-
-    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
-
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Area_Children = geo_fine->nodes->GetVolume(Point_Fine);
-      Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+    for (auto k = children.outerPtr()[Point_Coarse]; k < children.outerPtr()[Point_Coarse + 1]; ++k) {
+      const auto Point_Fine = children.innerIdx()[k];
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Correction(Point_Coarse, iVar) -= weights[k] * Solution_Fine(Point_Fine, iVar);
     }
-
-    Solution_Coarse = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] += Solution_Coarse[iVar];
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
   }
   END_SU2_OMP_FOR
 
-  delete [] Solution;
-
   /*--- Remove any contributions from no-slip walls. ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -359,6 +352,12 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
         su2double zero[3] = {0.0};
         sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
 
+        /*--- The turbulence variables are also imposed at the walls. ---*/
+
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS) {
+          for (iVar = 0; iVar < nVar; iVar++) sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse, iVar, 0.0);
+        }
+
       }
       END_SU2_OMP_FOR
     }
@@ -371,9 +370,8 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse));
+    for (const auto Point_Fine : children.getInnerIter(Point_Coarse)) {
+      sol_fine->LinSysRes.SetBlock(Point_Fine, Correction[Point_Coarse]);
     }
   }
   END_SU2_OMP_FOR
@@ -455,8 +453,8 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
 }
 
-void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine,
-                                                      CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine,
+                                                      CGeometry *geo_fine, CConfig *config, unsigned short iMesh) {
   unsigned long Point_Fine;
   unsigned short iVar;
   su2double *Solution_Fine, *Residual_Fine;
@@ -464,6 +462,11 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
   const unsigned short nVar = sol_fine->GetnVar();
   const su2double factor = config->GetDamp_Correc_Prolong();
 
+  /*--- The scalar variables (turbulence, mass fractions) are positive, their corrections can
+   * reduce them by at most this fraction (the coarse grids tend to overshoot near walls). ---*/
+  const bool positive = (RunTime_EqSystem == RUNTIME_TURB_SYS) || (RunTime_EqSystem == RUNTIME_SPECIES_SYS);
+  const su2double maxDecrease = 0.9;
+
   SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
   for (Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
     Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
@@ -472,7 +475,10 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
       /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
       if (Residual_Fine[iVar] != Residual_Fine[iVar])
         Residual_Fine[iVar] = 0.0;
-      Solution_Fine[iVar] += factor*Residual_Fine[iVar];
+      su2double correction = factor*Residual_Fine[iVar];
+      if (positive && Solution_Fine[iVar] > 0.0)
+        correction = max(correction, -maxDecrease*Solution_Fine[iVar]);
+      Solution_Fine[iVar] += correction;
     }
   }
   END_SU2_OMP_FOR
@@ -499,16 +505,80 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   END_SU2_OMP_FOR
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::FullMG_Startup(CGeometry **geometry, CSolver ***solver_container, CConfig *config) {
+
+  const unsigned short FinestMesh = config->GetFinestMesh();
+  if (FinestMesh == MESH_0) return;
+
+  /*--- The switch is based on the iteration count, the current finest grid is done once the iterations of
+   * all the coarser grids plus its own have been performed. ---*/
+
+  unsigned long switchIter = 0;
+  for (auto iMesh = FinestMesh; iMesh <= config->GetnMGLevels(); iMesh++) {
+    switchIter += config->GetFullMG_Iter(iMesh);
+  }
+  const unsigned long innerIter = config->GetInnerIter();
+  const bool customCFL = config->GetnFullMG_CFL() > 0;
+
+  if (customCFL && (innerIter == 0) && (FinestMesh == config->GetnMGLevels())) {
+    SetFullMG_CFL(FinestMesh, true, geometry, solver_container, config);
+  }
+  if (innerIter < switchIter) return;
+
+  /*--- The scalar solvers are not prolongated by their own integration, all solutions move to the finer
+   * grid together before the flow system is iterated on it. ---*/
+
+  for (const auto iSol : {FLOW_SOL, TURB_SOL, SPECIES_SOL}) {
+    if (!solver_container[FinestMesh][iSol] || !solver_container[FinestMesh-1][iSol]) continue;
+    SetProlongated_Solution(RUNTIME_FLOW_SYS, solver_container[FinestMesh-1][iSol], solver_container[FinestMesh][iSol],
+                            geometry[FinestMesh-1], geometry[FinestMesh], config);
+  }
+
+  if (customCFL) {
+    SetFullMG_CFL(FinestMesh, false, geometry, solver_container, config);
+    SetFullMG_CFL(FinestMesh-1, true, geometry, solver_container, config);
+  }
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(config->SubtractFinestMesh();)
+}
+
+void CMultiGridIntegration::SetFullMG_CFL(unsigned short iMesh, bool finest, CGeometry **geometry,
+                                          CSolver ***solver_container, const CConfig *config) {
+
+  /*--- MESH_0 is never a start-up grid, it keeps the (possibly adapted) CFL of the fine grid. ---*/
+  if (iMesh == MESH_0) return;
+
+  const su2double CFL = finest ? config->GetFullMG_CFL(iMesh) : config->GetCFL(iMesh);
+  const su2double CFLTurb = CFL * config->GetCFLRedCoeff_Turb();
+  const su2double CFLSpecies = CFL * config->GetCFLRedCoeff_Species();
+
+  CSolver* solverFlow = solver_container[iMesh][FLOW_SOL];
+  CSolver* solverTurb = solver_container[iMesh][TURB_SOL];
+  CSolver* solverSpecies = solver_container[iMesh][SPECIES_SOL];
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geometry[iMesh]->GetnPoint(), omp_get_num_threads()))
+  for (auto iPoint = 0ul; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+    solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
+    if (solverTurb) solverTurb->GetNodes()->SetLocalCFL(iPoint, CFLTurb);
+    if (solverSpecies) solverSpecies->GetNodes()->SetLocalCFL(iPoint, CFLSpecies);
+  }
+  END_SU2_OMP_FOR
+}
+
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                            unsigned short iMesh) {
 
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
-  const su2double *Residual_Fine;
+  unsigned long Point_Coarse, iVertex;
+  unsigned short iMarker, iVar;
 
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric();
 
+  /*--- The residuals are integrals over the control volumes, they are summed over the children. ---*/
+
+  const auto& children = geo_coarse->GetMGTransferPattern();
+
   auto *Residual = new su2double[nVar];
 
   SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
@@ -518,9 +588,8 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
-    for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
-      Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    for (const auto Point_Fine : children.getInnerIter(Point_Coarse)) {
+      const su2double* Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
@@ -536,6 +605,7 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
         sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS) sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
       }
       END_SU2_OMP_FOR
     }
@@ -613,6 +683,32 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
 }
 
+void CMultiGridIntegration::ScalarPostprocessing(CGeometry **geometry, CSolver ***solver_container, CConfig *config,
+                                                 unsigned short RunTime_EqSystem) {
+
+  const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
+  const unsigned short FinestMesh = config->GetFinestMesh();
+
+  /*--- The correction may have been the last update of the fine solution. ---*/
+
+  solver_container[FinestMesh][Solver_Position]->Postprocessing(geometry[FinestMesh], solver_container[FinestMesh],
+                                                                config, FinestMesh);
+
+  /*--- Like the single grid integration, the coarse turbulence variables are made consistent with
+   * the fine ones, and the eddy viscosity of the coarse grids is computed from them. ---*/
+
+  if (RunTime_EqSystem != RUNTIME_TURB_SYS) return;
+
+  for (auto iMesh = FinestMesh; iMesh < config->GetnMGLevels(); iMesh++) {
+    SetRestricted_Solution(RunTime_EqSystem, solver_container[iMesh][Solver_Position],
+                           solver_container[iMesh+1][Solver_Position], geometry[iMesh], geometry[iMesh+1], config);
+
+    solver_container[iMesh+1][Solver_Position]->Postprocessing(geometry[iMesh+1], solver_container[iMesh+1],
+                                                               config, iMesh+1);
+  }
+
+}
+
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                    CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse;
@@ -657,6 +753,14 @@ void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSol
                                                       CNumerics ****numerics_container, CConfig *config,
                                                       unsigned short FinestMesh, unsigned short RunTime_EqSystem,
                                                       su2double *monitor) {
+
+  /*--- Average quantities at the inflow and outflow boundaries (all threads share the work). ---*/
+
+  if ((RunTime_EqSystem == RUNTIME_FLOW_SYS) && config->GetBoolTurbomachinery()) {
+    solver_container[FinestMesh][FLOW_SOL]->TurboAverageProcess(solver_container[FinestMesh], geometry[FinestMesh],config,INFLOW);
+    solver_container[FinestMesh][FLOW_SOL]->TurboAverageProcess(solver_container[FinestMesh], geometry[FinestMesh], config, OUTFLOW);
+  }
+
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
   switch (RunTime_EqSystem) {
 
@@ -669,16 +773,15 @@ void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSol
       solver_container[FinestMesh][FLOW_SOL]->Friction_Forces(geometry[FinestMesh], config);
 
       /*--- Calculate the turbo performance ---*/
-      if (config->GetBoolTurbomachinery()){
-
-        /*--- Average quantities at the inflow and outflow boundaries ---*/
-
-        solver_container[FinestMesh][FLOW_SOL]->TurboAverageProcess(solver_container[FinestMesh], geometry[FinestMesh],config,INFLOW);
-        solver_container[FinestMesh][FLOW_SOL]->TurboAverageProcess(solver_container[FinestMesh], geometry[FinestMesh], config, OUTFLOW);
+      if (config->GetBoolTurbomachinery() && config->GetTurboPerf_Iter()){
 
-        /*--- Gather Inflow and Outflow quantities on the Master Node to compute performance ---*/
+        /*--- Start gathering the Inflow and Outflow quantities to compute performance, the reduction is
+         *    completed when the performance is computed, i.e. after the turbulence iteration. The recording
+         *    of the adjoint must contain the complete communication. ---*/
 
         solver_container[FinestMesh][FLOW_SOL]->GatherInOutAverageValues(config, geometry[FinestMesh]);
+        if (config->GetDiscrete_Adjoint())
+          solver_container[FinestMesh][FLOW_SOL]->CompleteInOutAverageValues(config);
 
       }
 
@@ -73,6 +73,8 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  frozenGradients = config->GetNewtonKrylovFrozenGradients();
+  assembledJacobian = config->GetNewtonKrylovAssembledJacobian();
 
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
@@ -88,6 +90,20 @@ void CNewtonIntegration::Setup() {
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, nullptr);
   }
 
+  if (assembledJacobian) {
+    /*--- The centered schemes depend on the neighbors of the neighbors (undivided Laplacian). ---*/
+    if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
+      SU2_MPI::Error("NEWTON_KRYLOV_ASSEMBLED_JACOBIAN requires an upwind scheme.", CURRENT_FUNCTION);
+    }
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+    /*--- Columns of the Jacobian that do not share rows can be computed together. ---*/
+    jacobianColoring = colorSparsePattern(geometry->GetSparsePattern(ConnectivityType::FiniteVolume));
+    if (jacobianColoring.empty()) {
+      SU2_MPI::Error("Coloring of the Newton-Krylov Jacobian failed (too many colors).", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- Check if the solver is able to provide a linear preconditioner. ---*/
   if (config->GetKind_TimeIntScheme() != EULER_IMPLICIT) return;
 
@@ -103,6 +119,14 @@ void CNewtonIntegration::Setup() {
   /*--- Only possible with a preconditioner. ---*/
   startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
 
+  /*--- Without startup period and inner preconditioner iterations, the approximate Jacobian is only used to
+   build the preconditioner, the ILU(0) factorization can then overwrite it instead of using a copy. ---*/
+  if (!startupPeriod && precondIters == 0 && kindPrec == ILU && solvers[FLOW_SOL]->Jacobian.SetILUInPlace()) {
+    if (SU2_MPI::GetRank() == MASTER_NODE) {
+      cout << "The Newton-Krylov preconditioner is factorized in place of the approximate Jacobian." << endl;
+    }
+  }
+
 }
 
 void CNewtonIntegration::PerturbSolution(const CSysVector<Scalar>& dir, Scalar mag) {
@@ -165,6 +189,68 @@ void CNewtonIntegration::ComputeFinDiffStep() {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+void CNewtonIntegration::AssembleJacobian() {
+
+  auto* nodes = solvers[FLOW_SOL]->GetNodes();
+  const auto nVar = LinSysRes.GetNVar();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto& pattern = geometry->GetSparsePattern(ConnectivityType::FiniteVolume);
+  const Scalar invStep = 1.0 / finDiffStep;
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(solvers[FLOW_SOL]->SetFrozenGradients(true);)
+
+  for (auto iColor = 0ul; iColor < jacobianColoring.getOuterSize(); ++iColor) {
+    const auto nColorPoints = jacobianColoring.getNumNonZeros(iColor);
+
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+
+      /*--- Perturb one variable of all the points of this color. ---*/
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (auto k = 0ul; k < nColorPoints; ++k)
+        nodes->AddSolution(jacobianColoring.getInnerIdx(iColor, k), iVar, finDiffStep);
+      END_SU2_OMP_FOR
+
+      ComputeResiduals(ResEvalType::EXPLICIT);
+
+      /*--- The points of a color do not have common neighbors, therefore the change of the residual
+       * of a point is due to the perturbation of the only neighbor of that color. The solution of
+       * the point is then restored (the solution was saved in MultiGrid_Iteration). ---*/
+
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (auto k = 0ul; k < nColorPoints; ++k) {
+        const auto jPoint = jacobianColoring.getInnerIdx(iColor, k);
+
+        for (const auto iPoint : pattern.getInnerIter(jPoint)) {
+          if (iPoint >= nPointDomain) continue;
+          auto* block = Jacobian.GetBlock(iPoint, jPoint);
+
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+            Scalar perturbRes = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes(iPoint,jVar));
+
+            /*--- The global residual had its sign flipped, so we add to get the difference. ---*/
+            block[jVar*nVar+iVar] = (perturbRes + LinSysRes(iPoint,jVar)) * invStep;
+          }
+        }
+        nodes->AddSolution(jPoint, iVar, 0.0);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(solvers[FLOW_SOL]->SetFrozenGradients(frozenGradients);)
+
+  /*--- Pseudotime term of the true Jacobian. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    su2double delta = (geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint)) /
+                      max(EPS, solvers[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint));
+    Jacobian.AddVal2Diag(iPoint, SU2_TYPE::GetValue(delta));
+  }
+  END_SU2_OMP_FOR
+}
+
 void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solvers_, CNumerics ******numerics_,
                                              CConfig **config_, unsigned short EqSystem, unsigned short iZone,
                                              unsigned short iInst) {
@@ -236,11 +322,35 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   else {
     ComputeFinDiffStep();
 
+    if (assembledJacobian) AssembleJacobian();
+
+    /*--- The gradients and limiters of the current residual are used by all products. ---*/
+    if (frozenGradients) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(solvers[FLOW_SOL]->SetFrozenGradients(true);)
+    }
+
+    const CMatrixFreeProductWrapper matrixFree(this);
+    const CSysMatrixVectorProduct<Scalar> assembled(Jacobian, geometry, config);
+    const CMatrixVectorProduct<Scalar>& product = assembledJacobian ?
+      static_cast<const CMatrixVectorProduct<Scalar>&>(assembled) : matrixFree;
+
     eps *= toleranceFactor;
-    iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, CMatrixFreeProductWrapper(this),
-                                      CPreconditionerWrapper(this), eps, iter, eps, false, config);
+    if (config->GetKind_Linear_Solver() == PIPELINED_FGMRES) {
+      iter = LinSolver.PFGMRES_LinSolver(LinSysRes, linSysSol, product,
+                                         CPreconditionerWrapper(this), eps, iter, eps, false, config);
+    } else if (config->GetKind_Linear_Solver() == RECYCLED_FGMRES) {
+      iter = LinSolver.RecycledFGMRES_LinSolver(LinSysRes, linSysSol, product,
+                                                CPreconditionerWrapper(this), eps, iter, eps, false, config);
+    } else {
+      iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, product,
+                                        CPreconditionerWrapper(this), eps, iter, eps, false, config);
+    }
     /*--- Scale back the residual to trick the CFL adaptation. ---*/
     eps /= toleranceFactor;
+
+    if (frozenGradients) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(solvers[FLOW_SOL]->SetFrozenGradients(false);)
+    }
   }
   SetSolutionResult(solvers[FLOW_SOL]->LinSysSol);
 
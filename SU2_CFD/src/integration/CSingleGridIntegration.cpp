@@ -72,6 +72,12 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   Time_Integration(geometry_fine, solvers_fine, config[iZone], NO_RK_ITER, RunTime_EqSystem);
 
+  /*--- Anderson acceleration (only the heat solver, the turbulence and species variables must remain positive). ---*/
+
+  if ((RunTime_EqSystem == RUNTIME_HEAT_SYS) && (FinestMesh == MESH_0)) {
+    AccelerateNonlinearIteration(geometry_fine, solvers_fine[Solver_Position], config[iZone]);
+  }
+
   /*--- Postprocessing ---*/
 
   solvers_fine[Solver_Position]->Postprocessing(geometry_fine, solvers_fine, config[iZone], FinestMesh);
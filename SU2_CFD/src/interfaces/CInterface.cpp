@@ -59,144 +59,235 @@ CInterface::~CInterface() {
   delete[] SpanLevelDonor;
 }
 
+void CInterface::BuildTransferPattern(const CInterpolator& interpolator, CGeometry *donor_geometry,
+                                      CGeometry *target_geometry, const CConfig *donor_config,
+                                      const CConfig *target_config) {
+
+  const auto nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2u;
+  transferPattern.clear();
+  transferPattern.resize(nMarkerInt);
+
+  for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
+
+    auto& pattern = transferPattern[iMarkerInt];
+
+    const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
+    const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
+
+    pattern.active = CInterpolator::CheckInterfaceBoundary(markDonor, markTarget);
+    if (!pattern.active) continue;
+
+    /*--- Global indices of the donors needed by the target vertices of this rank, per owner rank. ---*/
+
+    vector<vector<unsigned long> > needed(size);
+
+    if (markTarget >= 0) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+        const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+        for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); iDonor++)
+          needed[targetVertex.processor[iDonor]].push_back(targetVertex.globalPoint[iDonor]);
+      }
+    }
+
+    pattern.recvProcIdx.assign(size, -1);
+    pattern.recvStart.assign(1, 0);
+    vector<int> nRequest(size), nRequested(size);
+
+    for (int iProc = 0; iProc < size; ++iProc) {
+      auto& idx = needed[iProc];
+      sort(idx.begin(), idx.end());
+      idx.erase(unique(idx.begin(), idx.end()), idx.end());
+      nRequest[iProc] = idx.size();
+      if (idx.empty()) continue;
+
+      pattern.recvProcIdx[iProc] = pattern.recvProc.size();
+      pattern.recvProc.push_back(iProc);
+      pattern.recvGlobalIdx.insert(pattern.recvGlobalIdx.end(), idx.begin(), idx.end());
+      pattern.recvStart.push_back(pattern.recvGlobalIdx.size());
+    }
+
+    /*--- Send the requests to the donor ranks. ---*/
+
+    SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    vector<int> displRequest(size, 0), displRequested(size, 0);
+    for (int iProc = 1; iProc < size; ++iProc) {
+      displRequest[iProc] = displRequest[iProc-1] + nRequest[iProc-1];
+      displRequested[iProc] = displRequested[iProc-1] + nRequested[iProc-1];
+    }
+    vector<unsigned long> requested(displRequested.back() + nRequested.back());
+
+    SU2_MPI::Alltoallv(pattern.recvGlobalIdx.data(), nRequest.data(), displRequest.data(), MPI_UNSIGNED_LONG,
+                       requested.data(), nRequested.data(), displRequested.data(), MPI_UNSIGNED_LONG,
+                       SU2_MPI::GetComm());
+
+    /*--- Map the requested global indices to donor vertices of this rank. ---*/
+
+    vector<pair<unsigned long, unsigned long> > donorVertices;
+    if (markDonor >= 0) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+        if (donor_geometry->nodes->GetDomain(iPoint))
+          donorVertices.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iVertex);
+      }
+    }
+    sort(donorVertices.begin(), donorVertices.end());
+
+    pattern.sendStart.assign(1, 0);
+
+    for (int iProc = 0; iProc < size; ++iProc) {
+      if (nRequested[iProc] == 0) continue;
+      pattern.sendProc.push_back(iProc);
+
+      for (int i = 0; i < nRequested[iProc]; ++i) {
+        const auto globalIdx = requested[displRequested[iProc] + i];
+        const auto it = lower_bound(donorVertices.begin(), donorVertices.end(), make_pair(globalIdx, 0ul));
+        if (it == donorVertices.end() || it->first != globalIdx)
+          SU2_MPI::Error("A donor point of the interpolation is not owned by the expected rank.", CURRENT_FUNCTION);
+        pattern.sendVertex.push_back(it->second);
+      }
+      pattern.sendStart.push_back(pattern.sendVertex.size());
+    }
+
+    pattern.sendBuf.resize(pattern.sendVertex.size(), nVar);
+    pattern.recvBuf.resize(pattern.recvGlobalIdx.size(), nVar);
+    pattern.requests.resize(pattern.sendProc.size() + pattern.recvProc.size());
+  }
+
+  patternInterpolator = &interpolator;
+  patternUpdates = interpolator.GetnUpdates();
+}
+
 void CInterface::BroadcastData(const CInterpolator& interpolator,
                                CSolver *donor_solution, CSolver *target_solution,
                                CGeometry *donor_geometry, CGeometry *target_geometry,
                                const CConfig *donor_config, const CConfig *target_config) {
   static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
 
+  /*--- The pattern only changes with the interpolator, which is updated by all ranks. ---*/
+
+  if (patternInterpolator != &interpolator || patternUpdates != interpolator.GetnUpdates() ||
+      transferPattern.empty())
+    BuildTransferPattern(interpolator, donor_geometry, target_geometry, donor_config, target_config);
+
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
 
   /*--- Loop over interface markers. ---*/
 
-  for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
+  for (auto iMarkerInt = 0u; iMarkerInt < transferPattern.size(); iMarkerInt++) {
+
+    auto& pattern = transferPattern[iMarkerInt];
 
     /*--- Check if this interface connects the two zones, if not continue. ---*/
 
+    if (!pattern.active) continue;
+
     const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
     const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
 
-    if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
-
-    /*--- Count donor vertices on this rank. ---*/
-
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
-      }
-    }
-
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+    const auto nSend = pattern.sendProc.size();
+    const auto nRecv = pattern.recvProc.size();
+    auto* requests = pattern.requests.data();
+    int nRequests = 0;
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    /*--- Post the receives from other ranks. ---*/
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+    for (auto iRecv = 0ul; iRecv < nRecv; ++iRecv) {
+      const auto iProc = pattern.recvProc[iRecv];
+      if (iProc == rank) continue;
+      const auto start = pattern.recvStart[iRecv];
+      const int count = (pattern.recvStart[iRecv+1] - start) * nVar;
+      SU2_MPI::Irecv(pattern.recvBuf[start], count, MPI_DOUBLE, iProc, iMarkerInt, SU2_MPI::GetComm(),
+                     &requests[nRequests++]);
     }
 
-    /*--- Fill send buffers. ---*/
-
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+    /*--- Fill the send buffers and send (or copy, for this rank) the donor data. ---*/
 
     if (markDonor >= 0) {
 
       /*--- Apply contact resistance if specified. ---*/
-      
+
       SetContactResistance(donor_config->GetContactResistance(iMarkerInt));
 
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      for (auto iSend = 0ul; iSend < pattern.sendVertex.size(); iSend++) {
+        const auto iVertex = pattern.sendVertex[iSend];
         const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
-
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
-
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
+        GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+        for (auto iVar = 0u; iVar < nVar; iVar++) pattern.sendBuf(iSend, iVar) = Donor_Variable[iVar];
       }
     }
 
-    /*--- Gather data. ---*/
-
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
-
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
-
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
-
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+    for (auto iSend = 0ul; iSend < nSend; ++iSend) {
+      const auto iProc = pattern.sendProc[iSend];
+      const auto start = pattern.sendStart[iSend];
+      const auto count = pattern.sendStart[iSend+1] - start;
+
+      if (iProc == rank) {
+        const auto recvStart = pattern.recvStart[pattern.recvProcIdx[rank]];
+        for (auto i = 0ul; i < count; ++i)
+          for (auto iVar = 0u; iVar < nVar; iVar++)
+            pattern.recvBuf(recvStart + i, iVar) = pattern.sendBuf(start + i, iVar);
+        continue;
+      }
+      SU2_MPI::Isend(pattern.sendBuf[start], count * nVar, MPI_DOUBLE, iProc, iMarkerInt, SU2_MPI::GetComm(),
+                     &requests[nRequests++]);
+    }
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+    /*--- Only the data of the neighbors is needed, the sends complete while the targets are set. ---*/
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+    const int nRecvRequests = nRecv - (pattern.recvProcIdx[rank] >= 0);
+    SU2_MPI::Waitall(nRecvRequests, requests, MPI_STATUSES_IGNORE);
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+    if (markTarget >= 0) {
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
-    }
+      /*--- Loop over target vertices. ---*/
 
-    /*--- Loop over target vertices. ---*/
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
-    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
-      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
-      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+        auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+        const auto nDonorPoints = targetVertex.nDonor();
 
-      auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
-      const auto nDonorPoints = targetVertex.nDonor();
+        InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
 
-      InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
+        /*--- For the number of donor points. ---*/
+        for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
 
-      /*--- For the number of donor points. ---*/
-      for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
+          /*--- Get the global index of the donor and the interpolation coefficient. ---*/
 
-        /*--- Get the global index of the donor and the interpolation coefficient. ---*/
+          const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
+          const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
 
-        const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
-        const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
+          /*--- Find the donor in the data received from its rank. ---*/
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
+          const auto iRecv = pattern.recvProcIdx[targetVertex.processor[iDonorPoint]];
+          const auto begin = pattern.recvGlobalIdx.begin() + pattern.recvStart[iRecv];
+          const auto end = pattern.recvGlobalIdx.begin() + pattern.recvStart[iRecv+1];
+          const auto idx = lower_bound(begin, end, donorGlobalIndex) - pattern.recvGlobalIdx.begin();
+          assert(idx < static_cast<long>(pattern.recvStart[iRecv+1]));
 
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
+          /*--- Recover the Target_Variable from the buffer of variables. ---*/
+          RecoverTarget_Variable(pattern.recvBuf[idx], donorCoeff);
 
-        /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+          /*--- If the value is not directly aggregated in the previous function. ---*/
+          if (!valAggregated)
+            SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
+        }
 
-        /*--- If the value is not directly aggregated in the previous function. ---*/
-        if (!valAggregated)
+        /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
+        if (valAggregated)
           SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
       }
-
-      /*--- If we have aggregated the values in the function RecoverTarget_Variable, the set is outside the loop. ---*/
-      if (valAggregated)
-        SetTarget_Variable(target_solution, target_geometry, target_config, markTarget, iVertex, iPoint);
     }
+
+    SU2_MPI::Waitall(nRequests - nRecvRequests, requests + nRecvRequests, MPI_STATUSES_IGNORE);
   }
 }
 
@@ -32,6 +32,16 @@
 #include "../../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../include/solvers/CSolver.hpp"
 
+namespace {
+/*--- Whether the conductance and normal temperature of the donor are needed by the target. ---*/
+bool RobinCoupling(const CConfig* config) {
+  const auto kind = config->GetKind_CHT_Coupling();
+  return (kind == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
+         (kind == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX) ||
+         (kind == CHT_COUPLING::IMPLICIT_ROBIN_HEATFLUX);
+}
+}
+
 CConjugateHeatInterface::CConjugateHeatInterface(unsigned short val_nVar, unsigned short val_nConst) :
   CInterface(val_nVar, val_nConst) {
 }
@@ -85,8 +95,7 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
     const su2double thermal_conductivityND = Cp*(laminar_viscosity/Prandtl_Lam);
     heat_flux_density = thermal_conductivityND*dTdn;
 
-    if ((donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-        (donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+    if (RobinCoupling(donor_config)) {
 
       thermal_conductivity   = thermal_conductivityND*donor_config->GetViscosity_Ref();
       conductivity_over_dist = thermal_conductivity/dist;
@@ -99,8 +108,7 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
     const su2double thermal_conductivityND  = donor_solution->GetNodes()->GetThermalConductivity(iPoint);
     heat_flux_density       = thermal_conductivityND*dTdn;
 
-    if ((donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-        (donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+    if (RobinCoupling(donor_config)) {
 
       switch (donor_config->GetKind_ConductivityModel()) {
 
@@ -129,8 +137,7 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
     heat_flux_density = thermal_diffusivity*dTdn;
 
 
-    if ((donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-        (donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+    if (RobinCoupling(donor_config)) {
 
       /*--- Apply contact resistance to solid-to-solid heat transfer boundary ---*/
       const su2double rho_cp_solid = donor_config->GetSpecific_Heat_Cp()*donor_config->GetMaterialDensity(0);
@@ -146,8 +153,7 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
 
   /*--- We only need these for the Robin BC option ---*/
 
-  if ((donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-      (donor_config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+  if (RobinCoupling(donor_config)) {
 
     Donor_Variable[2] = conductivity_over_dist;
     Donor_Variable[3] = Tnormal*donor_config->GetTemperature_Ref();
@@ -164,8 +170,7 @@ void CConjugateHeatInterface::SetTarget_Variable(CSolver *target_solution, CGeom
   target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 1,
                                             target_config->GetRelaxation_Factor_CHT(), Target_Variable[1]);
 
-  if ((target_config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-      (target_config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+  if (RobinCoupling(target_config)) {
 
     target_solution->SetConjugateHeatVariable(Marker_Target, Vertex_Target, 2,
                                               target_config->GetRelaxation_Factor_CHT(), Target_Variable[2]);
@@ -45,6 +45,16 @@ void CFluidIteration::Preprocess(COutput* output, CIntegration**** integration,
         geometry[val_iZone][val_iInst], solver[val_iZone][val_iInst], config[val_iZone], TimeIter);
   }
 
+  /*--- Initial guess of the inner iterations of dual time stepping (from the second block subiteration
+   the solver also reuses the partially converged solution). ---*/
+
+  const bool dual_time = (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                         (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  if (dual_time && !config[val_iZone]->GetDiscrete_Adjoint() && (OuterIter == 0)) {
+    solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->ExtrapolateSolutionInTime(config[val_iZone]);
+  }
+
   /*--- Apply a Wind Gust ---*/
 
   if (config[val_iZone]->GetWind_Gust()) {
@@ -62,6 +72,7 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   const bool frozen_visc = (config[val_iZone]->GetContinuous_Adjoint() && config[val_iZone]->GetFrozen_Visc_Cont()) ||
                            (config[val_iZone]->GetDiscrete_Adjoint() && config[val_iZone]->GetFrozen_Visc_Disc());
   const bool disc_adj = (config[val_iZone]->GetDiscrete_Adjoint());
+  const bool mg_scalars = config[val_iZone]->GetMG_ScalarSolvers();
 
   /*--- Setting up iteration values depending on if this is a
    steady or an unsteady simulation */
@@ -79,10 +90,18 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   integration[val_iZone][val_iInst][FLOW_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config, RUNTIME_FLOW_SYS,
                                                                    val_iZone, val_iInst);
 
+  /*--- Undo the extrapolated initial guess of the time step if it increased the residuals. ---*/
+
+  if (unsteady && !disc_adj && (InnerIter == 0) && (config[val_iZone]->GetOuterIter() == 0)) {
+    solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->CheckTimeExtrapolation(config[val_iZone]);
+  }
+
   /*--- If the flow integration is not fully coupled, run the various single grid integrations. ---*/
 
   if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE && !frozen_visc) {
 
+    AD::BeginTapeSection(AD::TapeSection::TURBULENCE);
+
     /*--- Solve transition model ---*/
 
     if (config[val_iZone]->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
@@ -94,21 +113,46 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
     /*--- Solve the turbulence model ---*/
 
     config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    if (mg_scalars) {
+      integration[val_iZone][val_iInst][TURB_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    } else {
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                        RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    }
+
+    /*--- The coupled solve also updated the flow, update its primitive variables and then the eddy viscosity. ---*/
+
+    if (config[val_iZone]->GetCoupled_Turb_Solve()) {
+      solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->Preprocessing(geometry[val_iZone][val_iInst][MESH_0],
+                                                                    solver[val_iZone][val_iInst][MESH_0],
+                                                                    config[val_iZone], MESH_0, NO_RK_ITER,
+                                                                    RUNTIME_FLOW_SYS, true);
+      solver[val_iZone][val_iInst][MESH_0][TURB_SOL]->Postprocessing(geometry[val_iZone][val_iInst][MESH_0],
+                                                                     solver[val_iZone][val_iInst][MESH_0],
+                                                                     config[val_iZone], MESH_0);
+    }
+
+    AD::EndTapeSection();
   }
 
   if (config[val_iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE) {
     config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_SPECIES_SYS);
-    integration[val_iZone][val_iInst][SPECIES_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                         RUNTIME_SPECIES_SYS, val_iZone, val_iInst);
+    if (mg_scalars) {
+      integration[val_iZone][val_iInst][SPECIES_SOL]->MultiGrid_Iteration(geometry, solver, numerics, config,
+                                                                          RUNTIME_SPECIES_SYS, val_iZone, val_iInst);
+    } else {
+      integration[val_iZone][val_iInst][SPECIES_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                           RUNTIME_SPECIES_SYS, val_iZone, val_iInst);
+    }
 
     // This only applies if mixture properties are used. But this also doesn't hurt if done w/out mixture properties.
     // In case of turbulence, the Turb-Post computes the correct eddy viscosity based on mixture-density and
     // mixture lam-visc. In order to get the correct mixture properties, based on the just updated mass-fractions, the
     // Flow-Pre has to be called upfront. The updated eddy-visc are copied into the flow-solver Primitive in another
     // Flow-Pre call which is done at the start of the next iteration.
-    if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE) {
+    // With frozen turbulence the eddy viscosity stays passive.
+    if (config[val_iZone]->GetKind_Turb_Model() != TURB_MODEL::NONE && !frozen_visc) {
       solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->Preprocessing(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0], config[val_iZone], MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
       solver[val_iZone][val_iInst][MESH_0][TURB_SOL]->Postprocessing(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0], config[val_iZone], MESH_0);
     }
@@ -120,8 +164,10 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                                                                       RUNTIME_HEAT_SYS, val_iZone, val_iInst);
   }
 
-  /*--- Incorporate a weakly-coupled radiation model to the analysis ---*/
-  if (config[val_iZone]->AddRadiation()) {
+  /*--- Incorporate a weakly-coupled radiation model to the analysis, possibly every few iterations
+   (the radiative source terms of the flow are lagged in between). ---*/
+  if (config[val_iZone]->AddRadiation() &&
+      (config[val_iZone]->GetInnerIter() % config[val_iZone]->GetRadiation_Freq() == 0)) {
     config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_RADIATION_SYS);
     integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
                                                                      RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
@@ -226,7 +272,9 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
     /*--- Turbomachinery Specific Montior ---*/
   if (config[ZONE_0]->GetBoolTurbomachinery()){
     if (val_iZone == config[ZONE_0]->GetnZone()-1) {
-      ComputeTurboPerformance(solver, geometry, config, config[val_iZone]->GetnInner_Iter());
+      /*--- Between updates the history output repeats the last performance values. ---*/
+      if (config[val_iZone]->GetTurboPerf_Iter())
+        ComputeTurboPerformance(solver, geometry, config, config[val_iZone]->GetnInner_Iter());
 
       output->SetHistoryOutput(geometry, solver,
                            config, TurbomachineryStagePerformance, TurbomachineryPerformance, val_iZone, config[val_iZone]->GetTimeIter(), config[val_iZone]->GetOuterIter(),
@@ -329,6 +377,11 @@ void CFluidIteration::ComputeTurboPerformance(CSolver***** solver, CGeometry****
   vector<su2double> TurboPrimitiveIn, TurboPrimitiveOut;
   std::vector<std::vector<CTurbomachineryCombinedPrimitiveStates>> bladesPrimitives;
 
+  /*--- Complete the gathering of the span-wise averages of all blade rows. ---*/
+  for (iBlade = 0; iBlade < nBladesRow; iBlade++) {
+    solver[iBlade][INST_0][MESH_0][FLOW_SOL]->CompleteInOutAverageValues(config_container[iBlade]);
+  }
+
   if (rank == MASTER_NODE) {
       for (iBlade = 0; iBlade < nBladesRow; iBlade++){
       /* Blade Primitive initialized per blade */
@@ -398,6 +451,9 @@ void CFluidIteration::Solve(COutput* output, CIntegration**** integration, CGeom
     Iterate(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement, FFDBox, val_iZone,
             INST_0);
 
+    /*--- Measure the cost of each point over the first iterations (if requested). ---*/
+    geometry[val_iZone][INST_0][MESH_0]->UpdatePointCostProfile(config[val_iZone]);
+
     /*--- Monitor the pseudo-time ---*/
     StopCalc = Monitor(output, integration, geometry, solver, numerics, config, surface_movement, grid_movement, FFDBox,
                        val_iZone, INST_0);
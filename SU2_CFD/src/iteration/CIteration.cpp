@@ -185,6 +185,8 @@ void CIteration::SetMesh_Deformation(CGeometry** geometry, CSolver** solver, CNu
 
   /*--- Perform the elasticity mesh movement ---*/
 
+  AD::BeginTapeSection(AD::TapeSection::MESH_DEFORMATION);
+
   bool wasActive = false;
   if ((kind_recording != RECORDING::MESH_DEFORM) && !config->GetMultizone_Problem()) {
     /*--- In a primal run, AD::TapeActive returns a false ---*/
@@ -202,6 +204,8 @@ void CIteration::SetMesh_Deformation(CGeometry** geometry, CSolver** solver, CNu
 
   /*--- Continue recording. ---*/
   AD::EndPassive(wasActive);
+
+  AD::EndTapeSection();
 }
 
 void CIteration::Output(COutput* output, CGeometry**** geometry, CSolver***** solver, CConfig** config,
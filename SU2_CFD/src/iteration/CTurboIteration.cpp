@@ -39,7 +39,7 @@ void CTurboIteration::Preprocess(COutput* output, CIntegration**** integration,
   solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->TurboAverageProcess(
       solver[val_iZone][val_iInst][MESH_0], geometry[val_iZone][val_iInst][MESH_0], config[val_iZone], OUTFLOW);
 
-  if (config[val_iZone]->GetBoolTurbomachinery()) {
+  if (config[val_iZone]->GetBoolTurbomachinery() && !TurbomachineryPerformance) {
     InitTurboPerformance(geometry[val_iZone][INST_0][MESH_0], config,
                          solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->GetFluidModel());
   }
@@ -55,9 +55,10 @@ void CTurboIteration::Postprocess(COutput* output, CIntegration**** integration,
   solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->TurboAverageProcess(
       solver[val_iZone][val_iInst][MESH_0], geometry[val_iZone][val_iInst][MESH_0], config[val_iZone], OUTFLOW);
 
-  /*--- Gather Inflow and Outflow quantities on the Master Node to compute performance ---*/
+  /*--- Gather Inflow and Outflow quantities to compute performance ---*/
   solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->GatherInOutAverageValues(config[val_iZone],
                                                                            geometry[val_iZone][val_iInst][MESH_0]);
+  solver[val_iZone][val_iInst][MESH_0][FLOW_SOL]->CompleteInOutAverageValues(config[val_iZone]);
 }
 
 void CTurboIteration::InitTurboPerformance(CGeometry* geometry, CConfig** config, CFluidModel* fluid) {
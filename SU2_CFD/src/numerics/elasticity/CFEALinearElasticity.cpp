@@ -194,6 +194,93 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
 }
 
 
+void CFEALinearElasticity::Compute_Stiffness_Product(CElement *element, const CConfig *config) {
+
+  /*--- Same material properties and constitutive matrix as in Compute_Tangent_Matrix. ---*/
+  SetElement_Properties(element, config);
+  Compute_Lame_Parameters();
+  Compute_Constitutive_Matrix(element, config);
+
+  const unsigned short bDim = (nDim == 2) ? DIM_STRAIN_2D : DIM_STRAIN_3D;
+
+  element->ClearElement();
+  element->ComputeGrad_Linear();
+  const auto nNode = element->GetnNodes();
+  const auto nGauss = element->GetnGaussPoints();
+
+  /*--- Nodal displacements. ---*/
+  for (auto iNode = 0u; iNode < nNode; iNode++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      nodalDisplacement(iNode,iDim) = element->GetCurr_Coord(iNode,iDim) - element->GetRef_Coord(iNode,iDim);
+
+  for (auto iGauss = 0u; iGauss < nGauss; iGauss++) {
+
+    const su2double factor = element->GetWeight(iGauss) * element->GetJ_X(iGauss);
+
+    /*--- Strain at the Gauss point, eps = sum_b B_b u_b, with the same (Voigt) ordering as the B matrices. ---*/
+    su2double strain[DIM_STRAIN_3D] = {0.0};
+
+    for (auto iNode = 0u; iNode < nNode; iNode++) {
+      su2double g[MAXNDIM] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; iDim++) g[iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
+      const su2double* u = nodalDisplacement[iNode];
+
+      if (nDim == 2) {
+        strain[0] += g[0]*u[0];
+        strain[1] += g[1]*u[1];
+        strain[2] += g[1]*u[0] + g[0]*u[1];
+      }
+      else {
+        strain[0] += g[0]*u[0];
+        strain[1] += g[1]*u[1];
+        strain[2] += g[2]*u[2];
+        strain[3] += g[1]*u[0] + g[0]*u[1];
+        strain[4] += g[2]*u[0] + g[0]*u[2];
+        strain[5] += g[2]*u[1] + g[1]*u[2];
+      }
+    }
+
+    /*--- Integrated stress, sigma = w J D eps. ---*/
+    su2double stress[DIM_STRAIN_3D] = {0.0};
+    for (auto iVar = 0u; iVar < bDim; iVar++) {
+      for (auto jVar = 0u; jVar < bDim; jVar++)
+        stress[iVar] += D_Mat[iVar][jVar] * strain[jVar];
+      stress[iVar] *= factor;
+    }
+
+    /*--- Nodal forces, B_a^T sigma. ---*/
+    for (auto iNode = 0u; iNode < nNode; iNode++) {
+      su2double g[MAXNDIM] = {0.0}, force[MAXNDIM] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; iDim++) g[iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
+
+      if (nDim == 2) {
+        force[0] = g[0]*stress[0] + g[1]*stress[2];
+        force[1] = g[1]*stress[1] + g[0]*stress[2];
+      }
+      else {
+        force[0] = g[0]*stress[0] + g[1]*stress[3] + g[2]*stress[4];
+        force[1] = g[1]*stress[1] + g[0]*stress[3] + g[2]*stress[5];
+        force[2] = g[2]*stress[2] + g[0]*stress[4] + g[1]*stress[5];
+      }
+      element->Add_Kt_a(iNode, force);
+    }
+  }
+}
+
+
+void CFEALinearElasticity::Get_LameParameters(const CElement *element, const CConfig *config,
+                                              su2double& lambda, su2double& mu) {
+
+  /*--- Same material properties as in Compute_Tangent_Matrix. For plane stress the constitutive
+   *    matrix has the plane strain form with lambda* = 2 lambda mu / (lambda + 2 mu). ---*/
+  SetElement_Properties(element, config);
+  Compute_Lame_Parameters();
+
+  mu = Mu;
+  lambda = (nDim == 2 && plane_stress) ? 2.0*Lambda*Mu/(Lambda + 2.0*Mu) : Lambda;
+}
+
+
 void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_container, const CConfig *config) {
 
   /*--- Compute the D Matrix (for plane stress and 2-D)---*/
@@ -280,6 +280,10 @@ void CAdjFlowCompOutput::SetVolumeOutputFields(CConfig *config) {
   AddVolumeOutput("SENSITIVITY", "Surface_Sensitivity", "SENSITIVITY", "sensitivity in normal direction");
   /// END_GROUP
 
+  /// BEGIN_GROUP: ERROR_INDICATOR, DESCRIPTION: Mesh refinement indicators.
+  SetVolumeOutputFieldsAdjIndicator();
+  /// END_GROUP
+
 }
 
 void CAdjFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) {
@@ -319,6 +323,8 @@ void CAdjFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CS
     SetVolumeOutputValue("SENSITIVITY-Z", iPoint, Node_AdjFlow->GetSensitivity(iPoint, 2));
 
   LoadVolumeDataAdjScalar(config, solver, iPoint);
+
+  LoadVolumeDataAdjIndicator(geometry, solver, iPoint);
 }
 
 void CAdjFlowCompOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint, unsigned short iMarker, unsigned long iVertex) {
@@ -350,6 +350,10 @@ void CAdjFlowIncOutput::SetVolumeOutputFields(CConfig *config) {
   AddVolumeOutput("SENSITIVITY", "Surface_Sensitivity", "SENSITIVITY", "sensitivity in normal direction");
   /// END_GROUP
 
+  /// BEGIN_GROUP: ERROR_INDICATOR, DESCRIPTION: Mesh refinement indicators.
+  SetVolumeOutputFieldsAdjIndicator();
+  /// END_GROUP
+
 }
 
 void CAdjFlowIncOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) {
@@ -414,6 +418,8 @@ void CAdjFlowIncOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSo
   }
 
   LoadVolumeDataAdjScalar(config, solver, iPoint);
+
+  LoadVolumeDataAdjIndicator(geometry, solver, iPoint);
 }
 
 void CAdjFlowIncOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint, unsigned short iMarker, unsigned long iVertex) {
@@ -365,3 +365,26 @@ void CAdjFlowOutput::LoadVolumeDataAdjScalar(const CConfig* config, const CSolve
   }
 
 }
+
+void CAdjFlowOutput::SetVolumeOutputFieldsAdjIndicator() {
+  AddVolumeOutput("ADJOINT_INDICATOR", "Adjoint_Indicator", "ERROR_INDICATOR",
+                  "Adjoint-weighted mesh refinement indicator");
+}
+
+void CAdjFlowOutput::LoadVolumeDataAdjIndicator(const CGeometry* geometry, const CSolver* const* solver,
+                                                const unsigned long iPoint) {
+  const auto* Node_Flow = solver[FLOW_SOL]->GetNodes();
+  const auto* Node_AdjFlow = solver[ADJFLOW_SOL]->GetNodes();
+  const auto nVar = min(solver[FLOW_SOL]->GetnVar(), solver[ADJFLOW_SOL]->GetnVar());
+
+  su2double indicator = 0.0;
+  for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+    su2double product = 0.0;
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      product += fabs(Node_AdjFlow->GetSolution(jPoint, iVar) - Node_AdjFlow->GetSolution(iPoint, iVar)) *
+                 fabs(Node_Flow->GetSolution(jPoint, iVar) - Node_Flow->GetSolution(iPoint, iVar));
+    }
+    indicator = max(indicator, product);
+  }
+  SetVolumeOutputValue("ADJOINT_INDICATOR", iPoint, indicator);
+}
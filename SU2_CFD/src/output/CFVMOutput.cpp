@@ -73,7 +73,7 @@ void CFVMOutput::LoadCommonFVMOutputs(const CConfig* config, const CGeometry* ge
 
   SetVolumeOutputValue("RANK", iPoint, rank);
 
-  if (config->GetWrt_MultiGrid()) {
+  if (config->GetWrt_MultiGrid() && multiGridRequested) {
     for (auto iMesh = 1u; iMesh <= config->GetnMGLevels(); ++iMesh) {
       stringstream key;
       key << "MG_" << iMesh;
@@ -81,7 +81,13 @@ void CFVMOutput::LoadCommonFVMOutputs(const CConfig* config, const CGeometry* ge
     }
   }
 
-  if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+  if (config->GetKind_Linear_Solver_Prec() == LINELET && lineletRequested) {
     SetVolumeOutputValue("LINELET", iPoint, geometry->GetLineletInfo(config).lineletColor[iPoint]);
   }
 }
+
+void CFVMOutput::SetRequestedVolumeOutputs(const CConfig* config) {
+
+  multiGridRequested = VolumeOutputRequested("MULTIGRID");
+  lineletRequested = VolumeOutputRequested("LINELET");
+}
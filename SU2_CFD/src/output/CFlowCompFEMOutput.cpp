@@ -153,6 +153,12 @@ void CFlowCompFEMOutput::SetVolumeOutputFields(CConfig *config){
   if (config->GetKind_Solver() == MAIN_SOLVER::FEM_LES && (config->GetKind_SGS_Model() != TURB_SGS_MODEL::IMPLICIT_LES)) {
     AddVolumeOutput("EDDY_VISCOSITY", "Eddy_Viscosity", "PRIMITIVE", "Turbulent eddy viscosity");
   }
+
+  // Shock capturing
+  if (config->GetKind_FEM_DG_Shock() != FEM_SHOCK_CAPTURING_DG::NONE) {
+    AddVolumeOutput("SHOCK_SENSOR",   "Shock_Sensor",   "SHOCK_CAPTURING", "Value of the shock sensor of the element");
+    AddVolumeOutput("SHOCK_TROUBLED", "Shock_Troubled", "SHOCK_CAPTURING", "Elements flagged by the shock sensor");
+  }
 }
 
 void CFlowCompFEMOutput::LoadVolumeDataFEM(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iElem, unsigned long index, unsigned short dof){
@@ -224,6 +230,10 @@ void CFlowCompFEMOutput::LoadVolumeDataFEM(CConfig *config, CGeometry *geometry,
     // todo: Export Eddy instead of Laminar viscosity
     SetVolumeOutputValue("EDDY_VISCOSITY", index, DGFluidModel->GetLaminarViscosity());
   }
+  if (config->GetKind_FEM_DG_Shock() != FEM_SHOCK_CAPTURING_DG::NONE) {
+    SetVolumeOutputValue("SHOCK_SENSOR",   index, volElem[iElem].shockSensorValue);
+    SetVolumeOutputValue("SHOCK_TROUBLED", index, volElem[iElem].shockTroubled);
+  }
 }
 
 void CFlowCompFEMOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolver **solver) {
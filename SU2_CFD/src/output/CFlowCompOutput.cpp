@@ -169,6 +169,14 @@ void CFlowCompOutput::SetHistoryOutputFields(CConfig *config){
   AddHistoryOutput("MIN_CFL", "Min CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current minimum of the local CFL numbers");
   AddHistoryOutput("MAX_CFL", "Max CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current maximum of the local CFL numbers");
   AddHistoryOutput("AVG_CFL", "Avg CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current average of the local CFL numbers");
+  if (config->GetCFL_Adapt()) {
+    AddHistoryOutput("REDUCED_CFL", "Reduced CFL", ScreenOutputFormat::FIXED, "CFL_NUMBER", "Fraction of the control volumes whose local CFL number was reduced");
+    if (config->GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL)
+      AddHistoryOutput("CFL_BACKTRACKS", "CFL Backtracks", ScreenOutputFormat::INTEGER, "CFL_NUMBER", "Number of global CFL backtracks of the local residual CFL adaption");
+  }
+  if (config->GetActiveSet()) {
+    AddHistoryOutput("ACTIVE_POINTS", "Active Pts", ScreenOutputFormat::FIXED, "ACTIVE_SET", "Fraction of the points updated in the iteration (not frozen by the active set)");
+  }
 
   /// BEGIN_GROUP: FIXED_CL, DESCRIPTION: Relevant outputs for the Fixed CL mode
   if (config->GetFixed_CL_Mode()){
@@ -303,7 +311,7 @@ void CFlowCompOutput::SetVolumeOutputFields(CConfig *config){
   AddCommonFVMOutputs(config);
 
   if (config->GetTime_Domain()) {
-    SetTimeAveragedFields();
+    SetTimeAveragedFields(config);
   }
 }
 
@@ -428,6 +436,14 @@ void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
   SetHistoryOutputValue("MIN_CFL", flow_solver->GetMin_CFL_Local());
   SetHistoryOutputValue("MAX_CFL", flow_solver->GetMax_CFL_Local());
   SetHistoryOutputValue("AVG_CFL", flow_solver->GetAvg_CFL_Local());
+  if (config->GetCFL_Adapt()) {
+    SetHistoryOutputValue("REDUCED_CFL", flow_solver->GetReduced_CFL_Fraction());
+    if (config->GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL)
+      SetHistoryOutputValue("CFL_BACKTRACKS", flow_solver->GetnBacktrack_CFL());
+  }
+  if (config->GetActiveSet()) {
+    SetHistoryOutputValue("ACTIVE_POINTS", flow_solver->GetActivePointFraction());
+  }
 
   SetHistoryOutputValue("LINSOL_ITER", flow_solver->GetIterLinSolver());
   SetHistoryOutputValue("LINSOL_RESIDUAL", log10(flow_solver->GetResLinSolver()));
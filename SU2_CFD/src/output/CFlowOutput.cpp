@@ -29,10 +29,13 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 
 #include "../../include/output/CFlowOutput.hpp"
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/adt/CADTElemClass.hpp"
+#include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CSolver.hpp"
 #include "../../include/variables/CPrimitiveIndices.hpp"
@@ -357,28 +360,50 @@ void CFlowOutput::SetAnalyzeSurface(const CSolver* const*solver, const CGeometry
 
   }
 
-  auto Allreduce = [](const vector<su2double>& src, vector<su2double>& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  };
-
-  auto Allreduce_su2activematrix = [](const su2activematrix& src, su2activematrix& dst) {
-    SU2_MPI::Allreduce(src.data(), dst.data(), src.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-  };
-
-  Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total);
-  Allreduce(Surface_Mach_Local, Surface_Mach_Total);
-  Allreduce(Surface_Temperature_Local, Surface_Temperature_Total);
-  Allreduce(Surface_Density_Local, Surface_Density_Total);
-  Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total);
-  Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total);
-  Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total);
-  Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total);
-  Allreduce(Surface_Pressure_Local, Surface_Pressure_Total);
-  Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total);
-  Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total);
-  Allreduce(Surface_Area_Local, Surface_Area_Total);
-  Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total);
-  Allreduce_su2activematrix(Surface_Species_Local, Surface_Species_Total);
+  /*--- Sum the quantities of all the markers over the ranks with a single reduction. ---*/
+
+  const vector<su2double>* const Surface_Local[] = {
+    &Surface_MassFlow_Local,
+    &Surface_Mach_Local,
+    &Surface_Temperature_Local,
+    &Surface_Density_Local,
+    &Surface_Enthalpy_Local,
+    &Surface_NormalVelocity_Local,
+    &Surface_StreamVelocity2_Local,
+    &Surface_TransvVelocity2_Local,
+    &Surface_Pressure_Local,
+    &Surface_TotalTemperature_Local,
+    &Surface_TotalPressure_Local,
+    &Surface_Area_Local,
+    &Surface_MassFlow_Abs_Local};
+  vector<su2double>* const Surface_Total[] = {
+    &Surface_MassFlow_Total,
+    &Surface_Mach_Total,
+    &Surface_Temperature_Total,
+    &Surface_Density_Total,
+    &Surface_Enthalpy_Total,
+    &Surface_NormalVelocity_Total,
+    &Surface_StreamVelocity2_Total,
+    &Surface_TransvVelocity2_Total,
+    &Surface_Pressure_Total,
+    &Surface_TotalTemperature_Total,
+    &Surface_TotalPressure_Total,
+    &Surface_Area_Total,
+    &Surface_MassFlow_Abs_Total};
+
+  vector<su2double> sendBuf, recvBuf;
+  for (const auto* local : Surface_Local) sendBuf.insert(sendBuf.end(), local->begin(), local->end());
+  sendBuf.insert(sendBuf.end(), Surface_Species_Local.data(), Surface_Species_Local.data() + Surface_Species_Local.size());
+  recvBuf.resize(sendBuf.size());
+
+  SU2_MPI::Allreduce(sendBuf.data(), recvBuf.data(), sendBuf.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  auto itBuf = recvBuf.cbegin();
+  for (auto* total : Surface_Total) {
+    std::copy(itBuf, itBuf + total->size(), total->begin());
+    itBuf += total->size();
+  }
+  std::copy(itBuf, recvBuf.cend(), Surface_Species_Total.data());
 
   /*--- Compute the value of Surface_Area_Total, and Surface_Pressure_Total, and
    set the value in the config structure for future use ---*/
@@ -819,56 +844,92 @@ void CFlowOutput::SetCustomOutputs(const CSolver* const* solver, const CGeometry
   const bool axisymmetric = config->GetAxisymmetric();
   const auto* flowNodes = su2staticcast_p<const CFlowVariable*>(solver[FLOW_SOL]->GetNodes());
 
+  /*--- ADT of the local volume elements, built only if there are probes to locate. ---*/
+  std::unique_ptr<CADTElemClass> volumeADT;
+
+  auto BuildVolumeADT = [&]() {
+    vector<su2double> coor(geometry->GetnPoint() * nDim);
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      for (auto iDim = 0u; iDim < nDim; ++iDim) coor[iPoint * nDim + iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+
+    vector<unsigned long> conn, elemID;
+    vector<unsigned short> vtkType, markerID;
+    for (auto iElem = 0ul; iElem < geometry->GetnElem(); ++iElem) {
+      const auto* elem = geometry->elem[iElem];
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) conn.push_back(elem->GetNode(iNode));
+      vtkType.push_back(elem->GetVTK_Type());
+      markerID.push_back(0);
+      elemID.push_back(iElem);
+    }
+    volumeADT.reset(new CADTElemClass(nDim, coor, conn, vtkType, markerID, elemID, false));
+  };
+
   for (auto& output : customOutputs) {
-    if (output.skip) continue;
+    if (output.skip || !output.varIndices.empty()) continue;
 
-    if (output.varIndices.empty()) {
-      const bool allowSkip = adjoint && (output.type == OperationType::FUNCTION);
+    const bool allowSkip = adjoint && (output.type == OperationType::FUNCTION);
 
-      /*--- Setup indices for the symbols in the expression. ---*/
-      const auto primIdx = CPrimitiveIndices<unsigned long>(config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
-          config->GetNEMOProblem(), nDim, config->GetnSpecies());
-      ConvertVariableSymbolsToIndices(primIdx, allowSkip, output);
-      if (output.skip) continue;
+    /*--- Setup indices for the symbols in the expression. ---*/
+    const auto primIdx = CPrimitiveIndices<unsigned long>(config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE,
+        config->GetNEMOProblem(), nDim, config->GetnSpecies());
+    ConvertVariableSymbolsToIndices(primIdx, allowSkip, output);
+    if (output.skip) continue;
 
-      /*--- Convert marker names to their index (if any) in this rank. Or probe locations to nearest points. ---*/
+    /*--- Convert marker names to their index (if any) in this rank. Or probe locations to interpolation stencils. ---*/
 
-      if (output.type != OperationType::PROBE) {
-        output.markerIndices.clear();
-        for (const auto& marker : output.markers) {
-          for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
-            if (config->GetMarker_All_TagBound(iMarker) == marker) {
-              output.markerIndices.push_back(iMarker);
-              continue;
-            }
+    if (!output.IsProbe()) {
+      output.markerIndices.clear();
+      for (const auto& marker : output.markers) {
+        for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
+          if (config->GetMarker_All_TagBound(iMarker) == marker) {
+            output.markerIndices.push_back(iMarker);
+            continue;
           }
         }
-      } else {
-        if (output.markers.size() != nDim) {
-          SU2_MPI::Error("Wrong number of coordinates to specify probe " + output.name, CURRENT_FUNCTION);
-        }
-        su2double coord[3] = {};
-        for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iDim] = std::stod(output.markers[iDim]);
-        su2double minDist = std::numeric_limits<su2double>::max();
-        unsigned long minPoint = 0;
-        for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
-          const su2double dist = GeometryToolbox::SquaredDistance(nDim, coord, geometry->nodes->GetCoord(iPoint));
-          if (dist < minDist) {
-            minDist = dist;
-            minPoint = iPoint;
-          }
-        }
-        /*--- Decide which rank owns the probe. ---*/
-        su2double globMinDist;
-        SU2_MPI::Allreduce(&minDist, &globMinDist, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-        output.iPoint = fabs(minDist - globMinDist) < EPS ? minPoint : CustomOutput::PROBE_NOT_OWNED;
-        if (output.iPoint != CustomOutput::PROBE_NOT_OWNED) {
-          std::cout << "Probe " << output.name << " is using global point "
-                    << geometry->nodes->GetGlobalIndex(output.iPoint)
-                    << ", distance from target location is " << sqrt(minDist) << std::endl;
-        }
       }
+    } else {
+      if (!volumeADT) BuildVolumeADT();
+      LocateProbeSamples(geometry, *volumeADT, output);
     }
+  }
+
+  /*--- Nothing uses the values in this iteration. ---*/
+
+  customOutputsDeferred = !CustomOutputsNeeded(config);
+  if (customOutputsDeferred) return;
+
+  /*--- The partial surface integrals and probe samples of this rank are summed over all ranks with one reduction.
+   * The pending outputs are only reduced earlier if an output may reference them (i.e. it references others). ---*/
+
+  vector<su2double> localSums;
+  vector<const CustomOutput*> pending;
+
+  auto ReducePending = [&]() {
+    if (pending.empty()) return;
+    vector<su2double> sums(localSums.size());
+    SU2_MPI::Allreduce(localSums.data(), sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    auto it = sums.cbegin();
+    for (const auto* output : pending) {
+      if (output->IsProbe()) {
+        for (const auto& name : output->sampleNames) SetHistoryOutputValue(name, *(it++));
+        continue;
+      }
+      su2double integral = *(it++);
+      const su2double weight = *(it++);
+      if (output->type == OperationType::AREA_AVG || output->type == OperationType::MASSFLOW_AVG) {
+        integral /= weight;
+      }
+      SetHistoryOutputValue(output->name, integral);
+    }
+    localSums.clear();
+    pending.clear();
+  };
+
+  for (const auto& output : customOutputs) {
+    if (output.skip) continue;
+
+    if (!output.otherOutputs.empty()) ReducePending();
 
     if (output.type == OperationType::FUNCTION) {
       auto Functor = [&](unsigned long i) {
@@ -898,43 +959,98 @@ void CFlowOutput::SetCustomOutputs(const CSolver* const* solver, const CGeometry
       };
     };
 
-    if (output.type == OperationType::PROBE) {
-      su2double value = std::numeric_limits<su2double>::max();
-      if (output.iPoint != CustomOutput::PROBE_NOT_OWNED) {
-        value = output.Eval(MakeFunctor(output.iPoint));
+    pending.push_back(&output);
+
+    if (output.IsProbe()) {
+      /*--- Interpolate the expression evaluated at the points of each sample, only the owner of a sample
+       * contributes to its sum. ---*/
+      for (const auto& sample : output.samples) {
+        su2double value = 0.0;
+        for (auto i = 0ul; i < sample.points.size(); ++i) {
+          value += sample.weights[i] * output.Eval(MakeFunctor(sample.points[i]));
+        }
+        localSums.push_back(value);
       }
-      su2double tmp = value;
-      SU2_MPI::Allreduce(&tmp, &value, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-      SetHistoryOutputValue(output.name, value);
       continue;
     }
 
-    /*--- Surface integral of the expression. ---*/
+    /*--- Values of the symbols for a block of points, the symbol indices are decoded once per block. ---*/
+
+    constexpr auto blockSize = CCompiledExpression::BLOCK_SIZE;
+
+    auto GatherSymbols = [&](const unsigned long* points, unsigned long nPoints, su2double* inputs) {
+      for (auto iSymbol = 0ul; iSymbol < output.varIndices.size(); ++iSymbol) {
+        su2double* values = inputs + iSymbol * blockSize;
+        const auto i = output.varIndices[iSymbol];
+
+        if (i >= CustomOutput::NOT_A_VARIABLE) {
+          const su2double value = *output.otherOutputs[i - CustomOutput::NOT_A_VARIABLE];
+          for (auto k = 0ul; k < nPoints; ++k) values[k] = value;
+          continue;
+        }
+        const auto solIdx = i / CustomOutput::MAX_VARS_PER_SOLVER;
+        const auto varIdx = i % CustomOutput::MAX_VARS_PER_SOLVER;
+        if (solIdx == FLOW_SOL) {
+          for (auto k = 0ul; k < nPoints; ++k) values[k] = flowNodes->GetPrimitive(points[k], varIdx);
+        } else {
+          const auto* nodes = solver[solIdx]->GetNodes();
+          for (auto k = 0ul; k < nPoints; ++k) values[k] = nodes->GetSolution(points[k], varIdx);
+        }
+      }
+    };
+
+    /*--- Surface integral of the expression, the points are processed in blocks to evaluate the compiled
+     * expression, and the weighted sums are accumulated for each block. ---*/
 
     std::array<su2double, 2> integral = {0.0, 0.0};
 
     SU2_OMP_PARALLEL {
       std::array<su2double, 2> local_integral = {0.0, 0.0};
+      std::array<unsigned long, blockSize> points;
+      std::array<su2double, blockSize> weights, interpreted;
+      vector<su2double> inputs, work;
+      if (output.compiled.Ready()) {
+        inputs.resize(output.varIndices.size() * blockSize);
+        work.resize(output.compiled.GetWorkSize());
+      }
 
       for (const auto iMarker : output.markerIndices) {
+        const auto nVertex = geometry->nVertex[iMarker];
 
         SU2_OMP_FOR_(schedule(static) SU2_NOWAIT)
-        for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; ++iVertex) {
-          const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        for (auto iBlock = 0ul; iBlock < roundUpDiv(nVertex, blockSize); ++iBlock) {
+          unsigned long nPoints = 0;
 
-          if (!geometry->nodes->GetDomain(iPoint)) continue;
+          for (auto iVertex = iBlock * blockSize; iVertex < min(nVertex, (iBlock + 1) * blockSize); ++iVertex) {
+            const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-          const auto* normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+            if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-          su2double weight = 1.0;
-          if (output.type == OperationType::MASSFLOW_AVG || output.type == OperationType::MASSFLOW_INT) {
-            weight = flowNodes->GetDensity(iPoint) * flowNodes->GetProjVel(iPoint, normal);
+            const auto* normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+
+            su2double weight = 1.0;
+            if (output.type == OperationType::MASSFLOW_AVG || output.type == OperationType::MASSFLOW_INT) {
+              weight = flowNodes->GetDensity(iPoint) * flowNodes->GetProjVel(iPoint, normal);
+            } else {
+              weight = GeometryToolbox::Norm(nDim, normal);
+            }
+            points[nPoints] = iPoint;
+            weights[nPoints] = weight * GetAxiFactor(axisymmetric, *geometry->nodes, iPoint, iMarker);
+            ++nPoints;
+          }
+          if (nPoints == 0) continue;
+
+          const su2double* values = interpreted.data();
+          if (output.compiled.Ready()) {
+            GatherSymbols(points.data(), nPoints, inputs.data());
+            values = output.compiled.Eval(nPoints, inputs.data(), work.data());
           } else {
-            weight = GeometryToolbox::Norm(nDim, normal);
+            for (auto k = 0ul; k < nPoints; ++k) interpreted[k] = output.Eval(MakeFunctor(points[k]));
+          }
+          for (auto k = 0ul; k < nPoints; ++k) {
+            local_integral[1] += weights[k];
+            local_integral[0] += weights[k] * values[k];
           }
-          weight *= GetAxiFactor(axisymmetric, *geometry->nodes, iPoint, iMarker);
-          local_integral[1] += weight;
-          local_integral[0] += weight * output.Eval(MakeFunctor(iPoint));
         }
         END_SU2_OMP_FOR
       }
@@ -947,12 +1063,123 @@ void CFlowOutput::SetCustomOutputs(const CSolver* const* solver, const CGeometry
     }
     END_SU2_OMP_PARALLEL
 
-    const auto local = integral;
-    SU2_MPI::Allreduce(local.data(), integral.data(), 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-    if (output.type == OperationType::AREA_AVG || output.type == OperationType::MASSFLOW_AVG) {
-      integral[0] /= integral[1];
+    localSums.push_back(integral[0]);
+    localSums.push_back(integral[1]);
+  }
+  ReducePending();
+}
+
+void CFlowOutput::LocateProbeSamples(const CGeometry* geometry, CADTElemClass& adt, CustomOutput& output) const {
+
+  /*--- Coordinates of the samples. A probe is [x, y, (z)], a line [start, end, n], and a plane
+   [origin, edge A, edge B, nA, nB], the samples are uniformly distributed including the end points. ---*/
+
+  const auto& entries = output.markers;
+  const auto nSamples = output.sampleNames.size();
+
+  size_t nEntries = nDim;
+  if (output.type == OperationType::LINE) nEntries = 2 * nDim + 1;
+  if (output.type == OperationType::PLANE) nEntries = 3 * nDim + 2;
+  if (entries.size() != nEntries) {
+    SU2_MPI::Error("Wrong number of coordinates to specify probe " + output.name, CURRENT_FUNCTION);
+  }
+  auto Entry = [&](unsigned long i) { return su2double(std::stod(entries[i])); };
+  auto Fraction = [](unsigned long i, unsigned long n) { return n > 1 ? su2double(i) / (n - 1) : su2double(0); };
+
+  vector<su2double> coords(nSamples * nDim);
+
+  if (output.type == OperationType::PROBE) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coords[iDim] = Entry(iDim);
+  } else if (output.type == OperationType::LINE) {
+    for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+      const su2double t = Fraction(iSample, nSamples);
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        coords[iSample * nDim + iDim] = (1 - t) * Entry(iDim) + t * Entry(nDim + iDim);
+    }
+  } else {
+    const auto nA = std::stoul(entries[3 * nDim]);
+    for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+      const su2double s = Fraction(iSample % nA, nA), t = Fraction(iSample / nA, nSamples / nA);
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        coords[iSample * nDim + iDim] = Entry(iDim) + s * Entry(nDim + iDim) + t * Entry(2 * nDim + iDim);
+    }
+  }
+
+  /*--- Find the elements that contain the samples, the lowest rank containing a sample owns it. ---*/
+
+  constexpr int MaxNodes = 8;
+  vector<int> localRank(nSamples, size), ownerRank(nSamples);
+  vector<unsigned long> elemOfSample(nSamples);
+  vector<su2double> weights(nSamples * MaxNodes);
+
+  for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+    unsigned short markerID;
+    int rankID;
+    su2double parCoor[3];
+    if (adt.DetermineContainingElement(&coords[iSample * nDim], markerID, elemOfSample[iSample], rankID, parCoor,
+                                       &weights[iSample * MaxNodes])) {
+      localRank[iSample] = rank;
+    }
+  }
+  SU2_MPI::Allreduce(localRank.data(), ownerRank.data(), nSamples, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  /*--- Samples outside the domain use the nearest domain point, owned by the closest rank. ---*/
+
+  const auto nOutside = std::count(ownerRank.begin(), ownerRank.end(), size);
+  vector<unsigned long> nearestPoint(nSamples);
+  vector<su2double> dist(nSamples, std::numeric_limits<su2double>::max());
+  vector<int> closestRank(nSamples, size);
+
+  if (nOutside > 0) {
+    const auto nPointDomain = geometry->GetnPointDomain();
+    vector<su2double> pointCoor(nPointDomain * nDim), minDist(nSamples);
+    vector<unsigned long> pointID(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      pointID[iPoint] = iPoint;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) pointCoor[iPoint * nDim + iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+    }
+    CADTPointsOnlyClass pointADT(nDim, nPointDomain, pointCoor.data(), pointID.data(), false);
+
+    for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+      if (ownerRank[iSample] != size) continue;
+      int rankID;
+      pointADT.DetermineNearestNode(&coords[iSample * nDim], dist[iSample], nearestPoint[iSample], rankID);
+    }
+    SU2_MPI::Allreduce(dist.data(), minDist.data(), nSamples, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+    for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+      localRank[iSample] = (ownerRank[iSample] == size && dist[iSample] == minDist[iSample]) ? rank : size;
+    }
+    SU2_MPI::Allreduce(localRank.data(), closestRank.data(), nSamples, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+    if (rank == MASTER_NODE) {
+      std::cout << "WARNING: " << nOutside << " sample(s) of " << output.name
+                << " are outside the domain, the nearest point is used." << std::endl;
+    }
+  }
+
+  /*--- Interpolation stencils of the samples owned by this rank. ---*/
+
+  output.samples.clear();
+  output.samples.resize(nSamples);
+
+  for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+    auto& sample = output.samples[iSample];
+    if (ownerRank[iSample] == rank) {
+      const auto* elem = geometry->elem[elemOfSample[iSample]];
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) {
+        sample.points.push_back(elem->GetNode(iNode));
+        sample.weights.push_back(weights[iSample * MaxNodes + iNode]);
+      }
+    } else if (ownerRank[iSample] == size && closestRank[iSample] == rank) {
+      sample.points.push_back(nearestPoint[iSample]);
+      sample.weights.push_back(1.0);
+      if (output.type == OperationType::PROBE) {
+        std::cout << "Probe " << output.name << " is using global point "
+                  << geometry->nodes->GetGlobalIndex(nearestPoint[iSample])
+                  << ", distance from target location is " << dist[iSample] << std::endl;
+      }
     }
-    SetHistoryOutputValue(output.name, integral[0]);
   }
 }
 
@@ -1125,6 +1352,10 @@ void CFlowOutput::AddHistoryOutputFields_ScalarBGS_RES(const CConfig* config) {
 }
 
 void CFlowOutput::AddHistoryOutputFieldsScalarLinsol(const CConfig* config) {
+  if (config->GetLinear_Solver_Prec_Reuse() > 0) {
+    AddHistoryOutput("LINSOL_PREC_AGE", "LinSolPrecAge", ScreenOutputFormat::INTEGER, "LINSOL", "Number of linear solves since the preconditioner of the flow solver was rebuilt (0 means rebuilt).");
+  }
+
   if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) {
     AddHistoryOutput("LINSOL_ITER_TURB", "LinSolIterTurb", ScreenOutputFormat::INTEGER, "LINSOL", "Number of iterations of the linear solver for turbulence solver.");
     AddHistoryOutput("LINSOL_RESIDUAL_TURB", "LinSolResTurb", ScreenOutputFormat::FIXED, "LINSOL", "Residual of the linear solver for turbulence solver.");
@@ -1176,6 +1407,10 @@ void CFlowOutput::LoadHistoryDataScalar(const CConfig* config, const CSolver* co
     case TURB_FAMILY::NONE: break;
   }
 
+  if (config->GetLinear_Solver_Prec_Reuse() > 0) {
+    SetHistoryOutputValue("LINSOL_PREC_AGE", solver[FLOW_SOL]->System.GetPreconditionerAge());
+  }
+
   if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) {
     SetHistoryOutputValue("LINSOL_ITER_TURB", solver[TURB_SOL]->GetIterLinSolver());
     SetHistoryOutputValue("LINSOL_RESIDUAL_TURB", log10(solver[TURB_SOL]->GetResLinSolver()));
@@ -1481,6 +1716,10 @@ void CFlowOutput::SetVolumeOutputFieldsScalarMisc(const CConfig* config) {
     AddVolumeOutput("Q_CRITERION", "Q_Criterion", "VORTEX_IDENTIFICATION", "Value of the Q-Criterion");
   }
 
+  // Mesh refinement indicator
+  AddVolumeOutput("FEATURE_INDICATOR", "Feature_Indicator", "ERROR_INDICATOR",
+                  "Largest velocity jump to the neighbors, feature-based mesh refinement indicator");
+
   // Timestep info
   AddVolumeOutput("DELTA_TIME", "Delta_Time", "TIMESTEP", "Value of the local timestep for the flow variables");
   AddVolumeOutput("CFL", "CFL", "TIMESTEP", "Value of the local CFL for the flow variables");
@@ -1504,14 +1743,22 @@ void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* con
   SetVolumeOutputValue("CFL", iPoint, Node_Flow->GetLocalCFL(iPoint));
 
   if (config->GetViscous()) {
-    if (nDim == 3){
-      SetVolumeOutputValue("VORTICITY_X", iPoint, Node_Flow->GetVorticity(iPoint)[0]);
-      SetVolumeOutputValue("VORTICITY_Y", iPoint, Node_Flow->GetVorticity(iPoint)[1]);
-      SetVolumeOutputValue("VORTICITY_Z", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
-    } else {
-      SetVolumeOutputValue("VORTICITY", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+    if (vorticityRequested) {
+      if (nDim == 3){
+        SetVolumeOutputValue("VORTICITY_X", iPoint, Node_Flow->GetVorticity(iPoint)[0]);
+        SetVolumeOutputValue("VORTICITY_Y", iPoint, Node_Flow->GetVorticity(iPoint)[1]);
+        SetVolumeOutputValue("VORTICITY_Z", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      } else {
+        SetVolumeOutputValue("VORTICITY", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      }
     }
-    SetVolumeOutputValue("Q_CRITERION", iPoint, GetQCriterion(Node_Flow->GetVelocityGradient(iPoint)));
+    if (qCriterionRequested) {
+      SetVolumeOutputValue("Q_CRITERION", iPoint, GetQCriterion(Node_Flow->GetVelocityGradient(iPoint)));
+    }
+  }
+
+  if (featureIndicatorRequested) {
+    SetVolumeOutputValue("FEATURE_INDICATOR", iPoint, GetFeatureIndicator(geometry, Node_Flow, iPoint));
   }
 
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != LIMITER::NONE);
@@ -1630,6 +1877,32 @@ void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* con
   }
 }
 
+void CFlowOutput::SetRequestedVolumeOutputs(const CConfig* config) {
+
+  CFVMOutput::SetRequestedVolumeOutputs(config);
+
+  vorticityRequested = VolumeOutputRequested("VORTICITY") || VolumeOutputRequested("VORTICITY_X") ||
+                       VolumeOutputRequested("VORTICITY_Y") || VolumeOutputRequested("VORTICITY_Z");
+  qCriterionRequested = VolumeOutputRequested("Q_CRITERION");
+  featureIndicatorRequested = VolumeOutputRequested("FEATURE_INDICATOR");
+  timeAveragesRequested = VolumeOutputRequested("TIME_AVERAGE");
+  timeStatisticsRequested = VolumeOutputRequested("TIME_STATISTICS");
+}
+
+su2double CFlowOutput::GetFeatureIndicator(const CGeometry* geometry, const CVariable* flowNodes,
+                                           unsigned long iPoint) const {
+  su2double indicator = 0.0;
+
+  for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+    su2double jump = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      jump += pow(flowNodes->GetVelocity(jPoint, iDim) - flowNodes->GetVelocity(iPoint, iDim), 2);
+    }
+    indicator = max(indicator, jump);
+  }
+  return sqrt(indicator);
+}
+
 void CFlowOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint, unsigned short iMarker, unsigned long iVertex){
 
   if (!config->GetViscous_Wall(iMarker)) return;
@@ -2355,6 +2628,8 @@ void CFlowOutput::WriteAdditionalFiles(CConfig *config, CGeometry *geometry, CSo
     WriteForcesBreakdown(config, solver_container[FLOW_SOL]);
   }
 
+  if (timeStatistics) WriteTimeStatistics(config, geometry);
+
 }
 
 void CFlowOutput::WriteMetaData(const CConfig *config){
@@ -3946,7 +4221,7 @@ bool CFlowOutput::WriteVolumeOutput(CConfig *config, unsigned long Iter, bool fo
   return force_writing;
 }
 
-void CFlowOutput::SetTimeAveragedFields() {
+void CFlowOutput::SetTimeAveragedFields(const CConfig *config) {
   AddVolumeOutput("MEAN_DENSITY", "MeanDensity", "TIME_AVERAGE", "Mean density");
   AddVolumeOutput("MEAN_VELOCITY-X", "MeanVelocity_x", "TIME_AVERAGE", "Mean velocity x-component");
   AddVolumeOutput("MEAN_VELOCITY-Y", "MeanVelocity_y", "TIME_AVERAGE", "Mean velocity y-component");
@@ -3970,9 +4245,60 @@ void CFlowOutput::SetTimeAveragedFields() {
     AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
     AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
   }
+
+  if (!config->GetTime_Statistics()) return;
+
+  /*--- The running statistics are stored in CTimeStatistics, these fields are only loaded from it. ---*/
+
+  const char* velNames[] = {"U", "V", "W"};
+  AddVolumeOutput("STAT_DENSITY", "Stat_Density", "TIME_STATISTICS", "Mean density");
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    const string comp = string(1, 'X' + iDim);
+    AddVolumeOutput("STAT_VELOCITY-" + comp, "Stat_Velocity_" + string(1, 'x' + iDim), "TIME_STATISTICS",
+                    "Mean velocity " + string(1, 'x' + iDim) + "-component");
+  }
+  AddVolumeOutput("STAT_PRESSURE", "Stat_Pressure", "TIME_STATISTICS", "Mean pressure");
+  for (auto iDim = 0u; iDim < nDim; ++iDim) {
+    for (auto jDim = iDim; jDim < nDim; ++jDim) {
+      const string name = string(velNames[iDim]) + velNames[jDim];
+      AddVolumeOutput("STAT_" + name, "Stat_" + name, "TIME_STATISTICS", "Reynolds-stress component " + name);
+    }
+  }
+  AddVolumeOutput("STAT_PP", "Stat_PP", "TIME_STATISTICS", "Variance of the pressure");
+  for (auto iVar = 0u; iVar <= nDim; ++iVar) {
+    const string name = (iVar < nDim) ? velNames[iVar] : "P";
+    AddVolumeOutput("STAT_SKEWNESS_" + name, "Stat_Skewness_" + name, "TIME_STATISTICS", "Skewness of " + name);
+    AddVolumeOutput("STAT_FLATNESS_" + name, "Stat_Flatness_" + name, "TIME_STATISTICS", "Flatness of " + name);
+  }
 }
 
 void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *Node_Flow){
+
+  /*--- Running statistics, the variables are density, velocity, and pressure. ---*/
+
+  if (timeStatisticsRequested && timeStatistics) {
+    const char* velNames[] = {"U", "V", "W"};
+    const auto& stats = *timeStatistics;
+    SetVolumeOutputValue("STAT_DENSITY", iPoint, stats.GetMean(iPoint, 0));
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      SetVolumeOutputValue("STAT_VELOCITY-" + string(1, 'X' + iDim), iPoint, stats.GetMean(iPoint, iDim+1));
+    SetVolumeOutputValue("STAT_PRESSURE", iPoint, stats.GetMean(iPoint, nDim+1));
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      for (auto jDim = iDim; jDim < nDim; ++jDim) {
+        SetVolumeOutputValue(string("STAT_") + velNames[iDim] + velNames[jDim], iPoint,
+                             stats.GetCovariance(iPoint, iDim+1, jDim+1));
+      }
+    }
+    SetVolumeOutputValue("STAT_PP", iPoint, stats.GetCovariance(iPoint, nDim+1, nDim+1));
+    for (auto iVar = 0u; iVar <= nDim; ++iVar) {
+      const string name = (iVar < nDim) ? velNames[iVar] : "P";
+      SetVolumeOutputValue("STAT_SKEWNESS_" + name, iPoint, stats.GetSkewness(iPoint, iVar+1));
+      SetVolumeOutputValue("STAT_FLATNESS_" + name, iPoint, stats.GetFlatness(iPoint, iVar+1));
+    }
+  }
+
+  if (!timeAveragesRequested) return;
+
   SetAvgVolumeOutputValue("MEAN_DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
   SetAvgVolumeOutputValue("MEAN_VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint,0));
   SetAvgVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint,1));
@@ -4014,6 +4340,97 @@ void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *No
   }
 }
 
+void CFlowOutput::UpdateTimeStatistics(const CConfig *config, const CGeometry *geometry, CSolver **solver) {
+
+  if (!config->GetTime_Statistics() || curTimeIter < config->GetStartWindowIteration() ||
+      curTimeIter == lastStatisticsIter) return;
+  lastStatisticsIter = curTimeIter;
+
+  const auto probeNames = config->GetSpectral_Probes();
+
+  if (!timeStatistics) {
+    for (const auto& name : probeNames) {
+      if (historyOutput_Map.count(name) == 0)
+        SU2_MPI::Error("Invalid history output (" + name + ") in SPECTRAL_PROBES.", CURRENT_FUNCTION);
+    }
+    timeStatistics.reset(new CTimeStatistics(geometry->GetnPointDomain(), nDim+2,
+                                             config->GetTime_Statistics_Single_Prec()));
+    spectralProbes.assign(probeNames.size(), CStreamingSpectrum(config->GetSpectral_Window()));
+
+    /*--- Continue the statistics of the previous run. ---*/
+
+    vector<passivedouble> state;
+    const auto& fileName = config->GetTime_Statistics_FileName();
+
+    if (config->GetRestart() && timeStatistics->Read(fileName, geometry, state)) {
+      const bool probesMatch = state.size() >= 2 && state[0] == probeNames.size() &&
+                               state[1] == config->GetSpectral_Window();
+      if (probesMatch) {
+        const passivedouble* ptr = state.data() + 2;
+        for (auto& probe : spectralProbes) probe.Unpack(ptr);
+      }
+      if (rank == MASTER_NODE) {
+        cout << "Continuing the time statistics of " << fileName << " (" << timeStatistics->GetnSamples()
+             << " samples)." << endl;
+        if (!probesMatch) cout << "WARNING: The spectral probes changed, their spectra are restarted." << endl;
+      }
+    }
+  }
+
+  /*--- Sample the density, velocity, and pressure of all points. ---*/
+
+  const auto* flowNodes = solver[FLOW_SOL]->GetNodes();
+
+  SU2_OMP_PARALLEL_(for schedule(static))
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    passivedouble values[CTimeStatistics::MAX_VARS];
+    values[0] = SU2_TYPE::GetValue(flowNodes->GetDensity(iPoint));
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      values[iDim+1] = SU2_TYPE::GetValue(flowNodes->GetVelocity(iPoint, iDim));
+    values[nDim+1] = SU2_TYPE::GetValue(flowNodes->GetPressure(iPoint));
+    timeStatistics->Update(iPoint, values);
+  }
+  END_SU2_OMP_PARALLEL
+
+  timeStatistics->Advance();
+
+  for (auto iProbe = 0ul; iProbe < spectralProbes.size(); ++iProbe) {
+    spectralProbes[iProbe].AddSample(SU2_TYPE::GetValue(GetHistoryFieldValue(probeNames[iProbe])));
+  }
+}
+
+void CFlowOutput::WriteTimeStatistics(const CConfig *config, const CGeometry *geometry) const {
+
+  const auto& fileName = config->GetTime_Statistics_FileName();
+
+  vector<passivedouble> state = {passivedouble(spectralProbes.size()), passivedouble(config->GetSpectral_Window())};
+  for (const auto& probe : spectralProbes) probe.Pack(state);
+
+  timeStatistics->Write(fileName, geometry, state);
+
+  if (spectralProbes.empty() || rank != MASTER_NODE) return;
+
+  /*--- Power spectral density of each probe, one column per probe. ---*/
+
+  const auto probeNames = config->GetSpectral_Probes();
+  const passivedouble timeStep = SU2_TYPE::GetValue(config->GetDelta_UnstTime());
+  const auto window = config->GetSpectral_Window();
+
+  vector<vector<passivedouble> > psd;
+  for (const auto& probe : spectralProbes) psd.push_back(probe.GetPSD(timeStep));
+
+  ofstream file(fileName.substr(0, fileName.find_last_of('.')) + "_spectra.csv");
+  file << "\"Frequency\"";
+  for (const auto& name : probeNames) file << ",\"PSD[" << name << "]\"";
+  file << "\n" << std::scientific << std::setprecision(10);
+
+  for (auto k = 0ul; k <= window / 2; ++k) {
+    file << k / (window * timeStep);
+    for (const auto& values : psd) file << "," << values[k];
+    file << "\n";
+  }
+}
+
 void CFlowOutput::SetFixedCLScreenOutput(const CConfig *config){
   PrintingToolbox::CTablePrinter FixedCLSummary(&cout);
 
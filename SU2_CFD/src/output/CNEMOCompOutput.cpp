@@ -173,6 +173,11 @@ void CNEMOCompOutput::SetHistoryOutputFields(CConfig *config){
   AddHistoryOutput("MIN_CFL", "Min CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current minimum of the local CFL numbers");
   AddHistoryOutput("MAX_CFL", "Max CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current maximum of the local CFL numbers");
   AddHistoryOutput("AVG_CFL", "Avg CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current average of the local CFL numbers");
+  if (config->GetCFL_Adapt()) {
+    AddHistoryOutput("REDUCED_CFL", "Reduced CFL", ScreenOutputFormat::FIXED, "CFL_NUMBER", "Fraction of the control volumes whose local CFL number was reduced");
+    if (config->GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL)
+      AddHistoryOutput("CFL_BACKTRACKS", "CFL Backtracks", ScreenOutputFormat::INTEGER, "CFL_NUMBER", "Number of global CFL backtracks of the local residual CFL adaption");
+  }
 
   ///   /// BEGIN_GROUP: FIXED_CL, DESCRIPTION: Relevant outputs for the Fixed CL mode
   if (config->GetFixed_CL_Mode()){
@@ -299,7 +304,7 @@ void CNEMOCompOutput::SetVolumeOutputFields(CConfig *config){
   AddCommonFVMOutputs(config);
 
   if (config->GetTime_Domain()) {
-    SetTimeAveragedFields();
+    SetTimeAveragedFields(config);
   }
 }
 
@@ -432,6 +437,11 @@ void CNEMOCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
   SetHistoryOutputValue("MIN_CFL", NEMO_solver->GetMin_CFL_Local());
   SetHistoryOutputValue("MAX_CFL", NEMO_solver->GetMax_CFL_Local());
   SetHistoryOutputValue("AVG_CFL", NEMO_solver->GetAvg_CFL_Local());
+  if (config->GetCFL_Adapt()) {
+    SetHistoryOutputValue("REDUCED_CFL", NEMO_solver->GetReduced_CFL_Fraction());
+    if (config->GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL)
+      SetHistoryOutputValue("CFL_BACKTRACKS", NEMO_solver->GetnBacktrack_CFL());
+  }
 
   SetHistoryOutputValue("LINSOL_ITER", NEMO_solver->GetIterLinSolver());
   SetHistoryOutputValue("LINSOL_RESIDUAL", log10(NEMO_solver->GetResLinSolver()));
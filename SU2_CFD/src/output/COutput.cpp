@@ -29,6 +29,8 @@
 #include <csignal>
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
+#include "../../../Common/include/toolboxes/CPhaseTimer.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
@@ -49,6 +51,10 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../include/output/filewriter/CHDF5FileWriter.hpp"
+#include "../../include/output/filewriter/CCatalystWriter.hpp"
+#include "../../include/output/filewriter/CSurfaceStreamWriter.hpp"
 
 namespace {
 volatile sig_atomic_t STOP;
@@ -57,6 +63,12 @@ void signalHandler(int signum) {
    std::cout << "Interrupt signal (" << signum << ") received, saving files and exiting.\n";
    STOP = 1;
 }
+
+/*--- Prefix of the derivative fields of a direction of DIRECT_DIFF, e.g. "D_" or "D_MACH_" in vector mode. ---*/
+string DirectDiffPrefix(const CConfig* config, unsigned short iDir) {
+  if (config->GetnDirectDiff() < 2) return "D_";
+  return "D_" + config->GetDirectDiff_Name(iDir) + "_";
+}
 }
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
@@ -73,7 +85,10 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
-  fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  asyncOutput = config->GetWrt_Async_Output();
+#endif
+  fileWritingTable = new PrintingToolbox::CTablePrinter(asyncOutput ? &fileWritingLog : &std::cout);
   historyFileTable = new PrintingToolbox::CTablePrinter(&histFile, "");
 
   /*--- Set default filenames ---*/
@@ -190,12 +205,20 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
 COutput::~COutput() {
 
+  WaitForAsyncOutput(nullptr);
+#ifdef HAVE_MPI
+  if (asyncOutputComm != MPI_COMM_NULL) MPI_Comm_free(&asyncOutputComm);
+#endif
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
   delete historyFileTable;
   delete volumeDataSorter;
   delete surfaceDataSorter;
+  delete surfaceStreamWriter;
+
+  CCatalystWriter::Finalize();
 
 }
 
@@ -206,6 +229,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::OUTPUT);
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = max(TimeIter, config->GetStartWindowIteration()) - config->GetStartWindowIteration();
   curOuterIter = OuterIter;
@@ -219,6 +244,10 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
 
   ConvergenceMonitoring(config, curInnerIter);
 
+  /*--- The last iteration is written, the custom outputs may have been deferred before convergence was known. ---*/
+
+  if (convergence && customOutputsDeferred) LoadHistoryData(config, geometry, solver_container);
+
   PostprocessHistoryData(config);
 
   MonitorTimeConvergence(config, curTimeIter);
@@ -366,6 +395,10 @@ void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_co
 
   AllocateDataSorters(config, geometry);
 
+  /*--- The sorters may still be in use by an asynchronous write. ---*/
+
+  WaitForAsyncOutput(config);
+
   /*--- Loop over all points and store the requested volume output data into the data sorter objects ---*/
 
   LoadDataIntoSorter(config, geometry, solver_container);
@@ -378,6 +411,34 @@ void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_co
 
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName){
 
+  WaitForAsyncOutput(config);
+
+  WriteSortedData(config, geometry, format, fileName, GetOutputStamp());
+
+  /*--- Print the summary of this file and account for its bandwidth. ---*/
+
+  WaitForAsyncOutput(config);
+}
+
+void COutput::WaitForAsyncOutput(CConfig *config) {
+
+  if (asyncOutputThread.joinable()) asyncOutputThread.join();
+
+  if (config != nullptr && pendingRestartBandwidth > 0) {
+    config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + pendingRestartBandwidth);
+    pendingRestartBandwidth = 0;
+  }
+
+  if (rank == MASTER_NODE && fileWritingLog.tellp() > 0) {
+    cout << fileWritingLog.str() << flush;
+    fileWritingLog.str("");
+    headerNeeded = true;
+  }
+}
+
+void COutput::WriteSortedData(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName,
+                              const OutputStamp& stamp){
+
   /*--- File writer that will later be used to write the file to disk. Created below in the "switch" ---*/
   CFileWriter *fileWriter = nullptr;
 
@@ -407,10 +468,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CSU2FileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       surfaceDataSorter->SortConnectivity(config, geometry);
       surfaceDataSorter->SortOutputData();
@@ -425,10 +486,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CSU2FileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Restart_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       LogOutputFiles("SU2 ASCII restart");
       fileWriter = new CSU2FileWriter(volumeDataSorter);
@@ -440,13 +501,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CSU2BinaryFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Restart_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       LogOutputFiles("SU2 binary restart");
-      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter, config->GetRestart_Compression(),
+                                            config->GetRestart_Compression_Tol());
 
       break;
 
@@ -458,7 +520,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         fileName = volumeFilename;
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -469,22 +531,40 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2BinaryMeshFileWriter::fileExt;
+
+      /*--- By default the binary mesh is written next to the ASCII mesh output. ---*/
+
+      if (fileName.empty())
+        fileName = config->GetMesh_Out_FileName().substr(0, config->GetMesh_Out_FileName().find_last_of('.'));
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2BinaryMeshFileWriter(volumeDataSorter, config->GetnZone());
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, false);
 
       LogOutputFiles("Tecplot binary");
-      fileWriter = new CTecplotBinaryFileWriter(volumeDataSorter, curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotBinaryFileWriter(volumeDataSorter, stamp.timeIter, stamp.timeStep);
 
       break;
 
@@ -493,17 +573,17 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CTecplotFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
 
       LogOutputFiles("Tecplot ASCII");
-      fileWriter = new CTecplotFileWriter(volumeDataSorter, curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotFileWriter(volumeDataSorter, stamp.timeIter, stamp.timeStep);
 
       break;
 
@@ -512,10 +592,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewXMLFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -531,10 +611,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewBinaryFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -550,17 +630,17 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         extension = CParaviewVTMFileWriter::fileExt;
 
         if (fileName.empty())
-          fileName = config->GetUnsteady_FileName(volumeFilename, curTimeIter, "");
+          fileName = config->GetUnsteady_FileName(volumeFilename, stamp.timeIter, "");
 
         if (!config->GetWrt_Volume_Overwrite())
-          filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+          filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
         /*--- Sort volume connectivity ---*/
 
         volumeDataSorter->SortConnectivity(config, geometry, true);
 
         LogOutputFiles("Paraview Multiblock");
-        fileWriter = new CParaviewVTMFileWriter(GetHistoryFieldValue("CUR_TIME"), config->GetiZone(), config->GetnZone());
+        fileWriter = new CParaviewVTMFileWriter(stamp.curTime, config->GetiZone(), config->GetnZone());
 
         /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
         auto* vtmWriter = dynamic_cast<CParaviewVTMFileWriter*>(fileWriter);
@@ -579,10 +659,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -598,10 +678,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -618,10 +698,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewBinaryFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -638,10 +718,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CParaviewXMLFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -658,10 +738,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CTecplotFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -669,7 +749,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       surfaceDataSorter->SortOutputData();
 
       LogOutputFiles("Tecplot ASCII surface");
-      fileWriter = new CTecplotFileWriter(surfaceDataSorter, curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotFileWriter(surfaceDataSorter, stamp.timeIter, stamp.timeStep);
 
       break;
 
@@ -678,10 +758,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CTecplotBinaryFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -689,7 +769,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       surfaceDataSorter->SortOutputData();
 
       LogOutputFiles("Tecplot binary surface");
-      fileWriter = new CTecplotBinaryFileWriter(surfaceDataSorter, curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+      fileWriter = new CTecplotBinaryFileWriter(surfaceDataSorter, stamp.timeIter, stamp.timeStep);
 
       break;
 
@@ -698,10 +778,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CSTLFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
       surfaceDataSorter->SortConnectivity(config, geometry);
@@ -717,10 +797,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CCGNSFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Volume_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
       volumeDataSorter->SortConnectivity(config, geometry, true);
@@ -735,10 +815,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       extension = CCGNSFileWriter::fileExt;
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", stamp.timeIter);
 
       if (!config->GetWrt_Surface_Overwrite())
-        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
       surfaceDataSorter->SortConnectivity(config, geometry);
@@ -749,6 +829,63 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::HDF5:
+
+      extension = CHDF5FileWriter::fileExt;
+
+      /*--- Time series are appended to one file, therefore the time iteration is not part of the name. ---*/
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", -1);
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("HDF5");
+      fileWriter = new CHDF5FileWriter(volumeDataSorter, stamp.timeIter, stamp.curTime, config->GetTime_Domain(),
+                                       gridMovement, config->GetHDF5_Compression());
+
+      break;
+
+    case OUTPUT_TYPE::SURFACE_HDF5:
+
+      extension = CHDF5FileWriter::fileExt;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", -1);
+
+      if (!config->GetWrt_Surface_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, stamp.innerIter, stamp.outerIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      LogOutputFiles("HDF5 surface");
+      fileWriter = new CHDF5FileWriter(surfaceDataSorter, stamp.timeIter, stamp.curTime, config->GetTime_Domain(),
+                                       gridMovement, config->GetHDF5_Compression());
+
+      break;
+
+    case OUTPUT_TYPE::CATALYST:
+
+      /*--- Nothing is written, the name is used for the Catalyst channel. ---*/
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", -1);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      CCatalystWriter::Initialize(config);
+
+      if (rank == MASTER_NODE) (*fileWritingTable) << "Catalyst (in-situ)" << "channel " + fileName;
+      fileWriter = new CCatalystWriter(volumeDataSorter, config->GetTime_Domain() ? stamp.timeIter : stamp.outerIter,
+                                       stamp.curTime, catalystFieldNames);
+
+      break;
+
     default:
       break;
   }
@@ -760,6 +897,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
     fileWriter->WriteData(fileName);
 
     su2double BandWidth = fileWriter->GetBandwidth();
+    su2double UsedTime = fileWriter->GetUsedTime();
 
     /*--- Write data with iteration number to file if required ---*/
 
@@ -768,17 +906,19 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       /*--- Average bandwidth ---*/
       BandWidth = (BandWidth + fileWriter->GetBandwidth()) / 2;
+      UsedTime += fileWriter->GetUsedTime();
     }
 
     /*--- Compute and store the bandwidth ---*/
 
     if (format == OUTPUT_TYPE::RESTART_BINARY) {
-      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + BandWidth);
+      pendingRestartBandwidth += BandWidth;
     }
 
     if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
-      (*fileWritingTable) << " " << "(" + PrintingToolbox::to_string(BandWidth) + " MB/s)";
+      (*fileWritingTable) << " " << "(" + PrintingToolbox::to_string(BandWidth) + " MB/s, " +
+                                      PrintingToolbox::to_string(UsedTime) + " s)";
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
     }
 
@@ -803,13 +943,21 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
-  bool isFileWrite = false, dataIsLoaded = false;
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::OUTPUT);
+  const MemoryAllocation::CCategoryScope memCategory(MemoryAllocation::CATEGORY::OUTPUT);
+
+  bool dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
   AllocateDataSorters(config, geometry);
 
+  if (config->GetTime_Domain()) UpdateTimeStatistics(config, geometry, solver_container);
+
+  vector<OUTPUT_TYPE> filesToWrite;
+  bool writeStream = false;
+
   for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++) {
 
     /*--- Collect the volume data from the solvers.
@@ -818,39 +966,86 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
     const bool write_file = WriteVolumeOutput(config, iter, force_writing || cauchyTimeConverged, iFile);
 
     if ((write_file || config->GetTime_Domain()) && !dataIsLoaded) {
+      /*--- The unsorted data of the previous output may still be read by the asynchronous write. ---*/
+      WaitForAsyncOutput(config);
       LoadDataIntoSorter(config, geometry, solver_container);
       dataIsLoaded = true;
     }
-    if (!write_file) continue;
+    if (write_file && VolumeFiles[iFile] == OUTPUT_TYPE::SURFACE_STREAM) writeStream = true;
+    else if (write_file) filesToWrite.push_back(VolumeFiles[iFile]);
+  }
+
+  /*--- The surface stream is written directly from the unsorted data, before it is sorted for the other files. ---*/
+
+  if (writeStream) {
+    if (surfaceStreamWriter == nullptr) {
+      if (femOutput)
+        SU2_MPI::Error("SURFACE_STREAM output is not available for the FEM solvers.", CURRENT_FUNCTION);
+      surfaceStreamWriter = new CSurfaceStreamWriter(volumeDataSorter, config, geometry, streamFieldNames,
+                                                     config->GetFilename(surfaceFilename, "", -1));
+    }
+    const auto stamp = GetOutputStamp();
+    surfaceStreamWriter->WriteStep(config->GetTime_Domain() ? stamp.timeIter : stamp.outerIter, stamp.curTime);
+  }
 
-    /*--- Partition and sort the data --- */
+  if (filesToWrite.empty()) return writeStream;
+
+#ifdef HAVE_MPI
+  /*--- The writers communicate on a duplicate communicator, which is only safe with MPI_THREAD_MULTIPLE. ---*/
+  if (asyncOutput && asyncOutputComm == MPI_COMM_NULL) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      asyncOutput = false;
+      if (rank == MASTER_NODE)
+        cout << "WARNING: WRT_ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (start SU2_CFD with --thread_multiple).\n"
+                "         The result files will be written synchronously." << endl;
+    } else {
+      MPI_Comm_dup(SU2_MPI::GetComm(), &asyncOutputComm);
+    }
+  }
+#endif
+
+  /*--- Partition and sort the data, then loop through all requested output files and write
+   * the partitioned and sorted data stored in the data sorters. This only uses the sorters
+   * and the (static) geometry, therefore it may run concurrently with the next iterations.
+   * Since the data is loaded before the next output can start, there are at most two copies
+   * of the output data, the one being written and the one being loaded. ---*/
+
+  auto writeFiles = [this, config, geometry, filesToWrite](const OutputStamp& stamp) {
 
     volumeDataSorter->SortOutputData();
 
-    if (rank == MASTER_NODE && !isFileWrite) {
+    if (rank == MASTER_NODE) {
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
       fileWritingTable->PrintHeader();
       fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
     }
 
-    /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+    for (const auto format : filesToWrite) WriteSortedData(config, geometry, format, "", stamp);
 
-    WriteToFile(config, geometry, VolumeFiles[iFile]);
+    if (rank == MASTER_NODE) fileWritingTable->PrintFooter();
+  };
 
-    /*--- Write any additonal files defined in the child class ----*/
+  if (asyncOutput) {
+    asyncOutputThread = std::thread([this, writeFiles](const OutputStamp& stamp) {
+#ifdef HAVE_MPI
+      SU2_MPI::SetThreadComm(asyncOutputComm);
+#endif
+      writeFiles(stamp);
+    }, GetOutputStamp());
+  } else {
+    writeFiles(GetOutputStamp());
+    WaitForAsyncOutput(config);
+  }
 
-    WriteAdditionalFiles(config, geometry, solver_container);
+  /*--- Write any additonal files defined in the child class ----*/
 
-    isFileWrite = true;
-  }
+  WriteAdditionalFiles(config, geometry, solver_container);
 
-  if (rank == MASTER_NODE && isFileWrite) {
-    fileWritingTable->PrintFooter();
-    headerNeeded = true;
-  }
+  if (rank == MASTER_NODE && !asyncOutput) headerNeeded = true;
 
-  return isFileWrite;
+  return true;
 }
 
 void COutput::PrintConvergenceSummary(){
@@ -1549,6 +1744,22 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
           volumeFieldNames.push_back(Field.fieldName);
           nVolumeFields++;
 
+          /*--- Fields passed to Catalyst, all of them if none are specified. ---*/
+          bool catalystField = (config->GetnCatalyst_Fields() == 0);
+          for (unsigned short iCatField = 0; iCatField < config->GetnCatalyst_Fields(); iCatField++) {
+            const auto& catalystRequest = config->GetCatalyst_Field(iCatField);
+            catalystField |= (catalystRequest == Field.outputGroup) || (catalystRequest == fieldReference);
+          }
+          if (catalystField) catalystFieldNames.push_back(Field.fieldName);
+
+          /*--- Fields of the surface stream, all of them if none are specified. ---*/
+          bool streamField = (config->GetnSurface_Stream_Fields() == 0);
+          for (unsigned short iStreamField = 0; iStreamField < config->GetnSurface_Stream_Fields(); iStreamField++) {
+            const auto& streamRequest = config->GetSurface_Stream_Field(iStreamField);
+            streamField |= (streamRequest == Field.outputGroup) || (streamRequest == fieldReference);
+          }
+          if (streamField) streamFieldNames.push_back(Field.fieldName);
+
           FoundField[iReqField] = true;
         }
       }
@@ -1591,6 +1802,16 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
     }
     cout << endl;
   }
+
+  SetRequestedVolumeOutputs(config);
+}
+
+bool COutput::VolumeOutputRequested(const string& name) const {
+
+  for (const auto& field : volumeOutput_Map) {
+    if (field.second.offset != -1 && (field.first == name || field.second.outputGroup == name)) return true;
+  }
+  return false;
 }
 
 void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
@@ -1810,12 +2031,14 @@ void COutput::PostprocessHistoryData(CConfig *config){
         auto& timeAverage = it->second;
         timeAverage.AddValue(currentField.value,config->GetTimeIter(), config->GetStartWindowIteration()); //Collecting Values for Windowing
         SetHistoryOutputValue("TAVG_" + fieldIdentifier, timeAverage.GetVal());
-        if (config->GetDirectDiff() != NO_DERIVATIVE) {
-          SetHistoryOutputValue("D_TAVG_" + fieldIdentifier, SU2_TYPE::GetDerivative(timeAverage.GetVal()));
+        for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+          SetHistoryOutputValue(DirectDiffPrefix(config, iDir) + "TAVG_" + fieldIdentifier,
+                                SU2_TYPE::GetDerivative(timeAverage.GetVal(), iDir));
         }
       }
-      if (config->GetDirectDiff() != NO_DERIVATIVE){
-        SetHistoryOutputValue("D_" + fieldIdentifier, SU2_TYPE::GetDerivative(currentField.value));
+      for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+        SetHistoryOutputValue(DirectDiffPrefix(config, iDir) + fieldIdentifier,
+                              SU2_TYPE::GetDerivative(currentField.value, iDir));
       }
     }
   }
@@ -1865,26 +2088,35 @@ void COutput::PostprocessHistoryFields(CConfig *config){
     }
   }
 
-  if (config->GetDirectDiff()){
+  /*--- One derivative of each coefficient per direction, in vector forward mode the fields of all directions
+   *    are in the same group and their names include the differentiated variable. ---*/
+
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++){
+    const string prefix = DirectDiffPrefix(config, iDir);
+    const string screenPrefix = (config->GetnDirectDiff() > 1) ? "d" + config->GetDirectDiff_Name(iDir) : "d";
     for (unsigned short iField = 0; iField < historyOutput_List.size(); iField++){
       const string &fieldIdentifier = historyOutput_List[iField];
       const HistoryOutputField &currentField = historyOutput_Map.at(fieldIdentifier);
       if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
-        AddHistoryOutput("D_"      + fieldIdentifier, "d["     + currentField.fieldName + "]",
+        AddHistoryOutput(prefix + fieldIdentifier, screenPrefix + "["     + currentField.fieldName + "]",
                          currentField.screenFormat, "D_"      + currentField.outputGroup,
                          "Derivative value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
       }
     }
   }
 
-  if (config->GetTime_Domain() && config->GetDirectDiff()){
-    for (unsigned short iField = 0; iField < historyOutput_List.size(); iField++){
-      const string &fieldIdentifier = historyOutput_List[iField];
-      const HistoryOutputField &currentField = historyOutput_Map.at(fieldIdentifier);
-      if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
-        AddHistoryOutput("D_TAVG_" + fieldIdentifier, "dtavg[" + currentField.fieldName + "]",
-                         currentField.screenFormat, "D_TAVG_" + currentField.outputGroup,
-                         "Derivative of the time averaged value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+  if (config->GetTime_Domain()){
+    for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++){
+      const string prefix = DirectDiffPrefix(config, iDir);
+      const string screenPrefix = (config->GetnDirectDiff() > 1) ? "d" + config->GetDirectDiff_Name(iDir) : "d";
+      for (unsigned short iField = 0; iField < historyOutput_List.size(); iField++){
+        const string &fieldIdentifier = historyOutput_List[iField];
+        const HistoryOutputField &currentField = historyOutput_Map.at(fieldIdentifier);
+        if (currentField.fieldType == HistoryFieldType::COEFFICIENT){
+          AddHistoryOutput(prefix + "TAVG_" + fieldIdentifier, screenPrefix + "tavg[" + currentField.fieldName + "]",
+                           currentField.screenFormat, "D_TAVG_" + currentField.outputGroup,
+                           "Derivative of the time averaged value (DIRECT_DIFF=YES)", HistoryFieldType::AUTO_COEFFICIENT);
+        }
       }
     }
   }
@@ -2073,6 +2305,23 @@ void COutput::SetCommonHistoryFields() {
 
   AddHistoryOutput("NONPHYSICAL_POINTS", "Nonphysical_Points", ScreenOutputFormat::INTEGER, "NONPHYSICAL_POINTS", "The number of non-physical points in the solution");
 
+  AddHistoryOutput("TRANSPORT_CACHE_HITS", "Transport_Cache_Hits", ScreenOutputFormat::INTEGER, "TRANSPORT_CACHE_HITS", "The number of points that reused their cached transport properties");
+
+  /// BEGIN_GROUP: RUNTIME_PROFILE, DESCRIPTION: Accumulated time of the main phases (RUNTIME_PROFILING).
+  for (auto iSec = 0u; iSec < CRuntimeProfiler::nSections; iSec++) {
+    const string name = CRuntimeProfiler::Name(static_cast<CRuntimeProfiler::SECTION>(iSec));
+    AddHistoryOutput("PROF_" + name, "Prof_" + name, ScreenOutputFormat::SCIENTIFIC, "RUNTIME_PROFILE",
+                     "Accumulated time in " + name + " (s, master rank)");
+  }
+  /// END_GROUP
+
+  /// BEGIN_GROUP: MEMORY, DESCRIPTION: Memory high-water marks, largest over the ranks (MEMORY_HISTORY).
+  /// DESCRIPTION: Aligned allocations (solution containers, Jacobian, etc.).
+  AddHistoryOutput("MEM_ALLOCATED", "Mem_Allocated", ScreenOutputFormat::FIXED, "MEMORY", "Peak of the tracked allocations (MB)");
+  /// DESCRIPTION: Resident set size of the process.
+  AddHistoryOutput("MEM_PROCESS", "Mem_Process", ScreenOutputFormat::FIXED, "MEMORY", "Peak resident memory of the process (MB)");
+  /// END_GROUP
+
 }
 
 void COutput::RequestCommonHistory(bool dynamic) {
@@ -2104,6 +2353,8 @@ void COutput::SetCustomOutputs(const CConfig* config) {
     {"MassFlowAvg", OperationType::MASSFLOW_AVG},
     {"MassFlowInt", OperationType::MASSFLOW_INT},
     {"Probe", OperationType::PROBE},
+    {"Line", OperationType::LINE},
+    {"Plane", OperationType::PLANE},
   };
   std::stringstream knownOps;
   for (const auto& item : opMap) knownOps << item.first << ", ";
@@ -2183,6 +2434,10 @@ void COutput::SetCustomOutputs(const CConfig* config) {
       mel::Print(output.expression, output.varSymbols, std::cout);
 #endif
 
+      if (type != OperationType::FUNCTION && !output.compiled.Compile(output.func, output.varSymbols)) {
+        DebugPrint("The expression of " + output.name + " will be interpreted.");
+      }
+
       if (type == OperationType::FUNCTION) {
         AddHistoryOutput(output.name, output.name, ScreenOutputFormat::SCIENTIFIC, "CUSTOM", "Custom output", HistoryFieldType::COEFFICIENT);
         break;
@@ -2201,6 +2456,25 @@ void COutput::SetCustomOutputs(const CConfig* config) {
       /*--- Skip the terminating "]". ---*/
       if (it != last) ++it;
 
+      if (type == OperationType::LINE || type == OperationType::PLANE) {
+        /*--- One output per sample, "name_i", in a group with the name of the function. The number of
+         samples is the last entry of a line, and the product of the last two entries of a plane. ---*/
+        const size_t nCounts = (type == OperationType::LINE) ? 1 : 2;
+        if (output.markers.size() < nCounts) {
+          SU2_MPI::Error("Missing number of samples of " + output.name, CURRENT_FUNCTION);
+        }
+        unsigned long nSamples = 1;
+        for (auto i = output.markers.size() - nCounts; i < output.markers.size(); ++i) {
+          nSamples *= std::stoul(output.markers[i]);
+        }
+        for (auto iSample = 0ul; iSample < nSamples; ++iSample) {
+          output.sampleNames.push_back(output.name + "_" + std::to_string(iSample));
+          AddHistoryOutput(output.sampleNames.back(), output.sampleNames.back(), ScreenOutputFormat::SCIENTIFIC, output.name, "Custom output", HistoryFieldType::COEFFICIENT);
+        }
+        break;
+      }
+      if (type == OperationType::PROBE) output.sampleNames.push_back(output.name);
+
       AddHistoryOutput(output.name, output.name, ScreenOutputFormat::SCIENTIFIC, "CUSTOM", "Custom output", HistoryFieldType::COEFFICIENT);
     }
   }
@@ -2247,6 +2521,36 @@ void COutput::ComputeSimpleCustomOutputs(const CConfig *config) {
   }
 }
 
+bool COutput::CustomOutputsNeeded(const CConfig *config) {
+
+  /*--- Time averages, derivatives, and the outputs of the adjoint recording or of other zones may use the
+   *    values of any iteration. ---*/
+
+  if (noWriting || config->GetTime_Domain() || config->GetDiscrete_Adjoint() ||
+      config->GetMultizone_Problem() || config->GetDirectDiff() != NO_DERIVATIVE) return true;
+
+  if (WriteScreenOutput(config) || WriteHistoryFileOutput(config)) return true;
+
+  /*--- Otherwise only if something else consumes them. ---*/
+
+  auto IsCustom = [&](const string& field) {
+    for (const auto& output : customOutputs) {
+      if (field == output.name) return true;
+      for (const auto& name : output.sampleNames) if (field == name) return true;
+    }
+    return false;
+  };
+  for (const auto& field : convFields) if (IsCustom(field)) return true;
+  for (const auto& field : wndConvFields) if (IsCustom(field)) return true;
+
+  if (config->GetKind_ObjFunc() == CUSTOM_OBJFUNC) {
+    for (const auto& output : customOutputs) {
+      if (config->GetCustomObjFunc().find(output.name) != string::npos) return true;
+    }
+  }
+  return false;
+}
+
 void COutput::LoadCommonHistoryData(const CConfig *config) {
 
   SetHistoryOutputValue("TIME_STEP", config->GetDelta_UnstTimeND()*config->GetTime_Ref());
@@ -2270,6 +2574,23 @@ void COutput::LoadCommonHistoryData(const CConfig *config) {
   SetHistoryOutputValue("WALL_TIME", UsedTime);
 
   SetHistoryOutputValue("NONPHYSICAL_POINTS", config->GetNonphysical_Points());
+
+  SetHistoryOutputValue("TRANSPORT_CACHE_HITS", config->GetTransport_Cache_Hits());
+
+  for (auto iSec = 0u; iSec < CRuntimeProfiler::nSections; iSec++) {
+    const auto section = static_cast<CRuntimeProfiler::SECTION>(iSec);
+    SetHistoryOutputValue(string("PROF_") + CRuntimeProfiler::Name(section), CRuntimeProfiler::GetTime(section));
+  }
+
+  if (config->GetMemory_History()) {
+    su2double memory[2] = {0.0, CPhaseTimer::MemoryHighWaterMark()}, maxMemory[2];
+    for (auto iCat = 0u; iCat < MemoryAllocation::nCategories; iCat++) {
+      memory[0] += MemoryAllocation::PeakBytes(static_cast<MemoryAllocation::CATEGORY>(iCat)) / (1024.0 * 1024.0);
+    }
+    SU2_MPI::Allreduce(memory, maxMemory, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    SetHistoryOutputValue("MEM_ALLOCATED", maxMemory[0]);
+    SetHistoryOutputValue("MEM_PROCESS", maxMemory[1]);
+  }
 }
 
 
@@ -0,0 +1,321 @@
+/*!
+ * \file CCatalystWriter.cpp
+ * \brief In-situ output through Catalyst (Conduit Mesh Blueprint).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CCatalystWriter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+
+#include <algorithm>
+
+#ifdef HAVE_CATALYST
+#include <catalyst.h>
+#endif
+
+const string CCatalystWriter::fileExt = "";
+
+bool CCatalystWriter::initialized = false;
+
+CCatalystWriter::CCatalystWriter(CParallelDataSorter* valDataSorter, unsigned long valTimeIter, su2double valTime,
+                                 vector<string> valFields)
+    : CFileWriter(valDataSorter, fileExt),
+      timeIter(valTimeIter),
+      timeValue(SU2_TYPE::GetValue(valTime)),
+      sentFields(std::move(valFields)) {}
+
+void CCatalystWriter::Initialize(const CConfig* config) {
+
+  if (initialized) return;
+
+#ifdef HAVE_CATALYST
+  conduit_node* params = conduit_node_create();
+
+  for (unsigned short iScript = 0; iScript < config->GetnCatalyst_Scripts(); ++iScript) {
+    const string path = "catalyst/scripts/script" + to_string(iScript);
+    conduit_node_set_path_char8_str(params, path.c_str(), config->GetCatalyst_Script(iScript).c_str());
+  }
+
+  /*--- Otherwise the implementation is taken from the environment (CATALYST_IMPLEMENTATION_NAME). ---*/
+  if (!config->GetCatalyst_Implementation().empty()) {
+    conduit_node_set_path_char8_str(params, "catalyst_load/implementation",
+                                    config->GetCatalyst_Implementation().c_str());
+  }
+
+#ifdef HAVE_MPI
+  conduit_node_set_path_int64(params, "catalyst/mpi_comm", MPI_Comm_c2f(SU2_MPI::GetComm()));
+#endif
+
+  const auto status = catalyst_initialize(params);
+  conduit_node_destroy(params);
+
+  if (status != catalyst_status_ok) {
+    SU2_MPI::Error("Catalyst could not be initialized (error code " + to_string(status) + ").", CURRENT_FUNCTION);
+  }
+  initialized = true;
+#else
+  SU2_MPI::Error("SU2 was built without Catalyst support.", CURRENT_FUNCTION);
+#endif
+}
+
+void CCatalystWriter::Finalize() {
+
+  if (!initialized) return;
+
+#ifdef HAVE_CATALYST
+  conduit_node* params = conduit_node_create();
+  catalyst_finalize(params);
+  conduit_node_destroy(params);
+#endif
+  initialized = false;
+}
+
+void CCatalystWriter::WriteData(string val_filename) {
+
+#ifdef HAVE_CATALYST
+  if (!dataSorter->GetConnectivitySorted()) {
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+  if (!initialized) {
+    SU2_MPI::Error("Catalyst must be initialized before passing data to it.", CURRENT_FUNCTION);
+  }
+
+  startTime = SU2_MPI::Wtime();
+
+  const auto& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nField = fieldNames.size();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long pointBegin = dataSorter->GetnPointCumulative(rank);
+
+  static constexpr unsigned short nType = 7;
+  const GEO_TYPE types[nType] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON, PYRAMID, PRISM, HEXAHEDRON};
+  const unsigned short nNodes[nType] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL,
+                                        N_POINTS_TETRAHEDRON, N_POINTS_PYRAMID, N_POINTS_PRISM,
+                                        N_POINTS_HEXAHEDRON};
+
+  /*--- Points of the local elements that belong to other ranks (sorted, thus grouped by owner). ---*/
+
+  auto isLocal = [&](unsigned long iPoint) { return iPoint >= pointBegin && iPoint < pointBegin + nPoint; };
+
+  vector<unsigned long> ghostPoints;
+  for (unsigned short iType = 0; iType < nType; ++iType) {
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(types[iType]); ++iElem) {
+      for (unsigned short iNode = 0; iNode < nNodes[iType]; ++iNode) {
+        const auto iPoint = dataSorter->GetElemConnectivity(types[iType], iElem, iNode) - 1;
+        if (!isLocal(iPoint)) ghostPoints.push_back(iPoint);
+      }
+    }
+  }
+  sort(ghostPoints.begin(), ghostPoints.end());
+  ghostPoints.erase(unique(ghostPoints.begin(), ghostPoints.end()), ghostPoints.end());
+  const unsigned long nGhost = ghostPoints.size();
+
+  /*--- Request the data of those points from their owners. ---*/
+
+  vector<unsigned long> pointCumulative(size + 1, dataSorter->GetnPointsGlobal());
+  for (int iRank = 0; iRank < size; ++iRank) pointCumulative[iRank] = dataSorter->GetnPointCumulative(iRank);
+
+  vector<int> nRequest(size, 0), nReply(size, 0);
+  for (const auto iPoint : ghostPoints) {
+    const auto owner = upper_bound(pointCumulative.begin(), pointCumulative.end(), iPoint) - pointCumulative.begin() - 1;
+    ++nRequest[owner];
+  }
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nReply.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> requestDispl(size + 1, 0), replyDispl(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    requestDispl[iRank + 1] = requestDispl[iRank] + nRequest[iRank];
+    replyDispl[iRank + 1] = replyDispl[iRank] + nReply[iRank];
+  }
+
+  vector<unsigned long> requestedPoints(replyDispl[size]);
+  SU2_MPI::Alltoallv(ghostPoints.data(), nRequest.data(), requestDispl.data(), MPI_UNSIGNED_LONG,
+                     requestedPoints.data(), nReply.data(), replyDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  vector<passivedouble> replyData(requestedPoints.size() * nField);
+  for (unsigned long iReply = 0; iReply < requestedPoints.size(); ++iReply) {
+    const auto iPoint = requestedPoints[iReply] - pointBegin;
+    for (unsigned long iField = 0; iField < nField; ++iField) {
+      replyData[iReply * nField + iField] = dataSorter->GetData(iField, iPoint);
+    }
+  }
+
+  /*--- The owned points are followed by the ghost points, the data of all fields is interleaved. ---*/
+
+  vector<passivedouble> pointData((nPoint + nGhost) * nField);
+  copy_n(dataSorter->GetData(), nPoint * nField, pointData.begin());
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nRequest[iRank] *= nField;
+    nReply[iRank] *= nField;
+    requestDispl[iRank] *= nField;
+    replyDispl[iRank] *= nField;
+  }
+  SU2_MPI::Alltoallv(replyData.data(), nReply.data(), replyDispl.data(), MPI_DOUBLE,
+                     pointData.data() + nPoint * nField, nRequest.data(), requestDispl.data(), MPI_DOUBLE,
+                     SU2_MPI::GetComm());
+
+  vector<conduit_uint8> ghostType(nPoint + nGhost, 0);
+  fill(ghostType.begin() + nPoint, ghostType.end(), 1);
+
+  /*--- Mixed connectivity in local indices, the shape IDs are the VTK types, which is what GEO_TYPE uses. ---*/
+
+  vector<conduit_int32> shapes, sizes, offsets;
+  vector<conduit_int64> connectivity;
+  shapes.reserve(dataSorter->GetnElem());
+  sizes.reserve(dataSorter->GetnElem());
+  offsets.reserve(dataSorter->GetnElem());
+  connectivity.reserve(dataSorter->GetnConn());
+
+  for (unsigned short iType = 0; iType < nType; ++iType) {
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(types[iType]); ++iElem) {
+      shapes.push_back(types[iType]);
+      sizes.push_back(nNodes[iType]);
+      offsets.push_back(connectivity.size());
+      for (unsigned short iNode = 0; iNode < nNodes[iType]; ++iNode) {
+        const auto iPoint = dataSorter->GetElemConnectivity(types[iType], iElem, iNode) - 1;
+        if (isLocal(iPoint)) {
+          connectivity.push_back(iPoint - pointBegin);
+        } else {
+          connectivity.push_back(nPoint + lower_bound(ghostPoints.begin(), ghostPoints.end(), iPoint) -
+                                 ghostPoints.begin());
+        }
+      }
+    }
+  }
+
+  /*--- Describe the mesh and the fields (Conduit Mesh Blueprint), the arrays are not copied. ---*/
+
+  const string channel = "catalyst/channels/" + val_filename.substr(val_filename.find_last_of("/\\") + 1);
+  const string mesh = channel + "/data";
+
+  conduit_node* node = conduit_node_create();
+
+  conduit_node_set_path_int64(node, "catalyst/state/timestep", timeIter);
+  conduit_node_set_path_float64(node, "catalyst/state/time", timeValue);
+  conduit_node_set_path_char8_str(node, (channel + "/type").c_str(), "mesh");
+
+  const auto nLocal = static_cast<conduit_index_t>(nPoint + nGhost);
+  const auto stride = static_cast<conduit_index_t>(nField * sizeof(passivedouble));
+
+  auto setValues = [&](const string& path, unsigned long iField) {
+    conduit_node_set_path_external_float64_ptr_detailed(node, path.c_str(), pointData.data(), nLocal,
+                                                        iField * sizeof(passivedouble), stride,
+                                                        sizeof(passivedouble), CONDUIT_ENDIANNESS_DEFAULT_ID);
+  };
+
+  const char* axes[] = {"x", "y", "z"};
+
+  conduit_node_set_path_char8_str(node, (mesh + "/coordsets/coords/type").c_str(), "explicit");
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    setValues(mesh + "/coordsets/coords/values/" + axes[iDim], iDim);
+  }
+
+  const string topo = mesh + "/topologies/mesh";
+  conduit_node_set_path_char8_str(node, (topo + "/type").c_str(), "unstructured");
+  conduit_node_set_path_char8_str(node, (topo + "/coordset").c_str(), "coords");
+  conduit_node_set_path_char8_str(node, (topo + "/elements/shape").c_str(), "mixed");
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/line").c_str(), LINE);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/tri").c_str(), TRIANGLE);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/quad").c_str(), QUADRILATERAL);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/tet").c_str(), TETRAHEDRON);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/pyramid").c_str(), PYRAMID);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/wedge").c_str(), PRISM);
+  conduit_node_set_path_int32(node, (topo + "/elements/shape_map/hex").c_str(), HEXAHEDRON);
+  conduit_node_set_path_external_int32_ptr(node, (topo + "/elements/shapes").c_str(), shapes.data(), shapes.size());
+  conduit_node_set_path_external_int32_ptr(node, (topo + "/elements/sizes").c_str(), sizes.data(), sizes.size());
+  conduit_node_set_path_external_int32_ptr(node, (topo + "/elements/offsets").c_str(), offsets.data(),
+                                           offsets.size());
+  conduit_node_set_path_external_int64_ptr(node, (topo + "/elements/connectivity").c_str(), connectivity.data(),
+                                           connectivity.size());
+
+  auto setFieldHeader = [&](const string& path) {
+    conduit_node_set_path_char8_str(node, (path + "/association").c_str(), "vertex");
+    conduit_node_set_path_char8_str(node, (path + "/topology").c_str(), "mesh");
+  };
+
+  setFieldHeader(mesh + "/fields/vtkGhostType");
+  conduit_node_set_path_external_uint8_ptr(node, (mesh + "/fields/vtkGhostType/values").c_str(), ghostType.data(),
+                                           ghostType.size());
+
+  /*--- The requested fields, <name>_x, _y(, _z) are passed as one vector field. ---*/
+
+  auto fieldIndex = [&](const string& name) -> long {
+    if (find(sentFields.begin(), sentFields.end(), name) == sentFields.end()) return -1;
+    const auto it = find(fieldNames.begin() + nDim, fieldNames.end(), name);
+    return it == fieldNames.end() ? -1 : it - fieldNames.begin();
+  };
+
+  vector<bool> fieldDone(nField, false);
+
+  for (unsigned long iField = nDim; iField < nField; ++iField) {
+    if (fieldDone[iField] || fieldIndex(fieldNames[iField]) < 0) continue;
+
+    string name = fieldNames[iField];
+    name.erase(remove(name.begin(), name.end(), '"'), name.end());
+    replace(name.begin(), name.end(), '/', '_');
+
+    vector<long> components;
+    if (name.size() > 2 && name.compare(name.size() - 2, 2, "_x") == 0) {
+      const string base = fieldNames[iField].substr(0, fieldNames[iField].size() - 2);
+      components.push_back(iField);
+      for (unsigned short iDim = 1; iDim < nDim; ++iDim) components.push_back(fieldIndex(base + "_" + axes[iDim]));
+      if (find(components.begin(), components.end(), -1) != components.end()) components.resize(1);
+    }
+
+    if (components.size() > 1) {
+      name.resize(name.size() - 2);
+      setFieldHeader(mesh + "/fields/" + name);
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        setValues(mesh + "/fields/" + name + "/values/" + axes[iDim], components[iDim]);
+        fieldDone[components[iDim]] = true;
+      }
+    } else {
+      setFieldHeader(mesh + "/fields/" + name);
+      setValues(mesh + "/fields/" + name + "/values", iField);
+      fieldDone[iField] = true;
+    }
+  }
+
+  const auto status = catalyst_execute(node);
+  conduit_node_destroy(node);
+
+  if (status != catalyst_status_ok) {
+    SU2_MPI::Error("Catalyst failed to process the data (error code " + to_string(status) + ").", CURRENT_FUNCTION);
+  }
+
+  stopTime = SU2_MPI::Wtime();
+  usedTime = stopTime - startTime;
+
+  /*--- Amount of data handed to Catalyst. ---*/
+
+  su2double myFileSize = pointData.size() * sizeof(passivedouble) + connectivity.size() * sizeof(conduit_int64);
+  SU2_MPI::Allreduce(&myFileSize, &fileSize, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  bandwidth = fileSize / (1.0e6) / usedTime;
+
+#else
+  SU2_MPI::Error("SU2 was built without Catalyst support.", CURRENT_FUNCTION);
+#endif
+}
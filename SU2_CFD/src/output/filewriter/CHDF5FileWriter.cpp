@@ -0,0 +1,403 @@
+/*!
+ * \file CHDF5FileWriter.cpp
+ * \brief Filewriter class for HDF5 files described by XDMF.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CHDF5FileWriter.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+const string CHDF5FileWriter::fileExt = ".h5";
+const string CHDF5FileWriter::descriptorExt = ".xmf";
+
+CHDF5FileWriter::CHDF5FileWriter(CParallelDataSorter* valDataSorter, unsigned long valTimeIter, su2double valTime,
+                                 bool valTimeSeries, bool valDynamicGrid, unsigned short valCompression)
+    : CFileWriter(valDataSorter, fileExt),
+      timeIter(valTimeIter),
+      timeValue(SU2_TYPE::GetValue(valTime)),
+      timeSeries(valTimeSeries),
+      dynamicGrid(valDynamicGrid),
+      compression(min<unsigned short>(valCompression, 9)) {}
+
+void CHDF5FileWriter::WriteData(string val_filename) {
+
+#ifdef HAVE_HDF5
+  if (!dataSorter->GetConnectivitySorted()) {
+    SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+  }
+
+  const string descriptorName = val_filename + descriptorExt;
+  val_filename.append(fileExt);
+
+  startTime = SU2_MPI::Wtime();
+  fileSize = 0;
+
+  OpenFile(val_filename);
+
+  /*--- The mesh is only written once per file. ---*/
+
+  if (H5Lexists(fileID, "Mesh", H5P_DEFAULT) <= 0) {
+    const hid_t mesh = H5Gcreate2(fileID, "Mesh", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CallHDF5(mesh);
+    WriteTopology(mesh);
+    if (!dynamicGrid) WriteCoordinates(mesh);
+    CallHDF5(H5Gclose(mesh));
+  }
+
+  /*--- Each call adds one step, replacing a step with the same iteration (e.g. after a restart). ---*/
+
+  std::stringstream ss;
+  ss << "Step_" << std::setw(8) << std::setfill('0') << timeIter;
+  const string stepName = ss.str();
+
+  if (H5Lexists(fileID, stepName.c_str(), H5P_DEFAULT) > 0) {
+    CallHDF5(H5Ldelete(fileID, stepName.c_str(), H5P_DEFAULT));
+  }
+
+  /*--- Track the creation order to keep the order of the fields in the descriptor. ---*/
+
+  const hid_t gcpl = H5Pcreate(H5P_GROUP_CREATE);
+  CallHDF5(H5Pset_link_creation_order(gcpl, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED));
+  const hid_t step = H5Gcreate2(fileID, stepName.c_str(), H5P_DEFAULT, gcpl, H5P_DEFAULT);
+  CallHDF5(step);
+  CallHDF5(H5Pclose(gcpl));
+
+  auto writeAttribute = [step](const char* name, hid_t type, const void* value) {
+    const hid_t space = H5Screate(H5S_SCALAR);
+    const hid_t attr = H5Acreate2(step, name, type, space, H5P_DEFAULT, H5P_DEFAULT);
+    CallHDF5(attr);
+    CallHDF5(H5Awrite(attr, type, value));
+    CallHDF5(H5Aclose(attr));
+    CallHDF5(H5Sclose(space));
+  };
+  writeAttribute("Time", H5T_NATIVE_DOUBLE, &timeValue);
+  writeAttribute("TimeIter", H5T_NATIVE_ULONG, &timeIter);
+
+  if (dynamicGrid) WriteCoordinates(step);
+
+  /*--- Write the fields, the first nDim are the coordinates. ---*/
+
+  const auto& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  vector<float> buffer(nPoint);
+
+  for (unsigned short iField = dataSorter->GetnDim(); iField < fieldNames.size(); ++iField) {
+    string name = fieldNames[iField];
+    name.erase(remove(name.begin(), name.end(), '"'), name.end());
+    replace(name.begin(), name.end(), '/', '_');
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      buffer[iPoint] = static_cast<float>(dataSorter->GetData(iField, iPoint));
+    }
+    WriteDataset(step, name, H5T_IEEE_F32LE, H5T_NATIVE_FLOAT, buffer.data(), nPoint,
+                 dataSorter->GetnPointCumulative(rank), dataSorter->GetnPointsGlobal(), 1);
+  }
+  CallHDF5(H5Gclose(step));
+
+  /*--- The descriptor lists all the steps in the file. They are read by all ranks, since opening
+   *    objects in a parallel file is collective, but the master node writes the descriptor. ---*/
+
+  WriteDescriptor(descriptorName, val_filename.substr(val_filename.find_last_of("/\\") + 1));
+
+  CallHDF5(H5Pclose(dxplID));
+  CallHDF5(H5Fclose(fileID));
+
+  stopTime = SU2_MPI::Wtime();
+  usedTime = stopTime - startTime;
+
+  /*--- Size of the data written (before compression). ---*/
+
+  su2double myFileSize = fileSize;
+  SU2_MPI::Allreduce(&myFileSize, &fileSize, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  bandwidth = fileSize / (1.0e6) / usedTime;
+
+#else
+  SU2_MPI::Error("SU2 was built without HDF5 support (which comes with CGNS).", CURRENT_FUNCTION);
+#endif
+}
+
+#ifdef HAVE_HDF5
+void CHDF5FileWriter::OpenFile(const string& val_filename) {
+
+  /*--- Time series are appended to the file if it exists, the master node decides for everyone. ---*/
+
+  int append = 0;
+  if (rank == MASTER_NODE && timeSeries) {
+    append = std::ifstream(val_filename).good();
+  }
+  SU2_MPI::Bcast(&append, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+
+  const hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  dxplID = H5Pcreate(H5P_DATASET_XFER);
+
+#ifdef HAVE_MPI
+#ifdef H5_HAVE_PARALLEL
+  CallHDF5(H5Pset_fapl_mpio(fapl, SU2_MPI::GetComm(), MPI_INFO_NULL));
+  CallHDF5(H5Pset_dxpl_mpio(dxplID, H5FD_MPIO_COLLECTIVE));
+#else
+  if (size > 1) {
+    SU2_MPI::Error("HDF5 output in parallel requires a parallel build of the HDF5 library.", CURRENT_FUNCTION);
+  }
+#endif
+#endif
+
+  if (append) {
+    fileID = H5Fopen(val_filename.c_str(), H5F_ACC_RDWR, fapl);
+  } else {
+    fileID = H5Fcreate(val_filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  }
+  CallHDF5(H5Pclose(fapl));
+
+  if (fileID < 0) {
+    SU2_MPI::Error(string("Unable to open file ") + val_filename, CURRENT_FUNCTION);
+  }
+}
+
+void CHDF5FileWriter::WriteDataset(hid_t location, const string& name, hid_t fileType, hid_t memType,
+                                   const void* data, unsigned long nLocal, unsigned long offset,
+                                   unsigned long nGlobal, unsigned long nComp) {
+
+  const int nDims = (nComp > 1) ? 2 : 1;
+  const hsize_t dims[] = {nGlobal, nComp};
+  const hsize_t start[] = {offset, 0};
+  const hsize_t count[] = {nLocal, nComp};
+
+  const hid_t fileSpace = H5Screate_simple(nDims, dims, nullptr);
+  const hid_t memSpace = H5Screate_simple(nDims, count, nullptr);
+
+  /*--- Chunks allow compression and reading subsets of large datasets efficiently. ---*/
+
+  const hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if (nGlobal > 0) {
+    const hsize_t chunk[] = {min<hsize_t>(nGlobal, ChunkSize), nComp};
+    CallHDF5(H5Pset_chunk(dcpl, nDims, chunk));
+    if (compression > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+      CallHDF5(H5Pset_deflate(dcpl, compression));
+    }
+  }
+
+  const hid_t dataset = H5Dcreate2(location, name.c_str(), fileType, fileSpace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  CallHDF5(dataset);
+
+  if (nLocal > 0) {
+    CallHDF5(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, nullptr, count, nullptr));
+  } else {
+    CallHDF5(H5Sselect_none(fileSpace));
+    CallHDF5(H5Sselect_none(memSpace));
+  }
+  CallHDF5(H5Dwrite(dataset, memType, memSpace, fileSpace, dxplID, data));
+
+  fileSize += nLocal * nComp * H5Tget_size(memType);
+
+  CallHDF5(H5Dclose(dataset));
+  CallHDF5(H5Pclose(dcpl));
+  CallHDF5(H5Sclose(memSpace));
+  CallHDF5(H5Sclose(fileSpace));
+}
+
+void CHDF5FileWriter::WriteTopology(hid_t location) {
+
+  static constexpr unsigned short nType = 7;
+  const GEO_TYPE types[nType] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON, PYRAMID, PRISM, HEXAHEDRON};
+  const unsigned short nNodes[nType] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL,
+                                        N_POINTS_TETRAHEDRON, N_POINTS_PYRAMID, N_POINTS_PRISM,
+                                        N_POINTS_HEXAHEDRON};
+
+  /*--- Each element is its type and its nodes, polylines (lines) also need the number of nodes. ---*/
+
+  unsigned long nLocal = 0;
+  for (unsigned short iType = 0; iType < nType; ++iType) {
+    nLocal += dataSorter->GetnElem(types[iType]) * (1 + (types[iType] == LINE) + nNodes[iType]);
+  }
+
+  vector<int64_t> topology;
+  topology.reserve(nLocal);
+
+  for (unsigned short iType = 0; iType < nType; ++iType) {
+    const auto type = types[iType];
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(type); ++iElem) {
+      topology.push_back(GetXDMFType(type));
+      if (type == LINE) topology.push_back(N_POINTS_LINE);
+      for (unsigned short iNode = 0; iNode < nNodes[iType]; ++iNode) {
+        topology.push_back(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1);
+      }
+    }
+  }
+
+  /*--- Offset of this rank in the global array. ---*/
+
+  vector<unsigned long> nLocalAll(size);
+  SU2_MPI::Allgather(&nLocal, 1, MPI_UNSIGNED_LONG, nLocalAll.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  unsigned long offset = 0, nGlobal = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank < rank) offset += nLocalAll[iRank];
+    nGlobal += nLocalAll[iRank];
+  }
+
+  WriteDataset(location, "Topology", H5T_STD_I64LE, H5T_NATIVE_INT64, topology.data(), nLocal, offset, nGlobal, 1);
+
+  /*--- The descriptor needs the number of elements, which cannot be inferred from a mixed topology. ---*/
+
+  const unsigned long nElemGlobal = dataSorter->GetnElemGlobal();
+  const hid_t dataset = H5Dopen2(location, "Topology", H5P_DEFAULT);
+  const hid_t space = H5Screate(H5S_SCALAR);
+  const hid_t attr = H5Acreate2(dataset, "NumberOfElements", H5T_NATIVE_ULONG, space, H5P_DEFAULT, H5P_DEFAULT);
+  CallHDF5(attr);
+  CallHDF5(H5Awrite(attr, H5T_NATIVE_ULONG, &nElemGlobal));
+  CallHDF5(H5Aclose(attr));
+  CallHDF5(H5Sclose(space));
+  CallHDF5(H5Dclose(dataset));
+}
+
+void CHDF5FileWriter::WriteCoordinates(hid_t location) {
+
+  /*--- We always have 3 coords, independent of the actual value of nDim. ---*/
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+
+  vector<float> coords(nPoint * 3, 0.0f);
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      coords[iPoint * 3 + iDim] = static_cast<float>(dataSorter->GetData(iDim, iPoint));
+    }
+  }
+  WriteDataset(location, "Coordinates", H5T_IEEE_F32LE, H5T_NATIVE_FLOAT, coords.data(), nPoint,
+               dataSorter->GetnPointCumulative(rank), dataSorter->GetnPointsGlobal(), 3);
+}
+
+void CHDF5FileWriter::WriteDescriptor(const string& descriptorName, const string& dataFileName) const {
+
+  auto linkNames = [](hid_t group, H5_index_t order) {
+    H5G_info_t info;
+    CallHDF5(H5Gget_info(group, &info));
+    vector<string> names(info.nlinks);
+    for (hsize_t i = 0; i < info.nlinks; ++i) {
+      const auto len = H5Lget_name_by_idx(group, ".", order, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+      CallHDF5(len);
+      names[i].resize(len + 1);
+      H5Lget_name_by_idx(group, ".", order, H5_ITER_INC, i, &names[i][0], len + 1, H5P_DEFAULT);
+      names[i].resize(len);
+    }
+    return names;
+  };
+
+  auto extent = [](hid_t location, const string& name) {
+    const hid_t dataset = H5Dopen2(location, name.c_str(), H5P_DEFAULT);
+    const hid_t space = H5Dget_space(dataset);
+    hsize_t dims[2] = {0, 1};
+    H5Sget_simple_extent_dims(space, dims, nullptr);
+    H5Sclose(space);
+    H5Dclose(dataset);
+    return dims[0];
+  };
+
+  auto dataItem = [&dataFileName](unsigned long nRows, unsigned long nCols, const string& path, bool isInt) {
+    std::stringstream item;
+    item << "<DataItem Dimensions=\"" << nRows;
+    if (nCols > 1) item << " " << nCols;
+    item << "\" NumberType=\"" << (isInt ? "Int" : "Float") << "\" Precision=\"" << (isInt ? 8 : 4)
+         << "\" Format=\"HDF\">" << dataFileName << ":" << path << "</DataItem>";
+    return item.str();
+  };
+
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+  const auto topologySize = extent(fileID, "Mesh/Topology");
+
+  unsigned long nElemGlobal = 0;
+  const hid_t topology = H5Dopen2(fileID, "Mesh/Topology", H5P_DEFAULT);
+  const hid_t attr = H5Aopen(topology, "NumberOfElements", H5P_DEFAULT);
+  H5Aread(attr, H5T_NATIVE_ULONG, &nElemGlobal);
+  H5Aclose(attr);
+  H5Dclose(topology);
+
+  std::stringstream file;
+  file.precision(15);
+
+  file << "<?xml version=\"1.0\" ?>\n";
+  file << "<Xdmf Version=\"3.0\">\n<Domain>\n";
+  file << "<Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for (const auto& stepName : linkNames(fileID, H5_INDEX_NAME)) {
+    if (stepName.compare(0, 5, "Step_") != 0) continue;
+
+    const hid_t step = H5Gopen2(fileID, stepName.c_str(), H5P_DEFAULT);
+
+    passivedouble time = 0;
+    const hid_t timeAttr = H5Aopen(step, "Time", H5P_DEFAULT);
+    H5Aread(timeAttr, H5T_NATIVE_DOUBLE, &time);
+    H5Aclose(timeAttr);
+
+    const auto fields = linkNames(step, H5_INDEX_CRT_ORDER);
+    auto hasField = [&fields](const string& name) { return find(fields.begin(), fields.end(), name) != fields.end(); };
+    const bool stepCoords = hasField("Coordinates");
+
+    file << "<Grid Name=\"" << stepName << "\" GridType=\"Uniform\">\n";
+    file << "<Time Value=\"" << time << "\"/>\n";
+    file << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << nElemGlobal << "\">\n"
+         << dataItem(topologySize, 1, "/Mesh/Topology", true) << "\n</Topology>\n";
+    file << "<Geometry GeometryType=\"XYZ\">\n"
+         << dataItem(nPointGlobal, 3, stepCoords ? "/" + stepName + "/Coordinates" : "/Mesh/Coordinates", false)
+         << "\n</Geometry>\n";
+
+    /*--- Components named <name>_x, <name>_y (and <name>_z) are joined into vectors. ---*/
+
+    for (const auto& field : fields) {
+      if (field == "Coordinates") continue;
+
+      const bool hasSuffix = field.size() > 2;
+      const auto base = hasSuffix ? field.substr(0, field.size() - 2) : field;
+      const auto suffix = hasSuffix ? field.substr(field.size() - 2) : string();
+      const bool isVector = (suffix == "_x") && hasField(base + "_y");
+      if ((suffix == "_y" || suffix == "_z") && hasField(base + "_x") && hasField(base + "_y")) continue;
+
+      if (isVector) {
+        vector<string> components = {field, base + "_y"};
+        if (hasField(base + "_z")) components.push_back(base + "_z");
+
+        file << "<Attribute Name=\"" << base << "\" AttributeType=\"Vector\" Center=\"Node\">\n";
+        file << "<DataItem ItemType=\"Function\" Dimensions=\"" << nPointGlobal << " " << components.size()
+             << "\" Function=\"JOIN($0, $1" << (components.size() == 3 ? ", $2" : "") << ")\">\n";
+        for (const auto& component : components) {
+          file << dataItem(nPointGlobal, 1, "/" + stepName + "/" + component, false) << "\n";
+        }
+        file << "</DataItem>\n</Attribute>\n";
+      } else {
+        file << "<Attribute Name=\"" << field << "\" AttributeType=\"Scalar\" Center=\"Node\">\n"
+             << dataItem(nPointGlobal, 1, "/" + stepName + "/" + field, false) << "\n</Attribute>\n";
+      }
+    }
+    file << "</Grid>\n";
+
+    H5Gclose(step);
+  }
+
+  file << "</Grid>\n</Domain>\n</Xdmf>\n";
+
+  if (rank == MASTER_NODE) std::ofstream(descriptorName) << file.str();
+}
+#endif
@@ -26,11 +26,15 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter)  :
-  CFileWriter(valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter, RESTART_COMPRESSION valCompression,
+                                           su2double valTolerance)  :
+  CFileWriter(valDataSorter, fileExt),
+  compression(valCompression),
+  tolerance(SU2_TYPE::GetValue(valTolerance)) {}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter()= default;
@@ -56,6 +60,17 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  /*--- Compressed files are flagged by the fourth int, the fifth is the global number of blocks. ---*/
+
+  const unsigned long nBlock = (nParallel_Poin + CompressionToolbox::RestartBlockSize - 1) /
+                               CompressionToolbox::RestartBlockSize;
+  if (compression != RESTART_COMPRESSION::NONE) {
+    unsigned long nBlockGlobal = 0;
+    SU2_MPI::Allreduce(&nBlock, &nBlockGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    var_buf[3] = CompressionToolbox::RestartFormat;
+    var_buf[4] = nBlockGlobal;
+  }
+
   /*--- Open the file using MPI I/O ---*/
 
   OpenMPIFile(val_filename);
@@ -75,6 +90,12 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
 
+  if (compression != RESTART_COMPRESSION::NONE) {
+    WriteCompressedData();
+    CloseMPIFile();
+    return;
+  }
+
   /*--- Compute various data sizes --- */
 
   unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
@@ -91,3 +112,55 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
   CloseMPIFile();
 
 }
+
+void CSU2BinaryFileWriter::WriteCompressedData() {
+
+  const unsigned long nVar = dataSorter->GetFieldNames().size();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long pointBegin = dataSorter->GetnPointCumulative(rank);
+  const unsigned long nBlock = (nPoint + CompressionToolbox::RestartBlockSize - 1) /
+                               CompressionToolbox::RestartBlockSize;
+  const unsigned long nEntry = CompressionToolbox::RestartTableEntry(nVar);
+
+  /*--- Compress each field of each block of the local points. ---*/
+
+  vector<unsigned long> table(nBlock * nEntry);
+  vector<char> blocks;
+  vector<passivedouble> values(CompressionToolbox::RestartBlockSize);
+
+  for (unsigned long iBlock = 0; iBlock < nBlock; ++iBlock) {
+    const auto first = iBlock * CompressionToolbox::RestartBlockSize;
+    const auto nPointBlock = min(CompressionToolbox::RestartBlockSize, nPoint - first);
+    auto* entry = &table[iBlock * nEntry];
+    entry[0] = pointBegin + first;
+    entry[1] = nPointBlock;
+
+    for (unsigned long iVar = 0; iVar < nVar; ++iVar) {
+      passivedouble maxAbs = 0.0;
+      for (unsigned long iPoint = 0; iPoint < nPointBlock; ++iPoint) {
+        values[iPoint] = dataSorter->GetData(iVar, first + iPoint);
+        maxAbs = max(maxAbs, fabs(values[iPoint]));
+      }
+      if (compression == RESTART_COMPRESSION::LOSSY) {
+        CompressionToolbox::Quantize(values.data(), nPointBlock, tolerance * maxAbs);
+      }
+      entry[2 + iVar] = CompressionToolbox::Compress(values.data(), nPointBlock, blocks);
+    }
+  }
+
+  /*--- The ranks write their part of the table and of the blocks collectively. ---*/
+
+  unsigned long nLocal[2] = {nBlock * nEntry, blocks.size()}, nCumulative[2] = {0, 0}, nGlobal[2] = {0, 0};
+  vector<unsigned long> nAll(2 * size);
+  SU2_MPI::Allgather(nLocal, 2, MPI_UNSIGNED_LONG, nAll.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (int i = 0; i < 2; ++i) {
+      if (iRank < rank) nCumulative[i] += nAll[2 * iRank + i];
+      nGlobal[i] += nAll[2 * iRank + i];
+    }
+  }
+
+  WriteMPIBinaryDataAll(table.data(), nLocal[0] * sizeof(unsigned long), nGlobal[0] * sizeof(unsigned long),
+                        nCumulative[0] * sizeof(unsigned long));
+  WriteMPIBinaryDataAll(blocks.data(), nLocal[1], nGlobal[1], nCumulative[1]);
+}
@@ -0,0 +1,165 @@
+/*!
+ * \file CSU2BinaryMeshFileWriter.cpp
+ * \brief Filewriter class for the SU2 binary mesh format.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2BinaryMeshFileWriter.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+const string CSU2BinaryMeshFileWriter::fileExt = ".su2b";
+
+CSU2BinaryMeshFileWriter::CSU2BinaryMeshFileWriter(CParallelDataSorter *valDataSorter, unsigned short valnZone) :
+   CFileWriter(valDataSorter, fileExt), nZone(valnZone) {}
+
+void CSU2BinaryMeshFileWriter::WriteData(string val_filename) {
+
+  using Format = CSU2BinaryMeshReaderFVM;
+
+  if (nZone > 1) {
+    SU2_MPI::Error("The SU2 binary mesh format stores a single zone, use MESH output for multizone meshes.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
+  val_filename.append(fileExt);
+
+  const unsigned long nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nElem = dataSorter->GetnElem();
+
+  OpenMPIFile(val_filename);
+
+  /*--- Header, written by the master. ---*/
+
+  const unsigned long header[] = {Format::FileVersion, nDim, dataSorter->GetnElemGlobal(), dataSorter->GetnPointsGlobal()};
+  static_assert(sizeof(header) + 8 == Format::HeaderSize, "Inconsistent header size.");
+
+  WriteMPIBinaryData(Format::FileMagic, 8, MASTER_NODE);
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Fixed size element records [vtkType n0 ... n7], each rank writes its own
+   block, the global element index is implied by the position in the file. ---*/
+
+  vector<unsigned long> elemRecords(nElem * Format::ElemRecordSize, 0);
+  unsigned long iRecord = 0;
+
+  for (const auto type : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nPointsElem = nPointsOfElementType(type);
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      auto* record = &elemRecords[iRecord * Format::ElemRecordSize];
+      record[0] = type;
+      for (auto iNode = 0u; iNode < nPointsElem; ++iNode)
+        record[1 + iNode] = dataSorter->GetElemConnectivity(type, iElem, iNode) - 1;
+      iRecord++;
+    }
+  }
+
+  const unsigned long elemBytes = Format::ElemRecordSize * sizeof(unsigned long);
+  WriteMPIBinaryDataAll(elemRecords.data(), nElem * elemBytes, dataSorter->GetnElemGlobal() * elemBytes,
+                        dataSorter->GetnElemCumulative(rank) * elemBytes);
+  vector<unsigned long>().swap(elemRecords);
+
+  /*--- Point coordinates, sorted by global index over the ranks. ---*/
+
+  vector<passivedouble> coords(nPoint * nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      coords[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  const unsigned long pointBytes = nDim * sizeof(passivedouble);
+  WriteMPIBinaryDataAll(coords.data(), nPoint * pointBytes, dataSorter->GetnPointsGlobal() * pointBytes,
+                        dataSorter->GetnPointCumulative(rank) * pointBytes);
+  vector<passivedouble>().swap(coords);
+
+  /*--- The master reads the boundary information and writes the markers. ---*/
+
+  vector<char> markerBuffer;
+
+  auto append = [&markerBuffer](const void* data, unsigned long nBytes) {
+    const auto* bytes = static_cast<const char*>(data);
+    markerBuffer.insert(markerBuffer.end(), bytes, bytes + nBytes);
+  };
+
+  if (rank == MASTER_NODE) {
+
+    ifstream input_file("boundary.dat");
+
+    if (!input_file.is_open()) {
+      SU2_MPI::Error(string("Cannot find boundary.dat"), CURRENT_FUNCTION);
+    }
+
+    string text_line;
+    while (getline(input_file, text_line)) {
+
+      auto position = text_line.find("NMARK=",0);
+      if (position == string::npos) continue;
+
+      text_line.erase(0,6);
+      const unsigned long nMarker_ = atoi(text_line.c_str());
+      append(&nMarker_, sizeof(unsigned long));
+
+      for (auto iMarker = 0ul; iMarker < nMarker_; iMarker++) {
+
+        getline(input_file, text_line);
+        text_line.erase(0,11);
+        text_line.erase(remove_if(text_line.begin(), text_line.end(), ::isspace), text_line.end());
+        const string& Marker_Tag = text_line;
+
+        const unsigned long tagLength = Marker_Tag.size();
+        append(&tagLength, sizeof(unsigned long));
+        append(Marker_Tag.data(), tagLength);
+
+        getline(input_file, text_line);
+        text_line.erase(0,13);
+        const unsigned long nElem_Bound_ = atoi(text_line.c_str());
+        append(&nElem_Bound_, sizeof(unsigned long));
+
+        /*--- Skip SEND_TO. ---*/
+        getline(input_file, text_line);
+
+        for (auto iElem_Bound = 0ul; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+
+          unsigned long record[Format::BoundRecordSize] = {0};
+          bound_line >> record[0];
+
+          if (record[0] != LINE && record[0] != TRIANGLE && record[0] != QUADRILATERAL) {
+            SU2_MPI::Error(string("Unsupported boundary element type in marker ") + Marker_Tag, CURRENT_FUNCTION);
+          }
+          for (auto iNode = 0u; iNode < nPointsOfElementType(record[0]); ++iNode)
+            bound_line >> record[1 + iNode];
+
+          append(record, sizeof(record));
+        }
+      }
+      break;
+    }
+  }
+
+  WriteMPIBinaryData(markerBuffer.data(), markerBuffer.size(), MASTER_NODE);
+
+  CloseMPIFile();
+}
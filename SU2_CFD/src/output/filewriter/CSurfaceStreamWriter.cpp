@@ -0,0 +1,183 @@
+/*!
+ * \file CSurfaceStreamWriter.cpp
+ * \brief Surface stream (high-frequency sampling) output class.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSurfaceStreamWriter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+#include <algorithm>
+
+const string CSurfaceStreamWriter::fileExt = ".stream";
+
+CSurfaceStreamWriter::CSurfaceStreamWriter(CParallelDataSorter* valDataSorter, const CConfig* config,
+                                           const CGeometry* geometry, const vector<string>& valFields,
+                                           const string& val_filename)
+    : CFileWriter(valDataSorter, fileExt) {
+
+  /*--- Map the requested fields to the columns of the data sorter. ---*/
+
+  const auto& sorterFields = dataSorter->GetFieldNames();
+  for (const auto& field : valFields) {
+    const auto it = std::find(sorterFields.begin(), sorterFields.end(), field);
+    if (it == sorterFields.end())
+      SU2_MPI::Error("Field " + field + " of the surface stream is not in the volume output.", CURRENT_FUNCTION);
+    fieldIndex.push_back(it - sorterFields.begin());
+  }
+
+  /*--- Collect the points and elements of each marker owned by this rank. A point is owned by the rank where it
+   *    is a domain point, and an element by the rank owning its node with the lowest global index. The list of
+   *    markers is the same on all ranks, but a rank may not have some of them. ---*/
+
+  markers.resize(config->GetnSurface_Stream_Markers());
+  vector<unsigned long> nLocal(2 * markers.size()), nGlobal(2 * markers.size() * size);
+
+  for (auto iStream = 0ul; iStream < markers.size(); ++iStream) {
+    auto& marker = markers[iStream];
+    marker.tag = config->GetSurface_Stream_Marker(iStream);
+
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+      if (config->GetMarker_All_TagBound(iMarker) != marker.tag) continue;
+
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (geometry->nodes->GetDomain(iPoint)) marker.points.push_back(iPoint);
+      }
+
+      for (auto iElem = 0ul; iElem < geometry->GetnElem_Bound(iMarker); ++iElem) {
+        const auto* elem = geometry->bound[iMarker][iElem];
+        const unsigned short nNodes = std::min<unsigned short>(elem->GetnNodes(), +NodesPerElem);
+
+        auto owner = elem->GetNode(0);
+        for (unsigned short iNode = 1; iNode < nNodes; ++iNode) {
+          const auto iPoint = elem->GetNode(iNode);
+          if (geometry->nodes->GetGlobalIndex(iPoint) < geometry->nodes->GetGlobalIndex(owner)) owner = iPoint;
+        }
+        if (!geometry->nodes->GetDomain(owner)) continue;
+
+        marker.elements.push_back(elem->GetVTK_Type());
+        for (unsigned short iNode = 0; iNode < NodesPerElem; ++iNode) {
+          marker.elements.push_back(iNode < nNodes ? int64_t(geometry->nodes->GetGlobalIndex(elem->GetNode(iNode)))
+                                                   : int64_t(-1));
+        }
+      }
+    }
+    nLocal[2 * iStream] = marker.points.size();
+    nLocal[2 * iStream + 1] = marker.elements.size() / (1 + NodesPerElem);
+  }
+
+  /*--- The offsets of this rank in each block of the file are fixed. ---*/
+
+  SU2_MPI::Allgather(nLocal.data(), nLocal.size(), MPI_UNSIGNED_LONG, nGlobal.data(), nLocal.size(),
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  for (auto iStream = 0ul; iStream < markers.size(); ++iStream) {
+    auto& marker = markers[iStream];
+    for (int iRank = 0; iRank < size; ++iRank) {
+      const auto nPoint = nGlobal[iRank * nLocal.size() + 2 * iStream];
+      const auto nElem = nGlobal[iRank * nLocal.size() + 2 * iStream + 1];
+      if (iRank < rank) {
+        marker.pointOffset += nPoint;
+        marker.elemOffset += nElem;
+      }
+      marker.nPointGlobal += nPoint;
+      marker.nElemGlobal += nElem;
+    }
+    if (marker.nPointGlobal == 0)
+      SU2_MPI::Error("Marker " + marker.tag + " of the surface stream does not exist or is empty.", CURRENT_FUNCTION);
+  }
+
+  OpenMPIFile(val_filename);
+
+  /*--- Header, written by the master node. ---*/
+
+  const int32_t header[4] = {535532, 1, int32_t(fieldIndex.size()), int32_t(markers.size())};
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (const auto& field : valFields) {
+    strncpy(str_buf, field.c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+  for (const auto& marker : markers) {
+    strncpy(str_buf, marker.tag.c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+    const int64_t counts[2] = {int64_t(marker.nPointGlobal), int64_t(marker.nElemGlobal)};
+    WriteMPIBinaryData(counts, sizeof(counts), MASTER_NODE);
+  }
+
+  /*--- Geometry of each marker, written once. ---*/
+
+  for (const auto& marker : markers) {
+    const auto nPoint = marker.points.size();
+
+    vector<int64_t> globalIndex(nPoint);
+    vector<passivedouble> coord(3 * nPoint, 0.0);
+    for (auto i = 0ul; i < nPoint; ++i) {
+      globalIndex[i] = geometry->nodes->GetGlobalIndex(marker.points[i]);
+      for (unsigned short iDim = 0; iDim < geometry->GetnDim(); ++iDim)
+        coord[3 * i + iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(marker.points[i], iDim));
+    }
+
+    WriteMPIBinaryDataAll(globalIndex.data(), nPoint * sizeof(int64_t), marker.nPointGlobal * sizeof(int64_t),
+                          marker.pointOffset * sizeof(int64_t));
+    WriteMPIBinaryDataAll(coord.data(), 3 * nPoint * sizeof(passivedouble),
+                          3 * marker.nPointGlobal * sizeof(passivedouble),
+                          3 * marker.pointOffset * sizeof(passivedouble));
+
+    constexpr unsigned long elemSize = (1 + NodesPerElem) * sizeof(int64_t);
+    WriteMPIBinaryDataAll(marker.elements.data(), marker.elements.size() * sizeof(int64_t),
+                          marker.nElemGlobal * elemSize, marker.elemOffset * elemSize);
+  }
+
+  /*--- The element lists are no longer needed. ---*/
+
+  for (auto& marker : markers) vector<int64_t>().swap(marker.elements);
+}
+
+CSurfaceStreamWriter::~CSurfaceStreamWriter() { CloseMPIFile(); }
+
+void CSurfaceStreamWriter::WriteStep(unsigned long iter, su2double time) {
+
+  const passivedouble stamp[2] = {passivedouble(iter), SU2_TYPE::GetValue(time)};
+  WriteMPIBinaryData(stamp, sizeof(stamp), MASTER_NODE);
+
+  const auto nField = fieldIndex.size();
+
+  for (const auto& marker : markers) {
+    const auto nPoint = marker.points.size();
+    buffer.resize(nPoint * nField);
+
+    for (auto i = 0ul; i < nPoint; ++i)
+      for (auto iField = 0ul; iField < nField; ++iField)
+        buffer[i * nField + iField] = dataSorter->GetUnsortedData(marker.points[i], fieldIndex[iField]);
+
+    WriteMPIBinaryDataAll(buffer.data(), nPoint * nField * sizeof(passivedouble),
+                          marker.nPointGlobal * nField * sizeof(passivedouble),
+                          marker.pointOffset * nField * sizeof(passivedouble));
+  }
+
+  ++nRecord;
+}
@@ -29,6 +29,7 @@
 #ifdef HAVE_TECIO
   #include "TECIO.h"
 #endif
+#include <algorithm>
 #include <set>
 
 const string CTecplotBinaryFileWriter::fileExt = ".szplt";
@@ -55,15 +56,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
 #ifdef HAVE_TECIO
 
   const vector<string> fieldNames = dataSorter->GetFieldNames();
-
-  /*--- Reduce the total number of each element. ---*/
-
-  unsigned long nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
-                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
-                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
-                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
-                nParallel_Pris = dataSorter->GetnElem(PRISM),
-                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
+  const auto nVar = fieldNames.size();
 
   unsigned long nTot_Line = dataSorter->GetnElemGlobal(LINE),
                 nTot_Tria = dataSorter->GetnElemGlobal(TRIANGLE),
@@ -76,10 +69,10 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   string data_set_title = "Visualization of the solution";
 
   ostringstream tecplot_variable_names;
-  for (size_t iVar = 0; iVar < fieldNames.size()-1; ++iVar) {
+  for (size_t iVar = 0; iVar < nVar-1; ++iVar) {
     tecplot_variable_names << fieldNames[iVar] << ",";
   }
-  tecplot_variable_names << fieldNames[fieldNames.size()-1];
+  tecplot_variable_names << fieldNames[nVar-1];
 
   void* file_handle = nullptr;
   int32_t err = tecFileWriterOpen(val_filename.c_str(), data_set_title.c_str(), tecplot_variable_names.str().c_str(),
@@ -91,33 +84,32 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   if (err) cout << "Error initializing Tecplot parallel output." << endl;
 #endif
 
-  /*--- Define the zone(s). For 2D, and for 3D surfaces, each rank outputs a separate zone. ---*/
+  /*--- Define the zone. Lower dimensional elements are degenerated into the element type of the zone,
+   *    the map of each element type gives the position of its nodes in the element of the zone. ---*/
 
-  int64_t num_nodes;
-  int64_t num_cells;
   int32_t zone_type;
-
-
-  num_nodes = static_cast<int64_t>(dataSorter->GetnPointsGlobal());
-  num_cells = static_cast<int64_t>(dataSorter->GetnElemGlobal());
-  if (dataSorter->GetnDim() == 3){
-    if ((nTot_Quad > 0 || nTot_Tria > 0) && (nTot_Hexa + nTot_Pris + nTot_Pyra + nTot_Tetr == 0)){
-      zone_type = ZONETYPE_FEQUADRILATERAL;
-    }
-    else {
-      zone_type = ZONETYPE_FEBRICK;
-    }
+  vector<pair<GEO_TYPE, vector<unsigned short> > > zone_elems;
+
+  if (dataSorter->GetnDim() == 3 && (nTot_Hexa + nTot_Pris + nTot_Pyra + nTot_Tetr > 0)) {
+    zone_type = ZONETYPE_FEBRICK;
+    zone_elems = {{TETRAHEDRON, {0, 1, 2, 2, 3, 3, 3, 3}},
+                  {HEXAHEDRON, {0, 1, 2, 3, 4, 5, 6, 7}},
+                  {PRISM, {0, 1, 1, 2, 3, 4, 4, 5}},
+                  {PYRAMID, {0, 1, 2, 3, 4, 4, 4, 4}}};
+  }
+  else if (nTot_Line > 0 && (nTot_Tria + nTot_Quad == 0)) {
+    zone_type = ZONETYPE_FELINESEG;
+    zone_elems = {{LINE, {0, 1}}};
   }
   else {
-    if (nTot_Line > 0 && (nTot_Tria + nTot_Quad == 0)){
-      zone_type = ZONETYPE_FELINESEG;
-
-    }
-    else{
-      zone_type = ZONETYPE_FEQUADRILATERAL;
-    }
+    zone_type = ZONETYPE_FEQUADRILATERAL;
+    zone_elems = {{TRIANGLE, {0, 1, 2, 2}},
+                  {QUADRILATERAL, {0, 1, 2, 3}}};
   }
 
+  const auto num_nodes = static_cast<int64_t>(dataSorter->GetnPointsGlobal());
+  const auto num_cells = static_cast<int64_t>(dataSorter->GetnElemGlobal());
+
   bool is_unsteady = false;
   passivedouble solution_time = 0.0;
 
@@ -127,7 +119,7 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
   }
 
   int32_t zone;
-  vector<int32_t> value_locations(fieldNames.size(), 1); /* Nodal variables. */
+  vector<int32_t> value_locations(nVar, 1); /* Nodal variables. */
   err = tecZoneCreateFE(file_handle, "Zone", zone_type, num_nodes, num_cells, nullptr, nullptr, value_locations.data(), nullptr, 0, 0, 0, &zone);
   if (err) cout << rank << ": Error creating Tecplot zone." << endl;
   if (is_unsteady) {
@@ -135,451 +127,169 @@ void CTecplotBinaryFileWriter::WriteData(string val_filename){
     if (err) cout << rank << ": Error setting Tecplot zone unsteady options." << std::endl;
   }
 
-#ifdef HAVE_MPI
-
-  unsigned long nParallel_Line = dataSorter->GetnElem(LINE);
-
-  unsigned short iVar;
-  NodePartitioner node_partitioner(num_nodes, size);
-  std::set<unsigned long> halo_nodes;
-  vector<unsigned long> sorted_halo_nodes;
-  vector<passivedouble> halo_var_data;
-  vector<int> num_nodes_to_receive(size, 0);
-  vector<int> values_to_receive_displacements(size);
+  /*--- The global (1-based) node numbers of this rank are node_begin+1 to node_end. ---*/
 
-  if (zone_type == ZONETYPE_FEBRICK) {
-
-    /* We output a single, partitioned zone where each rank outputs one partition. */
-    vector<int32_t> partition_owners;
-    partition_owners.reserve(size);
-    for (int32_t iRank = 0; iRank < size; ++iRank)
-      partition_owners.push_back(iRank);
-    err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, size, partition_owners.data());
-    if (err) cout << rank << ": Error assigning MPI ranks for Tecplot zone partitions." << endl;
-
-    /* Gather a list of nodes we refer to but are not outputting. */
-
-    for (unsigned long i = 0; i < nParallel_Tria * N_POINTS_TRIANGLE; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(TRIANGLE, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(TRIANGLE, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(TRIANGLE, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Quad * N_POINTS_QUADRILATERAL; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(QUADRILATERAL, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Tetr * N_POINTS_TETRAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(TETRAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Hexa * N_POINTS_HEXAHEDRON; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(HEXAHEDRON, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pris * N_POINTS_PRISM; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(PRISM, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(PRISM, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(PRISM, 0, i));
-
-    for (unsigned long i = 0; i < nParallel_Pyra * N_POINTS_PYRAMID; ++i)
-      if ((unsigned long)dataSorter->GetElemConnectivity(PYRAMID, 0, i) <= dataSorter->GetNodeBegin(rank) ||
-          dataSorter->GetNodeEnd(rank) < (unsigned long)dataSorter->GetElemConnectivity(PYRAMID, 0, i))
-        halo_nodes.insert(dataSorter->GetElemConnectivity(PYRAMID, 0, i));
-
-    /* Sorted list of halo nodes for this MPI rank. */
-    sorted_halo_nodes.assign(halo_nodes.begin(), halo_nodes.end());
-
-    /* Have to include all nodes our cells refer to or TecIO will barf, so add the halo node count to the number of local nodes. */
-    int64_t partition_num_nodes = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + static_cast<int64_t>(halo_nodes.size());
-    int64_t partition_num_cells = nParallel_Tetr + nParallel_Hexa + nParallel_Pris + nParallel_Pyra;
-
-    /*--- We effectively tack the halo nodes onto the end of the node list for this partition.
-      TecIO will later replace them with references to nodes in neighboring partitions. */
-    size_t num_halo_nodes = sorted_halo_nodes.size();
-    vector<int64_t> halo_node_local_numbers(max((size_t)1, num_halo_nodes)); /* Min size 1 to avoid crashes when we access these vectors below. */
-    vector<int32_t> neighbor_partitions(max((size_t)1, num_halo_nodes));
-    vector<int64_t> neighbor_nodes(max((size_t)1, num_halo_nodes));
-    for(int64_t i = 0; i < static_cast<int64_t>(num_halo_nodes); ++i) {
-      halo_node_local_numbers[i] = dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank) + i + 1;
-      int owning_rank;
-      unsigned long node_number;
-      node_partitioner.GetOwningRankAndNodeNumber(sorted_halo_nodes[i], owning_rank, node_number);
-      neighbor_partitions[i] = owning_rank + 1; /* Partition numbers are 1-based. */
-      neighbor_nodes[i] = static_cast<int64_t>(node_number);
-    }
-    err = tecFEPartitionCreate64(file_handle, zone, rank + 1, partition_num_nodes, partition_num_cells,
-      static_cast<int64_t>(num_halo_nodes), halo_node_local_numbers.data(), neighbor_partitions.data(), neighbor_nodes.data(), 0, nullptr);
-    if (err) cout << rank << ": Error creating Tecplot zone partition." << endl;
+  const unsigned long num_local_nodes = dataSorter->GetnPoints();
+  const unsigned long node_begin = dataSorter->GetnPointCumulative(rank);
+  const unsigned long node_end = node_begin + num_local_nodes;
 
-    /* Gather halo node data. First, tell each rank how many nodes' worth of data we need from them. */
-    for (size_t i = 0; i < num_halo_nodes; ++i)
-      ++num_nodes_to_receive[neighbor_partitions[i] - 1];
-    vector<int> num_nodes_to_send(size);
-    SU2_MPI::Alltoall(num_nodes_to_receive.data(), 1, MPI_INT, num_nodes_to_send.data(), 1, MPI_INT, SU2_MPI::GetComm());
-
-    /* Now send the global node numbers whose data we need,
-       and receive the same from all other ranks.
-       Each rank has globally consecutive node numbers,
-       so we can just parcel out sorted_halo_nodes for send. */
-    vector<int> nodes_to_send_displacements(size);
-    vector<int> nodes_to_receive_displacements(size);
-    nodes_to_send_displacements[0] = 0;
-    nodes_to_receive_displacements[0] = 0;
-    for(int iRank = 1; iRank < size; ++iRank) {
-      nodes_to_send_displacements[iRank] = nodes_to_send_displacements[iRank - 1] + num_nodes_to_send[iRank - 1];
-      nodes_to_receive_displacements[iRank] = nodes_to_receive_displacements[iRank - 1] + num_nodes_to_receive[iRank - 1];
-    }
-    int total_num_nodes_to_send = nodes_to_send_displacements[size - 1] + num_nodes_to_send[size - 1];
-    vector<unsigned long> nodes_to_send(max(1, total_num_nodes_to_send));
-
-    /* The terminology gets a bit confusing here. We're sending the node numbers
-       (sorted_halo_nodes) whose data we need to receive, and receiving
-       lists of nodes whose data we need to send. */
-    if (sorted_halo_nodes.empty()) sorted_halo_nodes.resize(1); /* Avoid crash. */
-    SU2_MPI::Alltoallv(sorted_halo_nodes.data(), num_nodes_to_receive.data(), nodes_to_receive_displacements.data(), MPI_UNSIGNED_LONG,
-                       nodes_to_send.data(),     num_nodes_to_send.data(),    nodes_to_send_displacements.data(),    MPI_UNSIGNED_LONG,
-                       SU2_MPI::GetComm());
-
-    /* Now actually send and receive the data */
-    vector<passivedouble> data_to_send(max(1, total_num_nodes_to_send * (int)fieldNames.size()));
-    halo_var_data.resize(max((size_t)1, fieldNames.size() * num_halo_nodes));
-    vector<int> num_values_to_send(size);
-    vector<int> values_to_send_displacements(size);
-    vector<int> num_values_to_receive(size);
-    size_t index = 0;
-    for(int iRank = 0; iRank < size; ++iRank) {
-      /* We send and receive GlobalField_Counter values per node. */
-      num_values_to_send[iRank]              = num_nodes_to_send[iRank] * fieldNames.size();
-      values_to_send_displacements[iRank]    = nodes_to_send_displacements[iRank] * fieldNames.size();
-      num_values_to_receive[iRank]           = num_nodes_to_receive[iRank] * fieldNames.size();
-      values_to_receive_displacements[iRank] = nodes_to_receive_displacements[iRank] * fieldNames.size();
-      for(iVar = 0; iVar < fieldNames.size(); ++iVar)
-        for(int iNode = 0; iNode < num_nodes_to_send[iRank]; ++iNode) {
-          unsigned long node_offset = nodes_to_send[nodes_to_send_displacements[iRank] + iNode] - dataSorter->GetNodeBegin(rank) - 1;
-          data_to_send[index++] =dataSorter->GetData(iVar,node_offset);
-        }
-    }
-    CBaseMPIWrapper::Alltoallv(data_to_send.data(),  num_values_to_send.data(),    values_to_send_displacements.data(),    MPI_DOUBLE,
-                       halo_var_data.data(), num_values_to_receive.data(), values_to_receive_displacements.data(), MPI_DOUBLE,
-                       SU2_MPI::GetComm());
-  }
-  else {
-    /* Zone will be gathered to and output by MASTER_NODE */
-    int32_t partition_owner = MASTER_NODE;
-    err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, 1, &partition_owner);
-  }
+  unsigned long num_local_cells = 0;
+  for (const auto& elem : zone_elems) num_local_cells += dataSorter->GetnElem(elem.first);
 
-  /*--- Write surface and volumetric solution data. ---*/
+  /*--- Nodes referenced by the cells of this rank but that are written by other ranks. ---*/
 
-  if (zone_type == ZONETYPE_FEBRICK) {
-    std::vector<passivedouble> values_to_write(dataSorter->GetnPoints());
-    for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-      for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-        values_to_write[i] = dataSorter->GetData(iVar, i);
-      err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, dataSorter->GetnPoints(), values_to_write.data());
-      if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
-      for (int iRank = 0; err == 0 && iRank < size; ++iRank) {
-        if (num_nodes_to_receive[iRank] > 0) {
-          int var_data_offset = values_to_receive_displacements[iRank] + num_nodes_to_receive[iRank] * iVar;
-          err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, rank + 1, static_cast<int64_t>(num_nodes_to_receive[iRank]), &halo_var_data[var_data_offset]);
-          if (err) cout << rank << ": Error outputting Tecplot halo values." << endl;
-        }
-      }
-    }
-  } else {
-    if (rank == MASTER_NODE) {
-      vector<passivedouble> var_data;
-      unsigned long nPoint = dataSorter->GetnPoints();
-      vector<unsigned long> num_points(size);
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, num_points.data(), 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-
-      for(int iRank = 0; iRank < size; ++iRank) {
-        int64_t rank_num_points = num_points[iRank];
-
-        if (rank_num_points > 0) {
-          if (iRank == rank) { /* Output local data. */
-            std::vector<passivedouble> values_to_write;
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              values_to_write.resize(rank_num_points);
-              for(unsigned long i = 0; i < (unsigned long)rank_num_points; ++i)
-                values_to_write[i] = dataSorter->GetData(iVar,i);
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, values_to_write.data());
-              if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
-            }
-          }
-          else { /* Receive data from other rank. */
-            var_data.resize(max((int64_t)1, (int64_t)fieldNames.size() * rank_num_points));
-            CBaseMPIWrapper::Recv(var_data.data(), fieldNames.size() * rank_num_points, MPI_DOUBLE, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-            for (iVar = 0; err == 0 && iVar < fieldNames.size(); iVar++) {
-              err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, rank_num_points, &var_data[iVar * rank_num_points]);
-              if (err) cout << rank << ": Error outputting Tecplot surface variable values." << endl;
-            }
-          }
-        }
+  std::set<unsigned long> halo_nodes;
+  for (const auto& elem : zone_elems) {
+    const auto nElemNodes = nPointsOfElementType(elem.first);
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(elem.first); ++iElem) {
+      for (unsigned short iNode = 0; iNode < nElemNodes; ++iNode) {
+        const auto node = dataSorter->GetElemConnectivity(elem.first, iElem, iNode);
+        if (node <= node_begin || node_end < node) halo_nodes.insert(node);
       }
     }
-    else { /* Send data to MASTER_NODE */
-      unsigned long nPoint = dataSorter->GetnPoints();
-
-      SU2_MPI::Gather(&nPoint, 1, MPI_UNSIGNED_LONG, nullptr, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-
-      vector<passivedouble> var_data;
-      size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
-      var_data.reserve(var_data_size);
-      for (iVar = 0; err == 0 && iVar < fieldNames.size() ; iVar++)
-          for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-            var_data.push_back(dataSorter->GetData(iVar,i));
-
-      if (!var_data.empty())
-        CBaseMPIWrapper::Send(var_data.data(), static_cast<int>(var_data.size()), MPI_DOUBLE, MASTER_NODE, rank, SU2_MPI::GetComm());
-    }
   }
+  /* Sorted list of halo nodes for this MPI rank. */
+  vector<unsigned long> sorted_halo_nodes(halo_nodes.begin(), halo_nodes.end());
+  const auto num_halo_nodes = sorted_halo_nodes.size();
 
-#else
-
-  unsigned short iVar;
-
-  vector<passivedouble> var_data;
-  size_t var_data_size = fieldNames.size() * dataSorter->GetnPoints();
-  var_data.reserve(var_data_size);
+  /*--- The halo values, grouped by variable. ---*/
 
+  vector<passivedouble> halo_var_data(nVar * num_halo_nodes);
 
-  for (iVar = 0; err == 0 && iVar <  fieldNames.size(); iVar++) {
-    for(unsigned long i = 0; i < dataSorter->GetnPoints(); ++i)
-      var_data.push_back(dataSorter->GetData(iVar,i));
-    err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, 0, dataSorter->GetnPoints(), &var_data[iVar * dataSorter->GetnPoints()]);
-    if (err) cout << rank << ": Error outputting Tecplot variable value." << endl;
-  }
-
+  /*--- Each rank writes one partition of the zone (the ranks without nodes or cells do not write any). ---*/
 
-#endif /* HAVE_MPI */
+  int32_t partition = 0;
 
-  /*--- Write connectivity data. ---*/
+#ifdef HAVE_MPI
 
-  unsigned long iElem;
+  vector<unsigned long> rank_counts(2 * size);
+  const unsigned long local_counts[] = {num_local_nodes, num_local_cells};
+  SU2_MPI::Allgather(local_counts, 2, MPI_UNSIGNED_LONG, rank_counts.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-#ifdef HAVE_MPI
-  if (zone_type == ZONETYPE_FEBRICK) {
-
-    int64_t nodes[8];
-
-    /**
-     *  Each rank writes node numbers relative to the partition it is outputting (starting with node number 1).
-     *  Ghost (halo) nodes identified above are numbered sequentially just beyond the end of the actual, local nodes.
-     *  Note that beg_node and end_node refer to zero-based node numbering, but Conn_* contain one-based node numbers.
-     */
-#define MAKE_LOCAL(n) dataSorter->GetNodeBegin(rank) < (unsigned long)n && (unsigned long)n <= dataSorter->GetNodeEnd(rank) \
-  ? (int64_t)((unsigned long)n - dataSorter->GetNodeBegin(rank)) \
-  : GetHaloNodeNumber(n, dataSorter->GetNodeEnd(rank) - dataSorter->GetNodeBegin(rank), sorted_halo_nodes)
-
-    for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 2));
-      nodes[3] = nodes[2];
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 3));
-      nodes[5] = nodes[4];
-      nodes[6] = nodes[4];
-      nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
+  /*--- Partition numbers are 1-based, and the global node numbers of each rank start after rank_node_begin. ---*/
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 2));
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 3));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 4));
-      nodes[5] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 5));
-      nodes[6] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 6));
-      nodes[7] = MAKE_LOCAL(dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 7));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+  vector<int32_t> rank_partition(size, 0), partition_owners;
+  vector<unsigned long> rank_node_begin(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (rank_counts[2 * iRank] + rank_counts[2 * iRank + 1] > 0) {
+      partition_owners.push_back(iRank);
+      rank_partition[iRank] = partition_owners.size();
     }
+    rank_node_begin[iRank + 1] = rank_node_begin[iRank] + rank_counts[2 * iRank];
+  }
+  partition = rank_partition[rank];
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 1));
-      nodes[2] = nodes[1];
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 2));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 3));
-      nodes[5] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 4));
-      nodes[6] = nodes[5];
-      nodes[7] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PRISM, iElem, 5));
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
+  err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, partition_owners.size(), partition_owners.data());
+  if (err) cout << rank << ": Error assigning MPI ranks for Tecplot zone partitions." << endl;
 
-    for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
-      nodes[0] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PYRAMID, iElem, 0));
-      nodes[1] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PYRAMID, iElem, 1));
-      nodes[2] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PYRAMID, iElem, 2));
-      nodes[3] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PYRAMID, iElem, 3));
-      nodes[4] = MAKE_LOCAL(dataSorter->GetElemConnectivity(PYRAMID, iElem, 4));
-      nodes[5] = nodes[4];
-      nodes[6] = nodes[4];
-      nodes[7] = nodes[4];
-      err = tecZoneNodeMapWrite64(file_handle, zone, rank + 1, 1, 8, nodes);
-      if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-    }
-  } else {
-    if (rank == MASTER_NODE) {
-
-      /* Non-hexahedral output by the master node. Output local data directly, and gather other data from the other ranks. */
-
-      int64_t nodes[4];
-
-      vector<unsigned long> connectivity_sizes(size);
-      unsigned long unused = 0;
-      SU2_MPI::Gather(&unused, 1, MPI_UNSIGNED_LONG, connectivity_sizes.data(), 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      for(int iRank = 0; iRank < size; ++iRank) {
-        if (iRank == rank) {
-          for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(LINE, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(LINE, iElem, 1);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 2, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-          for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1);
-            nodes[2] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-            nodes[3] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-          for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-            nodes[0] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0);
-            nodes[1] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1);
-            nodes[2] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2);
-            nodes[3] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3);
-            err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, 4, nodes);
-            if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-          }
-
-        } else { /* Receive node map and write out. */
-          connectivity.resize(max((unsigned long)1, connectivity_sizes[iRank]));
-          SU2_MPI::Recv(connectivity.data(), connectivity_sizes[iRank], MPI_UNSIGNED_LONG, iRank, iRank, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
-          err = tecZoneNodeMapWrite64(file_handle, zone, 0, 1, connectivity_sizes[iRank], connectivity.data());
-          if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-        }
-      }
-    } else {
-
-      /* Non-hexahedral output by non-master node. Send what we've got to the master node. */
-
-      unsigned long connectivity_size;
-      connectivity_size = 2 * nParallel_Line + 4 * (nParallel_Tria + nParallel_Quad);
-      SU2_MPI::Gather(&connectivity_size, 1, MPI_UNSIGNED_LONG, nullptr, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
-      vector<int64_t> connectivity;
-      connectivity.reserve(connectivity_size);
-      for (iElem = 0; err == 0 && iElem < nParallel_Line; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(LINE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(LINE, iElem, 0));
-      }
+  /*--- The halo nodes are appended to the local nodes of the partition,
+   *    TecIO replaces them with references to the nodes of the neighbor partitions. ---*/
 
-      for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2));
-        connectivity.push_back(dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2));
-      }
+  vector<int64_t> halo_node_local_numbers(max<size_t>(1, num_halo_nodes));
+  vector<int32_t> neighbor_partitions(max<size_t>(1, num_halo_nodes));
+  vector<int64_t> neighbor_nodes(max<size_t>(1, num_halo_nodes));
+  vector<int> num_nodes_to_receive(size, 0);
 
-      for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2));
-        connectivity.push_back(dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3));
-      }
+  for (size_t i = 0; i < num_halo_nodes; ++i) {
+    const auto owner = static_cast<int>(upper_bound(rank_node_begin.begin() + 1, rank_node_begin.end(),
+                                                    sorted_halo_nodes[i] - 1) - rank_node_begin.begin()) - 1;
+    halo_node_local_numbers[i] = num_local_nodes + i + 1;
+    neighbor_partitions[i] = rank_partition[owner];
+    neighbor_nodes[i] = static_cast<int64_t>(sorted_halo_nodes[i] - rank_node_begin[owner]);
+    ++num_nodes_to_receive[owner];
+  }
 
-      if (connectivity.empty()) connectivity.resize(1); /* Avoid crash */
-      SU2_MPI::Send(connectivity.data(), connectivity_size, MPI_UNSIGNED_LONG, MASTER_NODE, rank, SU2_MPI::GetComm());
-    }
+  if (partition > 0) {
+    err = tecFEPartitionCreate64(file_handle, zone, partition, num_local_nodes + num_halo_nodes, num_local_cells,
+      static_cast<int64_t>(num_halo_nodes), halo_node_local_numbers.data(), neighbor_partitions.data(), neighbor_nodes.data(), 0, nullptr);
+    if (err) cout << rank << ": Error creating Tecplot zone partition." << endl;
   }
-#else
 
-  int64_t nodes[8];
+  /*--- Gather the halo node data. First, tell each rank how many nodes' worth of data we need from them. ---*/
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Tria; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-    nodes[3] = dataSorter->GetElemConnectivity(TRIANGLE, iElem, 2);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+  vector<int> num_nodes_to_send(size);
+  SU2_MPI::Alltoall(num_nodes_to_receive.data(), 1, MPI_INT, num_nodes_to_send.data(), 1, MPI_INT, SU2_MPI::GetComm());
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Quad; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 2);
-    nodes[3] = dataSorter->GetElemConnectivity(QUADRILATERAL, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 4, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+  /* Now send the global node numbers whose data we need, and receive the same from all other ranks.
+     Each rank has globally consecutive node numbers, so we can just parcel out sorted_halo_nodes for send. */
+  vector<int> nodes_to_send_displacements(size, 0);
+  vector<int> nodes_to_receive_displacements(size, 0);
+  for (int iRank = 1; iRank < size; ++iRank) {
+    nodes_to_send_displacements[iRank] = nodes_to_send_displacements[iRank - 1] + num_nodes_to_send[iRank - 1];
+    nodes_to_receive_displacements[iRank] = nodes_to_receive_displacements[iRank - 1] + num_nodes_to_receive[iRank - 1];
   }
-
-  for (iElem = 0; err == 0 && iElem < nParallel_Tetr; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 2);
-    nodes[3] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 2);
-    nodes[4] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 3);
-    nodes[5] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 3);
-    nodes[6] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 3);
-    nodes[7] = dataSorter->GetElemConnectivity(TETRAHEDRON, iElem, 3);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+  const int total_num_nodes_to_send = nodes_to_send_displacements[size - 1] + num_nodes_to_send[size - 1];
+  vector<unsigned long> nodes_to_send(max(1, total_num_nodes_to_send));
+
+  /* We're sending the node numbers whose data we need to receive, and receiving lists of nodes whose data we need to send. */
+  vector<unsigned long> nodes_to_receive(sorted_halo_nodes);
+  if (nodes_to_receive.empty()) nodes_to_receive.resize(1); /* Avoid crash. */
+  SU2_MPI::Alltoallv(nodes_to_receive.data(), num_nodes_to_receive.data(), nodes_to_receive_displacements.data(), MPI_UNSIGNED_LONG,
+                     nodes_to_send.data(),    num_nodes_to_send.data(),    nodes_to_send_displacements.data(),    MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  /* Now actually send and receive the data, all the variables of a node are contiguous. */
+  vector<passivedouble> data_to_send(max(1, total_num_nodes_to_send * static_cast<int>(nVar)));
+  vector<passivedouble> data_to_receive(max<size_t>(1, nVar * num_halo_nodes));
+  vector<int> num_values_to_send(size), values_to_send_displacements(size);
+  vector<int> num_values_to_receive(size), values_to_receive_displacements(size);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    num_values_to_send[iRank]              = num_nodes_to_send[iRank] * nVar;
+    values_to_send_displacements[iRank]    = nodes_to_send_displacements[iRank] * nVar;
+    num_values_to_receive[iRank]           = num_nodes_to_receive[iRank] * nVar;
+    values_to_receive_displacements[iRank] = nodes_to_receive_displacements[iRank] * nVar;
   }
-
-  for (iElem = 0; err == 0 && iElem < nParallel_Hexa; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 2);
-    nodes[3] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 3);
-    nodes[4] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 4);
-    nodes[5] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 5);
-    nodes[6] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 6);
-    nodes[7] = dataSorter->GetElemConnectivity(HEXAHEDRON, iElem, 7);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+  for (int i = 0; i < total_num_nodes_to_send; ++i) {
+    const unsigned long node_offset = nodes_to_send[i] - node_begin - 1;
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      data_to_send[i * nVar + iVar] = dataSorter->GetData(iVar, node_offset);
   }
+  CBaseMPIWrapper::Alltoallv(data_to_send.data(),    num_values_to_send.data(),    values_to_send_displacements.data(),    MPI_DOUBLE,
+                             data_to_receive.data(), num_values_to_receive.data(), values_to_receive_displacements.data(), MPI_DOUBLE,
+                             SU2_MPI::GetComm());
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Pris; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(PRISM, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(PRISM, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(PRISM, iElem, 1);
-    nodes[3] = dataSorter->GetElemConnectivity(PRISM, iElem, 2);
-    nodes[4] = dataSorter->GetElemConnectivity(PRISM, iElem, 3);
-    nodes[5] = dataSorter->GetElemConnectivity(PRISM, iElem, 4);
-    nodes[6] = dataSorter->GetElemConnectivity(PRISM, iElem, 4);
-    nodes[7] = dataSorter->GetElemConnectivity(PRISM, iElem, 5);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
-  }
+  for (size_t i = 0; i < num_halo_nodes; ++i)
+    for (size_t iVar = 0; iVar < nVar; ++iVar)
+      halo_var_data[iVar * num_halo_nodes + i] = data_to_receive[i * nVar + iVar];
 
-  for (iElem = 0; err == 0 && iElem < nParallel_Pyra; iElem++) {
-    nodes[0] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 0);
-    nodes[1] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 1);
-    nodes[2] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 2);
-    nodes[3] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 3);
-    nodes[4] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 4);
-    nodes[5] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 4);
-    nodes[6] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 4);
-    nodes[7] = dataSorter->GetElemConnectivity(PYRAMID, iElem, 4);
-    err = tecZoneNodeMapWrite64(file_handle, zone, rank, 1, 8, nodes);
-    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+#endif /* HAVE_MPI */
+
+  /*--- Write the solution data of the partition, the local nodes followed by the halo nodes. ---*/
+
+  const bool write_partition = (num_local_nodes + num_local_cells > 0) || (size == SINGLE_NODE);
+
+  if (write_partition) {
+    vector<passivedouble> values_to_write(num_local_nodes + num_halo_nodes);
+    for (size_t iVar = 0; err == 0 && iVar < nVar; iVar++) {
+      for (unsigned long i = 0; i < num_local_nodes; ++i)
+        values_to_write[i] = dataSorter->GetData(iVar, i);
+      for (size_t i = 0; i < num_halo_nodes; ++i)
+        values_to_write[num_local_nodes + i] = halo_var_data[iVar * num_halo_nodes + i];
+      err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar + 1, partition, values_to_write.size(), values_to_write.data());
+      if (err) cout << rank << ": Error outputting Tecplot variable values." << endl;
+    }
   }
 
+  /*--- Write the connectivity of the partition. The node numbers are relative to the partition (starting with 1),
+   *    and the halo nodes are numbered sequentially just beyond the end of the local nodes. ---*/
 
+  if (write_partition && err == 0 && num_local_cells > 0) {
+    vector<int64_t> connectivity;
+    connectivity.reserve(num_local_cells * zone_elems.front().second.size());
 
-#endif
+    for (const auto& elem : zone_elems) {
+      for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(elem.first); ++iElem) {
+        for (const auto iNode : elem.second) {
+          const auto node = dataSorter->GetElemConnectivity(elem.first, iElem, iNode);
+          connectivity.push_back(node_begin < node && node <= node_end ? static_cast<int64_t>(node - node_begin)
+                                                                        : GetHaloNodeNumber(node, num_local_nodes, sorted_halo_nodes));
+        }
+      }
+    }
+    err = tecZoneNodeMapWrite64(file_handle, zone, partition, 1, connectivity.size(), connectivity.data());
+    if (err) cout << rank << ": Error outputting Tecplot node values." << endl;
+  }
 
   err = tecFileWriterClose(&file_handle);
   if (err) cout << rank << ": Error finishing Tecplot file output." << endl;
@@ -605,9 +315,7 @@ int64_t CTecplotBinaryFileWriter::GetHaloNodeNumber(unsigned long global_node_nu
   auto it = lower_bound(halo_node_list.begin(), halo_node_list.end(), global_node_number);
   assert(it != halo_node_list.end());
   assert(*it == global_node_number);
-  /* When C++11 is universally available, replace the following mouthful with "auto" */
-  iterator_traits<vector<unsigned long>::const_iterator>::difference_type offset = distance(halo_node_list.begin(), it);
+  const auto offset = distance(halo_node_list.begin(), it);
   assert(offset >= 0);
   return (int64_t)(last_local_node + offset + 1);
 }
-
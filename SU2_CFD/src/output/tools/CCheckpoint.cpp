@@ -0,0 +1,338 @@
+/*!
+ * \file CCheckpoint.cpp
+ * \brief Node-local (buddy) checkpoints of unsteady simulations.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CCheckpoint.hpp"
+#include "../../../include/solvers/CSolver.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#if defined(_WIN32)
+#include <direct.h>
+#endif
+
+using namespace std;
+
+vector<char> CCheckpoint::recovered;
+
+namespace {
+/*--- Header of the checkpoints, followed by nSnapshot x nPointDomain x nField values (latest snapshot first). ---*/
+struct CheckpointHeader {
+  uint64_t magic, timeIter, nPointDomain, nField, nSnapshot, partitionHash;
+};
+constexpr uint64_t CheckpointMagic = 0x53553243484b5031;  // "SU2CHKP1"
+
+/*--- 64-bit FNV-1a hash of the global indices of the domain points, identifies the partition. ---*/
+uint64_t PartitionHash(const CGeometry* geometry) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const auto iPoint : geometry->GetDomainPoints_GlobalOrder()) {
+    const uint64_t globalIndex = geometry->nodes->GetGlobalIndex(iPoint);
+    for (auto iByte = 0u; iByte < sizeof(uint64_t); ++iByte) {
+      hash = (hash ^ ((globalIndex >> (8 * iByte)) & 0xff)) * 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
+CheckpointHeader GetHeader(const vector<char>& data) {
+  CheckpointHeader header{};
+  if (data.size() >= sizeof(CheckpointHeader)) memcpy(&header, data.data(), sizeof(CheckpointHeader));
+  return header;
+}
+}  // namespace
+
+CCheckpoint::CCheckpoint(const CConfig* config) {
+  const auto comm = SU2_MPI::GetComm();
+  rank = SU2_MPI::GetRank();
+  size = SU2_MPI::GetSize();
+
+  /*--- Global rank of the first rank of the node of each rank, and local rank in the node. ---*/
+
+  int nodeInfo[2] = {0, rank};
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  MPI_Comm_rank(nodeComm, &nodeInfo[1]);
+  nodeInfo[0] = rank;
+  SU2_MPI::Bcast(&nodeInfo[0], 1, MPI_INT, 0, nodeComm);
+  MPI_Comm_free(&nodeComm);
+#endif
+  vector<int> allNodeInfo(2 * size);
+  SU2_MPI::Allgather(nodeInfo, 2, MPI_INT, allNodeInfo.data(), 2, MPI_INT, comm);
+
+  /*--- The buddy is the rank with the same local rank on the next node (cyclically). With one
+   *    node the next rank is used, the copy then only protects against the loss of a file. ---*/
+
+  vector<vector<int> > ranksPerNode;
+  vector<int> nodeOfLeader(size, -1);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    auto& iNode = nodeOfLeader[allNodeInfo[2 * iRank]];
+    if (iNode < 0) {
+      iNode = ranksPerNode.size();
+      ranksPerNode.emplace_back();
+    }
+    ranksPerNode[iNode].push_back(iRank);
+  }
+
+  if (ranksPerNode.size() == 1) {
+    buddy = (rank + 1) % size;
+  } else {
+    const auto& next = ranksPerNode[(nodeOfLeader[nodeInfo[0]] + 1) % ranksPerNode.size()];
+    buddy = next[nodeInfo[1] % next.size()];
+  }
+
+  vector<int> buddies(size);
+  SU2_MPI::Allgather(&buddy, 1, MPI_INT, buddies.data(), 1, MPI_INT, comm);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (buddies[iRank] == rank && iRank != rank) wards.push_back(iRank);
+  }
+
+  /*--- Node-local directory of the checkpoints. ---*/
+
+  const auto& dir = config->GetCheckpoint_Dir();
+#if defined(_WIN32)
+#ifdef __MINGW32__
+  mkdir(dir.c_str());
+#else
+  _mkdir(dir.c_str());
+#endif
+#else
+  mkdir(dir.c_str(), 0755);
+#endif
+}
+
+string CCheckpoint::FileName(const CConfig* config, int owner, bool copy) {
+  return config->GetCheckpoint_Dir() + "/checkpoint_rank" + to_string(owner) + (copy ? "_buddy" : "") + ".dat";
+}
+
+void CCheckpoint::WriteFile(const string& fileName, const vector<char>& data) {
+  /*--- Write to a temporary file and rename it, a failure while writing does not destroy the previous checkpoint. ---*/
+  const auto tmpName = fileName + ".tmp";
+  {
+    ofstream file(tmpName, ios::binary);
+    file.write(data.data(), data.size());
+    if (!file.good()) SU2_MPI::Error("Unable to write the checkpoint " + tmpName + ".", CURRENT_FUNCTION);
+  }
+  if (rename(tmpName.c_str(), fileName.c_str()) != 0) {
+    SU2_MPI::Error("Unable to rename the checkpoint " + tmpName + ".", CURRENT_FUNCTION);
+  }
+}
+
+bool CCheckpoint::ReadFile(const string& fileName, vector<char>& data) {
+  ifstream file(fileName, ios::binary | ios::ate);
+  if (!file.is_open()) return false;
+  data.resize(file.tellg());
+  file.seekg(0);
+  file.read(data.data(), data.size());
+  const auto header = GetHeader(data);
+  const auto nValue = header.nSnapshot * header.nPointDomain * header.nField;
+  return file.good() && header.magic == CheckpointMagic &&
+         data.size() == sizeof(CheckpointHeader) + nValue * sizeof(passivedouble);
+}
+
+vector<passivedouble> CCheckpoint::GetRestartData(const CConfig* config, const CGeometry* geometry,
+                                                  CSolver* const* solver, bool previous) {
+
+  /*--- Same layout as the restart files: coordinates, then the flow, turbulence and species variables.
+   *    Incompressible restarts only include the energy variable when the energy equation is active. ---*/
+
+  const auto nDim = geometry->GetnDim();
+  const bool incNoEnergy = (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) && !config->GetEnergy_Equation();
+
+  vector<pair<const CVariable*, unsigned short> > blocks;
+  blocks.emplace_back(solver[FLOW_SOL]->GetNodes(), solver[FLOW_SOL]->GetnVar() - incNoEnergy);
+  if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) {
+    blocks.emplace_back(solver[TURB_SOL]->GetNodes(), solver[TURB_SOL]->GetnVar());
+  }
+  if (config->GetKind_Species_Model() != SPECIES_MODEL::NONE) {
+    blocks.emplace_back(solver[SPECIES_SOL]->GetNodes(), solver[SPECIES_SOL]->GetnVar());
+  }
+
+  unsigned long nFields = nDim;
+  for (const auto& block : blocks) nFields += block.second;
+
+  vector<passivedouble> data;
+  data.reserve(nFields * geometry->GetnPointDomain());
+
+  for (const auto iPoint : geometry->GetDomainPoints_GlobalOrder()) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) {
+      data.push_back(SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+    }
+    for (const auto& block : blocks) {
+      for (auto iVar = 0u; iVar < block.second; ++iVar) {
+        const auto value = previous ? block.first->GetSolution_time_n1(iPoint, iVar)
+                                    : block.first->GetSolution(iPoint, iVar);
+        data.push_back(SU2_TYPE::GetValue(value));
+      }
+    }
+  }
+  return data;
+}
+
+void CCheckpoint::Save(const CConfig* config, const CGeometry* geometry, CSolver* const* solver,
+                       unsigned long timeIter) {
+
+  /*--- Second order dual time stepping also needs the solution at the previous time. ---*/
+
+  const bool dt2nd = config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND;
+
+  auto current = GetRestartData(config, geometry, solver);
+
+  CheckpointHeader header{};
+  header.magic = CheckpointMagic;
+  header.timeIter = timeIter;
+  header.nPointDomain = geometry->GetnPointDomain();
+  header.nField = current.size() / max<unsigned long>(1, header.nPointDomain);
+  header.nSnapshot = 1 + dt2nd;
+  header.partitionHash = PartitionHash(geometry);
+
+  const auto snapshotBytes = current.size() * sizeof(passivedouble);
+  own.resize(sizeof(CheckpointHeader) + header.nSnapshot * snapshotBytes);
+  memcpy(own.data(), &header, sizeof(CheckpointHeader));
+  memcpy(own.data() + sizeof(CheckpointHeader), current.data(), snapshotBytes);
+  if (dt2nd) {
+    const auto previous = GetRestartData(config, geometry, solver, true);
+    memcpy(own.data() + sizeof(CheckpointHeader) + snapshotBytes, previous.data(), snapshotBytes);
+  }
+
+  /*--- Send the checkpoint to the buddy and receive those of the wards, sizes first. ---*/
+
+  if (buddy != rank) {
+    const auto comm = SU2_MPI::GetComm();
+    const unsigned long ownSize = own.size();
+    vector<unsigned long> wardSizes(wards.size());
+    vector<SU2_MPI::Request> requests(wards.size() + 1);
+
+    SU2_MPI::Isend(&ownSize, 1, MPI_UNSIGNED_LONG, buddy, rank, comm, &requests[0]);
+    for (auto iWard = 0ul; iWard < wards.size(); ++iWard) {
+      SU2_MPI::Irecv(&wardSizes[iWard], 1, MPI_UNSIGNED_LONG, wards[iWard], wards[iWard], comm, &requests[iWard + 1]);
+    }
+    SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+
+    SU2_MPI::Isend(own.data(), own.size(), MPI_CHAR, buddy, rank, comm, &requests[0]);
+    for (auto iWard = 0ul; iWard < wards.size(); ++iWard) {
+      auto& copy = copies[wards[iWard]];
+      copy.resize(wardSizes[iWard]);
+      SU2_MPI::Irecv(copy.data(), copy.size(), MPI_CHAR, wards[iWard], wards[iWard], comm, &requests[iWard + 1]);
+    }
+    SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+  }
+
+  WriteFile(FileName(config, rank, false), own);
+  for (const auto& copy : copies) WriteFile(FileName(config, copy.first, true), copy.second);
+
+  if (rank == MASTER_NODE) {
+    cout << "Checkpoint of time iteration " << timeIter << " saved in " << config->GetCheckpoint_Dir() << "." << endl;
+  }
+}
+
+void CCheckpoint::Recover(CConfig* config) {
+  const auto comm = SU2_MPI::GetComm();
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  /*--- Which ranks have their own checkpoint, and which can provide the copy of the others. ---*/
+
+  int haveOwn = ReadFile(FileName(config, rank, false), recovered);
+  if (!haveOwn) recovered.clear();
+  vector<int> allHaveOwn(size);
+  SU2_MPI::Allgather(&haveOwn, 1, MPI_INT, allHaveOwn.data(), 1, MPI_INT, comm);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (allHaveOwn[iRank]) continue;
+
+    vector<char> copy;
+    const int haveCopy = (iRank != rank) && ReadFile(FileName(config, iRank, true), copy);
+    const int candidate = haveCopy ? rank : size;
+    int holder = size;
+    SU2_MPI::Allreduce(&candidate, &holder, 1, MPI_INT, MPI_MIN, comm);
+    if (holder == size) {
+      SU2_MPI::Error("The checkpoint of rank " + to_string(iRank) + " and its copy were not found in " +
+                     config->GetCheckpoint_Dir() + ".", CURRENT_FUNCTION);
+    }
+    unsigned long copySize = copy.size();
+    if (rank == holder) {
+      SU2_MPI::Send(&copySize, 1, MPI_UNSIGNED_LONG, iRank, iRank, comm);
+      SU2_MPI::Send(copy.data(), copySize, MPI_CHAR, iRank, iRank, comm);
+    } else if (rank == iRank) {
+      SU2_MPI::Recv(&copySize, 1, MPI_UNSIGNED_LONG, holder, iRank, comm, MPI_STATUS_IGNORE);
+      recovered.resize(copySize);
+      SU2_MPI::Recv(recovered.data(), copySize, MPI_CHAR, holder, iRank, comm, MPI_STATUS_IGNORE);
+    }
+  }
+
+  /*--- All ranks must restart from the same time iteration. ---*/
+
+  const unsigned long timeIter = GetHeader(recovered).timeIter;
+  unsigned long minIter = 0, maxIter = 0;
+  SU2_MPI::Allreduce(&timeIter, &minIter, 1, MPI_UNSIGNED_LONG, MPI_MIN, comm);
+  SU2_MPI::Allreduce(&timeIter, &maxIter, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm);
+  if (minIter != maxIter) {
+    SU2_MPI::Error("The checkpoints are from different time iterations (" + to_string(minIter) + " to " +
+                   to_string(maxIter) + "), use the regular restart files.", CURRENT_FUNCTION);
+  }
+
+  config->SetRestart_FromCheckpoint(timeIter + 1);
+
+  if (rank == MASTER_NODE) {
+    cout << "Restarting from the checkpoints of time iteration " << timeIter << "." << endl;
+  }
+}
+
+void CCheckpoint::SetRestarts(const CConfig* config, const CGeometry* geometry) {
+
+  const auto header = GetHeader(recovered);
+  const int mismatch = (header.nPointDomain != geometry->GetnPointDomain()) ||
+                       (header.partitionHash != PartitionHash(geometry));
+  int anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  if (anyMismatch) {
+    SU2_MPI::Error("The partition of the mesh does not match the checkpoints, the same number of ranks and the "
+                   "same partitioning (e.g. PARTITION_CACHE) are required.", CURRENT_FUNCTION);
+  }
+
+  vector<string> fields = {"Point_ID", "x", "y"};
+  if (geometry->GetnDim() == 3) fields.push_back("z");
+  for (auto iField = fields.size() - 1; iField < header.nField; ++iField) {
+    fields.push_back("Field_" + to_string(iField));
+  }
+
+  /*--- The snapshot of time n-1 is only needed by second order dual time stepping. ---*/
+
+  const auto nValue = header.nPointDomain * header.nField;
+  const auto* values = reinterpret_cast<const passivedouble*>(recovered.data() + sizeof(CheckpointHeader));
+
+  for (auto iSnapshot = 0ul; iSnapshot < header.nSnapshot; ++iSnapshot) {
+    vector<passivedouble> data(values + iSnapshot * nValue, values + (iSnapshot + 1) * nValue);
+    const auto fileName = config->GetFilename(config->GetSolution_FileName(), "", header.timeIter - iSnapshot);
+    CSolver::StoreRestartInMemory(fileName, fields, std::move(data));
+  }
+  vector<char>().swap(recovered);
+}
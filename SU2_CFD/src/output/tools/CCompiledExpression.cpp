@@ -0,0 +1,199 @@
+/*!
+ * \file CCompiledExpression.cpp
+ * \brief Compilation and block evaluation of the custom output expressions.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CCompiledExpression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+using namespace std;
+
+struct CCompiledExpression::Parser {
+  const string& str;
+  const vector<string>& symbols;
+  vector<Instruction>& code;
+  size_t pos = 0;
+  bool ok = true;
+
+  Parser(const string& s, const vector<string>& syms, vector<Instruction>& c) : str(s), symbols(syms), code(c) {}
+
+  static bool IsOperator(char c) {
+    return c == '+' || c == '-' || c == '*' || c == '/' || c == '^' || c == '(' || c == ')' || c == ',' ||
+           c == ' ' || c == '\t';
+  }
+
+  void SkipSpaces() {
+    while (pos < str.size() && (str[pos] == ' ' || str[pos] == '\t')) ++pos;
+  }
+
+  bool Accept(char c) {
+    SkipSpaces();
+    if (pos < str.size() && str[pos] == c) {
+      ++pos;
+      return true;
+    }
+    return false;
+  }
+
+  unsigned long Emit(OpCode op, unsigned long a = 0, unsigned long b = 0, passivedouble value = 0) {
+    code.push_back({op, a, b, value});
+    return code.size() - 1;
+  }
+
+  unsigned long Fail() {
+    ok = false;
+    return 0;
+  }
+
+  /*--- expr := term (('+'|'-') term)* ---*/
+  unsigned long Expression() {
+    auto lhs = Term();
+    while (ok) {
+      if (Accept('+')) lhs = Emit(OpCode::ADD, lhs, Term());
+      else if (Accept('-')) lhs = Emit(OpCode::SUB, lhs, Term());
+      else break;
+    }
+    return lhs;
+  }
+
+  /*--- term := unary (('*'|'/') unary)* ---*/
+  unsigned long Term() {
+    auto lhs = Unary();
+    while (ok) {
+      if (Accept('*')) lhs = Emit(OpCode::MUL, lhs, Unary());
+      else if (Accept('/')) lhs = Emit(OpCode::DIV, lhs, Unary());
+      else break;
+    }
+    return lhs;
+  }
+
+  /*--- unary := ('-'|'+') unary | power, power := primary ('^' unary)?, i.e. -a^b = -(a^b) and a^b^c = a^(b^c). ---*/
+  unsigned long Unary() {
+    if (Accept('-')) return Emit(OpCode::NEG, Unary());
+    if (Accept('+')) return Unary();
+    const auto base = Primary();
+    if (ok && Accept('^')) return Emit(OpCode::POW, base, Unary());
+    return base;
+  }
+
+  /*--- primary := number | function '(' args ')' | symbol | '(' expr ')' ---*/
+  unsigned long Primary() {
+    if (!ok) return 0;
+    if (Accept('(')) {
+      const auto inner = Expression();
+      return Accept(')') ? inner : Fail();
+    }
+    SkipSpaces();
+    if (pos == str.size()) return Fail();
+
+    if (isdigit(str[pos]) || str[pos] == '.') {
+      char* end = nullptr;
+      const passivedouble value = strtod(str.c_str() + pos, &end);
+      pos = end - str.c_str();
+      return Emit(OpCode::CONSTANT, 0, 0, value);
+    }
+
+    const auto start = pos;
+    while (pos < str.size() && !IsOperator(str[pos])) ++pos;
+    const auto name = str.substr(start, pos - start);
+    if (name.empty()) return Fail();
+
+    static const map<string, OpCode> unaryFunctions = {
+      {"sqrt", OpCode::SQRT}, {"exp", OpCode::EXP}, {"log", OpCode::LOG}, {"log10", OpCode::LOG10},
+      {"sin", OpCode::SIN}, {"cos", OpCode::COS}, {"tan", OpCode::TAN}, {"asin", OpCode::ASIN},
+      {"acos", OpCode::ACOS}, {"atan", OpCode::ATAN}, {"sinh", OpCode::SINH}, {"cosh", OpCode::COSH},
+      {"tanh", OpCode::TANH}, {"abs", OpCode::ABS}};
+    static const map<string, OpCode> binaryFunctions = {
+      {"pow", OpCode::POW}, {"min", OpCode::MIN}, {"max", OpCode::MAX}};
+
+    const auto symbol = find(symbols.begin(), symbols.end(), name);
+    if (symbol != symbols.end()) return Emit(OpCode::SYMBOL, symbol - symbols.begin());
+
+    if (!Accept('(')) return Fail();
+    const auto unary = unaryFunctions.find(name);
+    if (unary != unaryFunctions.end()) {
+      const auto arg = Expression();
+      return Accept(')') ? Emit(unary->second, arg) : Fail();
+    }
+    const auto binary = binaryFunctions.find(name);
+    if (binary != binaryFunctions.end()) {
+      const auto arg1 = Expression();
+      if (!Accept(',')) return Fail();
+      const auto arg2 = Expression();
+      return Accept(')') ? Emit(binary->second, arg1, arg2) : Fail();
+    }
+    return Fail();
+  }
+};
+
+bool CCompiledExpression::Compile(const string& expression, const vector<string>& symbols) {
+  code.clear();
+  Parser parser(expression, symbols, code);
+  parser.Expression();
+  parser.SkipSpaces();
+  if (!parser.ok || parser.pos != expression.size() || code.empty()) code.clear();
+  return Ready();
+}
+
+const su2double* CCompiledExpression::Eval(unsigned long nPoints, const su2double* inputs, su2double* work) const {
+
+  for (auto iInstr = 0ul; iInstr < code.size(); ++iInstr) {
+    const auto& instr = code[iInstr];
+    su2double* res = work + iInstr * BLOCK_SIZE;
+    const su2double* a = work + instr.a * BLOCK_SIZE;
+    const su2double* b = work + instr.b * BLOCK_SIZE;
+
+    switch (instr.op) {
+      case OpCode::CONSTANT: for (auto i = 0ul; i < nPoints; ++i) res[i] = instr.value; break;
+      case OpCode::SYMBOL: copy_n(inputs + instr.a * BLOCK_SIZE, nPoints, res); break;
+      case OpCode::NEG: for (auto i = 0ul; i < nPoints; ++i) res[i] = -a[i]; break;
+      case OpCode::ADD: for (auto i = 0ul; i < nPoints; ++i) res[i] = a[i] + b[i]; break;
+      case OpCode::SUB: for (auto i = 0ul; i < nPoints; ++i) res[i] = a[i] - b[i]; break;
+      case OpCode::MUL: for (auto i = 0ul; i < nPoints; ++i) res[i] = a[i] * b[i]; break;
+      case OpCode::DIV: for (auto i = 0ul; i < nPoints; ++i) res[i] = a[i] / b[i]; break;
+      case OpCode::POW: for (auto i = 0ul; i < nPoints; ++i) res[i] = pow(a[i], b[i]); break;
+      case OpCode::MIN: for (auto i = 0ul; i < nPoints; ++i) res[i] = (b[i] < a[i]) ? b[i] : a[i]; break;
+      case OpCode::MAX: for (auto i = 0ul; i < nPoints; ++i) res[i] = (a[i] < b[i]) ? b[i] : a[i]; break;
+      case OpCode::SQRT: for (auto i = 0ul; i < nPoints; ++i) res[i] = sqrt(a[i]); break;
+      case OpCode::EXP: for (auto i = 0ul; i < nPoints; ++i) res[i] = exp(a[i]); break;
+      case OpCode::LOG: for (auto i = 0ul; i < nPoints; ++i) res[i] = log(a[i]); break;
+      case OpCode::LOG10: for (auto i = 0ul; i < nPoints; ++i) res[i] = log10(a[i]); break;
+      case OpCode::SIN: for (auto i = 0ul; i < nPoints; ++i) res[i] = sin(a[i]); break;
+      case OpCode::COS: for (auto i = 0ul; i < nPoints; ++i) res[i] = cos(a[i]); break;
+      case OpCode::TAN: for (auto i = 0ul; i < nPoints; ++i) res[i] = tan(a[i]); break;
+      case OpCode::ASIN: for (auto i = 0ul; i < nPoints; ++i) res[i] = asin(a[i]); break;
+      case OpCode::ACOS: for (auto i = 0ul; i < nPoints; ++i) res[i] = acos(a[i]); break;
+      case OpCode::ATAN: for (auto i = 0ul; i < nPoints; ++i) res[i] = atan(a[i]); break;
+      case OpCode::SINH: for (auto i = 0ul; i < nPoints; ++i) res[i] = sinh(a[i]); break;
+      case OpCode::COSH: for (auto i = 0ul; i < nPoints; ++i) res[i] = cosh(a[i]); break;
+      case OpCode::TANH: for (auto i = 0ul; i < nPoints; ++i) res[i] = tanh(a[i]); break;
+      case OpCode::ABS: for (auto i = 0ul; i < nPoints; ++i) res[i] = fabs(a[i]); break;
+    }
+  }
+  return work + (code.size() - 1) * BLOCK_SIZE;
+}
@@ -0,0 +1,305 @@
+/*!
+ * \file CTimeStatistics.cpp
+ * \brief Running (streaming) statistics and spectra of unsteady simulations.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CTimeStatistics.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+#include <complex>
+
+namespace {
+/*--- Identifies the files of the statistics ("SU2" + 1, the restart files use "SU2"). ---*/
+constexpr unsigned long StatisticsFileMarker = 535533;
+constexpr int nHeader = 5;
+}  // namespace
+
+CTimeStatistics::CTimeStatistics(unsigned long nPoint_, unsigned short nVar_, bool singlePrecision_)
+    : nPoint(nPoint_), nVar(nVar_), nMoment(nVar_ * (nVar_ + 1) / 2 + 2 * nVar_), singlePrecision(singlePrecision_) {
+  if (nVar > MAX_VARS) SU2_MPI::Error("Too many variables for the time statistics.", CURRENT_FUNCTION);
+  means.resize(nPoint * nVar, 0.0);
+  if (singlePrecision) momentsFloat.resize(nPoint * nMoment, 0.0f);
+  else momentsDouble.resize(nPoint * nMoment, 0.0);
+}
+
+template <class T>
+void CTimeStatistics::UpdateImpl(passivedouble* mean, T* moments, const passivedouble* values) const {
+
+  /*--- Count including the new sample. ---*/
+  const passivedouble n = nSamples + 1;
+
+  passivedouble delta[MAX_VARS];
+  for (auto iVar = 0u; iVar < nVar; ++iVar) delta[iVar] = values[iVar] - mean[iVar];
+
+  for (auto iVar = 0u; iVar < nVar; ++iVar) {
+    const passivedouble M2 = moments[CoMoment(iVar, iVar)];
+    const passivedouble M3 = moments[Moment3(iVar)];
+    const passivedouble deltaN = delta[iVar] / n;
+    const passivedouble term = delta[iVar] * deltaN * (n - 1);
+
+    /*--- The higher moments use the old lower moments. ---*/
+    moments[Moment4(iVar)] += term * deltaN * deltaN * (n * n - 3 * n + 3) + 6 * deltaN * deltaN * M2 - 4 * deltaN * M3;
+    moments[Moment3(iVar)] += term * deltaN * (n - 2) - 3 * deltaN * M2;
+
+    for (auto jVar = iVar; jVar < nVar; ++jVar) {
+      moments[CoMoment(iVar, jVar)] += (n - 1) / n * delta[iVar] * delta[jVar];
+    }
+    mean[iVar] += deltaN;
+  }
+}
+
+void CTimeStatistics::Update(unsigned long iPoint, const passivedouble* values) {
+  if (singlePrecision) UpdateImpl(&means[iPoint * nVar], &momentsFloat[iPoint * nMoment], values);
+  else UpdateImpl(&means[iPoint * nVar], &momentsDouble[iPoint * nMoment], values);
+}
+
+passivedouble CTimeStatistics::GetCovariance(unsigned long iPoint, unsigned short iVar, unsigned short jVar) const {
+  if (nSamples == 0) return 0.0;
+  if (jVar < iVar) std::swap(iVar, jVar);
+  return GetMoment(iPoint, CoMoment(iVar, jVar)) / nSamples;
+}
+
+passivedouble CTimeStatistics::GetSkewness(unsigned long iPoint, unsigned short iVar) const {
+  const passivedouble M2 = GetMoment(iPoint, CoMoment(iVar, iVar));
+  if (M2 <= 0) return 0.0;
+  return sqrt(passivedouble(nSamples)) * GetMoment(iPoint, Moment3(iVar)) / pow(M2, 1.5);
+}
+
+passivedouble CTimeStatistics::GetFlatness(unsigned long iPoint, unsigned short iVar) const {
+  const passivedouble M2 = GetMoment(iPoint, CoMoment(iVar, iVar));
+  if (M2 <= 0) return 0.0;
+  return nSamples * GetMoment(iPoint, Moment4(iVar)) / (M2 * M2);
+}
+
+void CTimeStatistics::Write(const string& fileName, const CGeometry* geometry,
+                            const vector<passivedouble>& extra) const {
+
+  /*--- The file has a header, the moments of each point in the order of the global indices, and the extra data. ---*/
+
+  const auto nStat = nVar + nMoment;
+  const auto& order = geometry->GetDomainPoints_GlobalOrder();
+  vector<passivedouble> data(order.size() * nStat);
+  for (auto k = 0ul; k < order.size(); ++k) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) data[k * nStat + iVar] = GetMean(order[k], iVar);
+    for (auto iMoment = 0ul; iMoment < nMoment; ++iMoment)
+      data[k * nStat + nVar + iMoment] = GetMoment(order[k], iMoment);
+  }
+
+  const unsigned long nPointGlobal = geometry->GetGlobal_nPointDomain();
+  const unsigned long header[nHeader] = {StatisticsFileMarker, nVar, nPointGlobal, nSamples, extra.size()};
+
+#ifdef HAVE_MPI
+  const MPI_Offset extraOffset = sizeof(header) + nPointGlobal * nStat * sizeof(passivedouble);
+
+  MPI_File fhw;
+  if (MPI_File_open(SU2_MPI::GetComm(), fileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw))
+    SU2_MPI::Error("Unable to open the statistics file " + fileName, CURRENT_FUNCTION);
+  MPI_File_set_size(fhw, 0);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+    MPI_File_write_at(fhw, extraOffset, extra.data(), extra.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+  }
+
+  /*--- Consecutive global indices are merged into one block. ---*/
+  vector<int> blocklen;
+  vector<MPI_Aint> displace;
+  unsigned long nextGlobal = 0;
+  for (const auto iPoint : order) {
+    const auto iPoint_Global = geometry->nodes->GetGlobalIndex(iPoint);
+    if (!blocklen.empty() && iPoint_Global == nextGlobal) {
+      blocklen.back() += nStat;
+    } else {
+      blocklen.push_back(nStat);
+      displace.push_back(iPoint_Global * nStat * sizeof(passivedouble));
+    }
+    nextGlobal = iPoint_Global + 1;
+  }
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(blocklen.size(), blocklen.data(), displace.data(), MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+  MPI_File_set_view(fhw, sizeof(header), MPI_DOUBLE, filetype, (char*)"native", MPI_INFO_NULL);
+  MPI_File_write_all(fhw, data.data(), data.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+  MPI_Type_free(&filetype);
+  MPI_File_close(&fhw);
+#else
+  FILE* fhw = fopen(fileName.c_str(), "wb");
+  if (!fhw) SU2_MPI::Error("Unable to open the statistics file " + fileName, CURRENT_FUNCTION);
+  fwrite(header, sizeof(unsigned long), nHeader, fhw);
+  fwrite(data.data(), sizeof(passivedouble), data.size(), fhw);
+  fwrite(extra.data(), sizeof(passivedouble), extra.size(), fhw);
+  fclose(fhw);
+#endif
+}
+
+bool CTimeStatistics::Read(const string& fileName, const CGeometry* geometry, vector<passivedouble>& extra) {
+
+  const auto nStat = nVar + nMoment;
+  const auto& order = geometry->GetDomainPoints_GlobalOrder();
+  const unsigned long nPointGlobal = geometry->GetGlobal_nPointDomain();
+  vector<passivedouble> data(order.size() * nStat);
+  unsigned long header[nHeader] = {0};
+
+#ifdef HAVE_MPI
+  MPI_File fhw;
+  if (MPI_File_open(SU2_MPI::GetComm(), fileName.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw)) return false;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    MPI_File_read_at(fhw, 0, header, sizeof(header), MPI_BYTE, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(header, nHeader, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+#else
+  FILE* fhw = fopen(fileName.c_str(), "rb");
+  if (!fhw) return false;
+  if (fread(header, sizeof(unsigned long), nHeader, fhw) != nHeader)
+    SU2_MPI::Error("Error reading the statistics file " + fileName, CURRENT_FUNCTION);
+#endif
+
+  if (header[0] != StatisticsFileMarker || header[1] != nVar || header[2] != nPointGlobal) {
+    SU2_MPI::Error("The statistics file " + fileName + " does not match the mesh or the problem.", CURRENT_FUNCTION);
+  }
+  nSamples = header[3];
+  extra.resize(header[4]);
+
+#ifdef HAVE_MPI
+  const MPI_Offset extraOffset = sizeof(header) + nPointGlobal * nStat * sizeof(passivedouble);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    MPI_File_read_at(fhw, extraOffset, extra.data(), extra.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(extra.data(), extra.size(), MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+  vector<int> blocklen;
+  vector<MPI_Aint> displace;
+  unsigned long nextGlobal = 0;
+  for (const auto iPoint : order) {
+    const auto iPoint_Global = geometry->nodes->GetGlobalIndex(iPoint);
+    if (!blocklen.empty() && iPoint_Global == nextGlobal) {
+      blocklen.back() += nStat;
+    } else {
+      blocklen.push_back(nStat);
+      displace.push_back(iPoint_Global * nStat * sizeof(passivedouble));
+    }
+    nextGlobal = iPoint_Global + 1;
+  }
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(blocklen.size(), blocklen.data(), displace.data(), MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+  MPI_File_set_view(fhw, sizeof(header), MPI_DOUBLE, filetype, (char*)"native", MPI_INFO_NULL);
+  MPI_File_read_all(fhw, data.data(), data.size(), MPI_DOUBLE, MPI_STATUS_IGNORE);
+  MPI_Type_free(&filetype);
+  MPI_File_close(&fhw);
+#else
+  if (fread(data.data(), sizeof(passivedouble), data.size(), fhw) != data.size() ||
+      fread(extra.data(), sizeof(passivedouble), extra.size(), fhw) != extra.size())
+    SU2_MPI::Error("Error reading the statistics file " + fileName, CURRENT_FUNCTION);
+  fclose(fhw);
+#endif
+
+  for (auto k = 0ul; k < order.size(); ++k) {
+    const auto iPoint = order[k];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) means[iPoint * nVar + iVar] = data[k * nStat + iVar];
+    for (auto iMoment = 0ul; iMoment < nMoment; ++iMoment) {
+      const auto value = data[k * nStat + nVar + iMoment];
+      if (singlePrecision) momentsFloat[iPoint * nMoment + iMoment] = value;
+      else momentsDouble[iPoint * nMoment + iMoment] = value;
+    }
+  }
+  return true;
+}
+
+CStreamingSpectrum::CStreamingSpectrum(unsigned long windowSize_) : windowSize(windowSize_) {
+  samples.reserve(windowSize);
+  psdSum.resize(windowSize / 2 + 1, 0.0);
+}
+
+void CStreamingSpectrum::AddSample(passivedouble value) {
+
+  samples.push_back(value);
+  if (samples.size() < windowSize) return;
+
+  /*--- Hann window of the fluctuations (the mean of the window is removed) and radix-2 FFT. ---*/
+
+  passivedouble mean = 0.0;
+  for (const auto x : samples) mean += x;
+  mean /= windowSize;
+
+  const passivedouble pi = PI_NUMBER;
+  vector<std::complex<passivedouble> > X(windowSize);
+  for (auto i = 0ul; i < windowSize; ++i) {
+    X[i] = (samples[i] - mean) * 0.5 * (1 - cos(2 * pi * i / windowSize));
+  }
+
+  for (auto i = 1ul, j = 0ul; i < windowSize; ++i) {
+    auto bit = windowSize >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(X[i], X[j]);
+  }
+  for (auto len = 2ul; len <= windowSize; len <<= 1) {
+    const auto w = std::polar(passivedouble(1), -2 * pi / len);
+    for (auto i = 0ul; i < windowSize; i += len) {
+      std::complex<passivedouble> wk(1);
+      for (auto k = 0ul; k < len / 2; ++k) {
+        const auto a = X[i + k];
+        const auto b = X[i + k + len / 2] * wk;
+        X[i + k] = a + b;
+        X[i + k + len / 2] = a - b;
+        wk *= w;
+      }
+    }
+  }
+
+  for (auto k = 0ul; k < psdSum.size(); ++k) psdSum[k] += std::norm(X[k]);
+  ++nWindows;
+  samples.clear();
+}
+
+vector<passivedouble> CStreamingSpectrum::GetPSD(passivedouble timeStep) const {
+
+  /*--- One-sided density, normalized by the energy of the (Hann) window, sum w^2 = 3N/8. ---*/
+
+  vector<passivedouble> psd(psdSum.size(), 0.0);
+  if (nWindows == 0) return psd;
+
+  const passivedouble scale = timeStep / (0.375 * windowSize * nWindows);
+  for (auto k = 0ul; k < psd.size(); ++k) {
+    const bool edge = (k == 0) || (k == psd.size() - 1);
+    psd[k] = (edge ? 1 : 2) * scale * psdSum[k];
+  }
+  return psd;
+}
+
+void CStreamingSpectrum::Pack(vector<passivedouble>& state) const {
+  state.push_back(nWindows);
+  state.push_back(samples.size());
+  state.insert(state.end(), psdSum.begin(), psdSum.end());
+  state.insert(state.end(), samples.begin(), samples.end());
+}
+
+void CStreamingSpectrum::Unpack(const passivedouble*& state) {
+  nWindows = static_cast<unsigned long>(*(state++));
+  const auto nSamples = static_cast<unsigned long>(*(state++));
+  for (auto& value : psdSum) value = *(state++);
+  samples.assign(state, state + nSamples);
+  state += nSamples;
+}
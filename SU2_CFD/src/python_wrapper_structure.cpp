@@ -103,6 +103,50 @@ void CDriver::SetFarFieldAoS(const passivedouble AoS) {
   solver_container[selected_zone][INST_0][MESH_0][FLOW_SOL]->UpdateFarfieldVelocity(config_container[selected_zone]);
 }
 
+void CDriver::SetFarFieldMach(const passivedouble Mach) {
+  auto* config = config_container[selected_zone];
+
+  if (config->GetKind_Regime() != ENUM_REGIME::COMPRESSIBLE || config->GetNEMOProblem() || Mach <= 0.0) {
+    SU2_MPI::Error("The freestream Mach number can only be set (to a positive value) for compressible flows.",
+                   CURRENT_FUNCTION);
+  }
+
+  /*--- Scale the freestream velocity (shared by the config and the flow solvers), the static conditions are kept. ---*/
+
+  const auto nDim = geometry_container[selected_zone][INST_0][MESH_0]->GetnDim();
+  const su2double ratio = Mach / config->GetMach();
+  auto* velocity = config->GetVelocity_FreeStreamND();
+  const su2double kineticEnergy = 0.5 * GeometryToolbox::SquaredNorm(nDim, velocity);
+
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    velocity[iDim] *= ratio;
+    config->GetVelocity_FreeStream()[iDim] *= ratio;
+  }
+  config->SetModVel_FreeStreamND(config->GetModVel_FreeStreamND() * ratio);
+  config->SetEnergy_FreeStreamND(config->GetEnergy_FreeStreamND() + kineticEnergy * (ratio * ratio - 1.0));
+  config->SetReynolds(config->GetReynolds() * ratio);
+  config->SetMach(Mach);
+
+  for (auto iMesh = 0u; iMesh <= config->GetnMGLevels(); iMesh++) {
+    auto** solvers = solver_container[selected_zone][INST_0][iMesh];
+    solvers[FLOW_SOL]->UpdateFreestreamMach(config);
+    if (solvers[TURB_SOL] != nullptr) solvers[TURB_SOL]->UpdateFarfieldVelocity(config);
+  }
+}
+
+void CDriver::ResetConvergence() {
+  for (auto iZone = 0u; iZone < nZone; iZone++) {
+    for (auto iMesh = 0u; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+      for (auto iSol = 0u; iSol < MAX_SOLS; iSol++) {
+        auto* solver = solver_container[iZone][INST_0][iMesh][iSol];
+        if (solver != nullptr) solver->ResetNonlinearIterations(config_container[iZone], iMesh);
+      }
+    }
+  }
+  TimeIter = 0;
+  StopCalc = false;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /* Functions related to simulation control, high level functions (reset convergence, set initial mesh, etc.)   */
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1070,8 +1070,8 @@ void CAdjEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
 
   CNumerics* numerics = numerics_container[CONV_TERM];
 
-  su2double Project_Grad_i, Project_Grad_j, *Limiter_i = nullptr,
-  *Limiter_j = nullptr, *Psi_i = nullptr, *Psi_j = nullptr, *V_i, *V_j;
+  su2double Project_Grad_i, Project_Grad_j, *Psi_i = nullptr, *Psi_j = nullptr, *V_i, *V_j;
+  const su2limiterfloat *Limiter_i = nullptr, *Limiter_j = nullptr;
   unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
   unsigned short iDim, iVar;
 
@@ -3835,31 +3835,21 @@ void CAdjEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   /*--- Load data from the restart into correct containers. ---*/
 
   int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
   unsigned long iPoint_Global_Local = 0;
   unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
 
-    iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    nodes->SetSolution(iPoint_Local,Solution);
+    iPoint_Global_Local++;
 
-    if (iPoint_Local > -1) {
-
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
-
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-
-      nodes->SetSolution(iPoint_Local,Solution);
-      iPoint_Global_Local++;
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
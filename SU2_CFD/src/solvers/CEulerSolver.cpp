@@ -34,6 +34,7 @@
 #include "../../include/fluid/CPengRobinson.hpp"
 #include "../../include/fluid/CDataDrivenFluid.hpp"
 #include "../../include/fluid/CCoolProp.hpp"
+#include "../../include/fluid/CFluidTableGenerator.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
 #include "../../include/output/CTurboOutput.hpp"
@@ -59,7 +60,6 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   const auto nZone = geometry->GetnZone();
   const bool restart = (config->GetRestart() || config->GetRestart_Flow());
   const bool rans = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
-  const auto direct_diff = config->GetDirectDiff();
   const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                          (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
   const bool time_stepping = (config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING);
@@ -162,7 +162,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
   }
   else {
     if (rank == MASTER_NODE)
@@ -246,26 +246,28 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch(direct_diff) {
-    case NO_DERIVATIVE:
-      /*--- Default ---*/
-      break;
-    case D_DENSITY:
-      SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-      break;
-    case D_PRESSURE:
-      SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Already done in postprocessing of config ---*/
-      break;
-    default:
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE:
+        /*--- Default ---*/
+        break;
+      case D_DENSITY:
+        SU2_TYPE::SetDerivative(Density_Inf, iDir, 1.0);
+        break;
+      case D_PRESSURE:
+        SU2_TYPE::SetDerivative(Pressure_Inf, iDir, 1.0);
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, iDir, 1.0);
+        break;
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Already done in postprocessing of config ---*/
+        break;
+      default:
+        break;
+    }
   }
 
   SetReferenceValues(*config);
@@ -342,6 +344,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
       cout << "Warning. The original solution contains " << counter_global << " points that are not physical." << endl;
   }
 
+  /*--- Points and forces of the body force actuator disks. ---*/
+
+  if (config->GetActDisk_BodyForce()) SetActDisk_BodyForce(geometry, config, iMesh);
+
   /*--- Initial comms. ---*/
 
   CommunicateInitialState(geometry, config);
@@ -357,6 +363,11 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
 
 CEulerSolver::~CEulerSolver() {
 
+  if (TurboPerfPending) {
+    SU2_MPI::Status status;
+    SU2_MPI::Wait(&TurboPerfRequest, &status);
+  }
+
   for(auto& model : FluidModel) delete model;
 }
 
@@ -377,6 +388,9 @@ void CEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_containe
     SU2_MPI::Error("The numerical scheme + gas model in use do not "
                    "support vectorization.", CURRENT_FUNCTION);
 
+  /*--- Optional, the boundaries fall back to the non-vectorized numerics. ---*/
+  boundaryNumerics = CNumericsSIMD::CreateBoundaryNumerics(*config, nDim, MGLevel);
+
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
@@ -875,6 +889,8 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
 
     case DATADRIVEN_FLUID:
 
+      if (config->GetLUT_Generate() && iMesh == MESH_0) CFluidTableGenerator::GenerateFromConfig(config);
+
       auxFluidModel = new CDataDrivenFluid(config);
 
       break;
@@ -1074,9 +1090,6 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
-  delete auxFluidModel;
-
   /*--- Create one final fluid model object per OpenMP thread to be able to use them in parallel.
    *    GetFluidModel() should be used to automatically access the "right" object of each thread. ---*/
 
@@ -1129,6 +1142,10 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
   }
   END_SU2_OMP_PARALLEL
 
+  /*--- Auxilary (dimensional) FluidModel no longer needed, it is deleted after creating the final
+   *    ones so that they can reuse its data (e.g. binary lookup tables in shared memory). ---*/
+  delete auxFluidModel;
+
   Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) Energy_FreeStreamND += Tke_FreeStreamND;
@@ -1575,18 +1592,22 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   /*--- Set the primitive variables ---*/
 
-  ompMasterAssignBarrier(ErrorCounter, 0);
+  ompMasterAssignBarrier(ErrorCounter, 0, TransportCacheHits, 0);
 
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::FLUID_MODEL);
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::FLUID_MODEL);
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
   { /*--- Ops that are not OpenMP parallel go in this block. ---*/
 
     if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
-      unsigned long tmp = ErrorCounter;
-      SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      unsigned long tmp[] = {ErrorCounter, TransportCacheHits}, counters[2] = {0};
+      SU2_MPI::Allreduce(tmp, counters, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      ErrorCounter = counters[0];
       config->SetNonphysical_Points(ErrorCounter);
+      config->SetTransport_Cache_Hits(counters[1]);
     }
 
     /*--- Update the angle of attack at the far-field for fixed CL calculations (only direct problem). ---*/
@@ -1656,20 +1677,10 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
-
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
-
-    /*--- Limiter computation ---*/
+    /*--- Gradient and limiter computation for MUSCL reconstruction. ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method_Recon(), true,
+                                  limiter && !van_albada);
   }
 }
 
@@ -1681,17 +1692,46 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp).
+   *    The fluid model is evaluated for blocks of points, the threads share the work by blocks. ---*/
 
-    /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+  constexpr auto blockSize = CFluidModel::BlockSize;
+  const auto nBlock = roundUpDiv(nPoint, blockSize);
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+  /*--- Models that evaluate all points at once (e.g. on an offload device) get the density and
+   *    static energy of all points, the blocks then retrieve their states from the batch. ---*/
+
+  const bool batch = GetFluidModel()->HasBatchEvaluation();
+
+  if (batch) {
+    SU2_OMP_MASTER {
+      BatchDensity.resize(nPoint);
+      BatchEnergy.resize(nPoint);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      nodes->SetVelocity(iPoint);
+      BatchDensity[iPoint] = nodes->GetDensity(iPoint);
+      BatchEnergy[iPoint] = nodes->GetEnergy(iPoint) - 0.5 * nodes->GetVelocity2(iPoint);
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_MASTER
+    GetFluidModel()->SetTDStateBatch_rhoe(nPoint, BatchDensity.data(), BatchEnergy.data());
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
 
-    /* Check for non-realizable states for reporting. */
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, blockSize))
+  for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
+    const auto iPoint = iBlock * blockSize;
 
-    if (!physical) nonPhysicalPoints++;
+    /*--- Check for non-realizable states for reporting. ---*/
+
+    nonPhysicalPoints += nodes->SetPrimVarBlock(iPoint, min(iPoint + blockSize, nPoint), GetFluidModel(), batch);
   }
   END_SU2_OMP_FOR
 
@@ -1763,8 +1803,25 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                          (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool low_mach_corr = config->Low_Mach_Correction();
 
-  /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  /*--- Use vectorization if the scheme supports it. The vectorized HLLC, AUSM, and SLAU schemes use approximate
+   * Jacobians (the scalar HLLC Jacobian is exact), and the vectorized Roe-Turkel scheme has an entropy fix that
+   * the scalar one does not, they are only used if requested (USE_VECTORIZATION). ---*/
+  bool vectorized_scheme = false;
+  switch (config->GetKind_Upwind_Flow()) {
+    case UPWIND::ROE:
+      vectorized_scheme = true;
+      break;
+    case UPWIND::HLLC: case UPWIND::TURKEL:
+      vectorized_scheme = config->GetUseVectorization();
+      break;
+    case UPWIND::AUSMPLUSUP: case UPWIND::AUSMPLUSUP2:
+    case UPWIND::SLAU: case UPWIND::SLAU2:
+      vectorized_scheme = config->GetUseVectorization() && !config->GetUse_Accurate_Jacobians();
+      break;
+    default:
+      break;
+  }
+  if (vectorized_scheme && ideal_gas && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
@@ -1813,6 +1870,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     auto iPoint = geometry->edges->GetNode(iEdge,0);
     auto jPoint = geometry->edges->GetNode(iEdge,1);
 
+    if (FrozenEdge(iPoint, jPoint)) continue;
+
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     auto Coord_i = geometry->nodes->GetCoord(iPoint);
@@ -2077,6 +2136,23 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     AD::EndNoSharedReading();
   }
 
+  if (config->GetActDisk_BodyForce()) {
+
+    /*--- Body force actuator disks, the force at each point was computed once (SetActDisk_BodyForce). ---*/
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto k = 0ul; k < ActDiskBF_Point.size(); k++) {
+      const auto iPoint = ActDiskBF_Point[k];
+
+      su2double residual[MAXNVAR] = {0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        residual[iDim+1] = -ActDiskBF_Force(k, iDim);
+        residual[nDim+1] -= ActDiskBF_Force(k, iDim) * nodes->GetVelocity(iPoint, iDim);
+      }
+      LinSysRes.AddBlock(iPoint, residual);
+    }
+    END_SU2_OMP_FOR
+  }
+
   if (rotating_frame) {
 
     /*--- Include the residual contribution from GCL due to the static
@@ -2250,9 +2326,8 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if ( VerificationSolution ) {
     if ( VerificationSolution->IsManufacturedSolution() ) {
 
-      /*--- Get the physical time. ---*/
-      su2double time = 0.0;
-      if (config->GetTime_Marching() != TIME_MARCHING::STEADY) time = config->GetPhysicalTime();
+      /*--- Get the MMS source terms (computed once for steady problems). ---*/
+      const auto& sourceMan = GetVerificationSourceTerms(geometry, config);
 
       /*--- Loop over points ---*/
       SU2_OMP_FOR_DYN(omp_chunk_size)
@@ -2261,16 +2336,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
         /*--- Get control volume size. ---*/
         su2double Volume = geometry->nodes->GetVolume(iPoint);
 
-        /*--- Get the current point coordinates. ---*/
-        const su2double *coor = geometry->nodes->GetCoord(iPoint);
-
-        /*--- Get the MMS source term. ---*/
-        vector<su2double> sourceMan(nVar,0.0);
-        VerificationSolution->GetMMSSourceTerm(coor, time, sourceMan.data());
-
         /*--- Compute the residual for this control volume and subtract. ---*/
         for (iVar = 0; iVar < nVar; iVar++) {
-          LinSysRes(iPoint,iVar) -= sourceMan[iVar]*Volume;
+          LinSysRes(iPoint,iVar) -= sourceMan(iPoint,iVar)*Volume;
         }
       }
       END_SU2_OMP_FOR
@@ -2347,17 +2415,9 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *co
   }
   END_SU2_OMP_FOR
 
-  /*--- Correct the Laplacian across any periodic boundaries. ---*/
-
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-  }
-
-  /*--- MPI parallelization ---*/
+  /*--- Correct the Laplacian across any periodic boundaries and MPI parallelization. ---*/
 
-  InitiateComms(geometry, config, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
+  PeriodicAndHaloComms(geometry, config, PERIODIC_LAPLACIAN, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
 
 }
 
@@ -4101,6 +4161,170 @@ void CEulerSolver::ReadActDisk_InputFile(CGeometry *geometry, CSolver **solver_c
   }
 }
 
+void CEulerSolver::SetActDisk_BodyForce(const CGeometry *geometry, const CConfig *config, unsigned short iMesh) {
+
+  struct ActDiskData {
+    su2double center[MAXNDIM] = {0.0}, axis[MAXNDIM] = {0.0}, radius = 0.0, advRatio = 0.0;
+    vector<su2double> rad, Fa, Ft, Fr;
+  };
+  vector<ActDiskData> disks;
+
+  /*--- Read all the disks of the input file (same format as for VARIABLE_LOAD), the marker names are not used. ---*/
+
+  ifstream ActDisk_file(config->GetActDisk_FileName());
+  if (ActDisk_file.fail()) SU2_MPI::Error("Unable to open Actuator Disk Input File", CURRENT_FUNCTION);
+
+  /*--- Text after the "=" of the next line. ---*/
+  auto NextValue = [&ActDisk_file]() {
+    string text_line;
+    getline(ActDisk_file, text_line);
+    const auto position = text_line.find('=');
+    return (position == string::npos) ? string() : text_line.substr(position + 1);
+  };
+
+  const su2double Dens_FreeStream = config->GetDensity_FreeStream();
+  const su2double Vel_FreeStream = GeometryToolbox::Norm(nDim, config->GetVelocity_FreeStream());
+
+  string text_line;
+  while (getline(ActDisk_file, text_line)) {
+    if (text_line.find("MARKER_ACTDISK=") == string::npos) continue;
+
+    ActDiskData disk;
+    istringstream C_value(NextValue());
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) C_value >> disk.center[iDim];
+    istringstream axis_value(NextValue());
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) axis_value >> disk.axis[iDim];
+    istringstream R_value(NextValue());
+    R_value >> disk.radius;
+    istringstream J_value(NextValue());
+    J_value >> disk.advRatio;
+    unsigned long nRow = 0;
+    istringstream row_value(NextValue());
+    row_value >> nRow;
+
+    const su2double axisNorm = GeometryToolbox::Norm(nDim, disk.axis);
+    if (nRow < 2 || disk.radius <= 0.0 || disk.advRatio <= 0.0 || axisNorm == 0.0) {
+      SU2_MPI::Error("Invalid actuator disk " + to_string(disks.size()) + " in the actuator disk input file.",
+                     CURRENT_FUNCTION);
+    }
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) disk.axis[iDim] /= axisNorm;
+
+    /*--- Non-dimensional radius, and the thrust, power, and radial force coefficients. ---*/
+    vector<su2double> dCt(nRow), dCp(nRow), dCr(nRow);
+    disk.rad.resize(nRow);
+    getline(ActDisk_file, text_line);
+    for (auto iRow = 0ul; iRow < nRow; iRow++) {
+      getline(ActDisk_file, text_line);
+      istringstream row_val_value(text_line);
+      row_val_value >> disk.rad[iRow] >> dCt[iRow] >> dCp[iRow] >> dCr[iRow];
+    }
+
+    /*--- Axial, tangential, and radial forces per unit area, as in ReadActDisk_InputFile (at the center of the
+     * disk the axial force is extrapolated and the other forces are zero). ---*/
+    const su2double J = disk.advRatio;
+    const su2double scale = 2 * Dens_FreeStream * pow(Vel_FreeStream, 2) / config->GetPressure_Ref();
+    disk.Fa.resize(nRow);
+    disk.Ft.resize(nRow);
+    disk.Fr.resize(nRow);
+    for (auto iRow = 0ul; iRow < nRow; iRow++) {
+      const su2double r = disk.rad[iRow];
+      if (r == 0.0) {
+        disk.Fa[iRow] = scale / (pow(J, 2) * PI_NUMBER) * (dCt[1] - dCt[0]) / disk.rad[1];
+        disk.Ft[iRow] = 0.0;
+        disk.Fr[iRow] = 0.0;
+      } else {
+        disk.Fa[iRow] = scale * dCt[iRow] / (pow(J, 2) * PI_NUMBER * r);
+        disk.Ft[iRow] = scale * dCp[iRow] / pow(J * PI_NUMBER * r, 2);
+        disk.Fr[iRow] = scale * dCr[iRow] / (pow(J, 2) * PI_NUMBER * r);
+      }
+    }
+    disks.push_back(disk);
+  }
+
+  /*--- Find the points inside each disk (a cylinder with the thickness of the disk), and compute their force.
+   * The loads per unit area are spread uniformly over the thickness, and interpolated linearly in the radius. ---*/
+
+  const su2double thickness = config->GetActDisk_BodyForce_Thickness();
+  const auto nDisk = disks.size();
+  vector<unsigned long> nPointDisk(nDisk, 0);
+  vector<passivedouble> thrust(nDisk, 0.0);
+  vector<su2double> forces;
+
+  ActDiskBF_Point.clear();
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto* Coord = geometry->nodes->GetCoord(iPoint);
+    su2double force[MAXNDIM] = {0.0};
+    bool inside = false;
+
+    for (auto iDisk = 0ul; iDisk < nDisk; iDisk++) {
+      const auto& disk = disks[iDisk];
+
+      /*--- Axial and radial coordinates of the point. ---*/
+      su2double dist[MAXNDIM] = {0.0}, radial[MAXNDIM] = {0.0}, tangential[MAXNDIM] = {0.0};
+      GeometryToolbox::Distance(nDim, Coord, disk.center, dist);
+      const su2double axial = GeometryToolbox::DotProduct(nDim, dist, disk.axis);
+      if (fabs(axial) > 0.5 * thickness) continue;
+
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) radial[iDim] = dist[iDim] - axial * disk.axis[iDim];
+      const su2double r = GeometryToolbox::Norm(nDim, radial);
+      const su2double r_ = r / disk.radius;
+      if (r_ < disk.rad.front() || r_ > disk.rad.back()) continue;
+
+      /*--- Unit radial and tangential directions, the tangential force is along axis x radial. ---*/
+      if (r > 0.0) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) radial[iDim] /= r;
+        if (nDim == 3) GeometryToolbox::CrossProduct(disk.axis, radial, tangential);
+      }
+
+      auto iRow = 1ul;
+      while (iRow < disk.rad.size() - 1 && r_ > disk.rad[iRow]) ++iRow;
+      const su2double h = (r_ - disk.rad[iRow - 1]) / (disk.rad[iRow] - disk.rad[iRow - 1]);
+      auto Interpolate = [&](const vector<su2double>& F) { return F[iRow - 1] + h * (F[iRow] - F[iRow - 1]); };
+      const su2double Fa = Interpolate(disk.Fa), Ft = Interpolate(disk.Ft), Fr = Interpolate(disk.Fr);
+
+      const su2double weight = geometry->nodes->GetVolume(iPoint) / thickness;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        force[iDim] += weight * (Fa * disk.axis[iDim] + Ft * tangential[iDim] + Fr * radial[iDim]);
+      }
+      thrust[iDisk] += SU2_TYPE::GetValue(weight * Fa);
+      nPointDisk[iDisk]++;
+      inside = true;
+    }
+
+    if (inside) {
+      ActDiskBF_Point.push_back(iPoint);
+      forces.insert(forces.end(), force, force + nDim);
+    }
+  }
+
+  ActDiskBF_Force.resize(ActDiskBF_Point.size(), nDim);
+  for (auto k = 0ul; k < ActDiskBF_Point.size(); k++) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) ActDiskBF_Force(k, iDim) = forces[k * nDim + iDim];
+  }
+
+  /*--- Report the number of points and the total axial force of each disk. ---*/
+
+  if (iMesh != MESH_0) return;
+
+  vector<unsigned long> nPointDiskGlobal(nDisk);
+  vector<passivedouble> thrustGlobal(nDisk);
+  SU2_MPI::Allreduce(nPointDisk.data(), nPointDiskGlobal.data(), nDisk, MPI_UNSIGNED_LONG, MPI_SUM,
+                     SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(thrust.data(), thrustGlobal.data(), nDisk, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  for (auto iDisk = 0ul; iDisk < nDisk; iDisk++) {
+    cout << "Body force actuator disk " << iDisk << ": " << nPointDiskGlobal[iDisk]
+         << " points, non-dimensional axial force " << thrustGlobal[iDisk] << "." << endl;
+    if (nPointDiskGlobal[iDisk] == 0) {
+      cout << "WARNING: No points inside body force actuator disk " << iDisk
+           << ", the ACTDISK_BODY_FORCE_THICKNESS may be too small." << endl;
+    }
+  }
+}
+
 void CEulerSolver::SetActDisk_BEM_VLAD(CGeometry *geometry, CSolver **solver_container,
                                        CConfig *config, unsigned short iMesh, bool Output) {
 
@@ -4777,10 +5001,15 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   auto *Normal = new su2double[nDim];
 
-  /*--- Loop over all the vertices on this boundary marker ---*/
+  /*--- Loop over blocks of vertices on this boundary marker, with the vectorized boundary numerics the
+   * convective flux of each block is computed together once the farfield states of the block are set. ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  const unsigned long nVertex = geometry->nVertex[val_marker];
+  const unsigned long blockSize = boundaryNumerics ? static_cast<unsigned long>(Double::Size) : 1ul;
+
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
+  for (auto iBlock = 0ul; iBlock < roundUpDiv(nVertex, blockSize); iBlock++) {
+  for (iVertex = iBlock*blockSize; iVertex < min(nVertex, (iBlock+1)*blockSize); iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Allocate the value at the infinity ---*/
@@ -4934,29 +5163,30 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       V_infty[nDim+2] = Density;
       V_infty[nDim+3] = Energy + Pressure/Density;
 
+      /*--- Compute the convective residual using an upwind scheme (after the loop if vectorized) ---*/
 
+      if (!boundaryNumerics) {
 
-      /*--- Set various quantities in the numerics class ---*/
+        /*--- Set various quantities in the numerics class ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_infty);
+        conv_numerics->SetPrimitive(V_domain, V_infty);
 
-      if (dynamic_grid) {
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
-                                  geometry->nodes->GetGridVel(iPoint));
-      }
-
-      /*--- Compute the convective residual using an upwind scheme ---*/
+        if (dynamic_grid) {
+          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
+                                    geometry->nodes->GetGridVel(iPoint));
+        }
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
+        /*--- Update residual value ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Convective Jacobian contribution for implicit integration ---*/
+        /*--- Convective Jacobian contribution for implicit integration ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+      }
 
       /*--- Viscous residual contribution ---*/
 
@@ -5001,6 +5231,31 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
     }
   }
+
+  /*--- Vectorized convective flux of the block, the lanes of halo (or missing) vertices repeat a
+   * domain vertex of the block and are masked. ---*/
+
+  if (boundaryNumerics) {
+    const auto first = iBlock*blockSize;
+    auto firstDomain = first;
+    while ((firstDomain < min(nVertex, first+blockSize)) &&
+           !geometry->nodes->GetDomain(geometry->vertex[val_marker][firstDomain]->GetNode())) firstDomain++;
+    if (firstDomain == min(nVertex, first+blockSize)) continue;
+
+    Int blockVertex, blockPoint;
+    Double mask;
+    for (auto k = 0ul; k < Double::Size; k++) {
+      const auto jVertex = first + k;
+      const bool in = (jVertex < nVertex) &&
+                      geometry->nodes->GetDomain(geometry->vertex[val_marker][min(jVertex, nVertex-1)]->GetNode());
+      blockVertex[k] = in ? jVertex : firstDomain;
+      blockPoint[k] = geometry->vertex[val_marker][blockVertex[k]]->GetNode();
+      mask[k] = in;
+    }
+    boundaryNumerics->ComputeBoundaryFlux(blockVertex, blockPoint, val_marker, CharacPrimVar[val_marker], *config,
+                                          *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  }
   END_SU2_OMP_FOR
 
   /*--- Free locally allocated memory ---*/
@@ -5027,7 +5282,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -6893,7 +7148,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the inlet ---*/
@@ -7196,7 +7451,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the outlet ---*/
@@ -8086,6 +8341,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto costScope = geometry->ProfilePointCost(iPoint);
     GlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_donor = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -8932,155 +9188,132 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   const bool menter_sst       = (config->GetKind_Turb_Model() == TURB_MODEL::SST);
   const auto nSpanWiseSections = config->GetnSpanWiseSections();
 
-  for (auto iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
-    su2double TotalDensity{0}, TotalPressure{0}, TotalNu{0}, TotalOmega{0}, TotalKine{0}, TotalVelocity[MAXNDIM],
-              TotalAreaDensity{0}, TotalAreaPressure{0}, TotalAreaNu{0}, TotalAreaOmega{0}, TotalAreaKine{0}, TotalAreaVelocity[MAXNDIM],
-              TotalMassDensity{0}, TotalMassPressure{0}, TotalMassNu{0}, TotalMassOmega{0}, TotalMassKine{0}, TotalMassVelocity[MAXNDIM];
-
-    su2double TotalFluxes[MAXNVAR];
-    /*--- Forces initialization for contenitors ---*/
-    for (auto iVar=0u;iVar<nVar;iVar++)
-      TotalFluxes[iVar]= 0.0;
-    for (auto iDim=0u; iDim<nDim; iDim++) {
-      TotalVelocity[iDim]     = 0.0;
-      TotalAreaVelocity[iDim] = 0.0;
-      TotalMassVelocity[iDim] = 0.0;
-    }
+  /*--- The span-wise binning of the vertices is precomputed in the turbovertex structure. The pitch-wise sums
+   *    of all spans are accumulated concurrently (one row per span), the last row (whole boundary) is the sum
+   *    of the others, and all rows are reduced with a single MPI call. ---*/
 
-    auto UpdateTotalQuantities = [&](const size_t iMarker, const size_t iSpan, const size_t iVertex){
-      /*--- Increment integral quantities for averaging ---*/
+  enum : unsigned short {DENSITY, PRESSURE, NU, OMEGA, KINE,
+                         AREA_DENSITY, AREA_PRESSURE, AREA_NU, AREA_OMEGA, AREA_KINE,
+                         MASS_DENSITY, MASS_PRESSURE, MASS_NU, MASS_OMEGA, MASS_KINE, VELOCITY};
+  const unsigned short AREA_VELOCITY = VELOCITY + nDim, MASS_VELOCITY = AREA_VELOCITY + nDim,
+                       FLUXES = MASS_VELOCITY + nDim, nQuantities = FLUXES + nVar;
 
-      const auto iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    TurboAverageTotals.resize(nSpanWiseSections + 1, nQuantities) = su2double(0.0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
-      /*--- Retrieve local quantities ---*/
-      const auto Pressure = nodes->GetPressure(iPoint);
-      const auto Density  = nodes->GetDensity(iPoint);
-      const auto Enthalpy = nodes->GetEnthalpy(iPoint);
+  auto UpdateTotalQuantities = [&](const size_t iMarker, const size_t iSpan, const size_t iVertex, su2double* Total){
+    /*--- Increment integral quantities for averaging ---*/
 
-      su2double Velocity[MAXNDIM] = {0}, UnitNormal[MAXNDIM] = {0}, TurboNormal[MAXNDIM] = {0}, TurboVelocity[MAXNDIM] = {0};
-      geometry->turbovertex[iMarker][iSpan][iVertex]->GetNormal(UnitNormal);
-      geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
-      const auto Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
+    const auto iPoint = geometry->turbovertex[iMarker][iSpan][iVertex]->GetNode();
 
-      for (auto iDim=0u; iDim < nDim; iDim++) Velocity[iDim] = nodes->GetVelocity(iPoint, iDim);
+    /*--- Retrieve local quantities ---*/
+    const auto Pressure = nodes->GetPressure(iPoint);
+    const auto Density  = nodes->GetDensity(iPoint);
+    const auto Enthalpy = nodes->GetEnthalpy(iPoint);
 
-      ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
+    su2double Velocity[MAXNDIM] = {0}, TurboNormal[MAXNDIM] = {0}, TurboVelocity[MAXNDIM] = {0};
+    geometry->turbovertex[iMarker][iSpan][iVertex]->GetTurboNormal(TurboNormal);
+    const auto Area = geometry->turbovertex[iMarker][iSpan][iVertex]->GetArea();
 
-      /*--- Compute different integral quantities for the boundary of interest ---*/
-      TotalDensity          += Density;
-      TotalPressure         += Pressure;
+    for (auto iDim=0u; iDim < nDim; iDim++) Velocity[iDim] = nodes->GetVelocity(iPoint, iDim);
 
-      TotalAreaPressure         += Area*Pressure;
-      TotalAreaDensity          += Area*Density;
+    ComputeTurboVelocity(Velocity, TurboNormal , TurboVelocity, marker_flag, config->GetKind_TurboMachinery(iZone));
 
-      TotalMassPressure         += Area*(Density*TurboVelocity[0] )*Pressure;
-      TotalMassDensity          += Area*(Density*TurboVelocity[0] )*Density;
+    /*--- Compute different integral quantities for the boundary of interest ---*/
+    const su2double MassFlux = Area*Density*TurboVelocity[0];
 
-      for (auto iDim = 0u; iDim < nDim; iDim++) {
-        TotalVelocity[iDim] += Velocity[iDim];
-        TotalAreaVelocity[iDim] += Area*Velocity[iDim];
-        TotalMassVelocity[iDim] += Area*(Density*TurboVelocity[0] )*Velocity[iDim];
-      }
+    Total[DENSITY]       += Density;
+    Total[PRESSURE]      += Pressure;
 
-      TotalFluxes[0]      += Area*(Density*TurboVelocity[0]);
-      TotalFluxes[1]      += Area*(Density*TurboVelocity[0]*TurboVelocity[0] + Pressure);
-      for (auto iDim = 2; iDim < nDim+1; iDim++)
-        TotalFluxes[iDim] += Area*(Density*TurboVelocity[0]*TurboVelocity[iDim -1]);
-      TotalFluxes[nDim+1] += Area*(Density*TurboVelocity[0]*Enthalpy);
+    Total[AREA_PRESSURE] += Area*Pressure;
+    Total[AREA_DENSITY]  += Area*Density;
 
-      /*--- Compute turbulent integral quantities for the boundary of interest ---*/
+    Total[MASS_PRESSURE] += MassFlux*Pressure;
+    Total[MASS_DENSITY]  += MassFlux*Density;
 
-      if(turbulent){
-        su2double Kine{0}, Omega{0}, Nu{0};
-        if(menter_sst){
-          Kine = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-          Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
-        }
-        if(spalart_allmaras){
-          Nu = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
-        }
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      Total[VELOCITY+iDim]      += Velocity[iDim];
+      Total[AREA_VELOCITY+iDim] += Area*Velocity[iDim];
+      Total[MASS_VELOCITY+iDim] += MassFlux*Velocity[iDim];
+    }
 
-        TotalKine   += Kine;
-        TotalOmega  += Omega;
-        TotalNu     += Nu;
+    Total[FLUXES]        += MassFlux;
+    Total[FLUXES+1]      += MassFlux*TurboVelocity[0] + Area*Pressure;
+    for (auto iDim = 2u; iDim < nDim+1u; iDim++)
+      Total[FLUXES+iDim] += MassFlux*TurboVelocity[iDim -1];
+    Total[FLUXES+nDim+1] += MassFlux*Enthalpy;
 
-        TotalAreaKine    += Area*Kine;
-        TotalAreaOmega   += Area*Omega;
-        TotalAreaNu      += Area*Nu;
+    /*--- Compute turbulent integral quantities for the boundary of interest ---*/
 
-        TotalMassKine    += Area*(Density*TurboVelocity[0] )*Kine;
-        TotalMassOmega   += Area*(Density*TurboVelocity[0] )*Omega;
-        TotalMassNu      += Area*(Density*TurboVelocity[0] )*Nu;
+    if(turbulent){
+      su2double Kine{0}, Omega{0}, Nu{0};
+      if(menter_sst){
+        Kine = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+        Omega = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,1);
+      }
+      if(spalart_allmaras){
+        Nu = solver[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
       }
-    };
-
-    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++){
-      for (auto iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
-
-            /*--- Loop over the vertices to sum all the quantities pitch-wise ---*/
-            if(iSpan < nSpanWiseSections){
-              for (auto iVertex = 0ul; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
-                UpdateTotalQuantities(iMarker, iSpan, iVertex);
-              }
-            } else {
-              for (auto jSpan= 0u; jSpan < nSpanWiseSections; jSpan++){
-                for (auto iVertex = 0ul; iVertex < geometry->GetnVertexSpan(iMarker,jSpan); iVertex++) {
-                  UpdateTotalQuantities(iMarker, jSpan, iVertex);
-                }
-              }
-            }
 
-          } // marker_flag match
-        } // iMarkerTP match
-      } // iMarkerTP
-    } // iMarker
+      Total[KINE]       += Kine;
+      Total[OMEGA]      += Omega;
+      Total[NU]         += Nu;
 
-#ifdef HAVE_MPI
+      Total[AREA_KINE]  += Area*Kine;
+      Total[AREA_OMEGA] += Area*Omega;
+      Total[AREA_NU]    += Area*Nu;
 
-    /*--- Add information using all the nodes ---*/
+      Total[MASS_KINE]  += MassFlux*Kine;
+      Total[MASS_OMEGA] += MassFlux*Omega;
+      Total[MASS_NU]    += MassFlux*Nu;
+    }
+  };
 
-    auto Allreduce = [](su2double x) {
-      su2double tmp = x; x = 0.0;
-      SU2_MPI::Allreduce(&tmp, &x, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      return x;
-    };
+  /*--- Loop over the vertices of each span to sum all the quantities pitch-wise ---*/
 
-    TotalDensity = Allreduce(TotalDensity);
-    TotalPressure = Allreduce(TotalPressure);
-    TotalAreaDensity = Allreduce(TotalAreaDensity);
-    TotalAreaPressure = Allreduce(TotalAreaPressure);
-    TotalMassDensity = Allreduce(TotalMassDensity);
-    TotalMassPressure = Allreduce(TotalMassPressure);
+  SU2_OMP_FOR_DYN(1)
+  for (auto iSpan = 0u; iSpan < nSpanWiseSections; iSpan++) {
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == 0 ||
+          config->GetMarker_All_TurbomachineryFlag(iMarker) != marker_flag) continue;
 
-    TotalNu = Allreduce(TotalNu);
-    TotalKine = Allreduce(TotalKine);
-    TotalOmega = Allreduce(TotalOmega);
-    TotalAreaNu = Allreduce(TotalAreaNu);
-    TotalAreaKine = Allreduce(TotalAreaKine);
-    TotalAreaOmega = Allreduce(TotalAreaOmega);
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertexSpan(iMarker,iSpan); iVertex++) {
+        UpdateTotalQuantities(iMarker, iSpan, iVertex, TurboAverageTotals[iSpan]);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
 
-    TotalMassNu = Allreduce(TotalMassNu);
-    TotalMassKine = Allreduce(TotalMassKine);
-    TotalMassOmega = Allreduce(TotalMassOmega);
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
 
-    auto* buffer = new su2double[max(nVar,nDim)];
+  for (auto iSpan = 0u; iSpan < nSpanWiseSections; iSpan++) {
+    for (auto iQuant = 0u; iQuant < nQuantities; iQuant++)
+      TurboAverageTotals(nSpanWiseSections, iQuant) += TurboAverageTotals(iSpan, iQuant);
+  }
 
-    auto Allreduce_inplace = [buffer](int size, su2double* x) {
-      SU2_MPI::Allreduce(x, buffer, size, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      for(int i=0; i<size; ++i) x[i] = buffer[i];
-    };
+#ifdef HAVE_MPI
 
-    Allreduce_inplace(nVar, TotalFluxes);
-    Allreduce_inplace(nDim, TotalVelocity);
-    Allreduce_inplace(nDim, TotalAreaVelocity);
-    Allreduce_inplace(nDim, TotalMassVelocity);
+  /*--- Add information using all the nodes ---*/
 
-    delete [] buffer;
+  const su2activematrix LocalTotals = TurboAverageTotals;
+  SU2_MPI::Allreduce(LocalTotals.data(), TurboAverageTotals.data(), LocalTotals.size(), MPI_DOUBLE, MPI_SUM,
+                     SU2_MPI::GetComm());
 
 #endif
 
+  for (auto iSpan = 0u; iSpan < nSpanWiseSections + 1u; iSpan++){
+
+    const su2double* Total = TurboAverageTotals[iSpan];
+    const su2double TotalDensity = Total[DENSITY], TotalPressure = Total[PRESSURE], TotalNu = Total[NU],
+                    TotalOmega = Total[OMEGA], TotalKine = Total[KINE],
+                    TotalAreaDensity = Total[AREA_DENSITY], TotalAreaPressure = Total[AREA_PRESSURE],
+                    TotalAreaNu = Total[AREA_NU], TotalAreaOmega = Total[AREA_OMEGA], TotalAreaKine = Total[AREA_KINE],
+                    TotalMassDensity = Total[MASS_DENSITY], TotalMassPressure = Total[MASS_PRESSURE],
+                    TotalMassNu = Total[MASS_NU], TotalMassOmega = Total[MASS_OMEGA], TotalMassKine = Total[MASS_KINE];
+    const su2double *TotalVelocity = Total + VELOCITY, *TotalAreaVelocity = Total + AREA_VELOCITY,
+                    *TotalMassVelocity = Total + MASS_VELOCITY, *TotalFluxes = Total + FLUXES;
     /*--- Compute pitch-wise averaged quantities ---*/
     for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++){
       for (auto iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -9297,6 +9530,9 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
       } // iMarkerTP
     } // iMarker is iMarkerTP
   } // iMarker
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 void CEulerSolver::MixedOut_Average(CConfig *config, su2double val_init_pressure, const su2double *val_Averaged_Flux,
@@ -9346,184 +9582,77 @@ void CEulerSolver::MixedOut_Average(CConfig *config, su2double val_init_pressure
 
 void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry){
 
-  unsigned short iMarker, iMarkerTP;
-  unsigned short iSpan;
-  int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
-  //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
+  /*--- The averages of a blade row are only known by the ranks that own its markers. They are made available on
+   *    all ranks with a single non-blocking reduction for all markers and spans (maximum, the other ranks
+   *    contribute the lowest value), CompleteInOutAverageValues must be called before the values are used. ---*/
+
+  CompleteInOutAverageValues(config);
+
+  const auto nSpan = config->GetnSpanWiseSections() + 1ul;
+  const auto nMarkerTP = config->GetnMarker_Turbomachinery();
+  const su2double unset = std::numeric_limits<passivedouble>::lowest();
+
+  TurboPerfSendBuf.assign(nMarkerTP * nSpan * 2 * nTurboPerfVar, unset);
+  TurboPerfRecvBuf.resize(TurboPerfSendBuf.size());
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    const auto iMarkerTP = config->GetMarker_All_Turbomachinery(iMarker);
+    const auto flag = config->GetMarker_All_TurbomachineryFlag(iMarker);
+    if (iMarkerTP == 0 || (flag != INFLOW && flag != OUTFLOW)) continue;
+
+    const bool inflow = (flag == INFLOW);
+    const auto& density = inflow ? DensityIn : DensityOut;
+    const auto& pressure = inflow ? PressureIn : PressureOut;
+    const auto& turboVelocity = inflow ? TurboVelocityIn : TurboVelocityOut;
+    const auto& kine = inflow ? KineIn : KineOut;
+    const auto& omega = inflow ? OmegaIn : OmegaOut;
+    const auto& nu = inflow ? NuIn : NuOut;
+
+    for (auto iSpan = 0ul; iSpan < nSpan; iSpan++) {
+      su2double* buf = &TurboPerfSendBuf[(((iMarkerTP - 1) * nSpan + iSpan) * 2 + !inflow) * nTurboPerfVar];
+      buf[0] = density[iMarkerTP - 1][iSpan];
+      buf[1] = pressure[iMarkerTP - 1][iSpan];
+      for (auto iDim = 0u; iDim < nDim; iDim++) buf[2 + iDim] = turboVelocity[iMarkerTP - 1][iSpan][iDim];
+      buf[5] = kine[iMarkerTP - 1][iSpan];
+      buf[6] = omega[iMarkerTP - 1][iSpan];
+      buf[7] = nu[iMarkerTP - 1][iSpan];
+    }
+  }
 
-  const auto nSpanWiseSections = config->GetnSpanWiseSections();
+  SU2_MPI::Iallreduce(TurboPerfSendBuf.data(), TurboPerfRecvBuf.data(), TurboPerfSendBuf.size(), MPI_DOUBLE,
+                      MPI_MAX, SU2_MPI::GetComm(), &TurboPerfRequest);
+  TurboPerfPending = true;
+}
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+void CEulerSolver::CompleteInOutAverageValues(const CConfig *config) {
 
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= nullptr,*TurbPerfOut= nullptr;
-    su2double *TotTurbPerfIn = nullptr,*TotTurbPerfOut = nullptr;
-    int *TotMarkerTP = nullptr;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
+  if (!TurboPerfPending) return;
 
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
-
-    markerTP             = -1;
-
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
-            }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
+  SU2_MPI::Status status;
+  SU2_MPI::Wait(&TurboPerfRequest, &status);
+  TurboPerfPending = false;
 
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
-          }
+  const auto nSpan = config->GetnSpanWiseSections() + 1ul;
+  const auto nMarkerTP = config->GetnMarker_Turbomachinery();
+  const su2double unset = std::numeric_limits<passivedouble>::lowest();
 
-          /*--- retrieve outlet information ---*/
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
-            if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
-            }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
+  for (auto iMarkerTP = 0u; iMarkerTP < nMarkerTP; iMarkerTP++) {
+    for (auto iSpan = 0ul; iSpan < nSpan; iSpan++) {
+      for (auto iSide = 0u; iSide < 2; iSide++) {
+        const su2double* buf = &TurboPerfRecvBuf[((iMarkerTP * nSpan + iSpan) * 2 + iSide) * nTurboPerfVar];
 
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
-          }
-        }
-      }
-    }
-
-#ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(int i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
-
-    if (rank == MASTER_NODE){
-      for (int i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = TotTurbPerfIn[n1*i+7];
-          markerTP         = TotMarkerTP[i];
-        }
+        /*--- No rank owns this marker (e.g. another zone). ---*/
+        if (buf[0] == unset) continue;
 
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
+        const bool inflow = (iSide == 0);
+        (inflow ? DensityIn : DensityOut)[iMarkerTP][iSpan] = buf[0];
+        (inflow ? PressureIn : PressureOut)[iMarkerTP][iSpan] = buf[1];
+        for (auto iDim = 0u; iDim < nDim; iDim++)
+          (inflow ? TurboVelocityIn : TurboVelocityOut)[iMarkerTP][iSpan][iDim] = buf[2 + iDim];
+        (inflow ? KineIn : KineOut)[iMarkerTP][iSpan] = buf[5];
+        (inflow ? OmegaIn : OmegaOut)[iMarkerTP][iSpan] = buf[6];
+        (inflow ? NuIn : NuOut)[iMarkerTP][iSpan] = buf[7];
       }
-
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
-    }
-
-#endif
-
-    if (rank == MASTER_NODE && markerTP > -1){
-      /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
-      if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
-      if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
     }
   }
 }
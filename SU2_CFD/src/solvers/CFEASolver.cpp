@@ -654,83 +654,142 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
     LinSysRes.SetValZero();
     Jacobian.SetValZero();
 
-    for(auto color : ElemColoring) {
-
-      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-      for(auto k = 0ul; k < color.size; ++k) {
-
-        auto iElem = color.indices[k];
+    /*--- Linear simplices are computed in batches, one element per SIMD lane. ---*/
+    auto simplexBatch = [&](const unsigned long* batch, unsigned short nLanes) {
+      if (nDim == 2) StiffMatrixSimplices<2>(geometry, numerics, config, batch, nLanes);
+      else StiffMatrixSimplices<3>(geometry, numerics, config, batch, nLanes);
+    };
 
-        unsigned short iNode, jNode, iDim, iVar;
+    auto singleElement = [&](unsigned long iElem) {
 
-        int thread = omp_get_thread_num();
+      unsigned short iNode, jNode, iDim, iVar;
 
-        /*--- Convert VTK type to index in the element container. ---*/
-        int EL_KIND;
-        unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+      int thread = omp_get_thread_num();
 
-        /*--- Each thread needs a dedicated element. ---*/
-        CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+      /*--- Convert VTK type to index in the element container. ---*/
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
 
-        /*--- For the number of nodes, get the coordinates and cache the point indices. ---*/
-        unsigned long indexNode[MAXNNODE_3D];
+      /*--- Each thread needs a dedicated element. ---*/
+      CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
 
-        for (iNode = 0; iNode < nNodes; iNode++) {
+      /*--- For the number of nodes, get the coordinates and cache the point indices. ---*/
+      unsigned long indexNode[MAXNNODE_3D];
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+      for (iNode = 0; iNode < nNodes; iNode++) {
 
-          for (iDim = 0; iDim < nDim; iDim++) {
-            su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
-            su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
-            element->SetRef_Coord(iNode, iDim, val_Coord);
-            element->SetCurr_Coord(iNode, iDim, val_Sol);
-          }
-        }
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
-        su2double simp_penalty = 1.0;
-        if (topology_mode) {
-          su2double density = element_properties[iElem]->GetPhysicalDensity();
-          simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+          su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+          element->SetRef_Coord(iNode, iDim, val_Coord);
+          element->SetCurr_Coord(iNode, iDim, val_Sol);
         }
+      }
 
-        /*--- Set the properties of the element ---*/
-        element->Set_ElProperties(element_properties[iElem]);
+      /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
+      su2double simp_penalty = 1.0;
+      if (topology_mode) {
+        su2double density = element_properties[iElem]->GetPhysicalDensity();
+        simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+      }
 
-        /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
-        int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+      /*--- Set the properties of the element ---*/
+      element->Set_ElProperties(element_properties[iElem]);
 
-        numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
+      /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
+      int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
-        /*--- Update residual and stiffness matrix with contributions from the element. ---*/
-        for (iNode = 0; iNode < nNodes; iNode++) {
+      numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
 
-          if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+      /*--- Update residual and stiffness matrix with contributions from the element. ---*/
+      for (iNode = 0; iNode < nNodes; iNode++) {
 
-          auto Ta = element->Get_Kt_a(iNode);
-          for (iVar = 0; iVar < nVar; iVar++)
-            LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
+        if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
 
-          for (jNode = 0; jNode < nNodes; jNode++) {
-            auto Kab = element->Get_Kab(iNode, jNode);
-            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
-          }
+        auto Ta = element->Get_Kt_a(iNode);
+        for (iVar = 0; iVar < nVar; iVar++)
+          LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
-          if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+        for (jNode = 0; jNode < nNodes; jNode++) {
+          auto Kab = element->Get_Kab(iNode, jNode);
+          Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
         }
 
-      } // end iElem loop
-      END_SU2_OMP_FOR
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+      }
+    };
 
-    } // end color loop
+    for(auto color : ElemColoring) {
+      ElementColorLoop(geometry, color, simplexBatch, singleElement);
+    }
 
   }
   END_SU2_OMP_PARALLEL
 
 }
 
+template<size_t NDIM>
+void CFEASolver::StiffMatrixSimplices(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                      const unsigned long* batch, unsigned short nLanes) {
+  constexpr size_t nNode = NDIM+1;
+
+  unsigned long indexNode[Double::Size][nNode];
+  MatrixDbl<nNode,NDIM> coord, grad, disp, force;
+  Double lambda, mu;
+
+  GatherSimplices<NDIM>(geometry, numerics, config, batch, nLanes, indexNode, coord, lambda, mu);
+
+  /*--- Displacements and, in topology mode, the penalty to apply to the stiffness. ---*/
+  Double simp_penalty = 1.0;
+
+  for (auto iLane = 0ul; iLane < Double::Size; ++iLane) {
+    for (auto iNode = 0ul; iNode < nNode; ++iNode)
+      for (auto iDim = 0ul; iDim < NDIM; ++iDim)
+        disp(iNode,iDim)[iLane] = nodes->GetSolution(indexNode[iLane][iNode], iDim);
+
+    if (config->GetTopology_Optimization() && (iLane < nLanes)) {
+      const su2double density = element_properties[batch[iLane]]->GetPhysicalDensity();
+      const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+      simp_penalty[iLane] = simp_minstiff+(1.0-simp_minstiff)*pow(density,config->GetSIMP_Exponent());
+    }
+  }
+
+  const Double volume = LinearSimplex::gradients<NDIM>(coord, grad);
+  LinearSimplex::stiffnessProduct<NDIM>(grad, volume, lambda, mu, disp, force);
+
+  /*--- Update residual and stiffness matrix with the contributions of each element. ---*/
+  MatrixDbl<NDIM> Kab[nNode];
+
+  for (auto iNode = 0ul; iNode < nNode; ++iNode) {
+
+    for (auto jNode = 0ul; jNode < nNode; ++jNode)
+      LinearSimplex::stiffnessBlock<NDIM>(grad, volume, lambda, mu, iNode, jNode, Kab[jNode]);
+
+    for (auto iLane = 0ul; iLane < nLanes; ++iLane) {
+      const auto iPoint = indexNode[iLane][iNode];
+
+      if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+
+      for (auto iVar = 0ul; iVar < NDIM; ++iVar)
+        LinSysRes(iPoint, iVar) -= simp_penalty[iLane]*force(iNode,iVar)[iLane];
+
+      for (auto jNode = 0ul; jNode < nNode; ++jNode) {
+        su2double block[NDIM*NDIM];
+        for (auto iVar = 0ul; iVar < NDIM; ++iVar)
+          for (auto jVar = 0ul; jVar < NDIM; ++jVar)
+            block[iVar*NDIM+jVar] = Kab[jNode](iVar,jVar)[iLane];
+
+        Jacobian.AddBlock(iPoint, indexNode[iLane][jNode], block, simp_penalty[iLane]);
+      }
+
+      if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+    }
+  }
+}
+
 void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
   const bool prestretch_fem = config->GetPrestretch();
@@ -1559,7 +1618,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, const CConfig *config, unsigned
 
     LinSysSol.SetBlock(iPoint, zeros);
     if (LinSysReact.GetLocSize() > 0) LinSysReact.SetBlock(iPoint, zeros);
-    Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+    EnforceSolutionAtNode(iPoint, zeros);
 
   }
 
@@ -1639,7 +1698,7 @@ void CFEASolver::BC_Sym_Plane(CGeometry *geometry, const CConfig *config, unsign
     nodes->SetBound_Disp(iPoint, axis, 0.0);
     LinSysSol(iPoint, axis) = 0.0;
     if (LinSysReact.GetLocSize() > 0) LinSysReact(iPoint, axis) = 0.0;
-    Jacobian.EnforceSolutionAtDOF(iPoint, axis, su2double(0.0), LinSysRes);
+    EnforceSolutionAtDOF(iPoint, axis, 0.0);
 
   }
 
@@ -2641,6 +2700,14 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *c
 
     }
 
+  }
+  else if (RelaxMethod_FSI == BGS_RELAXATION::QUASI_NEWTON) {
+
+    /*--- Only the interface is accelerated, the other points take the calculated solution. ---*/
+    WAitken_Dyn = 1.0;
+
+    if (iOuterIter == 0) InterfaceQN.newTimeStep();
+
   }
   else {
     if (rank == MASTER_NODE) cout << "No relaxation method used. " << endl;
@@ -2686,6 +2753,55 @@ void CFEASolver::SetAitken_Relaxation(CGeometry *geometry, const CConfig *config
   }
   END_SU2_OMP_PARALLEL
 
+  if (config->GetRelaxation_Method_BGS() == BGS_RELAXATION::QUASI_NEWTON)
+    SetInterface_QuasiNewton(geometry, config);
+
+}
+
+void CFEASolver::SetInterface_QuasiNewton(CGeometry *geometry, const CConfig *config) {
+
+  if (!InterfaceQN_Ready) {
+    /*--- Gather the points of the fluid load markers, the halos are included to keep them
+     *    consistent but only the domain points count in the dot products. ---*/
+    vector<unsigned long> haloPoints;
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_Fluid_Load(iMarker) != YES) continue;
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (geometry->nodes->GetDomain(iPoint)) InterfacePoints.push_back(iPoint);
+        else haloPoints.push_back(iPoint);
+      }
+    }
+    for (auto* points : {&InterfacePoints, &haloPoints}) {
+      sort(points->begin(), points->end());
+      points->erase(unique(points->begin(), points->end()), points->end());
+    }
+    const auto nDomain = InterfacePoints.size();
+    InterfacePoints.insert(InterfacePoints.end(), haloPoints.begin(), haloPoints.end());
+
+    InterfaceQN.resize(InterfacePoints.size(), nDim, nDomain, config->GetQuasiNewtonFSI_MaxColumns(),
+                       config->GetQuasiNewtonFSI_ReuseSteps(), SU2_TYPE::GetValue(config->GetQuasiNewtonFSI_Filter()),
+                       SU2_TYPE::GetValue(config->GetAitkenStatRelax()));
+    InterfaceQN_Ready = true;
+  }
+
+  /*--- The input of the fixed-point is the previous prediction, its result the calculated solution. ---*/
+  for (auto i = 0ul; i < InterfacePoints.size(); i++) {
+    const auto iPoint = InterfacePoints[i];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      InterfaceQN(i, iDim) = SU2_TYPE::GetValue(nodes->GetSolution_Pred_Old(iPoint)[iDim]);
+      InterfaceQN.FPresult(i, iDim) = SU2_TYPE::GetValue(nodes->GetSolution(iPoint)[iDim]);
+    }
+  }
+
+  const auto& newPred = InterfaceQN.compute();
+
+  for (auto i = 0ul; i < InterfacePoints.size(); i++) {
+    su2double dispPred[MAXNVAR] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) dispPred[iDim] = newPred(i, iDim);
+    nodes->SetSolution_Pred(InterfacePoints[i], dispPred);
+  }
+
 }
 
 void CFEASolver::OutputForwardModeGradient(const CConfig *config, bool newFile,
@@ -3073,38 +3189,28 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
+  unsigned long counter = 0;
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    const auto index = counter*Restart_Vars[1] + skipVars;
+    const passivedouble* Sol = &Restart_Data[index];
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
-
-    if (iPoint_Local >= 0) {
-
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
-
-      const auto index = counter*Restart_Vars[1] + skipVars;
-      const passivedouble* Sol = &Restart_Data[index];
-
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
-        if (dynamic) {
-          nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
-        }
-        if (fluid_structure && discrete_adjoint){
-          nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
-        }
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
+      if (dynamic) {
+        nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
+        nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+      }
+      if (fluid_structure && discrete_adjoint){
+        nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
       }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file. ---*/
@@ -3236,7 +3342,7 @@ void CFEASolver::FilterElementDensities(CGeometry *geometry, const CConfig *conf
   }
   END_SU2_OMP_PARALLEL
 
-  geometry->FilterValuesAtElementCG(filter_radius, kernels, search_lim, physical_rho);
+  geometry->FilterValuesAtElementCG(filter_radius, kernels, search_lim, physical_rho, &topol_filter_cache);
 
   SU2_OMP_PARALLEL
   {
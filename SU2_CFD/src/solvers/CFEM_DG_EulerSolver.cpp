@@ -176,6 +176,28 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   nMatchingInternalFacesLocalElem    = DGGeometry->GetNMatchingFacesInternal();
   matchingInternalFaces              = DGGeometry->GetMatchingFaces();
 
+  /*--- Face neighbors of the local elements, for the buffer of the shock sensor. ---*/
+  if(config->GetKind_FEM_DG_Shock() != FEM_SHOCK_CAPTURING_DG::NONE) {
+    const unsigned long nFaces = nMatchingInternalFacesWithHaloElem[config->GetnLevels_TimeAccurateLTS()];
+
+    elemNeighborPtr.assign(nVolElemTot+1, 0);
+    for(unsigned long i=0; i<nFaces; ++i) {
+      ++elemNeighborPtr[matchingInternalFaces[i].elemID0+1];
+      ++elemNeighborPtr[matchingInternalFaces[i].elemID1+1];
+    }
+    for(unsigned long l=0; l<nVolElemTot; ++l) elemNeighborPtr[l+1] += elemNeighborPtr[l];
+
+    elemNeighbors.resize(elemNeighborPtr[nVolElemTot]);
+    vector<unsigned long> pos(elemNeighborPtr.begin(), elemNeighborPtr.end()-1);
+    for(unsigned long i=0; i<nFaces; ++i) {
+      const unsigned long elem0 = matchingInternalFaces[i].elemID0;
+      const unsigned long elem1 = matchingInternalFaces[i].elemID1;
+      elemNeighbors[pos[elem0]++] = elem1;
+      elemNeighbors[pos[elem1]++] = elem0;
+    }
+    shockSensorBuffer.assign(nVolElemTot, 0);
+  }
+
   boundaries = DGGeometry->GetBoundaries();
 
   nStandardBoundaryFacesSol = DGGeometry->GetNStandardBoundaryFacesSol();
@@ -238,8 +260,10 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   }
   else {
 
-    /* Inviscid simulation. */
-    unsigned int sizeVol = nPadGemm*nIntegrationMax*(nDim+2) + nPadGemm*nDOFsMax;
+    /* Inviscid simulation. The last part of sizeVol is the work space of the
+       sum-factorization kernels of the tensor product elements. */
+    unsigned int sizeVol = nPadGemm*nIntegrationMax*(nDim+2) + nPadGemm*nDOFsMax
+                         + 2*nPadGemm*max(nIntegrationMax,nDOFsMax);
     unsigned int sizeSur = nPadGemm*(2*nIntegrationMax + max(nIntegrationMax,nDOFsMax));
 
     sizeWorkArray = max(sizeVol, sizeSur);
@@ -3481,6 +3505,22 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
       }
     }
   }
+
+  /*--- Elements for which the full shock sensor must be evaluated in this iteration. ---*/
+  UpdateShockSensorBuffer();
+}
+
+void CFEM_DG_EulerSolver::UpdateShockSensorBuffer() {
+
+  /*--- A shock moves at most one element per time step, hence the elements next to a troubled
+        element are not screened by the first pass of the sensor, which may miss a shock that
+        is entering the element. ---*/
+  for(unsigned long l=0; l<shockSensorBuffer.size(); ++l) {
+    bool flag = volElem[l].shockTroubled;
+    for(unsigned long k=elemNeighborPtr[l]; k<elemNeighborPtr[l+1]; ++k)
+      flag = flag || volElem[elemNeighbors[k]].shockTroubled;
+    shockSensorBuffer[l] = flag;
+  }
 }
 
 void CFEM_DG_EulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
@@ -3540,7 +3580,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
         su2double *solDOF = VecWorkSolDOFs[0].data() + jj*nVar;
 
 #ifdef CODI_FORWARD_TYPE
-        solDOF[var].setGradient(1.0);
+        SU2_TYPE::SetDerivative(solDOF[var], 1.0);
 #else
         solDOF[var] += 0.001;   /* This is to avoid a compiler warning. */
 #endif
@@ -3568,7 +3608,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
           /* Store the matrix entries. */
           for(unsigned short j=0; j<nVar; ++j) {
 #ifdef CODI_FORWARD_TYPE
-            Jac[var+j*nVar] = resDOF[j].getGradient();
+            Jac[var+j*nVar] = SU2_TYPE::GetDerivative(resDOF[j]);
 #else
             Jac[var+j*nVar] = 0.0;   /* This is to avoid a compiler warning. */
 #endif
@@ -3583,7 +3623,7 @@ void CFEM_DG_EulerSolver::ComputeSpatialJacobian(CGeometry *geometry,  CSolver *
         su2double *solDOF = VecWorkSolDOFs[0].data() + jj*nVar;
 
 #ifdef CODI_FORWARD_TYPE
-        solDOF[var].setGradient(0.0);
+        SU2_TYPE::SetDerivative(solDOF[var], 0.0);
 #else
         solDOF[var] -= 0.001;   /* This is to avoid a compiler warning. */
 #endif
@@ -3857,6 +3897,27 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   /* Easier storage of the number of time levels.. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
+  /* Determine whether the compute time per time level must be measured for
+     the load balance monitoring of ADER-DG. */
+  const bool measureWork = (config->GetKind_TimeIntScheme_Flow() == ADER_DG) &&
+                           (config->GetLoadBalance_Freq_FEM() > 0);
+  if(measureWork && (workTimeLevels.size() != nTimeLevels)) {
+    workTimeLevels.assign(nTimeLevels, 0.0);
+    timeTaskTypes.assign(CTaskDefinition::ADER_UPDATE_SOLUTION+1, 0.0);
+  }
+
+#ifndef CODI_REVERSE_TYPE
+  /* Carry out the tasks with a pool of threads, if desired. This is only done
+     when the tasks are thread safe, which is not the case for the viscous terms
+     (the fluid model stores the thermodynamic state) and for the Riemann solvers
+     that are implemented via the numerics classes. */
+  if(config->GetThreaded_Task_Scheduler_FEM() && (omp_get_max_threads() > 1) &&
+     !config->GetViscous() && (config->GetRiemann_Solver_FEM() == UPWIND::ROE)) {
+    ProcessTaskListThreads_DG(numerics, config, measureWork);
+    return;
+  }
+#endif
+
   /* Define and initialize the bool vector, that indicates whether or
      not the tasks from the list have been completed. */
   vector<bool> taskCompleted(tasksList.size(), false);
@@ -3887,280 +3948,393 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
         if( taskCanBeCarriedOut ) {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+          const su2double taskStart = measureWork ? SU2_MPI::Wtime() : 0.0;
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+          /*--- Carry out the task. The only tasks that may fail are the
+                completion of the non-blocking communication. If that is the
+                case the next task needs to be found. For j==1 the next tasks
+                are waiting for this communication and hence it is waited for. ---*/
+          taskCarriedOut = CarryOutTask_DG(i, numerics, config, j==1, workArray);
+          taskCompleted[i] = taskCarriedOut;
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+          if(measureWork && taskCarriedOut)
+            AccumulateTaskTime_DG(i, SU2_MPI::Wtime() - taskStart);
+        }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        /* Break the inner loop if a task has been carried out. */
+        if( taskCarriedOut ) break;
+      }
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+      /* Break the outer loop if a task has been carried out. */
+      if( taskCarriedOut ) break;
+    }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    /* Update the value of lowestIndexInList. */
+    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+      if( !taskCompleted[lowestIndexInList] ) break;
+  }
+}
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+void CFEM_DG_EulerSolver::ProcessTaskListThreads_DG(CNumerics  **numerics,
+                                                    CConfig    *config,
+                                                    const bool measureWork) {
+
+  /* Status of the tasks in the list. The status, as well as the counters, are only
+     accessed in critical sections, which also make sure that the data computed in
+     a task is visible to the other threads once its status is COMPLETED. */
+  enum : unsigned short {WAITING, RUNNING, COMPLETED};
+  vector<unsigned short> taskStatus(tasksList.size(), WAITING);
+  unsigned long nTasksCompleted = 0, nTasksRunning = 0, lowestIndexInList = 0;
+
+  /* Lambda, which determines whether or not a task can be carried out. */
+  auto taskIsReady = [&](const unsigned long i) {
+    if(taskStatus[i] != WAITING) return false;
+    for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind)
+      if(taskStatus[tasksList[i].indMustBeCompleted[ind]] != COMPLETED) return false;
+    return true;
+  };
+
+  /* Lambda, which releases a task that has been claimed by a thread. */
+  auto releaseTask = [&](const unsigned long i, const bool completed, const su2double elapsed) {
+    SU2_OMP_CRITICAL
+    {
+      --nTasksRunning;
+      taskStatus[i] = completed ? COMPLETED : WAITING;
+      if( completed ) {
+        ++nTasksCompleted;
+        if( measureWork ) AccumulateTaskTime_DG(i, elapsed);
+      }
+      for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+        if(taskStatus[lowestIndexInList] != COMPLETED) break;
+    }
+    END_SU2_OMP_CRITICAL
+  };
+
+  SU2_OMP_PARALLEL
+  {
+    /* Every thread has its own work array. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    const bool masterThread = (omp_get_thread_num() == 0);
+
+    bool allTasksCompleted = false;
+    while( !allTasksCompleted ) {
+
+      /* Claim the next task. MPI is only called by the master thread, which
+         gives priority to the start of a communication, such that it is
+         overlapped with the work of the other threads as much as possible. The
+         completion of a communication is tested when nothing else is ready for
+         the master thread, it is waited for when no thread is carrying out a
+         task, because then nothing can be done before it is completed. */
+      long iTask = -1;
+      bool isCompletion = false, waitComm = false;
+
+      SU2_OMP_CRITICAL
+      {
+        long iCompletion = -1;
+        for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+          if( !taskIsReady(i) ) continue;
+
+          const auto task = tasksList[i].task;
+          if((task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+             (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION)) {
+            if(masterThread && (iCompletion < 0)) iCompletion = i;
+          }
+          else if((task == CTaskDefinition::INITIATE_MPI_COMMUNICATION) ||
+                  (task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION)) {
+            if( masterThread ) {iTask = i; break;}
+          }
+          else if(iTask < 0) {
+            iTask = i;
+            if( !masterThread ) break;
+          }
+        }
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        if((iTask < 0) && (iCompletion >= 0)) {
+          iTask        = iCompletion;
+          isCompletion = true;
+          waitComm     = (nTasksRunning == 0);
+        }
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        if(iTask >= 0) {
+          taskStatus[iTask] = RUNNING;
+          ++nTasksRunning;
+        }
+        allTasksCompleted = (nTasksCompleted == tasksList.size());
+      }
+      END_SU2_OMP_CRITICAL
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+      if(iTask < 0) continue;
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the task and release it. Only the test of the completion of a
+         communication may fail, in which case the task is waiting again. */
+      const su2double taskStart = measureWork ? omp_get_wtime() : 0.0;
+      const bool completed = CarryOutTask_DG(iTask, numerics, config, waitComm, workArrayVec.data());
+      releaseTask(iTask, completed || !isCompletion,
+                  measureWork ? omp_get_wtime() - taskStart : 0.0);
+    }
+  }
+  END_SU2_OMP_PARALLEL
+}
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+void CFEM_DG_EulerSolver::AccumulateTaskTime_DG(const unsigned long iTask,
+                                                const su2double     elapsed) {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+  /* The completion of the communication is considered waiting time, the
+     other tasks are work of the time level of the task. */
+  const auto task = tasksList[iTask].task;
+  if((task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+     (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION))
+    waitTimeComm += elapsed;
+  else
+    workTimeLevels[tasksList[iTask].timeLevel] += elapsed;
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+  timeTaskTypes[task] += elapsed;
+}
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+bool CFEM_DG_EulerSolver::CarryOutTask_DG(const unsigned long iTask,
+                                          CNumerics           **numerics,
+                                          CConfig             *config,
+                                          const bool          waitComm,
+                                          su2double           *workArray) {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+  /* Easier storage of the number of time levels.. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+  /*--- Determine the actual task to be carried out and do so. ---*/
+  switch( tasksList[iTask].task ) {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+      /* Carry out the ADER predictor step for the elements whose
+         solution must be communicated for this time level. */
+      const unsigned short level   = tasksList[iTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must not be communicated for this time level. */
+      const unsigned short level   = tasksList[iTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, tasksList[iTask].timeLevel);
+      return true;
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the solution data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the next
+         task on the list is carried out. If waitComm is true, the next
+         tasks are waiting for this communication to be completed and
+         hence MPI_Waitall is used. */
+      return Complete_MPI_Communication(config, tasksList[iTask].timeLevel,
+                                        waitComm);
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, tasksList[iTask].timeLevel);
+      return true;
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the residual data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the next
+         task on the list is carried out. If waitComm is true, the next
+         tasks are waiting for this communication to be completed and
+         hence MPI_Waitall is used. */
+      return Complete_MPI_ReverseCommunication(config, tasksList[iTask].timeLevel,
+                                               waitComm);
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[iTask].intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[iTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
+
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[iTask].intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[iTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /*--- Compute the volume portion of the residual. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
+                      nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Compute the residual of the faces that only involve owned elements. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-            default: {
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(tasksList[iTask].timeLevel, config, numerics, false,
+                          workArray);
+      return true;
+    }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
-      }
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(tasksList[iTask].timeLevel, config, numerics, true,
+                          workArray);
+      return true;
     }
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[iTask].timeLevel, true);
+      return true;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[iTask].timeLevel, false);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[iTask].timeLevel,
+                                               tasksList[iTask].intPointADER);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[iTask].timeLevel,
+                                              tasksList[iTask].intPointADER);
+      return true;
+    }
+
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          workArray);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                        nVolElemOwnedPerTimeLevel[level+1]);
+      return true;
+    }
+
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
+      return false;
+    }
   }
 }
 
@@ -4174,10 +4348,459 @@ void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolve
   /* Process the tasks list to carry out one ADER space time integration step. */
   ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
 
+  /* Report the load balance, if needed. */
+  MonitorLoadBalance(config);
+
   /* Postprocessing. */
   Postprocessing(geometry, solver_container, config, iMesh);
 }
 
+void CFEM_DG_EulerSolver::MonitorLoadBalance(CConfig *config) {
+
+  /*--- Check if the load balance must be reported in this time step. ---*/
+  const unsigned long freq = config->GetLoadBalance_Freq_FEM();
+  if(!freq || (++nStepsLoadBalance < freq)) return;
+  nStepsLoadBalance = 0;
+
+  /*--- Determine the local compute time, the number of elements and the sum of
+        the a priori work estimates (volume part) of the owned elements per time
+        level, followed by the time waiting for communication and the time per
+        type of task. ---*/
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  const unsigned short nTaskTypes  = timeTaskTypes.size();
+
+  vector<su2double> locBuf(3*nTimeLevels+1+nTaskTypes, 0.0);
+  su2double locTime = 0.0;
+  for(unsigned short level=0; level<nTimeLevels; ++level) {
+    locBuf[level] = workTimeLevels[level];
+    locTime      += workTimeLevels[level];
+
+    for(unsigned long l=nVolElemOwnedPerTimeLevel[level]; l<nVolElemOwnedPerTimeLevel[level+1]; ++l) {
+      const unsigned short ind = volElem[l].indStandardElement;
+      locBuf[nTimeLevels+level]   += 1.0;
+      locBuf[2*nTimeLevels+level] += standardElementsSol[ind].WorkEstimateMetis(config);
+    }
+  }
+  locBuf[3*nTimeLevels] = waitTimeComm;
+  for(unsigned short i=0; i<nTaskTypes; ++i) locBuf[3*nTimeLevels+1+i] = timeTaskTypes[i];
+
+  vector<su2double> globBuf(locBuf.size());
+  su2double maxTime;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), locBuf.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&locTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+#else
+  globBuf = locBuf;
+  maxTime = locTime;
+#endif
+
+  /*--- Write the load imbalance, i.e. the maximum over the average compute time,
+        and the measured work per time level. The latter is the compute time per
+        unit of a priori work estimate, which replaces the factor 2^(maxLevel-level)
+        when the file is read in the partitioning of a next run. ---*/
+  if(rank == MASTER_NODE) {
+
+    su2double totTime = 0.0;
+    for(unsigned short level=0; level<nTimeLevels; ++level) totTime += globBuf[level];
+
+    const su2double avgTime = totTime/size;
+    cout << endl << "Load balance of ADER-DG over the last " << freq << " time steps:" << endl;
+    cout << "Imbalance (max/avg compute time per rank): " << maxTime/max(avgTime, su2double(EPS))
+         << ", average waiting time for communication: " << globBuf[3*nTimeLevels]/size << " s." << endl;
+
+    vector<su2double> work(nTimeLevels, 0.0);
+    for(unsigned short level=0; level<nTimeLevels; ++level) {
+      const su2double nElem    = globBuf[nTimeLevels+level];
+      const su2double estimate = globBuf[2*nTimeLevels+level];
+      if(nElem > 0.0) {
+        work[level] = globBuf[level]/estimate;
+        cout << "Time level " << level << ": " << (unsigned long) SU2_TYPE::GetValue(nElem)
+             << " elements, " << globBuf[level]/nElem << " s per element." << endl;
+      }
+    }
+
+    /* The average time per rank of the types of tasks that have been carried out. */
+    static const char* taskNames[] = {"", "ADER predictor communicated elements", "ADER predictor internal elements",
+      "Initiate communication", "Complete communication", "Initiate reverse communication",
+      "Complete reverse communication", "ADER time interpolation owned elements",
+      "ADER time interpolation halo elements", "Shock capturing owned elements", "Shock capturing halo elements",
+      "Volume residual", "Surface residual owned elements", "Surface residual halo elements",
+      "Boundary conditions owned elements", "Boundary conditions halo elements", "Sum up residual owned elements",
+      "Sum up residual halo elements", "ADER space time residual owned elements",
+      "ADER space time residual halo elements", "Multiply inverse mass matrix", "ADER update solution"};
+
+    cout << "Average time per rank of the tasks:" << endl;
+    for(unsigned short i=0; i<nTaskTypes; ++i) {
+      const su2double taskTime = globBuf[3*nTimeLevels+1+i]/size;
+      if(taskTime > 0.0) cout << "  " << taskNames[i] << ": " << taskTime << " s." << endl;
+    }
+
+    /* Time levels without elements get the work of the adjacent levels, assuming
+       that the work doubles when the time level decreases by one. */
+    for(unsigned short level=nTimeLevels-1; level>0; --level)
+      if((work[level-1] <= 0.0) && (work[level] > 0.0)) work[level-1] = 2.0*work[level];
+    for(unsigned short level=1; level<nTimeLevels; ++level)
+      if((work[level] <= 0.0) && (work[level-1] > 0.0)) work[level] = 0.5*work[level-1];
+
+    ofstream workFile(config->GetWorkWeights_FileName_FEM());
+    workFile << "% Measured work per time level, relative to the a priori work estimate." << endl;
+    workFile << nTimeLevels << endl;
+    workFile << std::scientific << std::setprecision(6);
+    for(unsigned short level=0; level<nTimeLevels; ++level)
+      workFile << level << " " << work[level] << endl;
+  }
+
+  /*--- Reset the measurements. ---*/
+  for(auto &t : workTimeLevels) t = 0.0;
+  for(auto &t : timeTaskTypes) t = 0.0;
+  waitTimeComm = 0.0;
+}
+
+void CFEM_DG_EulerSolver::JFNK_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
+                                                    CNumerics **numerics, CConfig *config,
+                                                    unsigned short iMesh, unsigned short RunTime_EqSystem) {
+#ifndef CODI_REVERSE_TYPE
+
+  /* Preprocessing. */
+  Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
+
+  /*--- Allocate the memory for the implicit scheme when this function is called
+        for the first time. The blocks of the preconditioner are built then. ---*/
+  const unsigned long nSolOwned = nVar*nDOFsLocOwned;
+  if(VecSolDOFsJFNK.size() != nSolOwned) {
+    VecSolDOFsJFNK.resize(nSolOwned);
+    VecResDOFsJFNK.resize(nSolOwned);
+    TimeCoefJFNK.resize(nVolElemOwned);
+
+    LinSysSol.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+    LinSysRes.Initialize(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+
+    ColorElementsJFNK(config);
+    ageBlocksJFNK = config->GetJFNK_Precond_Rebuild();
+  }
+
+  /*--- Determine the coefficients of the time derivative, which is discretized as
+        (c0*U - c1*U^n - c2*U^(n-1))/dt. For time accurate simulations the variable
+        step size BDF2 scheme is used once the solution of the previous time step is
+        available, otherwise the backward Euler scheme is used. The coefficients are
+        stored divided by the time step of the element. ---*/
+  const bool timeAccurate = config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING;
+  const bool useBDF2      = timeAccurate && !VecSolDOFsTimeN1.empty();
+
+  vector<su2double> coefTimeN(nVolElemOwned), coefTimeN1(nVolElemOwned, 0.0);
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    su2double c0 = 1.0, c1 = 1.0;
+    if( useBDF2 ) {
+      const su2double omega = VecDeltaTime[l]/VecDeltaTimeTimeN1[l];
+      c0            = (1.0 + 2.0*omega)/(1.0 + omega);
+      c1            =  1.0 + omega;
+      coefTimeN1[l] = -omega*omega/(1.0 + omega);
+    }
+
+    TimeCoefJFNK[l] = c0/VecDeltaTime[l];
+    coefTimeN[l]    = c1/VecDeltaTime[l];
+    coefTimeN1[l]  /= VecDeltaTime[l];
+  }
+
+  /*--- Determine whether the blocks of the preconditioner must be rebuilt. This is
+        done periodically and, for time accurate simulations, when the coefficient of
+        the new solution changes. For steady problems the local time steps change
+        slowly, hence the blocks are not rebuilt for that reason. As a residual
+        evaluation is needed for every column of the blocks, this decision must
+        be the same on all ranks. ---*/
+  int rebuildBlocks = ageBlocksJFNK >= config->GetJFNK_Precond_Rebuild();
+  if(timeAccurate && nVolElemOwned) {
+    if(fabs(TimeCoefJFNK[0] - timeCoefBlocksJFNK) > 1.e-6*fabs(TimeCoefJFNK[0])) rebuildBlocks = 1;
+  }
+
+#ifdef HAVE_MPI
+  int rebuildLoc = rebuildBlocks;
+  SU2_MPI::Allreduce(&rebuildLoc, &rebuildBlocks, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+#endif
+
+  /*--- Newton iterations, starting from the solution of the previous time step. ---*/
+  const unsigned short nNewtonIter = config->GetJFNK_Newton_Iter();
+  const su2double      newtonTol   = config->GetJFNK_Newton_Tol();
+
+  for(unsigned long i=0; i<nSolOwned; ++i) VecSolDOFsJFNK[i] = VecSolDOFs[i];
+
+  JFNK_Product     product(this, geometry, solver_container, numerics, config, iMesh);
+  JFNK_BlockJacobi precond(this);
+
+  su2double normRes0 = 0.0, linRes = 0.0;
+  unsigned long linIter = 0;
+
+  for(unsigned short iNewton=0; iNewton<nNewtonIter; ++iNewton) {
+
+    /* Compute the spatial residual of the Newton iterate. */
+    SpatialResidualJFNK(VecSolDOFsJFNK.data(), geometry, solver_container, numerics, config, iMesh);
+    for(unsigned long i=0; i<nSolOwned; ++i) VecResDOFsJFNK[i] = VecResDOFs[i];
+
+    /* Compute the nonlinear residual. Its negative is the right hand side
+       of the linear system for the Newton update. */
+    for(unsigned long l=0; l<nVolElemOwned; ++l) {
+      const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+      const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+
+      for(unsigned short j=0; j<nVarNDOFs; ++j) {
+        const unsigned long k = offset + j;
+        su2double res = TimeCoefJFNK[l]*VecSolDOFsJFNK[k] - coefTimeN[l]*VecSolDOFs[k] + VecResDOFsJFNK[k];
+        if( useBDF2 ) res -= coefTimeN1[l]*VecSolDOFsTimeN1[k];
+        LinSysRes[k] = -res;
+      }
+    }
+
+    /* Check the convergence of the Newton iterations. */
+    const su2double normRes = LinSysRes.norm();
+    if(iNewton == 0) normRes0 = normRes;
+    else if(normRes <= newtonTol*normRes0) break;
+
+    /* Build the blocks of the preconditioner around the current iterate, if needed. */
+    if( rebuildBlocks ) {
+      BuildBlockJacobiJFNK(geometry, solver_container, numerics, config, iMesh);
+      rebuildBlocks = 0;
+    }
+
+    /* Numerator of the finite difference step of the Jacobian-vector products,
+       sqrt(eps_machine)*sqrt(1 + ||U||^2). */
+    su2double normSol2 = 0.0;
+    for(unsigned long i=0; i<nSolOwned; ++i) normSol2 += VecSolDOFsJFNK[i]*VecSolDOFsJFNK[i];
+
+#ifdef HAVE_MPI
+    su2double normSol2Loc = normSol2;
+    SU2_MPI::Allreduce(&normSol2Loc, &normSol2, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+#endif
+    EpsNumeratorJFNK = sqrt(EPS)*sqrt(1.0 + normSol2);
+
+    /* Solve the linear system for the Newton update and update the iterate. */
+    LinSysSol.SetValZero();
+    linIter = SystemJFNK.FGMRES_LinSolver(LinSysRes, LinSysSol, product, precond,
+                                          config->GetLinear_Solver_Error(), config->GetLinear_Solver_Iter(),
+                                          linRes, false, config);
+
+    for(unsigned long i=0; i<nSolOwned; ++i) VecSolDOFsJFNK[i] += LinSysSol[i];
+  }
+
+  SetIterLinSolver(linIter);
+  SetResLinSolver(linRes);
+
+  /*--- Store the data of the current time step needed by BDF2 and the new solution. ---*/
+  if( timeAccurate ) {
+    VecSolDOFsTimeN1   = VecSolDOFs;
+    VecDeltaTimeTimeN1 = VecDeltaTime;
+  }
+  for(unsigned long i=0; i<nSolOwned; ++i) VecSolDOFs[i] = VecSolDOFsJFNK[i];
+  ++ageBlocksJFNK;
+
+  /*--- The spatial residual of the last Newton iterate is monitored. The working
+        solution contains the last perturbed state and is reset. ---*/
+  for(unsigned long i=0; i<nSolOwned; ++i) VecResDOFs[i] = VecResDOFsJFNK[i];
+  Set_OldSolution();
+
+  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
+        function of CSolver cannot be used, because that is for the FV solver. ---*/
+  SetResidual_RMS_FEM(geometry, config);
+
+  /*--- For verification cases, compute the global error metrics. ---*/
+  ComputeVerificationError(geometry, config);
+
+  /* Postprocessing. */
+  Postprocessing(geometry, solver_container, config, iMesh);
+
+#else
+  SU2_MPI::Error("The implicit DG scheme is not available in reverse mode AD builds.", CURRENT_FUNCTION);
+#endif
+}
+
+void CFEM_DG_EulerSolver::SpatialResidualJFNK(const su2double *sol,
+                                              CGeometry       *geometry,
+                                              CSolver         **solver_container,
+                                              CNumerics       **numerics,
+                                              CConfig         *config,
+                                              unsigned short  iMesh) {
+
+  /* Copy the solution of the owned DOFs into the working vector. The halo data
+     is communicated when the tasks are processed. */
+  su2double *solWork = VecWorkSolDOFs[0].data();
+  for(unsigned long i=0; i<nVar*nDOFsLocOwned; ++i) solWork[i] = sol[i];
+
+  /* Carry out all the tasks to compute the residual. */
+  ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+}
+
+void CFEM_DG_EulerSolver::ColorElementsJFNK(CConfig *config) {
+
+  /*--- Determine the face neighbors of the owned elements. Only owned neighbors are
+        considered, hence an element of another rank with the same color may perturb
+        the halo data of an element while its block is computed. This only affects
+        the quality of the preconditioner, not the converged solution. ---*/
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  vector<vector<unsigned long> > neighbors(nVolElemOwned);
+
+  for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
+    const unsigned long elem0 = matchingInternalFaces[i].elemID0;
+    const unsigned long elem1 = matchingInternalFaces[i].elemID1;
+
+    if((elem0 < nVolElemOwned) && (elem1 < nVolElemOwned)) {
+      neighbors[elem0].push_back(elem1);
+      neighbors[elem1].push_back(elem0);
+    }
+  }
+
+  /*--- Greedy coloring, each element gets the lowest color not used by its neighbors. ---*/
+  vector<int> colorElem(nVolElemOwned, -1);
+  vector<bool> colorUsed;
+  unsigned long nColorsLoc = 0, nColors;
+
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    colorUsed.assign(nColorsLoc+1, false);
+    for(const auto nb : neighbors[l])
+      if(colorElem[nb] >= 0) colorUsed[colorElem[nb]] = true;
+
+    int color = 0;
+    while( colorUsed[color] ) ++color;
+    colorElem[l] = color;
+    nColorsLoc   = max(nColorsLoc, (unsigned long) color+1);
+  }
+
+  /*--- Every color requires residual evaluations, which contain communication.
+        Hence the number of colors must be the same on all ranks. ---*/
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nColorsLoc, &nColors, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+#else
+  nColors = nColorsLoc;
+#endif
+
+  elemPerColorJFNK.assign(nColors, vector<unsigned long>(0));
+  for(unsigned long l=0; l<nVolElemOwned; ++l)
+    elemPerColorJFNK[colorElem[l]].push_back(l);
+
+  if(rank == MASTER_NODE)
+    cout << "Implicit DG scheme: " << nColors << " element colors for the block Jacobi preconditioner." << endl;
+}
+
+void CFEM_DG_EulerSolver::BuildBlockJacobiJFNK(CGeometry      *geometry,
+                                               CSolver        **solver_container,
+                                               CNumerics      **numerics,
+                                               CConfig        *config,
+                                               unsigned short iMesh) {
+
+  /*--- Determine the size of the largest block, which must be the same on all ranks,
+        because a residual evaluation is needed for every column of the blocks. ---*/
+  unsigned long nColumnsLoc = 0, nColumns;
+  for(unsigned long l=0; l<nVolElemOwned; ++l)
+    nColumnsLoc = max(nColumnsLoc, (unsigned long) nVar*volElem[l].nDOFsSol);
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nColumnsLoc, &nColumns, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+#else
+  nColumns = nColumnsLoc;
+#endif
+
+  InvBlocksJFNK.resize(nVolElemOwned);
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+    InvBlocksJFNK[l].resize(nVarNDOFs, nVarNDOFs);
+  }
+
+  /*--- Compute the diagonal blocks of the spatial Jacobian by finite differences. The
+        elements of a color are not face neighbors, hence they can be perturbed
+        simultaneously. The working solution is reset to the iterate after every column. ---*/
+  su2double *solWork = VecWorkSolDOFs[0].data();
+  for(unsigned long i=0; i<nVar*nDOFsLocOwned; ++i) solWork[i] = VecSolDOFsJFNK[i];
+
+  vector<su2double> stepFD(nVolElemOwned);
+
+  for(unsigned long color=0; color<elemPerColorJFNK.size(); ++color) {
+    const vector<unsigned long> &elemColor = elemPerColorJFNK[color];
+
+    for(unsigned long col=0; col<nColumns; ++col) {
+
+      /* Perturb this column for the elements of the current color. */
+      for(const auto l : elemColor) {
+        if(col >= nVar*volElem[l].nDOFsSol) continue;
+        const unsigned long k = nVar*volElem[l].offsetDOFsSolLocal + col;
+        stepFD[l]   = sqrt(EPS)*(1.0 + fabs(VecSolDOFsJFNK[k]));
+        solWork[k] += stepFD[l];
+      }
+
+      /* Compute the perturbed residual, the halo data is communicated. */
+      ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+      /* Store the column of the blocks, including the time derivative term,
+         and reset the perturbation. */
+      for(const auto l : elemColor) {
+        const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+        if(col >= nVarNDOFs) continue;
+
+        const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+        const su2double stepInv    = 1.0/stepFD[l];
+        for(unsigned short row=0; row<nVarNDOFs; ++row)
+          InvBlocksJFNK[l](row,col) = stepInv*(VecResDOFs[offset+row] - VecResDOFsJFNK[offset+row]);
+        InvBlocksJFNK[l](col,col) += TimeCoefJFNK[l];
+
+        solWork[offset+col] = VecSolDOFsJFNK[offset+col];
+      }
+    }
+  }
+
+  /*--- Invert the blocks. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l)
+    CBlasStructure::inverse(nVar*volElem[l].nDOFsSol, InvBlocksJFNK[l]);
+
+  timeCoefBlocksJFNK = nVolElemOwned ? TimeCoefJFNK[0] : su2double(0.0);
+  ageBlocksJFNK      = 0;
+}
+
+void CFEM_DG_EulerSolver::JacobianProductJFNK(const CSysVector<su2double> &u,
+                                              CSysVector<su2double>       &v,
+                                              CGeometry                   *geometry,
+                                              CSolver                     **solver_container,
+                                              CNumerics                   **numerics,
+                                              CConfig                     *config,
+                                              unsigned short              iMesh) {
+
+  /*--- The norm is global, hence all ranks return here or none. ---*/
+  const su2double normU = u.norm();
+  if(normU == 0.0) {
+    v.SetValZero();
+    return;
+  }
+
+  /*--- Spatial residual of the perturbed iterate. ---*/
+  const su2double eps = EpsNumeratorJFNK/normU;
+
+  su2double *solWork = VecWorkSolDOFs[0].data();
+  for(unsigned long i=0; i<nVar*nDOFsLocOwned; ++i) solWork[i] = VecSolDOFsJFNK[i] + eps*u[i];
+
+  ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
+
+  /*--- Product with the Newton matrix, time derivative plus spatial Jacobian. ---*/
+  const su2double epsInv = 1.0/eps;
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long offset     = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned short nVarNDOFs = nVar*volElem[l].nDOFsSol;
+
+    for(unsigned short j=0; j<nVarNDOFs; ++j) {
+      const unsigned long k = offset + j;
+      v[k] = TimeCoefJFNK[l]*u[k] + epsInv*(VecResDOFs[k] - VecResDOFsJFNK[k]);
+    }
+  }
+}
+
+void CFEM_DG_EulerSolver::ApplyBlockJacobiJFNK(const CSysVector<su2double> &u,
+                                               CSysVector<su2double>       &v) const {
+
+  /*--- Multiply the vector with the inverse of the element blocks. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    const int nVarNDOFs        = nVar*volElem[l].nDOFsSol;
+
+    blasFunctions->gemv(nVarNDOFs, nVarNDOFs, InvBlocksJFNK[l].data(), &u[offset], &v[offset]);
+  }
+}
+
 void CFEM_DG_EulerSolver::TolerancesADERPredictorStep() {
 
   /* Determine the maximum values of the conservative variables of the
@@ -4868,7 +5491,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -4922,7 +5545,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -4971,7 +5594,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -5133,7 +5756,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -5199,7 +5822,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -5251,7 +5874,7 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -5371,7 +5994,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5461,7 +6084,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -5586,7 +6209,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5696,7 +6319,7 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -5884,6 +6507,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     su2double *sources = solDOFs + nDOFs*NPad;
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *workSF  = fluxes  + nInt*nDim*NPad;
+
+    /* Quadrilaterals and hexahedra use sum-factorization instead of gemm. */
+    const bool tensorKernels = standardElementsSol[ind].TensorProductKernels();
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5908,7 +6535,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product to determine
        the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    if( tensorKernels )
+      standardElementsSol[ind].TensorProductInterpolation(NPad, solDOFs, solInt, workSF);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5933,7 +6563,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
@@ -6021,7 +6651,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
@@ -6143,7 +6773,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const unsigned short iNPad = i*NPad;
 
             /* Determine the integration weight multiplied by the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double weightJac    = weights[i]*metricTerms[0];
 
@@ -6174,12 +6804,17 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /*------------------------------------------------------------------------*/
 
     /* Call the general function to carry out the matrix product.
-       Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+       Use solDOFs as a temporary storage for the matrix product. For the
+       tensor product elements the source terms are included directly. */
+    if( tensorKernels )
+      standardElementsSol[ind].TensorProductResidual(NPad, fluxes, addSourceTerms ? sources : nullptr,
+                                                     solDOFs, workSF);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
-    if( addSourceTerms ) {
+    if( addSourceTerms && !tensorKernels ) {
 
       /* Call the general function to carry out the matrix product. */
       blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
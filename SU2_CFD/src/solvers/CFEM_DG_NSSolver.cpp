@@ -500,7 +500,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double *solDOFDs    = solDOFDr   + offDeriv;
                     const su2double *normals     = surfElem[lll].metricNormalsFace.data()
                                                  + i*(nDim+1);
-                    const su2double *metricTerms = surfElem[lll].metricCoorDerivFace.data()
+                    const su2metricfloat *metricTerms = surfElem[lll].metricCoorDerivFace.data()
                                                  + i*nDim*nDim;
                     const su2double *Coord       = surfElem[lll].coorIntegrationPoints.data()
                                                  + i*nDim;
@@ -609,7 +609,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double *solDOFDt    = solDOFDs   + offDeriv;
                     const su2double *normals     = surfElem[lll].metricNormalsFace.data()
                                                  + i*(nDim+1);
-                    const su2double *metricTerms = surfElem[lll].metricCoorDerivFace.data()
+                    const su2metricfloat *metricTerms = surfElem[lll].metricCoorDerivFace.data()
                                                  + i*nDim*nDim;
                     const su2double *Coord       = surfElem[lll].coorIntegrationPoints.data()
                                                  + i*nDim;
@@ -1495,7 +1495,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -1549,7 +1549,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -1598,7 +1598,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -1867,7 +1867,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -1933,7 +1933,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -1985,7 +1985,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -2147,7 +2147,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -2177,7 +2177,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          HIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms2ndDer = elem->metricTerms2ndDer.data()
+      const su2metricfloat *metricTerms2ndDer = elem->metricTerms2ndDer.data()
                                          + i*nMetric2ndDerPerPoint;
 
       /* Compute the Cartesian second derivatives of the independent solution
@@ -2378,7 +2378,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -2546,7 +2546,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -2591,7 +2591,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          HIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms2ndDer = elem->metricTerms2ndDer.data()
+      const su2metricfloat *metricTerms2ndDer = elem->metricTerms2ndDer.data()
                                          + i*nMetric2ndDerPerPoint;
 
       /* Compute the Cartesian second derivatives of the independent solution
@@ -2940,7 +2940,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
              THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
              THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
              BE TAKEN. */
-          const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+          const su2metricfloat *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
           const su2double weightJac    = weights[i]*metricTerms[0];
 
           /* Compute the source terms of the manufactured solution.
@@ -2989,6 +2989,9 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
                                                   const unsigned long elemEnd,
                                                   su2double           *workArray) {
 
+  /*--- Margin (in the logarithm of the sensor) of the threshold of the cheap first pass. ---*/
+  const su2double firstPassMargin = 4.0;
+
   /*--- Dummy variable for storing shock sensor value temporarily ---*/
   su2double sensorVal, sensorLowerBound, machNorm, machMax;
   su2double DensityInv, Velocity2, StaticEnergy, SoundSpeed2, Velocity2Rel;
@@ -3033,6 +3036,58 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
         break;
     }
 
+    /* Following switch is purely empirical from NACA0012 case.
+       Need to develop thorough method for general problems. */
+    switch ( nPoly ) {
+      case 1:  sensorLowerBound =  -6.0; break;
+      case 2:  sensorLowerBound = -12.0; break;
+      case 3:  sensorLowerBound = -12.0; break;
+      case 4:  sensorLowerBound = -17.0; break;
+      default: sensorLowerBound = -17.0; break;
+    }
+
+    /* Easier storage of the solution variables for this element. */
+    const unsigned short timeLevel = volElem[l].timeLevel;
+    const su2double *solDOFs = VecWorkSolDOFs[timeLevel].data()
+                             + nVar*volElem[l].offsetDOFsSolThisTimeLevel;
+
+    /*---------------------------------------------------------------------*/
+    /*--- Step 1b: Cheap first pass, decay of the modal coefficients of ---*/
+    /*---          the density, which needs no fluid model evaluations. ---*/
+    /*---          Elements in the buffer of the previously troubled    ---*/
+    /*---          elements are not screened.                           ---*/
+    /*---------------------------------------------------------------------*/
+
+    if( !shockSensorBuffer[l] ) {
+
+      /* Modal coefficients of the density, column by column of the inverse
+         Vandermonde matrix, such that the inner loop is contiguous. */
+      su2double *rhoModal = workArray;
+      for(unsigned short i=0; i<nDOFs; ++i) rhoModal[i] = 0.0;
+
+      for(unsigned short j=0; j<nDOFs; ++j) {
+        const su2double rho = solDOFs[j*nVar];
+        const su2double *colVanderInv = matVanderInv + j*nDOFs;
+        for(unsigned short i=0; i<nDOFs; ++i) rhoModal[i] += colVanderInv[i]*rho;
+      }
+
+      su2double highModes = 0.0, allModes = 0.0;
+      for(unsigned short i=0; i<nDOFs; ++i) {
+        const su2double coef2 = rhoModal[i]*rhoModal[i];
+        allModes += coef2;
+        if(i >= nDOFsPm1) highModes += coef2;
+      }
+
+      /* The threshold is looser than the one of the full sensor, the mean of the
+         density dominates its modal energy more than the mean of the Mach number. */
+      if(highModes <= exp(sensorLowerBound - firstPassMargin)*allModes) {
+        volElem[l].shockSensorValue         = -1000.0;
+        volElem[l].shockArtificialViscosity = 0.0;
+        volElem[l].shockTroubled            = false;
+        continue;
+      }
+    }
+
     /*---------------------------------------------------------------------*/
     /*--- Step 2: Calculate the shock sensor value for this element.    ---*/
     /*---------------------------------------------------------------------*/
@@ -3041,12 +3096,6 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
     sensorVal = 0;
     machMax = -1;
     shockExist = false;
-    sensorLowerBound = 1.e15;
-
-    /* Easier storage of the solution variables for this element. */
-    const unsigned short timeLevel = volElem[l].timeLevel;
-    const su2double *solDOFs = VecWorkSolDOFs[timeLevel].data()
-                             + nVar*volElem[l].offsetDOFsSolThisTimeLevel;
 
     /* Temporary storage of mach number for DOFs in this element. */
     su2double *machSolDOFs = workArray;
@@ -3121,16 +3170,6 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
     /*--- Step 3: Determine artificial viscosity for this element.      ---*/
     /*---------------------------------------------------------------------*/
     if (shockExist) {
-      // Following if-else clause is purely empirical from NACA0012 case.
-      // Need to develop thorough method for general problems.
-      switch ( nPoly ) {
-        case 1:  sensorLowerBound =  -6.0; break;
-        case 2:  sensorLowerBound = -12.0; break;
-        case 3:  sensorLowerBound = -12.0; break;
-        case 4:  sensorLowerBound = -17.0; break;
-        default: sensorLowerBound = -17.0; break;
-      }
-
       // Assign artificial viscosity based on shockSensorValue
       if ( volElem[l].shockSensorValue > sensorLowerBound ) {
         // Following value is initial guess.
@@ -3143,6 +3182,9 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
     else {
       volElem[l].shockArtificialViscosity = 0.0;
     }
+
+    /* Make the troubled elements available to the buffer and the output. */
+    volElem[l].shockTroubled = volElem[l].shockArtificialViscosity > 0.0;
   }
 }
 
@@ -3262,7 +3304,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
@@ -3425,7 +3467,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
@@ -3655,7 +3697,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const unsigned short iNPad = i*NPad;
 
             /* Determine the integration weight multiplied by the Jacobian. */
-            const su2double *metricTerms = volElem[lInd].metricTerms.data()
+            const su2metricfloat *metricTerms = volElem[lInd].metricTerms.data()
                                          + i*nMetricPerPoint;
             const su2double weightJac    = weights[i]*metricTerms[0];
 
@@ -4140,7 +4182,7 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
                                              const bool              HeatFlux_Prescribed,
                                              const su2double         *solInt,
                                              const su2double         *gradSolInt,
-                                             const su2double         *metricCoorDerivFace,
+                                             const su2metricfloat    *metricCoorDerivFace,
                                              const su2double         *metricNormalsFace,
                                              const su2double         *wallDistanceInt,
                                                    su2double         *viscNormFluxes,
@@ -4180,7 +4222,7 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
            the solution and the gradients, w.r.t. the parametric coordinates
            of this solution. */
         const unsigned short offPointer = NPad*i + nVar*indFaceChunk;
-        const su2double *metricTerms = metricCoorDerivFace + i*nDim*nDim;
+        const su2metricfloat *metricTerms = metricCoorDerivFace + i*nDim*nDim;
         const su2double *sol         = solInt     + offPointer;
         const su2double *dSolDr      = gradSolInt + offPointer;
         const su2double *dSolDs      = dSolDr     + offDeriv;
@@ -4239,7 +4281,7 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
            the solution and the gradients, w.r.t. the parametric coordinates
            of this solution. */
         const unsigned short offPointer = NPad*i + nVar*indFaceChunk;
-        const su2double *metricTerms = metricCoorDerivFace + i*nDim*nDim;
+        const su2metricfloat *metricTerms = metricCoorDerivFace + i*nDim*nDim;
         const su2double *sol         = solInt     + offPointer;
         const su2double *dSolDr      = gradSolInt + offPointer;
         const su2double *dSolDs      = dSolDr     + offDeriv;
@@ -4866,7 +4908,7 @@ void CFEM_DG_NSSolver::TransformSymmetrizingFluxes(const unsigned short indFaceC
                                                    const su2double      halfTheta,
                                                    const su2double      *symmFluxes,
                                                    const su2double      *weights,
-                                                   const su2double      *metricCoorFace,
+                                                   const su2metricfloat *metricCoorFace,
                                                          su2double      *paramFluxes) {
 
   /*--- Transform the fluxes, such that they must be multiplied with the
@@ -4897,7 +4939,7 @@ void CFEM_DG_NSSolver::TransformSymmetrizingFluxes(const unsigned short indFaceC
         su2double *paramFlux   =  paramFluxes + offPointer;
 
         /* Compute the modified metric terms. */
-        const su2double *metricTerms = metricCoorFace + 4*i;   // The 4 is nDim*nDim;
+        const su2metricfloat *metricTerms = metricCoorFace + 4*i;   // The 4 is nDim*nDim;
         const su2double drdx = wTheta*metricTerms[0];
         const su2double drdy = wTheta*metricTerms[1];
         const su2double dsdx = wTheta*metricTerms[2];
@@ -4936,7 +4978,7 @@ void CFEM_DG_NSSolver::TransformSymmetrizingFluxes(const unsigned short indFaceC
         su2double *paramFlux   =  paramFluxes + offPointer;
 
         /* Compute the modified metric terms. */
-        const su2double *metricTerms = metricCoorFace + 9*i;   // The 9 is nDim*nDim;
+        const su2metricfloat *metricTerms = metricCoorFace + 9*i;   // The 9 is nDim*nDim;
         const su2double drdx = wTheta*metricTerms[0];
         const su2double drdy = wTheta*metricTerms[1];
         const su2double drdz = wTheta*metricTerms[2];
@@ -5274,7 +5316,7 @@ void CFEM_DG_NSSolver::BC_Sym_Plane(CConfig                  *config,
 
             /* Easier storage of the metric terms and left gradients of this
                integration point. */
-            const su2double *metricTerms = surfElem[ll].metricCoorDerivFace.data()
+            const su2metricfloat *metricTerms = surfElem[ll].metricCoorDerivFace.data()
                                          + i*nDim*nDim;
             const su2double *dULDr       = gradSolInt + pointerOffset;
             const su2double *dULDs       = dULDr + offDeriv;
@@ -5392,7 +5434,7 @@ void CFEM_DG_NSSolver::BC_Sym_Plane(CConfig                  *config,
 
             /* Easier storage of the metric terms and left gradients of this
                integration point. */
-            const su2double *metricTerms = surfElem[ll].metricCoorDerivFace.data()
+            const su2metricfloat *metricTerms = surfElem[ll].metricCoorDerivFace.data()
                                          + i*nDim*nDim;
             const su2double *dULDr       = gradSolInt + pointerOffset;
             const su2double *dULDs       = dULDr + offDeriv;
@@ -174,13 +174,17 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
   /*--- current dimension if we run consecutive on each dimension ---*/
   unsigned int iDim = 0;
 
-  /*--- Set vector and sparse matrix to 0 ---*/
+  /*--- Set vectors to 0 ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
-  Jacobian.SetValZero();
 
-  /*--- Compute the stiffness matrix for the smoothing operator. ---*/
-  Compute_StiffMatrix(geometry, numerics, config);
+  /*--- Compute the stiffness matrix for the smoothing operator, unless the mesh did not change. The operator is
+   * isotropic, therefore when separating dimensions the same matrix is used for all of them. ---*/
+  if (!StiffMatrixIsCached(geometry)) {
+    Jacobian.SetValZero();
+    SetCurrentDim(0);
+    Compute_StiffMatrix(geometry, numerics, config);
+  }
 
   /*--- Impose boundary conditions to the RHS and solve the system. ---*/
   if (config->GetSmoothSepDim()) {
@@ -213,17 +217,21 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
 
 void CGradientSmoothingSolver::ApplyGradientSmoothingSurface(CGeometry* geometry, CNumerics* numerics,
                                                              const CConfig* config) {
-  /*--- Set vector and sparse matrix to 0 ---*/
+  /*--- Set vectors to 0, and the sparse matrix if the mesh changed. ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
-  Jacobian.SetValZero();
-  std::fill(visited.begin(), visited.end(), false);
+
+  const bool cached = StiffMatrixIsCached(geometry);
+  if (!cached) {
+    Jacobian.SetValZero();
+    std::fill(visited.begin(), visited.end(), false);
+  }
 
   /*--- Loop over all DV markers to compute the stiffness matrix for the smoothing operator. ---*/
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       /*--- Compute the stiffness matrix for the smoothing operator. ---*/
-      Compute_Surface_StiffMatrix(geometry, numerics, config, iMarker);
+      if (!cached) Compute_Surface_StiffMatrix(geometry, numerics, config, iMarker);
 
       Compute_Surface_Residual(geometry, config, iMarker);
 
@@ -234,7 +242,7 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingSurface(CGeometry* geometry
   }
 
   /*--- Set the matrix to identity if the current mpi rank holds no part of the DV marker. ---*/
-  Complete_Surface_StiffMatrix(geometry);
+  if (!cached) Complete_Surface_StiffMatrix(geometry);
 
   /*--- Solve the system and write the result back. ---*/
   Solve_Linear_System(geometry, config);
@@ -254,8 +262,9 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingDV(CGeometry* geometry, CNu
   vector<su2double> x(nDVtotal, 0.0);
   hessian.Initialize(nDVtotal);
 
-  /*--- Reset the Jacobian to 0 ---*/
+  /*--- Reset the Jacobian to 0, it no longer holds a matrix that can be reused for smoothing. ---*/
   Jacobian.SetValZero();
+  cachedCoord.clear();
 
   /*--- Record the parameterization on the AD tape. ---*/
   if (rank == MASTER_NODE)  cout << " calculate the original gradient" << endl;
@@ -662,6 +671,9 @@ void CGradientSmoothingSolver::Solve_Linear_System(CGeometry* geometry, const CC
   /*--- elimination shedule ---*/
   Set_VertexEliminationSchedule(geometry, config);
 
+  /*--- Reuse the preconditioner (or factorization) if this matrix was already solved. ---*/
+  System.SetMatrixUnchanged(stiffMatrixSolved);
+
   SU2_OMP_PARALLEL
   {
 
@@ -675,6 +687,37 @@ void CGradientSmoothingSolver::Solve_Linear_System(CGeometry* geometry, const CC
   END_SU2_OMP_MASTER
   }
   END_SU2_OMP_PARALLEL
+
+  stiffMatrixSolved = true;
+}
+
+bool CGradientSmoothingSolver::StiffMatrixIsCached(const CGeometry* geometry) {
+  const auto nCoord = geometry->GetnPoint() * nDim;
+
+  int unchanged = (cachedCoord.size() == nCoord);
+  for (auto iPoint = 0ul; unchanged && iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      if (cachedCoord[iPoint * nDim + iDim] != SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim))) {
+        unchanged = 0;
+        break;
+      }
+    }
+  }
+
+  /*--- All ranks must agree, e.g. the PaStiX factorization is collective. ---*/
+  int allUnchanged = unchanged;
+  SU2_MPI::Allreduce(&unchanged, &allUnchanged, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (allUnchanged) return true;
+
+  cachedCoord.resize(nCoord);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      cachedCoord[iPoint * nDim + iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+    }
+  }
+  stiffMatrixSolved = false;
+  return false;
 }
 
 template <typename scalar_type>
@@ -62,7 +62,7 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   /*--- Initialization of the structure of the whole Jacobian ---*/
 
   if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (heat equation) MG level: " << iMesh << "." << endl;
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   if (ReducerStrategy) EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
@@ -150,6 +150,9 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   const bool euler_implicit = (config->GetKind_TimeIntScheme_Heat() == EULER_IMPLICIT);
   SetImplicitPeriodic(euler_implicit);
 
+  /*--- Conduction in solids is linear with constant coefficients, the matrix can be assembled once. ---*/
+  frozenSystem = !flow && heat_equation && euler_implicit && config->GetHeat_Frozen_System();
+
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
@@ -181,7 +184,7 @@ void CHeatSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container,
    * for the weakly coupled energy equation the convection part does this by setting instead of incrementing. ---*/
   if (!Output && !flow && ReducerStrategy) {
     EdgeFluxes.SetValZero();
-    if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) {
+    if (config->GetKind_TimeIntScheme() == EULER_IMPLICIT && !frozenJacobian) {
       Jacobian.SetValZero();
     } else {
       SU2_OMP_BARRIER
@@ -213,23 +216,15 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   /*--- Load data from the restart into correct containers. ---*/
   unsigned long counter = 0;
-  for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-
-    const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
-
-    if (iPoint_Local > -1) {
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+  for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto index = counter*Restart_Vars[1] + skipVars;
-      for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
+    const auto index = counter*Restart_Vars[1] + skipVars;
+    for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
 
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -282,7 +277,7 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   /*--- For fluid problems the viscous residual is included in the convective residual. ---*/
   if (flow) return;
-  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) && !frozenJacobian;
   CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num() * MAX_TERMS];
 
   bool pausePreacc = false;
@@ -306,7 +301,7 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
 
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
-    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+    if (implicit) Jacobian.SetDiagonalAsColumnSum(geometry);
   }
 }
 
@@ -530,7 +525,8 @@ void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
 void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short val_marker) {
 
-  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  /*--- With a frozen system the conductance of the interface is kept at its first value in the matrix. ---*/
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT) && !frozenJacobian;
   const su2double Temperature_Ref = config->GetTemperature_Ref();
   const su2double rho_cp_solid = config->GetMaterialDensity(0) * config->GetSpecific_Heat_Cp();
 
@@ -567,7 +563,8 @@ void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solv
         su2double HeatFlux = 0;
 
         if ((config->GetKind_CHT_Coupling() == CHT_COUPLING::DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-            (config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+            (config->GetKind_CHT_Coupling() == CHT_COUPLING::AVERAGED_TEMPERATURE_ROBIN_HEATFLUX) ||
+            (config->GetKind_CHT_Coupling() == CHT_COUPLING::IMPLICIT_ROBIN_HEATFLUX)) {
 
           const su2double Tinterface = nodes->GetTemperature(iPoint);
           const su2double Tnormal_Conjugate = GetConjugateHeatVariable(val_marker, iVertex, 3) / Temperature_Ref;
@@ -1014,7 +1011,7 @@ void CHeatSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_con
     }
 
     /*--- Compute the Jacobian contribution due to the dual time source term. ---*/
-    if (implicit) {
+    if (implicit && !frozenJacobian) {
       if (first_order) Jacobian.AddVal2Diag(iPoint, Volume_nP1 / TimeStep);
       if (second_order) Jacobian.AddVal2Diag(iPoint, (Volume_nP1 * 3.0) / (2.0 * TimeStep));
     }
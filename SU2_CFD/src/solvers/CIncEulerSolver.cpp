@@ -36,6 +36,7 @@
 #include "../../include/fluid/CFluidScalar.hpp"
 #include "../../include/fluid/CFluidFlamelet.hpp"
 #include "../../include/fluid/CFluidModel.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 
 CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh,
@@ -161,7 +162,7 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
   }
   else {
     if (rank == MASTER_NODE)
@@ -177,26 +178,28 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch (config->GetDirectDiff()) {
-    case NO_DERIVATIVE:
-      /*--- Default ---*/
-      break;
-    case D_DENSITY:
-      SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-      break;
-    case D_PRESSURE:
-      SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Already done in postprocessing of config ---*/
-      break;
-    default:
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE:
+        /*--- Default ---*/
+        break;
+      case D_DENSITY:
+        SU2_TYPE::SetDerivative(Density_Inf, iDir, 1.0);
+        break;
+      case D_PRESSURE:
+        SU2_TYPE::SetDerivative(Pressure_Inf, iDir, 1.0);
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, iDir, 1.0);
+        break;
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Already done in postprocessing of config ---*/
+        break;
+      default:
+        break;
+    }
   }
 
   SetReferenceValues(*config);
@@ -236,6 +239,26 @@ CIncEulerSolver::~CIncEulerSolver() {
   for(auto& model : FluidModel) delete model;
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+
+  /*--- The mass fluxes are needed by the upwind schemes of bounded scalars. ---*/
+  su2double* massFluxes = config->GetBounded_Scalar()? EdgeMassFluxes.data() : nullptr;
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes(), massFluxes);
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, nullptr, massFluxes);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme in use does not support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
   su2double Temperature_FreeStream = 0.0,  ModVel_FreeStream = 0.0,Energy_FreeStream = 0.0,
@@ -413,9 +436,6 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
   if (tkeNeeded) { Energy_FreeStream += Tke_FreeStream; };
   config->SetEnergy_FreeStream(Energy_FreeStream);
 
-  /*--- Auxilary (dimensional) FluidModel no longer needed. ---*/
-  delete auxFluidModel;
-
   /*--- Compute Mach number ---*/
 
   if (config->GetKind_FluidModel() == CONSTANT_DENSITY) {
@@ -528,6 +548,10 @@ void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short i
 
   }
 
+  /*--- Auxilary (dimensional) FluidModel no longer needed, it is deleted after creating the final
+   *    ones so that they can reuse its data (e.g. binary lookup tables in shared memory). ---*/
+  delete auxFluidModel;
+
   Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
@@ -952,17 +976,21 @@ void CIncEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_
 
   /*--- Set the primitive variables ---*/
 
-  ompMasterAssignBarrier(ErrorCounter, 0);
+  ompMasterAssignBarrier(ErrorCounter, 0, TransportCacheHits, 0);
 
+  CRuntimeProfiler::Begin(CRuntimeProfiler::SECTION::FLUID_MODEL);
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
+  CRuntimeProfiler::End(CRuntimeProfiler::SECTION::FLUID_MODEL);
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
     BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
     {
-      unsigned long tmp = ErrorCounter;
-      SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      unsigned long tmp[] = {ErrorCounter, TransportCacheHits}, counters[2] = {0};
+      SU2_MPI::Allreduce(tmp, counters, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      ErrorCounter = counters[0];
       config->SetNonphysical_Points(ErrorCounter);
+      config->SetTransport_Cache_Hits(counters[1]);
     }
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
   }
@@ -1013,20 +1041,10 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
   if (!Output && muscl && !center) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
-
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
-
-    /*--- Limiter computation ---*/
+    /*--- Gradient and limiter computation for MUSCL reconstruction. ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method_Recon(), true,
+                                  limiter && !van_albada);
   }
 }
 
@@ -1137,6 +1155,7 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
 
     iPoint = geometry->edges->GetNode(iEdge,0); jPoint = geometry->edges->GetNode(iEdge,1);
+    if (FrozenEdge(iPoint, jPoint)) continue;
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
 
@@ -1198,7 +1217,7 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
   if (ReducerStrategy) {
     SumEdgeFluxes(geometry);
     if (implicit)
-      Jacobian.SetDiagonalAsColumnSum();
+      Jacobian.SetDiagonalAsColumnSum(geometry);
   }
 
 }
@@ -1206,6 +1225,12 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Use vectorization if requested, the viscous fluxes are included via a decorator. ---*/
+  if (config->GetUseVectorization() && (config->GetKind_Upwind_Flow() == UPWIND::FDS)) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
@@ -1242,6 +1267,7 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
     /*--- Points in edge and normal vectors ---*/
 
     iPoint = geometry->edges->GetNode(iEdge,0); jPoint = geometry->edges->GetNode(iEdge,1);
+    if (FrozenEdge(iPoint, jPoint)) continue;
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Grid movement ---*/
@@ -1775,9 +1801,8 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
   if (VerificationSolution) {
     if ( VerificationSolution->IsManufacturedSolution() ) {
 
-      /*--- Get the physical time. ---*/
-      su2double time = 0.0;
-      if (config->GetTime_Marching() != TIME_MARCHING::STEADY) time = config->GetPhysicalTime();
+      /*--- Get the MMS source terms (computed once for steady problems). ---*/
+      const auto& sourceMan = GetVerificationSourceTerms(geometry, config);
 
       AD::StartNoSharedReading();
 
@@ -1788,16 +1813,9 @@ void CIncEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_cont
         /*--- Get control volume size. ---*/
         su2double Volume = geometry->nodes->GetVolume(iPoint);
 
-        /*--- Get the current point coordinates. ---*/
-        const su2double *coor = geometry->nodes->GetCoord(iPoint);
-
-        /*--- Get the MMS source term. ---*/
-        vector<su2double> sourceMan(nVar,0.0);
-        VerificationSolution->GetMMSSourceTerm(coor, time, sourceMan.data());
-
         /*--- Compute the residual for this control volume and subtract. ---*/
         for (iVar = 0; iVar < nVar; iVar++) {
-          LinSysRes[iPoint*nVar+iVar] -= sourceMan[iVar]*Volume;
+          LinSysRes[iPoint*nVar+iVar] -= sourceMan(iPoint,iVar)*Volume;
         }
 
       }
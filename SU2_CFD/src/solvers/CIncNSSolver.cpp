@@ -45,12 +45,14 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
 
   /*--- Initialize the secondary values for direct derivative approximations ---*/
 
-  switch (config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, iDir, 1.0);
+        break;
+      default:
+        break;
+    }
   }
 
   /*--- Set the initial Streamwise periodic pressure drop value. ---*/
@@ -74,31 +76,26 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
-  /*--- Compute gradient for MUSCL reconstruction ---*/
+  /*--- Compute gradient for MUSCL reconstruction. The limiters use the reconstruction gradient (which may
+   *    be the gradient of the primitive variables), they are computed with it if FUSED_GRADIENT_LIMITER,
+   *    otherwise they are computed last. ---*/
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
+  const bool computeLimiter = muscl && !center && limiter && !van_albada && !Output;
+  const bool reconGradient = config->GetReconstructionGradientRequired();
+  const bool fusedLimiter = computeLimiter && config->GetFused_Gradient_Limiter();
+
+  if (reconGradient && muscl && !center) {
+    SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method_Recon(), true, fusedLimiter);
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
-  }
+  SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method(), false,
+                                fusedLimiter && !reconGradient);
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (computeLimiter && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -281,7 +278,7 @@ void CIncNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CS
 
 unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long iPoint, nonPhysicalPoints = 0, cacheHits = 0;
   su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
   const su2double* scalar = nullptr;
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
@@ -317,6 +314,7 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, c
     /* Check for non-realizable states for reporting. */
 
     if (!physical) nonPhysicalPoints++;
+    cacheHits += nodes->GetTransportCacheHit(iPoint);
 
     /*--- Set the DES length scale ---*/
 
@@ -327,6 +325,9 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::EndNoSharedReading();
 
+  SU2_OMP_ATOMIC
+  TransportCacheHits += cacheHits;
+
   return nonPhysicalPoints;
 
 }
@@ -366,6 +367,9 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
                              config->GetHeat_Flux_Ref();
       Tinfinity = config->GetWall_HeatTransfer_Temperature(Marker_Tag) / config->GetTemperature_Ref();
       break;
+    case CHT_WALL_INTERFACE:
+      /*--- Set for each vertex from the conductance and near-wall temperature of the other zone. ---*/
+      break;
     default:
       SU2_MPI::Error("Unknown type of boundary condition.", CURRENT_FUNCTION);
       break;
@@ -420,6 +424,12 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
 
     if (!energy) continue;
 
+    if (kind_boundary == CHT_WALL_INTERFACE) {
+      Transfer_Coefficient = GetConjugateHeatVariable(val_marker, iVertex, 2) * config->GetTemperature_Ref() /
+                             config->GetHeat_Flux_Ref();
+      Tinfinity = GetConjugateHeatVariable(val_marker, iVertex, 3) / config->GetTemperature_Ref();
+    }
+
     switch(kind_boundary) {
     case HEAT_FLUX:
 
@@ -448,6 +458,7 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
       } // if streamwise_periodic
       break;
 
+    case CHT_WALL_INTERFACE:
     case HEAT_TRANSFER:
       Twall = nodes->GetTemperature(iPoint);
       Wall_HeatFlux = Transfer_Coefficient * (Tinfinity - Twall);
@@ -538,6 +549,13 @@ void CIncNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **sol
     SU2_MPI::Error("Wall function treatment not implemented yet.", CURRENT_FUNCTION);
   }
 
+  /*--- Weak (Robin) imposition of the heat flux through the interface, implicit in the wall temperature. ---*/
+
+  if (config->GetKind_CHT_Coupling() == CHT_COUPLING::IMPLICIT_ROBIN_HEATFLUX) {
+    BC_Wall_Generic(geometry, config, val_marker, CHT_WALL_INTERFACE);
+    return;
+  }
+
   /*--- Loop over boundary points ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
@@ -651,6 +669,7 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
     for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
       const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto costScope = geometry->ProfilePointCost(iPoint);
       const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
       /*--- On the finest mesh compute also on halo nodes to avoid communication of tau wall. ---*/
       if ((!geometry->nodes->GetDomain(iPoint)) && !(MGLevel==MESH_0)) continue;
@@ -729,6 +748,20 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
         continue;
       }
 
+      /*--- With the tabulated inverse law, u+ follows directly from U y / nu and no iterations are needed. ---*/
+
+      if (!WallLawTable.empty()) {
+        const su2double Re_y = max(Density_Wall * VelTangMod * WallDistMod / Lam_Visc_Wall, EPS);
+        const su2double U_Plus = WallLawTable.GetUPlus(Re_y);
+        const su2double kUp = kappa * U_Plus;
+
+        U_Tau = VelTangMod / U_Plus;
+        Y_Plus = Re_y / U_Plus;
+        Eddy_Visc_Wall = Lam_Visc_Wall * kappa*exp(-kappa*B) * (exp(kUp) -1.0 - kUp - kUp * kUp / 2.0);
+        Eddy_Visc_Wall = max(1.0e-6, Eddy_Visc_Wall);
+        diff = 0.0;
+      }
+
       /*--- Convergence criterium for the Newton solver, note that 1e-10 is too large ---*/
       const su2double tol = 1e-12;
       while (fabs(diff) > tol) {
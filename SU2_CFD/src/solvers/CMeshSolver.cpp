@@ -29,6 +29,7 @@
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../include/solvers/CMeshSolver.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
 
 using namespace GeometryToolbox;
 
@@ -97,11 +98,24 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(LINE
 
   /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
 
-  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Mesh Deformation)." << endl;
-
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+  /*--- In matrix-free mode only the diagonal blocks of the stiffness are stored (for the preconditioner). ---*/
+  matrix_free = config->GetDeform_Matrix_Free();
+
+  if (matrix_free) {
+    if (rank == MASTER_NODE) cout << "Matrix-free stiffness (Mesh Deformation), the Jacobian is not stored." << endl;
+
+    MatrixFreeAux.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    InvDiagBlocks.resize(nPoint, nVar*nVar) = su2double(0.0);
+    ConstrainedDOF.resize(nPoint*nVar, false);
+  }
+  else {
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Mesh Deformation)." << endl;
+
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
 
   /*--- Initialize structures for hybrid-parallel mode. ---*/
 
@@ -490,11 +504,13 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
 
   /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
 
-  const bool wasActive = AD::BeginPassive();
+  if (!matrix_free) {
+    const bool wasActive = AD::BeginPassive();
 
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+    Compute_StiffMatrix(geometry[MESH_0], numerics, config);
 
-  AD::EndPassive(wasActive);
+    AD::EndPassive(wasActive);
+  }
 
   /*--- Clear residual (loses AD info), we do not want an incremental solution. ---*/
   SU2_OMP_PARALLEL {
@@ -507,6 +523,15 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
           LinSysSol(iPoint, iDim) = nodes->GetSolution(iPoint, iDim);
       END_SU2_OMP_FOR
     }
+    else if (time_domain && config->GetDeform_Warm_Start() && !config->GetDiscrete_Adjoint()) {
+      /*--- Otherwise LinSysSol is the previous displacement, extrapolate it linearly in time. ---*/
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          LinSysSol(iPoint, iDim) = 2.0 * nodes->GetSolution_time_n(iPoint)[iDim] -
+                                    nodes->GetSolution_time_n1(iPoint)[iDim];
+      END_SU2_OMP_FOR
+    }
   }
   END_SU2_OMP_PARALLEL
 
@@ -514,7 +539,8 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   SetBoundaryDisplacements(geometry[MESH_0], config, false);
 
   /*--- Solve the linear system. ---*/
-  Solve_System(geometry[MESH_0], config);
+  if (matrix_free) Solve_System_MatrixFree(geometry[MESH_0], numerics, config);
+  else Solve_System(geometry[MESH_0], config);
 
   SU2_OMP_PARALLEL {
 
@@ -575,11 +601,13 @@ void CMeshSolver::ComputeGridVelocity_FromBoundary(CGeometry **geometry, CNumeri
 
   /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
 
-  const bool wasActive = AD::BeginPassive();
+  if (!matrix_free) {
+    const bool wasActive = AD::BeginPassive();
 
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+    Compute_StiffMatrix(geometry[MESH_0], numerics, config);
 
-  AD::EndPassive(wasActive);
+    AD::EndPassive(wasActive);
+  }
 
   const su2double velRef = config->GetVelocity_Ref();
   const su2double invVelRef = 1.0 / velRef;
@@ -600,7 +628,8 @@ void CMeshSolver::ComputeGridVelocity_FromBoundary(CGeometry **geometry, CNumeri
   SetBoundaryDisplacements(geometry[MESH_0], config, true);
 
   /*--- Solve the linear system. ---*/
-  Solve_System(geometry[MESH_0], config);
+  if (matrix_free) Solve_System_MatrixFree(geometry[MESH_0], numerics, config);
+  else Solve_System(geometry[MESH_0], config);
 
   SU2_OMP_PARALLEL {
     SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -665,7 +694,7 @@ void CMeshSolver::BC_Deforming(CGeometry *geometry, const CConfig *config, unsig
       else Sol[iDim] = nodes->GetBound_Disp(iPoint,iDim);
     }
     LinSysSol.SetBlock(iPoint, Sol);
-    Jacobian.EnforceSolutionAtNode(iPoint, Sol, LinSysRes);
+    EnforceSolutionAtNode(iPoint, Sol);
   }
 }
 
@@ -692,6 +721,9 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
 
   unsigned short iMarker;
 
+  /*--- The known degrees of freedom are flagged again by the boundary conditions. ---*/
+  if (matrix_free) ConstrainedDOF.assign(nPoint*nVar, false);
+
   /*--- Impose zero displacements of all non-moving surfaces that are not MARKER_DEFORM_SYM_PLANE. ---*/
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_Deform_Mesh(iMarker) == NO) &&
@@ -729,7 +761,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
       su2double zeros[MAXNVAR] = {0.0};
       nodes->SetSolution(iPoint, zeros);
       LinSysSol.SetBlock(iPoint, zeros);
-      Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+      EnforceSolutionAtNode(iPoint, zeros);
     }
   }
 
@@ -746,7 +778,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
           su2double zeros[MAXNVAR] = {0.0};
           nodes->SetSolution(iPoint, zeros);
           LinSysSol.SetBlock(iPoint, zeros);
-          Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+          EnforceSolutionAtNode(iPoint, zeros);
           break;
         }
       }
@@ -755,6 +787,327 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
 
 }
 
+void CMeshSolver::EnforceSolutionAtNode(unsigned long iPoint, const su2double* val_sol) {
+
+  if (!matrix_free) return CFEASolver::EnforceSolutionAtNode(iPoint, val_sol);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    ConstrainedDOF[iPoint*nVar + iVar] = true;
+    LinSysSol(iPoint, iVar) = val_sol[iVar];
+  }
+}
+
+void CMeshSolver::EnforceSolutionAtDOF(unsigned long iPoint, unsigned short iVar, su2double val_sol) {
+
+  if (!matrix_free) return CFEASolver::EnforceSolutionAtDOF(iPoint, iVar, val_sol);
+
+  ConstrainedDOF[iPoint*nVar + iVar] = true;
+  LinSysSol(iPoint, iVar) = val_sol;
+}
+
+void CMeshSolver::ComputeStiffnessProduct(const CSysVector<su2double>& u, CSysVector<su2double>& v,
+                                          CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  /*--- Same element loop as Compute_StiffMatrix, but the element kernels compute K_e u_e
+   * directly, which requires much less memory and traffic than the assembled matrix. ---*/
+
+  SU2_OMP_BARRIER
+  v.SetValZero();
+  SU2_OMP_BARRIER
+
+  /*--- Linear simplices are computed in batches, one element per SIMD lane. ---*/
+  auto simplexBatch = [&](const unsigned long* batch, unsigned short nLanes) {
+    if (nDim == 2) StiffnessProductSimplices<2>(u, v, geometry, numerics, config, batch, nLanes);
+    else StiffnessProductSimplices<3>(u, v, geometry, numerics, config, batch, nLanes);
+  };
+
+  auto singleElement = [&](unsigned long iElem) {
+
+    const int thread = omp_get_thread_num();
+
+    /*--- Convert VTK type to index in the element container. ---*/
+    int EL_KIND;
+    unsigned short nNodes;
+    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+    /*--- Each thread needs a dedicated element. ---*/
+    CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+    /*--- The input vector is set as the displacement of the current coordinates. ---*/
+    unsigned long indexNode[MAXNNODE_3D];
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+        element->SetRef_Coord(iNode, iDim, val_Coord);
+        element->SetCurr_Coord(iNode, iDim, val_Coord + u(indexNode[iNode], iDim));
+      }
+    }
+
+    element->Set_ElProperties(element_properties[iElem]);
+
+    const int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+
+    numerics[NUM_TERM]->Compute_Stiffness_Product(element, config);
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+
+      if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+
+      const auto Ta = element->Get_Kt_a(iNode);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        v(indexNode[iNode], iVar) += Ta[iVar];
+
+      if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+    }
+  };
+
+  for (auto color : ElemColoring) {
+    ElementColorLoop(geometry, color, simplexBatch, singleElement);
+  }
+
+  /*--- The rows of the halo points are incomplete, they are obtained from their owners. ---*/
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+
+}
+
+template<size_t NDIM>
+void CMeshSolver::StiffnessProductSimplices(const CSysVector<su2double>& u, CSysVector<su2double>& v,
+                                            const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                            const unsigned long* batch, unsigned short nLanes) {
+  constexpr size_t nNode = NDIM+1;
+
+  unsigned long indexNode[Double::Size][nNode];
+  MatrixDbl<nNode,NDIM> coord, grad, disp, force;
+  Double lambda, mu;
+
+  GatherSimplices<NDIM>(geometry, numerics, config, batch, nLanes, indexNode, coord, lambda, mu);
+
+  for (auto iLane = 0ul; iLane < Double::Size; ++iLane)
+    for (auto iNode = 0ul; iNode < nNode; ++iNode)
+      for (auto iDim = 0ul; iDim < NDIM; ++iDim)
+        disp(iNode,iDim)[iLane] = u(indexNode[iLane][iNode], iDim);
+
+  const Double volume = LinearSimplex::gradients<NDIM>(coord, grad);
+  LinearSimplex::stiffnessProduct<NDIM>(grad, volume, lambda, mu, disp, force);
+
+  for (auto iLane = 0ul; iLane < nLanes; ++iLane) {
+    for (auto iNode = 0ul; iNode < nNode; ++iNode) {
+      const auto iPoint = indexNode[iLane][iNode];
+
+      if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+
+      for (auto iVar = 0ul; iVar < NDIM; ++iVar)
+        v(iPoint, iVar) += force(iNode,iVar)[iLane];
+
+      if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+    }
+  }
+}
+
+void CMeshSolver::ApplyConstrainedStiffness(const CSysVector<su2double>& u, CSysVector<su2double>& v,
+                                            CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  /*--- v = (I-P) K (I-P) u + P u, where P selects the known degrees of freedom. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    MatrixFreeAux[i] = ConstrainedDOF[i]? su2double(0.0) : u[i];
+  END_SU2_OMP_FOR
+
+  ComputeStiffnessProduct(MatrixFreeAux, v, geometry, numerics, config);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    if (ConstrainedDOF[i]) v[i] = u[i];
+  END_SU2_OMP_FOR
+
+}
+
+void CMeshSolver::ComputeBlockJacobi(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  /*--- Only the diagonal blocks of the element matrices are accumulated. ---*/
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+      InvDiagBlocks(iPoint, iVar) = 0.0;
+  END_SU2_OMP_FOR
+
+  for (auto color : ElemColoring) {
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
+
+      const auto iElem = color.indices[k];
+      const int thread = omp_get_thread_num();
+
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+      CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+      unsigned long indexNode[MAXNNODE_3D];
+
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          const su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+          element->SetRef_Coord(iNode, iDim, val_Coord);
+          element->SetCurr_Coord(iNode, iDim, val_Coord);
+        }
+      }
+
+      element->Set_ElProperties(element_properties[iElem]);
+
+      const int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+
+      numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
+
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+
+        if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+
+        const auto Kab = element->Get_Kab(iNode, iNode);
+        for (auto iVar = 0ul; iVar < nVar*nVar; iVar++)
+          InvDiagBlocks(indexNode[iNode], iVar) += Kab[iVar];
+
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Eliminate the rows and columns of the known degrees of freedom and invert the blocks. ---*/
+
+  su2activematrix block(nVar, nVar);
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        block(iVar, jVar) = InvDiagBlocks(iPoint, iVar*nVar + jVar);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      if (!ConstrainedDOF[iPoint*nVar + iVar]) continue;
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        block(iVar, jVar) = block(jVar, iVar) = 0.0;
+      block(iVar, iVar) = 1.0;
+    }
+
+    CBlasStructure::inverse(nVar, block);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        InvDiagBlocks(iPoint, iVar*nVar + jVar) = block(iVar, jVar);
+  }
+  END_SU2_OMP_FOR
+
+}
+
+void CMeshSolver::ApplyBlockJacobi(const CSysVector<su2double>& u, CSysVector<su2double>& v,
+                                   CGeometry *geometry, const CConfig *config) const {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      su2double sum = 0.0;
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        sum += InvDiagBlocks(iPoint, iVar*nVar + jVar) * u(iPoint, jVar);
+      v(iPoint, iVar) = sum;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(v, geometry, config);
+  CSysMatrixComms::Complete(v, geometry, config);
+
+}
+
+void CMeshSolver::Solve_System_MatrixFree(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  /*--- Enforce solution at some halo points possibly not covered by essential BC markers (see Solve_System). ---*/
+  CSysMatrixComms::Initiate(LinSysSol, geometry, config);
+  CSysMatrixComms::Complete(LinSysSol, geometry, config);
+
+  for (auto iPoint : ExtraVerticesToEliminate) {
+    su2double Sol[MAXNVAR] = {0.0};
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) Sol[iVar] = LinSysSol(iPoint, iVar);
+    EnforceSolutionAtNode(iPoint, Sol);
+  }
+
+  const auto kindSolver = config->GetKind_Deform_Linear_Solver();
+  const auto maxIter = config->GetDeform_Linear_Solver_Iter();
+  const su2double tol = config->GetDeform_Linear_Solver_Error();
+  const bool screenOutput = config->GetDeform_Output();
+
+  SU2_OMP_PARALLEL
+  {
+  ComputeBlockJacobi(geometry, numerics, config);
+
+  /*--- The r.h.s. is the same as with the eliminated (assembled) matrix, -(I-P) K P x + P x. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    MatrixFreeAux[i] = ConstrainedDOF[i]? LinSysSol[i] : su2double(0.0);
+  END_SU2_OMP_FOR
+
+  ComputeStiffnessProduct(MatrixFreeAux, LinSysRes, geometry, numerics, config);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto i = 0ul; i < nPoint*nVar; ++i)
+    LinSysRes[i] = ConstrainedDOF[i]? LinSysSol[i] : su2double(-LinSysRes[i]);
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = nPointDomain*nVar; i < nPoint*nVar; ++i) LinSysRes[i] = 0.0;
+  END_SU2_OMP_FOR
+
+  const StiffnessProduct product(this, geometry, numerics, config);
+  const BlockJacobi precond(this, geometry, config);
+
+  su2double residual = 0.0;
+  unsigned long iter = 0;
+
+#ifndef CODI_REVERSE_TYPE
+  switch (kindSolver) {
+    case CONJUGATE_GRADIENT:
+      iter = MatrixFreeSystem.CG_LinSolver(LinSysRes, LinSysSol, product, precond, tol, maxIter, residual,
+                                           screenOutput, config);
+      break;
+    case BCGSTAB:
+      iter = MatrixFreeSystem.BCGSTAB_LinSolver(LinSysRes, LinSysSol, product, precond, tol, maxIter, residual,
+                                                screenOutput, config);
+      break;
+    default:
+      iter = MatrixFreeSystem.FGMRES_LinSolver(LinSysRes, LinSysSol, product, precond, tol, maxIter, residual,
+                                               screenOutput, config);
+      break;
+  }
+#else
+  SU2_MPI::Error("The matrix-free mesh solver is not available in AD builds.", CURRENT_FUNCTION);
+#endif
+
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(residual);
+  }
+  END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+
+}
+
 void CMeshSolver::SetDualTime_Mesh(){
 
   nodes->Set_Solution_time_n1();
@@ -775,39 +1128,29 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
-
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+  unsigned long counter = 0;
 
-    if (iPoint_Local >= 0) {
+  for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    auto index = counter*Restart_Vars[1];
 
-      auto index = counter*Restart_Vars[1];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++){
+      /*--- Update the coordinates of the mesh ---*/
+      su2double curr_coord = Restart_Data[index+iDim];
+      /// TODO: "Double deformation" in multizone adjoint if this is set here?
+      ///       In any case it should not be needed as deformation is called before other solvers
+      ///geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, curr_coord);
 
-      for (unsigned short iDim = 0; iDim < nDim; iDim++){
-        /*--- Update the coordinates of the mesh ---*/
-        su2double curr_coord = Restart_Data[index+iDim];
-        /// TODO: "Double deformation" in multizone adjoint if this is set here?
-        ///       In any case it should not be needed as deformation is called before other solvers
-        ///geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, curr_coord);
-
-        /*--- Store the displacements computed as the current coordinates
-         minus the coordinates of the reference mesh file ---*/
-        su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
-        nodes->SetSolution(iPoint_Local, iDim, displ);
-      }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+      /*--- Store the displacements computed as the current coordinates
+       minus the coordinates of the reference mesh file ---*/
+      su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
+      nodes->SetSolution(iPoint_Local, iDim, displ);
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -913,35 +1256,26 @@ void CMeshSolver::RestartOldGeometry(CGeometry *geometry, const CConfig *config)
 
       /*--- Load data from the restart into correct containers. ---*/
 
-      unsigned long iPoint_Global, counter = 0;
-
-      for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-        /*--- Retrieve local index. If this node from the restart file lives
-         on the current processor, we will load and instantiate the vars. ---*/
+      unsigned long counter = 0;
 
-        auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+      for (const auto iPoint_Local : geometry->GetDomainPoints_GlobalOrder()) {
+        /*--- We need to store this point's data, so jump to the correct
+         offset in the buffer of data from the restart file and load it. ---*/
 
-        if (iPoint_Local >= 0) {
+        auto index = counter*Restart_Vars[1];
 
-          /*--- We need to store this point's data, so jump to the correct
-           offset in the buffer of data from the restart file and load it. ---*/
-
-          auto index = counter*Restart_Vars[1];
-
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            su2double curr_coord = Restart_Data[index+iDim];
-            su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
-
-            if(iStep==1)
-              nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
-            else
-              nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
-          }
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          su2double curr_coord = Restart_Data[index+iDim];
+          su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
 
-          /*--- Increment the overall counter for how many points have been loaded. ---*/
-          counter++;
+          if(iStep==1)
+            nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
+          else
+            nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
         }
+
+        /*--- Increment the overall counter for how many points have been loaded. ---*/
+        counter++;
       }
 
 
@@ -49,7 +49,6 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   const auto nZone = geometry->GetnZone();
   const bool restart = (config->GetRestart() || config->GetRestart_Flow());
-  const auto direct_diff = config->GetDirectDiff();
   const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                          (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
   const bool time_stepping = (config->GetTime_Marching() == TIME_MARCHING::TIME_STEPPING);
@@ -120,6 +119,23 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     specified reference values. ---*/
   SetNondimensionalization(config, iMesh);
 
+  /*--- Fluid models of each thread for the operator split integration of the chemistry (on the fine grid). ---*/
+  if (config->GetChemistry_Splitting() && !config->GetFrozen() && !config->GetMonoatomic() && iMesh == MESH_0) {
+    ChemistryFluidModels.resize(omp_get_max_threads(), nullptr);
+    for (auto& model : ChemistryFluidModels) {
+      if (config->GetKind_FluidModel() == MUTATIONPP) {
+        #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+        model = new CMutationTCLib(config, nDim);
+        #endif
+      } else {
+        model = new CSU2TCLib(config, nDim, config->GetViscous());
+      }
+    }
+    if (rank == MASTER_NODE)
+      cout << "Chemical source terms integrated with operator splitting ("
+           << ChemistryFluidModels.size() << " thread(s))." << endl;
+  }
+
   /// TODO: This type of variables will be replaced.
 
   AllocateTerribleLegacyTemporaryVariables();
@@ -148,26 +164,28 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
   Temperature_ve_Inf  = config->GetTemperature_ve_FreeStreamND();
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
-  switch(direct_diff) {
-  case NO_DERIVATIVE:
-    /*--- Default ---*/
-    break;
-  case D_DENSITY:
-    SU2_TYPE::SetDerivative(Density_Inf, 1.0);
-    break;
-  case D_PRESSURE:
-    SU2_TYPE::SetDerivative(Pressure_Inf, 1.0);
-    break;
-  case D_TEMPERATURE:
-    SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-    break;
-  case D_MACH: case D_AOA:
-  case D_SIDESLIP: case D_REYNOLDS:
-  case D_TURB2LAM: case D_DESIGN:
-    /*--- Already done in postprocessing of config ---*/
-    break;
-  default:
-    break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+    case NO_DERIVATIVE:
+      /*--- Default ---*/
+      break;
+    case D_DENSITY:
+      SU2_TYPE::SetDerivative(Density_Inf, iDir, 1.0);
+      break;
+    case D_PRESSURE:
+      SU2_TYPE::SetDerivative(Pressure_Inf, iDir, 1.0);
+      break;
+    case D_TEMPERATURE:
+      SU2_TYPE::SetDerivative(Temperature_Inf, iDir, 1.0);
+      break;
+    case D_MACH: case D_AOA:
+    case D_SIDESLIP: case D_REYNOLDS:
+    case D_TURB2LAM: case D_DESIGN:
+      /*--- Already done in postprocessing of config ---*/
+      break;
+    default:
+      break;
+    }
   }
 
   SetReferenceValues(*config);
@@ -233,6 +251,7 @@ CNEMOEulerSolver::~CNEMOEulerSolver() {
 
   delete node_infty;
   delete FluidModel;
+  for (auto model : ChemistryFluidModels) delete model;
 
 }
 
@@ -529,7 +548,7 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
       auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
 
       /*--- Set and extract limiters ---*/
-      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+      const su2limiterfloat *Limiter_i = nullptr, *Limiter_j = nullptr;
 
       if (limiter && !van_albada){
         Limiter_i = nodes->GetLimiter_Primitive(iPoint);
@@ -555,8 +574,8 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
             lim_i = min(lim_i, va_lim_i);
             lim_j = min(lim_j, va_lim_j);
           } else {
-            lim_i = min(lim_i, Limiter_i[iVar]);
-            lim_j = min(lim_j, Limiter_j[iVar]);
+            lim_i = min(lim_i, su2double(Limiter_i[iVar]));
+            lim_j = min(lim_j, su2double(Limiter_j[iVar]));
           }
         } else {
           lim_i = lim_j = 1.0;
@@ -753,6 +772,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   const bool axisymm    = config->GetAxisymmetric();
   const bool viscous    = config->GetViscous();
   const bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
+  const bool splitChemistry = !ChemistryFluidModels.empty();
 
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
 
@@ -775,6 +795,8 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+    const auto costScope = geometry->ProfilePointCost(iPoint);
+
     /*--- Set conserved & primitive variables  ---*/
     numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
     numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nullptr);
@@ -793,7 +815,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     /*--- Compute finite rate chemistry ---*/
 
     if(!monoatomic){
-      if(!frozen){
+      if(!frozen && !splitChemistry){
         /*--- Compute the non-equilibrium chemistry ---*/
         auto residual = numerics->ComputeChemistry(config);
 
@@ -900,17 +922,23 @@ void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solve
                                             CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<RUNGE_KUTTA_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == config->GetnRKStep()-1) IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                               CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == 3) IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
+
+  IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
@@ -926,6 +954,182 @@ void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**,
 void CNEMOEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
   CompleteImplicitIteration_impl<true>(geometry, config);
+
+  IntegrateChemistry(geometry, config);
+}
+
+void CNEMOEulerSolver::IntegrateChemistry(CGeometry *geometry, CConfig *config) {
+
+  if (ChemistryFluidModels.empty()) return;
+
+  /*--- Operator splitting of the finite rate chemistry: after the flow update, the species densities of each
+   *    cell are advanced over the local time step at constant momentum, total energy and vib.-el. energy, i.e.
+   *    d(rho_s)/dt = w_s(rho_s, T, Tve) with the temperatures recomputed from the energies. The stiff system is
+   *    integrated with the L-stable two-stage Rosenbrock method (ROS2) and step size control, based on the
+   *    embedded linearly-implicit Euler solution. The Jacobian of the production rates is approximated by finite
+   *    differences, which includes the dependence of the temperatures on the composition. ---*/
+
+  const su2double rtol = config->GetChemistry_Split_Tol();
+  const unsigned long maxSteps = config->GetChemistry_Split_MaxSteps();
+  const su2double gamma = 1.0 + 1.0/sqrt(2.0);
+  const su2double Tmin = 50.0, Tmax = 8E4;
+  const passivedouble perturb = sqrt(std::numeric_limits<passivedouble>::epsilon());
+
+  unsigned long nFailed = 0, nSubSteps = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  CNEMOGas* fluidmodel = ChemistryFluidModels[omp_get_thread_num()];
+
+  vector<su2double> rhos(nSpecies), rhos_stage(nSpecies), rhos_new(nSpecies);
+  vector<su2double> ws(nSpecies), ws_stage(nSpecies), k1(nSpecies), k2(nSpecies);
+  su2activematrix dwdrho(nSpecies, nSpecies), mat(nSpecies, nSpecies);
+  vector<su2double*> matRows(nSpecies);
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) matRows[iSpecies] = mat[iSpecies];
+
+  unsigned long nFailedThread = 0, nSubStepsThread = 0;
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    const su2double* U = nodes->GetSolution(iPoint);
+    const su2double dt = nodes->GetDelta_Time(iPoint);
+
+    su2double rho = 0.0, rhoEvel = 0.0;
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+      rhos[iSpecies] = max(U[iSpecies], su2double(0.0));
+      rho += rhos[iSpecies];
+    }
+    for (auto iDim = 0u; iDim < nDim; iDim++) rhoEvel += pow(U[nSpecies+iDim], 2);
+    rhoEvel *= 0.5/rho;
+    const su2double rhoE = U[nSpecies+nDim];
+    const su2double rhoEve = U[nSpecies+nDim+1];
+    const su2double atol = 1e-10*rho;
+    su2double Tve = nodes->GetTemperature_ve(iPoint);
+
+    /*--- Net production rates at constant energies, false if the temperatures are not physical. ---*/
+    auto ProductionRates = [&](vector<su2double>& val_rhos, vector<su2double>& val_ws) {
+      const auto& T = fluidmodel->ComputeTemperatures(val_rhos, rhoE, rhoEve, rhoEvel, Tve);
+      const su2double Ttr = T[0], Tv = T[1];
+      if (!(Ttr > Tmin && Ttr < Tmax && Tv > Tmin && Tv < Tmax)) return false;
+      fluidmodel->SetTDStateRhosTTv(val_rhos, Ttr, Tv);
+      val_ws = fluidmodel->ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+      for (const auto w : val_ws) if (w != w) return false;
+      return true;
+    };
+
+    /*--- Solve (I - gamma h dw/drho) x = rhs. ---*/
+    auto Solve = [&](su2double h, vector<su2double>& rhs) {
+      for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+        for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++)
+          mat(iSpecies,jSpecies) = su2double(iSpecies == jSpecies) - gamma * h * dwdrho(iSpecies,jSpecies);
+      Gauss_Elimination(matRows.data(), rhs.data(), nSpecies);
+    };
+
+    su2double time = 0.0, h = dt;
+    unsigned long nSteps = 0;
+    bool success = (dt > 0.0);
+
+    while (success && time < dt) {
+
+      if (nSteps++ == maxSteps || !ProductionRates(rhos, ws)) {
+        success = false;
+        break;
+      }
+
+      /*--- Finite difference Jacobian of the production rates. ---*/
+      for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
+        rhos_stage = rhos;
+        const su2double delta = perturb * max(rhos[jSpecies], 1e-8*rho);
+        rhos_stage[jSpecies] += delta;
+        if (!ProductionRates(rhos_stage, ws_stage)) {
+          success = false;
+          break;
+        }
+        for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+          dwdrho(iSpecies,jSpecies) = (ws_stage[iSpecies] - ws[iSpecies]) / delta;
+      }
+      if (!success) break;
+
+      /*--- Attempt steps until the error is acceptable, without producing negative densities. ---*/
+      while (true) {
+        h = min(h, dt - time);
+
+        k1 = ws;
+        Solve(h, k1);
+
+        for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+          rhos_stage[iSpecies] = rhos[iSpecies] + h * k1[iSpecies];
+
+        su2double error = 0.0;
+        if (ProductionRates(rhos_stage, ws_stage)) {
+          for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+            k2[iSpecies] = ws_stage[iSpecies] - 2.0 * k1[iSpecies];
+          Solve(h, k2);
+
+          for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+            rhos_new[iSpecies] = rhos[iSpecies] + h * (1.5 * k1[iSpecies] + 0.5 * k2[iSpecies]);
+            const su2double scale = atol + rtol * max(fabs(rhos[iSpecies]), fabs(rhos_new[iSpecies]));
+            error = max(error, 0.5 * h * fabs(k1[iSpecies] + k2[iSpecies]) / scale);
+            if (rhos_new[iSpecies] < -atol) error = max(error, su2double(4.0));
+          }
+          if (error != error) error = 100.0;
+        } else {
+          error = 100.0;
+        }
+
+        const su2double factor = min(su2double(5.0), max(su2double(0.2), 0.9 / sqrt(max(error, su2double(1e-10)))));
+
+        if (error <= 1.0) {
+          time += h;
+          h *= factor;
+          su2double rho_new = 0.0;
+          for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+            rhos[iSpecies] = max(rhos_new[iSpecies], su2double(0.0));
+            rho_new += rhos[iSpecies];
+          }
+          /*--- Restore the mixture density after clipping, the reactions conserve mass. ---*/
+          for (auto& rho_s : rhos) rho_s *= rho / rho_new;
+          break;
+        }
+
+        h *= factor;
+        if (nSteps++ >= maxSteps || h < 1e-12 * dt) {
+          success = false;
+          break;
+        }
+      }
+    }
+    nSubStepsThread += nSteps;
+
+    /*--- Keep the composition of the flow update if the integration failed. ---*/
+    if (success) {
+      for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+        nodes->SetSolution(iPoint, iSpecies, rhos[iSpecies]);
+    } else {
+      nFailedThread++;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_ATOMIC
+  nFailed += nFailedThread;
+  SU2_OMP_ATOMIC
+  nSubSteps += nSubStepsThread;
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Communicate the updated species densities. ---*/
+  InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+  CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+
+  unsigned long local[] = {nFailed, nSubSteps, nPointDomain}, global[3] = {0};
+  SU2_MPI::Allreduce(local, global, 3, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE && global[0] != 0) {
+    cout << "Warning!! Split chemistry integration failed in " << global[0]
+         << " points (average of " << global[1] / max<unsigned long>(global[2], 1) << " sub-steps)." << endl;
+  }
 }
 
 void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
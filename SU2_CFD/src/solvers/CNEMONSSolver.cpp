@@ -43,13 +43,15 @@ CNEMONSSolver::CNEMONSSolver(CGeometry *geometry, CConfig *config, unsigned shor
   Prandtl_Turb       = config->GetPrandtl_Turb();
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
-  switch(config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      /*--- Already done upstream. ---*/
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, iDir, 1.0);
+        break;
+      default:
+        /*--- Already done upstream. ---*/
+        break;
+    }
   }
 
 }
@@ -145,6 +147,8 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
 void CNEMONSSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, const CConfig *config, bool reconstruction) {
 
+  if (frozenGradients) return;
+
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? MPI_QUANTITIES::PRIMITIVE_GRAD_REC : MPI_QUANTITIES::PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
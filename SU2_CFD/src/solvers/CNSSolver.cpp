@@ -57,13 +57,15 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
 
   /*--- Initialize the seed values for forward mode differentiation. ---*/
 
-  switch(config->GetDirectDiff()) {
-    case D_VISCOSITY:
-      SU2_TYPE::SetDerivative(Viscosity_Inf, 1.0);
-      break;
-    default:
-      /*--- Already done upstream. ---*/
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case D_VISCOSITY:
+        SU2_TYPE::SetDerivative(Viscosity_Inf, iDir, 1.0);
+        break;
+      default:
+        /*--- Already done upstream. ---*/
+        break;
+    }
   }
 
 }
@@ -88,31 +90,27 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
-  if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
+  /*--- The limiters use the reconstruction gradient (which may be the gradient of the primitive
+   *    variables), they are computed with it if FUSED_GRADIENT_LIMITER, otherwise they are computed last. ---*/
+
+  const bool computeLimiter = muscl && !center && limiter && !van_albada && !Output;
+  const bool reconGradient = config->GetReconstructionGradientRequired();
+  const bool fusedLimiter = computeLimiter && config->GetFused_Gradient_Limiter();
+
+  if (reconGradient && muscl && !center) {
+    SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method_Recon(), true, fusedLimiter);
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
-  }
+  SetPrimitive_Gradient_Limiter(geometry, config, config->GetKind_Gradient_Method(), false,
+                                fusedLimiter && !reconGradient);
 
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, nPrimVarGrad_bak);
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (computeLimiter && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -130,7 +128,7 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
   /*--- Number of non-physical points, local to the thread, needs
    *    further reduction if function is called in parallel ---*/
-  unsigned long nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0, cacheHits = 0;
 
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == TURB_MODEL::SST);
@@ -162,12 +160,16 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
     /*--- Check for non-realizable states for reporting. ---*/
 
     nonPhysicalPoints += !physical;
+    cacheHits += nodes->GetTransportCacheHit(iPoint);
 
   }
   END_SU2_OMP_FOR
 
   AD::EndNoSharedReading();
 
+  SU2_OMP_ATOMIC
+  TransportCacheHits += cacheHits;
+
   return nonPhysicalPoints;
 }
 
@@ -429,6 +431,11 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
+  /*--- Conjugate heat interfaces are heat-transfer walls with the conductance and near-wall
+   temperature of the other zone, which are set for each vertex. ---*/
+  const bool conjugate = (kind_boundary == CHT_WALL_INTERFACE);
+  const bool transfer = (kind_boundary == HEAT_TRANSFER) || conjugate;
+
   /*--- Get the specified wall heat flux, temperature or heat transfer coefficient from config ---*/
 
   su2double Wall_HeatFlux = 0.0, Tinfinity = 0.0, Transfer_Coefficient = 0.0;
@@ -452,7 +459,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
 
   /*--- Jacobian, initialized to zero if needed. ---*/
   su2double **Jacobian_i = nullptr;
-  if ((dynamic_grid || (kind_boundary == HEAT_TRANSFER)) && implicit) {
+  if ((dynamic_grid || transfer) && implicit) {
     Jacobian_i = new su2double* [nVar];
     for (auto iVar = 0u; iVar < nVar; iVar++)
       Jacobian_i[iVar] = new su2double [nVar] ();
@@ -460,7 +467,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -471,9 +478,15 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
 
     /*--- If it is a customizable patch, retrieve the specified wall heat flux. ---*/
 
+    if (conjugate) {
+      Transfer_Coefficient = GetConjugateHeatVariable(val_marker, iVertex, 2) * config->GetTemperature_Ref() /
+                             config->GetHeat_Flux_Ref();
+      Tinfinity = GetConjugateHeatVariable(val_marker, iVertex, 3) / config->GetTemperature_Ref();
+    }
+
     if (config->GetMarker_All_PyCustom(val_marker))
       Wall_HeatFlux = geometry->GetCustomBoundaryHeatFlux(val_marker, iVertex) / config->GetHeat_Flux_Ref();
-    else if (kind_boundary == HEAT_TRANSFER) {
+    else if (transfer) {
       const su2double Twall = nodes->GetTemperature(iPoint);
       Wall_HeatFlux = Transfer_Coefficient * (Tinfinity - Twall);
     }
@@ -536,7 +549,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
      And add the contributions to the Jacobian due to energy. ---*/
 
     if (implicit) {
-      if (kind_boundary == HEAT_TRANSFER){
+      if (transfer){
 
         /*--- It is necessary to zero the jacobian entries of the energy equation. ---*/
         if (!dynamic_grid)
@@ -559,7 +572,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
         Jacobian_i[nDim+1][nDim+1] += Transfer_Coefficient * dTdrhoe * Area;
 
       }
-      if (dynamic_grid || (kind_boundary == HEAT_TRANSFER)) {
+      if (dynamic_grid || transfer) {
         Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
       }
 
@@ -647,7 +660,7 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
 
   /*--- Loop over boundary points ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_(schedule(dynamic,OMP_MIN_SIZE) SU2_NOWAIT)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -783,7 +796,11 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
 
 void CNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
                                            CConfig *config, unsigned short val_marker) {
-  BC_Isothermal_Wall_Generic(geometry, solver_container, conv_numerics, nullptr, config, val_marker, true);
+  if (config->GetKind_CHT_Coupling() == CHT_COUPLING::IMPLICIT_ROBIN_HEATFLUX) {
+    BC_HeatFlux_Wall_Generic(geometry, config, val_marker, CHT_WALL_INTERFACE);
+  } else {
+    BC_Isothermal_Wall_Generic(geometry, solver_container, conv_numerics, nullptr, config, val_marker, true);
+  }
 }
 
 void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container, const CConfig *config) {
@@ -828,6 +845,7 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
     for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
       const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto costScope = geometry->ProfilePointCost(iPoint);
       const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
 
       /*--- Check if the node belongs to the domain (i.e, not a halo node)
@@ -930,6 +948,13 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
         continue;
       }
 
+      /*--- The tabulated (incompressible) inverse law gives the initial guess, which reduces the iterations. ---*/
+
+      if (!WallLawTable.empty()) {
+        const su2double Re_y = Density_Wall * VelTangMod * WallDistMod / Lam_Visc_Wall;
+        if (Re_y > EPS) U_Tau = VelTangMod / WallLawTable.GetUPlus(Re_y);
+      }
+
       /*--- Convergence criterium for the Newton solver, note that 1e-10 is too large ---*/
       const su2double tol = 1e-12;
       while (fabs(diff) > tol) {
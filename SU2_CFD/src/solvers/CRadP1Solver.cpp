@@ -36,7 +36,6 @@ CRadP1Solver::CRadP1Solver() : CRadSolver() {
 CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(geometry, config) {
 
   unsigned short iVar;
-  unsigned short direct_diff = config->GetDirectDiff();
   bool multizone = config->GetMultizone_Problem();
 
   nDim =          geometry->GetnDim();
@@ -86,19 +85,21 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
 
   /*--- Initialize the secondary values for direct derivative approxiations ---*/
 
-  switch(direct_diff){
-    case NO_DERIVATIVE: case D_DENSITY:
-    case D_PRESSURE: case D_VISCOSITY:
-    case D_MACH: case D_AOA:
-    case D_SIDESLIP: case D_REYNOLDS:
-    case D_TURB2LAM: case D_DESIGN:
-      /*--- Not necessary here ---*/
-      break;
-    case D_TEMPERATURE:
-      SU2_TYPE::SetDerivative(Temperature_Inf, 1.0);
-      break;
-    default:
-      break;
+  for (unsigned short iDir = 0; iDir < config->GetnDirectDiff(); iDir++) {
+    switch (config->GetDirectDiff(iDir)) {
+      case NO_DERIVATIVE: case D_DENSITY:
+      case D_PRESSURE: case D_VISCOSITY:
+      case D_MACH: case D_AOA:
+      case D_SIDESLIP: case D_REYNOLDS:
+      case D_TURB2LAM: case D_DESIGN:
+        /*--- Not necessary here ---*/
+        break;
+      case D_TEMPERATURE:
+        SU2_TYPE::SetDerivative(Temperature_Inf, iDir, 1.0);
+        break;
+      default:
+        break;
+    }
   }
 
   SetTemperature_Inf(Temperature_Inf);
@@ -145,8 +146,8 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     LinSysRes.SetBlock_Zero(iPoint);
   }
 
-  /*--- Initialize the Jacobian matrix ---*/
-  Jacobian.SetValZero();
+  /*--- Initialize the Jacobian matrix, unless it is frozen ---*/
+  if (assembleJacobian) Jacobian.SetValZero();
 
   /*--- Compute the Solution gradients ---*/
   if (config->GetReconstructionGradientRequired()) {
@@ -220,7 +221,7 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     LinSysRes.SubtractBlock(iPoint, Residual);
     LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    if (assembleJacobian) Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
 
   }
 
@@ -252,7 +253,7 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Subtract residual and the Jacobian ---*/
 
     LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    if (assembleJacobian) Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
 
   }
 
@@ -326,7 +327,7 @@ void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
       /*--- Compute the Jacobian contribution. ---*/
       if (implicit) {
         Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+        if (assembleJacobian) Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       }
     }
   }
@@ -400,7 +401,7 @@ void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       /*--- Compute the Jacobian contribution. ---*/
       if (implicit) {
         Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+        if (assembleJacobian) Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       }
     }
   }
@@ -474,7 +475,7 @@ void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, C
       /*--- Compute the Jacobian contribution. ---*/
       if (implicit) {
         Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+        if (assembleJacobian) Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
       }
 
     }
@@ -489,6 +490,7 @@ void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   unsigned long iPoint, total_index, IterLinSol = 0;
   su2double Vol;
   su2double Delta;
+  const bool frozenSystem = config->GetRadiation_Frozen_System();
 
   /*--- Set maximum residual to zero ---*/
 
@@ -506,22 +508,23 @@ void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
       Delta = Vol / nodes->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+      if (assembleJacobian) Jacobian.AddVal2Diag(iPoint, Delta);
     }
     else {
-      Jacobian.SetVal2Diag(iPoint, 1.0);
+      if (assembleJacobian) Jacobian.SetVal2Diag(iPoint, 1.0);
       for (iVar = 0; iVar < nVar; iVar++) {
         total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = 0.0;
       }
     }
 
-    /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+    /*--- Right hand side of the system (-Residual) and initial guess (x = 0, or the previous
+     update when the system is frozen, as the forcing by the flow temperature changes slowly) ---*/
 
     for (iVar = 0; iVar < nVar; iVar++) {
       total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index]);
-      LinSysSol[total_index] = 0.0;
+      if (!frozenSystem) LinSysSol[total_index] = 0.0;
       Residual_RMS[iVar] += LinSysRes[total_index]*LinSysRes[total_index];
       AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
     }
@@ -537,10 +540,16 @@ void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     }
   }
 
-  /*--- Solve or smooth the linear system ---*/
+  /*--- Solve or smooth the linear system, the preconditioner of a frozen matrix is reused. ---*/
 
+  System.SetMatrixUnchanged(!assembleJacobian);
   IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
+  /*--- The P1 matrix only depends on the geometry, the coefficients of the medium, and the
+   (CFL based) time step, after the first assembly it can be kept. ---*/
+
+  if (frozenSystem) assembleJacobian = false;
+
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     for (iVar = 0; iVar < nVar; iVar++) {
       nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
@@ -45,7 +45,10 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CRuntimeProfiler.hpp"
+#include "../../../Common/include/toolboxes/CSquareMatrixCM.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
@@ -89,6 +92,8 @@ CSolver::CSolver(LINEAR_SOLVER_MODE linear_solver_mode) : System(linear_solver_m
   base_nodes         = nullptr;
   nOutputVariables   = 0;
   ResLinSolver       = 0.0;
+  Reduced_CFL_Fraction = 0.0;
+  nBacktrack_CFL     = 0;
 
   /*--- Variable initialization to avoid valgrid warnings when not used. ---*/
 
@@ -319,7 +324,7 @@ namespace PeriodicCommHelpers {
     }
   }
 
-  su2activematrix& selectLimiter(CVariable* nodes, unsigned short commType) {
+  su2matrix<su2limiterfloat>& selectLimiter(CVariable* nodes, unsigned short commType) {
     switch(commType) {
       case PERIODIC_LIM_PRIM_1:
       case PERIODIC_LIM_PRIM_2:
@@ -964,7 +969,10 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
             }
 
             if (rotate_periodic) {
-              Rotate(zeros, &limiter(iPoint,1), &bufDSend[buf_offset+1]);
+              su2double limiterVel[3] = {0.0};
+              for (unsigned short iDim = 0; iDim < nDim; iDim++)
+                limiterVel[iDim] = limiter(iPoint, iDim+1);
+              Rotate(zeros, limiterVel, &bufDSend[buf_offset+1]);
             }
 
             break;
@@ -1012,6 +1020,13 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
   unsigned short nPeriodic = config->GetnMarker_Periodic();
   unsigned short iDim, jDim, iVar, jVar, iPeriodic, nNeighbor;
 
+  /*--- Index 0 treats all pairs at once, the passive face of a pair is the second marker. ---*/
+
+  auto isPassive = [&](unsigned short jPeriodic) {
+    if (val_periodic_index == 0) return jPeriodic > nPeriodic/2;
+    return jPeriodic == val_periodic_index + nPeriodic/2;
+  };
+
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset, total_index;
 
   int source, iMessage, jRecv;
@@ -1088,7 +1103,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
          inefficient when we have multiple pairs of periodic faces, but
          it simplifies the communications. ---*/
 
-        if ((iPeriodic == val_periodic_index) ||
+        if ((val_periodic_index == 0) || (iPeriodic == val_periodic_index) ||
             (iPeriodic == val_periodic_index + nPeriodic/2)) {
 
           /*--- Compute the offset in the recv buffer for this point. ---*/
@@ -1154,7 +1169,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
                 Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
 
-                if (iPeriodic == val_periodic_index + nPeriodic/2) {
+                if (isPassive(iPeriodic)) {
                   for (iVar = 0; iVar < nVar; iVar++) {
                     LinSysRes(iPoint, iVar) = 0.0;
                     total_index = iPoint*nVar+iVar;
@@ -1175,8 +1190,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
                we are updating the solution at the passive nodes
                using the new solution from the master. ---*/
 
-              if ((implicit_periodic) &&
-                  (iPeriodic == val_periodic_index + nPeriodic/2)) {
+              if ((implicit_periodic) && isPassive(iPeriodic)) {
 
                 /*--- Directly set the solution on the passive periodic
                  face that is provided from the master. ---*/
@@ -1287,7 +1301,7 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
                faces for the limiter, and store the proper min value. ---*/
 
               for (iVar = 0; iVar < ICOUNT; iVar++)
-                limiter(iPoint, iVar) = min(limiter(iPoint, iVar), bufDRecv[buf_offset+iVar]);
+                limiter(iPoint, iVar) = min(su2double(limiter(iPoint, iVar)), bufDRecv[buf_offset+iVar]);
 
               break;
 
@@ -1325,14 +1339,20 @@ void CSolver::GetCommCountAndType(const CConfig* config,
                                   MPI_QUANTITIES commType,
                                   unsigned short &COUNT_PER_POINT,
                                   unsigned short &MPI_TYPE) const {
+  /*--- Gradients and limiters may be sent in single precision. ---*/
+  const auto GRAD_MPI_TYPE = config->GetFloat_Halo_Comms() ? COMM_TYPE_FLOAT : COMM_TYPE_DOUBLE;
+
   switch (commType) {
     case MPI_QUANTITIES::SOLUTION:
     case MPI_QUANTITIES::SOLUTION_OLD:
     case MPI_QUANTITIES::UNDIVIDED_LAPLACIAN:
-    case MPI_QUANTITIES::SOLUTION_LIMITER:
       COUNT_PER_POINT  = nVar;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
+    case MPI_QUANTITIES::SOLUTION_LIMITER:
+      COUNT_PER_POINT  = nVar;
+      MPI_TYPE         = GRAD_MPI_TYPE;
+      break;
     case MPI_QUANTITIES::MAX_EIGENVALUE:
     case MPI_QUANTITIES::SENSOR:
       COUNT_PER_POINT  = 1;
@@ -1341,16 +1361,16 @@ void CSolver::GetCommCountAndType(const CConfig* config,
     case MPI_QUANTITIES::SOLUTION_GRADIENT:
     case MPI_QUANTITIES::SOLUTION_GRAD_REC:
       COUNT_PER_POINT  = nVar*nDim;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = GRAD_MPI_TYPE;
       break;
     case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
     case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
       COUNT_PER_POINT  = nPrimVarGrad*nDim;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = GRAD_MPI_TYPE;
       break;
     case MPI_QUANTITIES::PRIMITIVE_LIMITER:
       COUNT_PER_POINT  = nPrimVarGrad;
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = GRAD_MPI_TYPE;
       break;
     case MPI_QUANTITIES::SOLUTION_EDDY:
       COUNT_PER_POINT  = nVar+1;
@@ -1365,7 +1385,7 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       break;
     case MPI_QUANTITIES::AUXVAR_GRADIENT:
       COUNT_PER_POINT  = nDim*base_nodes->GetnAuxVar();
-      MPI_TYPE         = COMM_TYPE_DOUBLE;
+      MPI_TYPE         = GRAD_MPI_TYPE;
       break;
     case MPI_QUANTITIES::MESH_DISPLACEMENTS:
       COUNT_PER_POINT  = nDim;
@@ -1397,15 +1417,69 @@ namespace CommHelpers {
     }
   }
 
-  su2activematrix& selectLimiter(CVariable* nodes, MPI_QUANTITIES commType) {
+  su2matrix<su2limiterfloat>& selectLimiter(CVariable* nodes, MPI_QUANTITIES commType) {
     if (commType == MPI_QUANTITIES::PRIMITIVE_LIMITER) return nodes->GetLimiter_Primitive();
     return nodes->GetLimiter();
   }
 }
 
+void CSolver::CompletePendingComms(CGeometry *geometry, const CConfig *config) {
+
+  /*--- All threads must read the flag before it is reset. ---*/
+  const bool pending = pendingComms;
+  if (!pending) return;
+  SU2_OMP_BARRIER
+
+  CompleteComms(geometry, config, pendingCommsType);
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(pendingComms = false;)
+}
+
+void CSolver::PeriodicComms(CGeometry *geometry,
+                            const CConfig *config,
+                            unsigned short commType) {
+
+  const unsigned short nPeriodicPair = config->GetnMarker_Periodic() / 2;
+  if ((nPeriodicPair == 0) || (commType == PERIODIC_NONE)) return;
+
+  if (geometry->periodicPairsDisjoint) {
+    InitiatePeriodicComms(geometry, config, 0, commType);
+    CompletePeriodicComms(geometry, config, 0, commType);
+    return;
+  }
+
+  /*--- Points on adjacent periodic markers are accumulated by treating one pair at a time. ---*/
+
+  for (unsigned short iPeriodic = 1; iPeriodic <= nPeriodicPair; iPeriodic++) {
+    InitiatePeriodicComms(geometry, config, iPeriodic, commType);
+    CompletePeriodicComms(geometry, config, iPeriodic, commType);
+  }
+}
+
+void CSolver::PeriodicAndHaloComms(CGeometry *geometry,
+                                   const CConfig *config,
+                                   unsigned short periodicType,
+                                   MPI_QUANTITIES commType) {
+
+  const bool split = (config->GetnMarker_Periodic() > 0) && (periodicType != PERIODIC_NONE) &&
+                     (geometry->P2PSendPeriodic.size() == static_cast<size_t>(geometry->nP2PSend));
+
+  if (split) InitiateComms(geometry, config, commType, P2P_SUBSET::NOT_PERIODIC);
+
+  PeriodicComms(geometry, config, periodicType);
+
+  InitiateComms(geometry, config, commType, split ? P2P_SUBSET::PERIODIC : P2P_SUBSET::ALL);
+  CompleteComms(geometry, config, commType);
+}
+
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
-                            MPI_QUANTITIES commType) {
+                            MPI_QUANTITIES commType,
+                            P2P_SUBSET subset) {
+
+  /*--- The communication buffers are shared, previous comms must be completed. ---*/
+
+  if (subset != P2P_SUBSET::PERIODIC) CompletePendingComms(geometry, config);
 
   /*--- Local variables ---*/
 
@@ -1431,6 +1505,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
   /*--- Set some local pointers to make access simpler. ---*/
 
   su2double *bufDSend = geometry->bufD_P2PSend;
+  float *bufFSend = geometry->bufF_P2PSend;
+  const bool single = (MPI_TYPE == COMM_TYPE_FLOAT);
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1443,12 +1519,16 @@ void CSolver::InitiateComms(CGeometry *geometry,
 
   if (geometry->nP2PSend > 0) {
 
-    /*--- Post all non-blocking recvs first before sends. ---*/
+    /*--- Post all non-blocking recvs first before sends (with the first subset of messages). ---*/
 
-    geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
+    if (subset != P2P_SUBSET::PERIODIC)
+      geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
 
     for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
 
+      if ((subset != P2P_SUBSET::ALL) &&
+          (geometry->P2PSendPeriodic[iMessage] != (subset == P2P_SUBSET::PERIODIC))) continue;
+
       /*--- Get the offset in the buffer for the start of this message. ---*/
 
       msg_offset = geometry->nPoint_P2PSend[iMessage];
@@ -1489,6 +1569,11 @@ void CSolver::InitiateComms(CGeometry *geometry,
             break;
           case MPI_QUANTITIES::SOLUTION_LIMITER:
           case MPI_QUANTITIES::PRIMITIVE_LIMITER:
+            if (single) {
+              for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
+                bufFSend[buf_offset+iVar] = SU2_TYPE::GetValue(limiter(iPoint, iVar));
+              break;
+            }
             for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
               bufDSend[buf_offset+iVar] = limiter(iPoint, iVar);
             break;
@@ -1503,6 +1588,12 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case MPI_QUANTITIES::SOLUTION_GRAD_REC:
           case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
           case MPI_QUANTITIES::AUXVAR_GRADIENT:
+            if (single) {
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  bufFSend[buf_offset+iVar*nDim+iDim] = SU2_TYPE::GetValue(gradient(iPoint, iVar, iDim));
+              break;
+            }
             for (iVar = 0; iVar < nVarGrad; iVar++)
               for (iDim = 0; iDim < nDim; iDim++)
                 bufDSend[buf_offset+iVar*nDim+iDim] = gradient(iPoint, iVar, iDim);
@@ -1549,6 +1640,20 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             MPI_QUANTITIES commType) {
 
+  /*--- Leave the comms in flight, they are completed by CompletePendingComms. ---*/
+
+  if (deferCompleteComms && !pendingComms) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      deferCompleteComms = false;
+      pendingComms = true;
+      pendingCommsType = commType;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    return;
+  }
+
+  const CRuntimeProfiler::CScope profile(CRuntimeProfiler::SECTION::COMMUNICATION);
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -1568,6 +1673,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
   /*--- Set some local pointers to make access simpler. ---*/
 
   const su2double *bufDRecv = geometry->bufD_P2PRecv;
+  const float *bufFRecv = geometry->bufF_P2PRecv;
+  const bool single = (MPI_TYPE == COMM_TYPE_FLOAT);
 
   /*--- Handle the different types of gradient and limiter. ---*/
 
@@ -1637,6 +1744,11 @@ void CSolver::CompleteComms(CGeometry *geometry,
             break;
           case MPI_QUANTITIES::SOLUTION_LIMITER:
           case MPI_QUANTITIES::PRIMITIVE_LIMITER:
+            if (single) {
+              for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
+                limiter(iPoint,iVar) = bufFRecv[buf_offset+iVar];
+              break;
+            }
             for (iVar = 0; iVar < COUNT_PER_POINT; iVar++)
               limiter(iPoint,iVar) = bufDRecv[buf_offset+iVar];
             break;
@@ -1651,6 +1763,12 @@ void CSolver::CompleteComms(CGeometry *geometry,
           case MPI_QUANTITIES::SOLUTION_GRAD_REC:
           case MPI_QUANTITIES::PRIMITIVE_GRAD_REC:
           case MPI_QUANTITIES::AUXVAR_GRADIENT:
+            if (single) {
+              for (iVar = 0; iVar < nVarGrad; iVar++)
+                for (iDim = 0; iDim < nDim; iDim++)
+                  gradient(iPoint,iVar,iDim) = bufFRecv[buf_offset+iVar*nDim+iDim];
+              break;
+            }
             for (iVar = 0; iVar < nVarGrad; iVar++)
               for (iDim = 0; iDim < nDim; iDim++)
                 gradient(iPoint,iVar,iDim) = bufDRecv[buf_offset+iVar*nDim+iDim];
@@ -1703,13 +1821,92 @@ void CSolver::ResetCFLAdapt() {
   NonLinRes_Counter = 0;
 }
 
+void CSolver::ResetNonlinearIterations(const CConfig *config, unsigned short iMesh) {
+
+  ResetCFLAdapt();
+
+  if (base_nodes == nullptr) return;
+
+  /*--- The local CFL of the scalar solvers is set by the CFL adaption of the flow solver. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    base_nodes->SetUnderRelaxation(iPoint, 1.0);
+  }
+}
+
+void CSolver::ExtrapolateSolutionInTime(const CConfig *config) {
+
+  extrapolatedTimeStep = config->GetTime_Extrapolation() && !skipTimeExtrapolation;
+  skipTimeExtrapolation = false;
+
+  if (!extrapolatedTimeStep) return;
+
+  /*--- The time levels were pushed back by the update of the previous time step, i.e. the solution
+   is the same as u_n, the initial guess becomes u_n + (u_n - u_n1). At the first time step the two
+   levels are equal and nothing changes. ---*/
+
+  auto* nodes = GetNodes();
+  const auto chunkSize = roundUpDiv(nPoint, omp_get_max_threads());
+
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double sol_n = nodes->GetSolution_time_n(iPoint, iVar);
+      nodes->SetSolution(iPoint, iVar, 2.0 * sol_n - nodes->GetSolution_time_n1(iPoint, iVar));
+    }
+  }
+  END_SU2_OMP_PARALLEL
+}
+
+void CSolver::CheckTimeExtrapolation(const CConfig *config) {
+
+  if (!config->GetTime_Extrapolation()) return;
+
+  /*--- Residuals of the first inner iteration, i.e. of the initial guess. ---*/
+
+  bool fallback = false;
+
+  if (extrapolatedTimeStep && !TimeExtrapolation_Res0.empty()) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      fallback |= (GetRes_RMS(iVar) > config->GetTime_Extrapolation_Tol() * TimeExtrapolation_Res0[iVar]);
+    }
+  }
+
+  if (!fallback) {
+    TimeExtrapolation_Res0.resize(nVar);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) TimeExtrapolation_Res0[iVar] = GetRes_RMS(iVar);
+    return;
+  }
+
+  /*--- Restart the time step from u_n, the reference residuals are kept. The coarse grids are
+   restricted from the fine grid at the start of each multigrid cycle. ---*/
+
+  if (rank == MASTER_NODE) {
+    cout << "The extrapolated initial guess increased the residuals, using the solution at time n." << endl;
+  }
+
+  auto* nodes = GetNodes();
+  const auto chunkSize = roundUpDiv(nPoint, omp_get_max_threads());
+
+  SU2_OMP_PARALLEL_(for schedule(static,chunkSize))
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, nodes->GetSolution_time_n(iPoint, iVar));
+  }
+  END_SU2_OMP_PARALLEL
+
+  extrapolatedTimeStep = false;
+  skipTimeExtrapolation = true;
+}
+
 
 void CSolver::AdaptCFLNumber(CGeometry **geometry,
                              CSolver   ***solver_container,
                              CConfig   *config) {
 
   /* Adapt the CFL number on all multigrid levels using an
-   exponential progression with under-relaxation approach. */
+   exponential progression with under-relaxation approach, or a
+   pseudo-transient continuation driven by the local residual reduction. */
 
   vector<su2double> MGFactor(config->GetnMGLevels()+1,1.0);
   const su2double CFLFactorDecrease = config->GetCFL_AdaptParam(0);
@@ -1718,11 +1915,15 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
   const su2double acceptableLinTol  = config->GetCFL_AdaptParam(4);
   const bool fullComms              = (config->GetComm_Level() == COMM_FULL);
+  const bool mgScalars              = config->GetMG_ScalarSolvers();
+  const bool localMethod            = (config->GetKind_CFL_Adapt() == CFL_ADAPT_METHOD::LOCAL_RESIDUAL);
+  const su2double localExponent     = config->GetCFL_AdaptLocalParam(0);
+  const su2double backtrackTol      = config->GetCFL_AdaptLocalParam(1);
 
   /* Number of iterations considered to check for stagnation. */
   const auto Res_Count = min(100ul, config->GetnInner_Iter()-1);
 
-  static bool reduceCFL, resetCFL, canIncrease;
+  static bool reduceCFL, resetCFL, canIncrease, backtrackCFL;
 
   for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
 
@@ -1822,6 +2023,14 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
           for (auto& val : NonLinRes_Series) val = 0.0;
         }
       }
+
+      /* Global backtracking of the local residual method, if the nonlinear residual
+       increased too much in the last iteration all CFL numbers are reduced. The
+       solution is not rolled back as the secondary variables (e.g. eddy viscosity)
+       would no longer be consistent with it. */
+
+      backtrackCFL = localMethod && (New_Func - Old_Func > backtrackTol);
+      if (backtrackCFL) nBacktrack_CFL++;
     }
     } /* End safe global access, now all threads update the CFL number. */
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
@@ -1829,6 +2038,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
     /* Loop over all points on this grid and apply CFL adaption. */
 
     su2double myCFLMin = 1e30, myCFLMax = 0.0, myCFLSum = 0.0;
+    unsigned long myReduced = 0;
     const su2double CFLTurbReduction = config->GetCFLRedCoeff_Turb();
     const su2double CFLSpeciesReduction = config->GetCFLRedCoeff_Species();
 
@@ -1837,6 +2047,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
       Min_CFL_Local = 1e30;
       Max_CFL_Local = 0.0;
       Avg_CFL_Local = 0.0;
+      Reduced_CFL_Fraction = 0.0;
     }
     END_SU2_OMP_MASTER
 
@@ -1864,13 +2075,38 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
        then we schedule an increase the CFL number for the next iteration. */
 
       su2double CFLFactor = 1.0;
-      if (underRelaxation < 0.1 || reduceCFL) {
-        CFLFactor = CFLFactorDecrease;
-      } else if ((underRelaxation >= 0.1 && underRelaxation < 1.0) || !canIncrease) {
-        CFLFactor = 1.0;
+      if (!localMethod) {
+        if (underRelaxation < 0.1 || reduceCFL) {
+          CFLFactor = CFLFactorDecrease;
+        } else if ((underRelaxation >= 0.1 && underRelaxation < 1.0) || !canIncrease) {
+          CFLFactor = 1.0;
+        } else {
+          CFLFactor = CFLFactorIncrease;
+        }
       } else {
-        CFLFactor = CFLFactorIncrease;
+        /* Pseudo-transient continuation, the CFL of each control volume follows the
+         reduction of its residual, (R_old/R)^exponent, within the factor limits. The
+         linear solver and under-relaxation checks only limit the local factor. The
+         coarse grids have no local residual and follow the standard increase. */
+
+        su2double localFactor = CFLFactorIncrease;
+        if (iMesh == MESH_0) {
+          const su2double resOld = LocalResidual_Old[iPoint];
+          const su2double resNew = LocalResidual[iPoint];
+          if (resOld > 0.0 && resNew > 0.0) localFactor = pow(resOld / resNew, localExponent);
+          else if (resOld == 0.0) localFactor = 1.0;
+          localFactor = min(max(localFactor, CFLFactorDecrease), CFLFactorIncrease);
+          LocalResidual_Old[iPoint] = resNew;
+        }
+        if (underRelaxation < 0.1 || reduceCFL || backtrackCFL) {
+          CFLFactor = CFLFactorDecrease;
+        } else if (underRelaxation < 1.0 || !canIncrease) {
+          CFLFactor = min(localFactor, 1.0);
+        } else {
+          CFLFactor = localFactor;
+        }
       }
+      if ((iMesh == MESH_0) && (CFLFactor < 1.0)) myReduced++;
 
       /* Check if we are hitting the min or max and adjust. */
 
@@ -1894,10 +2130,10 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
       CFL *= CFLFactor;
       solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
-      if ((iMesh == MESH_0) && solverTurb) {
+      if ((iMesh == MESH_0 || mgScalars) && solverTurb) {
         solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL * CFLTurbReduction);
       }
-      if ((iMesh == MESH_0) && solverSpecies) {
+      if ((iMesh == MESH_0 || mgScalars) && solverSpecies) {
         solverSpecies->GetNodes()->SetLocalCFL(iPoint, CFL * CFLSpeciesReduction);
       }
 
@@ -1920,6 +2156,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
         Min_CFL_Local = min(Min_CFL_Local,myCFLMin);
         Max_CFL_Local = max(Max_CFL_Local,myCFLMax);
         Avg_CFL_Local += myCFLSum;
+        Reduced_CFL_Fraction += myReduced;
       }
       END_SU2_OMP_CRITICAL
 
@@ -1930,6 +2167,9 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
         SU2_MPI::Allreduce(&myCFLMax, &Max_CFL_Local, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
         SU2_MPI::Allreduce(&myCFLSum, &Avg_CFL_Local, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
         Avg_CFL_Local /= su2double(geometry[iMesh]->GetGlobal_nPointDomain());
+        const su2double myReducedSum = Reduced_CFL_Fraction;
+        SU2_MPI::Allreduce(&myReducedSum, &Reduced_CFL_Fraction, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+        Reduced_CFL_Fraction /= su2double(geometry[iMesh]->GetGlobal_nPointDomain());
       }
       END_SU2_OMP_SAFE_GLOBAL_ACCESS
     }
@@ -2186,17 +2426,9 @@ void CSolver::SetUndivided_Laplacian(CGeometry *geometry, const CConfig *config)
   }
   END_SU2_OMP_FOR
 
-  /*--- Correct the Laplacian across any periodic boundaries. ---*/
-
-  for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
-    InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-    CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_LAPLACIAN);
-  }
-
-  /*--- MPI parallelization ---*/
+  /*--- Correct the Laplacian across any periodic boundaries and MPI parallelization. ---*/
 
-  InitiateComms(geometry, config, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
-  CompleteComms(geometry, config, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
+  PeriodicAndHaloComms(geometry, config, PERIODIC_LAPLACIAN, MPI_QUANTITIES::UNDIVIDED_LAPLACIAN);
 
 }
 
@@ -2740,6 +2972,30 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) const {
 
 }
 
+map<string, CSolver::RestartInMemory> CSolver::RestartsInMemory;
+
+void CSolver::StoreRestartInMemory(const string& filename, vector<string> fields, vector<passivedouble> data) {
+  auto& restart = RestartsInMemory[filename];
+  restart.fields = std::move(fields);
+  restart.data = std::move(data);
+}
+
+bool CSolver::ReadRestartInMemory(const CGeometry *geometry, const string& filename) {
+
+  const auto it = RestartsInMemory.find(filename);
+  if (it == RestartsInMemory.end()) return false;
+
+  /*--- Same metadata as a binary file that matches the mesh. ---*/
+
+  fields = it->second.fields;
+  Restart_Vars.assign(5, 0);
+  Restart_Vars[0] = 535532;
+  Restart_Vars[1] = fields.size() - 1;
+  Restart_Vars[2] = geometry->GetGlobal_nPointDomain();
+  Restart_Data = it->second.data;
+  return true;
+}
+
 void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config, string val_filename) {
 
   ifstream restart_file;
@@ -2754,6 +3010,8 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
   string error_string = "Note: ASCII restart files must be in CSV format since v7.0.\n"
                         "Check https://su2code.github.io/docs/Guide-to-v7 for more information.";
 
+  if (ReadRestartInMemory(geometry, val_filename)) return;
+
   /*--- First, check that this is not a binary restart file. ---*/
 
   char fname[100];
@@ -2903,8 +3161,19 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
 
 }
 
+namespace {
+/*--- Restarts are interpolated when the number of points does not match the mesh (except in SU2_SOL,
+ where the file defines the points), or when requested explicitly. ---*/
+bool RestartInterpolationRequired(const CGeometry *geometry, const CConfig *config, unsigned long nPointFile) {
+  if (config->GetRestart_Interpolation()) return true;
+  return nPointFile != geometry->GetGlobal_nPointDomain() && config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL;
+}
+}  // namespace
+
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
 
+  if (ReadRestartInMemory(geometry, val_filename)) return;
+
   char str_buf[CGNS_STRING_SIZE], fname[100];
   val_filename += ".dat";
   strcpy(fname, val_filename.c_str());
@@ -2962,6 +3231,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
     fields.push_back(str_buf);
   }
 
+  /*--- Compressed files are read block by block. ---*/
+
+  if (Restart_Vars[3] != 0) {
+    fclose(fhw);
+    ReadCompressedRestartData(geometry, config, val_filename);
+  }
+  else {
+
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
   Restart_Data.resize(nFields*nPointFile);
@@ -2976,6 +3253,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   /*--- Close the file. ---*/
 
   fclose(fhw);
+  }
 
 #else
 
@@ -3053,6 +3331,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   delete [] mpi_str_buf;
 
+  /*--- Compressed files are read block by block. ---*/
+
+  if (Restart_Vars[3] != 0) {
+    MPI_File_close(&fhw);
+    ReadCompressedRestartData(geometry, config, val_filename);
+  }
+  else {
+
   /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
   etype = MPI_DOUBLE;
@@ -3070,20 +3356,24 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   int *blocklen = nullptr;
   MPI_Aint *displace = nullptr;
 
-  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
-      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
-    /*--- No interpolation, each rank reads the indices it needs. ---*/
-    nBlock = geometry->GetnPointDomain();
-
-    blocklen = new int[nBlock];
-    displace = new MPI_Aint[nBlock];
-    int counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
-      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-        counter++;
+  if (!RestartInterpolationRequired(geometry, config, nPointFile)) {
+    /*--- No interpolation, each rank reads the indices it needs, in ascending order.
+     Consecutive points are merged into one block. ---*/
+    nBlock = 0;
+
+    const auto& globalIndex = geometry->GetDomainPoints_GlobalIndex();
+    blocklen = new int[globalIndex.size()];
+    displace = new MPI_Aint[globalIndex.size()];
+    unsigned long nextGlobal = 0;
+    for (const auto iPoint_Global : globalIndex) {
+      if (nBlock > 0 && iPoint_Global == nextGlobal) {
+        blocklen[nBlock-1] += nFields;
+      } else {
+        blocklen[nBlock] = nFields;
+        displace[nBlock] = iPoint_Global*nFields*sizeof(passivedouble);
+        nBlock++;
       }
+      nextGlobal = iPoint_Global + 1;
     }
   }
   else {
@@ -3109,7 +3399,8 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-  const int bufSize = nBlock*blocklen[0];
+  int bufSize = 0;
+  for (int iBlock = 0; iBlock < nBlock; ++iBlock) bufSize += blocklen[iBlock];
   Restart_Data.resize(bufSize);
 
   /*--- Collective call for all ranks to read from their view simultaneously. ---*/
@@ -3126,15 +3417,133 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   delete [] blocklen;
   delete [] displace;
+  }
 
 #endif
 
-  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
-      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+  if (RestartInterpolationRequired(geometry, config, nPointFile)) {
     InterpolateRestartData(geometry, config);
   }
 }
 
+void CSolver::ReadCompressedRestartData(const CGeometry *geometry, const CConfig *config, const string& fname) {
+
+  if (Restart_Vars[3] != CompressionToolbox::RestartFormat || !CompressionToolbox::Available()) {
+    SU2_MPI::Error(string("The restart file ") + fname + string(" is compressed in an unknown format,\n") +
+                   string("or SU2 was built without compression support (zlib)."), CURRENT_FUNCTION);
+  }
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const unsigned long nBlock = Restart_Vars[4];
+  const unsigned long nEntry = CompressionToolbox::RestartTableEntry(nFields);
+  const unsigned long tableOffset = Restart_Vars.size()*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  const unsigned long dataOffset = tableOffset + nBlock*nEntry*sizeof(unsigned long);
+
+  /*--- Global indices of the points of this rank, in ascending order. Like for uncompressed
+   files, these are the domain points, or a linear partition of the file if it is interpolated. ---*/
+
+  vector<unsigned long> points;
+
+  if (size == SINGLE_NODE) {
+    points.resize(nPointFile);
+    iota(points.begin(), points.end(), 0ul);
+  }
+  else if (!RestartInterpolationRequired(geometry, config, nPointFile)) {
+    points = geometry->GetDomainPoints_GlobalIndex();
+  }
+  else {
+    const auto partitioner = CLinearPartitioner(nPointFile,0);
+    points.resize(partitioner.GetSizeOnRank(rank));
+    iota(points.begin(), points.end(), partitioner.GetFirstIndexOnRank(rank));
+  }
+
+  /*--- The table of blocks is small, the master reads it for all ranks. ---*/
+
+  vector<unsigned long> table(nBlock*nEntry);
+
+#ifdef HAVE_MPI
+  MPI_File fhw;
+  if (MPI_File_open(SU2_MPI::GetComm(), fname.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw))
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, tableOffset, table.data(), table.size()*sizeof(unsigned long), MPI_BYTE, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(table.data(), table.size(), MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+#else
+  FILE *fhw = fopen(fname.c_str(), "rb");
+  if (!fhw) SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+
+  if (fseek(fhw, tableOffset, SEEK_SET) ||
+      fread(table.data(), sizeof(unsigned long), table.size(), fhw) != table.size())
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+#endif
+
+  /*--- Select the blocks that contain points of this rank (the blocks are sorted by their first point). ---*/
+
+  vector<unsigned long> neededBlocks, blockOffset(nBlock+1, 0);
+  auto nextPoint = points.begin();
+
+  for (auto iBlock = 0ul; iBlock < nBlock; ++iBlock) {
+    const auto* entry = &table[iBlock*nEntry];
+    blockOffset[iBlock+1] = blockOffset[iBlock];
+    for (auto iVar = 0ul; iVar < nFields; ++iVar) blockOffset[iBlock+1] += entry[2+iVar];
+
+    nextPoint = lower_bound(nextPoint, points.end(), entry[0]);
+    if (nextPoint != points.end() && *nextPoint < entry[0] + entry[1]) neededBlocks.push_back(iBlock);
+  }
+
+  /*--- Read the compressed blocks, collectively in parallel. ---*/
+
+  unsigned long nBytes = 0;
+  for (const auto iBlock : neededBlocks) nBytes += blockOffset[iBlock+1] - blockOffset[iBlock];
+  vector<char> buffer(nBytes);
+
+#ifdef HAVE_MPI
+  const int nNeeded = neededBlocks.size();
+  vector<int> blocklen(nNeeded);
+  vector<MPI_Aint> displace(nNeeded);
+  for (int i = 0; i < nNeeded; ++i) {
+    blocklen[i] = blockOffset[neededBlocks[i]+1] - blockOffset[neededBlocks[i]];
+    displace[i] = blockOffset[neededBlocks[i]];
+  }
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(nNeeded, blocklen.data(), displace.data(), MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+  MPI_File_set_view(fhw, dataOffset, MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+  MPI_File_read_all(fhw, buffer.data(), nBytes, MPI_BYTE, MPI_STATUS_IGNORE);
+  MPI_Type_free(&filetype);
+  MPI_File_close(&fhw);
+#else
+  if (fseek(fhw, dataOffset, SEEK_SET) || fread(buffer.data(), sizeof(char), nBytes, fhw) != nBytes)
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  fclose(fhw);
+#endif
+
+  /*--- Decompress the fields of each block and copy the points of this rank. ---*/
+
+  Restart_Data.resize(points.size()*nFields);
+  vector<passivedouble> values(CompressionToolbox::RestartBlockSize);
+  const char* compressed = buffer.data();
+  auto iRow = 0ul;
+
+  for (const auto iBlock : neededBlocks) {
+    const auto* entry = &table[iBlock*nEntry];
+    const auto firstRow = iRow;
+    values.resize(entry[1]);
+
+    for (auto iVar = 0ul; iVar < nFields; ++iVar) {
+      CompressionToolbox::Decompress(compressed, entry[2+iVar], values.data(), entry[1]);
+      compressed += entry[2+iVar];
+
+      for (iRow = firstRow; iRow < points.size() && points[iRow] < entry[0] + entry[1]; ++iRow) {
+        Restart_Data[iRow*nFields + iVar] = values[points[iRow] - entry[0]];
+      }
+    }
+  }
+}
+
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetGlobal_nPointDomain() == 0) return;
@@ -3148,39 +3557,31 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
   /* Challenges:
    *  - Do not use too much memory by gathering the restart data in all ranks.
    *  - Do not repeat too many computations in all ranks.
-   * Solution?:
-   *  - Build a local ADT for the domain points (not the restart points).
-   *  - Find the closest target point for each donor, which does not match all targets.
-   *  - "Diffuse" the data to neighbor points.
-   *  Complexity is approx. Nlt + (Nlt + Nd) log(Nlt) where Nlt is the LOCAL number
-   *  of target points and Nd the TOTAL number of donors. */
+   * Solution:
+   *  - The donor (restart) data circulates over all ranks in blocks, the coordinates
+   *    of the old mesh are the first nDim fields of the restart.
+   *  - Build a local ADT for each block of donor points.
+   *  - Find the closest donor of the block for each local target point (batched query),
+   *    and keep the closest over all blocks, this matches all targets.
+   *  Complexity is approx. Nd log(Nd/R) + R Nlt log(Nd/R) where Nlt is the LOCAL number
+   *  of target points, Nd the TOTAL number of donors, and R the number of ranks. */
 
   const unsigned long nFields = Restart_Vars[1];
   const unsigned long nPointFile = Restart_Vars[2];
   const auto t0 = SU2_MPI::Wtime();
-  auto nRecurse = 0;
 
   if (rank == MASTER_NODE) {
-    cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
-            "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n"
-            "A recursive nearest neighbor interpolation will be performed." << endl;
+    if (nPointFile != geometry->GetGlobal_nPointDomain()) {
+      cout << "\nThe number of points in the restart file (" << nPointFile << ") does not match "
+              "the mesh (" << geometry->GetGlobal_nPointDomain() << ").\n";
+    } else {
+      cout << "\nThe restart file will be interpolated (RESTART_INTERPOLATION= YES).\n";
+    }
+    cout << "A nearest neighbor interpolation will be performed." << endl;
   }
 
   su2activematrix localVars(nPointDomain, nFields);
-  localVars = su2double(0.0);
   {
-  su2vector<uint8_t> isMapped(nPoint);
-  isMapped = false;
-
-  /*--- ADT of local target points. ---*/
-  {
-  const auto& coord = geometry->nodes->GetCoord();
-  vector<unsigned long> index(nPointDomain);
-  iota(index.begin(), index.end(), 0ul);
-
-  CADTPointsOnlyClass adt(nDim, nPointDomain, coord.data(), index.data(), false);
-  vector<unsigned long>().swap(index);
-
   /*--- Copy local donor restart data, which will circulate over all ranks. ---*/
 
   const auto partitioner = CLinearPartitioner(nPointFile,0);
@@ -3199,10 +3600,17 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
 
   Restart_Data = decltype(Restart_Data){};
 
-  /*--- Make room to receive donor data from other ranks, and to map it to target points. ---*/
+  /*--- Make room to receive donor data from other ranks, and for the nearest donors of the targets. ---*/
 
   su2activematrix donorVars(nPointDonorMax, nFields);
-  vector<su2double> donorDist(nPointDomain, 1e12);
+  su2activematrix donorCoord(nPointDonorMax, nDim);
+  vector<unsigned long> donorIndex(nPointDonorMax);
+  iota(donorIndex.begin(), donorIndex.end(), 0ul);
+
+  const auto& coord = geometry->nodes->GetCoord();
+  vector<su2double> bestDist(nPointDomain, numeric_limits<passivedouble>::max()), dist(nPointDomain);
+  vector<unsigned long> iDonor(nPointDomain);
+  vector<int> donorRank(nPointDomain);
 
   /*--- Circle over all ranks. ---*/
 
@@ -3223,91 +3631,30 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
       else SU2_MPI::Recv(donorVars.data(), count, MPI_DOUBLE, src, 0, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
     }
 
-    /*--- Find the closest target for each donor. ---*/
-
-    vector<su2double> targetDist(donorVars.rows());
-    vector<unsigned long> iTarget(donorVars.rows());
-
-    SU2_OMP_PARALLEL_(for schedule(dynamic,4*OMP_MIN_SIZE))
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
-      int r=0;
-      adt.DetermineNearestNode(donorVars[iDonor], targetDist[iDonor], iTarget[iDonor], r);
-    }
-    END_SU2_OMP_PARALLEL
+    /*--- ADT of the donor points of this block. ---*/
 
-    /*--- Keep the closest donor for each target (this is separate for OpenMP). ---*/
+    for (auto iPoint = 0ul; iPoint < nPointDonorMax; ++iPoint)
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        donorCoord(iPoint,iDim) = donorVars(iPoint,iDim);
 
-    for (auto iDonor = 0ul; iDonor < donorVars.rows(); ++iDonor) {
-      const auto iPoint = iTarget[iDonor];
-      const auto dist = targetDist[iDonor];
+    CADTPointsOnlyClass adt(nDim, nPointDonorMax, donorCoord.data(), donorIndex.data(), false);
 
-      if (dist < donorDist[iPoint]) {
-        donorDist[iPoint] = dist;
-        isMapped[iPoint] = true;
-        for (auto iVar = 0ul; iVar < donorVars.cols(); ++iVar)
-          localVars(iPoint,iVar) = donorVars(iDonor,iVar);
-      }
-    }
-  }
-  } // everything goes out of scope except "localVars" and "isMapped"
+    /*--- Find the closest donor for each target. ---*/
 
-  /*--- Recursively diffuse the nearest neighbor data. ---*/
+    adt.DetermineNearestNodes(nPointDomain, coord.data(), coord.cols(), dist.data(), iDonor.data(), donorRank.data());
 
-  auto nDonor = isMapped;
-  bool done = false;
+    /*--- Keep the closest donor over all blocks. ---*/
 
-  SU2_OMP_PARALLEL
-  while (!done) {
-    SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain,2*omp_get_num_threads()))
+    SU2_OMP_PARALLEL_(for schedule(static,OMP_MIN_SIZE))
     for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
-      /*--- Do not change points that are already interpolated. ---*/
-      if (isMapped[iPoint]) continue;
-
-      /*--- Boundaries to boundaries and domain to domain. ---*/
-      const bool boundary_i = geometry->nodes->GetSolidBoundary(iPoint);
-
-      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-        if (!isMapped[jPoint]) continue;
-        if (boundary_i != geometry->nodes->GetSolidBoundary(jPoint)) continue;
-
-        nDonor[iPoint]++;
-
-        for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
-          localVars(iPoint,iVar) += localVars(jPoint,iVar);
-      }
-
-      if (nDonor[iPoint] > 0) {
-        for (auto iVar = 0ul; iVar < localVars.cols(); ++iVar)
-          localVars(iPoint,iVar) /= nDonor[iPoint];
-        nDonor[iPoint] = true;
+      if (dist[iPoint] < bestDist[iPoint]) {
+        bestDist[iPoint] = dist[iPoint];
+        for (auto iVar = 0ul; iVar < nFields; ++iVar)
+          localVars(iPoint,iVar) = donorVars(iDonor[iPoint],iVar);
       }
     }
-    END_SU2_OMP_FOR
-
-    /*--- Repeat while all points are not mapped. ---*/
-
-    SU2_OMP_MASTER {
-      done = true;
-      ++nRecurse;
-    }
-    END_SU2_OMP_MASTER
-
-    bool myDone = true;
-
-    SU2_OMP_FOR_STAT(16*OMP_MIN_SIZE)
-    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
-      isMapped[iPoint] = nDonor[iPoint];
-      myDone &= nDonor[iPoint];
-    }
-    END_SU2_OMP_FOR
-
-    SU2_OMP_ATOMIC
-    done &= myDone;
-
-    SU2_OMP_BARRIER
+    END_SU2_OMP_PARALLEL
   }
-  END_SU2_OMP_PARALLEL
-
   } // everything goes out of scope except "localVars"
 
   /*--- Move to Restart_Data in ascending order of global index, which is how a matching restart would have been read. ---*/
@@ -3316,18 +3663,14 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
   Restart_Vars[2] = nPointDomain;
 
   int counter = 0;
-  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
-    const auto iPoint = geometry->GetGlobal_to_Local_Point(iPoint_Global);
-    if (iPoint >= 0) {
-      for (auto iVar = 0ul; iVar < nFields; ++iVar)
-        Restart_Data[counter*nFields+iVar] = SU2_TYPE::GetValue(localVars(iPoint,iVar));
-      counter++;
-    }
+  for (const auto iPoint : geometry->GetDomainPoints_GlobalOrder()) {
+    for (auto iVar = 0ul; iVar < nFields; ++iVar)
+      Restart_Data[counter*nFields+iVar] = SU2_TYPE::GetValue(localVars(iPoint,iVar));
+    counter++;
   }
 
   if (rank == MASTER_NODE) {
-    cout << "Number of recursions: " << nRecurse << ".\n"
-            "Elapsed time: " << SU2_MPI::Wtime()-t0 << "s.\n" << endl;
+    cout << "Elapsed time: " << SU2_MPI::Wtime()-t0 << "s.\n" << endl;
   }
 }
 
@@ -3740,7 +4083,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
       /*--- Get data for this profile. ---*/
 
-      const vector<passivedouble>& Inlet_Data = profileReader.GetDataForProfile(jMarker);
+      const passivedouble* Inlet_Data = profileReader.GetDataForProfile(jMarker);
       const auto nColumns = profileReader.GetNumberOfColumnsInProfile(jMarker);
       vector<su2double> Inlet_Data_Interpolated ((nCol_InletFile+nDim)*geometry[MESH_0]->nVertex[iMarker]);
 
@@ -3816,36 +4159,44 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
         cout<<"No Inlet Interpolation being used"<<endl;
       }
 
-      /*--- Loop through the nodes on this marker. ---*/
-
-      for (auto iVertex = 0ul; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
-
-        const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-        const auto Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
-
-        if (!Interpolate) {
-
-          su2double min_dist = 1e16;
+      /*--- Without interpolation, find the closest point in our inlet profile data for all
+       the nodes on this marker, with a batched query on an ADT of the profile points. ---*/
 
-          /*--- Find the distance to the closest point in our inlet profile data. ---*/
+      const auto nVertexMarker = geometry[MESH_0]->nVertex[iMarker];
+      vector<su2double> closestDist(nVertexMarker, 1e16);
+      vector<unsigned long> closestRow(nVertexMarker, 0);
 
-          for (auto iRow = 0ul; iRow < nRows; iRow++) {
+      if (!Interpolate && nVertexMarker > 0 && nRows > 0) {
+        vector<su2double> profileCoord(nRows*nDim);
+        vector<unsigned long> rowIndex(nRows);
+        for (auto iRow = 0ul; iRow < nRows; iRow++) {
+          rowIndex[iRow] = iRow;
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            profileCoord[iRow*nDim+iDim] = Inlet_Data[iRow*nColumns+iDim];
+        }
+        CADTPointsOnlyClass profileADT(nDim, nRows, profileCoord.data(), rowIndex.data(), false);
 
-            /*--- Get the coords for this data point. ---*/
+        vector<su2double> vertexCoord(nVertexMarker*nDim);
+        for (auto iVertex = 0ul; iVertex < nVertexMarker; iVertex++) {
+          const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+          for (auto iDim = 0u; iDim < nDim; iDim++)
+            vertexCoord[iVertex*nDim+iDim] = geometry[MESH_0]->nodes->GetCoord(iPoint, iDim);
+        }
+        vector<int> closestRank(nVertexMarker);
+        profileADT.DetermineNearestNodes(nVertexMarker, vertexCoord.data(), nDim, closestDist.data(),
+                                         closestRow.data(), closestRank.data());
+      }
 
-            const auto index = iRow*nColumns;
+      /*--- Loop through the nodes on this marker. ---*/
 
-            const auto dist = GeometryToolbox::Distance(nDim, Coord, &Inlet_Data[index]);
+      for (auto iVertex = 0ul; iVertex < nVertexMarker; iVertex++) {
 
-            /*--- Check is this is the closest point and store data if so. ---*/
+        const auto iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+        const auto Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
 
-            if (dist < min_dist) {
-              min_dist = dist;
-              for (auto iVar = 0ul; iVar < nColumns; iVar++)
-                Inlet_Values[iVar] = Inlet_Data[index+iVar];
-            }
+        if (!Interpolate) {
 
-          }
+          const su2double min_dist = closestDist[iVertex];
 
           /*--- If the diff is less than the tolerance, match the two.
           We could modify this to simply use the nearest neighbor, or
@@ -3853,6 +4204,10 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
           if (min_dist < tolerance) {
 
+            const auto index = closestRow[iVertex]*nColumns;
+            for (auto iVar = 0ul; iVar < nColumns; iVar++)
+              Inlet_Values[iVar] = Inlet_Data[index+iVar];
+
             solver[MESH_0][KIND_SOLVER]->SetInletAtVertex(Inlet_Values.data(), iMarker, iVertex);
 
           } else {
@@ -4150,6 +4505,66 @@ void CSolver::SetVerificationSolution(unsigned short nDim,
   }
 }
 
+namespace {
+/*--- The verification data only depends on the coordinates and time. With the discrete adjoint it is
+ *    recomputed to be recorded (sensitivities w.r.t. the mesh). ---*/
+bool ReuseVerificationData(const CConfig *config) {
+  return config->GetTime_Marching() == TIME_MARCHING::STEADY && !config->GetDynamic_Grid() &&
+         !config->GetDeform_Mesh() && !config->GetDiscrete_Adjoint();
+}
+}
+
+const su2activematrix& CSolver::GetVerificationSourceTerms(const CGeometry *geometry, const CConfig *config) {
+
+  if (ReuseVerificationData(config) && VerificationSourceTerms.rows() == nPointDomain) return VerificationSourceTerms;
+
+  su2double time = 0.0;
+  if (config->GetTime_Marching() != TIME_MARCHING::STEADY) time = config->GetPhysicalTime();
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(VerificationSourceTerms.resize(nPointDomain, nVar);)
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iVar = 0u; iVar < nVar; iVar++) VerificationSourceTerms(iPoint, iVar) = 0.0;
+    VerificationSolution->GetMMSSourceTerm(geometry->nodes->GetCoord(iPoint), time, VerificationSourceTerms[iPoint]);
+  }
+  END_SU2_OMP_FOR
+
+  return VerificationSourceTerms;
+}
+
+const su2activematrix& CSolver::GetVerificationBCStates(const CGeometry *geometry, const CConfig *config,
+                                                        unsigned short val_marker) {
+
+  const auto nVertex = geometry->nVertex[val_marker];
+
+  if (ReuseVerificationData(config) && VerificationBCStates.size() > val_marker &&
+      VerificationBCStates[val_marker].rows() == nVertex) {
+    return VerificationBCStates[val_marker];
+  }
+
+  su2double time = 0.0;
+  if (config->GetTime_Marching() != TIME_MARCHING::STEADY) time = config->GetPhysicalTime();
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    VerificationBCStates.resize(max<size_t>(VerificationBCStates.size(), config->GetnMarker_All()));
+    VerificationBCStates[val_marker].resize(nVertex, nVar);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  auto& states = VerificationBCStates[val_marker];
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    for (auto iVar = 0u; iVar < nVar; iVar++) states(iVertex, iVar) = 0.0;
+    VerificationSolution->GetBCState(geometry->nodes->GetCoord(iPoint), time, states[iVertex]);
+  }
+  END_SU2_OMP_FOR
+
+  return states;
+}
+
 void CSolver::ComputeResidual_Multizone(const CGeometry *geometry, const CConfig *config){
 
   SU2_OMP_PARALLEL {
@@ -4217,27 +4632,20 @@ void CSolver::BasicLoadRestart(CGeometry *geometry, const CConfig *config, const
 
   unsigned long iPoint_Global_Local = 0;
 
-  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
-
-    const auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+  /*--- The restart data of this rank is in ascending order of global index. ---*/
 
-    if (iPoint_Local > -1) {
+  for (const auto iPoint_Local : geometry->GetDomainPoints_GlobalOrder()) {
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto index = iPoint_Global_Local*Restart_Vars[1] + skipVars;
-
-      for (auto iVar = 0u; iVar < nVar; iVar++) {
-        base_nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
-      }
+    const auto index = iPoint_Global_Local*Restart_Vars[1] + skipVars;
 
-      iPoint_Global_Local++;
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      base_nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
     }
 
+    iPoint_Global_Local++;
   }
 
   /*--- Delete the class memory that is used to load the restart. ---*/
@@ -4342,3 +4750,110 @@ void CSolver::SavelibROM(CGeometry *geometry, CConfig *config, bool converged) {
 #endif
 
 }
+
+su2double CSolver::SolveReducedOrder(CGeometry *geometry, const CConfig *config) {
+
+#if defined(HAVE_LIBROM) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+  const bool lspg = (config->GetKind_ROMProjection() == ROM_PROJECTION::LSPG);
+  const unsigned long nElmDomain = nPointDomain * nVar;
+
+  /*--- Read the basis on the first call. Its rows are the solution at the points owned by this rank
+   (see SavelibROM), therefore the run that saved it must have used the same partitioning. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  if (ROM_Basis.empty()) {
+    CAROM::BasisReader reader(config->GetlibROMbase_FileName());
+    std::unique_ptr<const CAROM::Matrix> basis(reader.getSpatialBasis(0.0));
+
+    if (static_cast<unsigned long>(basis->numRows()) != nElmDomain) {
+      SU2_MPI::Error("The POD basis does not match the partitioning of the mesh, use the same number\n"
+                     "of ranks as the run that saved it.", CURRENT_FUNCTION);
+    }
+    const int nModes = min<int>(basis->numColumns(), config->GetMax_BasisDim());
+
+    if (rank == MASTER_NODE) cout << "Online reduced order model with " << nModes << " POD modes." << endl;
+
+    ROM_Basis.resize(nModes);
+    ROM_JacBasis.resize(nModes);
+    for (int iMode = 0; iMode < nModes; ++iMode) {
+      ROM_Basis[iMode].Initialize(nPoint, nPointDomain, nVar, 0.0);
+      ROM_JacBasis[iMode].Initialize(nPoint, nPointDomain, nVar, 0.0);
+      for (unsigned long i = 0; i < nElmDomain; ++i) ROM_Basis[iMode][i] = basis->item(i, iMode);
+    }
+    ROM_Rhs.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    ROM_System.resize(nModes * (nModes + 1));
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  const unsigned long nModes = ROM_Basis.size();
+
+  /*--- Jacobian times the modes. ---*/
+
+  ROM_Rhs.PassiveCopy(LinSysRes);
+
+  for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+    Jacobian.MatrixVectorProduct(ROM_Basis[iMode], ROM_JacBasis[iMode], geometry, config);
+  }
+
+  /*--- Reduced system (the last column is the right hand side), the contributions of all threads and
+   ranks are reduced at once. The test basis is J Phi for LSPG and Phi for Galerkin. ---*/
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(fill(ROM_System.begin(), ROM_System.end(), 0.0);)
+
+  vector<passivedouble> local(ROM_System.size(), 0.0);
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nElmDomain; ++i) {
+    for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+      const passivedouble test = lspg ? ROM_JacBasis[iMode][i] : ROM_Basis[iMode][i];
+      for (auto jMode = 0ul; jMode < nModes; ++jMode) {
+        local[iMode + jMode * nModes] += test * ROM_JacBasis[jMode][i];
+      }
+      local[iMode + nModes * nModes] += test * ROM_Rhs[i];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL
+  for (auto i = 0ul; i < local.size(); ++i) ROM_System[i] += local[i];
+  END_SU2_OMP_CRITICAL
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    local = ROM_System;
+    SU2_MPI::Allreduce(local.data(), ROM_System.data(), local.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    CSquareMatrixCM matrix(nModes);
+    for (auto iMode = 0ul; iMode < nModes; ++iMode)
+      for (auto jMode = 0ul; jMode < nModes; ++jMode)
+        matrix(iMode, jMode) = ROM_System[iMode + jMode * nModes];
+    matrix.Invert();
+
+    /*--- The reduced coordinates of the update overwrite the first column. ---*/
+    vector<passivedouble> coords(nModes, 0.0);
+    matrix.MatVecMult(&ROM_System[nModes * nModes], coords.data());
+    copy(coords.begin(), coords.end(), ROM_System.begin());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Update in the full space, and residual of the full order system. ---*/
+
+  const su2double rhsNorm = ROM_Rhs.norm();
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto i = 0ul; i < nElmDomain; ++i) {
+    su2double update = 0.0;
+    for (auto iMode = 0ul; iMode < nModes; ++iMode) {
+      update += ROM_System[iMode] * ROM_Basis[iMode][i];
+      ROM_Rhs[i] -= ROM_System[iMode] * ROM_JacBasis[iMode][i];
+    }
+    LinSysSol[i] = update;
+  }
+  END_SU2_OMP_FOR
+
+  return ROM_Rhs.norm() / max(rhsNorm, su2double(EPS));
+#else
+  SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
+  return 0.0;
+#endif
+
+}
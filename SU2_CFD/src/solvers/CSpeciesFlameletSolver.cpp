@@ -85,6 +85,7 @@ void CSpeciesFlameletSolver::Preprocessing(CGeometry* geometry, CSolver** solver
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i_point = 0u; i_point < nPoint; i_point++) {
+    const auto costScope = geometry->ProfilePointCost(i_point);
     CFluidModel* fluid_model_local = solver_container[FLOW_SOL]->GetFluidModel();
     su2double* scalars = nodes->GetSolution(i_point);
     for (auto iVar = 0u; iVar < nVar; iVar++) scalars_vector[iVar] = scalars[iVar];
@@ -562,6 +563,12 @@ unsigned long CSpeciesFlameletSolver::SetPreferentialDiffusionScalars(const CCon
   return misses;
 }
 
+CNumericsSIMD* CSpeciesFlameletSolver::CreateEdgeNumerics(const CSolver* const* solver_container,
+                                                          const CConfig* config) const {
+  if (config->GetPreferentialDiffusion()) return nullptr;
+  return CSpeciesSolver::CreateEdgeNumerics(solver_container, config);
+}
+
 void CSpeciesFlameletSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
                                               CNumerics* numerics, const CConfig* config) {
   /*--- Overloaded viscous residual method which accounts for preferential diffusion.  ---*/
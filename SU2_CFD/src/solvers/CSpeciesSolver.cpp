@@ -109,9 +109,10 @@ void CSpeciesSolver::Initialize(CGeometry* geometry, CConfig* config, unsigned s
   /*--- Define geometry constants in the solver structure ---*/
 
   nDim = geometry->GetnDim();
+  MGLevel = iMesh;
 
 
-if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_ScalarSolvers()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -131,7 +132,7 @@ if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (species transport model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
@@ -216,23 +217,16 @@ void CSpeciesSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+    for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+      /*--- We need to store this point's data, so jump to the correct
+       offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+      const auto index = counter * Restart_Vars[1] + skipVars;
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
 
-      if (iPoint_Local > -1) {
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
-
-        const auto index = counter * Restart_Vars[1] + skipVars;
-        for (auto iVar = 0u; iVar < nVar; iVar++)
-          nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
-
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
-      }
+      /*--- Increment the overall counter for how many points have been loaded. ---*/
+      counter++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -295,15 +289,21 @@ void CSpeciesSolver::Preprocessing(CGeometry* geometry, CSolver** solver_contain
                                    bool Output) {
   SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetGlobalParam(config->GetKind_Solver(), RunTime_EqSystem);)
 
-  /*--- Set the laminar mass Diffusivity for the species solver. ---*/
+  /*--- Set the laminar mass Diffusivity for the species solver. The fluid model is per thread, its
+   diffusivity model only needs to be set once. When all species share the same diffusivity it is
+   evaluated once per point. ---*/
+  auto* fluidModel = solver_container[FLOW_SOL]->GetFluidModel();
+  fluidModel->SetMassDiffusivityModel(config);
+  const bool sharedDiffusivity = config->GetSpecies_SharedDiffusivity();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0u; iPoint < nPoint; iPoint++) {
     const su2double temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
     const su2double* scalar = solver_container[SPECIES_SOL]->GetNodes()->GetSolution(iPoint);
-    solver_container[FLOW_SOL]->GetFluidModel()->SetMassDiffusivityModel(config);
-    solver_container[FLOW_SOL]->GetFluidModel()->SetTDState_T(temperature, scalar);
+    fluidModel->SetTDState_T(temperature, scalar);
+    const su2double shared_diffusivity = sharedDiffusivity ? fluidModel->GetMassDiffusivity(0) : 0.0;
     for (auto iVar = 0u; iVar <= nVar; iVar++) {
-      const su2double mass_diffusivity = solver_container[FLOW_SOL]->GetFluidModel()->GetMassDiffusivity(iVar);
+      const su2double mass_diffusivity = sharedDiffusivity ? shared_diffusivity : fluidModel->GetMassDiffusivity(iVar);
       nodes->SetDiffusivity(iPoint, mass_diffusivity, iVar);
     }
 
@@ -314,6 +314,10 @@ void CSpeciesSolver::Preprocessing(CGeometry* geometry, CSolver** solver_contain
   CommonPreprocessing(geometry, config, Output);
 }
 
+CNumericsSIMD* CSpeciesSolver::CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const {
+  return CNumericsSIMD::CreateScalarNumerics(*config, nDim, nVar, SPECIES_SOL, *solver_container[FLOW_SOL]);
+}
+
 void CSpeciesSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
                                       CNumerics* numerics, const CConfig* config) {
   /*--- Define an object to set solver specific numerics contribution. ---*/
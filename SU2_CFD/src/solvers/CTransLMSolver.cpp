@@ -31,6 +31,7 @@
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 /*---  This is the implementation of the Langtry-Menter transition model.
        The main reference for this model is:Langtry, Menter, AIAA J. 47(12) 2009
@@ -79,7 +80,7 @@ CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned sh
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (LM transition model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
@@ -263,6 +264,16 @@ void CTransLMSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
 }
 
 
+CNumericsSIMD* CTransLMSolver::CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const {
+  return CNumericsSIMD::CreateScalarNumerics(*config, nDim, nVar, TRANS_SOL, *solver_container[FLOW_SOL]);
+}
+
+CNumericsSIMD* CTransLMSolver::CreateSourceNumerics(const CSolver* const* solver_container,
+                                                    const CConfig* config) const {
+  return CNumericsSIMD::CreateScalarSourceNumerics(*config, nDim, TRANS_SOL, *solver_container[FLOW_SOL],
+                                                   solver_container[TURB_SOL]);
+}
+
 void CTransLMSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry* geometry, CSolver** solver_container,
                                      CNumerics* numerics, const CConfig* config) {
 
@@ -279,6 +290,9 @@ void CTransLMSolver::Viscous_Residual(const unsigned long iEdge, const CGeometry
 void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Vectorized sources, if enabled (only on the fine grid). ---*/
+  if ((iMesh == MESH_0) && PointSourceResidual(geometry, solver_container, config)) return;
+
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
@@ -528,24 +542,17 @@ void CTransLMSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
-
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+      /*--- We need to store this point's data, so jump to the correct
+       offset in the buffer of data from the restart file and load it. ---*/
 
-      if (iPoint_Local > -1) {
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
+      const auto index = counter * Restart_Vars[1] + skipVars;
+      for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
+      nodes ->SetIntermittencySep(iPoint_Local,  Restart_Data[index + 2]);
+      nodes ->SetIntermittencyEff(iPoint_Local,  Restart_Data[index + 3]);
 
-        const auto index = counter * Restart_Vars[1] + skipVars;
-        for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
-        nodes ->SetIntermittencySep(iPoint_Local,  Restart_Data[index + 2]);
-        nodes ->SetIntermittencyEff(iPoint_Local,  Restart_Data[index + 3]);
-
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
-      }
+      /*--- Increment the overall counter for how many points have been loaded. ---*/
+      counter++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -53,10 +53,11 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   /*--- Define geometry constants in the solver structure ---*/
 
   nDim = geometry->GetnDim();
+  MGLevel = iMesh;
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or all levels if the scalar solvers use the multigrid ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_ScalarSolvers()) {
 
     /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -68,10 +69,11 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SA model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
+    InitializeCoupledSystem(geometry, config);
 
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
@@ -1340,6 +1342,35 @@ void CTurbSASolver::SetTurbVars_WF(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
+void CTurbSASolver::SetDES_GeometricLengths(const CGeometry *geometry, unsigned short kindHybridRANSLES) {
+
+  /*--- The differences are stored with 3 components also in 2D (the vorticity has 3). ---*/
+
+  const auto& neighbors = geometry->nodes->GetPoints();
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (kindHybridRANSLES == SA_ZDES) DES_Delta.resize(nPointDomain, 3) = su2double(0.0);
+    if (kindHybridRANSLES == SA_EDDES) DES_NeighborDelta.resize(neighbors.getNumNonZeros(), 3) = su2double(0.0);
+    DES_GeometryReady = true;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto coord_i = geometry->nodes->GetCoord(iPoint);
+
+    for (auto iNeigh = neighbors.outerPtr()[iPoint]; iNeigh < neighbors.outerPtr()[iPoint+1]; ++iNeigh) {
+      const auto coord_j = geometry->nodes->GetCoord(neighbors.innerIdx()[iNeigh]);
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const su2double delta = fabs(coord_j[iDim] - coord_i[iDim]);
+        if (kindHybridRANSLES == SA_ZDES) DES_Delta(iPoint, iDim) = max(DES_Delta(iPoint, iDim), delta);
+        if (kindHybridRANSLES == SA_EDDES) DES_NeighborDelta(iNeigh, iDim) = delta;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config){
 
   const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
@@ -1352,11 +1383,21 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver[FLOW_SOL]->GetNodes());
 
+  /*--- The geometric parts of the length scales are computed once for static meshes, only the flow
+   *    dependent parts (shielding function, vorticity direction) are evaluated every iteration.
+   *    With mesh motion, or for the discrete adjoint (mesh sensitivities), they are recomputed. ---*/
+
+  const bool staticMesh = !config->GetDynamic_Grid() && !config->GetDeform_Mesh() && !config->GetDiscrete_Adjoint();
+
+  if ((kindHybridRANSLES == SA_ZDES || kindHybridRANSLES == SA_EDDES) && (!staticMesh || !DES_GeometryReady)) {
+    SetDES_GeometricLengths(geometry, kindHybridRANSLES);
+  }
+
+  const auto& neighbors = geometry->nodes->GetPoints();
+
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++){
 
-    const auto coord_i       = geometry->nodes->GetCoord(iPoint);
-    const auto nNeigh        = geometry->nodes->GetnPoint(iPoint);
     const auto wallDistance  = geometry->nodes->GetWall_Distance(iPoint);
     const auto velocityGrad  = flowNodes->GetVelocityGradient(iPoint);
     const auto vorticity     = flowNodes->GetVorticity(iPoint);
@@ -1365,6 +1406,7 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
     const auto eddyViscosity    = nodes->GetmuT(iPoint);
     const su2double kinematicViscosity     = laminarViscosity/density;
     const su2double kinematicViscosityTurb = eddyViscosity/density;
+    const su2double maxLength = geometry->nodes->GetMaxLength(iPoint);
 
     su2double uijuij = 0.0;
     for(auto iDim = 0u; iDim < nDim; iDim++){
@@ -1389,6 +1431,11 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
     su2double psi_2 = (1.0 - (cb1/(cw1*k2*fw_star))*(ft2 + (1.0 - ft2)*fv2))/(fv1 * max(1.0e-10,1.0-ft2));
     psi_2 = min(100.0,psi_2);
 
+    /*--- Shielding function of the delayed variants. ---*/
+
+    const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
+    const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+
     su2double lengthScale = 0.0;
 
     switch(kindHybridRANSLES){
@@ -1398,8 +1445,7 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
         1997
         ---*/
 
-        const su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
-        const su2double distDES = constDES * maxDelta;
+        const su2double distDES = constDES * maxLength;
         lengthScale = min(distDES,wallDistance);
 
         break;
@@ -1410,12 +1456,7 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
          Theoretical and Computational Fluid Dynamics - 2006
          ---*/
 
-        const su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-
-        const su2double distDES = constDES * maxDelta;
+        const su2double distDES = constDES * maxLength;
         lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
 
         break;
@@ -1426,33 +1467,20 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
          Theoretical and Computational Fluid Dynamics - 2012
          ---*/
 
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
+        su2double maxDelta = maxLength;
 
-        su2double delta[MAXNDIM] = {}, ratioOmega[MAXNDIM] = {};
+        if (f_d >= 0.99) {
+          const su2double* delta = DES_Delta[iPoint];
+          const su2double omega = GeometryToolbox::Norm(3, vorticity);
 
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            const su2double deltaAux = abs(coord_j[iDim] - coord_i[iDim]);
-            delta[iDim] = max(delta[iDim], deltaAux);
+          su2double ratioOmega[MAXNDIM] = {};
+          for (auto iDim = 0u; iDim < 3; iDim++){
+            ratioOmega[iDim] = vorticity[iDim]/omega;
           }
-        }
-
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
 
-        for (auto iDim = 0u; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-
-        su2double maxDelta = sqrt(pow(ratioOmega[0], 2)*delta[1]*delta[2] +
-                                  pow(ratioOmega[1], 2)*delta[0]*delta[2] +
-                                  pow(ratioOmega[2], 2)*delta[0]*delta[1]);
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-
-        if (f_d < 0.99){
-          maxDelta = deltaDDES;
+          maxDelta = sqrt(pow(ratioOmega[0], 2)*delta[1]*delta[2] +
+                          pow(ratioOmega[1], 2)*delta[0]*delta[2] +
+                          pow(ratioOmega[2], 2)*delta[0]*delta[1]);
         }
 
         const su2double distDES = constDES * maxDelta;
@@ -1466,45 +1494,36 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
          Flow Turbulence Combust - 2015
          ---*/
 
-        su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
-
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
-
-        su2double ratioOmega[MAXNDIM] = {};
+        su2double maxDelta = maxLength;
 
-        for (auto iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
+        if (f_d >= 0.999) {
+          const su2double omega = GeometryToolbox::Norm(3, vorticity);
 
-        su2double ln_max = 0.0;
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          su2double delta[MAXNDIM] = {};
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);
+          su2double ratioOmega[MAXNDIM] = {};
+          for (auto iDim = 0; iDim < 3; iDim++){
+            ratioOmega[iDim] = vorticity[iDim]/omega;
           }
-          su2double ln[3];
-          ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
-          ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
-          ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
-          const su2double aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
-          ln_max = max(ln_max, aux_ln);
-          vortexTiltingMeasure += nodes->GetVortex_Tilting(jPoint);
-        }
-        vortexTiltingMeasure /= (nNeigh + 1);
 
-        const su2double f_kh = max(f_min,
-                                   min(f_max,
-                                       f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
+          su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
+          su2double ln_max = 0.0;
+
+          for (auto iNeigh = neighbors.outerPtr()[iPoint]; iNeigh < neighbors.outerPtr()[iPoint+1]; ++iNeigh) {
+            const su2double* delta = DES_NeighborDelta[iNeigh];
+            su2double ln[3];
+            ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
+            ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
+            ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
+            const su2double aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
+            ln_max = max(ln_max, aux_ln);
+            vortexTiltingMeasure += nodes->GetVortex_Tilting(neighbors.innerIdx()[iNeigh]);
+          }
+          vortexTiltingMeasure /= (neighbors.getNumNonZeros(iPoint) + 1);
 
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+          const su2double f_kh = max(f_min,
+                                     min(f_max,
+                                         f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
 
-        su2double maxDelta = (ln_max/sqrt(3.0)) * f_kh;
-        if (f_d < 0.999){
-          maxDelta = deltaDDES;
+          maxDelta = (ln_max/sqrt(3.0)) * f_kh;
         }
 
         const su2double distDES = constDES * maxDelta;
@@ -55,10 +55,11 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   /*--- Define geometry constants in the solver structure ---*/
 
   nDim = geometry->GetnDim();
+  MGLevel = iMesh;
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or all levels if the scalar solvers use the multigrid ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_ScalarSolvers()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -70,10 +71,11 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     /*--- Initialization of the structure of the whole Jacobian ---*/
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SST model)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
+    InitializeCoupledSystem(geometry, config);
 
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
@@ -193,6 +195,23 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
 }
 
+void CTurbSSTSolver::UpdateFarfieldVelocity(const CConfig* config) {
+
+  const su2double rhoInf = config->GetDensity_FreeStreamND();
+  const su2double muLamInf = config->GetViscosity_FreeStreamND();
+  const su2double Intensity = config->GetTurbulenceIntensity_FreeStream();
+  const su2double viscRatio = config->GetTurb2LamViscRatio_FreeStream();
+  const su2double VelMag2 = GeometryToolbox::SquaredNorm(nDim, config->GetVelocity_FreeStreamND());
+
+  Solution_Inf[0] = 3.0/2.0*(VelMag2*Intensity*Intensity);
+  Solution_Inf[1] = rhoInf*Solution_Inf[0]/(muLamInf*viscRatio);
+
+  if (sstParsedOptions.dll) {
+    lowerlimit[0] = config->GetKFactor_LowerLimit() * Solution_Inf[0];
+    lowerlimit[1] = config->GetOmegaFactor_LowerLimit() * Solution_Inf[1];
+  }
+}
+
 void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
          unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
   SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetGlobalParam(config->GetKind_Solver(), RunTime_EqSystem);)
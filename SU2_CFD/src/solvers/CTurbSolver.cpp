@@ -45,6 +45,80 @@ CTurbSolver::~CTurbSolver() {
   }
 }
 
+void CTurbSolver::InitializeCoupledSystem(CGeometry* geometry, const CConfig* config) {
+
+  if (!config->GetCoupled_Turb_Solve()) return;
+
+  /*--- The compressible and incompressible flow solvers have nDim+2 variables. ---*/
+
+  const unsigned short nVarCoupled = nDim + 2 + nVar;
+
+  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (coupled flow and turbulence)." << endl;
+  CoupledJacobian.Initialize(nPoint, nPointDomain, nVarCoupled, nVarCoupled, true, geometry, config);
+  CoupledRes.Initialize(nPoint, nPointDomain, nVarCoupled, 0.0);
+  CoupledSol.Initialize(nPoint, nPointDomain, nVarCoupled, 0.0);
+  CoupledSystem.SetxIsZero(true);
+}
+
+void CTurbSolver::ImplicitEuler_Iteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) {
+
+  if (!config->GetCoupled_Turb_Solve()) {
+    CScalarSolver::ImplicitEuler_Iteration(geometry, solver_container, config);
+    return;
+  }
+
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- Combine the systems into blocks of (nVar_flow + nVar_turb), the blocks that couple the flow and turbulence
+   * variables stay zero since the numerics do not provide those derivatives, the benefit is that both solutions
+   * are updated from the same state, with a single linear solve. ---*/
+
+  auto* flowSolver = solver_container[FLOW_SOL];
+  const auto nVarFlow = flowSolver->GetnVar();
+
+  CoupledJacobian.SetSubBlocks(flowSolver->Jacobian, 0);
+  CoupledJacobian.SetSubBlocks(Jacobian, nVarFlow);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    CoupledSol.SetBlock_Zero(iPoint);
+    if (iPoint >= nPointDomain) {
+      CoupledRes.SetBlock_Zero(iPoint);
+      continue;
+    }
+    for (auto iVar = 0u; iVar < nVarFlow; iVar++) CoupledRes(iPoint, iVar) = flowSolver->LinSysRes(iPoint, iVar);
+    for (auto iVar = 0u; iVar < nVar; iVar++) CoupledRes(iPoint, nVarFlow + iVar) = LinSysRes(iPoint, iVar);
+  }
+  END_SU2_OMP_FOR
+
+  auto iter = CoupledSystem.Solve(CoupledJacobian, CoupledRes, CoupledSol, geometry, config);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SetIterLinSolver(iter);
+    SetResLinSolver(CoupledSystem.GetResidual());
+    flowSolver->SetIterLinSolver(iter);
+    flowSolver->SetResLinSolver(CoupledSystem.GetResidual());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (auto iVar = 0u; iVar < nVarFlow; iVar++) flowSolver->LinSysSol(iPoint, iVar) = CoupledSol(iPoint, iVar);
+    for (auto iVar = 0u; iVar < nVar; iVar++) LinSysSol(iPoint, iVar) = CoupledSol(iPoint, nVarFlow + iVar);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- The flow is updated first, the update of conservative turbulence variables uses its old density. ---*/
+
+  flowSolver->CompleteImplicitIteration(geometry, solver_container, config);
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+CNumericsSIMD* CTurbSolver::CreateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) const {
+  return CNumericsSIMD::CreateScalarNumerics(*config, nDim, nVar, TURB_SOL, *solver_container[FLOW_SOL],
+                                             GetConstants());
+}
+
 void CTurbSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
@@ -136,22 +210,15 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+    for (const auto iPoint_Local : geometry[MESH_0]->GetDomainPoints_GlobalOrder()) {
+      /*--- We need to store this point's data, so jump to the correct
+       offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+      const auto index = counter * Restart_Vars[1] + skipVars;
+      for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
 
-      if (iPoint_Local > -1) {
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
-
-        const auto index = counter * Restart_Vars[1] + skipVars;
-        for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index + iVar]);
-
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
-      }
+      /*--- Increment the overall counter for how many points have been loaded. ---*/
+      counter++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -140,6 +140,60 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+unsigned long CEulerVariable::SetPrimVarBlock(unsigned long iPointBegin, unsigned long iPointEnd,
+                                              CFluidModel *FluidModel, bool batch) {
+
+  unsigned long nonPhysicalPoints = 0;
+  su2double density[CFluidModel::BlockSize], staticEnergy[CFluidModel::BlockSize];
+  CFluidModel::TDStateBlock state;
+
+  for (auto iBlock = iPointBegin; iBlock < iPointEnd; iBlock += CFluidModel::BlockSize) {
+    const auto nPointBlock = min(+CFluidModel::BlockSize, iPointEnd - iBlock);
+
+    for (auto i = 0ul; i < nPointBlock; i++) {
+      const auto iPoint = iBlock + i;
+      SetVelocity(iPoint);   // Computes velocity and velocity^2
+      density[i] = GetDensity(iPoint);
+      staticEnergy[i] = GetEnergy(iPoint)-0.5*Velocity2(iPoint);
+    }
+
+    if (batch) FluidModel->GetTDStateBatch(iBlock, nPointBlock, density, state);
+    else FluidModel->SetTDStateBlock_rhoe(nPointBlock, density, staticEnergy, state);
+
+    for (auto i = 0ul; i < nPointBlock; i++) {
+      const auto iPoint = iBlock + i;
+
+      bool check_dens  = SetDensity(iPoint);
+      bool check_press = SetPressure(iPoint, state.Pressure[i]);
+      bool check_sos   = SetSoundSpeed(iPoint, state.SoundSpeed2[i]);
+      bool check_temp  = SetTemperature(iPoint, state.Temperature[i]);
+
+      /*--- Non-physical points are recomputed from the old solution one at a time. ---*/
+
+      if (check_dens || check_press || check_sos || check_temp) {
+        for (unsigned long iVar = 0; iVar < nVar; iVar++)
+          Solution(iPoint, iVar) = Solution_Old(iPoint, iVar);
+
+        SetPrimVar(iPoint, FluidModel);
+        SetSecondaryVar(iPoint, FluidModel);
+        nonPhysicalPoints++;
+        continue;
+      }
+
+      SetEnthalpy(iPoint);
+      SetdPdrho_e(iPoint, state.dPdrho_e[i]);
+      SetdPde_rho(iPoint, state.dPde_rho[i]);
+
+      if (DataDrivenFluid) {
+        SetDataExtrapolation(iPoint, state.Extrapolation[i]);
+        SetEntropy(iPoint, state.Entropy[i]);
+      }
+    }
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
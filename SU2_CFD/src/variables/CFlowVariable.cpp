@@ -25,6 +25,7 @@
  */
 
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/fluid/CFluidModel.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
 CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, unsigned long nprimvar,
@@ -97,6 +98,27 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
   if (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) {
     HB_Source.resize(nPoint, nVar) = su2double(0.0);
   }
+
+  /*--- The cached transport properties would not be differentiated, and with species transport they also
+   *    depend on the composition. ---*/
+  if (config->GetTransport_Cache_Tol() > 0.0 && config->GetViscous() && !config->GetDiscrete_Adjoint() &&
+      config->GetKind_Species_Model() == SPECIES_MODEL::NONE) {
+    TransportCacheTol = config->GetTransport_Cache_Tol();
+    TransportCache.resize(nPoint, CFluidModel::CACHE_SIZE) = su2double(0.0);
+    TransportCacheHit.resize(nPoint) = false;
+  }
+}
+
+void CFlowVariable::ComputeTransportProperties(unsigned long iPoint, CFluidModel* FluidModel, su2double& mu,
+                                               su2double& kt) {
+  if (TransportCacheTol > 0.0) {
+    TransportCacheHit(iPoint) = FluidModel->ComputeTransportCached(TransportCache[iPoint], TransportCacheTol);
+    mu = TransportCache(iPoint, CFluidModel::CACHE_MU);
+    kt = TransportCache(iPoint, CFluidModel::CACHE_KT);
+  } else {
+    mu = FluidModel->GetLaminarViscosity();
+    kt = FluidModel->GetThermalConductivity();
+  }
 }
 
 void CFlowVariable::SetSolution_New() {
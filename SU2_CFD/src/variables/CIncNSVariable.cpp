@@ -105,18 +105,18 @@ bool CIncNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2do
 
   SetVelocity(iPoint);
 
-  /*--- Set laminar viscosity ---*/
-
-  SetLaminarViscosity(iPoint, FluidModel->GetLaminarViscosity());
-
   /*--- Set eddy viscosity locally and in the fluid model. ---*/
 
   SetEddyViscosity(iPoint, eddy_visc);
   FluidModel->SetEddyViscosity(eddy_visc);
 
-  /*--- Set thermal conductivity (effective value if RANS). ---*/
+  /*--- Set laminar viscosity and thermal conductivity (effective value if RANS). ---*/
+
+  su2double mu, kt;
+  ComputeTransportProperties(iPoint, FluidModel, mu, kt);
 
-  SetThermalConductivity(iPoint, FluidModel->GetThermalConductivity());
+  SetLaminarViscosity(iPoint, mu);
+  SetThermalConductivity(iPoint, kt);
 
   /*--- Set specific heats ---*/
 
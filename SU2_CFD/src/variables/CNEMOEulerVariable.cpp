@@ -242,7 +242,7 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
   fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
 
   const auto& cvves = fluidmodel->ComputeSpeciesCvVibEle(V[TVE_INDEX]);
-  vector<su2double> eves  = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
+  const auto& eves  = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
     val_eves[iSpecies]  = eves[iSpecies];
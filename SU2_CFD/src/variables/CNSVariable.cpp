@@ -182,18 +182,18 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   SetEnthalpy(iPoint); // Requires pressure computation.
 
-  /*--- Set laminar viscosity ---*/
+  /*--- Set laminar viscosity and thermal conductivity ---*/
 
-  SetLaminarViscosity(iPoint, FluidModel->GetLaminarViscosity());
+  su2double mu, kt;
+  ComputeTransportProperties(iPoint, FluidModel, mu, kt);
+
+  SetLaminarViscosity(iPoint, mu);
+  SetThermalConductivity(iPoint, kt);
 
   /*--- Set eddy viscosity ---*/
 
   SetEddyViscosity(iPoint, eddy_visc);
 
-  /*--- Set thermal conductivity ---*/
-
-  SetThermalConductivity(iPoint, FluidModel->GetThermalConductivity());
-
   /*--- Set specific heat ---*/
 
   SetSpecificHeatCp(iPoint, FluidModel->GetCp());
@@ -55,6 +55,19 @@ CScalarVariable::CScalarVariable(unsigned long npoint, unsigned long ndim, unsig
   UnderRelaxation.resize(nPoint) = su2double(1.0);
   LocalCFL.resize(nPoint) = su2double(0.0);
 
+  /*--- Allocate residual structures for multigrid. ---*/
+  if (config->GetMG_ScalarSolvers()) {
+    Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+
+    for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+        Residual_Sum.resize(nPoint, nVar);
+        Residual_Old.resize(nPoint, nVar);
+        break;
+      }
+    }
+  }
+
   /*--- Allocate space for the harmonic balance source terms ---*/
   if (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) {
     HB_Source.resize(nPoint, nVar) = su2double(0.0);
@@ -85,21 +85,18 @@ class CDiscAdjDeformationDriver : public CDriverBase {
   void SetProjection_FD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Gradient);
 
   /*!
-   * \brief Projection of the surface sensitivity using algorithmic differentiation (AD).
+   * \brief Project the surface sensitivity onto the control points of (cartesian) FFD boxes, in one pass over the
+   *        local surface points, the finite difference gradient of each FFD design variable is then the product with
+   *        the displacement of the control points instead of a deformation of the surface.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] surface_movement - Surface movement class of the problem.
-   * \param[in] Gradient_file - Output file to store the gradient data.
+   * \param[in] FFDBox - FFD boxes of the problem.
+   * \param[out] ControlPointSens - Sensitivity of the control points of each box (local contribution).
    */
-  void SetProjection_AD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Gradient);
+  void SetControlPointSensitivity(CGeometry* geometry, CConfig* config, const CSurfaceMovement* surface_movement,
+                                  CFreeFormDefBox** FFDBox, vector<vector<su2double> >& ControlPointSens);
 
-  /*!
-   * \brief Prints the gradient information to a file.
-   * \param[in] Gradient - The gradient data.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] Gradient_file - Output file to store the gradient data.
-   */
-  void OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file);
 
   /*!
    * \brief Write the sensitivity (including mesh sensitivity) computed with the discrete adjoint method
@@ -61,6 +61,13 @@ int main(int argc, char* argv[]) {
 
   driver.Finalize();
 
+  /*--- Finalize PETSc (if it was used), before MPI. ---*/
+#ifdef HAVE_PETSC
+  PetscBool petscStarted = PETSC_FALSE;
+  PetscInitialized(&petscStarted);
+  if (petscStarted) PetscFinalize();
+#endif
+
   /*--- Finalize MPI parallelization. ---*/
 
   SU2_MPI::Finalize();
@@ -25,13 +25,11 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#define ENABLE_MAPS
 #include "../../../Common/include/CConfig.hpp"
-#undef ENABLE_MAPS
-
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/grid_movement/CSurfaceMovement.hpp"
 #include "../../../Common/include/grid_movement/CVolumetricMovement.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../SU2_CFD/include/numerics/CGradSmoothing.hpp"
 #include "../../../SU2_CFD/include/output/CBaselineOutput.hpp"
 #include "../../../SU2_CFD/include/solvers/CBaselineSolver.hpp"
@@ -347,8 +345,8 @@ void CDiscAdjDeformationDriver::Run() {
           DerivativeTreatment_Gradient(geometry_container[iZone][INST_0][MESH_0], config_container[iZone],
                                        grid_movement[iZone][INST_0], surface_movement[iZone], Gradient);
         } else {
-          SetProjection_AD(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], surface_movement[iZone],
-                           Gradient);
+          surface_movement[iZone]->SetProjection_AD(geometry_container[iZone][INST_0][MESH_0], config_container[iZone],
+                                                    Gradient);
         }
       } else {
         SetProjection_FD(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], surface_movement[iZone],
@@ -363,7 +361,7 @@ void CDiscAdjDeformationDriver::Run() {
 
   /*--- Print gradients to screen and writes to file. ---*/
 
-  OutputGradient(Gradient, config_container[ZONE_0], Gradient_file);
+  CSurfaceMovement::OutputGradient(Gradient, config_container[ZONE_0], Gradient_file);
 }
 
 void CDiscAdjDeformationDriver::Finalize() {
@@ -387,7 +385,8 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
   su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity, dalpha[3], deps[3], dalpha_deps;
-  bool *UpdatePoint, MoveSurface, Local_MoveSurface;
+  bool *UpdatePoint, MoveSurface, Local_MoveSurface, Projected;
+  su2double ProjectedGradient;
   CFreeFormDefBox** FFDBox;
 
   int rank = SU2_MPI::GetRank();
@@ -404,6 +403,10 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
   FFDBox = new CFreeFormDefBox*[nFFDBox];
   for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) FFDBox[iFFDBox] = nullptr;
 
+  /*--- Sensitivity of the control points of each FFD box, only for cartesian boxes. ---*/
+
+  vector<vector<su2double> > ControlPointSens(MAX_NUMBER_FFD);
+
   for (iDV = 0; iDV < nDV; iDV++) {
     nDV_Value = config->GetnDV_Value(iDV);
     if (nDV_Value != 1) {
@@ -418,9 +421,21 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
 
   if (rank == MASTER_NODE) cout << "Evaluate functional gradient using Finite Differences." << endl;
 
+  /*--- The bump design variables (Hicks-Henne, surface bump, CST) are projected together in one sweep. ---*/
+
+  vector<unsigned short> BumpDV;
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if (CSurfaceMovement::IsBumpDV(config->GetDesign_Variable(iDV))) BumpDV.push_back(iDV);
+  }
+  vector<su2double> BumpGradient(BumpDV.size(), 0.0);
+  if (!BumpDV.empty()) surface_movement->SetBump_Gradient(geometry, config, BumpDV, BumpGradient.data());
+  auto iBumpDV = 0ul;
+
   for (iDV = 0; iDV < nDV; iDV++) {
     MoveSurface = true;
     Local_MoveSurface = true;
+    Projected = false;
+    ProjectedGradient = 0.0;
 
     /*--- Free form deformation based. ---*/
 
@@ -454,6 +469,14 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
           surface_movement->CheckFFDIntersections(geometry, config, FFDBox[iFFDBox], iFFDBox);
         }
 
+        /*--- The surface of cartesian boxes is linear in the control points, the sensitivity is projected onto
+         * all control points in one pass and each design variable only needs its control point displacement. ---*/
+
+        if (config->GetFFD_CoordSystem() == CARTESIAN) {
+          if (rank == MASTER_NODE) cout << "Project the sensitivity onto the FFD control points." << endl;
+          SetControlPointSensitivity(geometry, config, surface_movement, FFDBox, ControlPointSens);
+        }
+
         if (rank == MASTER_NODE)
           cout << "-------------------------------------------------------------------------" << endl;
       }
@@ -516,27 +539,22 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
 
         if (Local_MoveSurface) {
           MoveSurface = true;
-          surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          if (!ControlPointSens[iFFDBox].empty()) {
+            Projected = true;
+            ProjectedGradient = FFDBox[iFFDBox]->GetControlPointDisplacementDot(ControlPointSens[iFFDBox].data());
+          } else {
+            Projected = false;
+            surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          }
         }
       }
     }
 
-    /*--- Hicks-Henne design variable. ---*/
+    /*--- Hicks-Henne, surface bump, and Kulfan (CST) design variables, already projected. ---*/
 
-    else if (config->GetDesign_Variable(iDV) == HICKS_HENNE) {
-      surface_movement->SetHicksHenne(geometry, config, iDV, true);
-    }
-
-    /*--- Surface bump design variable. ---*/
-
-    else if (config->GetDesign_Variable(iDV) == SURFACE_BUMP) {
-      surface_movement->SetSurface_Bump(geometry, config, iDV, true);
-    }
-
-    /*--- Kulfan (CST) design variable. ---*/
-
-    else if (config->GetDesign_Variable(iDV) == CST) {
-      surface_movement->SetCST(geometry, config, iDV, true);
+    else if (CSurfaceMovement::IsBumpDV(config->GetDesign_Variable(iDV))) {
+      Gradient[iDV][0] = BumpGradient[iBumpDV++];
+      continue;
     }
 
     /*--- Displacement design variable. ---*/
@@ -590,7 +608,9 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
       my_Gradient = 0.0;
       Gradient[iDV][0] = 0.0;
 
-      if (MoveSurface) {
+      if (MoveSurface && Projected) {
+        my_Gradient = ProjectedGradient / config->GetDV_Value(iDV);
+      } else if (MoveSurface) {
         delta_eps = config->GetDV_Value(iDV);
 
         for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) UpdatePoint[iPoint] = true;
@@ -644,151 +664,47 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
   delete[] UpdatePoint;
 }
 
-void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* config,
-                                                 CSurfaceMovement* surface_movement, su2double** Gradient) {
-  su2double *VarCoord = nullptr, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
-  unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
-  unsigned long iVertex, nVertex, iPoint;
-
-  const int rank = SU2_MPI::GetRank();
-
-  nMarker = config->GetnMarker_All();
-  nDim = geometry->GetnDim();
-  nDV = config->GetnDV();
-
-  /*--- Discrete adjoint gradient computation. ---*/
-
-  if (rank == MASTER_NODE)
-    cout << endl
-         << "Evaluate functional gradient using Algorithmic Differentiation (ZONE " << config->GetiZone() << ")."
-         << endl;
-
-  /*--- Start recording of operations. ---*/
-
-  AD::StartRecording();
-
-  /*--- Register design variables as input and set them to zero
-   * (since we want to have the derivative at alpha = 0, i.e. for the current design). ---*/
-
-  for (iDV = 0; iDV < nDV; iDV++) {
-    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
-      config->SetDV_Value(iDV, iDV_Value, 0.0);
-
-      AD::RegisterInput(config->GetDV_Value(iDV, iDV_Value));
-    }
-  }
-
-  /*--- Call the surface deformation routine. ---*/
-
-  surface_movement->SetSurface_Deformation(geometry, config);
-
-  /*--- Stop the recording. --- */
-
-  AD::StopRecording();
-
-  /*--- Create a structure to identify points that have been already visited.
-   * We need that to make sure to set the sensitivity of surface points only once.
-   * Markers share points, so we would visit them more than once in the loop over the markers below). ---*/
-
-  vector<bool> visited(geometry->GetnPoint(), false);
-
-  /*--- Initialize the derivatives of the output of the surface deformation routine
-   * with the discrete adjoints from the CFD solution. ---*/
-
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      nVertex = geometry->nVertex[iMarker];
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        if (!visited[iPoint]) {
-          VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-
-          Area = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Area += Normal[iDim] * Normal[iDim];
-          }
-          Area = sqrt(Area);
-
-          for (iDim = 0; iDim < nDim; iDim++) {
-            if (config->GetDiscrete_Adjoint()) {
-              Sensitivity = geometry->GetSensitivity(iPoint, iDim);
-            } else {
-              Sensitivity = -Normal[iDim] * geometry->vertex[iMarker][iVertex]->GetAuxVar() / Area;
-            }
-            SU2_TYPE::SetDerivative(VarCoord[iDim], SU2_TYPE::GetValue(Sensitivity));
-          }
-          visited[iPoint] = true;
-        }
-      }
-    }
-  }
-
-  /*--- Compute derivatives and extract gradient. ---*/
-
-  AD::ComputeAdjoint();
-
-  for (iDV = 0; iDV < nDV; iDV++) {
-    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
-      my_Gradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
-
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-
-      /*--- Angle of Attack design variable (this is different, the value comes form the input file). ---*/
-
-      if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
-          (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK)) {
-        Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
-      }
-
-      Gradient[iDV][iDV_Value] += localGradient;
+void CDiscAdjDeformationDriver::SetControlPointSensitivity(CGeometry* geometry, CConfig* config,
+                                                           const CSurfaceMovement* surface_movement,
+                                                           CFreeFormDefBox** FFDBox,
+                                                           vector<vector<su2double> >& ControlPointSens) {
+  const auto nDim = geometry->GetnDim();
+
+  /*--- Sensitivity w.r.t. the coordinates of each (domain) surface point, as used by the finite differences,
+   * the first vertex of a point on the design markers defines its normal. ---*/
+
+  vector<bool> HasSens(geometry->GetnPointDomain(), false);
+  su2activematrix PointSens(geometry->GetnPointDomain(), 3);
+  PointSens = su2double(0.0);
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (config->GetMarker_All_DV(iMarker) != YES) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if ((iPoint >= geometry->GetnPointDomain()) || HasSens[iPoint]) continue;
+      const auto* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      const su2double Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
+      const su2double dS = GeometryToolbox::Norm(nDim, Normal);
+      for (auto iDim = 0u; iDim < nDim; iDim++) PointSens(iPoint, iDim) = -Sensitivity * Normal[iDim] / dS;
+      HasSens[iPoint] = true;
     }
   }
 
-  AD::Reset();
-}
-
-void CDiscAdjDeformationDriver::OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file) {
-  unsigned short nDV, iDV, iDV_Value, nDV_Value;
-
-  int rank = SU2_MPI::GetRank();
-
-  nDV = config->GetnDV();
-
-  /*--- Loop through all design variables and their gradients. ---*/
-
-  for (iDV = 0; iDV < nDV; iDV++) {
-    nDV_Value = config->GetnDV_Value(iDV);
-    if (rank == MASTER_NODE) {
-      /*--- Print the kind of design variable on screen. ---*/
-
-      cout << endl << "Design variable (";
-      for (auto it = Param_Map.begin(); it != Param_Map.end(); ++it) {
-        if (it->second == config->GetDesign_Variable(iDV)) {
-          cout << it->first << ") number " << iDV << "." << endl;
-        }
-      }
-
-      /*--- Print the kind of objective function to screen. ---*/
-
-      for (auto it = Objective_Map.begin(); it != Objective_Map.end(); ++it) {
-        if (it->second == config->GetKind_ObjFunc()) {
-          cout << it->first << " gradient : ";
-          if (iDV == 0) Gradient_file << it->first << " gradient " << endl;
-        }
-      }
-
-      /*--- Print the gradient to file and screen. ---*/
-
-      for (iDV_Value = 0; iDV_Value < nDV_Value; iDV_Value++) {
-        cout << Gradient[iDV][iDV_Value];
-        if (iDV_Value != nDV_Value - 1) {
-          cout << ", ";
-        }
-        Gradient_file << Gradient[iDV][iDV_Value] << endl;
-      }
-      cout << endl;
-      cout << "-------------------------------------------------------------------------" << endl;
+  for (auto iFFDBox = 0u; iFFDBox < surface_movement->GetnFFDBox(); iFFDBox++) {
+    auto* Box = FFDBox[iFFDBox];
+    ControlPointSens[iFFDBox].assign(3ul * Box->GetlOrder() * Box->GetmOrder() * Box->GetnOrder(), 0.0);
+    vector<su2double> Work(Box->GetEvalWorkSize());
+    vector<bool> Visited(geometry->GetnPointDomain(), false);
+
+    for (auto iSurfacePoint = 0ul; iSurfacePoint < Box->GetnSurfacePoint(); iSurfacePoint++) {
+      const auto iPoint = Box->Get_PointIndex(iSurfacePoint);
+      if ((iPoint >= geometry->GetnPointDomain()) || !HasSens[iPoint] || Visited[iPoint]) continue;
+      if (config->GetMarker_All_DV(Box->Get_MarkerIndex(iSurfacePoint)) != YES) continue;
+      Visited[iPoint] = true;
+
+      su2double ParamCoord[3];
+      for (auto iDim = 0u; iDim < 3; iDim++) ParamCoord[iDim] = Box->Get_ParametricCoord(iSurfacePoint, iDim);
+      Box->AddControlPointSensitivity(ParamCoord, PointSens[iPoint], ControlPointSens[iFFDBox].data(), Work.data());
     }
   }
 }
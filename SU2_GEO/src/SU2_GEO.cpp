@@ -454,11 +454,9 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    geometry_container[ZONE_0]->ComputeAirfoil_Section(
-        Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr, Xcoord_Airfoil[iPlane],
-        Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane], true, config_container[ZONE_0]);
-  }
+  geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, nullptr, Xcoord_Airfoil,
+                                                      Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, true,
+                                                      config_container[ZONE_0]);
 
   if (rank == MASTER_NODE)
     cout << endl << "-------------------- Objective function evaluation ----------------------" << endl;
@@ -988,12 +986,9 @@ int main(int argc, char* argv[]) {
 
         /*--- Create airfoil structure ---*/
 
-        for (iPlane = 0; iPlane < nPlane; iPlane++) {
-          geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6,
-                                                             1E6, -1E6, 1E6, nullptr, Xcoord_Airfoil[iPlane],
-                                                             Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                             Variable_Airfoil[iPlane], false, config_container[ZONE_0]);
-        }
+        geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, nullptr, Xcoord_Airfoil,
+                                                            Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, false,
+                                                            config_container[ZONE_0]);
       }
 
       /*--- Compute gradient ---*/
@@ -93,6 +93,29 @@ const unsigned int ZONE_0 = 0; /*!< \brief Definition of the first grid domain.
 const unsigned int ZONE_1 = 1; /*!< \brief Definition of the first grid domain. */
 
 %include "../../Common/include/containers/CPyWrapperMatrixView.hpp"
+
+%extend CPyWrapperMatrixView {
+%pythoncode %{
+  @property
+  def __array_interface__(self):
+    """NumPy array interface, numpy.asarray(view) creates a view of the data without copies."""
+    import sys
+    rows, cols = self.Shape()
+    return {"shape": (rows, cols), "typestr": ("<" if sys.byteorder == "little" else ">") + "f8",
+            "data": (self.DataAddress(), self.IsReadOnly()), "version": 3}
+%}
+}
+
+%extend CPyWrapperMarkerMatrixView {
+%pythoncode %{
+  def __array__(self, dtype=None, copy=None):
+    """Conversion to a NumPy array (a copy, the marker vertices are not contiguous), with a single call."""
+    import numpy
+    rows, cols = self.Shape()
+    return numpy.array(self.GetAll(), dtype=dtype).reshape(rows, cols)
+%}
+}
+
 %include "../../SU2_CFD/include/drivers/CDriverBase.hpp"
 %include "../../SU2_CFD/include/drivers/CDriver.hpp"
 %include "../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
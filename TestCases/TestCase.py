@@ -26,6 +26,7 @@
 # License along with SU2. If not, see <http://www.gnu.org/licenses/>.
 from __future__ import print_function, division, absolute_import
 import time, os, subprocess, datetime, sys
+import json
 import difflib
 import platform
 import argparse
@@ -868,6 +869,111 @@ class TestCase:
         os.chdir(workdir)
         return passed
 
+    def run_perf(self, nranks=1, nthreads=1):
+        """ Run the case for test_iter iterations with the runtime profiler enabled, and measure its performance.
+
+        Returns a dictionary with the average time per iteration (s), the peak resident memory of the launched
+        processes (MB), and the per-kernel times of the profiler (runtime_profile.json), or None on failure.
+        """
+
+        print('==================== Start Performance Test: %s (%d ranks x %d threads) ===================='
+              % (self.tag, nranks, nthreads))
+
+        # Fixed iteration count and profiling options, the original cfg is restored at the end
+        original_cfg = self.cfg_file
+        self.adjust_iter()
+        if self.no_restart:
+            self.disable_restart()
+        self.enable_profiling()
+
+        command = self.Command(launch = "mpirun -n %d" % nranks if nranks > 1 else "",
+                               exec = self.command.exec if self.command.exec != "" else "SU2_CFD",
+                               param = "-t %d" % nthreads)
+        command.allow_mpi_as_root()
+
+        logfilename = '%s_perf.log' % os.path.splitext(self.cfg_file)[0]
+        shell_command = "%s %s > %s 2>&1" % (command.assemble(), self.cfg_file, logfilename)
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        profile_file = "runtime_profile.json"
+        if os.path.exists(profile_file):
+            os.remove(profile_file)
+
+        start = datetime.datetime.now()
+        process = subprocess.Popen(shell_command, shell=True)
+
+        # wait4 returns the peak RSS of the largest waited-for descendant (kB on Linux, bytes on macOS)
+        timed_out = False
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            time.sleep(0.1)
+            if self.timeout > 0 and (datetime.datetime.now() - start).seconds > self.timeout:
+                try:
+                    process.kill()
+                    command.killall()
+                except AttributeError:
+                    pass
+                timed_out = True
+        wall_time = (datetime.datetime.now() - start).total_seconds()
+        memory = usage.ru_maxrss / (1024.0**2 if sys.platform == "darwin" else 1024.0)
+
+        result = None
+        if timed_out or os.WEXITSTATUS(status) != 0:
+            print('ERROR: The run failed or timed out, see %s.' % logfilename)
+        else:
+            time_per_iter = None
+            with open(logfilename, 'r') as f:
+                for line in f:
+                    if line.find('Avg. s/iter:') > -1:
+                        time_per_iter = float(line.split(':')[1].split()[0])
+                        break
+
+            kernels = {}
+            if os.path.exists(profile_file):
+                with open(profile_file, 'r') as f:
+                    kernels = json.load(f).get("sections", {})
+
+            if time_per_iter is None:
+                print('ERROR: The time per iteration was not found in %s.' % logfilename)
+            else:
+                result = {"time_per_iter": time_per_iter, "memory": memory, "wall_time": wall_time,
+                          "kernels": kernels}
+                print('Time per iteration: %.6g s, peak memory: %.1f MB, wall time: %.1f s'
+                      % (time_per_iter, memory, wall_time))
+
+        os.chdir(workdir)
+        self.cfg_file = original_cfg
+
+        return result
+
+    def enable_profiling(self):
+
+        # Read the cfg file
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        file_in = open(self.cfg_file, 'r')
+        lines   = file_in.readlines()
+        file_in.close()
+
+        # Rewrite the file with a .autotest extension
+        options = {"WRT_PERFORMANCE": "YES", "RUNTIME_PROFILING": "YES"}
+        self.cfg_file = "%s.autotest"%self.cfg_file
+        file_out = open(self.cfg_file,'w')
+        file_out.write('% This file automatically generated by the regression script\n')
+        file_out.write('% Runtime profiling enabled\n')
+        for line in lines:
+            if not line.strip().split("=")[0].strip() in options:
+                file_out.write(line)
+        for key, value in options.items():
+            file_out.write("%s= %s\n"%(key, value))
+        file_out.close()
+        os.chdir(workdir)
+
+        return
+
     def adjust_iter(self, with_tsan=False, with_asan=False):
 
         # Read the cfg file
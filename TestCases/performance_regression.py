@@ -0,0 +1,200 @@
+#!/usr/bin/env python
+
+## \file performance_regression.py
+#  \brief Python script for performance regression testing (time per iteration, memory, scaling) of SU2 cases
+#  \version 8.1.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+from __future__ import print_function, division, absolute_import
+import sys, os, json, argparse
+from TestCase import TestCase
+
+def parse_perf_args():
+    parser = argparse.ArgumentParser(description='Performance Regression Tests')
+    parser.add_argument('--ranks', default='1,2,4,8', help='Comma separated numbers of MPI ranks for the scaling runs.')
+    parser.add_argument('--threads', default='1,2,4,8', help='Comma separated numbers of OpenMP threads per rank.')
+    parser.add_argument('--baselines', default='performance_baselines.json', help='File with the stored baselines.')
+    parser.add_argument('--results', default='performance_results.json', help='File where the results are written.')
+    parser.add_argument('--tol', type=float, default=0.1, help='Relative tolerance on the time per iteration.')
+    parser.add_argument('--mem_tol', type=float, default=0.1, help='Relative tolerance on the peak memory.')
+    parser.add_argument('--cases', default='', help='Comma separated tags of the cases to run (default all).')
+    parser.add_argument('--update_baselines', action='store_true', help='Store the results as the new baselines.')
+    return parser.parse_args()
+
+def print_kernels(kernels):
+    '''Per-kernel times of the runtime profiler, sorted by the maximum time over the ranks.'''
+    if not kernels:
+        return
+    print('  %-22s %10s %12s %12s' % ('Kernel', 'Calls', 'Avg_Time', 'Max_Time'))
+    for name, data in sorted(kernels.items(), key=lambda item: -item[1]['max_time']):
+        if data['calls'] > 0:
+            print('  %-22s %10d %12.4g %12.4g' % (name, data['calls'], data['avg_time'], data['max_time']))
+
+def main():
+    '''This program runs a curated set of SU2 cases at fixed iteration counts and checks that
+       the time per iteration and the memory usage did not regress with respect to stored baselines.
+       The baselines depend on the machine, they are created with --update_baselines. '''
+
+    args = parse_perf_args()
+
+    test_list = []
+
+    # Inviscid ONERA M6
+    inv_oneram6           = TestCase('inv_oneram6')
+    inv_oneram6.cfg_dir   = "euler/oneram6"
+    inv_oneram6.cfg_file  = "inv_ONERAM6.cfg"
+    inv_oneram6.test_iter = 50
+    test_list.append(inv_oneram6)
+
+    # RANS NACA0012 with SA
+    turb_naca0012_sa           = TestCase('turb_naca0012_sa')
+    turb_naca0012_sa.cfg_dir   = "rans/naca0012"
+    turb_naca0012_sa.cfg_file  = "turb_NACA0012_sa.cfg"
+    turb_naca0012_sa.test_iter = 50
+    test_list.append(turb_naca0012_sa)
+
+    # Incompressible RANS NACA0012
+    inc_turb_naca0012           = TestCase('inc_turb_naca0012')
+    inc_turb_naca0012.cfg_dir   = "incomp_rans/naca0012"
+    inc_turb_naca0012.cfg_file  = "naca0012.cfg"
+    inc_turb_naca0012.test_iter = 50
+    test_list.append(inc_turb_naca0012)
+
+    # NEMO inviscid wedge
+    invwedge           = TestCase('invwedge')
+    invwedge.cfg_dir   = "nonequilibrium/invwedge"
+    invwedge.cfg_file  = "invwedge_ausm.cfg"
+    invwedge.test_iter = 50
+    test_list.append(invwedge)
+
+    # DG-FEM NACA0012, 5th order
+    fem_naca0012           = TestCase('fem_naca0012')
+    fem_naca0012.cfg_dir   = "hom_euler/NACA0012_5thOrder"
+    fem_naca0012.cfg_file  = "fem_NACA0012_reg.cfg"
+    fem_naca0012.test_iter = 10
+    test_list.append(fem_naca0012)
+
+    # FEA static beam
+    statbeam3d           = TestCase('statbeam3d')
+    statbeam3d.cfg_dir   = "fea_fsi/StatBeam_3d"
+    statbeam3d.cfg_file  = "configBeam_3d.cfg"
+    statbeam3d.test_iter = 10
+    test_list.append(statbeam3d)
+
+    # Discrete adjoint RANS NACA0012
+    discadj_rans_naca0012_sa           = TestCase('discadj_rans_naca0012_sa')
+    discadj_rans_naca0012_sa.cfg_dir   = "disc_adj_rans/naca0012"
+    discadj_rans_naca0012_sa.cfg_file  = "turb_NACA0012_sa.cfg"
+    discadj_rans_naca0012_sa.test_iter = 10
+    discadj_rans_naca0012_sa.command   = TestCase.Command(exec = "SU2_CFD_AD")
+    test_list.append(discadj_rans_naca0012_sa)
+
+    if args.cases:
+        tags = args.cases.split(',')
+        test_list = [test for test in test_list if test.tag in tags]
+
+    for test in test_list:
+        test.timeout = 3600
+
+    ranks = [int(n) for n in args.ranks.split(',')]
+    threads = [int(n) for n in args.threads.split(',')]
+
+    baselines = {}
+    if os.path.exists(args.baselines):
+        with open(args.baselines, 'r') as f:
+            baselines = json.load(f)
+
+    # Strong scaling runs, first varying the ranks (1 thread) then the threads (1 rank)
+    configurations = [(n, 1) for n in ranks] + [(1, n) for n in threads if n != 1]
+
+    results = {}
+    pass_list = []
+    for test in test_list:
+        results[test.tag] = {}
+        for nranks, nthreads in configurations:
+            key = '%dx%d' % (nranks, nthreads)
+            result = test.run_perf(nranks, nthreads)
+            results[test.tag][key] = result
+
+            passed = result is not None
+            if passed:
+                print_kernels(result['kernels'])
+                baseline = baselines.get(test.tag, {}).get(key)
+                if baseline is None:
+                    print('No baseline for %s (%s).' % (test.tag, key))
+                else:
+                    time_ratio = result['time_per_iter'] / baseline['time_per_iter']
+                    mem_ratio = result['memory'] / baseline['memory']
+                    print('Time per iteration: %.3f x baseline, peak memory: %.3f x baseline.' % (time_ratio, mem_ratio))
+                    if time_ratio > 1 + args.tol:
+                        print('ERROR: The time per iteration exceeds the tolerance.')
+                        passed = False
+                    if mem_ratio > 1 + args.mem_tol:
+                        print('ERROR: The peak memory exceeds the tolerance.')
+                        passed = False
+            pass_list.append((test.tag, key, passed))
+
+    with open(args.results, 'w') as f:
+        json.dump(results, f, indent=2)
+
+    if args.update_baselines:
+        for tag, runs in results.items():
+            for key, result in runs.items():
+                if result is not None:
+                    baselines.setdefault(tag, {})[key] = {'time_per_iter': result['time_per_iter'],
+                                                          'memory': result['memory']}
+        with open(args.baselines, 'w') as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+
+    # Strong scaling summary, efficiency = t(1x1) / (t(RxT) * R * T)
+    print('==================================================================')
+    print('Strong scaling (parallel efficiency w.r.t. 1 rank x 1 thread)')
+    for tag, runs in results.items():
+        serial = runs.get('1x1')
+        line = '  %-26s' % tag
+        for nranks, nthreads in configurations:
+            result = runs.get('%dx%d' % (nranks, nthreads))
+            if serial is None or result is None:
+                line += ' %6s: %5s' % ('%dx%d' % (nranks, nthreads), '-')
+            else:
+                efficiency = serial['time_per_iter'] / (result['time_per_iter'] * nranks * nthreads)
+                line += ' %6s: %5.2f' % ('%dx%d' % (nranks, nthreads), efficiency)
+        print(line)
+
+    # Tests summary
+    print('==================================================================')
+    print('Summary of the performance tests')
+    print('python version:', sys.version)
+    for tag, key, passed in pass_list:
+        if passed:
+            print('  passed - %s (%s)' % (tag, key))
+        else:
+            print('* FAILED - %s (%s)' % (tag, key))
+
+    if all(passed for _, _, passed in pass_list):
+        sys.exit(0)
+    else:
+        sys.exit(1)
+    # done
+
+if __name__ == '__main__':
+    main()
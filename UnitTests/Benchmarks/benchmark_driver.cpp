@@ -0,0 +1,61 @@
+/*!
+ * \file benchmark_driver.cpp
+ * \brief The main entry point for the kernel micro-benchmarks.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*--- Custom main, with an extra command line option for the size of the meshes. Run with "-r xml" (or junit)
+ * for machine-readable results. ---*/
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+
+#include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/option_structure.hpp"
+
+/*--- Declared in BenchmarkCase.hpp. ---*/
+unsigned long BenchmarkMeshSize = 32;
+
+int main(int argc, char* argv[]) {
+  /*--- Startup MPI, if supported ---*/
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  Catch::Session session;
+
+  using Catch::clara::Opt;
+  auto cli = session.cli() | Opt(BenchmarkMeshSize, "points")["--mesh-size"](
+                                 "number of points in each direction of the benchmark meshes (default 32)");
+  session.cli(cli);
+
+  int result = session.applyCommandLine(argc, argv);
+  if (result == 0) result = session.run();
+
+  /*--- Finalize MPI parallelization ---*/
+  SU2_MPI::Finalize();
+
+  return result;
+}
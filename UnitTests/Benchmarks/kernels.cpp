@@ -0,0 +1,160 @@
+/*!
+ * \file kernels.cpp
+ * \brief Micro-benchmarks of the FVM kernels (fluxes, gradients, limiters, sparse linear algebra, ADT, halo
+ *        exchange) on generated box meshes.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include "BenchmarkCase.hpp"
+#include "../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include "../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeLimiters.hpp"
+
+namespace {
+/*!
+ * \brief Smooth field with two variables, with enough variation for the limiters to be active.
+ */
+su2activematrix TestField(const CGeometry& geometry) {
+  su2activematrix field(geometry.GetnPoint(), 2);
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    field(iPoint, 0) = sin(5 * coord[0]) * cos(3 * coord[1]) + pow(coord[2], 2);
+    field(iPoint, 1) = tanh(10 * (coord[0] + coord[1] - coord[2]));
+  }
+  return field;
+}
+}  // namespace
+
+TEST_CASE("Edge fluxes", "[Benchmark][Fluxes]") {
+  BenchmarkCase bench;
+  bench.InitSolver();
+  auto* flowSolver = bench.solver[FLOW_SOL];
+
+  BENCHMARK("Roe, MUSCL (SIMD)") {
+    flowSolver->Upwind_Residual(bench.geometry.get(), bench.solver, nullptr, bench.config.get(), MESH_0);
+  };
+}
+
+TEST_CASE("Gradients and limiters", "[Benchmark][Gradients]") {
+  BenchmarkCase bench;
+  auto& geometry = *bench.geometry;
+  auto& config = *bench.config;
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+
+  const auto field = TestField(geometry);
+  const auto nVar = field.cols();
+  C3DDoubleMatrix R(nPoint, nDim, nDim), gradient(nPoint, nVar, nDim);
+  su2activematrix fieldMin(nPoint, nVar), fieldMax(nPoint, nVar), limiter(nPoint, nVar);
+
+  BENCHMARK("Green-Gauss") {
+    computeGradientsGreenGauss(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config, field, 0, nVar, -1,
+                               gradient);
+  };
+  BENCHMARK("Weighted least squares") {
+    computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config, true, field, 0,
+                                 nVar, -1, gradient, R);
+  };
+  BENCHMARK("Venkatakrishnan limiter") {
+    computeLimiters(LIMITER::VENKATAKRISHNAN, nullptr, MPI_QUANTITIES::SOLUTION_LIMITER, PERIODIC_NONE,
+                    PERIODIC_NONE, geometry, config, 0, nVar, field, gradient, fieldMin, fieldMax, limiter);
+  };
+}
+
+TEST_CASE("Sparse linear algebra", "[Benchmark][LinearAlgebra]") {
+  BenchmarkCase bench;
+  auto* geometry = bench.geometry.get();
+  const auto* config = bench.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  constexpr unsigned short nVar = 5;
+
+  /*--- Diagonally dominant block matrix with the sparsity of the edge connectivity. ---*/
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  su2double block[nVar * nVar];
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+    for (auto k = 0u; k < nVar * nVar; ++k) block[k] = -0.1 / (1 + k % (nVar + 1));
+    matrix.SetBlock(iPoint, jPoint, block);
+    matrix.SetBlock(jPoint, iPoint, block);
+  }
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    matrix.AddVal2Diag(iPoint, 2.0 * geometry->nodes->GetnPoint(iPoint));
+  }
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar, 1.0), y(nPoint, nPointDomain, nVar, 0.0);
+
+  BENCHMARK("SpMV") { matrix.MatrixVectorProduct(x, y, geometry, config); };
+  BENCHMARK("ILU build") { matrix.BuildILUPreconditioner(); };
+  BENCHMARK("ILU application") { matrix.ComputeILUPreconditioner(x, y, geometry, config); };
+}
+
+TEST_CASE("ADT nearest point queries", "[Benchmark][ADT]") {
+  BenchmarkCase bench;
+  const auto& geometry = *bench.geometry;
+  const auto nPoint = geometry.GetnPointDomain();
+  const auto nDim = geometry.GetnDim();
+
+  vector<su2double> coord(nPoint * nDim);
+  vector<unsigned long> pointID(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iPoint * nDim + iDim] = geometry.nodes->GetCoord(iPoint, iDim);
+    pointID[iPoint] = iPoint;
+  }
+
+  /*--- Query points shifted from the mesh points. ---*/
+  vector<su2double> query(coord);
+  for (auto& x : query) x += 0.1 / BenchmarkMeshSize;
+  vector<su2double> dist(nPoint);
+  vector<unsigned long> nearest(nPoint);
+  vector<int> rank(nPoint);
+
+  BENCHMARK("Build (local)") {
+    CADTPointsOnlyClass tree(nDim, nPoint, coord.data(), pointID.data(), false);
+    return tree.IsEmpty();
+  };
+
+  CADTPointsOnlyClass adt(nDim, nPoint, coord.data(), pointID.data(), false);
+  BENCHMARK("Query all points") {
+    adt.DetermineNearestNodes(nPoint, query.data(), nDim, dist.data(), nearest.data(), rank.data());
+  };
+}
+
+TEST_CASE("Halo exchange", "[Benchmark][Communication]") {
+  BenchmarkCase bench;
+  auto* geometry = bench.geometry.get();
+  const auto* config = bench.config.get();
+
+  BENCHMARK("Coordinates") {
+    geometry->InitiateComms(geometry, config, MPI_QUANTITIES::COORDINATES);
+    geometry->CompleteComms(geometry, config, MPI_QUANTITIES::COORDINATES);
+  };
+}
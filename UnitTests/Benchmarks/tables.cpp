@@ -0,0 +1,105 @@
+/*!
+ * \file tables.cpp
+ * \brief Micro-benchmarks of the thermochemistry look-up table and of the MLP inference.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <vector>
+
+#include "BenchmarkCase.hpp"
+#include "../../Common/include/containers/CLookUpTable.hpp"
+#if defined(HAVE_MLPCPP)
+#include "../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
+#endif
+
+namespace {
+/*!
+ * \brief Deterministic uniformly distributed values in [lower, upper].
+ */
+std::vector<su2double> Samples(unsigned long n, su2double lower, su2double upper, unsigned long seed) {
+  std::vector<su2double> values(n);
+  for (auto i = 0ul; i < n; ++i) {
+    seed = (1103515245 * seed + 12345) % 2147483648ul;
+    values[i] = lower + (upper - lower) * seed / 2147483648.0;
+  }
+  return values;
+}
+}  // namespace
+
+TEST_CASE("Look-up table queries", "[Benchmark][LookUpTable]") {
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  CLookUpTable table("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable", "EnthalpyTot");
+  cout.rdbuf(origBuf);
+
+  /*--- As many queries as points in the benchmark meshes. ---*/
+  const auto nQuery = BenchmarkMeshSize * BenchmarkMeshSize * BenchmarkMeshSize;
+  const auto prog = Samples(nQuery, 0.0, 1.0, 1);
+  const auto enth = Samples(nQuery, -1.0, 1.0, 2);
+
+  const std::vector<unsigned long> idxVars = {table.GetIndexOfVar("Density"), table.GetIndexOfVar("Viscosity")};
+  std::vector<su2double> values(nQuery * idxVars.size());
+  std::vector<unsigned long> outside(nQuery);
+
+  BENCHMARK("Single point, one variable") {
+    su2double sum = 0.0, value;
+    for (auto i = 0ul; i < nQuery; ++i) {
+      table.LookUp_XY(idxVars[0], &value, prog[i], enth[i]);
+      sum += value;
+    }
+    return sum;
+  };
+  BENCHMARK("Batch, two variables") {
+    table.LookUp_XY_Batch(nQuery, idxVars, prog.data(), enth.data(), values.data(), outside.data());
+  };
+}
+
+#if defined(HAVE_MLPCPP)
+TEST_CASE("MLP inference", "[Benchmark][MLP]") {
+  std::string inputFiles[] = {"src/SU2/UnitTests/Common/toolboxes/multilayer_perceptron/simple_mlp.mlp"};
+  MLPToolbox::CLookUp_ANN ANN(1, inputFiles);
+
+  std::vector<std::string> inputNames = {"x", "y"}, outputNames = {"z"};
+  MLPToolbox::CIOMap iomap(inputNames, outputNames);
+  ANN.PairVariableswithMLPs(iomap);
+
+  const auto nQuery = BenchmarkMeshSize * BenchmarkMeshSize * BenchmarkMeshSize;
+  const auto x = Samples(nQuery, -2.0, 2.0, 3);
+  const auto y = Samples(nQuery, -2.0, 2.0, 4);
+
+  BENCHMARK("Two inputs, one output") {
+    su2double z, sum = 0.0;
+    std::vector<double> inputs(2);
+    std::vector<double*> outputs = {&z};
+    for (auto i = 0ul; i < nQuery; ++i) {
+      inputs[0] = SU2_TYPE::GetValue(x[i]);
+      inputs[1] = SU2_TYPE::GetValue(y[i]);
+      ANN.PredictANN(&iomap, inputs, outputs);
+      sum += z;
+    }
+    return sum;
+  };
+}
+#endif
@@ -27,6 +27,7 @@
 
 #include "catch.hpp"
 
+#include <fstream>
 #include <sstream>
 #include <stdio.h>
 
@@ -136,3 +137,146 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(idx_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_binary", "[tabulated chemistry]") {
+  /*--- the binary table must give the same results as the ASCII table it was written from ---*/
+
+  CLookUpTable look_up_table_ascii("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                                   "EnthalpyTot");
+  if (SU2_MPI::GetRank() == MASTER_NODE) look_up_table_ascii.WriteBinary("lookuptable_3D.drb");
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  CLookUpTable look_up_table("lookuptable_3D.drb", "ProgressVariable", "EnthalpyTot");
+
+  const unsigned long idx_rho = look_up_table.GetIndexOfVar("Density");
+  const unsigned long idx_mu = look_up_table.GetIndexOfVar("Viscosity");
+  CHECK(idx_rho == look_up_table_ascii.GetIndexOfVar("Density"));
+
+  /*--- points inside and outside of the table ---*/
+
+  const su2double prog[] = {0.55, 0.6, 1.1}, enth[] = {-0.5, 0.9, 1.1}, mfrac[] = {0.5, 0.8, 2.0};
+
+  for (int i = 0; i < 3; ++i) {
+    for (const auto idx_tag : {idx_rho, idx_mu}) {
+      su2double look_up_dat, look_up_dat_ascii;
+      const bool inside = look_up_table.LookUp_XYZ(idx_tag, &look_up_dat, prog[i], enth[i], mfrac[i]);
+      const bool inside_ascii =
+          look_up_table_ascii.LookUp_XYZ(idx_tag, &look_up_dat_ascii, prog[i], enth[i], mfrac[i]);
+      CHECK(inside == inside_ascii);
+      CHECK(SU2_TYPE::GetValue(look_up_dat) == SU2_TYPE::GetValue(look_up_dat_ascii));
+    }
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) remove("lookuptable_3D.drb");
+}
+
+TEST_CASE("LUTreader_search_grid", "[tabulated chemistry]") {
+  /*--- the search grid must locate the points found by the trapezoidal map (it also finds some points next
+   * to vertical edges that the trapezoidal map misses) ---*/
+
+  CLookUpTable look_up_table_tmap("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable",
+                                  "EnthalpyTot");
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable",
+                             "EnthalpyTot");
+  look_up_table.BuildSearchGrid();
+
+  const unsigned long idx_rho = look_up_table.GetIndexOfVar("Density");
+
+  /*--- sweep of points inside and outside of the table, consecutive points reuse the last triangle ---*/
+
+  for (int i = -2; i <= 22; ++i) {
+    for (int j = -2; j <= 22; ++j) {
+      const su2double prog = 0.05 * i + 0.013, enth = -1.0 + 0.1 * j + 0.007;
+      su2double look_up_dat, look_up_dat_tmap;
+      const bool inside = look_up_table.LookUp_XY(idx_rho, &look_up_dat, prog, enth);
+      const bool inside_tmap = look_up_table_tmap.LookUp_XY(idx_rho, &look_up_dat_tmap, prog, enth);
+      if (inside_tmap || !inside) {
+        CHECK(inside == inside_tmap);
+        CHECK(SU2_TYPE::GetValue(look_up_dat) == Approx(SU2_TYPE::GetValue(look_up_dat_tmap)));
+      }
+    }
+  }
+}
+
+TEST_CASE("LUTreader_batch", "[tabulated chemistry]") {
+  /*--- the batch lookup (on the offload device if available) must match the lookup of the points one at a time ---*/
+
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable.drg", "ProgressVariable",
+                             "EnthalpyTot");
+  look_up_table.BuildSearchGrid();
+
+  const std::vector<unsigned long> idx_var = {look_up_table.GetIndexOfVar("Density"), look_up_table.GetNullIndex()};
+
+  /*--- large enough to be offloaded, with points inside and outside of the table ---*/
+  const unsigned long n_batch = 5000;
+  std::vector<su2double> prog(n_batch), enth(n_batch), vals(2 * n_batch);
+  std::vector<unsigned long> outside(n_batch);
+  for (auto i = 0ul; i < n_batch; ++i) {
+    prog[i] = 0.0125 * (i % 100) - 0.1 + 0.003;
+    enth[i] = 0.025 * (i / 100) - 1.2 + 0.007;
+  }
+  look_up_table.LookUp_XY_Batch(n_batch, idx_var, prog.data(), enth.data(), vals.data(), outside.data());
+
+  std::vector<su2double> look_up_dat(2);
+  for (auto i = 0ul; i < n_batch; ++i) {
+    const bool inside = look_up_table.LookUp_XY(idx_var, look_up_dat, prog[i], enth[i]);
+    CHECK(outside[i] == !inside);
+    CHECK(SU2_TYPE::GetValue(vals[2 * i]) == Approx(SU2_TYPE::GetValue(look_up_dat[0])));
+    CHECK(SU2_TYPE::GetValue(vals[2 * i + 1]) == 0.0);
+  }
+}
+
+TEST_CASE("LUTreader_structured", "[tabulated chemistry]") {
+  /*--- regular table (non-uniform in x, uniform in y) of a bilinear function, which must be interpolated exactly ---*/
+
+  const double x[] = {0.0, 0.2, 0.5, 1.0}, y[] = {-1.0, 0.0, 1.0};
+  auto f = [](double x, double y) { return 1.0 + 0.5 * x + 0.25 * y + 2.0 * x * y; };
+  auto id = [](int ix, int iy) { return 1 + ix + 4 * iy; };
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    std::ofstream file("lookuptable_structured.drg");
+    file << "Dragon library\n\n<Header>\n[Version]\n1.0.1\n\n[Number of points]\n12\n\n[Number of triangles]\n12\n\n"
+         << "[Number of hull points]\n10\n\n[Number of variables]\n3\n\n[Variable names]\n"
+         << "ProgressVariable\nEnthalpyTot\nDensity\n\n</Header>\n\n<Data>\n";
+    for (int iy = 0; iy < 3; ++iy)
+      for (int ix = 0; ix < 4; ++ix) file << x[ix] << " " << y[iy] << " " << f(x[ix], y[iy]) << "\n";
+    file << "</Data>\n\n<Connectivity>\n";
+    for (int iy = 0; iy < 2; ++iy) {
+      for (int ix = 0; ix < 3; ++ix) {
+        file << id(ix, iy) << " " << id(ix + 1, iy) << " " << id(ix + 1, iy + 1) << "\n";
+        file << id(ix, iy) << " " << id(ix + 1, iy + 1) << " " << id(ix, iy + 1) << "\n";
+      }
+    }
+    file << "</Connectivity>\n\n<Hull>\n";
+    for (const int i : {id(0, 0), id(1, 0), id(2, 0), id(3, 0), id(3, 1), id(3, 2), id(2, 2), id(1, 2), id(0, 2),
+                        id(0, 1)})
+      file << i << "\n";
+    file << "</Hull>\n";
+  }
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  CLookUpTable look_up_table("lookuptable_structured.drg", "ProgressVariable", "EnthalpyTot");
+  CHECK(look_up_table.DetectStructuredLevels() == 1);
+
+  const std::vector<unsigned long> idx_var = {look_up_table.GetIndexOfVar("Density")};
+  const su2double prog[] = {0.1, 0.35, 0.9, 1.0, 0.0, 1.2}, enth[] = {-0.3, 0.6, 0.95, 1.0, -1.0, 0.5};
+  su2double vals[6];
+  unsigned long outside[6];
+  look_up_table.LookUp_XY_Batch(6, idx_var, prog, enth, vals, outside);
+
+  std::vector<su2double> look_up_dat(1);
+  for (int i = 0; i < 6; ++i) {
+    const bool inside = look_up_table.LookUp_XY(idx_var, look_up_dat, prog[i], enth[i]);
+    CHECK(inside == (i < 5));
+    CHECK(outside[i] == !inside);
+    CHECK(SU2_TYPE::GetValue(vals[i]) == Approx(SU2_TYPE::GetValue(look_up_dat[0])));
+    if (inside) {
+      CHECK(SU2_TYPE::GetValue(look_up_dat[0]) ==
+            Approx(f(SU2_TYPE::GetValue(prog[i]), SU2_TYPE::GetValue(enth[i]))));
+    }
+  }
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) remove("lookuptable_structured.drg");
+}
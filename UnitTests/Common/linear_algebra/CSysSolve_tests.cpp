@@ -0,0 +1,168 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the Krylov solvers and preconditioners of CSysSolve, on a Laplacian system.
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+namespace {
+using ScalarType = su2mixedfloat;
+
+/*!
+ * \brief Shifted graph Laplacian of the edges of a box mesh (SPD, conditioned like a diffusion problem),
+ *        the right hand side is such that the solution is 1.
+ */
+struct LaplacianProblem {
+  UnitQuadTestCase test;
+  CSysMatrix<ScalarType> A;
+  CSysVector<ScalarType> b, x;
+
+  explicit LaplacianProblem(passivedouble offDiagonal = -1.0) {
+    /*--- The AMG only coarsens systems with more than 1024 unknowns. ---*/
+    const std::string boxSize = "MESH_BOX_SIZE=5,5,5";
+    test.config_options.replace(test.config_options.find(boxSize), boxSize.size(), "MESH_BOX_SIZE=15,15,15");
+    test.InitConfig();
+    test.InitGeometry();
+
+    auto* geometry = test.geometry.get();
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+
+    A.Initialize(nPoint, nPointDomain, 1, 1, true, geometry, test.config.get());
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) A.AddVal2Diag(iPoint, 1e-2);
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      A.AddVal2Diag(iPoint, -offDiagonal);
+      A.AddVal2Diag(jPoint, -offDiagonal);
+      A.SetBlock(iPoint, jPoint, &offDiagonal);
+      A.SetBlock(jPoint, iPoint, &offDiagonal);
+    }
+
+    b.Initialize(nPoint, nPointDomain, 1, 0.0);
+    x.Initialize(nPoint, nPointDomain, 1, 1.0);
+    MatVec()(x, b);
+  }
+
+  CSysMatrixVectorProduct<ScalarType> MatVec() {
+    return CSysMatrixVectorProduct<ScalarType>(A, test.geometry.get(), test.config.get());
+  }
+
+  /*!
+   * \brief Solve from a zero initial guess, returns the number of iterations.
+   */
+  unsigned long Solve(ENUM_LINEAR_SOLVER_PREC kind, bool pipelined, ScalarType tol, unsigned long maxIter,
+                      ScalarType& residual) {
+    auto* geometry = test.geometry.get();
+    const auto* config = test.config.get();
+
+    std::unique_ptr<CPreconditioner<ScalarType> > precond(
+        CPreconditioner<ScalarType>::Create(kind, A, geometry, config));
+    precond->Build();
+
+    x = ScalarType(0);
+    CSysSolve<ScalarType> solver;
+    const auto matVec = MatVec();
+
+    if (pipelined) return solver.PFGMRES_LinSolver(b, x, matVec, *precond, tol, maxIter, residual, false, config);
+    return solver.FGMRES_LinSolver(b, x, matVec, *precond, tol, maxIter, residual, false, config);
+  }
+
+  /*!
+   * \brief Max error w.r.t. the exact solution.
+   */
+  passivedouble Error() const {
+    passivedouble error = 0.0;
+    for (auto iPoint = 0ul; iPoint < x.GetNBlkDomain(); ++iPoint)
+      error = std::max(error, std::abs(SU2_TYPE::GetValue(x(iPoint, 0)) - 1.0));
+    return error;
+  }
+};
+}  // namespace
+
+TEST_CASE("AMG preconditioner", "[LinearAlgebra]") {
+  LaplacianProblem p;
+  const ScalarType tol = 1e-8;
+  const unsigned long maxIter = 200;
+  ScalarType residual = 0;
+
+  const auto iterJacobi = p.Solve(JACOBI, false, tol, maxIter, residual);
+  CHECK(residual < tol);
+  CHECK(p.Error() < 1e-4);
+
+  const auto iterAMG = p.Solve(AMG, false, tol, maxIter, residual);
+  CHECK(residual < tol);
+  CHECK(p.Error() < 1e-4);
+
+  /*--- The multigrid should need far fewer iterations than the one-level preconditioner. ---*/
+  CHECK(3 * iterAMG < iterJacobi);
+
+  /*--- And reduce the residual more than ILU(0) in a fixed number of iterations. ---*/
+  ScalarType resILU = 0, resAMG = 0;
+  p.Solve(ILU, false, 0, 10, resILU);
+  p.Solve(AMG, false, 0, 10, resAMG);
+  CHECK(resAMG < resILU);
+}
+
+TEST_CASE("Pipelined FGMRES", "[LinearAlgebra]") {
+  LaplacianProblem p;
+  const ScalarType tol = 1e-8;
+  const unsigned long maxIter = 200;
+  ScalarType residual = 0, refResidual = 0;
+
+  const auto iterRef = p.Solve(ILU, false, tol, maxIter, refResidual);
+  const auto iter = p.Solve(ILU, true, tol, maxIter, residual);
+
+  /*--- Same Krylov subspace, hence the same convergence up to round-off. ---*/
+  CHECK(residual < tol);
+  CHECK(p.Error() < 1e-4);
+  CHECK(iter <= iterRef + 1);
+  CHECK(iter + 1 >= iterRef);
+
+  /*--- The recomputed residual agrees with the one estimated by the solver. ---*/
+  CSysVector<ScalarType> r(p.b.GetNBlk(), p.b.GetNBlkDomain(), 1, 0.0);
+  p.MatVec()(p.x, r);
+  r -= p.b;
+  CHECK(SU2_TYPE::GetValue(r.norm() / p.b.norm()) < 2 * tol);
+}
+
+TEST_CASE("Pipelined FGMRES happy breakdown", "[LinearAlgebra]") {
+  /*--- Diagonal system, with the Jacobi preconditioner the Krylov subspace is invariant after one iteration. ---*/
+  LaplacianProblem p(0.0);
+  ScalarType residual = 0;
+
+  const auto iter = p.Solve(JACOBI, true, 1e-14, 50, residual);
+  CHECK(iter == 1);
+  CHECK(residual < 1e-12);
+  CHECK(p.Error() < 1e-12);
+}
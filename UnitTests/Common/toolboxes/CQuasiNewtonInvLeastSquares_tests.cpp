@@ -1,6 +1,6 @@
 /*!
  * \file CQuasiNewtonInvLeastSquares_tests.cpp
- * \brief Unit tests for the CQuasiNewtonInvLeastSquares class.
+ * \brief Unit tests for the CQuasiNewtonInvLeastSquares and CQuasiNewtonInvLeastSquaresQR classes.
  * Which should find the root of a n-d linear problem in n+1 iterations.
  * \author P. Gomes
  * \version 8.1.0 "Harrier"
@@ -30,6 +30,7 @@
 #include <sstream>
 #include <iomanip>
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquaresQR.hpp"
 
 struct Problem {
   static constexpr int N = 4;
@@ -70,3 +71,29 @@ TEST_CASE("QN-ILS", "[Toolboxes]") {
 
   for (int i = 0; i < Problem::N; ++i) CHECK(qnils(i, 0) == Approx(1.0));
 }
+
+TEST_CASE("QN-ILS QR", "[Toolboxes]") {
+  Problem p, pRef;
+  CQuasiNewtonInvLeastSquares<passivedouble> qnils(Problem::N + 1, Problem::N, 1);
+  CQuasiNewtonInvLeastSquaresQR<passivedouble> qnilsQR;
+  /*--- No filtering and no relaxation, to reproduce the normal equations version. ---*/
+  qnilsQR.resize(Problem::N, 1, Problem::N, Problem::N, 1, 0.0, 1.0);
+  qnilsQR.newTimeStep();
+
+  /*--- Check the iterates are the same. ---*/
+  for (int i = 0; i <= Problem::N; ++i) {
+    iterate(pRef, qnils);
+    iterate(p, qnilsQR);
+    for (int j = 0; j < Problem::N; ++j) CHECK(qnilsQR(j, 0) == Approx(qnils(j, 0)));
+  }
+  for (int i = 0; i < Problem::N; ++i) CHECK(qnilsQR(i, 0) == Approx(1.0));
+
+  /*--- The history of the previous time step solves the same problem in one iteration. ---*/
+  qnilsQR.newTimeStep();
+  const auto nColumns = qnilsQR.size();
+  REQUIRE(nColumns == static_cast<decltype(nColumns)>(Problem::N));
+  for (int i = 0; i < Problem::N; ++i) qnilsQR(i, 0) = 0.0;
+  iterate(p, qnilsQR);
+
+  for (int i = 0; i < Problem::N; ++i) CHECK(qnilsQR(i, 0) == Approx(1.0));
+}
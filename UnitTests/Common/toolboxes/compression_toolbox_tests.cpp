@@ -0,0 +1,125 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests for the compression of blocks of doubles (compressed restart files).
+ * \version 8.1.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+namespace {
+/*--- Smooth field with a wide range of magnitudes and signs, plus some special values. ---*/
+std::vector<passivedouble> TestValues() {
+  std::vector<passivedouble> values;
+  for (int i = 0; i < 1000; ++i) values.push_back(std::sin(0.01 * i) * std::pow(10.0, (i % 17) - 8));
+  values.push_back(0.0);
+  values.push_back(-0.0);
+  values.push_back(std::numeric_limits<passivedouble>::denorm_min());
+  values.push_back(std::numeric_limits<passivedouble>::max());
+  values.push_back(-std::numeric_limits<passivedouble>::infinity());
+  values.push_back(std::numeric_limits<passivedouble>::quiet_NaN());
+  return values;
+}
+
+bool BitwiseEqual(const std::vector<passivedouble>& a, const std::vector<passivedouble>& b) {
+  return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(passivedouble)) == 0;
+}
+}  // namespace
+
+TEST_CASE("Quantize error bound", "[Toolboxes]") {
+  const auto original = TestValues();
+
+  for (const passivedouble tolerance : {1e-2, 1e-6, 3e-9, 1e-13}) {
+    auto values = original;
+    CompressionToolbox::Quantize(values.data(), values.size(), tolerance);
+
+    for (auto i = 0ul; i < values.size(); ++i) {
+      if (std::isfinite(original[i])) {
+        CHECK(std::abs(values[i] - original[i]) <= tolerance);
+      } else {
+        /*--- Special values are not modified. ---*/
+        CHECK(std::memcmp(&values[i], &original[i], sizeof(passivedouble)) == 0);
+      }
+    }
+  }
+
+  /*--- A non-positive tolerance means lossless. ---*/
+  auto values = original;
+  CompressionToolbox::Quantize(values.data(), values.size(), 0.0);
+  CHECK(BitwiseEqual(values, original));
+}
+
+TEST_CASE("Shuffle and unshuffle", "[Toolboxes]") {
+  const auto original = TestValues();
+  const auto n = original.size();
+  constexpr auto nByte = sizeof(passivedouble);
+
+  std::vector<unsigned char> shuffled(n * nByte);
+  CompressionToolbox::Shuffle(original.data(), n, shuffled.data());
+
+  /*--- Byte b of value i is at b * n + i. ---*/
+  const auto* bytes = reinterpret_cast<const unsigned char*>(original.data());
+  bool layout = true;
+  for (auto i = 0ul; i < n; ++i)
+    for (auto b = 0ul; b < nByte; ++b) layout &= (shuffled[b * n + i] == bytes[i * nByte + b]);
+  CHECK(layout);
+
+  std::vector<passivedouble> values(n);
+  CompressionToolbox::Unshuffle(shuffled.data(), n, values.data());
+  CHECK(BitwiseEqual(values, original));
+}
+
+TEST_CASE("Compress and decompress", "[Toolboxes]") {
+#ifdef HAVE_ZLIB
+  REQUIRE(CompressionToolbox::Available());
+
+  const auto original = TestValues();
+  const auto n = original.size();
+
+  /*--- The data is appended to the buffer. ---*/
+  std::vector<char> buffer(3, 'x');
+  const auto nBytes = CompressionToolbox::Compress(original.data(), n, buffer);
+  REQUIRE(buffer.size() == 3 + nBytes);
+
+  std::vector<passivedouble> values(n);
+  CompressionToolbox::Decompress(buffer.data() + 3, nBytes, values.data(), n);
+  CHECK(BitwiseEqual(values, original));
+
+  /*--- Quantized data is more compressible and still round trips exactly. ---*/
+  auto quantized = original;
+  CompressionToolbox::Quantize(quantized.data(), n, 1e-6);
+  std::vector<char> lossy;
+  const auto nLossy = CompressionToolbox::Compress(quantized.data(), n, lossy);
+  CHECK(nLossy < nBytes);
+
+  CompressionToolbox::Decompress(lossy.data(), nLossy, values.data(), n);
+  CHECK(BitwiseEqual(values, quantized));
+#else
+  /*--- Without zlib only the availability can be checked, compressing is an error. ---*/
+  CHECK_FALSE(CompressionToolbox::Available());
+#endif
+}
@@ -27,6 +27,7 @@
 
 #include "catch.hpp"
 #include "../../Common/include/parallelization/vectorization.hpp"
+#include "../../Common/include/containers/C2DContainer.hpp"
 
 using namespace std;
 
@@ -83,3 +84,25 @@ TEST_CASE("SIMD DOUBLE", "[Vectorization]") {
     CHECK(t[k] == 7);
   }
 }
+
+TEST_CASE("SIMD GATHER", "[Vectorization]") {
+  /*--- Rows of row-major matrices are gathered with transposed loads, plus a remainder. ---*/
+  using Double = simd::Array<double>;
+  using Int = simd::Array<unsigned long, Double::Size>;
+  constexpr size_t nCols = 2 * Double::Size + 1, nRows = 4 * Double::Size;
+
+  su2matrix<double> mat(nRows, nCols);
+  for (size_t i = 0; i < nRows; ++i)
+    for (size_t j = 0; j < nCols; ++j) mat(i, j) = i * nCols + j;
+
+  Int rows;
+  for (size_t k = 0; k < Int::Size; ++k) rows[k] = (3 * k + 1) % nRows;
+
+  const auto x = mat.get<C2DContainer<unsigned long, Double, StorageType::ColumnMajor, Double::Align, nCols - 1, 1> >(rows, 1);
+
+  for (size_t j = 0; j < nCols - 1; ++j) {
+    for (size_t k = 0; k < Double::Size; ++k) {
+      CHECK(x(j)[k] == mat(rows[k], j + 1));
+    }
+  }
+}
@@ -31,6 +31,7 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeGradientsAndLimiters.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -116,6 +117,19 @@ struct LinearFunction : public GradientTestBase {
   su2double grad(unsigned long, unsigned long, unsigned long iDim) const { return slope[iDim]; }
 };
 
+struct NonlinearFunction : public GradientTestBase {
+  const unsigned long nVar = 2;
+
+  /*!
+   * \brief Return manufactured value (with enough variation for the limiters to be active).
+   */
+  su2double operator()(unsigned long iPoint, unsigned long iVar) const {
+    const auto coord = geometry->nodes->GetCoord(iPoint);
+    if (iVar == 0) return sin(5 * coord[0]) * cos(3 * coord[1]) + pow(coord[2], 2);
+    return tanh(10 * (coord[0] + coord[1] - coord[2]));
+  }
+};
+
 template <class T, class U>
 void check(const T& ref, const U& calc, su2double tol = 1e-9) {
   su2double err = 0.0;
@@ -154,3 +168,100 @@ TEST_CASE("GG", "[Gradients]") { testGreenGauss<LinearFunction>(); }
 TEST_CASE("LS", "[Gradients]") { testLeastSquares<LinearFunction>(false); }
 
 TEST_CASE("WLS", "[Gradients]") { testLeastSquares<LinearFunction>(true); }
+
+template <class TestField>
+void testFusedLimiters(unsigned short kindGradient) {
+  TestField func;
+  auto& geometry = *func.geometry.get();
+  auto& config = *func.config.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  const auto nVar = func.nVar;
+
+  su2activematrix field(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) field(iPoint, iVar) = func(iPoint, iVar);
+
+  C3DDoubleMatrix R(nPoint, nDim, nDim), gradientRef(nPoint, nVar, nDim), gradient(nPoint, nVar, nDim);
+  su2activematrix minRef(nPoint, nVar), maxRef(nPoint, nVar), limiterRef(nPoint, nVar);
+  su2activematrix fieldMin(nPoint, nVar), fieldMax(nPoint, nVar), limiter(nPoint, nVar);
+
+  /*--- Reference, separate computation. ---*/
+  if (kindGradient == GREEN_GAUSS) {
+    computeGradientsGreenGauss(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config, field, 0, nVar, -1,
+                               gradientRef);
+  } else {
+    computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, config,
+                                 kindGradient == WEIGHTED_LEAST_SQUARES, field, 0, nVar, -1, gradientRef, R);
+  }
+  computeLimiters(LIMITER::VENKATAKRISHNAN, nullptr, MPI_QUANTITIES::SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE,
+                  geometry, config, 0, nVar, field, gradientRef, minRef, maxRef, limiterRef);
+
+  computeGradientsAndLimiters(LIMITER::VENKATAKRISHNAN, nullptr, MPI_QUANTITIES::SOLUTION, geometry, config,
+                              kindGradient, field, 0, nVar, -1, gradient, R, fieldMin, fieldMax, limiter);
+
+  su2double errGrad = 0.0, errLim = 0.0, minLim = 1.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        errGrad = max(errGrad, abs(gradient(iPoint, iVar, iDim) - gradientRef(iPoint, iVar, iDim)));
+      errLim = max(errLim, abs(limiter(iPoint, iVar) - limiterRef(iPoint, iVar)));
+      errLim = max(errLim, abs(fieldMin(iPoint, iVar) - minRef(iPoint, iVar)));
+      errLim = max(errLim, abs(fieldMax(iPoint, iVar) - maxRef(iPoint, iVar)));
+      minLim = min(minLim, limiterRef(iPoint, iVar));
+    }
+  }
+  CHECK(minLim < 0.5);
+  CHECK(errGrad < 1e-12);
+  CHECK(errLim < 1e-12);
+}
+
+TEST_CASE("GG with fused limiters", "[Gradients]") { testFusedLimiters<NonlinearFunction>(GREEN_GAUSS); }
+
+TEST_CASE("WLS with fused limiters", "[Gradients]") { testFusedLimiters<NonlinearFunction>(WEIGHTED_LEAST_SQUARES); }
+
+template <class TestField>
+void testCachedLeastSquares(bool weighted) {
+  TestField func;
+  auto& geometry = *func.geometry.get();
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  const auto nVar = func.nVar;
+
+  /*--- Same problem with the weights stored. ---*/
+  std::unique_ptr<CConfig> config;
+  {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    stringstream ss(func.configOptions + "CACHE_LEAST_SQUARES_WEIGHTS= YES\n");
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    cout.rdbuf(origBuf);
+  }
+
+  C3DDoubleMatrix R(nPoint, nDim, nDim), gradientRef(nPoint, nVar, nDim), gradient(nPoint, nVar, nDim);
+
+  computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, *func.config.get(),
+                               weighted, func, 0, nVar, -1, gradientRef, R);
+  CHECK(geometry.GetLeastSquaresWeights(weighted).empty());
+
+  /*--- The first call computes the weights, the second uses them. ---*/
+  for (int iCall = 0; iCall < 2; ++iCall) {
+    computeGradientsLeastSquares(nullptr, MPI_QUANTITIES::SOLUTION, PERIODIC_NONE, geometry, *config.get(), weighted,
+                                 func, 0, nVar, -1, gradient, R);
+    CHECK(!geometry.GetLeastSquaresWeights(weighted).empty());
+
+    su2double err = 0.0;
+    for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto iDim = 0ul; iDim < nDim; ++iDim)
+          err = max(err, abs(gradient(iPoint, iVar, iDim) - gradientRef(iPoint, iVar, iDim)));
+    CHECK(err < 1e-11);
+  }
+
+  geometry.ClearLeastSquaresWeights();
+  CHECK(geometry.GetLeastSquaresWeights(weighted).empty());
+}
+
+TEST_CASE("LS with cached weights", "[Gradients]") { testCachedLeastSquares<NonlinearFunction>(false); }
+
+TEST_CASE("WLS with cached weights", "[Gradients]") { testCachedLeastSquares<NonlinearFunction>(true); }